@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""compress_fonts.py -- convert --no-compress lv_font_conv fonts to compressed glyphs.
+
+Takes font sources lv_font_conv generated with --no-compress (plain 4 bpp
+bitmaps, tens of thousands of lines for the big display fonts) and rewrites
+each one in place with its glyph bitmaps in lv_font_conv's compressed format:
+rows XOR-prefiltered against the row above, then run-length coded (a value
+repeated once enters repeat mode, up to ten 1-bits each repeat it again, and
+longer runs take a 6-bit counter). The font's get_glyph_bitmap then points at
+font_glyph_cache_get_bitmap (main/ui/font_glyph_cache.h), which decodes each
+glyph once into a bounded PSRAM cache instead of on every draw.
+
+Every glyph is decoded again and compared with the original pixels before a
+file is written. The output is checked in; re-run after regenerating a font
+with --no-compress. Files already compressed are left alone.
+
+Usage: compress_fonts.py main/ui/lv_font_<name>.c [...]
+"""
+
+import re
+import sys
+
+BITMAP_RE = re.compile(r"(glyph_bitmap\[\] = \{\n)(.*?)(\n\};)", re.S)
+COMMENT_RE = re.compile(r"/\*.*?\*/", re.S)
+DSC_ROW_RE = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = -?\d+, "
+                        r"\.box_w = (\d+), \.box_h = (\d+),")
+INCLUDE_RE = re.compile(r'(#ifdef LV_LVGL_H_INCLUDE_SIMPLE\n.*?#endif\n|(?:#include "lvgl[^"]*"\n)+)', re.S)
+
+RLE_SKIP_COUNT = 1          # one repeat enters repeat mode
+RLE_BIT_COLLAPSED = 10      # repeats coded as single 1-bits
+RLE_COUNTER_BITS = 6
+RLE_MAX_RUN = RLE_BIT_COLLAPSED + (1 << RLE_COUNTER_BITS) - 1   # after the entry pair
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.nbits = 0
+
+    def write(self, value, bits):
+        for shift in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> shift) & 1)
+            self.nbits += 1
+            if self.nbits == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.nbits = 0
+
+    def flush(self):
+        if self.nbits:
+            self.out.append(self.acc << (8 - self.nbits))
+            self.acc = 0
+            self.nbits = 0
+        return bytes(self.out)
+
+
+class BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def read(self, bits):
+        v = 0
+        for _ in range(bits):
+            byte = self.data[self.pos >> 3]
+            v = (v << 1) | ((byte >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return v
+
+
+def unpack(data, offset, count, bpp):
+    r = BitReader(data)
+    r.pos = offset * 8
+    return [r.read(bpp) for _ in range(count)]
+
+
+def prefilter(pixels, w):
+    out = list(pixels[:w])
+    for i in range(w, len(pixels)):
+        out.append(pixels[i] ^ pixels[i - w])
+    return out
+
+
+def unprefilter(pixels, w):
+    out = list(pixels[:w])
+    for i in range(w, len(pixels)):
+        out.append(pixels[i] ^ out[i - w])
+    return out
+
+
+def rle_encode(pixels, bpp):
+    """Inverse of the decoder's three states (single / repeat / counter)."""
+    w = BitWriter()
+    n = len(pixels)
+    i = 0
+    prev = None
+    while i < n:
+        v = pixels[i]
+        w.write(v, bpp)
+        i += 1
+        if v != prev:
+            prev = v
+            continue
+        # Second equal value read: the decoder is in repeat mode.
+        run = 0
+        while i + run < n and pixels[i + run] == v:
+            run += 1
+        if run <= RLE_BIT_COLLAPSED:
+            for _ in range(run):
+                w.write(1, 1)
+            i += run
+            if i < n:
+                w.write(0, 1)
+                prev = pixels[i]
+                w.write(prev, bpp)
+                i += 1
+            continue
+        run = min(run, RLE_MAX_RUN)
+        for _ in range(RLE_BIT_COLLAPSED + 1):
+            w.write(1, 1)
+        counter = run - RLE_BIT_COLLAPSED
+        w.write(counter, RLE_COUNTER_BITS)
+        i += run
+        if i < n:
+            # The counter's last step reads the next value (possibly v again
+            # when a long run was clamped).
+            prev = pixels[i]
+            w.write(prev, bpp)
+            i += 1
+    return w.flush()
+
+
+def rle_decode(data, count, bpp):
+    r = BitReader(data)
+    out = []
+    state = "single"
+    prev = 0
+    cnt = 0
+    for k in range(count):
+        if state == "single":
+            v = r.read(bpp)
+            if k != 0 and v == prev:
+                cnt = 0
+                state = "repeat"
+            prev = v
+        elif state == "repeat":
+            cnt += 1
+            if r.read(1):
+                v = prev
+                if cnt == RLE_BIT_COLLAPSED + 1:
+                    cnt = r.read(RLE_COUNTER_BITS)
+                    state = "counter"
+            else:
+                v = prev = r.read(bpp)
+                state = "single"
+        else:
+            cnt -= 1
+            if cnt == 0:
+                v = prev = r.read(bpp)
+                state = "single"
+            else:
+                v = prev
+        out.append(v)
+    return out
+
+
+def parse_bytes(body):
+    """Split the glyph_bitmap[] body into (comment, [bytes]) per glyph."""
+    glyphs = []
+    pos = 0
+    for m in COMMENT_RE.finditer(body):
+        if glyphs:
+            glyphs[-1][1].extend(int(t, 0) for t in re.findall(r"0x[0-9a-fA-F]+|\d+", body[pos:m.start()]))
+        glyphs.append((m.group(0), []))
+        pos = m.end()
+    if glyphs:
+        glyphs[-1][1].extend(int(t, 0) for t in re.findall(r"0x[0-9a-fA-F]+|\d+", body[pos:]))
+    return glyphs
+
+
+def format_bytes(glyphs):
+    lines = []
+    for comment, data in glyphs:
+        if lines:
+            lines.append("")
+        lines.append("    " + comment)
+        for i in range(0, len(data), 8):
+            lines.append("    " + ", ".join("0x%x" % b for b in data[i:i + 8]) + ",")
+    # lv_font_conv leaves the last element without a trailing comma.
+    for i in range(len(lines) - 1, -1, -1):
+        if lines[i].endswith(","):
+            lines[i] = lines[i][:-1]
+            break
+    return "\n".join(lines)
+
+
+def compress_file(path):
+    with open(path) as f:
+        src = f.read()
+    if ".bitmap_format = 0," not in src or "--no-compress" not in src:
+        print("%s: not a --no-compress font, skipped" % path)
+        return
+    bpp = int(re.search(r"\.bpp = (\d+),", src).group(1))
+
+    bm = BITMAP_RE.search(src)
+    glyphs = parse_bytes(bm.group(2))
+    plain = bytes(b for _, data in glyphs for b in data)
+
+    dsc_start = src.index("glyph_dsc[] = {")
+    dsc_end = src.index("};", dsc_start)
+    rows = [(m.start(), m.end(), int(m.group(1)), int(m.group(2)), int(m.group(3)))
+            for m in DSC_ROW_RE.finditer(src, dsc_start, dsc_end)]
+    # Row 0 is the reserved id; the rest pair up with the bitmap comments.
+    if len(rows) - 1 != len(glyphs):
+        raise SystemExit("%s: %d glyph rows but %d bitmap comments" % (path, len(rows) - 1, len(glyphs)))
+
+    out_glyphs = []
+    new_index = [0]
+    offset = 0
+    for (_, _, index, bw, bh), (comment, _) in zip(rows[1:], glyphs):
+        pixels = unpack(plain, index, bw * bh, bpp) if bw * bh else []
+        packed = rle_encode(prefilter(pixels, bw), bpp) if pixels else b""
+        if pixels and unprefilter(rle_decode(packed, len(pixels), bpp), bw) != pixels:
+            raise SystemExit("%s: round trip failed for %s" % (path, comment))
+        new_index.append(offset)
+        out_glyphs.append((comment, list(packed)))
+        offset += len(packed)
+
+    # Rewrite back to front so earlier offsets stay valid.
+    for (start, end, _, bw, bh), idx in reversed(list(zip(rows, new_index))):
+        row = src[start:end]
+        src = src[:start] + re.sub(r"bitmap_index = \d+", "bitmap_index = %d" % idx, row, count=1) + src[end:]
+    bm = BITMAP_RE.search(src)
+    src = src[:bm.start(2)] + format_bytes(out_glyphs) + src[bm.end(2):]
+
+    src = src.replace(" --no-compress", "", 1)
+    src = src.replace(".bitmap_format = 0,", ".bitmap_format = 1,", 1)
+    src = src.replace("lv_font_get_bitmap_fmt_txt,", "font_glyph_cache_get_bitmap,", 1)
+    src = INCLUDE_RE.sub(lambda m: m.group(1) + '#include "font_glyph_cache.h"\n', src, count=1)
+
+    with open(path, "w") as f:
+        f.write(src)
+    print("%s: glyph bitmaps %d -> %d bytes" % (path, len(plain), offset))
+
+
+def main(argv):
+    if len(argv) < 2:
+        raise SystemExit(__doc__.strip().splitlines()[-1])
+    for path in argv[1:]:
+        compress_file(path)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""generate_web_assets.py -- gzip the embedded web UI into a static asset table.
+
+Runs at BUILD time (see main/CMakeLists.txt). Each input file becomes one
+web_asset_t row in the generated C file: its file name, the gzip-compressed
+body, a strong ETag (hash of the uncompressed content) and a Content-Type.
+The handlers send the bytes as-is with Content-Encoding: gzip (web_assets.h).
+
+Every occurrence of the token __WEB_ASSETS_VERSION__ in an input is replaced
+with a hash over all inputs, also exported as web_assets_version[]. The
+config page uses it to request fragments under a versioned URL, which is what
+lets those be cached as immutable without going stale after an OTA update.
+
+Output is deterministic (gzip mtime 0, inputs in argument order), and the file
+is only rewritten when its content changes, so an unchanged UI does not
+recompile.
+
+Usage: generate_web_assets.py OUTPUT.c INPUT...
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+VERSION_TOKEN = b"__WEB_ASSETS_VERSION__"
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+}
+
+
+def c_ident(name):
+    return "".join(c if c.isalnum() else "_" for c in name)
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 20):
+        lines.append("    " + ",".join("0x%02x" % b for b in data[i:i + 20]) + ",")
+    return "\n".join(lines)
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.stderr.write(__doc__)
+        return 2
+    out_path, inputs = argv[1], argv[2:]
+
+    sources = []
+    for path in inputs:
+        name = os.path.basename(path)
+        ext = os.path.splitext(name)[1].lower()
+        if ext not in CONTENT_TYPES:
+            sys.stderr.write("%s: no content type for %s\n" % (argv[0], name))
+            return 1
+        with open(path, "rb") as f:
+            sources.append((name, CONTENT_TYPES[ext], f.read()))
+
+    version = hashlib.sha256()
+    for name, _, data in sources:
+        version.update(name.encode() + b"\0" + data)
+    version = version.hexdigest()[:16]
+
+    out = [
+        "/* Generated by generate_web_assets.py -- do not edit. */",
+        "",
+        '#include "web_assets.h"',
+        "",
+        'const char web_assets_version[] = "%s";' % version,
+        "",
+    ]
+    rows = []
+    total_raw = total_gz = 0
+    for name, ctype, data in sources:
+        data = data.replace(VERSION_TOKEN, version.encode())
+        gz = gzip.compress(data, compresslevel=9, mtime=0)
+        etag = '\\"%s\\"' % hashlib.sha256(data).hexdigest()[:16]
+        ident = c_ident(name)
+        out.append("/* %s: %d -> %d bytes */" % (name, len(data), len(gz)))
+        out.append("static const uint8_t s_%s[%d] = {" % (ident, len(gz)))
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("")
+        rows.append('    { "%s", s_%s, sizeof(s_%s), "%s", "%s" },' % (name, ident, ident, etag, ctype))
+        total_raw += len(data)
+        total_gz += len(gz)
+
+    out.append("const web_asset_t web_assets[] = {")
+    out.extend(rows)
+    out.append("};")
+    out.append("")
+    out.append("const size_t web_assets_count = sizeof(web_assets) / sizeof(web_assets[0]);")
+    out.append("")
+    text = "\n".join(out)
+
+    try:
+        with open(out_path, "r") as f:
+            if f.read() == text:
+                return 0
+    except OSError:
+        pass
+    with open(out_path, "w") as f:
+        f.write(text)
+    print("web assets: %d files, %d -> %d bytes gzip" % (len(sources), total_raw, total_gz))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
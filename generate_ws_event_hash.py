@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""generate_ws_event_hash.py -- perfect-hash slot table for WebSocket event names.
+
+Reads the rows of k_event_info[] in main/ws_event.c (the EV / CONN / DISCONN
+lines, in order) and searches for an FNV-1a seed under which the top
+WS_EVENT_HASH_BITS bits of every name's hash land in a distinct slot. The
+result is written to main/ws_event_hash.h: the seed, the slot bits, and
+k_event_slots[], mapping slot -> row index + 1 (0 = empty). ws_event_lookup()
+then classifies a name with one hash and one strcmp.
+
+The output is checked in. Re-run after adding, removing or renaming a row;
+test_ws_event fails until the table matches the rows again. The file is only
+rewritten when its content changes.
+
+Usage: generate_ws_event_hash.py [main/ws_event.c [main/ws_event_hash.h]]
+"""
+
+import os
+import re
+import sys
+
+HASH_BITS = 7
+MAX_SEEDS = 1 << 22
+
+ROW_RE = re.compile(r'^\s*(?:EV|CONN|DISCONN)\(\s*"([^"]+)"', re.M)
+
+
+def fnv1a(seed, name):
+    h = seed
+    for b in name.encode():
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def read_names(path):
+    with open(path) as f:
+        src = f.read()
+    start = src.find("k_event_info[] = {")
+    end = src.find("};", start)
+    if start < 0 or end < 0:
+        raise SystemExit("%s: k_event_info[] not found" % path)
+    names = ROW_RE.findall(src[start:end])
+    if len(set(names)) != len(names):
+        raise SystemExit("%s: duplicate event name in k_event_info[]" % path)
+    return names
+
+
+def find_seed(names, bits):
+    shift = 32 - bits
+    for i in range(MAX_SEEDS):
+        seed = (2166136261 + i) & 0xFFFFFFFF
+        slots = set()
+        for name in names:
+            slot = fnv1a(seed, name) >> shift
+            if slot in slots:
+                break
+            slots.add(slot)
+        else:
+            return seed
+    return None
+
+
+def main(argv):
+    root = os.path.dirname(os.path.abspath(__file__))
+    src_path = argv[1] if len(argv) > 1 else os.path.join(root, "main", "ws_event.c")
+    out_path = argv[2] if len(argv) > 2 else os.path.join(root, "main", "ws_event_hash.h")
+
+    names = read_names(src_path)
+    if not names or len(names) >= 255 or len(names) > (1 << HASH_BITS):
+        sys.stderr.write("%s: %d rows do not fit %d slots\n" % (argv[0], len(names), 1 << HASH_BITS))
+        return 1
+    seed = find_seed(names, HASH_BITS)
+    if seed is None:
+        sys.stderr.write("%s: no collision-free seed; raise HASH_BITS\n" % argv[0])
+        return 1
+
+    slots = [0] * (1 << HASH_BITS)
+    for i, name in enumerate(names):
+        slots[fnv1a(seed, name) >> (32 - HASH_BITS)] = i + 1
+
+    out = [
+        "/* Generated by generate_ws_event_hash.py from k_event_info[] in ws_event.c",
+        " * -- do not edit. Private to ws_event.c. */",
+        "",
+        "#ifndef WS_EVENT_HASH_H",
+        "#define WS_EVENT_HASH_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define WS_EVENT_HASH_SEED 0x%08xu" % seed,
+        "#define WS_EVENT_HASH_BITS %d" % HASH_BITS,
+        "",
+        "/* %d events in %d slots: slot -> k_event_info index + 1, 0 = empty. */" % (len(names), len(slots)),
+        "static const uint8_t k_event_slots[1u << WS_EVENT_HASH_BITS] = {",
+    ]
+    for i in range(0, len(slots), 16):
+        out.append("    " + ", ".join("%2d" % v for v in slots[i:i + 16]) + ",")
+    out += ["};", "", "#endif /* WS_EVENT_HASH_H */", ""]
+    text = "\n".join(out)
+
+    try:
+        with open(out_path) as f:
+            if f.read() == text:
+                return 0
+    except OSError:
+        pass
+    with open(out_path, "w") as f:
+        f.write(text)
+    print("ws event hash: %d names, seed 0x%08x, %d slots" % (len(names), seed, len(slots)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
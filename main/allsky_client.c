@@ -3,8 +3,11 @@
  * @brief AllSky API HTTP client — polls /all endpoint and extracts configured field values.
  *
  * Uses http_fetch's shared fetcher with a module-static keep-alive slot
- * (s_conn). AllSky polling is single-owner (only allsky_poll_task ever
- * calls allsky_client_poll), so the connection slot needs no locking.
+ * (s_conn). AllSky polling is single-owner (only the allsky poll job ever
+ * calls allsky_client_poll, and the scheduler never runs a job twice at
+ * once), so the connection slot needs no locking.
+ * Polls are conditional (s_validators): a 304 leaves the published values
+ * as they are and only refreshes connected/last_poll_ms.
  */
 
 #include "allsky_client.h"
@@ -28,10 +31,16 @@ static const char *TAG = "allsky_client";
 static cJSON *s_cached_field_config = NULL;
 static char  *s_cached_field_config_str = NULL;
 
-/* Persistent keep-alive slot, owned exclusively by allsky_poll_task; lazily
+/* Persistent keep-alive slot, owned exclusively by the allsky poll job; lazily
  * created on first poll. */
 static http_fetch_conn_t *s_conn = NULL;
 
+/* ETag/Last-Modified of the last /all body, plus a hash of the field config
+ * that body was extracted with: a 304 only means "nothing to do" while the
+ * config is unchanged too. */
+static http_validator_cache_t *s_validators = NULL;
+static uint64_t s_published_config_hash = 0;
+
 // =============================================================================
 // Mutex Helpers
 // =============================================================================
@@ -280,6 +289,14 @@ void allsky_client_poll(const char *hostname, const char *field_config_json, all
             ESP_LOGW(TAG, "Failed to allocate AllSky keep-alive connection slot");
         }
     }
+    if (!s_validators) {
+        s_validators = http_validator_cache_create(2, 0);
+    }
+
+    uint64_t config_hash = http_validator_url_hash(field_config_json ? field_config_json : "");
+    if (config_hash != s_published_config_hash) {
+        http_validator_forget(s_validators, url);
+    }
 
     http_fetch_opts_t opts = {
         .timeout_ms = ALLSKY_HTTP_TIMEOUT_MS,
@@ -288,11 +305,21 @@ void allsky_client_poll(const char *hostname, const char *field_config_json, all
         .max_attempts = 1,
         .max_response_bytes = ALLSKY_RESPONSE_BUF_SIZE,
         .conn = s_conn,
+        .validators = s_validators,
     };
 
     char *buffer = NULL;
     size_t total_read = 0;
     esp_err_t err = http_fetch_text(url, &opts, &buffer, &total_read);
+    if (err == HTTP_FETCH_NOT_MODIFIED) {
+        if (allsky_data_lock(data, 200)) {
+            data->connected = true;
+            data->last_poll_ms = esp_timer_get_time() / 1000;
+            allsky_data_unlock(data);
+        }
+        ESP_LOGD(TAG, "AllSky poll OK — not modified");
+        return;
+    }
     if (err != ESP_OK) {
         ESP_LOGW(TAG, "AllSky HTTP fetch failed for %s: %s", url, esp_err_to_name(err));
         if (allsky_data_lock(data, 100)) {
@@ -305,6 +332,7 @@ void allsky_client_poll(const char *hostname, const char *field_config_json, all
     if (total_read == 0) {
         ESP_LOGW(TAG, "AllSky: empty response body");
         heap_caps_free(buffer);
+        http_validator_forget(s_validators, url);
         if (allsky_data_lock(data, 100)) {
             data->connected = false;
             allsky_data_unlock(data);
@@ -318,6 +346,7 @@ void allsky_client_poll(const char *hostname, const char *field_config_json, all
 
     if (!json) {
         ESP_LOGW(TAG, "AllSky: failed to parse JSON response");
+        http_validator_forget(s_validators, url);
         if (allsky_data_lock(data, 100)) {
             data->connected = false;
             allsky_data_unlock(data);
@@ -352,8 +381,10 @@ void allsky_client_poll(const char *hostname, const char *field_config_json, all
         memcpy(data->field_values, local_data.field_values, sizeof(data->field_values));
         data->moon_illumination = local_data.moon_illumination;
         allsky_data_unlock(data);
+        s_published_config_hash = config_hash;
         ESP_LOGD(TAG, "AllSky poll OK — %u bytes parsed", (unsigned)total_read);
     } else {
         ESP_LOGW(TAG, "AllSky: failed to acquire mutex for data update");
+        http_validator_forget(s_validators, url);
     }
 }
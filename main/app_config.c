@@ -6,12 +6,14 @@
 #include "cJSON.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include <stdio.h>
 #include <string.h>
 #include <strings.h>
 #include <stdlib.h>
 #include "esp_heap_caps.h"
 #include "perf_monitor.h"
 #include "settings_table.h"
+#include "config_tlv.h"
 #include "themes.h"
 #include "ui/page_registry.h"
 
@@ -3069,6 +3071,122 @@ static bool validate_config(app_config_t *cfg) {
     return fixed;
 }
 
+/* ── Tagged config store ─────────────────────────────────────────────────
+ * app_config_t is persisted field by field (config_tlv.h): one NVS blob per
+ * bucket, keys "cfg.0".."cfg.f", plus the "cfg_fmt" marker written once all
+ * buckets exist. A save diffs against s_persisted (what the buckets hold)
+ * and rewrites only the buckets with a changed field. Boot decodes the
+ * buckets onto the defaults, so adding a field needs no migration. The
+ * legacy "config" blob and its migrate_from_vN() chain are only read when
+ * the marker is missing, to import a device's settings once. */
+#define CONFIG_STORE_FMT_KEY "cfg_fmt"
+
+static app_config_t *s_persisted;          /* PSRAM; last state written to the buckets */
+static bool s_persisted_valid;
+static uint32_t s_store_unsaved;           /* buckets whose last write failed */
+static uint8_t *s_store_buf;               /* PSRAM encode/decode scratch */
+static size_t s_store_buf_cap;
+
+static void config_store_key(int bucket, char key[8]) {
+    snprintf(key, 8, "cfg.%x", bucket);
+}
+
+/* Grow the scratch buffer to at least @p need bytes. */
+static bool config_store_reserve(size_t need) {
+    if (s_store_buf_cap >= need) {
+        return true;
+    }
+    uint8_t *buf = heap_caps_realloc(s_store_buf, need, MALLOC_CAP_SPIRAM);
+    if (!buf) {
+        ESP_LOGE(TAG, "Failed to allocate %d bytes for config store", (int)need);
+        return false;
+    }
+    s_store_buf = buf;
+    s_store_buf_cap = need;
+    return true;
+}
+
+/* Decode the buckets onto the defaults. False if the store has not been
+ * written yet (no marker), so the caller imports the legacy blob instead. */
+static bool config_store_load(nvs_handle_t handle, const config_tlv_schema_t *schema,
+                              app_config_t *cfg) {
+    uint8_t fmt = 0;
+    if (nvs_get_u8(handle, CONFIG_STORE_FMT_KEY, &fmt) != ESP_OK) {
+        return false;
+    }
+    if (fmt != CONFIG_TLV_FORMAT) {
+        ESP_LOGW(TAG, "Config store format %u unsupported, importing legacy blob", fmt);
+        return false;
+    }
+
+    set_defaults(cfg);
+    int fields = 0;
+    size_t bytes = 0;
+    for (int b = 0; b < CONFIG_TLV_BUCKETS; b++) {
+        char key[8];
+        config_store_key(b, key);
+        size_t len = 0;
+        if (nvs_get_blob(handle, key, NULL, &len) != ESP_OK || !config_store_reserve(len)) {
+            continue;   /* missing bucket: its fields keep their defaults */
+        }
+        if (nvs_get_blob(handle, key, s_store_buf, &len) != ESP_OK) {
+            continue;
+        }
+        int n = config_tlv_decode(schema, s_store_buf, len, cfg);
+        if (n < 0) {
+            ESP_LOGW(TAG, "Config bucket %s is malformed; later fields use defaults", key);
+        } else {
+            fields += n;
+        }
+        bytes += len;
+    }
+    cfg->config_version = APP_CONFIG_VERSION;
+    ESP_LOGI(TAG, "Config loaded: %d fields from %d bytes", fields, (int)bytes);
+    return true;
+}
+
+/* Write the buckets in @p mask from s_config and commit. Buckets that fail
+ * stay in s_store_unsaved for the next save. Returns how many were written. */
+static int config_store_write(nvs_handle_t handle, const config_tlv_schema_t *schema,
+                              uint32_t mask) {
+    int written = 0;
+    for (int b = 0; b < CONFIG_TLV_BUCKETS; b++) {
+        if (!(mask & (1u << b))) {
+            continue;
+        }
+        char key[8];
+        config_store_key(b, key);
+        esp_err_t err = ESP_ERR_NO_MEM;
+        if (config_store_reserve(config_tlv_bucket_max(schema, b))) {
+            size_t len = config_tlv_encode_bucket(schema, &s_config, b,
+                                                  s_store_buf, s_store_buf_cap);
+            err = nvs_set_blob(handle, key, s_store_buf, len);
+        }
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to save config bucket %s: %s", key, esp_err_to_name(err));
+            s_store_unsaved |= 1u << b;
+        } else {
+            s_store_unsaved &= ~(1u << b);
+            written++;
+        }
+    }
+    nvs_commit(handle);
+    memcpy(s_persisted, &s_config, sizeof(app_config_t));
+    s_persisted_valid = true;
+    return written;
+}
+
+/* First write of the store: every bucket, then the marker that makes later
+ * boots skip the legacy blob. */
+static void config_store_import(nvs_handle_t handle, const config_tlv_schema_t *schema) {
+    int written = config_store_write(handle, schema, (1u << CONFIG_TLV_BUCKETS) - 1);
+    if (written == CONFIG_TLV_BUCKETS) {
+        nvs_set_u8(handle, CONFIG_STORE_FMT_KEY, CONFIG_TLV_FORMAT);
+        nvs_commit(handle);
+        ESP_LOGI(TAG, "Config store written (%d sections)", written);
+    }
+}
+
 void app_config_init(void) {
     s_config_mutex = xSemaphoreCreateMutex();
     /* Allocate the tiles caches early so getters are safe ("") on every
@@ -3076,6 +3194,16 @@ void app_config_init(void) {
      * a factory-reset re-init reuses the existing buffers without leaking. */
     tiles_caches_alloc();
     bool tiles_loaded = false;   /* migrations that source inline tiles set this true */
+    if (!s_persisted) {
+        s_persisted = heap_caps_malloc(sizeof(app_config_t), MALLOC_CAP_SPIRAM);
+    }
+    s_persisted_valid = false;
+    s_store_unsaved = 0;
+    const config_tlv_schema_t *schema = settings_store_schema();
+    if (!schema || !s_persisted) {
+        ESP_LOGE(TAG, "Config store unavailable; saving the legacy blob instead");
+        schema = NULL;
+    }
     nvs_handle_t handle;
     esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &handle);
     if (err != ESP_OK) {
@@ -3084,14 +3212,31 @@ void app_config_init(void) {
         return;
     }
 
+    if (schema && config_store_load(handle, schema, &s_config)) {
+        memcpy(s_persisted, &s_config, sizeof(app_config_t));
+        s_persisted_valid = true;
+        if (validate_config(&s_config)) {
+            config_store_write(handle, schema,
+                               config_tlv_dirty_buckets(schema, s_persisted, &s_config));
+        }
+        tiles_cache_load_key(handle, "json_tiles", s_json_tiles_cache);
+        tiles_cache_load_key(handle, "ha_tiles",   s_ha_tiles_cache);
+        nvs_close(handle);
+        goto loaded;
+    }
+
     /* Determine stored blob size without reading */
     size_t stored_size = 0;
     err = nvs_get_blob(handle, "config", NULL, &stored_size);
     if (err != ESP_OK || stored_size == 0) {
         ESP_LOGW(TAG, "Config not found in NVS, using defaults");
         set_defaults(&s_config);
-        nvs_set_blob(handle, "config", &s_config, sizeof(app_config_t));
-        nvs_commit(handle);
+        if (schema) {
+            config_store_import(handle, schema);
+        } else {
+            nvs_set_blob(handle, "config", &s_config, sizeof(app_config_t));
+            nvs_commit(handle);
+        }
         nvs_close(handle);
         return;
     }
@@ -3509,8 +3654,14 @@ void app_config_init(void) {
     }
 
     free(raw);
+    /* One-time import: from here on the buckets are the source of truth and
+     * the legacy blob is left as it is (a downgrade still finds it). */
+    if (schema) {
+        config_store_import(handle, schema);
+    }
     nvs_close(handle);
 
+loaded:
     /* Warn at boot if admin password is still the factory default. */
     if (strcmp(s_config.admin_password, "changeme123!") == 0) {
         ESP_LOGW(TAG, "Admin password is set to factory default. "
@@ -3552,13 +3703,26 @@ void app_config_save(const app_config_t *config) {
         return;
     }
 
-    err = nvs_set_blob(my_handle, "config", &s_config, sizeof(app_config_t));
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save config: %s", esp_err_to_name(err));
+    const config_tlv_schema_t *schema = s_persisted ? settings_store_schema() : NULL;
+    if (schema) {
+        /* Rewrite only the sections holding a changed field. */
+        uint32_t mask = s_persisted_valid
+            ? config_tlv_dirty_buckets(schema, s_persisted, &s_config) | s_store_unsaved
+            : (1u << CONFIG_TLV_BUCKETS) - 1;
+        int written = config_store_write(my_handle, schema, mask);
+        ESP_LOGI(TAG, "Config saved (%d of %d sections written)", written, CONFIG_TLV_BUCKETS);
+        if (!s_store_unsaved) {
+            s_config_dirty = false;
+        }
     } else {
-        ESP_LOGI(TAG, "Config saved");
-        nvs_commit(my_handle);
-        s_config_dirty = false;
+        err = nvs_set_blob(my_handle, "config", &s_config, sizeof(app_config_t));
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to save config: %s", esp_err_to_name(err));
+        } else {
+            ESP_LOGI(TAG, "Config saved");
+            nvs_commit(my_handle);
+            s_config_dirty = false;
+        }
     }
     nvs_close(my_handle);
 
@@ -3585,33 +3749,38 @@ void app_config_apply(const app_config_t *config) {
 }
 
 esp_err_t app_config_revert(void) {
-    nvs_handle_t handle;
-    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "app_config_revert: NVS open failed: %s", esp_err_to_name(err));
-        return ESP_FAIL;
-    }
+    app_config_t *tmp = NULL;
+    if (!s_persisted_valid) {
+        /* No store shadow (legacy-blob fallback): read the blob back. */
+        nvs_handle_t handle;
+        esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &handle);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "app_config_revert: NVS open failed: %s", esp_err_to_name(err));
+            return ESP_FAIL;
+        }
 
-    size_t sz = sizeof(app_config_t);
-    app_config_t *tmp = heap_caps_malloc(sz, MALLOC_CAP_SPIRAM);
-    if (!tmp) {
-        nvs_close(handle);
-        ESP_LOGE(TAG, "app_config_revert: malloc failed");
-        return ESP_FAIL;
-    }
+        size_t sz = sizeof(app_config_t);
+        tmp = heap_caps_malloc(sz, MALLOC_CAP_SPIRAM);
+        if (!tmp) {
+            nvs_close(handle);
+            ESP_LOGE(TAG, "app_config_revert: malloc failed");
+            return ESP_FAIL;
+        }
 
-    err = nvs_get_blob(handle, "config", tmp, &sz);
-    nvs_close(handle);
+        err = nvs_get_blob(handle, "config", tmp, &sz);
+        nvs_close(handle);
 
-    if (err != ESP_OK || sz != sizeof(app_config_t)) {
-        free(tmp);
-        ESP_LOGE(TAG, "app_config_revert: NVS read failed or size mismatch");
-        return ESP_FAIL;
+        if (err != ESP_OK || sz != sizeof(app_config_t)) {
+            free(tmp);
+            ESP_LOGE(TAG, "app_config_revert: NVS read failed or size mismatch");
+            return ESP_FAIL;
+        }
     }
 
     xSemaphoreTake(s_config_mutex, portMAX_DELAY);
     invalidate_json_caches();
-    memcpy(&s_config, tmp, sizeof(app_config_t));
+    /* s_persisted mirrors the store buckets, so no flash read is needed. */
+    memcpy(&s_config, tmp ? tmp : s_persisted, sizeof(app_config_t));
     s_config_dirty = false;
     /* Reload tiles caches from NVS (revert to last-persisted tiles). The tiles
      * setter writes the NVS key immediately on POST, so the keys hold the
@@ -3719,9 +3888,9 @@ uint32_t app_config_get_filter_color(const char *filter_name, int instance_index
     // Use cached parse tree, re-parse only on first access or after invalidation
     if (!s_filter_colors_cache[idx]) {
         const char *json = get_filter_colors_field(idx);
-        perf_timer_start(&g_perf.json_config_color_parse);
+        perf_span_t json_config_color_parse_span = perf_timer_start();
         s_filter_colors_cache[idx] = cJSON_Parse(json);
-        perf_timer_stop(&g_perf.json_config_color_parse);
+        perf_timer_stop(&g_perf.json_config_color_parse, json_config_color_parse_span);
         perf_counter_increment(&g_perf.json_parse_count);
     }
     cJSON *root = s_filter_colors_cache[idx];
@@ -3762,9 +3931,9 @@ static uint32_t get_threshold_color(float value, const char *json,
                                     float default_good_max, float default_ok_max) {
     // Use cached parse tree, re-parse only on first access or after invalidation
     if (!*cache) {
-        perf_timer_start(&g_perf.json_config_color_parse);
+        perf_span_t json_config_color_parse_span = perf_timer_start();
         *cache = cJSON_Parse(json);
-        perf_timer_stop(&g_perf.json_config_color_parse);
+        perf_timer_stop(&g_perf.json_config_color_parse, json_config_color_parse_span);
         perf_counter_increment(&g_perf.json_parse_count);
     }
     cJSON *root = *cache;
@@ -0,0 +1,160 @@
+/*
+ * config_tlv.c - Tagged config field encoding (see config_tlv.h).
+ */
+
+#include "config_tlv.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t config_tlv_tag(const char *name)
+{
+    uint32_t h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)name; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h ? h : 1;
+}
+
+static int cmp_tag(const void *a, const void *b)
+{
+    uint32_t x = ((const config_tlv_field_t *)a)->tag;
+    uint32_t y = ((const config_tlv_field_t *)b)->tag;
+    return (x > y) - (x < y);
+}
+
+bool config_tlv_schema_init(config_tlv_schema_t *s, config_tlv_field_t *fields,
+                            size_t count, size_t struct_size)
+{
+    if (!s || (!fields && count)) return false;
+    for (size_t i = 0; i < count; i++) {
+        if (!fields[i].name || fields[i].size == 0 ||
+            (size_t)fields[i].offset + fields[i].size > struct_size)
+            return false;
+        fields[i].tag = config_tlv_tag(fields[i].name);
+    }
+    qsort(fields, count, sizeof(fields[0]), cmp_tag);
+    for (size_t i = 1; i < count; i++) {
+        if (fields[i].tag == fields[i - 1].tag) return false;
+    }
+    s->fields = fields;
+    s->count = count;
+    s->struct_size = struct_size;
+    return true;
+}
+
+static const config_tlv_field_t *find(const config_tlv_schema_t *s, uint32_t tag)
+{
+    size_t lo = 0, hi = s->count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        uint32_t t = s->fields[mid].tag;
+        if (t == tag) return &s->fields[mid];
+        if (t < tag) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+/* Bytes of @p f stored from @p base: a string up to its NUL, else all of it. */
+static size_t stored_len(const config_tlv_field_t *f, const uint8_t *base)
+{
+    if (f->kind != CONFIG_TLV_STR) return f->size;
+    const char *str = (const char *)(base + f->offset);
+    const char *nul = memchr(str, '\0', f->size);
+    return nul ? (size_t)(nul - str) : (size_t)f->size - 1;
+}
+
+size_t config_tlv_bucket_max(const config_tlv_schema_t *s, int bucket)
+{
+    size_t n = CONFIG_TLV_HDR;
+    for (size_t i = 0; i < s->count; i++) {
+        if (config_tlv_bucket(s->fields[i].tag) == bucket)
+            n += CONFIG_TLV_REC_HDR + s->fields[i].size;
+    }
+    return n;
+}
+
+size_t config_tlv_encode_bucket(const config_tlv_schema_t *s, const void *cfg,
+                                int bucket, uint8_t *dst, size_t cap)
+{
+    const uint8_t *base = cfg;
+    if (cap < CONFIG_TLV_HDR) return 0;
+    dst[0] = CONFIG_TLV_FORMAT;
+    dst[1] = (uint8_t)bucket;
+    size_t n = CONFIG_TLV_HDR;
+
+    for (size_t i = 0; i < s->count; i++) {
+        const config_tlv_field_t *f = &s->fields[i];
+        if (config_tlv_bucket(f->tag) != bucket) continue;
+        size_t len = stored_len(f, base);
+        if (cap - n < CONFIG_TLV_REC_HDR + len) return 0;
+        for (int b = 0; b < 4; b++) dst[n++] = (uint8_t)(f->tag >> (8 * b));
+        dst[n++] = (uint8_t)len;
+        dst[n++] = (uint8_t)(len >> 8);
+        memcpy(dst + n, base + f->offset, len);
+        n += len;
+    }
+    return n;
+}
+
+/* Restore one record into its field; false if the record does not fit it. */
+static bool apply(const config_tlv_field_t *f, const uint8_t *data, size_t len, uint8_t *base)
+{
+    uint8_t *dst = base + f->offset;
+    switch (f->kind) {
+    case CONFIG_TLV_STR: {
+        size_t n = len < (size_t)f->size - 1 ? len : (size_t)f->size - 1;
+        memset(dst, 0, f->size);
+        memcpy(dst, data, n);
+        return true;
+    }
+    case CONFIG_TLV_ARRAY:
+        memcpy(dst, data, len < f->size ? len : f->size);
+        return true;
+    default:
+        if (len != f->size) return false;   /* type changed: keep the default */
+        memcpy(dst, data, len);
+        return true;
+    }
+}
+
+int config_tlv_decode(const config_tlv_schema_t *s, const uint8_t *src, size_t len,
+                      void *cfg)
+{
+    if (!src || len < CONFIG_TLV_HDR || src[0] != CONFIG_TLV_FORMAT) return -1;
+
+    int applied = 0;
+    size_t pos = CONFIG_TLV_HDR;
+    while (pos < len) {
+        if (len - pos < CONFIG_TLV_REC_HDR) return -1;
+        uint32_t tag = (uint32_t)src[pos] | (uint32_t)src[pos + 1] << 8 |
+                       (uint32_t)src[pos + 2] << 16 | (uint32_t)src[pos + 3] << 24;
+        size_t rlen = (size_t)src[pos + 4] | (size_t)src[pos + 5] << 8;
+        pos += CONFIG_TLV_REC_HDR;
+        if (len - pos < rlen) return -1;
+
+        const config_tlv_field_t *f = find(s, tag);
+        if (f && apply(f, src + pos, rlen, cfg)) applied++;
+        pos += rlen;
+    }
+    return applied;
+}
+
+uint32_t config_tlv_dirty_buckets(const config_tlv_schema_t *s, const void *a,
+                                  const void *b)
+{
+    const uint8_t *pa = a, *pb = b;
+    uint32_t mask = 0;
+    for (size_t i = 0; i < s->count; i++) {
+        const config_tlv_field_t *f = &s->fields[i];
+        uint32_t bit = 1u << config_tlv_bucket(f->tag);
+        if (mask & bit) continue;
+        bool differs = f->kind == CONFIG_TLV_STR
+            ? strncmp((const char *)pa + f->offset, (const char *)pb + f->offset, f->size) != 0
+            : memcmp(pa + f->offset, pb + f->offset, f->size) != 0;
+        if (differs) mask |= bit;
+    }
+    return mask;
+}
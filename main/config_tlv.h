@@ -0,0 +1,108 @@
+/*
+ * config_tlv.h - Pure, host-testable tagged (TLV) encoding of a config struct
+ * behind app_config.c.
+ *
+ * app_config_t used to be stored as one NVS blob holding the raw struct, so
+ * every save rewrote all ~6.7 KB and every layout change needed a
+ * migrate_from_vN() copying the previous layout field by field. Here each
+ * field is described by a schema row (stable name, offset, size, kind) and
+ * stored as a record: a 32-bit tag derived from the name, a length and the
+ * bytes. Records are grouped into CONFIG_TLV_BUCKETS buckets by tag, one NVS
+ * blob per bucket, so a save only rewrites the buckets holding a field that
+ * actually changed.
+ *
+ * Decoding is applied on top of the caller's defaults: a field with no record
+ * (added after the data was written) keeps its default, a record with no
+ * field (removed since) is skipped, strings are re-terminated and arrays that
+ * changed length keep the common prefix. No version chain is needed as long
+ * as a field's name keeps its meaning; a field whose meaning changes gets a
+ * new name.
+ *
+ * Record layout (little endian): tag u32, length u16, length bytes. A bucket
+ * blob starts with CONFIG_TLV_FORMAT and its bucket index.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef CONFIG_TLV_H
+#define CONFIG_TLV_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CONFIG_TLV_FORMAT   1
+#define CONFIG_TLV_BUCKETS  16
+#define CONFIG_TLV_HDR      2       /* format, bucket index */
+#define CONFIG_TLV_REC_HDR  6       /* tag u32, length u16 */
+
+typedef enum {
+    CONFIG_TLV_RAW = 0,     /* scalar: restored only at its exact size */
+    CONFIG_TLV_STR,         /* char[]: stored up to the NUL, re-terminated */
+    CONFIG_TLV_ARRAY,       /* array: common prefix restored on a size change */
+} config_tlv_kind_t;
+
+typedef struct {
+    const char *name;       /* stable key the tag is derived from */
+    uint16_t    offset;
+    uint16_t    size;
+    uint8_t     align;      /* alignment of the member (coverage checks) */
+    uint8_t     kind;       /* config_tlv_kind_t */
+    uint32_t    tag;        /* set by config_tlv_schema_init() */
+} config_tlv_field_t;
+
+typedef struct {
+    config_tlv_field_t *fields;     /* sorted by tag after init */
+    size_t              count;
+    size_t              struct_size;
+} config_tlv_schema_t;
+
+/* Tag for @p name (FNV-1a, 32-bit). Never 0. */
+uint32_t config_tlv_tag(const char *name);
+
+/* Bucket holding the record for @p tag. */
+static inline int config_tlv_bucket(uint32_t tag)
+{
+    return (int)(tag % CONFIG_TLV_BUCKETS);
+}
+
+/*
+ * Tag and sort @p fields in place and set up @p s over them. Returns false if
+ * a field lies outside @p struct_size or two names share a tag.
+ */
+bool config_tlv_schema_init(config_tlv_schema_t *s, config_tlv_field_t *fields,
+                            size_t count, size_t struct_size);
+
+/* Largest encoding of @p bucket (every field at full size). */
+size_t config_tlv_bucket_max(const config_tlv_schema_t *s, int bucket);
+
+/*
+ * Encode every field of @p bucket from @p cfg into @p dst. Returns the length,
+ * or 0 if it does not fit in @p cap (config_tlv_bucket_max() always does).
+ */
+size_t config_tlv_encode_bucket(const config_tlv_schema_t *s, const void *cfg,
+                                int bucket, uint8_t *dst, size_t cap);
+
+/*
+ * Apply the records in @p src to @p cfg, leaving fields without a record
+ * untouched. Returns the number of fields restored, or -1 if the header is
+ * not a CONFIG_TLV_FORMAT bucket or a record is truncated (records before it
+ * are still applied).
+ */
+int config_tlv_decode(const config_tlv_schema_t *s, const uint8_t *src, size_t len,
+                      void *cfg);
+
+/* Bitmask of the buckets holding a field that differs between @p a and @p b. */
+uint32_t config_tlv_dirty_buckets(const config_tlv_schema_t *s, const void *a,
+                                  const void *b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_TLV_H */
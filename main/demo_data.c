@@ -432,14 +432,8 @@ void demo_data_task(void *param)
                 d->hfr   = st->hfr;
                 d->stars  = stars;
 
-                /* HFR ring buffer */
-                if (d->hfr_ring.hfr && d->hfr_ring.stars) {
-                    int wi = d->hfr_ring.write_idx;
-                    d->hfr_ring.hfr[wi]   = st->hfr;
-                    d->hfr_ring.stars[wi]  = stars;
-                    d->hfr_ring.write_idx  = (wi + 1) % HFR_RING_SIZE;
-                    d->hfr_ring.count++;
-                }
+                /* HFR store */
+                hfr_store_note_image(&d->hfr_ring, st->hfr, stars);
 
                 /* Last image stats */
                 d->last_image_stats.has_data       = true;
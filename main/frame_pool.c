@@ -0,0 +1,152 @@
+/**
+ * @file frame_pool.c
+ * @brief Fixed pool of full-size RGB565 frame slots. See frame_pool.h.
+ */
+
+#include "frame_pool.h"
+
+#include <string.h>
+
+void frame_pool_init(frame_pool_t *pool, int count, size_t slot_bytes,
+                     frame_pool_alloc_fn alloc, frame_pool_free_fn free_fn)
+{
+    memset(pool, 0, sizeof(*pool));
+    if (count < 0) count = 0;
+    if (count > FRAME_POOL_MAX_SLOTS) count = FRAME_POOL_MAX_SLOTS;
+    pool->count = count;
+    pool->slot_bytes = slot_bytes;
+    pool->alloc = alloc;
+    pool->free = free_fn;
+}
+
+static frame_slot_t *find_slot(const frame_pool_t *pool, const void *buf)
+{
+    if (!buf) return NULL;
+    for (int i = 0; i < pool->count; i++) {
+        frame_slot_t *s = (frame_slot_t *)&pool->slots[i];
+        if (atomic_load(&s->buf) == buf) return s;
+    }
+    return NULL;
+}
+
+static void note_high_water(frame_pool_t *pool)
+{
+    int owned = 0;
+    for (int i = 0; i < pool->count; i++) {
+        if (atomic_load(&pool->slots[i].owner) != FRAME_OWNER_FREE) owned++;
+    }
+    int hw = atomic_load(&pool->high_water);
+    while (owned > hw && !atomic_compare_exchange_weak(&pool->high_water, &hw, owned)) {
+    }
+}
+
+/* Claim a free slot whose memory state matches @p with_buf. */
+static frame_slot_t *claim(frame_pool_t *pool, bool with_buf, frame_owner_t owner)
+{
+    for (int i = 0; i < pool->count; i++) {
+        frame_slot_t *s = &pool->slots[i];
+        if ((atomic_load(&s->buf) != NULL) != with_buf) continue;
+        uint8_t expect = FRAME_OWNER_FREE;
+        if (atomic_compare_exchange_strong(&s->owner, &expect, (uint8_t)owner)) {
+            /* trim() may have emptied the slot between the check and the claim. */
+            if ((atomic_load(&s->buf) != NULL) == with_buf) return s;
+            atomic_store(&s->owner, FRAME_OWNER_FREE);
+        }
+    }
+    return NULL;
+}
+
+void *frame_pool_acquire(frame_pool_t *pool, size_t bytes, frame_owner_t owner)
+{
+    if (!pool || owner == FRAME_OWNER_FREE || owner >= FRAME_OWNER_COUNT) return NULL;
+
+    if (bytes <= pool->slot_bytes) {
+        frame_slot_t *s = claim(pool, true, owner);
+        if (!s) {
+            /* The slot is ours once claimed, so its first fill needs no lock. */
+            s = claim(pool, false, owner);
+            if (s) {
+                uint8_t *buf = pool->alloc(pool->slot_bytes);
+                if (buf) {
+                    atomic_store(&s->buf, buf);
+                } else {
+                    atomic_store(&s->owner, FRAME_OWNER_FREE);
+                    s = NULL;
+                }
+            }
+        }
+        if (s) {
+            atomic_fetch_add(&pool->hits, 1);
+            note_high_water(pool);
+            return atomic_load(&s->buf);
+        }
+    }
+
+    void *buf = pool->alloc(bytes);
+    if (buf) atomic_fetch_add(&pool->fallbacks, 1);
+    return buf;
+}
+
+bool frame_pool_handoff(frame_pool_t *pool, const void *buf, frame_owner_t owner)
+{
+    if (!pool || owner == FRAME_OWNER_FREE || owner >= FRAME_OWNER_COUNT) return false;
+    frame_slot_t *s = find_slot(pool, buf);
+    if (!s || atomic_load(&s->owner) == FRAME_OWNER_FREE) return false;
+    atomic_store(&s->owner, (uint8_t)owner);
+    return true;
+}
+
+void frame_pool_release(frame_pool_t *pool, void *buf)
+{
+    if (!pool || !buf) return;
+    frame_slot_t *s = find_slot(pool, buf);
+    if (s) {
+        atomic_store(&s->owner, FRAME_OWNER_FREE);
+        return;
+    }
+    pool->free(buf);
+}
+
+frame_owner_t frame_pool_owner(const frame_pool_t *pool, const void *buf)
+{
+    if (!pool) return FRAME_OWNER_FREE;
+    const frame_slot_t *s = find_slot(pool, buf);
+    return s ? (frame_owner_t)atomic_load(&s->owner) : FRAME_OWNER_FREE;
+}
+
+void frame_pool_get_stats(const frame_pool_t *pool, frame_pool_stats_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (!pool) return;
+    out->slots = pool->count;
+    for (int i = 0; i < pool->count; i++) {
+        frame_slot_t *s = (frame_slot_t *)&pool->slots[i];
+        bool has_buf = atomic_load(&s->buf) != NULL;
+        uint8_t owner = atomic_load(&s->owner);
+        if (has_buf) out->allocated++;
+        /* A free slot with no memory yet is not "idle". */
+        if (owner == FRAME_OWNER_FREE && !has_buf) continue;
+        if (owner < FRAME_OWNER_COUNT) out->owned[owner]++;
+    }
+    frame_pool_t *p = (frame_pool_t *)pool;
+    out->high_water = atomic_load(&p->high_water);
+    out->hits       = atomic_load(&p->hits);
+    out->fallbacks  = atomic_load(&p->fallbacks);
+}
+
+void frame_pool_trim(frame_pool_t *pool)
+{
+    if (!pool) return;
+    for (int i = 0; i < pool->count; i++) {
+        frame_slot_t *s = &pool->slots[i];
+        /* Claim the slot first so no acquire can hand it out mid-free. */
+        uint8_t expect = FRAME_OWNER_FREE;
+        if (!atomic_load(&s->buf) ||
+            !atomic_compare_exchange_strong(&s->owner, &expect, FRAME_OWNER_PRODUCER)) {
+            continue;
+        }
+        uint8_t *buf = atomic_exchange(&s->buf, NULL);
+        atomic_store(&s->owner, FRAME_OWNER_FREE);
+        if (buf) pool->free(buf);
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+/**
+ * @file frame_pool.h
+ * @brief Fixed pool of full-size RGB565 frame slots with explicit ownership.
+ *
+ * Every image the slideshow shows used to cost several PSRAM allocations of a
+ * different size (the decoded frame, the moon render and its depth buffer,
+ * the page's cropped display copy), each freed again a frame or two later.
+ * Over a night of rotation that churn splits PSRAM into holes no 2 MB frame
+ * fits, which shows up as a falling psram_frag_ratio. The pool instead hands
+ * out a small, fixed set of slots sized for the usual frame. A slot's memory
+ * is allocated the first time it is needed and then kept, so once every stage
+ * of the pipeline has held a frame the slideshow allocates nothing.
+ *
+ * Each slot carries the stage that currently owns it. A producer acquires a
+ * slot, fills it and hands it to the next stage (PRODUCER -> PREFETCH ->
+ * SOURCE, or PRODUCER -> SOURCE); the display copies out of the SOURCE frame
+ * into a DISPLAY slot of its own. Whoever owns a slot last releases it.
+ * Ownership changes are single atomic operations on the slot, so no lock is
+ * needed beyond the ones that already guard the pointers being moved.
+ *
+ * A request larger than a slot, or one made while every slot is taken, falls
+ * back to a one-off allocation from the same allocator. frame_pool_release()
+ * frees any buffer that is not a slot with the pool's free function, so callers
+ * never need to know where a frame came from.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host). The allocator is supplied
+ * by the caller.
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRAME_POOL_MAX_SLOTS 8
+
+/** Pipeline stage holding a frame. */
+typedef enum {
+    FRAME_OWNER_FREE = 0,
+    FRAME_OWNER_PRODUCER,   /**< Being decoded or rendered */
+    FRAME_OWNER_PREFETCH,   /**< Finished ahead of time, parked for the next swap */
+    FRAME_OWNER_SOURCE,     /**< The frame the image page shows */
+    FRAME_OWNER_DISPLAY,    /**< A cropped/rotated copy an LVGL descriptor points at */
+    FRAME_OWNER_COUNT,
+} frame_owner_t;
+
+typedef void *(*frame_pool_alloc_fn)(size_t bytes);
+typedef void  (*frame_pool_free_fn)(void *p);
+
+typedef struct {
+    _Atomic(uint8_t *) buf;     /* NULL until first acquired */
+    _Atomic uint8_t    owner;   /* frame_owner_t */
+} frame_slot_t;
+
+typedef struct {
+    frame_slot_t        slots[FRAME_POOL_MAX_SLOTS];
+    int                 count;
+    size_t              slot_bytes;
+    frame_pool_alloc_fn alloc;
+    frame_pool_free_fn  free;
+    _Atomic uint32_t    hits;          /* acquires served by a slot */
+    _Atomic uint32_t    fallbacks;     /* acquires that allocated a one-off buffer */
+    _Atomic int         high_water;    /* most slots ever owned at once */
+} frame_pool_t;
+
+/** Occupancy snapshot. */
+typedef struct {
+    int      slots;                       /**< Configured slots */
+    int      allocated;                   /**< Slots with memory behind them */
+    int      owned[FRAME_OWNER_COUNT];    /**< Slots per owner; [FREE] counts idle slots */
+    int      high_water;
+    uint32_t hits;
+    uint32_t fallbacks;
+} frame_pool_stats_t;
+
+/**
+ * @brief Set up @p pool with @p count slots (clamped to FRAME_POOL_MAX_SLOTS)
+ *        of @p slot_bytes each. Allocates nothing.
+ */
+void frame_pool_init(frame_pool_t *pool, int count, size_t slot_bytes,
+                     frame_pool_alloc_fn alloc, frame_pool_free_fn free_fn);
+
+/**
+ * @brief Get a buffer of at least @p bytes owned by @p owner.
+ *
+ * Prefers a slot that already has memory, then fills an empty slot, then
+ * falls back to a one-off allocation. Contents are undefined.
+ * @return NULL only when the allocator fails.
+ */
+void *frame_pool_acquire(frame_pool_t *pool, size_t bytes, frame_owner_t owner);
+
+/**
+ * @brief Move @p buf to @p owner.
+ * @return true for a pool slot that was owned; false for a one-off buffer or
+ *         NULL (nothing to track).
+ */
+bool frame_pool_handoff(frame_pool_t *pool, const void *buf, frame_owner_t owner);
+
+/** @brief Return @p buf to the pool (slot) or free it (anything else). NULL is a no-op. */
+void frame_pool_release(frame_pool_t *pool, void *buf);
+
+/** @brief Owner of @p buf, or FRAME_OWNER_FREE when it is not a pool slot. */
+frame_owner_t frame_pool_owner(const frame_pool_t *pool, const void *buf);
+
+void frame_pool_get_stats(const frame_pool_t *pool, frame_pool_stats_t *out);
+
+/** @brief Free every idle slot's memory (owned slots are left alone). */
+void frame_pool_trim(frame_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,10 +1,15 @@
 #include "goes_client.h"
 #include "jpeg_utils.h"
+#include "jpeg_service.h"
+#include "display_defs.h"
+#include "http_fetch.h"
 #include "esp_http_client.h"
 #include "esp_crt_bundle.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
+#include "esp_cache.h"
 #include "esp_timer.h"
+#include "perf_monitor.h"
 #include <string.h>
 
 static const char *TAG = "goes_client";
@@ -14,6 +19,31 @@ static const char *TAG = "goes_client";
 #define GOES_HTTP_TIMEOUT_MS 30000
 #define GOES_IMG_MAX_DIM     1024            /* reject images wider/taller than this before decode */
 #define GOES_MAX_REDIRECTS   5               /* follow up to this many 30x Location hops */
+#define GOES_VALIDATOR_SLOTS 4               /* foreground + prefetch source, with slack */
+/* Frame slots: the shown frame, a prefetched one, one being decoded or
+ * rendered, and the image page's front and back display copies. Each holds a
+ * display-sized (SCREEN_SIZE square) frame; larger decodes, up to
+ * GOES_IMG_MAX_DIM, get a one-off buffer from the pool's fallback path. */
+#define GOES_FRAME_SLOTS     5
+#define GOES_FRAME_SLOT_BYTES ((size_t)SCREEN_SIZE * SCREEN_SIZE * 2)
+
+frame_pool_t g_image_frames;
+static bool  s_frames_ready = false;
+
+/* ETag/Last-Modified per image URL, shared by goes_data and the prefetch
+ * struct (the cache is internally locked). Lazily created; NULL = every
+ * fetch is unconditional. */
+static http_validator_cache_t *s_validators = NULL;
+
+/* Collects the validators of the response being read (reset per redirect hop). */
+static esp_err_t goes_http_event_cb(esp_http_client_event_t *evt)
+{
+    if (evt->event_id == HTTP_EVENT_ON_HEADER && evt->user_data) {
+        http_validators_note_header((http_validators_t *)evt->user_data,
+                                    evt->header_key, evt->header_value);
+    }
+    return ESP_OK;
+}
 
 /* Set a human-readable failure reason under the goes lock and mark disconnected.
  * Centralizes the lock boilerplate so every failure exit can record a reason. */
@@ -27,11 +57,73 @@ static void set_error_msg(goes_data_t *d, const char *m)
     }
 }
 
+/* 128-byte aligned (PPA DMA / L2 cache line) PSRAM for frame slots. */
+static void *goes_frame_alloc(size_t bytes)
+{
+    return heap_caps_aligned_alloc(128, (bytes + 127) & ~(size_t)127, MALLOC_CAP_SPIRAM);
+}
+
+static void goes_frame_free(void *p)
+{
+    heap_caps_free(p);
+}
+
+/* Decode on the shared HW engine into an exact-size RGB565 frame slot,
+ * matching what jpeg_sw_decode_rgb565() returns (rows compacted when the width
+ * is not a multiple of the 16px MCU). The engine's output buffer goes straight
+ * back to its pool. Returns false (nothing allocated) when the HW decoder
+ * rejects the image, e.g. progressive JPEGs; the caller then falls back to the
+ * software decoder. */
+static bool goes_hw_decode(const uint8_t *jpg, size_t size, uint8_t **out_buf,
+                           uint32_t *out_w, uint32_t *out_h, size_t *out_size)
+{
+    jpeg_service_frame_t frame;
+    esp_err_t err = jpeg_service_decode(jpg, size, &frame);
+    if (err != ESP_OK) {
+        ESP_LOGI(TAG, "HW decode unavailable (%s), using SW decoder", esp_err_to_name(err));
+        return false;
+    }
+
+    size_t row = (size_t)frame.width * 2;
+    size_t bytes = ((row * frame.height) + 127) & ~(size_t)127;
+    uint8_t *dst = frame_pool_acquire(&g_image_frames, bytes, FRAME_OWNER_PRODUCER);
+    if (!dst) {
+        ESP_LOGE(TAG, "No frame slot for %lux%lu", (unsigned long)frame.width,
+                 (unsigned long)frame.height);
+        jpeg_service_release(&frame);
+        return false;
+    }
+    if (frame.stride_w == frame.width) {
+        memcpy(dst, frame.buf, row * frame.height);
+    } else {
+        size_t stride = (size_t)frame.stride_w * 2;
+        for (uint32_t y = 0; y < frame.height; y++) {
+            memcpy(dst + y * row, frame.buf + y * stride, row);
+        }
+    }
+    /* Flush CPU cache to PSRAM so PPA DMA reads the copied rows */
+    esp_cache_msync(dst, bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+
+    *out_w = frame.width;
+    *out_h = frame.height;
+    *out_size = bytes;
+    *out_buf = dst;
+    jpeg_service_release(&frame);
+    return true;
+}
+
 void goes_data_init(goes_data_t *data)
 {
     memset(data, 0, sizeof(*data));
     data->src_kind = -1;
+    data->frame_owner = FRAME_OWNER_SOURCE;
     data->mutex = xSemaphoreCreateMutex();
+    if (!s_frames_ready) {
+        /* Slots are filled on first use, so this reserves nothing yet. */
+        frame_pool_init(&g_image_frames, GOES_FRAME_SLOTS, GOES_FRAME_SLOT_BYTES,
+                        goes_frame_alloc, goes_frame_free);
+        s_frames_ready = true;
+    }
 }
 
 bool goes_data_lock(goes_data_t *data, int timeout_ms)
@@ -49,18 +141,26 @@ void goes_client_cleanup(goes_data_t *data)
 {
     if (!data) return;
     if (goes_data_lock(data, 1000)) {
-        if (data->image_buf) {
-            heap_caps_free(data->image_buf);
-            data->image_buf = NULL;
-        }
+        frame_pool_release(&g_image_frames, data->image_buf);
+        data->image_buf = NULL;
         data->image_w = 0;
         data->image_h = 0;
         data->src_kind = -1;
+        data->image_url[0] = '\0';
         data->connected = false;
         goes_data_unlock(data);
     }
 }
 
+void goes_client_force_full_fetch(goes_data_t *data)
+{
+    if (!data) return;
+    if (goes_data_lock(data, 1000)) {
+        data->image_url[0] = '\0';
+        goes_data_unlock(data);
+    }
+}
+
 /* NESDIS sectors publish different size ladders. Return the GEOCOLOR image
  * size string (WxH, no extension) the device should fetch for a given sector.
  * Square regional sectors use 600x600 or 500x500; wide oceanic/continental
@@ -209,6 +309,26 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
     if (!url || !data) return ESP_ERR_INVALID_ARG;
 
     ESP_LOGI(TAG, "Fetching %s", url);
+    perf_span_t fetch_span = perf_timer_start();
+
+    if (!s_validators) {
+        s_validators = http_validator_cache_create(GOES_VALIDATOR_SLOTS, 0);
+    }
+
+    /* Only ask for a 304 when the frame on screen came from this very URL:
+     * a 304 then means "keep image_buf", skipping the download and decode. */
+    http_validators_t cond;
+    bool conditional = false;
+    if (goes_data_lock(data, 1000)) {
+        conditional = data->image_buf && strcmp(data->image_url, url) == 0;
+        goes_data_unlock(data);
+    }
+    if (!conditional || !http_validator_lookup(s_validators, url, &cond)) {
+        conditional = false;
+    }
+
+    http_validators_t got;
+    http_validators_clear(&got);
 
     esp_http_client_config_t http_cfg = {
         .url = url,
@@ -216,6 +336,8 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
         .buffer_size = GOES_HTTP_BUF_SIZE,
         .buffer_size_tx = 1024,
         .crt_bundle_attach = esp_crt_bundle_attach,
+        .event_handler = goes_http_event_cb,
+        .user_data = &got,
     };
 
     esp_http_client_handle_t client = esp_http_client_init(&http_cfg);
@@ -224,6 +346,10 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
         set_error_msg(data, "Fetch failed");
         return ESP_FAIL;
     }
+    if (conditional) {
+        if (cond.etag[0]) esp_http_client_set_header(client, "If-None-Match", cond.etag);
+        if (cond.last_modified[0]) esp_http_client_set_header(client, "If-Modified-Since", cond.last_modified);
+    }
 
     esp_err_t err = esp_http_client_open(client, 0);
     if (err != ESP_OK) {
@@ -253,6 +379,7 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
          * target. Without this, the previous connection leaks for the duration of
          * the chain. cleanup() on the terminal path still closes exactly once. */
         esp_http_client_close(client);
+        http_validators_clear(&got);
         /* Re-issue the request against the new (redirected) URL. */
         err = esp_http_client_open(client, 0);
         if (err != ESP_OK) {
@@ -266,6 +393,20 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
         redirects++;
     }
 
+    if (status == 304 && conditional) {
+        ESP_LOGI(TAG, "Not modified, keeping current image");
+        esp_http_client_cleanup(client);
+        http_validator_note_not_modified(s_validators, url);
+        /* last_poll_ms is deliberately left alone: it is the display's
+         * "new frame" signal, and nothing changed. */
+        if (goes_data_lock(data, 1000)) {
+            data->error_msg[0] = '\0';
+            data->connected = true;
+            goes_data_unlock(data);
+        }
+        return ESP_OK;
+    }
+
     if (status != 200) {
         ESP_LOGW(TAG, "HTTP status %d", status);
         esp_http_client_cleanup(client);
@@ -280,6 +421,11 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
         content_length = GOES_JPEG_MAX_SIZE;
     }
 
+    uint8_t *rgb565 = NULL;
+    uint32_t out_w = 0, out_h = 0;
+    size_t out_size = 0;
+    int total_read = 0;
+
     uint8_t *jpeg_buf = heap_caps_malloc(content_length, MALLOC_CAP_SPIRAM);
     if (!jpeg_buf) {
         ESP_LOGE(TAG, "PSRAM alloc failed for JPEG (%d bytes)", content_length);
@@ -288,7 +434,6 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
         return ESP_ERR_NO_MEM;
     }
 
-    int total_read = 0;
     while (total_read < content_length) {
         int read_len = esp_http_client_read(client, (char *)(jpeg_buf + total_read),
                                             content_length - total_read);
@@ -330,25 +475,24 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
 
     ESP_LOGI(TAG, "Downloaded %d bytes JPEG, decoding...", total_read);
 
-    uint8_t *rgb565 = NULL;
-    uint32_t out_w = 0, out_h = 0;
-    size_t out_size = 0;
-
-    bool decoded = jpeg_sw_decode_rgb565(jpeg_buf, total_read,
-                                          &rgb565, &out_w, &out_h, &out_size);
+    bool decoded = goes_hw_decode(jpeg_buf, total_read, &rgb565, &out_w, &out_h, &out_size)
+                || jpeg_sw_decode_rgb565(jpeg_buf, total_read,
+                                         &rgb565, &out_w, &out_h, &out_size);
     heap_caps_free(jpeg_buf);
 
     if (!decoded || !rgb565) {
         ESP_LOGE(TAG, "JPEG decode failed");
-        if (rgb565) heap_caps_free(rgb565);
+        frame_pool_release(&g_image_frames, rgb565);
         set_error_msg(data, "Decode failed");
         return ESP_FAIL;
     }
+    perf_timer_stop(&g_perf.image_fetch_decode, fetch_span);
 
     ESP_LOGI(TAG, "Decoded %lux%lu (%u bytes)", out_w, out_h, (unsigned)out_size);
 
     if (goes_data_lock(data, 2000)) {
         uint8_t *old = data->image_buf;
+        frame_pool_handoff(&g_image_frames, rgb565, data->frame_owner);
         data->image_buf = rgb565;
         data->image_w = (uint16_t)out_w;
         data->image_h = (uint16_t)out_h;
@@ -356,13 +500,18 @@ esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, c
         if (label) { strlcpy(data->label, label, sizeof(data->label)); }
         else       { data->label[0] = '\0'; }
         data->src_kind = src_kind;
+        strlcpy(data->image_url, url, sizeof(data->image_url));
         data->error_msg[0] = '\0';   /* clear: this fetch succeeded */
         data->connected = true;
         data->last_poll_ms = esp_timer_get_time() / 1000;
         goes_data_unlock(data);
-        if (old) heap_caps_free(old);
+        frame_pool_release(&g_image_frames, old);
+        /* A URL longer than image_url can never match it, so skip storing. */
+        if (strlen(url) < sizeof(data->image_url)) {
+            http_validator_commit(s_validators, url, &got, (size_t)total_read);
+        }
     } else {
-        heap_caps_free(rgb565);
+        frame_pool_release(&g_image_frames, rgb565);
         return ESP_ERR_TIMEOUT;
     }
 
@@ -3,6 +3,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "esp_err.h"
+#include "frame_pool.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -16,9 +17,16 @@ typedef struct {
     char              label[48];    /* human-readable name of the source this buffer holds (region/band); rendered verbatim by the page so it can never desync from image_buf */
     char              error_msg[48]; /* human-readable failure reason shown on-screen when a fetch fails; "" when last fetch succeeded */
     int8_t            src_kind;      /* source the current image_buf belongs to: 0=GOES 1=Moon 2=Solar 3=Custom, -1=unknown */
+    char              image_url[256]; /* URL image_buf was decoded from; "" for rendered frames. A re-poll of the same URL is sent conditionally and a 304 keeps image_buf */
+    frame_owner_t     frame_owner;   /* g_image_frames stage image_buf is handed to on commit (FRAME_OWNER_SOURCE unless set after init) */
     SemaphoreHandle_t mutex;
 } goes_data_t;
 
+/* Frame slots shared by every image_buf (decoded or rendered) and the image
+ * page's display copies. image_buf is always released with
+ * frame_pool_release(&g_image_frames, ...), never heap_caps_free(). */
+extern frame_pool_t g_image_frames;
+
 void      goes_data_init(goes_data_t *data);
 bool      goes_data_lock(goes_data_t *data, int timeout_ms);
 void      goes_data_unlock(goes_data_t *data);
@@ -26,6 +34,11 @@ esp_err_t goes_client_poll(const char *region, goes_data_t *data);
 esp_err_t goes_client_poll_url(const char *url, goes_data_t *data, bool vflip, const char *label, int8_t src_kind);
 void      goes_client_cleanup(goes_data_t *data);
 
+/* Make the next goes_client_poll*() into @p data fetch unconditionally, e.g.
+ * when the caller needs a fresh commit (and last_poll_ms bump) to dismiss a
+ * loading overlay even if the image has not changed. */
+void      goes_client_force_full_fetch(goes_data_t *data);
+
 /* NESDIS sector code -> human-readable region name. Returns the code itself
  * when no match is found. Single source of truth for region labels. */
 const char *goes_region_name(const char *code);
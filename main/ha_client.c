@@ -2,25 +2,43 @@
  * @file ha_client.c
  * @brief Home Assistant client for the HA page.
  *
- * Uses http_fetch's shared fetcher. Within ha_client_poll a module-static
- * keep-alive slot (s_conn) is reused across the sequential per-entity fetches;
- * polling is single-owner (only ha_poll_task ever calls ha_client_poll), so the
- * slot needs no locking. The PUBLIC ha_client_fetch_entity() is a one-shot fetch
+ * Uses http_fetch's shared fetcher. A poll fans its per-entity fetches out to
+ * up to HA_FETCH_WORKERS short-lived tasks, started for that poll and gone once
+ * the work queue is empty, each borrowing one of the persistent keep-alive
+ * slots (an http_fetch_conn_t is single-task). The results are merged in tile
+ * order once they are all back or HA_POLL_DEADLINE_MS has passed -- an entity
+ * still out then keeps its tiles' published values, so one slow entity cannot
+ * stall the page. Polling is single-owner (only the ha poll job ever calls
+ * ha_client_poll). The PUBLIC ha_client_fetch_entity() is a one-shot fetch
  * (conn=NULL) so the /api/ha-probe handler can call it safely from the httpd
- * worker task without touching the poll task's keep-alive slot.
+ * worker task without touching the fetch workers' keep-alive slots.
  *
  * Per tile: (entity_id, attr). Fetch GET {base}/api/states/{entity_id} per
- * UNIQUE entity, sequentially, de-duped; resolve every tile's value from the
+ * UNIQUE entity, de-duped; resolve every tile's value from the
  * parsed entity (top-level "state" when attr=="state", else attributes.<attr>).
  * Config cache mirrors json_client.c get_tiles_config() (parse-once, invalidate
  * on change), storing a row-major (entity_id, attr) list.
+ *
+ * Poll fetches are conditional (s_validators, keyed by entity URL): a 304 for
+ * an entity leaves the already-published values of the tiles that reference
+ * it untouched. HA's REST API does not currently emit ETag/Last-Modified, in
+ * which case every fetch is simply a plain 200 as before.
+ *
+ * All of the above is the fallback: each poll first services the WebSocket
+ * subscription (ha_ws_client.c), and while that is live HA pushes the tile
+ * entities' changes itself and the poll fetches nothing.
  */
 
 #include "ha_client.h"
+#include "ha_ws_client.h"
+#include "ha_ws_proto.h"   /* ha_ws_value_str */
 #include "http_fetch.h"
+#include "perf_monitor.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "esp_heap_caps.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 #include "cJSON.h"
 #include <string.h>
 #include <strings.h>   /* strncasecmp / strcasecmp */
@@ -40,6 +58,22 @@ static const char *TAG = "ha_client";
  * and comfortably fit; overlong ids are rejected. */
 #define HA_ENTITY_ID_LEN       128
 
+/* REST fan-out workers. Three sockets in flight stays well inside the
+ * ~9-socket ceiling shared with NINA, JSON, AllSky and the web server. Stack
+ * and priority match the poll workers (each runs an mbedTLS handshake); the
+ * stack is PSRAM and only held while a fan-out is running. */
+#define HA_FETCH_WORKERS       3
+#define HA_FETCH_STACK_BYTES   16384
+#define HA_FETCH_PRIORITY      3
+
+/* Per-poll deadline for the fan-out: entities not back by then keep their
+ * tiles' published values. The poll job holds one of the two shared poll
+ * workers while it waits, so this is kept to a few keep-alive round trips
+ * (plus a handshake) rather than a transport timeout. */
+#define HA_POLL_DEADLINE_MS    3000
+
+_Static_assert(PERF_HA_MAX_TILES == JSON_MAX_TILES, "perf_monitor HA tile count != JSON_MAX_TILES");
+
 /* Cached parsed tiles_config_json + its source string -- avoids re-parsing and
  * re-walking rows[][] on every poll cycle. */
 static cJSON *s_cached_tiles     = NULL;
@@ -53,16 +87,60 @@ static const char *s_tile_entities[JSON_MAX_TILES];
 static const char *s_tile_attrs[JSON_MAX_TILES];
 static int         s_tile_count = 0;
 
-/* Persistent keep-alive slot, owned exclusively by ha_poll_task; lazily created
- * on first poll. */
+/* Keep-alive slot for fetching inline on the poll job when no worker could be
+ * started; lazily created. */
 static http_fetch_conn_t *s_conn = NULL;
 
+/* One poll's fan-out, shared with the workers under s_fetch_lock. gen is bumped
+ * when a poll is dispatched and again when it is collected, so a worker that
+ * finishes after the deadline (or picks up a stale queue entry) sees the
+ * mismatch and discards its result instead of writing into the next poll. */
+typedef struct {
+    char     id[HA_ENTITY_ID_LEN];
+    cJSON   *json;        /* parsed entity; NULL on failure or 304 */
+    bool     unchanged;   /* 304: published tiles still current */
+    bool     done;
+    uint32_t fetch_us;    /* GET duration, valid once done */
+} ha_fetch_slot_t;
+
+typedef struct {
+    uint32_t gen;
+    int      slot;
+} ha_fetch_work_t;
+
+static struct {
+    uint32_t        gen;
+    char            base[256];
+    char            token[256];
+    ha_fetch_slot_t slots[JSON_MAX_TILES];
+    TaskHandle_t    waiter;   /* poll job task, notified per result */
+} s_fetch;
+
+/* Worker bookkeeping (s_fetch_lock). A worker claims a free keep-alive slot
+ * when it starts and hands it back when it exits, so the connections outlive
+ * the tasks. s_fetch_running never exceeds HA_FETCH_WORKERS, hence a worker
+ * always finds a free slot. */
+static SemaphoreHandle_t  s_fetch_lock = NULL;
+static QueueHandle_t      s_fetch_queue = NULL;
+static int                s_fetch_running = 0;
+static http_fetch_conn_t *s_fetch_conns[HA_FETCH_WORKERS];
+static bool               s_fetch_conn_busy[HA_FETCH_WORKERS];
+
+/* Per-entity validators, plus a hash of the (base, token, tiles config) the
+ * published values were resolved with. Any change there -- or a publish that
+ * could not take the mutex -- clears the cache, since a 304 is only safe to
+ * act on while data->values[] still holds that entity's resolved tiles. */
+static http_validator_cache_t *s_validators = NULL;
+static uint64_t s_published_config_hash = 0;
+
 /* Forward declarations (prototype-before-use under -Werror). */
-static bool   cjson_scalar_str(const cJSON *node, char *buf, size_t len);
 static void   invalidate_tiles_config(void);
 static int    get_tiles_config(const char *tiles_config_json);
+static bool   entity_url(const char *base_url, const char *entity_id,
+                         char *url, size_t url_len);
 static cJSON *fetch_entity_core(const char *base_url, const char *token,
-                                const char *entity_id, http_fetch_conn_t *conn);
+                                const char *entity_id, http_fetch_conn_t *conn,
+                                http_validator_cache_t *validators, bool *unchanged);
 static bool   resolve_tile_value(cJSON *entity, const char *attr,
                                  char *out, size_t out_len);
 
@@ -79,6 +157,7 @@ void ha_client_init(ha_data_t *data) {
     data->tile_count = 0;
     data->last_poll_ms = 0;
     data->mutex = xSemaphoreCreateMutex();
+    ha_ws_client_init();
 }
 
 bool ha_client_lock(ha_data_t *data, int timeout_ms) {
@@ -94,46 +173,6 @@ void ha_client_unlock(ha_data_t *data) {
     }
 }
 
-// =============================================================================
-// Scalar extraction -- string/number/bool -> string (mirrors json_client:95-125)
-// =============================================================================
-
-/**
- * Render a scalar cJSON node into @p buf as a string. Returns false (and sets
- * buf to "") for non-scalar nodes (object/array/null) or a NULL node.
- */
-static bool cjson_scalar_str(const cJSON *node, char *buf, size_t len) {
-    if (!buf || len == 0) {
-        return false;
-    }
-    buf[0] = '\0';
-    if (!node) {
-        return false;
-    }
-
-    if (cJSON_IsString(node)) {
-        snprintf(buf, len, "%s", node->valuestring ? node->valuestring : "");
-        return true;
-    }
-
-    if (cJSON_IsNumber(node)) {
-        double val = node->valuedouble;
-        if (val == (double)(int)val) {
-            snprintf(buf, len, "%d", (int)val);
-        } else {
-            snprintf(buf, len, "%.2f", val);
-        }
-        return true;
-    }
-
-    if (cJSON_IsBool(node)) {
-        snprintf(buf, len, "%s", cJSON_IsTrue(node) ? "true" : "false");
-        return true;
-    }
-
-    return false;
-}
-
 // =============================================================================
 // Tiles config cache -- parse-once + row-major (entity_id, attr) list
 // =============================================================================
@@ -261,15 +300,7 @@ static bool resolve_tile_value(cJSON *entity, const char *attr,
         }
     }
 
-    if (!cjson_scalar_str(node, out, out_len)) {
-        return false;
-    }
-
-    if (strcasecmp(out, "unavailable") == 0 || strcasecmp(out, "unknown") == 0) {
-        out[0] = '\0';
-        return false;
-    }
-    return true;
+    return ha_ws_value_str(node, out, out_len);
 }
 
 // =============================================================================
@@ -277,34 +308,52 @@ static bool resolve_tile_value(cJSON *entity, const char *attr,
 // =============================================================================
 
 /**
- * Fetch GET {base_url}/api/states/{entity_id} with Bearer auth. @p conn may be a
- * keep-alive slot (poll task) or NULL for a one-shot client (probe handler).
- * Returns the parsed entity JSON (caller cJSON_Delete) or NULL on failure.
+ * Build {base_url}/api/states/{entity_id} into @p url -- the key the entity's
+ * validators are stored under. Returns false (logged) if it does not fit.
  */
-static cJSON *fetch_entity_core(const char *base_url, const char *token,
-                                const char *entity_id, http_fetch_conn_t *conn) {
-    if (!base_url || base_url[0] == '\0' || !entity_id || entity_id[0] == '\0') {
-        return NULL;
-    }
-
+static bool entity_url(const char *base_url, const char *entity_id,
+                       char *url, size_t url_len) {
     /* Strip any trailing slash(es) from base so "{base}/api/states/{id}" never
      * produces a double slash. base_url is <=255 chars. */
     char base[256];
     size_t blen = strlen(base_url);
     if (blen >= sizeof(base)) {
         ESP_LOGW(TAG, "HA base_url too long");
-        return NULL;
+        return false;
     }
     memcpy(base, base_url, blen + 1);
     while (blen > 0 && base[blen - 1] == '/') {
         base[--blen] = '\0';
     }
 
+    int un = snprintf(url, url_len, "%s/api/states/%s", base, entity_id);
+    if (un <= 0 || un >= (int)url_len) {
+        ESP_LOGW(TAG, "HA URL truncated for entity %s", entity_id);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Fetch GET {base_url}/api/states/{entity_id} with Bearer auth. @p conn may be a
+ * keep-alive slot (poll task) or NULL for a one-shot client (probe handler).
+ * Returns the parsed entity JSON (caller cJSON_Delete) or NULL on failure.
+ * With @p validators the GET is conditional; a 304 returns NULL with
+ * *unchanged set true (@p unchanged may be NULL when @p validators is).
+ */
+static cJSON *fetch_entity_core(const char *base_url, const char *token,
+                                const char *entity_id, http_fetch_conn_t *conn,
+                                http_validator_cache_t *validators, bool *unchanged) {
+    if (unchanged) {
+        *unchanged = false;
+    }
+    if (!base_url || base_url[0] == '\0' || !entity_id || entity_id[0] == '\0') {
+        return NULL;
+    }
+
     /* url[512] covers base[256] + "/api/states/" + entity_id (<=127). */
     char url[512];
-    int un = snprintf(url, sizeof(url), "%s/api/states/%s", base, entity_id);
-    if (un <= 0 || un >= (int)sizeof(url)) {
-        ESP_LOGW(TAG, "HA URL truncated for entity %s", entity_id);
+    if (!entity_url(base_url, entity_id, url, sizeof(url))) {
         return NULL;
     }
 
@@ -329,11 +378,18 @@ static cJSON *fetch_entity_core(const char *base_url, const char *token,
         .max_response_bytes = HA_RESPONSE_BUF_SIZE,
         .extra_header = (auth[0] != '\0') ? auth : NULL,
         .conn = conn,
+        .validators = validators,
     };
 
     char *buffer = NULL;
     size_t total_read = 0;
     esp_err_t err = http_fetch_text(url, &opts, &buffer, &total_read);
+    if (err == HTTP_FETCH_NOT_MODIFIED) {
+        if (unchanged) {
+            *unchanged = true;
+        }
+        return NULL;
+    }
     if (err != ESP_OK) {
         ESP_LOGW(TAG, "HA fetch failed for %s: %s", entity_id, esp_err_to_name(err));
         return NULL;
@@ -341,6 +397,7 @@ static cJSON *fetch_entity_core(const char *base_url, const char *token,
     if (total_read == 0) {
         ESP_LOGW(TAG, "HA: empty response for %s", entity_id);
         heap_caps_free(buffer);
+        http_validator_forget(validators, url);
         return NULL;
     }
 
@@ -348,6 +405,7 @@ static cJSON *fetch_entity_core(const char *base_url, const char *token,
     heap_caps_free(buffer);
     if (!json) {
         ESP_LOGW(TAG, "HA: failed to parse response for %s", entity_id);
+        http_validator_forget(validators, url);
         return NULL;
     }
     return json;
@@ -356,7 +414,240 @@ static cJSON *fetch_entity_core(const char *base_url, const char *token,
 cJSON *ha_client_fetch_entity(const char *base_url, const char *token,
                               const char *entity_id) {
     /* One-shot (conn=NULL): safe to call from the httpd worker task. */
-    return fetch_entity_core(base_url, token, entity_id, NULL);
+    return fetch_entity_core(base_url, token, entity_id, NULL, NULL, NULL);
+}
+
+// =============================================================================
+// REST fan-out workers
+// =============================================================================
+
+static void ha_fetch_worker(void *arg) {
+    (void)arg;
+    char base[sizeof(s_fetch.base)];
+    char token[sizeof(s_fetch.token)];
+    char id[HA_ENTITY_ID_LEN];
+
+    /* Borrow a keep-alive slot; NULL on alloc failure, in which case
+     * http_fetch uses a one-shot client per fetch. */
+    int c = 0;
+    xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+    while (c < HA_FETCH_WORKERS - 1 && s_fetch_conn_busy[c]) {
+        c++;
+    }
+    s_fetch_conn_busy[c] = true;
+    xSemaphoreGive(s_fetch_lock);
+    if (!s_fetch_conns[c]) {
+        s_fetch_conns[c] = http_fetch_conn_create();
+    }
+    http_fetch_conn_t *conn = s_fetch_conns[c];
+
+    while (1) {
+        /* Empty check and exit under the lock: the poll job queues under it
+         * too, so it never counts on a worker that is already leaving. */
+        ha_fetch_work_t w;
+        xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+        if (xQueueReceive(s_fetch_queue, &w, 0) != pdTRUE) {
+            s_fetch_conn_busy[c] = false;
+            s_fetch_running--;
+            xSemaphoreGive(s_fetch_lock);
+            break;
+        }
+        bool current = (w.gen == s_fetch.gen);
+        if (current) {
+            memcpy(base, s_fetch.base, sizeof(base));
+            memcpy(token, s_fetch.token, sizeof(token));
+            memcpy(id, s_fetch.slots[w.slot].id, sizeof(id));
+        }
+        xSemaphoreGive(s_fetch_lock);
+        if (!current) {
+            continue;   /* its poll was collected before this entry was reached */
+        }
+
+        bool unchanged = false;
+        perf_span_t span = perf_timer_start();
+        int64_t start_us = esp_timer_get_time();
+        cJSON *json = fetch_entity_core(base, token, id, conn, s_validators, &unchanged);
+        int64_t fetch_us = esp_timer_get_time() - start_us;
+        perf_timer_stop(&g_perf.ha_entity_fetch, span);
+        ESP_LOGD(TAG, "HA entity %s: %lld ms", id, (long long)(fetch_us / 1000));
+
+        xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+        if (w.gen == s_fetch.gen) {
+            ha_fetch_slot_t *slot = &s_fetch.slots[w.slot];
+            slot->json = json;
+            slot->unchanged = unchanged;
+            slot->fetch_us = fetch_us > UINT32_MAX ? UINT32_MAX : (uint32_t)fetch_us;
+            slot->done = true;
+            json = NULL;
+            if (s_fetch.waiter) {
+                xTaskNotifyGive(s_fetch.waiter);
+            }
+        }
+        xSemaphoreGive(s_fetch_lock);
+
+        if (json) {
+            /* Late: the poll merged without this body, but its validators were
+             * stored -- a later 304 would then vouch for values never published.
+             * Only this entity's entry is dropped; the others stay good. */
+            cJSON_Delete(json);
+            char url[512];
+            if (entity_url(base, id, url, sizeof(url))) {
+                http_validator_forget(s_validators, url);
+            }
+        }
+    }
+
+    /* Frees the PSRAM stack and TCB once this task is gone. */
+    vTaskDeleteWithCaps(NULL);
+}
+
+/**
+ * Start workers for a fan-out of @p n entities already on the queue, up to
+ * HA_FETCH_WORKERS in total (a straggler from the previous poll still counts
+ * and picks up work once its fetch returns). Only the ha poll job calls this.
+ * Returns the number running; 0 means the caller fetches inline.
+ */
+static int ha_fetch_workers_start(int n) {
+    int want = n < HA_FETCH_WORKERS ? n : HA_FETCH_WORKERS;
+
+    xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+    int start = want - s_fetch_running;
+    if (start > 0) {
+        s_fetch_running += start;   /* reserved before the tasks can exit */
+    }
+    xSemaphoreGive(s_fetch_lock);
+
+    for (int i = 0; i < start; i++) {
+        /* PSRAM stack, Core 0 (networking) like the poll workers. */
+        if (xTaskCreatePinnedToCoreWithCaps(ha_fetch_worker, "ha_fetch", HA_FETCH_STACK_BYTES,
+                                            NULL, HA_FETCH_PRIORITY, NULL, 0,
+                                            MALLOC_CAP_SPIRAM) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to start HA fetch worker");
+            xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+            s_fetch_running--;
+            xSemaphoreGive(s_fetch_lock);
+        }
+    }
+
+    xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+    int running = s_fetch_running;
+    xSemaphoreGive(s_fetch_lock);
+    return running;
+}
+
+/**
+ * Fetch the @p n entities in @p ids concurrently and wait until all are back
+ * or HA_POLL_DEADLINE_MS has passed. Results land in @p json / @p unchanged /
+ * @p fetch_us by index (tile order is restored by the caller); @p late[u] is
+ * set for an entity still out at the deadline. Returns the number late.
+ */
+static int ha_fetch_fanout(const char *base_url, const char *token,
+                           char ids[][HA_ENTITY_ID_LEN], int n,
+                           cJSON **json, bool *unchanged, uint32_t *fetch_us,
+                           bool *late) {
+    if (n <= 0) {
+        return 0;
+    }
+    if (!s_fetch_lock) {
+        /* Only the ha poll job gets here, so there is no create race. */
+        s_fetch_lock = xSemaphoreCreateMutex();
+        s_fetch_queue = xQueueCreate(JSON_MAX_TILES, sizeof(ha_fetch_work_t));
+    }
+
+    int running = 0;
+    uint32_t gen = 0;
+    if (s_fetch_lock && s_fetch_queue) {
+        /* Drop any notification left from an earlier poll before counting. */
+        ulTaskNotifyTake(pdTRUE, 0);
+        xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+        gen = ++s_fetch.gen;
+        snprintf(s_fetch.base, sizeof(s_fetch.base), "%s", base_url);
+        snprintf(s_fetch.token, sizeof(s_fetch.token), "%s", token ? token : "");
+        for (int u = 0; u < n; u++) {
+            ha_fetch_slot_t *slot = &s_fetch.slots[u];
+            memcpy(slot->id, ids[u], HA_ENTITY_ID_LEN);
+            slot->json = NULL;
+            slot->unchanged = false;
+            slot->done = false;
+            slot->fetch_us = 0;
+            ha_fetch_work_t w = { .gen = gen, .slot = u };
+            xQueueSend(s_fetch_queue, &w, 0);   /* n <= queue length, emptied per poll */
+        }
+        s_fetch.waiter = xTaskGetCurrentTaskHandle();
+        xSemaphoreGive(s_fetch_lock);
+        running = ha_fetch_workers_start(n);
+    } else {
+        ESP_LOGE(TAG, "Failed to create HA fetch queue");
+    }
+
+    if (running == 0) {
+        /* No worker: fetch inline, sequentially, on the poll job. */
+        if (s_fetch_lock && s_fetch_queue) {
+            xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+            xQueueReset(s_fetch_queue);
+            s_fetch.gen++;
+            s_fetch.waiter = NULL;
+            xSemaphoreGive(s_fetch_lock);
+        }
+        if (!s_conn) {
+            s_conn = http_fetch_conn_create();
+        }
+        for (int u = 0; u < n; u++) {
+            perf_span_t span = perf_timer_start();
+            int64_t start_us = esp_timer_get_time();
+            json[u] = fetch_entity_core(base_url, token, ids[u], s_conn, s_validators,
+                                        &unchanged[u]);
+            int64_t us = esp_timer_get_time() - start_us;
+            perf_timer_stop(&g_perf.ha_entity_fetch, span);
+            fetch_us[u] = us > UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+            late[u] = false;
+        }
+        return 0;
+    }
+
+    int64_t deadline_ms = esp_timer_get_time() / 1000 + HA_POLL_DEADLINE_MS;
+    while (1) {
+        int done = 0;
+        xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+        for (int u = 0; u < n; u++) {
+            done += s_fetch.slots[u].done ? 1 : 0;
+        }
+        xSemaphoreGive(s_fetch_lock);
+        int64_t left_ms = deadline_ms - esp_timer_get_time() / 1000;
+        if (done == n || left_ms <= 0) {
+            break;
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS((uint32_t)left_ms));
+    }
+
+    /* Collect, then retire the generation: stragglers discard their results,
+     * and emptying the queue lets every worker exit once its fetch returns. */
+    int late_count = 0;
+    xSemaphoreTake(s_fetch_lock, portMAX_DELAY);
+    for (int u = 0; u < n; u++) {
+        ha_fetch_slot_t *slot = &s_fetch.slots[u];
+        json[u] = slot->json;
+        unchanged[u] = slot->unchanged;
+        fetch_us[u] = slot->fetch_us;
+        late[u] = !slot->done;
+        slot->json = NULL;
+        if (late[u]) {
+            late_count++;
+        }
+    }
+    xQueueReset(s_fetch_queue);
+    s_fetch.gen++;
+    s_fetch.waiter = NULL;
+    xSemaphoreGive(s_fetch_lock);
+
+    for (int u = 0; u < n; u++) {
+        if (late[u]) {
+            ESP_LOGW(TAG, "HA entity %s not back within %d ms; keeping its tiles",
+                     ids[u], HA_POLL_DEADLINE_MS);
+        }
+    }
+    perf_counter_add(&g_perf.ha_entity_late_count, (uint32_t)late_count);
+    return late_count;
 }
 
 // =============================================================================
@@ -373,6 +664,19 @@ void ha_client_poll(const char *base_url, const char *token,
     if (count > JSON_MAX_TILES) {
         count = JSON_MAX_TILES;
     }
+
+    uint64_t config_hash =
+        http_validator_url_hash(tiles_config_json ? tiles_config_json : "") ^
+        (http_validator_url_hash(base_url) << 1) ^
+        (http_validator_url_hash(token ? token : "") << 2);
+
+    /* Pushed updates first: while the subscription is live and published, the
+     * tiles are current and there is nothing to fetch. */
+    if (ha_ws_client_service(base_url, token, s_tile_entities, s_tile_attrs,
+                             count > 0 ? count : 0, config_hash, data)) {
+        return;
+    }
+
     if (count <= 0) {
         /* No tiles configured -- nothing to fetch. Publish connected=true so the
          * page adapter's overlay ordering (base -> !connected -> tile_count==0)
@@ -387,27 +691,27 @@ void ha_client_poll(const char *base_url, const char *token,
         return;
     }
 
-    /* Lazily create the keep-alive slot on first poll. On failure, fall through
-     * with s_conn == NULL -- http_fetch uses a one-shot client per fetch. */
-    if (!s_conn) {
-        s_conn = http_fetch_conn_create();
-        if (!s_conn) {
-            ESP_LOGW(TAG, "Failed to allocate HA keep-alive connection slot");
-        }
+    if (!s_validators) {
+        s_validators = http_validator_cache_create(JSON_MAX_TILES, 0);
     }
 
-    /* De-dupe unique entity_ids (O(n^2), n<=JSON_MAX_TILES). Each unique entity is fetched
-     * ONCE, sequentially, reusing s_conn; the parsed JSON is reused for every
-     * tile that references it. */
-    char   unique_ids[JSON_MAX_TILES][HA_ENTITY_ID_LEN];
-    cJSON *unique_json[JSON_MAX_TILES];
-    int    unique_count = 0;
-    int    fetched_ok = 0;
-
-    for (int i = 0; i < JSON_MAX_TILES; i++) {
-        unique_json[i] = NULL;
+    if (config_hash != s_published_config_hash) {
+        http_validator_cache_clear(s_validators);
     }
 
+    /* De-dupe unique entity_ids (O(n^2), n<=JSON_MAX_TILES). Each unique entity is
+     * fetched ONCE, concurrently on the fetch workers; the parsed JSON is reused for every
+     * tile that references it. An entity that came back 304 has no JSON but is
+     * marked unchanged, and one still out at the deadline is marked late: the
+     * tiles of both keep their published values. */
+    char     unique_ids[JSON_MAX_TILES][HA_ENTITY_ID_LEN];
+    cJSON   *unique_json[JSON_MAX_TILES];
+    bool     unique_unchanged[JSON_MAX_TILES];
+    bool     unique_late[JSON_MAX_TILES];
+    uint32_t unique_us[JSON_MAX_TILES];
+    int      unique_count = 0;
+    int      fetched_ok = 0;
+
     for (int i = 0; i < count; i++) {
         const char *ent = s_tile_entities[i];
         if (!ent || ent[0] == '\0') {
@@ -424,23 +728,27 @@ void ha_client_poll(const char *base_url, const char *token,
                 break;
             }
         }
-        if (seen) {
-            continue;
+        if (!seen) {
+            snprintf(unique_ids[unique_count++], HA_ENTITY_ID_LEN, "%s", ent);
         }
-        /* New unique entity -- fetch it now (sequential, keep-alive reuse). */
-        snprintf(unique_ids[unique_count], HA_ENTITY_ID_LEN, "%s", ent);
-        cJSON *ej = fetch_entity_core(base_url, token, ent, s_conn);
-        unique_json[unique_count] = ej;   /* NULL on failure */
-        if (ej) {
+    }
+
+    perf_span_t fetch_span = perf_timer_start();
+    int late_count = ha_fetch_fanout(base_url, token, unique_ids, unique_count,
+                                     unique_json, unique_unchanged, unique_us,
+                                     unique_late);
+    perf_timer_stop(&g_perf.ha_poll_fetch, fetch_span);
+    for (int u = 0; u < unique_count; u++) {
+        if (unique_json[u] || unique_unchanged[u]) {
             fetched_ok++;
         }
-        unique_count++;
     }
 
     /* Resolve every tile from the de-duped parsed entities into local scratch. */
     ha_data_t local;
     memset(&local, 0, sizeof(local));
     local.mutex = NULL;   /* local scratch -- never locked */
+    bool keep[JSON_MAX_TILES] = { false };   /* tile's entity was a 304 or late */
 
     for (int i = 0; i < count; i++) {
         const char *ent = s_tile_entities[i];
@@ -453,9 +761,19 @@ void ha_client_poll(const char *base_url, const char *token,
         for (int u = 0; u < unique_count; u++) {
             if (strcmp(unique_ids[u], ent) == 0) {
                 ej = unique_json[u];
+                /* A late entity keeps what this tile last showed -- unless
+                 * the config changed and slot i used to be another tile. */
+                keep[i] = unique_unchanged[u] ||
+                          (unique_late[u] && config_hash == s_published_config_hash);
+                if (!unique_late[u]) {
+                    perf_ha_tile_record(i, unique_us[u]);   /* this tile's entity GET */
+                }
                 break;
             }
         }
+        if (keep[i]) {
+            continue;
+        }
         bool ok = resolve_tile_value(ej, s_tile_attrs[i],
                                      local.values[i], JSON_TILE_VALUE_LEN);
         local.resolved[i] = ok;
@@ -477,12 +795,19 @@ void ha_client_poll(const char *base_url, const char *token,
         data->connected = (fetched_ok > 0);
         data->last_poll_ms = esp_timer_get_time() / 1000;
         data->tile_count = local.tile_count;
-        memcpy(data->values, local.values, sizeof(data->values));
-        memcpy(data->resolved, local.resolved, sizeof(data->resolved));
+        for (int i = 0; i < JSON_MAX_TILES; i++) {
+            if (keep[i]) {
+                continue;
+            }
+            memcpy(data->values[i], local.values[i], sizeof(data->values[i]));
+            data->resolved[i] = local.resolved[i];
+        }
         ha_client_unlock(data);
-        ESP_LOGD(TAG, "HA poll: %d tiles, %d/%d entities OK",
-                 count, fetched_ok, unique_count);
+        s_published_config_hash = config_hash;
+        ESP_LOGD(TAG, "HA poll: %d tiles, %d/%d entities OK, %d late",
+                 count, fetched_ok, unique_count, late_count);
     } else {
         ESP_LOGW(TAG, "HA: failed to acquire mutex for data update");
+        http_validator_cache_clear(s_validators);
     }
 }
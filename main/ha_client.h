@@ -6,16 +6,22 @@
  *
  * Per-tile entity+attribute model. Each poll: parse ha_tiles_config into a
  * row-major (entity_id, attr) list; DE-DUPE unique entity_ids; fetch
- * GET {base}/api/states/{entity_id} for each UNIQUE entity SEQUENTIALLY (never
- * concurrent -- respect the ~9-socket ceiling), reusing one keep-alive slot;
+ * GET {base}/api/states/{entity_id} for each UNIQUE entity on a pool of 3
+ * keep-alive workers (bounded -- respect the ~9-socket ceiling), waiting at most
+ * a per-poll deadline (a late entity keeps its tiles' published values);
  * parse each entity once; resolve every tile's value (state or attributes.<attr>)
  * into a raw scalar string. "unavailable"/"unknown"/missing => resolved=false
  * (renderer shows "--"). Auth: build "Authorization: Bearer <token>" and pass via
  * http_fetch_opts_t.extra_header (mirrors json_client's extra_header path exactly,
  * avoiding any dependency on http_fetch's internal bearer buffer size).
  *
- * Single-owner: only ha_poll_task calls ha_client_poll(); the keep-alive slot
- * needs no locking. Data publish is mutex-protected. Modeled 1:1 on json_client.
+ * Single-owner: only the ha poll job calls ha_client_poll(); each pool worker
+ * owns its keep-alive slot. Data publish is mutex-protected. Modeled 1:1 on
+ * json_client.
+ *
+ * The REST fetches above are the fallback path: ha_client_poll() first keeps
+ * a WebSocket subscription to the tile entities running (ha_ws_client.h) and
+ * fetches nothing while it is live -- HA then pushes changes into ha_data_t.
  */
 
 #include <stdbool.h>
@@ -44,7 +50,8 @@ bool ha_client_lock(ha_data_t *data, int timeout_ms);
 void ha_client_unlock(ha_data_t *data);
 
 /**
- * Poll all configured HA entities and resolve every tile value.
+ * Poll all configured HA entities and resolve every tile value. Services the
+ * WebSocket subscription first and returns without fetching while it is live.
  *  - base_url: scheme+host+port (no path); appends "/api/states/<entity_id>".
  *  - token: RAW long-lived token; wrapped as Authorization: Bearer.
  *  - tiles_config_json: ha_tiles_config (rows/tiles; each tile has entity_id+attr).
@@ -0,0 +1,369 @@
+/**
+ * @file ha_ws_client.c
+ * @brief Home Assistant WebSocket subscription (see ha_ws_client.h).
+ *
+ * Threading: start/stop happen in the ha poll job (ha_ws_client_service) or
+ * an httpd worker (ha_ws_client_stop), serialized by s_life_mutex. Everything
+ * the event handler touches -- the protocol state and the reassembly buffer --
+ * is only written by the esp_websocket_client task while a client exists, and
+ * only reset after esp_websocket_client_destroy() has returned. The handler
+ * reports back through atomics.
+ */
+
+#include "ha_ws_client.h"
+#include "ha_ws_proto.h"
+#include "tasks.h"            /* data_task_handle, ha_page_active */
+#include "esp_websocket_client.h"
+#include "esp_crt_bundle.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/task.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "ha_ws";
+
+#define HA_WS_BACKOFF_INITIAL_MS   5000
+#define HA_WS_BACKOFF_MAX_MS       300000
+#define HA_WS_SETUP_TIMEOUT_MS     20000    /* connect + auth + initial states */
+#define HA_WS_SEND_TIMEOUT_MS      2000
+/* Largest message accepted. The initial "a" event carries every attribute of
+ * every subscribed entity (weather forecasts, media players) -- same cap as a
+ * REST entity response. Anything bigger fails the session; REST takes over. */
+#define HA_WS_MSG_MAX              262144
+
+_Static_assert(HA_WS_MAX_TILES == JSON_MAX_TILES, "ha_ws_proto tile count != JSON_MAX_TILES");
+_Static_assert(HA_WS_VALUE_LEN == JSON_TILE_VALUE_LEN, "ha_ws_proto value length != JSON_TILE_VALUE_LEN");
+
+static SemaphoreHandle_t s_life_mutex = NULL;
+
+/* Lifecycle state (s_life_mutex). */
+static esp_websocket_client_handle_t s_client = NULL;
+static ha_ws_proto_t *s_proto = NULL;       /* PSRAM, kept across sessions */
+static ha_data_t *s_data = NULL;
+static uint64_t s_config_hash = 0;
+static int64_t  s_started_ms = 0;
+static int64_t  s_retry_at_ms = 0;
+static int      s_backoff_ms = HA_WS_BACKOFF_INITIAL_MS;
+
+/* Written by the client task, read by the poll job. */
+static _Atomic int      s_phase = HA_WS_IDLE;      /* mirror of s_proto->phase */
+static _Atomic bool     s_closed = false;          /* socket dropped since start */
+static _Atomic uint32_t s_unpublished = 0;         /* changed tiles ha_data_t lacks */
+
+/* Reassembly of fragmented messages (client task only). */
+static char *s_msg = NULL;
+static int   s_msg_len = 0;
+static int   s_msg_have = 0;
+
+void ha_ws_client_init(void) {
+    if (!s_life_mutex) {
+        s_life_mutex = xSemaphoreCreateMutex();
+    }
+}
+
+// =============================================================================
+// Client task side
+// =============================================================================
+
+static void drop_message(void) {
+    if (s_msg) {
+        heap_caps_free(s_msg);
+        s_msg = NULL;
+    }
+    s_msg_len = 0;
+    s_msg_have = 0;
+}
+
+static void fail_session(const char *why) {
+    ESP_LOGW(TAG, "Subscription failed: %s", why);
+    s_proto->phase = HA_WS_FAILED;
+    s_phase = HA_WS_FAILED;
+    drop_message();
+}
+
+/**
+ * Publish the tiles in @p changed (plus any a busy mutex held back earlier)
+ * into ha_data_t, then wake the data task if the HA page is showing. An empty
+ * set publishes nothing and wakes no one.
+ */
+static void publish(uint32_t changed) {
+    uint32_t pending = s_unpublished | changed;
+    if (!pending) {
+        return;
+    }
+    if (!ha_client_lock(s_data, 50)) {
+        s_unpublished = pending;   /* REST covers until the next message retries */
+        return;
+    }
+    for (int i = 0; i < s_proto->tile_count; i++) {
+        if (pending & (1u << i)) {
+            memcpy(s_data->values[i], s_proto->values[i], sizeof(s_data->values[i]));
+            s_data->resolved[i] = s_proto->resolved[i];
+        }
+    }
+    s_data->tile_count = s_proto->tile_count;
+    s_data->connected = true;
+    s_data->last_poll_ms = esp_timer_get_time() / 1000;
+    ha_client_unlock(s_data);
+    s_unpublished = 0;
+
+    ESP_LOGD(TAG, "Pushed %d tile change(s)", __builtin_popcount(pending));
+    if (ha_page_active && data_task_handle) {
+        xTaskNotifyGive(data_task_handle);
+    }
+}
+
+/**
+ * Reassemble one text message from its DATA events (see ws_handle_data_frame
+ * in nina_websocket.c for the fragment layout) and hand it to the protocol.
+ * Unlike NINA events nothing here can be skipped: a lost fragment is a lost
+ * delta, so it fails the session.
+ */
+static void on_data(esp_websocket_event_data_t *d) {
+    int total = d->payload_len;
+    int off   = d->payload_offset;
+    int chunk = d->data_len;
+    if (total <= 0 || chunk < 0 || s_proto->phase == HA_WS_FAILED) {
+        return;
+    }
+
+    if (off == 0) {
+        drop_message();
+        if (total > HA_WS_MSG_MAX) {
+            fail_session("message too large");
+            return;
+        }
+        s_msg = heap_caps_malloc((size_t)total + 1, MALLOC_CAP_SPIRAM);
+        if (!s_msg) {
+            fail_session("out of memory");
+            return;
+        }
+        s_msg_len = total;
+    } else if (!s_msg || off != s_msg_have || total != s_msg_len) {
+        fail_session("fragment out of sequence");
+        return;
+    }
+    if (chunk > s_msg_len - s_msg_have) {
+        fail_session("fragment overflow");
+        return;
+    }
+    memcpy(s_msg + s_msg_have, d->data_ptr, (size_t)chunk);
+    s_msg_have += chunk;
+    if (s_msg_have < s_msg_len) {
+        return;
+    }
+    s_msg[s_msg_len] = '\0';
+
+    ha_ws_result_t r = ha_ws_proto_handle(s_proto, s_msg, (size_t)s_msg_len);
+    drop_message();
+
+    if (r.reply &&
+        esp_websocket_client_send_text(s_client, r.reply, (int)r.reply_len,
+                                       pdMS_TO_TICKS(HA_WS_SEND_TIMEOUT_MS)) < 0) {
+        fail_session("send failed");
+        return;
+    }
+    s_phase = s_proto->phase;
+    if (s_proto->phase == HA_WS_LIVE) {
+        publish(r.changed);
+    } else if (s_proto->phase == HA_WS_AUTH_FAILED) {
+        ESP_LOGW(TAG, "Access token rejected (auth_invalid)");
+    }
+}
+
+static void ha_ws_event_handler(void *handler_args, esp_event_base_t base,
+                                int32_t event_id, void *event_data)
+{
+    (void)handler_args;
+    (void)base;
+    esp_websocket_event_data_t *data = (esp_websocket_event_data_t *)event_data;
+
+    switch (event_id) {
+    case WEBSOCKET_EVENT_CONNECTED:
+        ESP_LOGI(TAG, "Connected, authenticating");
+        drop_message();
+        ha_ws_proto_begin(s_proto);
+        s_phase = HA_WS_AUTH;
+        break;
+
+    case WEBSOCKET_EVENT_DISCONNECTED:
+    case WEBSOCKET_EVENT_CLOSED:
+        s_closed = true;
+        break;
+
+    case WEBSOCKET_EVENT_DATA:
+        /* Text frame (0x01) and continuation (0x00); control frames ignored. */
+        if (data->op_code == 0x01 || data->op_code == 0x00) {
+            on_data(data);
+        }
+        break;
+
+    case WEBSOCKET_EVENT_ERROR:
+        ESP_LOGW(TAG, "Error");
+        break;
+
+    default:
+        break;
+    }
+}
+
+// =============================================================================
+// Lifecycle (s_life_mutex)
+// =============================================================================
+
+/**
+ * Build the WebSocket URL from the HA base URL:
+ * "http://ha.local:8123/" -> "ws://ha.local:8123/api/websocket",
+ * "https://..." -> "wss://...". Any path prefix (reverse proxy) is kept.
+ */
+static bool build_ws_url(const char *base_url, char *out, size_t out_len) {
+    const char *scheme;
+    const char *rest;
+    if (strncasecmp(base_url, "https://", 8) == 0) {
+        scheme = "wss://";
+        rest = base_url + 8;
+    } else if (strncasecmp(base_url, "http://", 7) == 0) {
+        scheme = "ws://";
+        rest = base_url + 7;
+    } else {
+        return false;
+    }
+    size_t len = strlen(rest);
+    while (len > 0 && rest[len - 1] == '/') {
+        len--;
+    }
+    int n = snprintf(out, out_len, "%s%.*s/api/websocket", scheme, (int)len, rest);
+    return n > 0 && n < (int)out_len;
+}
+
+static void stop_locked(void) {
+    if (s_client) {
+        esp_websocket_client_stop(s_client);
+        esp_websocket_client_destroy(s_client);
+        s_client = NULL;
+    }
+    /* Handler gone: its state may be reset from here. */
+    drop_message();
+    if (s_proto) {
+        s_proto->phase = HA_WS_IDLE;
+    }
+    s_phase = HA_WS_IDLE;
+    s_closed = false;
+    s_unpublished = 0;
+}
+
+static void start_locked(const char *base_url, const char *token,
+                         const char *const *entities, const char *const *attrs,
+                         int count, ha_data_t *data) {
+    char url[320];
+    if (!build_ws_url(base_url, url, sizeof(url))) {
+        ESP_LOGW(TAG, "Cannot derive a WebSocket URL from %s", base_url);
+        return;
+    }
+
+    if (!s_proto) {
+        s_proto = heap_caps_malloc(sizeof(ha_ws_proto_t), MALLOC_CAP_SPIRAM);
+        if (!s_proto) {
+            ESP_LOGW(TAG, "Protocol state alloc failed");
+            return;
+        }
+    }
+    ha_ws_proto_init(s_proto, token);
+    for (int i = 0; i < count; i++) {
+        ha_ws_proto_add_tile(s_proto, entities[i], attrs[i]);
+    }
+    if (ha_ws_proto_entity_count(s_proto) == 0) {
+        return;   /* nothing to subscribe to; REST publishes the empty grid */
+    }
+
+    bool tls = strncmp(url, "wss", 3) == 0;
+    esp_websocket_client_config_t cfg = {
+        .uri = url,
+        .buffer_size = 2048,
+        .network_timeout_ms = 10000,
+        .disable_auto_reconnect = true,   /* reconnects are ours, with backoff */
+        .crt_bundle_attach = tls ? esp_crt_bundle_attach : NULL,
+    };
+    s_client = esp_websocket_client_init(&cfg);
+    if (!s_client) {
+        ESP_LOGW(TAG, "Failed to init client");
+        return;
+    }
+    s_data = data;
+    s_closed = false;
+    s_unpublished = 0;
+    s_phase = HA_WS_IDLE;
+    s_started_ms = esp_timer_get_time() / 1000;
+
+    ESP_LOGI(TAG, "Subscribing to %d entities at %s",
+             ha_ws_proto_entity_count(s_proto), url);
+    esp_websocket_register_events(s_client, WEBSOCKET_EVENT_ANY, ha_ws_event_handler, NULL);
+    esp_websocket_client_start(s_client);
+}
+
+bool ha_ws_client_service(const char *base_url, const char *token,
+                          const char *const *entities, const char *const *attrs,
+                          int count, uint64_t config_hash, ha_data_t *data) {
+    if (!s_life_mutex || !base_url || !data) {
+        return false;
+    }
+    xSemaphoreTake(s_life_mutex, portMAX_DELAY);
+
+    int64_t now_ms = esp_timer_get_time() / 1000;
+    bool live = false;
+
+    if (config_hash != s_config_hash) {
+        /* New base, token or tiles: resubscribe right away. */
+        stop_locked();
+        s_config_hash = config_hash;
+        s_backoff_ms = HA_WS_BACKOFF_INITIAL_MS;
+        s_retry_at_ms = 0;
+    }
+
+    if (s_client) {
+        int phase = s_phase;
+        if (phase == HA_WS_LIVE && !s_closed) {
+            s_backoff_ms = HA_WS_BACKOFF_INITIAL_MS;
+            live = (s_unpublished == 0);
+        } else if (s_closed || phase == HA_WS_FAILED || phase == HA_WS_AUTH_FAILED ||
+                   now_ms - s_started_ms > HA_WS_SETUP_TIMEOUT_MS) {
+            const char *why = phase == HA_WS_AUTH_FAILED ? "auth rejected"
+                            : phase == HA_WS_FAILED     ? "failed"
+                            : s_closed                  ? "disconnected"
+                            :                             "setup timeout";
+            /* A rejected token will not fix itself: wait the longest. */
+            int wait_ms = phase == HA_WS_AUTH_FAILED ? HA_WS_BACKOFF_MAX_MS : s_backoff_ms;
+            ESP_LOGW(TAG, "Subscription down (%s); polling REST, retry in %d s",
+                     why, wait_ms / 1000);
+            s_retry_at_ms = now_ms + wait_ms;
+            s_backoff_ms *= 2;
+            if (s_backoff_ms > HA_WS_BACKOFF_MAX_MS) {
+                s_backoff_ms = HA_WS_BACKOFF_MAX_MS;
+            }
+            stop_locked();
+        }
+    } else if (now_ms >= s_retry_at_ms) {
+        start_locked(base_url, token, entities, attrs, count, data);
+        if (!s_client) {
+            s_retry_at_ms = now_ms + HA_WS_BACKOFF_MAX_MS;
+        }
+    }
+
+    xSemaphoreGive(s_life_mutex);
+    return live;
+}
+
+void ha_ws_client_stop(void) {
+    if (!s_life_mutex) {
+        return;
+    }
+    xSemaphoreTake(s_life_mutex, portMAX_DELAY);
+    stop_locked();
+    s_config_hash = 0;   /* next service() starts afresh */
+    s_retry_at_ms = 0;
+    xSemaphoreGive(s_life_mutex);
+}
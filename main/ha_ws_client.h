@@ -0,0 +1,40 @@
+#pragma once
+
+/**
+ * @file ha_ws_client.h
+ * @brief Home Assistant WebSocket subscription for the HA page.
+ *
+ * One connection to {base}/api/websocket (ws:// or wss:// after the base
+ * URL's scheme) that authenticates with the long-lived token and subscribes
+ * to the tile entities with subscribe_entities. HA then pushes state deltas;
+ * ha_ws_proto.c resolves them per tile and only tiles whose value actually
+ * changed are published into ha_data_t, waking the data task only then (and
+ * only while the HA page is shown).
+ *
+ * Owned by the ha poll job: ha_client_poll() calls ha_ws_client_service() each
+ * cycle and skips its REST fetches while the subscription is live. Whenever it
+ * is not -- connecting, refused, auth rejected, dropped -- REST polling is the
+ * fallback, and the socket is retried with exponential backoff.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "ha_client.h"
+
+/** Create the lifecycle mutex. Called once from ha_client_init(). */
+void ha_ws_client_init(void);
+
+/**
+ * Keep the subscription running for this configuration: (re)start it when
+ * @p config_hash differs from the running one, after a failure once the
+ * backoff has elapsed, or when it never came up. @p entities / @p attrs are
+ * the @p count row-major tiles (NULL entity = unresolved tile, NULL attr =
+ * state); they are copied. Returns true while the subscription is live and
+ * everything it pushed is published, i.e. the caller may skip REST.
+ */
+bool ha_ws_client_service(const char *base_url, const char *token,
+                          const char *const *entities, const char *const *attrs,
+                          int count, uint64_t config_hash, ha_data_t *data);
+
+/** Close the subscription (e.g. HA page disabled). Safe from any task. */
+void ha_ws_client_stop(void);
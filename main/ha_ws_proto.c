@@ -0,0 +1,331 @@
+/**
+ * @file ha_ws_proto.c
+ * @brief Home Assistant WebSocket API protocol (see ha_ws_proto.h).
+ */
+
+#include "ha_ws_proto.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>   /* strcasecmp */
+
+// =============================================================================
+// Tile values
+// =============================================================================
+
+bool ha_ws_value_str(const cJSON *node, char *out, size_t len) {
+    if (!out || len == 0) {
+        return false;
+    }
+    out[0] = '\0';
+    if (!node) {
+        return false;
+    }
+
+    if (cJSON_IsString(node)) {
+        snprintf(out, len, "%s", node->valuestring ? node->valuestring : "");
+    } else if (cJSON_IsNumber(node)) {
+        double val = node->valuedouble;
+        if (val == (double)(int)val) {
+            snprintf(out, len, "%d", (int)val);
+        } else {
+            snprintf(out, len, "%.2f", val);
+        }
+    } else if (cJSON_IsBool(node)) {
+        snprintf(out, len, "%s", cJSON_IsTrue(node) ? "true" : "false");
+    } else {
+        return false;
+    }
+
+    if (strcasecmp(out, "unavailable") == 0 || strcasecmp(out, "unknown") == 0) {
+        out[0] = '\0';
+        return false;
+    }
+    return true;
+}
+
+/* Resolve tile @p i from @p node (NULL = unresolved); flag it in *changed if
+ * the value or resolved state differs from what it held. */
+static void set_tile(ha_ws_proto_t *p, int i, const cJSON *node, uint32_t *changed) {
+    char v[HA_WS_VALUE_LEN];
+    bool ok = ha_ws_value_str(node, v, sizeof(v));
+    if (ok != p->resolved[i] || strcmp(v, p->values[i]) != 0) {
+        memcpy(p->values[i], v, sizeof(v));
+        p->resolved[i] = ok;
+        *changed |= 1u << i;
+    }
+}
+
+static uint32_t all_tiles(const ha_ws_proto_t *p) {
+    return p->tile_count > 0 ? (1u << p->tile_count) - 1u : 0;
+}
+
+// =============================================================================
+// Setup
+// =============================================================================
+
+void ha_ws_proto_init(ha_ws_proto_t *p, const char *token) {
+    memset(p, 0, sizeof(*p));
+    if (token) {
+        snprintf(p->token, sizeof(p->token), "%s", token);
+    }
+}
+
+bool ha_ws_proto_add_tile(ha_ws_proto_t *p, const char *entity, const char *attr) {
+    if (p->tile_count >= HA_WS_MAX_TILES) {
+        return false;
+    }
+    int i = p->tile_count++;
+    p->entity[i][0] = '\0';
+    p->attr[i][0] = '\0';
+    p->values[i][0] = '\0';
+    p->resolved[i] = false;
+
+    if (entity && strlen(entity) < HA_WS_ENTITY_ID_LEN) {
+        strcpy(p->entity[i], entity);
+    }
+    if (attr && attr[0] != '\0' && strcasecmp(attr, "state") != 0) {
+        if (strlen(attr) < HA_WS_ATTR_LEN) {
+            strcpy(p->attr[i], attr);
+        } else {
+            p->entity[i][0] = '\0';   /* cannot match the attribute: never resolves */
+        }
+    }
+    return true;
+}
+
+/* True if tile @p i is the first tile naming its entity. */
+static bool first_of_entity(const ha_ws_proto_t *p, int i) {
+    if (p->entity[i][0] == '\0') {
+        return false;
+    }
+    for (int j = 0; j < i; j++) {
+        if (strcmp(p->entity[j], p->entity[i]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int ha_ws_proto_entity_count(const ha_ws_proto_t *p) {
+    int n = 0;
+    for (int i = 0; i < p->tile_count; i++) {
+        if (first_of_entity(p, i)) {
+            n++;
+        }
+    }
+    return n;
+}
+
+void ha_ws_proto_begin(ha_ws_proto_t *p) {
+    p->phase = HA_WS_AUTH;
+    for (int i = 0; i < p->tile_count; i++) {
+        p->values[i][0] = '\0';
+        p->resolved[i] = false;
+    }
+}
+
+// =============================================================================
+// Replies
+// =============================================================================
+
+/* Print @p msg into p->out as the pending reply; consumes @p msg. */
+static bool set_reply(ha_ws_proto_t *p, cJSON *msg, ha_ws_result_t *res) {
+    bool ok = msg && cJSON_PrintPreallocated(msg, p->out, (int)sizeof(p->out), false);
+    cJSON_Delete(msg);
+    if (!ok) {
+        return false;
+    }
+    res->reply = p->out;
+    res->reply_len = strlen(p->out);
+    return true;
+}
+
+static bool reply_auth(ha_ws_proto_t *p, ha_ws_result_t *res) {
+    cJSON *msg = cJSON_CreateObject();
+    if (msg) {
+        cJSON_AddStringToObject(msg, "type", "auth");
+        cJSON_AddStringToObject(msg, "access_token", p->token);
+    }
+    return set_reply(p, msg, res);
+}
+
+static bool reply_subscribe(ha_ws_proto_t *p, ha_ws_result_t *res) {
+    cJSON *msg = cJSON_CreateObject();
+    if (msg) {
+        cJSON_AddNumberToObject(msg, "id", HA_WS_SUBSCRIBE_ID);
+        cJSON_AddStringToObject(msg, "type", "subscribe_entities");
+    }
+    cJSON *ids = msg ? cJSON_AddArrayToObject(msg, "entity_ids") : NULL;
+    if (!ids) {
+        cJSON_Delete(msg);
+        return false;
+    }
+    for (int i = 0; i < p->tile_count; i++) {
+        if (first_of_entity(p, i)) {
+            cJSON_AddItemToArray(ids, cJSON_CreateString(p->entity[i]));
+        }
+    }
+    return set_reply(p, msg, res);
+}
+
+// =============================================================================
+// State events
+// =============================================================================
+
+/* "a": the full state of an entity replaces every tile that reads it. */
+static void apply_added(ha_ws_proto_t *p, const cJSON *ent, uint32_t *changed) {
+    const cJSON *attrs = cJSON_GetObjectItemCaseSensitive(ent, "a");
+    for (int i = 0; i < p->tile_count; i++) {
+        if (strcmp(p->entity[i], ent->string) != 0) {
+            continue;
+        }
+        const cJSON *node = p->attr[i][0] == '\0'
+            ? cJSON_GetObjectItemCaseSensitive(ent, "s")
+            : (cJSON_IsObject(attrs) ? cJSON_GetObjectItemCaseSensitive(attrs, p->attr[i]) : NULL);
+        set_tile(p, i, node, changed);
+    }
+}
+
+static bool name_listed(const cJSON *list, const char *name) {
+    const cJSON *item = NULL;
+    cJSON_ArrayForEach(item, list) {
+        if (cJSON_IsString(item) && strcmp(item->valuestring, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* "c": only the tiles whose state / attribute is in the diff are touched. */
+static void apply_changed(ha_ws_proto_t *p, const cJSON *ent, uint32_t *changed) {
+    const cJSON *plus  = cJSON_GetObjectItemCaseSensitive(ent, "+");
+    const cJSON *minus = cJSON_GetObjectItemCaseSensitive(ent, "-");
+    const cJSON *plus_attrs  = cJSON_GetObjectItemCaseSensitive(plus, "a");
+    const cJSON *minus_attrs = cJSON_GetObjectItemCaseSensitive(minus, "a");
+
+    for (int i = 0; i < p->tile_count; i++) {
+        if (strcmp(p->entity[i], ent->string) != 0) {
+            continue;
+        }
+        if (p->attr[i][0] == '\0') {
+            const cJSON *s = cJSON_GetObjectItemCaseSensitive(plus, "s");
+            if (s) {
+                set_tile(p, i, s, changed);
+            }
+            continue;
+        }
+        const cJSON *a = cJSON_IsObject(plus_attrs)
+            ? cJSON_GetObjectItemCaseSensitive(plus_attrs, p->attr[i]) : NULL;
+        if (a) {
+            set_tile(p, i, a, changed);
+        } else if (cJSON_IsArray(minus_attrs) && name_listed(minus_attrs, p->attr[i])) {
+            set_tile(p, i, NULL, changed);
+        }
+    }
+}
+
+static void apply_event(ha_ws_proto_t *p, const cJSON *event, uint32_t *changed) {
+    const cJSON *added   = cJSON_GetObjectItemCaseSensitive(event, "a");
+    const cJSON *diffs   = cJSON_GetObjectItemCaseSensitive(event, "c");
+    const cJSON *removed = cJSON_GetObjectItemCaseSensitive(event, "r");
+    const cJSON *ent = NULL;
+
+    if (cJSON_IsObject(added)) {
+        cJSON_ArrayForEach(ent, added) {
+            apply_added(p, ent, changed);
+        }
+    }
+    if (cJSON_IsObject(diffs)) {
+        cJSON_ArrayForEach(ent, diffs) {
+            apply_changed(p, ent, changed);
+        }
+    }
+    if (cJSON_IsArray(removed)) {
+        cJSON_ArrayForEach(ent, removed) {
+            if (!cJSON_IsString(ent)) {
+                continue;
+            }
+            for (int i = 0; i < p->tile_count; i++) {
+                if (strcmp(p->entity[i], ent->valuestring) == 0) {
+                    set_tile(p, i, NULL, changed);
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// Messages
+// =============================================================================
+
+static void go_live(ha_ws_proto_t *p, ha_ws_result_t *res) {
+    p->phase = HA_WS_LIVE;
+    res->changed = all_tiles(p);
+}
+
+static void handle_one(ha_ws_proto_t *p, const cJSON *msg, ha_ws_result_t *res) {
+    const cJSON *type_item = cJSON_GetObjectItemCaseSensitive(msg, "type");
+    const char *type = cJSON_IsString(type_item) ? type_item->valuestring : "";
+    const cJSON *id_item = cJSON_GetObjectItemCaseSensitive(msg, "id");
+    bool ours = cJSON_IsNumber(id_item) && id_item->valueint == HA_WS_SUBSCRIBE_ID;
+
+    if (strcmp(type, "auth_required") == 0) {
+        if (p->phase == HA_WS_AUTH && !reply_auth(p, res)) {
+            p->phase = HA_WS_FAILED;
+        }
+    } else if (strcmp(type, "auth_ok") == 0) {
+        if (p->phase != HA_WS_AUTH) {
+            return;
+        }
+        if (ha_ws_proto_entity_count(p) == 0) {
+            /* Nothing to subscribe to -- an empty entity_ids would mean "all". */
+            go_live(p, res);
+        } else if (reply_subscribe(p, res)) {
+            p->phase = HA_WS_SUBSCRIBING;
+        } else {
+            p->phase = HA_WS_FAILED;
+        }
+    } else if (strcmp(type, "auth_invalid") == 0) {
+        p->phase = HA_WS_AUTH_FAILED;
+    } else if (strcmp(type, "result") == 0) {
+        /* success:false for our id: subscribe_entities unsupported (HA < 2022.4)
+         * or refused -- the caller falls back to REST polling. */
+        if (ours && !cJSON_IsTrue(cJSON_GetObjectItemCaseSensitive(msg, "success"))) {
+            p->phase = HA_WS_FAILED;
+        }
+    } else if (strcmp(type, "event") == 0) {
+        if (!ours || (p->phase != HA_WS_SUBSCRIBING && p->phase != HA_WS_LIVE)) {
+            return;
+        }
+        apply_event(p, cJSON_GetObjectItemCaseSensitive(msg, "event"), &res->changed);
+        if (p->phase == HA_WS_SUBSCRIBING) {
+            /* The first event carries the initial "a" states. */
+            go_live(p, res);
+        }
+    }
+}
+
+ha_ws_result_t ha_ws_proto_handle(ha_ws_proto_t *p, const char *msg, size_t len) {
+    ha_ws_result_t res = { 0 };
+    if (p->phase == HA_WS_IDLE || p->phase == HA_WS_AUTH_FAILED || p->phase == HA_WS_FAILED) {
+        return res;
+    }
+
+    cJSON *root = cJSON_ParseWithLength(msg, len);
+    if (!root) {
+        /* A lost delta would leave tiles silently stale: fail the session. */
+        p->phase = HA_WS_FAILED;
+        return res;
+    }
+    if (cJSON_IsArray(root)) {
+        const cJSON *item = NULL;
+        cJSON_ArrayForEach(item, root) {
+            handle_one(p, item, &res);
+        }
+    } else {
+        handle_one(p, root, &res);
+    }
+    cJSON_Delete(root);
+    return res;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+/**
+ * @file ha_ws_proto.h
+ * @brief Home Assistant WebSocket API protocol for the HA page.
+ *
+ * Drives one /api/websocket session from the text messages Home Assistant
+ * sends: answer auth_required with the long-lived token, subscribe to the
+ * tile entities with subscribe_entities once auth_ok arrives, then apply the
+ * compressed state events that subscription pushes:
+ *
+ *   {"a": {entity_id: {"s": state, "a": {attributes}, ...}}}     full state
+ *   {"c": {entity_id: {"+": {"s": ..., "a": {...}},              delta
+ *                      "-": {"a": [removed attribute names]}}}}
+ *   {"r": [entity_id, ...]}                                       removed
+ *
+ * Each tile (entity_id, attr) keeps its resolved value here with the same
+ * rules as the REST poll (ha_ws_value_str); ha_ws_proto_handle() reports
+ * which tiles actually changed so the caller only publishes -- and only wakes
+ * the UI -- for those. The socket itself lives in ha_ws_client.c.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cJSON.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HA_WS_MAX_TILES      15     /**< == JSON_MAX_TILES */
+#define HA_WS_VALUE_LEN      48     /**< == JSON_TILE_VALUE_LEN */
+#define HA_WS_ENTITY_ID_LEN  128
+#define HA_WS_ATTR_LEN       64
+#define HA_WS_TOKEN_LEN      256
+#define HA_WS_OUT_MAX        2560   /**< subscribe_entities with HA_WS_MAX_TILES ids */
+#define HA_WS_SUBSCRIBE_ID   1
+
+typedef enum {
+    HA_WS_IDLE = 0,       /**< no session */
+    HA_WS_AUTH,           /**< socket open, auth_required / auth_ok pending */
+    HA_WS_SUBSCRIBING,    /**< subscribe_entities sent, initial states pending */
+    HA_WS_LIVE,           /**< initial states applied; deltas are being pushed */
+    HA_WS_AUTH_FAILED,    /**< auth_invalid: the token was rejected */
+    HA_WS_FAILED,         /**< subscription refused or unexpected message */
+} ha_ws_phase_t;
+
+typedef struct {
+    ha_ws_phase_t phase;
+    int  tile_count;
+    char entity[HA_WS_MAX_TILES][HA_WS_ENTITY_ID_LEN];  /**< "" = tile stays unresolved */
+    char attr[HA_WS_MAX_TILES][HA_WS_ATTR_LEN];         /**< "" = top-level state */
+    char values[HA_WS_MAX_TILES][HA_WS_VALUE_LEN];      /**< "" when unresolved */
+    bool resolved[HA_WS_MAX_TILES];
+    char token[HA_WS_TOKEN_LEN];
+    char out[HA_WS_OUT_MAX];                            /**< pending reply */
+} ha_ws_proto_t;
+
+typedef struct {
+    uint32_t    changed;     /**< bit i set: tile i's value or resolved flag changed */
+    const char *reply;       /**< message to send back (points into the proto), or NULL */
+    size_t      reply_len;
+} ha_ws_result_t;
+
+/** Clear @p p, keeping @p token (may be NULL) for the auth reply. No tiles. */
+void ha_ws_proto_init(ha_ws_proto_t *p, const char *token);
+
+/**
+ * Append a tile. @p entity NULL/"" (or one that does not fit) makes a tile
+ * that never resolves; @p attr NULL/""/"state" reads the top-level state.
+ * Returns false when HA_WS_MAX_TILES are already added.
+ */
+bool ha_ws_proto_add_tile(ha_ws_proto_t *p, const char *entity, const char *attr);
+
+/** Number of distinct tile entities (what subscribe_entities asks for). */
+int ha_ws_proto_entity_count(const ha_ws_proto_t *p);
+
+/**
+ * Start a new session on a freshly opened socket: phase HA_WS_AUTH, every
+ * tile unresolved. Tiles and token are kept.
+ */
+void ha_ws_proto_begin(ha_ws_proto_t *p);
+
+/**
+ * Handle one complete text message (a single message object, or an array of
+ * them). Advances the phase, applies state events, and returns the tiles that
+ * changed plus any reply to send. Entering HA_WS_LIVE reports every tile as
+ * changed so the caller publishes a full snapshot once.
+ */
+ha_ws_result_t ha_ws_proto_handle(ha_ws_proto_t *p, const char *msg, size_t len);
+
+/**
+ * Render a Home Assistant scalar (string / number / bool) into @p out the way
+ * tiles display it. Returns false (out = "") for a missing or non-scalar node
+ * and for "unavailable" / "unknown" (case-insensitive). Shared with the REST
+ * path in ha_client.c so both resolve tiles identically.
+ */
+bool ha_ws_value_str(const cJSON *node, char *out, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
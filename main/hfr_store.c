@@ -0,0 +1,70 @@
+/*
+ * hfr_store.c - Pure, host-testable per-instance HFR/star history store.
+ *
+ * See hfr_store.h for the sync contract.
+ */
+
+#include "hfr_store.h"
+
+void hfr_store_clear(hfr_store_t *s) {
+    s->count = 0;
+    s->write_idx = 0;
+    s->synced_count = 0;
+    s->synced = false;
+}
+
+void hfr_store_invalidate(hfr_store_t *s) {
+    s->synced = false;
+}
+
+void hfr_store_push(hfr_store_t *s, float hfr, int stars) {
+    if (!s->hfr || !s->stars || !(hfr > 0)) return;
+    int idx = s->write_idx;
+    s->hfr[idx]   = hfr;
+    s->stars[idx] = stars;
+    s->write_idx  = (idx + 1) % HFR_RING_SIZE;
+    s->count++;
+}
+
+void hfr_store_note_image(hfr_store_t *s, float hfr, int stars) {
+    s->synced_count++;
+    hfr_store_push(s, hfr, stars);
+}
+
+void hfr_store_load_newest_first(hfr_store_t *s, const float *hfr, const int *stars,
+                                 int n, int image_total) {
+    hfr_store_clear(s);
+    if (n > HFR_RING_SIZE) n = HFR_RING_SIZE;
+    for (int i = n - 1; i >= 0; i--) {
+        hfr_store_push(s, hfr[i], stars[i]);
+    }
+    s->synced_count = image_total;
+    s->synced = true;
+}
+
+int hfr_store_plan_sync(const hfr_store_t *s, int api_count) {
+    if (!s->synced || api_count < s->synced_count) return HFR_STORE_SYNC_FULL;
+    int fresh = api_count - s->synced_count;
+    if (fresh == 0) return HFR_STORE_SYNC_NONE;
+    return fresh <= HFR_STORE_INCREMENTAL_MAX ? fresh : HFR_STORE_SYNC_FULL;
+}
+
+int hfr_store_build(const hfr_store_t *s, float *hfr_out, int *stars_out, int max_points) {
+    if (!s->hfr || !s->stars || s->count <= 0 || max_points <= 0) return 0;
+
+    /* Number of valid entries in the ring */
+    int available = (s->count < HFR_RING_SIZE) ? s->count : HFR_RING_SIZE;
+    int use = (available < max_points) ? available : max_points;
+
+    /* Read oldest-first: start 'use' entries back from the newest. Before
+     * the ring wraps the oldest sample is at 0, afterwards at write_idx. */
+    int oldest = (s->count < HFR_RING_SIZE) ? 0 : s->write_idx;
+    int read_start = (oldest + (available - use)) % HFR_RING_SIZE;
+
+    for (int i = 0; i < use; i++) {
+        int ring_idx = (read_start + i) % HFR_RING_SIZE;
+        hfr_out[i]   = s->hfr[ring_idx];
+        stars_out[i] = s->stars[ring_idx];
+    }
+    return use;
+}
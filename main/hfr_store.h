@@ -0,0 +1,85 @@
+/*
+ * hfr_store.h - Pure, host-testable per-instance HFR/star history store.
+ *
+ * Fixed-capacity ring of (HFR, stars) samples for one NINA instance's LIGHT
+ * frames, plus the bookkeeping needed to keep it in step with NINA's
+ * /image-history without re-downloading it: synced_count is the number of
+ * LIGHT images (with or without HFR) the store has accounted for, so a
+ * later ?count=true reply says exactly how many images are new.
+ *
+ * Feeders:
+ *   - one full /image-history?all=true&imageType=LIGHT sync per connection
+ *     (hfr_store_load_newest_first),
+ *   - IMAGE-SAVE WebSocket events (hfr_store_note_image),
+ *   - small ?index=N catch-ups when the WebSocket is down
+ *     (hfr_store_plan_sync + hfr_store_note_image).
+ *
+ * The caller owns locking and the sample buffers (PSRAM on target).
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef HFR_STORE_H
+#define HFR_STORE_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HFR_RING_SIZE 500  // Matches GRAPH_MAX_POINTS for HFR graph overlay
+
+/* Largest gap closed with per-index requests; beyond this one full sync is
+ * cheaper than N round trips. */
+#define HFR_STORE_INCREMENTAL_MAX 16
+
+/* hfr_store_plan_sync() results other than a positive image count */
+#define HFR_STORE_SYNC_NONE   0
+#define HFR_STORE_SYNC_FULL  -1
+
+typedef struct {
+    float *hfr;         // HFR values [HFR_RING_SIZE]
+    int   *stars;       // Star counts [HFR_RING_SIZE]
+    int    count;       // Total samples written (may exceed HFR_RING_SIZE)
+    int    write_idx;   // Next write position (wraps at HFR_RING_SIZE)
+    int    synced_count;// LIGHT images accounted for (incl. those without HFR)
+    bool   synced;      // Contents mirror NINA's history as of synced_count
+} hfr_store_t;
+
+/* Drop all samples and sync state (buffers are kept). */
+void hfr_store_clear(hfr_store_t *s);
+
+/* Forget sync state but keep samples: the next graph open re-syncs, while
+ * the graph keeps showing what is already known until then. */
+void hfr_store_invalidate(hfr_store_t *s);
+
+/* Append one sample; samples with hfr <= 0 (no star detection) are skipped. */
+void hfr_store_push(hfr_store_t *s, float hfr, int stars);
+
+/* Account for one new LIGHT image and append its sample if it has HFR. */
+void hfr_store_note_image(hfr_store_t *s, float hfr, int stars);
+
+/* Replace the contents from a full sync: @p hfr / @p stars hold up to
+ * HFR_RING_SIZE samples newest-first (as /image-history returns them);
+ * @p image_total is the number of LIGHT images the reply covered. Marks the
+ * store synced. */
+void hfr_store_load_newest_first(hfr_store_t *s, const float *hfr, const int *stars,
+                                 int n, int image_total);
+
+/* Decide how to catch up with NINA reporting @p api_count LIGHT images:
+ * HFR_STORE_SYNC_NONE if already current, a positive number of new images
+ * (<= HFR_STORE_INCREMENTAL_MAX) to fetch by index, or HFR_STORE_SYNC_FULL
+ * when never synced, history shrank (new session) or the gap is too big. */
+int hfr_store_plan_sync(const hfr_store_t *s, int api_count);
+
+/* Copy the most recent @p max_points samples oldest-first into the output
+ * arrays. Returns the number of samples written. */
+int hfr_store_build(const hfr_store_t *s, float *hfr_out, int *stars_out, int max_points);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HFR_STORE_H */
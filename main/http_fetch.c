@@ -5,34 +5,69 @@
 
 #include "http_fetch.h"
 #include "http_fetch_policy.h"
+#include "http_pipeline.h"
 
 #include <string.h>
 #include <strings.h>
 
 #include "esp_http_client.h"
 #include "esp_crt_bundle.h"
+#include "esp_transport.h"
+#include "esp_transport_tcp.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
+#include "perf_monitor.h"
 
 static const char *TAG = "http_fetch";
 
+/* Stack chunk for http_fetch_stream(). 512 matches esp_http_client's own
+ * default RX buffer, so each read drains at most one internal fill. */
+#define HTTP_STREAM_CHUNK_BYTES 512
+
+/* Request-text budget per pipelined GET (request line + Host + the small
+ * fixed headers), on top of the caller's extra header lines. */
+#define HTTP_BATCH_REQ_BYTES 320
+
 struct http_fetch_conn {
     esp_http_client_handle_t client; /* NULL until first successful fetch */
+    /* Raw keep-alive socket for http_fetch_batch(); esp_http_client has no
+     * pipelining, so the batch path speaks HTTP/1.1 over esp_transport. */
+    esp_transport_handle_t pipe;     /* NULL until first pipelined batch */
+    char pipe_host[128];
+    int pipe_port;
+};
+
+struct http_validator_cache {
+    SemaphoreHandle_t lock;
+    http_validator_table_t table;
+    size_t retain_body_max;          /* 0 = validators only */
 };
 
+/* Per-request context handed to the esp_http_client event handler: the
+ * caller's opts (for capture_header) plus the validators seen on the
+ * response, which only this module consumes. */
+typedef struct {
+    const http_fetch_opts_t *opts;
+    http_validators_t got;
+} fetch_req_t;
+
 /**
- * Clear the caller's capture buffer (if provided). Called before every
- * response-header fetch -- including each redirect re-open -- so that only
- * the FINAL response's header value survives; each hop re-fetches headers
- * and would otherwise leave a stale value from an intermediate response.
+ * Clear the caller's capture buffer (if provided) and the captured
+ * validators. Called before every response-header fetch -- including each
+ * redirect re-open -- so that only the FINAL response's header values
+ * survive; each hop re-fetches headers and would otherwise leave a stale
+ * value from an intermediate response.
  */
-static void capture_reset(const http_fetch_opts_t *opts) {
+static void capture_reset(fetch_req_t *req) {
+    const http_fetch_opts_t *opts = req->opts;
     if (opts->capture_header_out && opts->capture_header_out_len > 0) {
         opts->capture_header_out[0] = '\0';
     }
+    http_validators_clear(&req->got);
 }
 
 /**
@@ -41,14 +76,19 @@ static void capture_reset(const http_fetch_opts_t *opts) {
  * are only observable via HTTP_EVENT_ON_HEADER -- they are not queryable
  * after esp_http_client_fetch_headers(). evt->user_data is read from the
  * client's user_data at dispatch time, so attempt_once() can re-point it at
- * the current request's opts even though the client handle persists across
- * requests.
+ * the current request's fetch_req_t even though the client handle persists
+ * across requests.
  */
 static esp_err_t header_capture_event_cb(esp_http_client_event_t *evt) {
     if (evt->event_id != HTTP_EVENT_ON_HEADER) return ESP_OK;
 
-    const http_fetch_opts_t *opts = (const http_fetch_opts_t *)evt->user_data;
-    if (!opts || !opts->capture_header ||
+    fetch_req_t *req = (fetch_req_t *)evt->user_data;
+    if (!req) return ESP_OK;
+    const http_fetch_opts_t *opts = req->opts;
+    if (opts->validators && evt->header_key && evt->header_value) {
+        http_validators_note_header(&req->got, evt->header_key, evt->header_value);
+    }
+    if (!opts->capture_header ||
         !opts->capture_header_out || opts->capture_header_out_len == 0) {
         return ESP_OK;
     }
@@ -88,8 +128,24 @@ static esp_http_client_handle_t make_client(const char *url,
     return esp_http_client_init(&cfg);
 }
 
-/** Apply the optional headers from @p opts to @p client. */
-static void apply_headers(esp_http_client_handle_t client, const http_fetch_opts_t *opts) {
+/**
+ * Apply the optional headers from @p opts to @p client, plus the conditional
+ * headers for @p cond (NULL = unconditional). The conditional headers are
+ * deleted when not wanted: a reused keep-alive handle keeps every header a
+ * previous request set.
+ */
+static void apply_headers(esp_http_client_handle_t client, const http_fetch_opts_t *opts,
+                          const http_validators_t *cond) {
+    if (cond && cond->etag[0]) {
+        esp_http_client_set_header(client, "If-None-Match", cond->etag);
+    } else {
+        esp_http_client_delete_header(client, "If-None-Match");
+    }
+    if (cond && cond->last_modified[0]) {
+        esp_http_client_set_header(client, "If-Modified-Since", cond->last_modified);
+    } else {
+        esp_http_client_delete_header(client, "If-Modified-Since");
+    }
     if (opts->host_header) {
         /* Re-assert on every call: a reused keep-alive handle may have served
          * a different Host on a prior request, and esp_http_client_set_url()
@@ -152,11 +208,12 @@ static void apply_headers(esp_http_client_handle_t client, const http_fetch_opts
  * All three out-params may be NULL when the caller doesn't need them.
  */
 static esp_err_t open_and_follow_redirects(esp_http_client_handle_t client,
-                                            const http_fetch_opts_t *opts,
+                                            fetch_req_t *req,
                                             int *status_out, int *content_length_out,
                                             bool *opened_out, int64_t *connect_us_out,
                                             int64_t *headers_us_out) {
-    capture_reset(opts);
+    const http_fetch_opts_t *opts = req->opts;
+    capture_reset(req);
     int64_t t0 = esp_timer_get_time();
     esp_err_t err = esp_http_client_open(client, 0);
     if (connect_us_out) *connect_us_out += esp_timer_get_time() - t0;
@@ -174,7 +231,7 @@ static esp_err_t open_and_follow_redirects(esp_http_client_handle_t client,
         if (err != ESP_OK) break; /* no Location header or similar -- stop following */
 
         esp_http_client_close(client);
-        capture_reset(opts); /* only the final hop's header value may survive */
+        capture_reset(req); /* only the final hop's header values may survive */
         t0 = esp_timer_get_time();
         err = esp_http_client_open(client, 0);
         if (connect_us_out) *connect_us_out += esp_timer_get_time() - t0;
@@ -196,7 +253,7 @@ static esp_err_t open_and_follow_redirects(esp_http_client_handle_t client,
 static void finish_client(esp_http_client_handle_t client, http_fetch_conn_t *conn) {
     if (conn) {
         /* Detach the capture context before parking the handle: it points at
-         * this request's opts (stack of http_fetch_text) and would dangle. */
+         * this request's fetch_req_t (stack of attempt_once) and would dangle. */
         esp_http_client_set_user_data(client, NULL);
         esp_http_client_close(client);
         conn->client = client;
@@ -205,13 +262,177 @@ static void finish_client(esp_http_client_handle_t client, http_fetch_conn_t *co
     }
 }
 
+/**
+ * Streaming body reader for http_fetch_stream(): hands each socket read to
+ * @p sink as it arrives instead of accumulating into a PSRAM buffer. The
+ * chunk buffer is a small stack array; max_response_bytes still bounds the
+ * total (same "includes the NUL" accounting as the buffered path, so both
+ * entry points accept exactly the same bodies). A sink abort is treated as
+ * non-retryable (the consumer rejected the content, not the transport).
+ */
+static esp_err_t stream_body(esp_http_client_handle_t client, const char *url,
+                              const http_fetch_opts_t *opts, const http_fetch_sink_t *sink,
+                              int content_length, size_t *out_len, bool *retryable,
+                              http_fetch_attempt_info_t *info) {
+    char chunk[HTTP_STREAM_CHUNK_BYTES];
+    size_t cap = opts->max_response_bytes;
+    size_t total = 0;
+    esp_err_t err = ESP_OK;
+
+    if (sink->on_begin) sink->on_begin(sink->sink_ctx);
+
+    int64_t body_start_us = esp_timer_get_time();
+    for (;;) {
+        int n = esp_http_client_read(client, chunk, sizeof(chunk));
+        if (n <= 0) break;
+        total += (size_t)n;
+        if (total + 1 > cap) {
+            ESP_LOGW(TAG, "Streamed response exceeds cap (%u bytes) for %s",
+                     (unsigned)cap, url);
+            *retryable = false;
+            err = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        if (!sink->on_data(chunk, (size_t)n, sink->sink_ctx)) {
+            *retryable = false;
+            err = ESP_FAIL;
+            break;
+        }
+    }
+    info->body_us = esp_timer_get_time() - body_start_us;
+
+    if (err == ESP_OK && content_length > 0 && total < (size_t)content_length) {
+        ESP_LOGW(TAG, "Partial HTTP read: %u/%d bytes for %s",
+                 (unsigned)total, content_length, url);
+        return ESP_FAIL; /* retryable stays true; on_begin re-arms the sink */
+    }
+    if (err == ESP_OK) *out_len = total;
+    return err;
+}
+
+/* ── Conditional GET (validator cache) ─────────────────────────────── */
+
+/* 304 accounting: hit count plus KB of bodies not re-sent (the sub-KB
+ * remainder carries over so small JSON bodies still add up). */
+static void note_cond_hit(size_t body_len) {
+    static uint32_t s_saved_rem;
+    perf_counter_increment(&g_perf.http_cond_hit_count);
+    s_saved_rem += (uint32_t)body_len;
+    if (s_saved_rem >= 1024) {
+        perf_counter_add(&g_perf.http_cond_saved_kb, s_saved_rem / 1024);
+        s_saved_rem %= 1024;
+    }
+}
+
+static void validator_drop_locked(http_validator_entry_t *e) {
+    if (e->body) {
+        heap_caps_free(e->body);
+        e->body = NULL;
+    }
+    http_validator_release(e);
+}
+
+/**
+ * Copy the validators to send for @p url into *cond. A body-retaining cache
+ * only revalidates URLs whose body it can replay, so a 304 always yields
+ * what the caller asked for.
+ */
+static bool validator_prepare(http_validator_cache_t *cache, const char *url,
+                              http_validators_t *cond) {
+    if (!cache) return false;
+    bool ok = false;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    http_validator_entry_t *e = http_validator_find(&cache->table, url);
+    if (e && (cache->retain_body_max == 0 || e->body)) {
+        *cond = e->v;
+        ok = true;
+    }
+    xSemaphoreGive(cache->lock);
+    return ok;
+}
+
+/**
+ * Record a full 2xx response: keep its validators (and, for a retaining
+ * cache, a copy of @p body when it fits), or forget the URL when the server
+ * sent none.
+ */
+static void validator_store(http_validator_cache_t *cache, const char *url,
+                            const http_validators_t *got, const char *body, size_t len) {
+    if (!cache) return;
+    perf_counter_increment(&g_perf.http_cond_miss_count);
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    http_validator_entry_t *e;
+    if (!http_validators_present(got)) {
+        e = http_validator_find(&cache->table, url);
+        if (e) validator_drop_locked(e);
+    } else if ((e = http_validator_claim(&cache->table, url, NULL)) != NULL) {
+        e->v = *got;
+        e->body_len = (uint32_t)len;
+        void *old = e->body;
+        e->body = NULL;
+        if (body && cache->retain_body_max > 0 && len <= cache->retain_body_max) {
+            /* realloc: a same-sized poll body usually reuses the block */
+            char *nb = heap_caps_realloc(old, len ? len : 1, MALLOC_CAP_SPIRAM);
+            if (nb) {
+                memcpy(nb, body, len);
+                e->body = nb;
+                old = NULL;
+            }
+        }
+        if (old) heap_caps_free(old);
+        if (cache->retain_body_max > 0 && !e->body) validator_drop_locked(e);
+    }
+    xSemaphoreGive(cache->lock);
+}
+
+/**
+ * Answer a 304: count it, then replay the retained body (to @p sink, or as a
+ * fresh PSRAM copy in *out_body) if there is one. Returns
+ * HTTP_FETCH_NOT_MODIFIED for a validators-only cache, and
+ * ESP_ERR_INVALID_STATE if a retaining cache lost the entry meanwhile.
+ */
+static esp_err_t validator_replay(http_validator_cache_t *cache, const char *url,
+                                  const http_fetch_sink_t *sink,
+                                  char **out_body, size_t *out_len) {
+    esp_err_t err = HTTP_FETCH_NOT_MODIFIED;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    http_validator_entry_t *e = http_validator_find(&cache->table, url);
+    if (e) note_cond_hit(e->body_len);
+    if (e && e->body) {
+        size_t len = e->body_len;
+        if (sink) {
+            if (sink->on_begin) sink->on_begin(sink->sink_ctx);
+            err = sink->on_data(e->body, len, sink->sink_ctx) ? ESP_OK : ESP_FAIL;
+            if (err == ESP_OK) *out_len = len;
+        } else {
+            char *copy = heap_caps_malloc(len + 1, MALLOC_CAP_SPIRAM);
+            if (copy) {
+                memcpy(copy, e->body, len);
+                copy[len] = '\0';
+                *out_body = copy;
+                *out_len = len;
+                err = ESP_OK;
+            } else {
+                err = ESP_ERR_NO_MEM;
+            }
+        }
+    } else if (cache->retain_body_max > 0) {
+        ESP_LOGW(TAG, "304 for %s but no retained body", url);
+        err = ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreGive(cache->lock);
+    return err;
+}
+
 /**
  * Perform a single fetch attempt (no retry-loop delay here -- that lives in
- * http_fetch_text()). Sets *retryable to tell the caller whether another
+ * fetch_with_retry()). Sets *retryable to tell the caller whether another
  * attempt is worth trying on failure. @p info accumulates per-phase timing /
  * status for opts->on_attempt; caller pre-zeroes it and sets attempt_index.
+ * With a non-NULL @p sink the body is streamed to it and *out_body is unused.
  */
 static esp_err_t attempt_once(const char *url, const http_fetch_opts_t *opts,
+                               const http_fetch_sink_t *sink,
                                char **out_body, size_t *out_len, bool *retryable,
                                http_fetch_attempt_info_t *info) {
     *retryable = true;
@@ -226,14 +447,16 @@ static esp_err_t attempt_once(const char *url, const http_fetch_opts_t *opts,
         client = make_client(url, opts, conn != NULL);
         if (!client) return ESP_ERR_NO_MEM;
     }
-    apply_headers(client, opts);
-    /* Point the header-capture event handler at this request's opts (const
-     * cast: the handler only writes through opts->capture_header_out). */
-    esp_http_client_set_user_data(client, (void *)opts);
+    fetch_req_t req = { .opts = opts };
+    http_validators_t cond;
+    bool conditional = validator_prepare(opts->validators, url, &cond);
+    apply_headers(client, opts, conditional ? &cond : NULL);
+    /* Point the header-capture event handler at this request's context */
+    esp_http_client_set_user_data(client, &req);
 
     int status = 0;
     int content_length = 0;
-    esp_err_t err = open_and_follow_redirects(client, opts, &status, &content_length,
+    esp_err_t err = open_and_follow_redirects(client, &req, &status, &content_length,
                                                &info->ever_connected, &info->connect_us,
                                                &info->headers_us);
 
@@ -247,9 +470,9 @@ static esp_err_t attempt_once(const char *url, const http_fetch_opts_t *opts,
 
         client = make_client(url, opts, true);
         if (!client) return ESP_ERR_NO_MEM;
-        apply_headers(client, opts);
-        esp_http_client_set_user_data(client, (void *)opts);
-        err = open_and_follow_redirects(client, opts, &status, &content_length,
+        apply_headers(client, opts, conditional ? &cond : NULL);
+        esp_http_client_set_user_data(client, &req);
+        err = open_and_follow_redirects(client, &req, &status, &content_length,
                                          &info->ever_connected, &info->connect_us,
                                          &info->headers_us);
     }
@@ -262,6 +485,18 @@ static esp_err_t attempt_once(const char *url, const http_fetch_opts_t *opts,
         return err;
     }
 
+    if (status == 304 && conditional) {
+        finish_client(client, conn);
+        info->ok = true;
+        err = validator_replay(opts->validators, url, sink, out_body, out_len);
+        /* Entry lost since the request went out: retry unconditionally */
+        *retryable = (err == ESP_ERR_INVALID_STATE);
+        if (opts->not_modified_out && err != ESP_ERR_INVALID_STATE) {
+            *opts->not_modified_out = true;
+        }
+        return err;
+    }
+
     if (status < 200 || status >= 300) {
         ESP_LOGW(TAG, "HTTP %d for %s", status, url);
         finish_client(client, conn);
@@ -279,6 +514,17 @@ static esp_err_t attempt_once(const char *url, const http_fetch_opts_t *opts,
         return ESP_ERR_INVALID_SIZE;
     }
 
+    if (sink) {
+        err = stream_body(client, url, opts, sink, content_length, out_len,
+                          retryable, info);
+        finish_client(client, conn);
+        if (err == ESP_OK) {
+            info->ok = true;
+            validator_store(opts->validators, url, &req.got, NULL, *out_len);
+        }
+        return err;
+    }
+
     size_t bufsize = http_buf_initial(content_length, cap);
     if (bufsize == 0) {
         finish_client(client, conn);
@@ -335,21 +581,24 @@ static esp_err_t attempt_once(const char *url, const http_fetch_opts_t *opts,
 
     if (truncated) {
         ESP_LOGW(TAG, "Response truncated at cap (%u bytes) for %s", (unsigned)cap, url);
+        http_validators_clear(&req.got);  /* never revalidate a partial body */
     }
 
     finish_client(client, conn);
+    validator_store(opts->validators, url, &req.got, buf, total);
     *out_body = buf;
     *out_len = total;
     info->ok = true;
     return ESP_OK;
 }
 
-esp_err_t http_fetch_text(const char *url, const http_fetch_opts_t *opts_in,
-                           char **out_body, size_t *out_len) {
-    if (!url || !out_body || !out_len) return ESP_ERR_INVALID_ARG;
-
+/** Shared retry loop behind http_fetch_text() and http_fetch_stream(). */
+static esp_err_t fetch_with_retry(const char *url, const http_fetch_opts_t *opts_in,
+                                   const http_fetch_sink_t *sink,
+                                   char **out_body, size_t *out_len) {
     http_fetch_opts_t opts = opts_in ? *opts_in : (http_fetch_opts_t){0};
     normalize_opts(&opts);
+    if (opts.not_modified_out) *opts.not_modified_out = false;
 
     esp_err_t last_err = ESP_FAIL;
     for (int attempt = 0; attempt < opts.max_attempts; attempt++) {
@@ -359,10 +608,10 @@ esp_err_t http_fetch_text(const char *url, const http_fetch_opts_t *opts_in,
 
         bool retryable = true;
         http_fetch_attempt_info_t info = { .attempt_index = attempt };
-        esp_err_t err = attempt_once(url, &opts, out_body, out_len, &retryable, &info);
+        esp_err_t err = attempt_once(url, &opts, sink, out_body, out_len, &retryable, &info);
         if (opts.on_attempt) opts.on_attempt(&info, opts.hook_ctx);
         if (opts.status_out && info.status != 0) *opts.status_out = info.status;
-        if (err == ESP_OK) return ESP_OK;
+        if (err == ESP_OK || err == HTTP_FETCH_NOT_MODIFIED) return err;
 
         last_err = err;
         if (!retryable) break;
@@ -373,6 +622,352 @@ esp_err_t http_fetch_text(const char *url, const http_fetch_opts_t *opts_in,
     return last_err;
 }
 
+esp_err_t http_fetch_text(const char *url, const http_fetch_opts_t *opts_in,
+                           char **out_body, size_t *out_len) {
+    if (!url || !out_body || !out_len) return ESP_ERR_INVALID_ARG;
+    return fetch_with_retry(url, opts_in, NULL, out_body, out_len);
+}
+
+esp_err_t http_fetch_stream(const char *url, const http_fetch_opts_t *opts_in,
+                             const http_fetch_sink_t *sink, size_t *out_len) {
+    if (!url || !sink || !sink->on_data) return ESP_ERR_INVALID_ARG;
+    size_t len = 0;
+    esp_err_t err = fetch_with_retry(url, opts_in, sink, NULL, &len);
+    if (err == ESP_OK && out_len) *out_len = len;
+    return err;
+}
+
+/* ── Pipelined batch ──────────────────────────────────────────────────── */
+
+/* Per-response parser context: routes one pipelined response into its item. */
+typedef struct {
+    http_fetch_batch_item_t *item;
+    const http_fetch_opts_t *opts;
+    bool deliver;          /* 2xx and within the cap: body goes to the sink */
+    bool over_cap;
+    bool aborted;          /* sink returned false */
+    int64_t t_headers_us;  /* when this response's headers completed */
+} batch_resp_ctx_t;
+
+static void batch_on_status(int status, void *ctx) {
+    batch_resp_ctx_t *rc = (batch_resp_ctx_t *)ctx;
+    rc->item->status = status;
+    rc->deliver = (status >= 200 && status < 300);
+}
+
+static void batch_on_header(const char *name, const char *value, void *ctx) {
+    batch_resp_ctx_t *rc = (batch_resp_ctx_t *)ctx;
+    const http_fetch_opts_t *opts = rc->opts;
+    http_fetch_batch_item_t *item = rc->item;
+    if (!opts->capture_header || !item->capture_out || item->capture_out_len == 0) return;
+    if (strcasecmp(name, opts->capture_header) != 0) return;
+    size_t n = strnlen(value, item->capture_out_len - 1);
+    memcpy(item->capture_out, value, n);
+    item->capture_out[n] = '\0';
+}
+
+static void batch_on_headers_done(int64_t content_length, void *ctx) {
+    batch_resp_ctx_t *rc = (batch_resp_ctx_t *)ctx;
+    rc->t_headers_us = esp_timer_get_time();
+    if (!rc->deliver) return;
+    if (content_length > 0 && (size_t)content_length + 1 > rc->opts->max_response_bytes) {
+        rc->over_cap = true;
+        rc->deliver = false;
+        return;
+    }
+    if (rc->item->sink.on_begin) rc->item->sink.on_begin(rc->item->sink.sink_ctx);
+}
+
+static bool batch_on_body(const char *data, size_t len, void *ctx) {
+    batch_resp_ctx_t *rc = (batch_resp_ctx_t *)ctx;
+    http_fetch_batch_item_t *item = rc->item;
+    if (!rc->deliver) return false;
+    item->body_len += len;
+    if (item->body_len + 1 > rc->opts->max_response_bytes) {
+        rc->over_cap = true;
+        rc->deliver = false;
+        return false;
+    }
+    if (!item->sink.on_data(data, len, item->sink.sink_ctx)) {
+        rc->aborted = true;
+        rc->deliver = false;
+        return false;
+    }
+    return true;
+}
+
+/** Render the optional opts headers as raw "Name: value\r\n" lines. */
+static size_t format_extra_headers(const http_fetch_opts_t *opts, char *buf, size_t cap) {
+    size_t len = 0;
+    buf[0] = '\0';
+    const char *names[2] = { "User-Agent", "Accept" };
+    const char *values[2] = { opts->user_agent, opts->accept };
+    if (opts->bearer_token) {
+        int n = snprintf(buf, cap, "Authorization: Bearer %s\r\n", opts->bearer_token);
+        if (n > 0 && (size_t)n < cap) len = (size_t)n;
+        buf[len] = '\0';
+    }
+    if (opts->extra_header && strchr(opts->extra_header, ':') &&
+        opts->extra_header[0] != ':') {
+        /* Same "Name: value" line http_fetch_text() splits, sent verbatim */
+        int n = snprintf(buf + len, cap - len, "%s\r\n", opts->extra_header);
+        if (n > 0 && (size_t)n < cap - len) len += (size_t)n;
+        buf[len] = '\0';
+    }
+    for (int i = 0; i < 2; i++) {
+        if (!values[i]) continue;
+        int n = snprintf(buf + len, cap - len, "%s: %s\r\n", names[i], values[i]);
+        if (n > 0 && (size_t)n < cap - len) len += (size_t)n;
+        buf[len] = '\0';
+    }
+    return len;
+}
+
+static void pipe_drop(esp_transport_handle_t t) {
+    if (!t) return;
+    esp_transport_close(t);
+    esp_transport_destroy(t);
+}
+
+/** Take the parked pipeline socket if it points at @p origin, else NULL. */
+static esp_transport_handle_t pipe_take(http_fetch_conn_t *conn, const http_url_parts_t *origin) {
+    if (!conn || !conn->pipe) return NULL;
+    esp_transport_handle_t t = conn->pipe;
+    conn->pipe = NULL;
+    if (conn->pipe_port != origin->port || strcmp(conn->pipe_host, origin->host) != 0) {
+        pipe_drop(t);
+        return NULL;
+    }
+    return t;
+}
+
+static void pipe_park(http_fetch_conn_t *conn, esp_transport_handle_t t,
+                      const http_url_parts_t *origin) {
+    if (!conn) {
+        pipe_drop(t);
+        return;
+    }
+    conn->pipe = t;
+    strlcpy(conn->pipe_host, origin->host, sizeof(conn->pipe_host));
+    conn->pipe_port = origin->port;
+}
+
+static bool write_all(esp_transport_handle_t t, const char *buf, size_t len, int timeout_ms) {
+    while (len > 0) {
+        int n = esp_transport_write(t, buf, (int)len, timeout_ms);
+        if (n <= 0) return false;
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * Send every item's GET on one connection, then read the responses in
+ * order. Marks each item it finishes via @p done; anything left unmarked is
+ * for the caller's sequential fallback. Never blocks longer than
+ * opts->timeout_ms per socket operation.
+ */
+static void pipeline_run(http_fetch_batch_item_t *items, int n, const http_fetch_opts_t *opts,
+                         bool *done) {
+    http_url_parts_t origin;
+    if (!http_url_split(items[0].url, &origin)) return;
+
+    char host_value[140];
+    if (opts->host_header) {
+        strlcpy(host_value, opts->host_header, sizeof(host_value));
+    } else if (origin.port != 80) {
+        snprintf(host_value, sizeof(host_value), "%s:%d", origin.host, origin.port);
+    } else {
+        strlcpy(host_value, origin.host, sizeof(host_value));
+    }
+
+    /* Heap, not stack: a bearer token alone can run past 1 KB, and this
+     * runs on the 8 KB poll task stacks. */
+    const size_t extra_cap = 1400;
+    char *extra = heap_caps_malloc(extra_cap, MALLOC_CAP_SPIRAM);
+    if (!extra) return;
+    size_t extra_len = format_extra_headers(opts, extra, extra_cap);
+
+    size_t req_cap = (size_t)n * (HTTP_BATCH_REQ_BYTES + extra_len);
+    char *req = heap_caps_malloc(req_cap, MALLOC_CAP_SPIRAM);
+    if (!req) {
+        heap_caps_free(extra);
+        return;
+    }
+    size_t req_len = 0;
+    for (int i = 0; i < n; i++) {
+        http_url_parts_t parts;
+        if (!http_url_split(items[i].url, &parts) ||
+            (req_len = http_pipeline_append_get(req, req_cap, req_len, parts.path,
+                                                host_value, extra)) == 0) {
+            heap_caps_free(req);
+            heap_caps_free(extra);
+            return;
+        }
+    }
+    heap_caps_free(extra);
+
+    esp_transport_handle_t t = pipe_take(opts->conn, &origin);
+    bool reused = (t != NULL);
+    int64_t connect_us = 0;
+    int idx = 0;
+
+    /* Up to two rounds: a parked socket the server already closed fails on
+     * write or yields EOF before any response byte; reconnect once. */
+    for (int round = 0; round < 2 && idx == 0; round++) {
+        if (!t) {
+            int64_t t0 = esp_timer_get_time();
+            t = esp_transport_tcp_init();
+            if (t && esp_transport_connect(t, origin.host, origin.port, opts->timeout_ms) < 0) {
+                pipe_drop(t);
+                t = NULL;
+            }
+            connect_us = esp_timer_get_time() - t0;
+            reused = false;
+            if (!t) break;
+        }
+
+        if (!write_all(t, req, req_len, opts->timeout_ms)) {
+            pipe_drop(t);
+            t = NULL;
+            if (reused) continue;
+            break;
+        }
+        int64_t t_ready = esp_timer_get_time();
+
+        char chunk[HTTP_STREAM_CHUNK_BYTES];
+        bool any_bytes = false;
+        bool keep = true;
+        batch_resp_ctx_t rc = { .item = &items[idx], .opts = opts };
+        http_resp_callbacks_t cbs = {
+            .on_status = batch_on_status,
+            .on_header = batch_on_header,
+            .on_headers_done = batch_on_headers_done,
+            .on_body = batch_on_body,
+            .ctx = &rc,
+        };
+        http_resp_parser_t parser;
+        http_resp_init(&parser, &cbs);
+
+        while (idx < n && keep) {
+            int got = esp_transport_read(t, chunk, sizeof(chunk), opts->timeout_ms);
+            http_resp_result_t res = HTTP_RESP_IN_PROGRESS;
+            size_t off = 0;
+            if (got > 0) {
+                any_bytes = true;
+            } else if (got == -1 && any_bytes) {
+                res = http_resp_eof(&parser);   /* FIN: may end a read-until-close body */
+                keep = false;
+            } else {
+                keep = false;                   /* timeout, error, or EOF before any reply */
+                break;
+            }
+
+            do {
+                if (got > 0) {
+                    size_t used = 0;
+                    res = http_resp_feed(&parser, chunk + off, (size_t)got - off, &used);
+                    off += used;
+                }
+                if (res == HTTP_RESP_ERROR) {
+                    keep = false;
+                    break;
+                }
+                if (res != HTTP_RESP_COMPLETE) break;
+
+                /* One response finished: settle its item. */
+                http_fetch_batch_item_t *item = &items[idx];
+                int64_t now = esp_timer_get_time();
+                bool ok = rc.deliver && !rc.over_cap && !rc.aborted;
+                /* Redirects and 5xx keep their normal follow/retry handling */
+                bool defer = http_status_is_redirect(item->status) || item->status >= 500;
+                if (!defer) {
+                    item->err = ok ? ESP_OK
+                                   : (rc.over_cap ? ESP_ERR_INVALID_SIZE : ESP_FAIL);
+                    if (!ok && !rc.over_cap && !rc.aborted) {
+                        ESP_LOGW(TAG, "HTTP %d for %s", item->status, item->url);
+                    }
+                    item->pipelined = true;
+                    done[idx] = true;
+                    if (opts->on_attempt) {
+                        http_fetch_attempt_info_t info = {
+                            .ok = ok,
+                            .ever_connected = true,
+                            .status = item->status,
+                            .connect_us = (idx == 0) ? connect_us : 0,
+                            .headers_us = rc.t_headers_us - t_ready,
+                            .body_us = now - rc.t_headers_us,
+                        };
+                        opts->on_attempt(&info, opts->hook_ctx);
+                    }
+                }
+                if (http_resp_closes_connection(&parser)) keep = false;
+                t_ready = now;
+                idx++;
+                if (idx >= n || !keep) break;
+                rc = (batch_resp_ctx_t){ .item = &items[idx], .opts = opts };
+                http_resp_init(&parser, &cbs);
+            } while (got > 0 && off < (size_t)got);
+        }
+
+        if (keep && idx >= n) {
+            pipe_park(opts->conn, t, &origin);
+        } else {
+            pipe_drop(t);
+        }
+        t = NULL;
+        if (idx > 0 || !reused || any_bytes) break;  /* only a dead reused socket retries */
+    }
+
+    pipe_drop(t);
+    heap_caps_free(req);
+}
+
+esp_err_t http_fetch_batch(http_fetch_batch_item_t *items, int n,
+                            const http_fetch_opts_t *opts_in) {
+    if (!items || n <= 0 || n > HTTP_BATCH_MAX) return ESP_ERR_INVALID_ARG;
+    for (int i = 0; i < n; i++) {
+        if (!items[i].url || !items[i].sink.on_data) return ESP_ERR_INVALID_ARG;
+        items[i].err = ESP_FAIL;
+        items[i].status = 0;
+        items[i].body_len = 0;
+        items[i].pipelined = false;
+        if (items[i].capture_out && items[i].capture_out_len > 0) items[i].capture_out[0] = '\0';
+    }
+
+    http_fetch_opts_t opts = opts_in ? *opts_in : (http_fetch_opts_t){0};
+    normalize_opts(&opts);
+    opts.validators = NULL;
+    opts.not_modified_out = NULL;
+
+    bool done[HTTP_BATCH_MAX] = { false };
+
+    bool pipelinable = (n > 1);
+    for (int i = 0; i < n && pipelinable; i++) {
+        http_url_parts_t parts;
+        pipelinable = http_url_split(items[i].url, &parts) && !parts.https &&
+                      (i == 0 || http_url_same_origin(items[0].url, items[i].url));
+    }
+    if (pipelinable) pipeline_run(items, n, &opts, done);
+
+    esp_err_t result = ESP_OK;
+    for (int i = 0; i < n; i++) {
+        if (!done[i]) {
+            /* Sequential fallback with the caller's retry/redirect policy */
+            http_fetch_opts_t one = opts;
+            one.status_out = &items[i].status;
+            one.capture_header_out = items[i].capture_out;
+            one.capture_header_out_len = items[i].capture_out_len;
+            items[i].body_len = 0;
+            items[i].err = fetch_with_retry(items[i].url, &one, &items[i].sink,
+                                            NULL, &items[i].body_len);
+        }
+        if (items[i].err != ESP_OK) result = ESP_FAIL;
+    }
+    return result;
+}
+
 cJSON *http_fetch_json(const char *url, const http_fetch_opts_t *opts) {
     char *body = NULL;
     size_t len = 0;
@@ -397,5 +992,72 @@ void http_fetch_conn_destroy(http_fetch_conn_t *conn) {
     if (conn->client) {
         esp_http_client_cleanup(conn->client);
     }
+    if (conn->pipe) {
+        esp_transport_close(conn->pipe);
+        esp_transport_destroy(conn->pipe);
+    }
     heap_caps_free(conn);
 }
+
+http_validator_cache_t *http_validator_cache_create(int slots, size_t retain_body_max) {
+    if (slots <= 0) return NULL;
+    http_validator_cache_t *cache = heap_caps_calloc(1, sizeof(*cache), MALLOC_CAP_SPIRAM);
+    http_validator_entry_t *entries = heap_caps_calloc((size_t)slots, sizeof(*entries),
+                                                       MALLOC_CAP_SPIRAM);
+    SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+    if (!cache || !entries || !lock) {
+        heap_caps_free(cache);
+        heap_caps_free(entries);
+        if (lock) vSemaphoreDelete(lock);
+        return NULL;
+    }
+    cache->lock = lock;
+    cache->retain_body_max = retain_body_max;
+    http_validator_table_init(&cache->table, entries, slots);
+    return cache;
+}
+
+void http_validator_cache_destroy(http_validator_cache_t *cache) {
+    if (!cache) return;
+    http_validator_cache_clear(cache);
+    vSemaphoreDelete(cache->lock);
+    heap_caps_free(cache->table.entries);
+    heap_caps_free(cache);
+}
+
+void http_validator_cache_clear(http_validator_cache_t *cache) {
+    if (!cache) return;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    for (int i = 0; i < cache->table.slots; i++) {
+        validator_drop_locked(&cache->table.entries[i]);
+    }
+    xSemaphoreGive(cache->lock);
+}
+
+void http_validator_forget(http_validator_cache_t *cache, const char *url) {
+    if (!cache || !url) return;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    http_validator_entry_t *e = http_validator_find(&cache->table, url);
+    if (e) validator_drop_locked(e);
+    xSemaphoreGive(cache->lock);
+}
+
+bool http_validator_lookup(http_validator_cache_t *cache, const char *url,
+                           http_validators_t *out) {
+    if (!url || !out) return false;
+    return validator_prepare(cache, url, out);
+}
+
+void http_validator_commit(http_validator_cache_t *cache, const char *url,
+                           const http_validators_t *v, size_t body_len) {
+    if (!url || !v) return;
+    validator_store(cache, url, v, NULL, body_len);
+}
+
+void http_validator_note_not_modified(http_validator_cache_t *cache, const char *url) {
+    if (!cache || !url) return;
+    xSemaphoreTake(cache->lock, portMAX_DELAY);
+    http_validator_entry_t *e = http_validator_find(&cache->table, url);
+    if (e) note_cond_hit(e->body_len);
+    xSemaphoreGive(cache->lock);
+}
@@ -7,8 +7,12 @@
  * Scope: a plain text/JSON HTTP GET with retry, manual redirect-following
  * (esp_http_client's streaming open()/read() path does NOT auto-follow
  * redirects -- only the one-shot perform() variant does), status checking,
- * and a PSRAM-backed response buffer, with optional persistent keep-alive
- * reuse across calls from the same task.
+ * and a PSRAM-backed response buffer (or, via http_fetch_stream(), chunked
+ * delivery to a caller-supplied sink), with optional persistent keep-alive
+ * reuse across calls from the same task. http_fetch_batch() pipelines
+ * several same-origin GETs on one such connection. An optional validator
+ * cache turns repeat polls into conditional GETs (If-None-Match /
+ * If-Modified-Since) so an unchanged resource costs a 304, not its body.
  *
  * NOT for: image streaming (GOES tiles, Spotify album art -- those decode
  * progressively into caller-managed buffers) or OTA binary download (goes
@@ -33,10 +37,26 @@
 #include <stdint.h>
 #include "esp_err.h"
 #include "cJSON.h"
+#include "http_validator.h"
 
 /** Opaque persistent keep-alive slot; one per task that wants reuse. */
 typedef struct http_fetch_conn http_fetch_conn_t;
 
+/**
+ * Opaque per-URL ETag/Last-Modified store for conditional GETs; see
+ * http_validator_cache_create(). Internally locked, so unlike a conn it may
+ * be shared across tasks.
+ */
+typedef struct http_validator_cache http_validator_cache_t;
+
+/**
+ * Returned by http_fetch_text() / http_fetch_stream() when a conditional GET
+ * came back 304 and the cache retains no body to replay: the caller's last
+ * result for this URL is still current, so skip parsing and publishing.
+ * Chosen outside esp_http_client's own ESP_ERR_HTTP_* codes (0x7001..).
+ */
+#define HTTP_FETCH_NOT_MODIFIED ((esp_err_t)0x7100)
+
 /**
  * Optional per-attempt diagnostics, reported via http_fetch_opts_t.on_attempt
  * once per attempt (success or failure). Lets a caller with its own latency
@@ -97,6 +117,15 @@ typedef struct {
                                   * capture is disabled, the buffer is set to "" (when
                                   * provided). */
     size_t capture_header_out_len; /**< size of capture_header_out incl. NUL */
+    http_validator_cache_t *validators; /**< optional: NULL = plain GET. When set,
+                                  * a URL whose last 2xx carried an ETag and/or
+                                  * Last-Modified is re-requested conditionally, and
+                                  * a 304 returns HTTP_FETCH_NOT_MODIFIED -- or, for
+                                  * a cache created with body retention, ESP_OK with
+                                  * a copy of the retained body (see not_modified_out). */
+    bool *not_modified_out;      /**< optional: set false at the start of every call,
+                                  * true when the result is a 304 (replayed body or
+                                  * HTTP_FETCH_NOT_MODIFIED). */
 } http_fetch_opts_t;
 
 /**
@@ -105,6 +134,7 @@ typedef struct {
  * On success returns ESP_OK, and *out_body is a NUL-terminated PSRAM
  * buffer the caller must release with heap_caps_free(); *out_len is the
  * body length excluding the NUL. On failure returns an esp_err_t != ESP_OK
+ * (HTTP_FETCH_NOT_MODIFIED for an unchanged resource, see opts->validators)
  * and leaves *out_body / *out_len untouched.
  *
  * @param opts  May be NULL to use all defaults (one-shot, no retry, 8s
@@ -113,6 +143,71 @@ typedef struct {
 esp_err_t http_fetch_text(const char *url, const http_fetch_opts_t *opts,
                            char **out_body, size_t *out_len);
 
+/**
+ * Body consumer for http_fetch_stream(). on_begin (optional) runs before
+ * each attempt's body is read, so a retry after a partial read can restart
+ * the consumer from scratch; on_data receives each chunk straight off the
+ * socket and returns false to abort the fetch (not retried).
+ */
+typedef struct {
+    void (*on_begin)(void *sink_ctx);
+    bool (*on_data)(const char *data, size_t len, void *sink_ctx);
+    void *sink_ctx;
+} http_fetch_sink_t;
+
+/**
+ * Streaming variant of http_fetch_text(): same retry, redirect, status,
+ * keep-alive and header-capture behavior, but the body is handed to
+ * @p sink in small chunks instead of being accumulated into a PSRAM buffer.
+ * opts->max_response_bytes still caps the total. On success returns ESP_OK
+ * and writes the body length to *out_len (may be NULL).
+ */
+esp_err_t http_fetch_stream(const char *url, const http_fetch_opts_t *opts,
+                             const http_fetch_sink_t *sink, size_t *out_len);
+
+/** Most requests one http_fetch_batch() call accepts. */
+#define HTTP_BATCH_MAX 16
+
+/**
+ * One request of an http_fetch_batch(). url/sink/capture_out are inputs;
+ * the rest is written by the batch.
+ */
+typedef struct {
+    const char *url;
+    http_fetch_sink_t sink;       /**< on_data required; on_begin re-arms on a fallback retry */
+    char *capture_out;            /**< optional: per-request buffer for opts->capture_header */
+    size_t capture_out_len;
+    esp_err_t err;                /**< ESP_OK once the body was fully delivered */
+    int status;                   /**< final HTTP status; 0 if no response arrived */
+    size_t body_len;
+    bool pipelined;               /**< served from the pipelined connection */
+} http_fetch_batch_item_t;
+
+/**
+ * Fetch @p n GETs, handing each body to its own sink as it arrives.
+ *
+ * When every URL is plain http:// on one host:port, all requests are
+ * written back-to-back on one keep-alive connection (HTTP/1.1 pipelining)
+ * and the responses are parsed in order off the same socket, so the batch
+ * pays one round trip instead of n. The connection is parked in opts->conn
+ * (when set) for the next batch. Any request the pipelined pass could not
+ * finish -- the server closed early, a redirect or 5xx that wants the normal
+ * retry/redirect handling, a transport error -- falls back to
+ * http_fetch_stream() with the same opts, as does the whole batch for
+ * https or mixed-origin URLs.
+ *
+ * opts->on_attempt fires once per pipelined request (connect_us on the
+ * first request only, headers_us = wait for that response's headers,
+ * body_us = its body) and per attempt for fallbacks. opts->status_out and
+ * opts->capture_header_out are ignored; use the per-item fields instead.
+ * opts->validators is ignored: every item is fetched in full.
+ *
+ * Returns ESP_OK if every item succeeded, ESP_FAIL if any failed (see
+ * item->err), ESP_ERR_INVALID_ARG on bad input.
+ */
+esp_err_t http_fetch_batch(http_fetch_batch_item_t *items, int n,
+                            const http_fetch_opts_t *opts);
+
 /**
  * Convenience wrapper: http_fetch_text() + cJSON_Parse(). Returns NULL on
  * any failure (transport, HTTP status, or JSON parse). Caller must
@@ -128,3 +223,47 @@ http_fetch_conn_t *http_fetch_conn_create(void);
 
 /** Destroy a keep-alive slot, cleaning up any live client handle it holds. */
 void http_fetch_conn_destroy(http_fetch_conn_t *conn);
+
+/**
+ * Create a validator cache of @p slots URLs (least recently used evicted),
+ * allocated in PSRAM. Returns NULL on allocation failure; callers then simply
+ * fetch unconditionally.
+ *
+ * @param retain_body_max  0 = validators only: a 304 returns
+ *        HTTP_FETCH_NOT_MODIFIED and the caller keeps its own last result.
+ *        Otherwise http_fetch_text() also keeps a copy of each 2xx body up to
+ *        this size and answers a 304 by replaying it, for callers that must
+ *        re-parse (e.g. a result assembled from several responses). A URL
+ *        whose body is not retained is then fetched unconditionally.
+ */
+http_validator_cache_t *http_validator_cache_create(int slots, size_t retain_body_max);
+
+/** Destroy a validator cache, freeing any retained bodies. */
+void http_validator_cache_destroy(http_validator_cache_t *cache);
+
+/** Forget every URL (e.g. after a config change that re-interprets bodies). */
+void http_validator_cache_clear(http_validator_cache_t *cache);
+
+/** Forget @p url so its next fetch is unconditional. */
+void http_validator_forget(http_validator_cache_t *cache, const char *url);
+
+/*
+ * Building blocks for callers that keep their own esp_http_client path
+ * (e.g. goes_client.c's JPEG download) but want the same cache and metrics:
+ * look up what to send, feed response headers through
+ * http_validators_note_header(), then report the outcome.
+ */
+
+/** Copy the validators stored for @p url into *out. False if none. */
+bool http_validator_lookup(http_validator_cache_t *cache, const char *url,
+                           http_validators_t *out);
+
+/**
+ * Record a full 2xx response of @p body_len bytes for @p url (counted as a
+ * cache miss). Stores @p v, or forgets the URL if @p v holds no validator.
+ */
+void http_validator_commit(http_validator_cache_t *cache, const char *url,
+                           const http_validators_t *v, size_t body_len);
+
+/** Record a 304 for @p url (counted as a hit; adds its body size to bytes saved). */
+void http_validator_note_not_modified(http_validator_cache_t *cache, const char *url);
@@ -0,0 +1,320 @@
+/*
+ * http_pipeline.c - Pure, host-testable pieces of http_fetch_batch().
+ *
+ * See http_pipeline.h for the parser contract.
+ */
+
+#include "http_pipeline.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    ST_STATUS,
+    ST_HEADER,
+    ST_BODY,
+    ST_CHUNK_SIZE,
+    ST_CHUNK_DATA,
+    ST_CHUNK_CRLF,
+    ST_TRAILER,
+    ST_UNTIL_CLOSE,
+    ST_DONE,
+    ST_ERROR,
+};
+
+static char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static bool ieq(const char *a, const char *b) {
+    while (*a && *b) {
+        if (lower(*a++) != lower(*b++)) return false;
+    }
+    return *a == *b;
+}
+
+/* Case-insensitive token search within a comma-separated header value. */
+static bool icontains(const char *hay, const char *needle) {
+    size_t n = strlen(needle);
+    for (; *hay; hay++) {
+        size_t i = 0;
+        while (i < n && hay[i] && lower(hay[i]) == lower(needle[i])) i++;
+        if (i == n) return true;
+    }
+    return false;
+}
+
+bool http_url_split(const char *url, http_url_parts_t *out) {
+    if (!url || !out) return false;
+    memset(out, 0, sizeof(*out));
+
+    const char *p;
+    if (strncmp(url, "http://", 7) == 0) {
+        p = url + 7;
+        out->port = 80;
+    } else if (strncmp(url, "https://", 8) == 0) {
+        p = url + 8;
+        out->https = true;
+        out->port = 443;
+    } else {
+        return false;
+    }
+
+    const char *h_end = p;
+    while (*h_end && *h_end != ':' && *h_end != '/' && *h_end != '?') h_end++;
+    size_t hlen = (size_t)(h_end - p);
+    if (hlen == 0 || hlen >= sizeof(out->host)) return false;
+    memcpy(out->host, p, hlen);
+    out->host[hlen] = '\0';
+
+    p = h_end;
+    if (*p == ':') {
+        p++;
+        int port = 0;
+        int digits = 0;
+        while (*p >= '0' && *p <= '9') {
+            port = port * 10 + (*p++ - '0');
+            if (++digits > 5) return false;
+        }
+        if (digits == 0 || port <= 0 || port > 65535) return false;
+        if (*p && *p != '/' && *p != '?') return false;
+        out->port = port;
+    }
+    out->path = (*p == '/') ? p : "/";
+    return true;
+}
+
+bool http_url_same_origin(const char *a, const char *b) {
+    http_url_parts_t pa, pb;
+    if (!http_url_split(a, &pa) || !http_url_split(b, &pb)) return false;
+    return pa.https == pb.https && pa.port == pb.port && ieq(pa.host, pb.host);
+}
+
+size_t http_pipeline_append_get(char *buf, size_t cap, size_t len,
+                                const char *path, const char *host_value,
+                                const char *extra_headers) {
+    if (len >= cap) return 0;
+    int n = snprintf(buf + len, cap - len,
+                     "GET %s HTTP/1.1\r\n"
+                     "Host: %s\r\n"
+                     "%s"
+                     "Connection: keep-alive\r\n"
+                     "\r\n",
+                     path, host_value, extra_headers ? extra_headers : "");
+    if (n < 0 || (size_t)n >= cap - len) return 0;
+    return len + (size_t)n;
+}
+
+void http_resp_init(http_resp_parser_t *p, const http_resp_callbacks_t *cb) {
+    memset(p, 0, sizeof(*p));
+    if (cb) p->cb = *cb;
+    p->content_length = -1;
+    p->state = ST_STATUS;
+}
+
+static void deliver(http_resp_parser_t *p, const char *data, size_t n) {
+    p->body_bytes += n;
+    if (!p->body_muted && p->cb.on_body && !p->cb.on_body(data, n, p->cb.ctx)) {
+        p->body_muted = true;
+    }
+}
+
+static bool interim(const http_resp_parser_t *p) {
+    return p->status >= 100 && p->status < 200;
+}
+
+static void status_line(http_resp_parser_t *p) {
+    if (p->line_len == 0) return; /* tolerate stray CRLF between messages */
+    const char *l = p->line;
+    if (strncmp(l, "HTTP/1.", 7) != 0 || !(l[7] >= '0' && l[7] <= '9') || l[8] != ' ') {
+        p->state = ST_ERROR;
+        return;
+    }
+    int status = 0;
+    for (int i = 9; i < 12; i++) {
+        if (l[i] < '0' || l[i] > '9') {
+            p->state = ST_ERROR;
+            return;
+        }
+        status = status * 10 + (l[i] - '0');
+    }
+    if (l[12] != '\0' && l[12] != ' ') {
+        p->state = ST_ERROR;
+        return;
+    }
+    p->status = status;
+    if (!interim(p) && p->cb.on_status) p->cb.on_status(status, p->cb.ctx);
+    p->state = ST_HEADER;
+}
+
+static void headers_done(http_resp_parser_t *p) {
+    if (interim(p)) {
+        /* 1xx: a final response follows on the same stream */
+        p->status = 0;
+        p->chunked = false;
+        p->content_length = -1;
+        p->state = ST_STATUS;
+        return;
+    }
+    p->no_body = (p->status == 204 || p->status == 304);
+    if (p->cb.on_headers_done) {
+        int64_t cl = p->no_body ? 0 : (p->chunked ? -1 : p->content_length);
+        p->cb.on_headers_done(cl, p->cb.ctx);
+    }
+    if (p->no_body || (!p->chunked && p->content_length == 0)) {
+        p->state = ST_DONE;
+    } else if (p->chunked) {
+        p->state = ST_CHUNK_SIZE;
+    } else if (p->content_length > 0) {
+        p->remaining = (uint64_t)p->content_length;
+        p->state = ST_BODY;
+    } else {
+        p->until_close = true;
+        p->state = ST_UNTIL_CLOSE;
+    }
+}
+
+static void header_line(http_resp_parser_t *p) {
+    if (p->line_len == 0) {
+        headers_done(p);
+        return;
+    }
+    char *colon = strchr(p->line, ':');
+    if (!colon || colon == p->line) {
+        p->state = ST_ERROR;
+        return;
+    }
+    *colon = '\0';
+    const char *name = p->line;
+    char *value = colon + 1;
+    while (*value == ' ' || *value == '\t') value++;
+    size_t vlen = strlen(value);
+    while (vlen > 0 && (value[vlen - 1] == ' ' || value[vlen - 1] == '\t')) value[--vlen] = '\0';
+
+    if (interim(p)) return;
+
+    if (ieq(name, "Content-Length")) {
+        int64_t cl = 0;
+        const char *v = value;
+        if (*v == '\0') {
+            p->state = ST_ERROR;
+            return;
+        }
+        for (; *v; v++) {
+            if (*v < '0' || *v > '9' || cl > (INT64_MAX - 9) / 10) {
+                p->state = ST_ERROR;
+                return;
+            }
+            cl = cl * 10 + (*v - '0');
+        }
+        p->content_length = cl;
+    } else if (ieq(name, "Transfer-Encoding")) {
+        if (icontains(value, "chunked")) p->chunked = true;
+    } else if (ieq(name, "Connection")) {
+        if (icontains(value, "close")) p->conn_close = true;
+    }
+    if (p->cb.on_header) p->cb.on_header(name, value, p->cb.ctx);
+}
+
+static void chunk_size_line(http_resp_parser_t *p) {
+    uint64_t size = 0;
+    const char *l = p->line;
+    int digits = 0;
+    for (; *l && *l != ';' && *l != ' '; l++) {
+        char c = lower(*l);
+        int h;
+        if (c >= '0' && c <= '9') h = c - '0';
+        else if (c >= 'a' && c <= 'f') h = c - 'a' + 10;
+        else {
+            p->state = ST_ERROR;
+            return;
+        }
+        if (++digits > 15) {
+            p->state = ST_ERROR;
+            return;
+        }
+        size = (size << 4) | (uint64_t)h;
+    }
+    if (digits == 0) {
+        p->state = ST_ERROR;
+        return;
+    }
+    if (size == 0) {
+        p->state = ST_TRAILER;
+    } else {
+        p->remaining = size;
+        p->state = ST_CHUNK_DATA;
+    }
+}
+
+static void handle_line(http_resp_parser_t *p) {
+    switch (p->state) {
+    case ST_STATUS:     status_line(p); break;
+    case ST_HEADER:     header_line(p); break;
+    case ST_CHUNK_SIZE: chunk_size_line(p); break;
+    case ST_CHUNK_CRLF:
+        p->state = (p->line_len == 0) ? ST_CHUNK_SIZE : ST_ERROR;
+        break;
+    case ST_TRAILER:
+        if (p->line_len == 0) p->state = ST_DONE;
+        break;
+    default:
+        p->state = ST_ERROR;
+        break;
+    }
+}
+
+http_resp_result_t http_resp_feed(http_resp_parser_t *p, const char *data, size_t len,
+                                  size_t *consumed) {
+    size_t i = 0;
+    while (i < len && p->state != ST_DONE && p->state != ST_ERROR) {
+        switch (p->state) {
+        case ST_BODY:
+        case ST_CHUNK_DATA: {
+            size_t n = len - i;
+            if ((uint64_t)n > p->remaining) n = (size_t)p->remaining;
+            deliver(p, data + i, n);
+            i += n;
+            p->remaining -= n;
+            if (p->remaining == 0) {
+                p->state = (p->state == ST_BODY) ? ST_DONE : ST_CHUNK_CRLF;
+            }
+            break;
+        }
+        case ST_UNTIL_CLOSE:
+            deliver(p, data + i, len - i);
+            i = len;
+            break;
+        default: {
+            char c = data[i++];
+            if (c == '\n') {
+                if (p->line_len > 0 && p->line[p->line_len - 1] == '\r') p->line_len--;
+                p->line[p->line_len] = '\0';
+                handle_line(p);
+                p->line_len = 0;
+            } else if (p->line_len < sizeof(p->line) - 1) {
+                p->line[p->line_len++] = c;
+            }
+            break;
+        }
+        }
+    }
+    if (consumed) *consumed = i;
+    if (p->state == ST_DONE) return HTTP_RESP_COMPLETE;
+    if (p->state == ST_ERROR) return HTTP_RESP_ERROR;
+    return HTTP_RESP_IN_PROGRESS;
+}
+
+http_resp_result_t http_resp_eof(http_resp_parser_t *p) {
+    if (p->state == ST_UNTIL_CLOSE || p->state == ST_DONE) {
+        p->state = ST_DONE;
+        return HTTP_RESP_COMPLETE;
+    }
+    p->state = ST_ERROR;
+    return HTTP_RESP_ERROR;
+}
+
+bool http_resp_closes_connection(const http_resp_parser_t *p) {
+    return p->conn_close || p->until_close;
+}
@@ -0,0 +1,116 @@
+/*
+ * http_pipeline.h - Pure, host-testable pieces of http_fetch_batch():
+ * URL splitting, pipelined GET request formatting, and an incremental
+ * HTTP/1.1 response parser.
+ *
+ * The parser consumes a byte stream that may hold several back-to-back
+ * responses (one per pipelined request). http_resp_feed() stops exactly at
+ * the end of the current message and reports how many bytes it used, so the
+ * caller re-inits the parser for the next request and feeds it the rest.
+ * Body bytes are handed out as slices of the caller's input (no copy);
+ * Content-Length and chunked framing are supported, as is read-until-close
+ * for a final response that has neither.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef HTTP_PIPELINE_H
+#define HTTP_PIPELINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Status/header lines longer than this are truncated (value still usable
+ * for matching short headers; the framing headers are always short). */
+#define HTTP_RESP_LINE_MAX 256
+
+typedef struct {
+    bool https;
+    char host[128];
+    int  port;          /* explicit or scheme default (80/443) */
+    const char *path;   /* points into the URL; "/" when absent */
+} http_url_parts_t;
+
+/* Split an absolute http(s) URL. Returns false for other schemes, an empty
+ * or over-long host, or a malformed port. */
+bool http_url_split(const char *url, http_url_parts_t *out);
+
+/* True when both URLs split and share scheme, host and port (i.e. can be
+ * pipelined on one connection). */
+bool http_url_same_origin(const char *a, const char *b);
+
+/*
+ * Append one "GET <path> HTTP/1.1" request to @p buf at offset @p len.
+ * @p host_value is the Host header value; @p extra_headers is zero or more
+ * complete "Name: value\r\n" lines (may be NULL). Returns the new length,
+ * or 0 if it would not fit in @p cap.
+ */
+size_t http_pipeline_append_get(char *buf, size_t cap, size_t len,
+                                const char *path, const char *host_value,
+                                const char *extra_headers);
+
+typedef struct {
+    /* Status line parsed; @p status is the numeric code. */
+    void (*on_status)(int status, void *ctx);
+    /* One header (name and value NUL-terminated, value left-trimmed). */
+    void (*on_header)(const char *name, const char *value, void *ctx);
+    /* End of headers; @p content_length is -1 when unknown/chunked. */
+    void (*on_headers_done)(int64_t content_length, void *ctx);
+    /* A body slice. Return false to stop delivering body for this message
+     * (parsing continues so the stream stays in sync). */
+    bool (*on_body)(const char *data, size_t len, void *ctx);
+    void *ctx;
+} http_resp_callbacks_t;
+
+typedef enum {
+    HTTP_RESP_IN_PROGRESS,
+    HTTP_RESP_COMPLETE,      /* message ended; unconsumed bytes belong to the next */
+    HTTP_RESP_ERROR,         /* malformed; the connection cannot be trusted */
+} http_resp_result_t;
+
+typedef struct {
+    http_resp_callbacks_t cb;
+    unsigned char state;
+    bool chunked;
+    bool conn_close;        /* "Connection: close" seen */
+    bool until_close;       /* no framing: body runs to EOF */
+    bool body_muted;        /* on_body returned false */
+    bool no_body;           /* 1xx/204/304 */
+    int status;
+    int64_t content_length; /* -1 unknown */
+    uint64_t remaining;     /* bytes left in body or current chunk */
+    uint64_t body_bytes;
+    size_t line_len;
+    char line[HTTP_RESP_LINE_MAX];
+} http_resp_parser_t;
+
+void http_resp_init(http_resp_parser_t *p, const http_resp_callbacks_t *cb);
+
+/*
+ * Feed @p len bytes. Stores the number of bytes used in *@p consumed (less
+ * than @p len only when the message completed mid-buffer). Returns the
+ * parser state after this call.
+ */
+http_resp_result_t http_resp_feed(http_resp_parser_t *p, const char *data, size_t len,
+                                  size_t *consumed);
+
+/* Signal EOF. Completes a read-until-close body; any other unfinished
+ * message is an error. */
+http_resp_result_t http_resp_eof(http_resp_parser_t *p);
+
+/* True once the message's headers asked the server to close afterwards
+ * (or the body is delimited by close), i.e. no further pipelined responses
+ * will follow on this connection. */
+bool http_resp_closes_connection(const http_resp_parser_t *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HTTP_PIPELINE_H */
@@ -0,0 +1,101 @@
+/*
+ * http_validator.c - Pure, host-testable conditional-GET validator table.
+ *
+ * See http_validator.h for the contract.
+ */
+
+#include "http_validator.h"
+
+#include <string.h>
+#include <strings.h>
+
+uint64_t http_validator_url_hash(const char *url) {
+    uint64_t h = 1469598103934665603ULL;
+    for (const unsigned char *p = (const unsigned char *)url; p && *p; p++) {
+        h ^= *p;
+        h *= 1099511628211ULL;
+    }
+    return h ? h : 1;
+}
+
+void http_validators_clear(http_validators_t *v) {
+    v->etag[0] = '\0';
+    v->last_modified[0] = '\0';
+}
+
+bool http_validators_present(const http_validators_t *v) {
+    return v->etag[0] != '\0' || v->last_modified[0] != '\0';
+}
+
+static void set_value(char *dst, size_t cap, const char *value) {
+    size_t n = strlen(value);
+    if (n >= cap) {
+        dst[0] = '\0';
+        return;
+    }
+    memcpy(dst, value, n + 1);
+}
+
+bool http_validators_note_header(http_validators_t *v, const char *name, const char *value) {
+    if (!name || !value) return false;
+    if (strcasecmp(name, "ETag") == 0) {
+        set_value(v->etag, sizeof(v->etag), value);
+        return true;
+    }
+    if (strcasecmp(name, "Last-Modified") == 0) {
+        set_value(v->last_modified, sizeof(v->last_modified), value);
+        return true;
+    }
+    return false;
+}
+
+void http_validator_table_init(http_validator_table_t *t, http_validator_entry_t *entries,
+                               int slots) {
+    t->entries = entries;
+    t->slots = slots;
+    t->tick = 0;
+    memset(entries, 0, sizeof(*entries) * (size_t)slots);
+}
+
+http_validator_entry_t *http_validator_find(http_validator_table_t *t, const char *url) {
+    uint64_t h = http_validator_url_hash(url);
+    for (int i = 0; i < t->slots; i++) {
+        if (t->entries[i].url_hash == h) {
+            t->entries[i].last_used = ++t->tick;
+            return &t->entries[i];
+        }
+    }
+    return NULL;
+}
+
+http_validator_entry_t *http_validator_claim(http_validator_table_t *t, const char *url,
+                                             bool *recycled) {
+    if (recycled) *recycled = false;
+    http_validator_entry_t *e = http_validator_find(t, url);
+    if (e) return e;
+    if (t->slots <= 0) return NULL;
+
+    /* Free slot first, else the least recently used one */
+    http_validator_entry_t *victim = &t->entries[0];
+    for (int i = 0; i < t->slots; i++) {
+        http_validator_entry_t *c = &t->entries[i];
+        if (c->url_hash == 0) {
+            victim = c;
+            break;
+        }
+        if (c->last_used < victim->last_used) victim = c;
+    }
+    if (recycled) *recycled = (victim->url_hash != 0);
+    victim->url_hash = http_validator_url_hash(url);
+    victim->last_used = ++t->tick;
+    victim->body_len = 0;
+    http_validators_clear(&victim->v);
+    return victim;
+}
+
+void http_validator_release(http_validator_entry_t *e) {
+    e->url_hash = 0;
+    e->last_used = 0;
+    e->body_len = 0;
+    http_validators_clear(&e->v);
+}
@@ -0,0 +1,90 @@
+/*
+ * http_validator.h - Pure, host-testable bookkeeping behind http_fetch's
+ * conditional-GET cache: a small fixed table mapping a URL to the ETag /
+ * Last-Modified validators of the last full response it returned.
+ *
+ * Entries are keyed by a 64-bit FNV-1a hash of the URL, so a slot costs a
+ * fixed ~150 bytes no matter how long the URL is. When the table is full the
+ * least recently used entry is recycled. The table never allocates: the
+ * caller provides the entry array, and an optional retained body pointer is
+ * carried opaquely for the caller to own and free.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef HTTP_VALIDATOR_H
+#define HTTP_VALIDATOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Longer validators are not stored (the response is simply not cached):
+ * a truncated ETag would never match, a truncated date could wrongly match. */
+#define HTTP_VALIDATOR_ETAG_MAX 96
+#define HTTP_VALIDATOR_DATE_MAX 40
+
+typedef struct {
+    char etag[HTTP_VALIDATOR_ETAG_MAX];           /* "" = none */
+    char last_modified[HTTP_VALIDATOR_DATE_MAX];  /* "" = none */
+} http_validators_t;
+
+typedef struct {
+    uint64_t url_hash;      /* 0 = free slot */
+    uint32_t last_used;     /* table tick of the last find/claim */
+    uint32_t body_len;      /* size of the full body these validators describe */
+    void *body;             /* optional retained copy; owned by the caller */
+    http_validators_t v;
+} http_validator_entry_t;
+
+typedef struct {
+    http_validator_entry_t *entries;
+    int slots;
+    uint32_t tick;
+} http_validator_table_t;
+
+/* 64-bit FNV-1a of @p url; never returns 0 (the free-slot marker). */
+uint64_t http_validator_url_hash(const char *url);
+
+void http_validators_clear(http_validators_t *v);
+
+/* True when at least one validator is set. */
+bool http_validators_present(const http_validators_t *v);
+
+/*
+ * Record @p value if @p name is ETag or Last-Modified (case-insensitive).
+ * Returns true if the header was one of the two. An over-long value clears
+ * that validator instead of truncating it.
+ */
+bool http_validators_note_header(http_validators_t *v, const char *name, const char *value);
+
+/* Point @p t at @p entries (zeroed here). */
+void http_validator_table_init(http_validator_table_t *t, http_validator_entry_t *entries,
+                               int slots);
+
+/* Entry for @p url, or NULL. Refreshes its LRU stamp. */
+http_validator_entry_t *http_validator_find(http_validator_table_t *t, const char *url);
+
+/*
+ * Entry for @p url, taking a free slot or recycling the least recently used
+ * one if @p url has none. A recycled or fresh entry has its validators and
+ * body_len reset; its body pointer is left untouched so the caller can free
+ * it -- *recycled (optional) is set true when the entry's previous contents
+ * (body included) belonged to a different URL.
+ */
+http_validator_entry_t *http_validator_claim(http_validator_table_t *t, const char *url,
+                                             bool *recycled);
+
+/* Mark @p e free. Its body pointer is left for the caller to release. */
+void http_validator_release(http_validator_entry_t *e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HTTP_VALIDATOR_H */
@@ -1,4 +1,9 @@
 #include "image_red_remap.h"
+#include "red_remap_kernel.h"
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
 #include "ui/nina_dashboard.h"
 #include "ui/themes.h"
 
@@ -19,21 +24,52 @@ void image_red_remap_rgb565(uint16_t *buf, size_t px_count)
     image_red_remap_rgb565_force(buf, px_count);
 }
 
+#if CONFIG_NINA_RED_REMAP_LUT
+static const char *TAG = "red_remap";
+
+/* 64K-entry PSRAM table, built on first use. Remaps run from several tasks
+ * (image display, Spotify art, moon render), so the publish is guarded and a
+ * losing racer frees its copy. If the allocation fails it is not retried
+ * and the packed kernel is used instead. */
+static uint16_t *s_lut = NULL;
+static bool s_lut_failed = false;
+static portMUX_TYPE s_lut_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static const uint16_t *red_remap_lut(void)
+{
+    portENTER_CRITICAL(&s_lut_mux);
+    uint16_t *lut = s_lut;
+    portEXIT_CRITICAL(&s_lut_mux);
+    if (lut || s_lut_failed) return lut;
+
+    uint16_t *fresh = heap_caps_malloc(RED_REMAP_LUT_BYTES, MALLOC_CAP_SPIRAM);
+    if (!fresh) {
+        ESP_LOGW(TAG, "LUT alloc failed (%u bytes), using packed kernel",
+                 (unsigned)RED_REMAP_LUT_BYTES);
+        s_lut_failed = true;
+        return NULL;
+    }
+    red_remap_lut_build(fresh);
+    portENTER_CRITICAL(&s_lut_mux);
+    if (!s_lut) s_lut = fresh;
+    lut = s_lut;
+    portEXIT_CRITICAL(&s_lut_mux);
+    if (lut != fresh) heap_caps_free(fresh);
+    return lut;
+}
+#endif
+
 void image_red_remap_rgb565_force(uint16_t *buf, size_t px_count)
 {
     if (buf == NULL || px_count == 0) {
         return;
     }
-    for (size_t i = 0; i < px_count; i++) {
-        uint16_t px = buf[i];
-        uint8_t r5 = (uint8_t)((px >> 11) & 0x1f);
-        uint8_t g6 = (uint8_t)((px >> 5) & 0x3f);
-        uint8_t b5 = (uint8_t)(px & 0x1f);
-        uint8_t r8 = (uint8_t)((r5 << 3) | (r5 >> 2));
-        uint8_t g8 = (uint8_t)((g6 << 2) | (g6 >> 4));
-        uint8_t b8 = (uint8_t)((b5 << 3) | (b5 >> 2));
-        uint8_t luma8 = (uint8_t)((77 * r8 + 150 * g8 + 29 * b8) >> 8);
-        uint8_t r5o = (uint8_t)(luma8 >> 3);
-        buf[i] = (uint16_t)(r5o << 11);
+#if CONFIG_NINA_RED_REMAP_LUT
+    const uint16_t *lut = red_remap_lut();
+    if (lut) {
+        red_remap_rgb565_lut(buf, px_count, lut);
+        return;
     }
+#endif
+    red_remap_rgb565_packed(buf, px_count);
 }
@@ -0,0 +1,279 @@
+/**
+ * @file jpeg_service.c
+ * @brief Long-lived hardware JPEG decoder engine and output buffer pool. See jpeg_service.h.
+ */
+
+#include "jpeg_service.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "driver/jpeg_decode.h"
+#include "esp_cache.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "perf_monitor.h"
+
+static const char *TAG = "jpeg_service";
+
+/* Minimum free internal DMA heap required before creating the decoder engine.
+ * The engine allocates DMA tx/rx link descriptors from internal memory; if that
+ * fails, the ESP-IDF cleanup path crashes on a NULL dereference (IDF bug in
+ * jpeg_release_codec_handle). Leave headroom for the SDIO WiFi driver too. */
+#define JPEG_SERVICE_DMA_MIN_FREE_BYTES  (20 * 1024)
+
+/* How long a decode waits for another caller to finish with the engine. */
+#define JPEG_SERVICE_WAIT_MS             10000
+
+#define JPEG_SERVICE_BUF_BYTES \
+    ((size_t)JPEG_SERVICE_MAX_DIM * JPEG_SERVICE_MAX_DIM * 2)
+
+typedef struct {
+    uint8_t *buf;    /* NULL once detached by jpeg_service_take(), until refilled */
+    size_t   size;
+    bool     busy;   /* leased */
+} jpeg_service_slot_t;
+
+static SemaphoreHandle_t      s_engine_mutex;
+static jpeg_decoder_handle_t  s_engine;        /* guarded by s_engine_mutex */
+static jpeg_service_slot_t    s_slots[JPEG_SERVICE_BUF_COUNT];
+static portMUX_TYPE           s_slot_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t *alloc_output(size_t size, size_t *allocated)
+{
+    jpeg_decode_memory_alloc_cfg_t mem_cfg = {
+        .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
+    };
+    *allocated = 0;
+    return (uint8_t *)jpeg_alloc_decoder_mem(size, &mem_cfg, allocated);
+}
+
+/* Create the engine if it does not exist. Caller holds s_engine_mutex. */
+static bool ensure_engine(void)
+{
+    if (s_engine) return true;
+
+    size_t free_dma = heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (free_dma < JPEG_SERVICE_DMA_MIN_FREE_BYTES) {
+        ESP_LOGW(TAG, "Low DMA heap (%d bytes), not creating decoder engine", (int)free_dma);
+        return false;
+    }
+
+    jpeg_decode_engine_cfg_t engine_cfg = {
+        .intr_priority = 0,
+        .timeout_ms = 5000,
+    };
+    esp_err_t err = jpeg_new_decoder_engine(&engine_cfg, &s_engine);
+    if (err != ESP_OK || !s_engine) {
+        ESP_LOGE(TAG, "Decoder engine creation failed: %s", esp_err_to_name(err));
+        s_engine = NULL;
+        return false;
+    }
+    return true;
+}
+
+/* Lease an output buffer of at least @p need bytes into @p f. */
+static bool lease_buffer(size_t need, jpeg_service_frame_t *f)
+{
+    int empty = -1;
+
+    if (need <= JPEG_SERVICE_BUF_BYTES) {
+        taskENTER_CRITICAL(&s_slot_mux);
+        for (int i = 0; i < JPEG_SERVICE_BUF_COUNT; i++) {
+            if (s_slots[i].busy) continue;
+            if (s_slots[i].buf) {
+                s_slots[i].busy = true;
+                f->buf = s_slots[i].buf;
+                f->buf_size = s_slots[i].size;
+                f->slot = i;
+                break;
+            }
+            if (empty < 0) empty = i;
+        }
+        if (!f->buf && empty >= 0) {
+            s_slots[empty].busy = true;   /* refilled below */
+        }
+        taskEXIT_CRITICAL(&s_slot_mux);
+
+        if (f->buf) {
+            perf_counter_increment(&g_perf.jpeg_pool_hit_count);
+            return true;
+        }
+    }
+
+    perf_counter_increment(&g_perf.jpeg_pool_miss_count);
+
+    if (empty >= 0) {
+        /* Refill a slot whose buffer was taken. Done outside the spinlock. */
+        size_t allocated = 0;
+        uint8_t *buf = alloc_output(JPEG_SERVICE_BUF_BYTES, &allocated);
+        taskENTER_CRITICAL(&s_slot_mux);
+        s_slots[empty].buf = buf;
+        s_slots[empty].size = allocated;
+        s_slots[empty].busy = (buf != NULL);
+        taskEXIT_CRITICAL(&s_slot_mux);
+        if (buf) {
+            f->buf = buf;
+            f->buf_size = allocated;
+            f->slot = empty;
+            return true;
+        }
+    }
+
+    /* Oversized frame, or every slot busy: one-off buffer. */
+    size_t allocated = 0;
+    f->buf = alloc_output(need, &allocated);
+    f->buf_size = allocated;
+    f->slot = -1;
+    return f->buf != NULL;
+}
+
+esp_err_t jpeg_service_init(void)
+{
+    if (s_engine_mutex) return ESP_OK;
+
+    s_engine_mutex = xSemaphoreCreateMutex();
+    if (!s_engine_mutex) return ESP_ERR_NO_MEM;
+
+    xSemaphoreTake(s_engine_mutex, portMAX_DELAY);
+    bool engine_ok = ensure_engine();
+    xSemaphoreGive(s_engine_mutex);
+
+    int reserved = 0;
+    for (int i = 0; i < JPEG_SERVICE_BUF_COUNT; i++) {
+        s_slots[i].buf = alloc_output(JPEG_SERVICE_BUF_BYTES, &s_slots[i].size);
+        if (s_slots[i].buf) reserved++;
+    }
+
+    ESP_LOGI(TAG, "HW JPEG service ready (engine %s, %d x %u KB output buffers)",
+             engine_ok ? "up" : "deferred", reserved,
+             (unsigned)(JPEG_SERVICE_BUF_BYTES / 1024));
+    return ESP_OK;
+}
+
+esp_err_t jpeg_service_decode(const uint8_t *jpg, size_t size, jpeg_service_frame_t *out)
+{
+    if (!jpg || size == 0 || !out) return ESP_ERR_INVALID_ARG;
+    memset(out, 0, sizeof(*out));
+    out->slot = -1;
+    if (!s_engine_mutex) return ESP_ERR_INVALID_STATE;
+
+    jpeg_decode_picture_info_t pic_info = {0};
+    esp_err_t err = jpeg_decoder_get_info(jpg, size, &pic_info);
+    if (err != ESP_OK) return err;
+    if (pic_info.width == 0 || pic_info.height == 0) return ESP_ERR_INVALID_SIZE;
+
+    /* The HW decoder always writes whole 16px MCUs regardless of subsampling. */
+    out->width    = pic_info.width;
+    out->height   = pic_info.height;
+    out->stride_w = ((pic_info.width + 15) / 16) * 16;
+    out->stride_h = ((pic_info.height + 15) / 16) * 16;
+    out->gray     = (pic_info.sample_method == JPEG_DOWN_SAMPLING_GRAY);
+
+    /* Sized for RGB565 even when decoding gray, so gray expands in place. */
+    size_t pixels = (size_t)out->stride_w * out->stride_h;
+    if (!lease_buffer(pixels * 2, out)) {
+        ESP_LOGE(TAG, "No output buffer for %lux%lu",
+                 (unsigned long)out->width, (unsigned long)out->height);
+        return ESP_ERR_NO_MEM;
+    }
+    /* Zero so PPA edge interpolation reads black, not stale pixels; write it
+     * back so no dirty line is evicted over the decoder's DMA output. */
+    memset(out->buf, 0, pixels * 2);
+    esp_cache_msync(out->buf, out->buf_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+
+    if (xSemaphoreTake(s_engine_mutex, pdMS_TO_TICKS(JPEG_SERVICE_WAIT_MS)) != pdTRUE) {
+        ESP_LOGW(TAG, "Decoder busy, giving up");
+        jpeg_service_release(out);
+        return ESP_ERR_TIMEOUT;
+    }
+    if (!ensure_engine()) {
+        xSemaphoreGive(s_engine_mutex);
+        jpeg_service_release(out);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    jpeg_decode_cfg_t decode_cfg = {
+        .output_format = out->gray ? JPEG_DECODE_OUT_FORMAT_GRAY : JPEG_DECODE_OUT_FORMAT_RGB565,
+        .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
+    };
+    uint32_t out_size = 0;
+    err = jpeg_decoder_process(s_engine, &decode_cfg, jpg, size,
+                               out->buf, out->buf_size, &out_size);
+    if (err == ESP_ERR_TIMEOUT) {
+        /* A wedged engine is rebuilt on the next decode. */
+        jpeg_del_decoder_engine(s_engine);
+        s_engine = NULL;
+    }
+    xSemaphoreGive(s_engine_mutex);
+
+    if (err != ESP_OK || out_size == 0) {
+        ESP_LOGW(TAG, "HW decode failed: %s", esp_err_to_name(err));
+        jpeg_service_release(out);
+        return err != ESP_OK ? err : ESP_FAIL;
+    }
+
+    if (out->gray) {
+        /* Expand 1 byte/px to RGB565 back to front: pixel i's output (bytes
+         * 2i, 2i+1) never overlaps a gray byte that is still to be read. */
+        const uint8_t *src = out->buf;
+        uint16_t *dst = (uint16_t *)out->buf;
+        for (size_t i = pixels; i-- > 0; ) {
+            uint8_t g = src[i];
+            dst[i] = ((g >> 3) << 11) | ((g >> 2) << 5) | (g >> 3);
+        }
+        esp_cache_msync(out->buf, out->buf_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+    }
+    out->out_size = (uint32_t)(pixels * 2);
+    return ESP_OK;
+}
+
+uint8_t *jpeg_service_take(jpeg_service_frame_t *frame)
+{
+    if (!frame || !frame->buf) return NULL;
+
+    uint8_t *buf = frame->buf;
+    if (frame->slot >= 0) {
+        /* Copy the pixels out so the slot stays in the pool: detaching it
+         * would hand the caller a full JPEG_SERVICE_MAX_DIM-square buffer and
+         * make the next lease allocate a new one. */
+        size_t copy_size = ((size_t)frame->out_size + 127) & ~(size_t)127;
+        uint8_t *copy = heap_caps_aligned_alloc(128, copy_size, MALLOC_CAP_SPIRAM);
+        if (copy) {
+            memcpy(copy, frame->buf, frame->out_size);
+            /* Write back so a later PPA/DMA read sees the pixels */
+            esp_cache_msync(copy, copy_size, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+            jpeg_service_release(frame);
+            return copy;
+        }
+        /* No room for a copy: give up the slot instead; it is refilled on a
+         * later lease. */
+        ESP_LOGW(TAG, "No memory to copy out %lu bytes, detaching pool buffer",
+                 (unsigned long)frame->out_size);
+        taskENTER_CRITICAL(&s_slot_mux);
+        s_slots[frame->slot].buf = NULL;
+        s_slots[frame->slot].size = 0;
+        s_slots[frame->slot].busy = false;
+        taskEXIT_CRITICAL(&s_slot_mux);
+    }
+    memset(frame, 0, sizeof(*frame));
+    frame->slot = -1;
+    return buf;
+}
+
+void jpeg_service_release(jpeg_service_frame_t *frame)
+{
+    if (!frame || !frame->buf) return;
+
+    if (frame->slot >= 0) {
+        taskENTER_CRITICAL(&s_slot_mux);
+        s_slots[frame->slot].busy = false;
+        taskEXIT_CRITICAL(&s_slot_mux);
+    } else {
+        free(frame->buf);
+    }
+    memset(frame, 0, sizeof(*frame));
+    frame->slot = -1;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @file jpeg_service.h
+ * @brief Shared hardware JPEG decoder: one long-lived engine plus a small pool
+ *        of pre-reserved output buffers, used by every image path.
+ *
+ * Creating a decoder engine allocates DMA link descriptors from the internal
+ * DMA heap (the one PERF_DMA_HEAP_WARN_THRESHOLD watches). Doing that around
+ * every decode both costs setup time and, interleaved with the SDIO WiFi and
+ * TLS allocations, fragments that heap. The service creates the engine once at
+ * boot, while the heap is still plentiful, and keeps it for the lifetime of the
+ * firmware. Callers are serialized on a mutex; tasks waiting for the engine
+ * queue in priority order.
+ *
+ * Output buffers for frames up to JPEG_SERVICE_MAX_DIM x JPEG_SERVICE_MAX_DIM
+ * come from a pool of JPEG_SERVICE_BUF_COUNT PSRAM buffers reserved up front.
+ * A decoded frame is leased to the caller, who either releases it back to the
+ * pool once the pixels have been consumed (e.g. after a PPA scale) or takes
+ * the pixels to hand to the UI; taking copies them into a buffer of the
+ * frame's own size, so the pool slot stays reserved for the next decode.
+ * Larger frames (e.g. 1024px GOES images) get a one-off buffer.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+/* Largest frame (each side, in pixels) decoded into a pool buffer. */
+#define JPEG_SERVICE_MAX_DIM    720
+/* Pool buffers reserved at init (RGB565, JPEG_SERVICE_MAX_DIM squared). */
+#define JPEG_SERVICE_BUF_COUNT  2
+
+/** A decoded frame leased from the service. */
+typedef struct {
+    uint8_t *buf;        /**< RGB565 pixels, stride_w x stride_h */
+    size_t   buf_size;   /**< Allocated size of buf in bytes */
+    uint32_t out_size;   /**< Bytes of pixel data (stride_w * stride_h * 2) */
+    uint32_t width;      /**< Picture width in pixels */
+    uint32_t height;     /**< Picture height in pixels */
+    uint32_t stride_w;   /**< Width rounded up to the 16px MCU */
+    uint32_t stride_h;   /**< Height rounded up to the 16px MCU */
+    bool     gray;       /**< Source was grayscale (expanded to RGB565) */
+    int      slot;       /**< Pool slot, or -1 for a one-off buffer */
+} jpeg_service_frame_t;
+
+/**
+ * @brief Create the decoder engine and reserve the pool buffers.
+ *
+ * Call once early in app_main(), before anything decodes. If the engine
+ * cannot be created now (low DMA heap), the first decode retries.
+ *
+ * @return ESP_OK, or ESP_ERR_NO_MEM if the mutex could not be created.
+ */
+esp_err_t jpeg_service_init(void);
+
+/**
+ * @brief Hardware-decode a baseline JPEG to RGB565.
+ *
+ * Grayscale JPEGs are decoded as gray and expanded to RGB565 in place, so the
+ * result is always RGB565. The padding beyond width/height up to the stride
+ * holds whatever the decoder wrote for the partial MCU. On success the frame
+ * must be given back with jpeg_service_release() or jpeg_service_take().
+ *
+ * @param jpg   JPEG data (any memory; the driver copies to DMA-capable RAM)
+ * @param size  Size in bytes
+ * @param out   Receives the leased frame
+ * @return ESP_OK; ESP_ERR_INVALID_STATE when the engine is unavailable (low
+ *         DMA heap); ESP_ERR_TIMEOUT when the engine stayed busy; or the
+ *         driver's error (e.g. unsupported progressive/CMYK JPEG; callers fall
+ *         back to jpeg_sw_decode_rgb565()).
+ */
+esp_err_t jpeg_service_decode(const uint8_t *jpg, size_t size, jpeg_service_frame_t *out);
+
+/**
+ * @brief Hand the frame's pixels to the caller.
+ *
+ * A pool frame is copied into a 128-byte aligned PSRAM buffer of out_size
+ * bytes (rounded up to the cache line) and its slot released; a one-off
+ * buffer is handed over as is. If the copy cannot be allocated, the pool
+ * buffer itself is detached and its slot refilled on a later lease. The
+ * caller owns the returned buffer and frees it with free() (or hands it to an
+ * owner that does). The frame is cleared.
+ *
+ * @return The pixels, or NULL for a cleared frame.
+ */
+uint8_t *jpeg_service_take(jpeg_service_frame_t *frame);
+
+/**
+ * @brief Return the frame's buffer to the pool (one-off buffers are freed).
+ * No-op on a cleared frame. The frame is cleared.
+ */
+void jpeg_service_release(jpeg_service_frame_t *frame);
@@ -1,13 +1,13 @@
 /**
  * @file jpeg_utils.c
- * @brief JPEG fetch, hardware decode, and grayscale conversion for thumbnail display.
+ * @brief JPEG thumbnail fetch/display, software decode fallback, and PPA scaling.
  */
 
 #include "jpeg_utils.h"
+#include "jpeg_service.h"
 #include "nina_client.h"
 #include "ui/nina_dashboard.h"
 #include "bsp/esp-bsp.h"
-#include "driver/jpeg_decode.h"
 #include "driver/ppa.h"
 #include "esp_heap_caps.h"
 #include "esp_log.h"
@@ -20,122 +20,37 @@ static const char *TAG = "jpeg_utils";
 /* PPA SRM client for hardware image scaling (lazy-initialized) */
 static ppa_client_handle_t s_ppa_srm_client = NULL;
 
-/* Minimum free internal DMA heap required before attempting hardware JPEG decode.
- * The JPEG decoder engine allocates DMA tx/rx link descriptors from internal memory.
- * If we let it try when memory is tight, the ESP-IDF cleanup path crashes on NULL
- * dereference (IDF bug in jpeg_release_codec_handle).  Keep enough headroom for the
- * SDIO WiFi driver which also needs internal DMA buffers. */
-#define JPEG_DMA_MIN_FREE_BYTES  (20 * 1024)
-
 bool fetch_and_show_thumbnail(const char *base_url) {
     size_t jpeg_size = 0;
-    perf_timer_start(&g_perf.jpeg_fetch);
+    perf_span_t jpeg_fetch_span = perf_timer_start();
     uint8_t *jpeg_buf = nina_client_fetch_prepared_image(base_url, 720, 720, 70, &jpeg_size);
-    perf_timer_stop(&g_perf.jpeg_fetch);
+    perf_timer_stop(&g_perf.jpeg_fetch, jpeg_fetch_span);
     if (!jpeg_buf || jpeg_size == 0) {
         return false;
     }
 
-    bool success = false;
-    jpeg_decode_picture_info_t pic_info = {0};
-    esp_err_t err = jpeg_decoder_get_info(jpeg_buf, jpeg_size, &pic_info);
-    if (err == ESP_OK && pic_info.width > 0 && pic_info.height > 0) {
-        bool is_gray = (pic_info.sample_method == JPEG_DOWN_SAMPLING_GRAY);
-        // Output dimensions rounded up to 16 — HW decoder always uses 16px MCU alignment
-        uint32_t out_w = ((pic_info.width + 15) / 16) * 16;
-        uint32_t out_h = ((pic_info.height + 15) / 16) * 16;
-        // Grayscale: 1 byte/pixel decode buffer; RGB565: 2 bytes/pixel
-        uint32_t decode_buf_size = out_w * out_h * (is_gray ? 1 : 2);
-
-        jpeg_decode_memory_alloc_cfg_t mem_cfg = {
-            .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
-        };
-        size_t allocated_size = 0;
-        uint8_t *decode_buf = (uint8_t *)jpeg_alloc_decoder_mem(decode_buf_size, &mem_cfg, &allocated_size);
-
-        if (decode_buf) {
-            memset(decode_buf, 0, allocated_size); /* Zero buffer so PPA edge interpolation reads black, not heap garbage */
-            /* Guard: only create the HW decoder when internal DMA heap has enough
-             * headroom.  This avoids both the ESP-IDF crash (buggy cleanup on alloc
-             * failure) and starving the SDIO WiFi driver of DMA buffers. */
-            size_t free_dma = heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
-            if (free_dma < JPEG_DMA_MIN_FREE_BYTES) {
-                ESP_LOGW(TAG, "Skipping HW decode: low DMA heap (%d bytes)", (int)free_dma);
-                free(decode_buf);
-                free(jpeg_buf);
-                return false;
-            }
-
-            jpeg_decoder_handle_t decoder = NULL;
-            jpeg_decode_engine_cfg_t engine_cfg = {
-                .intr_priority = 0,
-                .timeout_ms = 5000,
-            };
-            err = jpeg_new_decoder_engine(&engine_cfg, &decoder);
-            if (err == ESP_OK && decoder) {
-                jpeg_decode_cfg_t decode_cfg = {
-                    .output_format = is_gray ? JPEG_DECODE_OUT_FORMAT_GRAY : JPEG_DECODE_OUT_FORMAT_RGB565,
-                    .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
-                };
-                uint32_t out_size = 0;
-                perf_timer_start(&g_perf.jpeg_decode);
-                err = jpeg_decoder_process(decoder, &decode_cfg,
-                    jpeg_buf, jpeg_size,
-                    decode_buf, allocated_size, &out_size);
-                perf_timer_stop(&g_perf.jpeg_decode);
-                jpeg_del_decoder_engine(decoder);
-
-                if (err == ESP_OK && out_size > 0) {
-                    uint8_t *rgb_buf = decode_buf;
-                    uint32_t rgb_size = out_size;
-
-                    if (is_gray) {
-                        // Convert grayscale to RGB565 for LVGL display
-                        uint32_t pixel_count = out_w * out_h;
-                        rgb_size = pixel_count * 2;
-                        rgb_buf = heap_caps_malloc(rgb_size, MALLOC_CAP_SPIRAM);
-                        if (rgb_buf) {
-                            uint16_t *dst = (uint16_t *)rgb_buf;
-                            for (uint32_t i = 0; i < pixel_count; i++) {
-                                uint8_t g = decode_buf[i];
-                                // RGB565: 5-bit R, 6-bit G, 5-bit B
-                                dst[i] = ((g >> 3) << 11) | ((g >> 2) << 5) | (g >> 3);
-                            }
-                            free(decode_buf);
-                            decode_buf = NULL;
-                        } else {
-                            ESP_LOGE(TAG, "Failed to alloc gray->RGB565 buffer");
-                            free(decode_buf);
-                            decode_buf = NULL;
-                            free(jpeg_buf);
-                            return false;
-                        }
-                    }
-
-                    ESP_LOGI(TAG, "JPEG decoded: %lux%lu %s -> %lu bytes",
-                        (unsigned long)pic_info.width, (unsigned long)pic_info.height,
-                        is_gray ? "gray" : "color", (unsigned long)rgb_size);
-                    if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
-                        nina_dashboard_set_thumbnail(rgb_buf, out_w, out_h, rgb_size);
-                        bsp_display_unlock();
-                        rgb_buf = NULL;  // ownership transferred
-                    } else {
-                        ESP_LOGW(TAG, "Display lock timeout (thumbnail set)");
-                        free(rgb_buf);
-                        rgb_buf = NULL;
-                    }
-                    decode_buf = NULL;
-                    success = true;
-                } else {
-                    ESP_LOGE(TAG, "JPEG decode failed: %s", esp_err_to_name(err));
-                }
-            }
-            if (decode_buf) free(decode_buf);
-        }
+    jpeg_service_frame_t frame;
+    perf_span_t jpeg_decode_span = perf_timer_start();
+    esp_err_t err = jpeg_service_decode(jpeg_buf, jpeg_size, &frame);
+    perf_timer_stop(&g_perf.jpeg_decode, jpeg_decode_span);
+    free(jpeg_buf);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "JPEG decode failed: %s", esp_err_to_name(err));
+        return false;
     }
 
-    free(jpeg_buf);
-    return success;
+    ESP_LOGI(TAG, "JPEG decoded: %lux%lu %s -> %lu bytes",
+        (unsigned long)frame.width, (unsigned long)frame.height,
+        frame.gray ? "gray" : "color", (unsigned long)frame.out_size);
+    if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
+        uint32_t out_w = frame.stride_w, out_h = frame.stride_h, out_size = frame.out_size;
+        nina_dashboard_set_thumbnail(jpeg_service_take(&frame), out_w, out_h, out_size);
+        bsp_display_unlock();
+    } else {
+        ESP_LOGW(TAG, "Display lock timeout (thumbnail set)");
+        jpeg_service_release(&frame);
+    }
+    return true;
 }
 
 // =============================================================================
@@ -224,6 +139,23 @@ bool jpeg_sw_decode_rgb565(const uint8_t *jpg_data, size_t jpg_size,
 // PPA Hardware Image Scaling
 // =============================================================================
 
+/* Lazy-init the shared PPA SRM client. */
+static bool ppa_srm_client_ready(void)
+{
+    if (s_ppa_srm_client) return true;
+
+    ppa_client_config_t cfg = {
+        .oper_type = PPA_OPERATION_SRM,
+        .max_pending_trans_num = 1,
+    };
+    if (ppa_register_client(&cfg, &s_ppa_srm_client) != ESP_OK) {
+        ESP_LOGE(TAG, "PPA SRM client registration failed");
+        return false;
+    }
+    ESP_LOGI(TAG, "PPA SRM client registered for image scaling");
+    return true;
+}
+
 uint8_t *ppa_scale_rgb565(const uint8_t *src, uint32_t src_w, uint32_t src_h,
                            uint32_t src_stride,
                            uint32_t dst_w, uint32_t dst_h, size_t *out_size)
@@ -231,18 +163,7 @@ uint8_t *ppa_scale_rgb565(const uint8_t *src, uint32_t src_w, uint32_t src_h,
     if (!src || src_w == 0 || src_h == 0 || dst_w == 0 || dst_h == 0) return NULL;
     if (src_stride == 0) src_stride = src_w;
 
-    /* Lazy-init PPA SRM client */
-    if (!s_ppa_srm_client) {
-        ppa_client_config_t cfg = {
-            .oper_type = PPA_OPERATION_SRM,
-            .max_pending_trans_num = 1,
-        };
-        if (ppa_register_client(&cfg, &s_ppa_srm_client) != ESP_OK) {
-            ESP_LOGE(TAG, "PPA SRM client registration failed");
-            return NULL;
-        }
-        ESP_LOGI(TAG, "PPA SRM client registered for image scaling");
-    }
+    if (!ppa_srm_client_ready()) return NULL;
 
     /* Output buffer: 128-byte aligned address and size (L2 cache line requirement) */
     size_t buf_size = dst_w * dst_h * 2;  /* RGB565 = 2 bytes/pixel */
@@ -328,18 +249,7 @@ static uint8_t *ppa_scale_rgb565_into_core(const uint8_t *src, uint32_t src_w, u
         return NULL;
     }
 
-    /* Lazy-init PPA SRM client */
-    if (!s_ppa_srm_client) {
-        ppa_client_config_t cfg = {
-            .oper_type = PPA_OPERATION_SRM,
-            .max_pending_trans_num = 1,
-        };
-        if (ppa_register_client(&cfg, &s_ppa_srm_client) != ESP_OK) {
-            ESP_LOGE(TAG, "PPA SRM client registration failed");
-            return NULL;
-        }
-        ESP_LOGI(TAG, "PPA SRM client registered for image scaling");
-    }
+    if (!ppa_srm_client_ready()) return NULL;
 
     /* Zero the destination to clear any stale data. Skippable when the caller
      * guarantees the transfer overwrites every output pixel (exact integer
@@ -421,3 +331,61 @@ uint8_t *ppa_scale_rgb565_into_noclear(const uint8_t *src, uint32_t src_w, uint3
                                       dst_w, dst_h, dst_buf, dst_buf_size,
                                       out_size, false, true);
 }
+
+uint8_t *ppa_rotate180_rgb565_into(const uint8_t *src, uint32_t pic_w, uint32_t pic_h,
+                                   uint32_t block_x, uint32_t block_y,
+                                   uint32_t block_w, uint32_t block_h,
+                                   uint8_t *dst_buf, size_t dst_buf_size)
+{
+    if (!src || !dst_buf || block_w == 0 || block_h == 0 ||
+        block_x + block_w > pic_w || block_y + block_h > pic_h) return NULL;
+
+    size_t needed = block_w * block_h * 2;
+    needed = (needed + 127) & ~(size_t)127;
+    if (needed > dst_buf_size) {
+        ESP_LOGE(TAG, "Pre-allocated buffer too small: need %zu, have %zu", needed, dst_buf_size);
+        return NULL;
+    }
+
+    if (!ppa_srm_client_ready()) return NULL;
+
+    /* Mirroring both axes is a 180 degree turn whatever order the SRM applies
+     * them in, so no rotation angle (and its direction convention) is needed. */
+    ppa_srm_oper_config_t srm = {
+        .in = {
+            .buffer = src,
+            .pic_w = pic_w,
+            .pic_h = pic_h,
+            .block_w = block_w,
+            .block_h = block_h,
+            .block_offset_x = block_x,
+            .block_offset_y = block_y,
+            .srm_cm = PPA_SRM_COLOR_MODE_RGB565,
+        },
+        .out = {
+            .buffer = dst_buf,
+            .buffer_size = needed,
+            .pic_w = block_w,
+            .pic_h = block_h,
+            .block_offset_x = 0,
+            .block_offset_y = 0,
+            .srm_cm = PPA_SRM_COLOR_MODE_RGB565,
+        },
+        .rotation_angle = PPA_SRM_ROTATION_ANGLE_0,
+        .scale_x = 1.0f,
+        .scale_y = 1.0f,
+        .mirror_x = true,
+        .mirror_y = true,
+        .rgb_swap = false,
+        .byte_swap = false,
+        .mode = PPA_TRANS_MODE_BLOCKING,
+    };
+
+    esp_err_t err = ppa_do_scale_rotate_mirror(s_ppa_srm_client, &srm);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "PPA 180 turn %lux%lu failed: %s",
+                 (unsigned long)block_w, (unsigned long)block_h, esp_err_to_name(err));
+        return NULL;
+    }
+    return dst_buf;
+}
@@ -99,3 +99,25 @@ uint8_t *ppa_scale_rgb565_into_noclear(const uint8_t *src, uint32_t src_w, uint3
                                         uint32_t dst_w, uint32_t dst_h,
                                         uint8_t *dst_buf, size_t dst_buf_size,
                                         size_t *out_size);
+
+/**
+ * @brief Turn a block of an RGB565 image by 180 degrees into a pre-allocated
+ * buffer using the PPA hardware (mirror on both axes, no scaling).
+ * Same buffer/alignment requirements as ppa_scale_rgb565_into(); the source
+ * must be cache-synced to PSRAM.
+ *
+ * @param src        Source RGB565 buffer
+ * @param pic_w      Source width (= stride) in pixels
+ * @param pic_h      Source height in pixels
+ * @param block_x    Left edge of the block to turn
+ * @param block_y    Top edge of the block to turn
+ * @param block_w    Block width (output width)
+ * @param block_h    Block height (output height)
+ * @param dst_buf    Destination (128-byte aligned, PSRAM), block_w x block_h
+ * @param dst_buf_size Size of dst_buf in bytes
+ * @return dst_buf on success, NULL on failure (caller should fall back to CPU)
+ */
+uint8_t *ppa_rotate180_rgb565_into(const uint8_t *src, uint32_t pic_w, uint32_t pic_h,
+                                   uint32_t block_x, uint32_t block_y,
+                                   uint32_t block_w, uint32_t block_h,
+                                   uint8_t *dst_buf, size_t dst_buf_size);
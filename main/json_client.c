@@ -3,8 +3,11 @@
  * @brief Generic JSON HTTP client for the JSON Display page.
  *
  * Uses http_fetch's shared fetcher with a module-static keep-alive slot
- * (s_conn). JSON polling is single-owner (only json_poll_task ever calls
- * json_client_poll), so the connection slot needs no locking.
+ * (s_conn). JSON polling is single-owner (only the json poll job ever calls
+ * json_client_poll, and the scheduler never runs a job twice at once), so the
+ * connection slot needs no locking. Polls are
+ * conditional (s_validators): a 304 keeps the published tile values and only
+ * refreshes connected/last_poll_ms.
  *
  * Resolver: C port of the JSON Display mockup tokenizePath()/evalPath().
  * Config cache: mirrors allsky_client.c get_field_config() (parse-once,
@@ -46,10 +49,16 @@ static char  *s_cached_tiles_str = NULL;
 static const char *s_tile_paths[JSON_MAX_TILES];
 static int         s_tile_path_count = 0;
 
-/* Persistent keep-alive slot, owned exclusively by json_poll_task; lazily
+/* Persistent keep-alive slot, owned exclusively by the json poll job; lazily
  * created on first poll. */
 static http_fetch_conn_t *s_conn = NULL;
 
+/* ETag/Last-Modified of the last body, plus a hash of the tiles config and
+ * auth header it was resolved with: a 304 only means "nothing to do" while
+ * those are unchanged too. */
+static http_validator_cache_t *s_validators = NULL;
+static uint64_t s_published_config_hash = 0;
+
 /* Forward declarations (prototype-before-use under -Werror). */
 static bool  cjson_scalar_str(const cJSON *node, char *buf, size_t len);
 static cJSON *json_eval_path(cJSON *root, const char *path);
@@ -339,6 +348,16 @@ void json_client_poll(const char *url, const char *auth_header,
             ESP_LOGW(TAG, "Failed to allocate JSON keep-alive connection slot");
         }
     }
+    if (!s_validators) {
+        s_validators = http_validator_cache_create(2, 0);
+    }
+
+    uint64_t config_hash =
+        http_validator_url_hash(tiles_config_json ? tiles_config_json : "") ^
+        (http_validator_url_hash(auth_header ? auth_header : "") << 1);
+    if (config_hash != s_published_config_hash) {
+        http_validator_forget(s_validators, url);
+    }
 
     bool is_https = (strncasecmp(url, "https", 5) == 0);
 
@@ -353,11 +372,21 @@ void json_client_poll(const char *url, const char *auth_header,
         .max_response_bytes = JSON_RESPONSE_BUF_SIZE,
         .extra_header = (auth_header && auth_header[0] != '\0') ? auth_header : NULL,
         .conn = s_conn,
+        .validators = s_validators,
     };
 
     char *buffer = NULL;
     size_t total_read = 0;
     esp_err_t err = http_fetch_text(url, &opts, &buffer, &total_read);
+    if (err == HTTP_FETCH_NOT_MODIFIED) {
+        if (json_client_lock(data, 200)) {
+            data->connected = true;
+            data->last_poll_ms = esp_timer_get_time() / 1000;
+            json_client_unlock(data);
+        }
+        ESP_LOGD(TAG, "JSON poll OK — not modified");
+        return;
+    }
     if (err != ESP_OK) {
         ESP_LOGW(TAG, "JSON HTTP fetch failed for %s: %s", url, esp_err_to_name(err));
         if (json_client_lock(data, 100)) {
@@ -370,6 +399,7 @@ void json_client_poll(const char *url, const char *auth_header,
     if (total_read == 0) {
         ESP_LOGW(TAG, "JSON: empty response body");
         heap_caps_free(buffer);
+        http_validator_forget(s_validators, url);
         if (json_client_lock(data, 100)) {
             data->connected = false;
             json_client_unlock(data);
@@ -382,6 +412,7 @@ void json_client_poll(const char *url, const char *auth_header,
 
     if (!json) {
         ESP_LOGW(TAG, "JSON: failed to parse response");
+        http_validator_forget(s_validators, url);
         if (json_client_lock(data, 100)) {
             data->connected = false;
             json_client_unlock(data);
@@ -424,8 +455,10 @@ void json_client_poll(const char *url, const char *auth_header,
         memcpy(data->values, local.values, sizeof(data->values));
         memcpy(data->resolved, local.resolved, sizeof(data->resolved));
         json_client_unlock(data);
+        s_published_config_hash = config_hash;
         ESP_LOGD(TAG, "JSON poll OK — %u bytes, %d tiles", (unsigned)total_read, count);
     } else {
         ESP_LOGW(TAG, "JSON: failed to acquire mutex for data update");
+        http_validator_forget(s_validators, url);
     }
 }
@@ -0,0 +1,398 @@
+/*
+ * json_stream.c - Pure, host-testable streaming (SAX-style) JSON extractor.
+ *
+ * Byte-at-a-time state machine; no ESP-IDF dependencies, no dynamic
+ * allocation. See json_stream.h for the event/path contract.
+ */
+
+#include "json_stream.h"
+#include <limits.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    ST_VALUE,    /* expecting a value (or ']' right after '[') */
+    ST_KEY,      /* expecting a member key (or '}' right after '{') */
+    ST_COLON,
+    ST_AFTER,    /* expecting ',' or a closer */
+    ST_STRING,
+    ST_ESC,
+    ST_UNICODE,
+    ST_NUMBER,
+    ST_LITERAL,
+    ST_DONE,     /* complete document seen; only whitespace may follow */
+    ST_ERROR,
+};
+
+static bool is_ws(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static void buf_put(json_stream_t *js, char c) {
+    if (js->buf_len < sizeof(js->buf) - 1) {
+        js->buf[js->buf_len++] = c;
+    } else {
+        js->truncated = true;
+    }
+}
+
+static void buf_append(json_stream_t *js, const char *src, size_t n) {
+    size_t room = sizeof(js->buf) - 1 - js->buf_len;
+    if (n > room) {
+        n = room;
+        js->truncated = true;
+    }
+    memcpy(js->buf + js->buf_len, src, n);
+    js->buf_len += n;
+}
+
+static void buf_start(json_stream_t *js) {
+    js->buf_len = 0;
+    js->truncated = false;
+}
+
+/* Encode one BMP code point as UTF-8. Lone/paired surrogates become '?':
+ * NINA never emits non-BMP text in the fields this extractor reads. */
+static void buf_put_codepoint(json_stream_t *js, unsigned cp) {
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+        buf_put(js, '?');
+    } else if (cp < 0x80) {
+        buf_put(js, (char)cp);
+    } else if (cp < 0x800) {
+        buf_put(js, (char)(0xC0 | (cp >> 6)));
+        buf_put(js, (char)(0x80 | (cp & 0x3F)));
+    } else {
+        buf_put(js, (char)(0xE0 | (cp >> 12)));
+        buf_put(js, (char)(0x80 | ((cp >> 6) & 0x3F)));
+        buf_put(js, (char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+static bool emit(json_stream_t *js, json_stream_event_t ev, const json_stream_value_t *val) {
+    if (js->cb && !js->cb(js, ev, val, js->ctx)) {
+        js->state = ST_ERROR;
+        return false;
+    }
+    return true;
+}
+
+/* A value (scalar or container) just completed at the current depth. */
+static void value_done(json_stream_t *js) {
+    js->just_opened = false;
+    js->state = (js->depth == 0) ? ST_DONE : ST_AFTER;
+}
+
+static bool emit_scalar(json_stream_t *js, json_stream_value_t *v) {
+    if (!emit(js, JSON_STREAM_EV_VALUE, v)) return false;
+    value_done(js);
+    return true;
+}
+
+static bool emit_number(json_stream_t *js) {
+    js->buf[js->buf_len] = '\0';
+    char *end = NULL;
+    double d = strtod(js->buf, &end);
+    if (js->truncated || end != js->buf + js->buf_len) {
+        js->state = ST_ERROR;
+        return false;
+    }
+    json_stream_value_t v = {
+        .type = JSON_STREAM_NUMBER, .str = js->buf, .len = js->buf_len, .num = d,
+    };
+    return emit_scalar(js, &v);
+}
+
+static bool emit_literal(json_stream_t *js) {
+    json_stream_value_t v = { .type = JSON_STREAM_NULL };
+    if (js->lit[0] == 't') {
+        v.type = JSON_STREAM_BOOL;
+        v.boolean = true;
+    } else if (js->lit[0] == 'f') {
+        v.type = JSON_STREAM_BOOL;
+    }
+    return emit_scalar(js, &v);
+}
+
+static bool begin_container(json_stream_t *js, bool is_array) {
+    if (js->depth >= JSON_STREAM_MAX_DEPTH) {
+        js->state = ST_ERROR;
+        return false;
+    }
+    if (!emit(js, is_array ? JSON_STREAM_EV_ARRAY_BEGIN : JSON_STREAM_EV_OBJECT_BEGIN, NULL)) {
+        return false;
+    }
+    json_stream_frame_t *f = &js->frames[js->depth++];
+    f->is_array = is_array;
+    f->index = 0;
+    f->key[0] = '\0';
+    js->just_opened = true;
+    js->state = is_array ? ST_VALUE : ST_KEY;
+    return true;
+}
+
+static bool end_container(json_stream_t *js, bool is_array) {
+    if (js->depth == 0 || js->frames[js->depth - 1].is_array != is_array) {
+        js->state = ST_ERROR;
+        return false;
+    }
+    js->depth--;
+    if (!emit(js, is_array ? JSON_STREAM_EV_ARRAY_END : JSON_STREAM_EV_OBJECT_END, NULL)) {
+        return false;
+    }
+    value_done(js);
+    return true;
+}
+
+static bool step(json_stream_t *js, char c) {
+    switch (js->state) {
+    case ST_VALUE:
+        if (is_ws(c)) return true;
+        if (c == '{') return begin_container(js, false);
+        if (c == '[') return begin_container(js, true);
+        if (c == '"') {
+            js->in_key = false;
+            buf_start(js);
+            js->state = ST_STRING;
+            return true;
+        }
+        if (c == '-' || (c >= '0' && c <= '9')) {
+            buf_start(js);
+            buf_put(js, c);
+            js->state = ST_NUMBER;
+            return true;
+        }
+        if (c == 't' || c == 'f' || c == 'n') {
+            js->lit = (c == 't') ? "true" : (c == 'f') ? "false" : "null";
+            js->lit_pos = 1;
+            js->state = ST_LITERAL;
+            return true;
+        }
+        if (c == ']' && js->just_opened) return end_container(js, true);
+        break;
+
+    case ST_KEY:
+        if (is_ws(c)) return true;
+        if (c == '"') {
+            js->in_key = true;
+            buf_start(js);
+            js->state = ST_STRING;
+            return true;
+        }
+        if (c == '}' && js->just_opened) return end_container(js, false);
+        break;
+
+    case ST_COLON:
+        if (is_ws(c)) return true;
+        if (c == ':') {
+            js->just_opened = false;
+            js->state = ST_VALUE;
+            return true;
+        }
+        break;
+
+    case ST_AFTER:
+        if (is_ws(c)) return true;
+        if (c == ',') {
+            json_stream_frame_t *f = &js->frames[js->depth - 1];
+            if (f->is_array) {
+                f->index++;
+                js->state = ST_VALUE;
+            } else {
+                js->state = ST_KEY;
+            }
+            js->just_opened = false;
+            return true;
+        }
+        if (c == ']') return end_container(js, true);
+        if (c == '}') return end_container(js, false);
+        break;
+
+    case ST_STRING:
+        if (c == '"') {
+            js->buf[js->buf_len] = '\0';
+            if (js->in_key) {
+                json_stream_frame_t *f = &js->frames[js->depth - 1];
+                size_t n = js->buf_len < sizeof(f->key) - 1 ? js->buf_len : sizeof(f->key) - 1;
+                memcpy(f->key, js->buf, n);
+                f->key[n] = '\0';
+                js->state = ST_COLON;
+                return true;
+            }
+            json_stream_value_t v = {
+                .type = JSON_STREAM_STRING, .str = js->buf, .len = js->buf_len,
+                .truncated = js->truncated,
+            };
+            return emit_scalar(js, &v);
+        }
+        if (c == '\\') {
+            js->state = ST_ESC;
+            return true;
+        }
+        if ((unsigned char)c < 0x20) break;
+        buf_put(js, c);
+        return true;
+
+    case ST_ESC:
+        js->state = ST_STRING;
+        switch (c) {
+        case '"': case '\\': case '/': buf_put(js, c); return true;
+        case 'b': buf_put(js, '\b'); return true;
+        case 'f': buf_put(js, '\f'); return true;
+        case 'n': buf_put(js, '\n'); return true;
+        case 'r': buf_put(js, '\r'); return true;
+        case 't': buf_put(js, '\t'); return true;
+        case 'u':
+            js->u_val = 0;
+            js->u_count = 0;
+            js->state = ST_UNICODE;
+            return true;
+        default:
+            break;
+        }
+        break;
+
+    case ST_UNICODE: {
+        unsigned h;
+        if (c >= '0' && c <= '9') h = (unsigned)(c - '0');
+        else if (c >= 'a' && c <= 'f') h = (unsigned)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') h = (unsigned)(c - 'A' + 10);
+        else break;
+        js->u_val = (unsigned short)((js->u_val << 4) | h);
+        if (++js->u_count == 4) {
+            buf_put_codepoint(js, js->u_val);
+            js->state = ST_STRING;
+        }
+        return true;
+    }
+
+    case ST_NUMBER:
+        if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' ||
+            c == '+' || c == '-') {
+            buf_put(js, c);
+            return true;
+        }
+        /* Numbers have no terminator: the first non-number byte ends it and
+         * is then handled by whatever state the value left us in. */
+        if (!emit_number(js)) return false;
+        return step(js, c);
+
+    case ST_LITERAL:
+        if (c != js->lit[js->lit_pos]) break;
+        if (js->lit[++js->lit_pos] == '\0') return emit_literal(js);
+        return true;
+
+    case ST_DONE:
+        if (is_ws(c)) return true;
+        break;
+
+    default:
+        return false;
+    }
+
+    js->state = ST_ERROR;
+    return false;
+}
+
+void json_stream_init(json_stream_t *js, json_stream_cb_t cb, void *ctx) {
+    memset(js, 0, sizeof(*js));
+    js->cb = cb;
+    js->ctx = ctx;
+    js->state = ST_VALUE;
+}
+
+void json_stream_reset(json_stream_t *js) {
+    json_stream_init(js, js->cb, js->ctx);
+    if (js->cb) js->cb(js, JSON_STREAM_EV_RESET, NULL, js->ctx);
+}
+
+bool json_stream_feed(json_stream_t *js, const char *data, size_t len) {
+    if (js->state == ST_ERROR) return false;
+    size_t i = 0;
+    while (i < len) {
+        if (js->state == ST_STRING) {
+            /* Plain string bytes need no per-byte state: copy the run in one go. */
+            size_t end = i;
+            while (end < len) {
+                unsigned char c = (unsigned char)data[end];
+                if (c == '"' || c == '\\' || c < 0x20) break;
+                end++;
+            }
+            buf_append(js, data + i, end - i);
+            i = end;
+            if (i == len) break;
+        }
+        if (!step(js, data[i])) return false;
+        i++;
+    }
+    js->bytes_fed += len;
+    return true;
+}
+
+bool json_stream_finish(json_stream_t *js) {
+    if (js->state == ST_NUMBER && js->depth == 0) {
+        if (!emit_number(js)) return false;
+    }
+    return js->state == ST_DONE;
+}
+
+size_t json_stream_bytes(const json_stream_t *js) {
+    return js->bytes_fed;
+}
+
+int json_stream_value_int(const json_stream_value_t *v) {
+    if (v->type != JSON_STREAM_NUMBER) return 0;
+    double d = v->num;
+    if (d >= INT_MAX) return INT_MAX;
+    if (d <= (double)INT_MIN) return INT_MIN;
+    if (d != d) return 0;
+    return (int)d;
+}
+
+bool json_stream_path_is(const json_stream_t *js, const char *pattern) {
+    int level = 0;
+    const char *p = pattern;
+    while (*p) {
+        if (*p == '.') {
+            p++;
+            continue;
+        }
+        if (level >= js->depth) return false;
+        const json_stream_frame_t *f = &js->frames[level];
+        if (*p == '[') {
+            p++;
+            if (!f->is_array) return false;
+            if (*p != ']') {
+                int n = 0;
+                while (*p >= '0' && *p <= '9') n = n * 10 + (*p++ - '0');
+                if (n != f->index) return false;
+            }
+            if (*p != ']') return false;
+            p++;
+        } else {
+            const char *end = p;
+            while (*end && *end != '.' && *end != '[') end++;
+            size_t n = (size_t)(end - p);
+            if (f->is_array || strlen(f->key) != n || memcmp(f->key, p, n) != 0) {
+                return false;
+            }
+            p = end;
+        }
+        level++;
+    }
+    return level == js->depth;
+}
+
+int json_stream_depth(const json_stream_t *js) {
+    return js->depth;
+}
+
+int json_stream_index_at(const json_stream_t *js, int level) {
+    if (level < 0 || level >= js->depth || !js->frames[level].is_array) return -1;
+    return js->frames[level].index;
+}
+
+const char *json_stream_key_at(const json_stream_t *js, int level) {
+    if (level < 0 || level >= js->depth || js->frames[level].is_array) return NULL;
+    return js->frames[level].key;
+}
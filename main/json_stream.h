@@ -0,0 +1,145 @@
+/*
+ * json_stream.h - Pure, host-testable streaming (SAX-style) JSON extractor.
+ *
+ * Push parser for the NINA poll hot path: the HTTP body is fed in arbitrary
+ * chunks straight from the socket read loop (http_fetch_stream()) and the
+ * caller's callback sees one event per scalar value / container boundary,
+ * together with the current path. Nothing is materialized -- the parser is a
+ * fixed-size struct (no heap), so a multi-hundred-KB /image-history or
+ * /equipment/guider/graph body costs a ~1KB stack frame instead of a cJSON
+ * DOM several times the body size.
+ *
+ * Paths are matched with json_stream_path_is() against a dotted pattern:
+ *   "Response.Camera.Name"              object keys
+ *   "Response.GuideSteps[].RADistanceRaw" any array index
+ *   "Response[0].HFR"                   a specific array index
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Deepest container nesting tracked. Most NINA poll endpoints nest at most 5
+ * levels (bundle -> Switch -> ReadonlySwitches[] -> {}), but /sequence/json
+ * adds two per sequence container (Items -> [n]), so 24 covers about ten
+ * container levels with their triggers. Deeper documents fail with a syntax
+ * error rather than silently mis-reporting paths. */
+#define JSON_STREAM_MAX_DEPTH 24
+
+/* Object keys longer than this (incl. NUL) are truncated for matching. */
+#define JSON_STREAM_KEY_MAX 40
+
+/* String values longer than this (incl. NUL) are truncated; see
+ * json_stream_value_t.truncated. Sized for ISO-8601 timestamps, device and
+ * filter names -- not for free-text blobs. */
+#define JSON_STREAM_STR_MAX 128
+
+typedef enum {
+    JSON_STREAM_EV_VALUE,        /* scalar; path names the value itself */
+    JSON_STREAM_EV_OBJECT_BEGIN, /* path names the object being opened */
+    JSON_STREAM_EV_OBJECT_END,   /* path names the object being closed */
+    JSON_STREAM_EV_ARRAY_BEGIN,
+    JSON_STREAM_EV_ARRAY_END,
+    JSON_STREAM_EV_RESET,        /* json_stream_reset(): discard partial state
+                                  * (e.g. a transport retry restarts the body) */
+} json_stream_event_t;
+
+typedef enum {
+    JSON_STREAM_NULL,
+    JSON_STREAM_BOOL,
+    JSON_STREAM_NUMBER,
+    JSON_STREAM_STRING,
+} json_stream_type_t;
+
+typedef struct {
+    json_stream_type_t type;
+    const char *str;    /* STRING: unescaped, NUL-terminated; NUMBER: raw text */
+    size_t len;
+    double num;         /* NUMBER */
+    bool boolean;       /* BOOL */
+    bool truncated;     /* STRING exceeded JSON_STREAM_STR_MAX - 1 bytes */
+} json_stream_value_t;
+
+typedef struct json_stream json_stream_t;
+
+/* Return false to abort the parse (json_stream_feed() then returns false). */
+typedef bool (*json_stream_cb_t)(json_stream_t *js, json_stream_event_t ev,
+                                 const json_stream_value_t *val, void *ctx);
+
+typedef struct {
+    bool is_array;
+    int index;                      /* array: current element index */
+    char key[JSON_STREAM_KEY_MAX];  /* object: current member key */
+} json_stream_frame_t;
+
+/* Treat as opaque; exposed only so callers can place it on the stack. */
+struct json_stream {
+    json_stream_cb_t cb;
+    void *ctx;
+    json_stream_frame_t frames[JSON_STREAM_MAX_DEPTH];
+    int depth;
+    unsigned char state;
+    unsigned char lit_pos;
+    bool in_key;
+    bool just_opened;
+    bool truncated;
+    bool done;
+    unsigned short u_val;
+    unsigned char u_count;
+    const char *lit;
+    size_t buf_len;
+    size_t bytes_fed;
+    char buf[JSON_STREAM_STR_MAX];
+};
+
+/* Initialise @p js. @p cb may be NULL (syntax-check only). */
+void json_stream_init(json_stream_t *js, json_stream_cb_t cb, void *ctx);
+
+/* Restart at the top of a new document, keeping cb/ctx. Emits
+ * JSON_STREAM_EV_RESET so the callback can drop any partial results. */
+void json_stream_reset(json_stream_t *js);
+
+/* Feed the next @p len bytes. Returns false on a syntax error, on a callback
+ * abort, or on bytes after a complete document (other than whitespace);
+ * once false, further calls keep returning false until reset. */
+bool json_stream_feed(json_stream_t *js, const char *data, size_t len);
+
+/* Signal end of input. Flushes a trailing top-level number and returns true
+ * iff exactly one complete, well-formed document was seen. */
+bool json_stream_finish(json_stream_t *js);
+
+/* Total bytes accepted since init/reset. */
+size_t json_stream_bytes(const json_stream_t *js);
+
+/* @p v as an int, clamped to [INT_MIN, INT_MAX] (NaN reads as 0) so an
+ * out-of-range number from the peer never hits an undefined conversion.
+ * A non-number reads as 0, like cJSON's valueint. */
+int json_stream_value_int(const json_stream_value_t *v);
+
+/* Match the current event's path against @p pattern (see file header). */
+bool json_stream_path_is(const json_stream_t *js, const char *pattern);
+
+/* Nesting depth of the current event's path (number of path segments). */
+int json_stream_depth(const json_stream_t *js);
+
+/* Array index at path segment @p level (0-based), or -1 if that segment is
+ * not an array element. */
+int json_stream_index_at(const json_stream_t *js, int level);
+
+/* Key at path segment @p level, or NULL if that segment is an array element. */
+const char *json_stream_key_at(const json_stream_t *js, int level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSON_STREAM_H */
@@ -2,12 +2,17 @@
 
 /**
  * @file log_capture.h
- * @brief Boot log capture into a bounded PSRAM circular buffer.
+ * @brief Boot log capture into bounded per-core PSRAM record rings.
  *
  * Hooks the ESP-IDF logging vprintf so everything printed to the console since
- * boot is also copied into a fixed-size circular byte buffer in PSRAM. The hook
- * chains to the original vprintf, so the serial console and `idf.py monitor`
- * are unaffected. When the buffer fills, the oldest bytes are overwritten.
+ * boot is also kept in PSRAM. The hook chains to the original vprintf, so the
+ * serial console and `idf.py monitor` are unaffected.
+ *
+ * Lines are not formatted at log time: each one is stored as a compact binary
+ * record (timestamp, format pointer, arguments; see log_ring.h) in the ring of
+ * the core that logged it, without taking a lock, and text is produced only
+ * when a reader walks the rings. When a ring fills, its oldest records are
+ * overwritten.
  *
  * Memory is a single fixed allocation made once at init; it never grows,
  * regardless of uptime or log volume. If the PSRAM allocation fails, capture
@@ -18,11 +23,16 @@
 #include <stddef.h>
 #include <stdbool.h>
 
-/* Fixed circular buffer size: 512 KB, PSRAM-allocated. */
+#include "log_ring.h"
+
+/* Fixed PSRAM budget for all rings together: 512 KB, split evenly per core. */
 #define LOG_CAPTURE_SIZE (512 * 1024)
 
+/* Read position over the captured log; see log_capture_open(). */
+typedef log_ring_reader_t log_capture_cursor_t;
+
 /**
- * @brief Allocate the PSRAM ring and install the vprintf hook.
+ * @brief Allocate the PSRAM rings and install the vprintf hook.
  *
  * Safe to call once early in app_main(). On allocation failure, logs one
  * warning and leaves the original logging path intact (capture disabled).
@@ -32,31 +42,34 @@ void log_capture_init(void);
 /**
  * @brief vprintf hook installed via esp_log_set_vprintf().
  *
- * Formats the line into a small stack buffer, copies it into the ring under a
- * spinlock, then chains to the original vprintf and returns its result.
+ * Appends the line's binary record to the current core's ring, then chains
+ * to the original vprintf and returns its result.
  */
 int log_capture_vprintf(const char *fmt, va_list args);
 
 /**
- * @brief Copy up to @p max_len bytes of captured log, oldest-first, into @p dst.
- *
- * Reads starting at logical byte offset @p offset (0 = oldest valid byte). The
- * ring is locked only for the duration of the copy, not across an entire HTTP
- * send, so callers stream by calling repeatedly with an advancing offset.
+ * @brief Position @p cur at the start of the captured log.
  *
- * @param offset   Logical offset from the oldest valid byte.
- * @param dst      Destination buffer.
- * @param max_len  Capacity of @p dst.
- * @return Number of bytes copied (0 when @p offset is at or past the end).
+ * @param cur         Cursor to initialise (large; keep it off small stacks).
+ * @param tail_bytes  0 for the whole log, else start at the oldest line such
+ *                    that the formatted log from there fits in this many
+ *                    bytes (always on a line boundary).
+ * @return false when capture is disabled (nothing to read).
  */
-size_t log_capture_read(size_t offset, char *dst, size_t max_len);
+bool log_capture_open(log_capture_cursor_t *cur, size_t tail_bytes);
 
 /**
- * @brief Reset the ring to empty.
+ * @brief Format the next whole lines, oldest first, into @p dst.
+ *
+ * Rings are never locked; callers stream by calling repeatedly. Lines logged
+ * after log_capture_open() are returned as well.
+ *
+ * @param max_len  Capacity of @p dst; at least LOG_RING_LINE_MAX.
+ * @return Number of bytes written (0 once the cursor has caught up).
  */
-void log_capture_clear(void);
+size_t log_capture_read(log_capture_cursor_t *cur, char *dst, size_t max_len);
 
 /**
- * @brief Current number of valid (readable) bytes in the ring.
+ * @brief Hide everything captured so far from subsequent reads.
  */
-size_t log_capture_size(void);
+void log_capture_clear(void);
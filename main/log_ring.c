@@ -0,0 +1,604 @@
+/*
+ * log_ring.c - Lock-free binary log record ring (see log_ring.h).
+ */
+
+#include "log_ring.h"
+
+#include <stdio.h>
+#include <string.h>
+
+_Static_assert(LOG_RING_PAYLOAD_MAX >= 2 + LOG_RING_LINE_MAX,
+               "a preformatted line must fit in one record");
+
+#define KIND_FMT    0x00    /* format pointer + encoded arguments */
+#define KIND_TEXT   0x80    /* uint16 length + preformatted bytes */
+#define NSLOTS_MASK 0x7F    /* header byte 0: nslots | kind */
+
+/* Longest %s argument copied into a record; longer ones make the line text. */
+#define STR_COPY_MAX 254
+
+#define SPEC_MAX    24  /* longest conversion spec, e.g. "%-08.3lld" */
+
+typedef enum {
+    ARG_NONE,       /* %% */
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_INTMAX,
+    ARG_SIZE,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_STR,
+    ARG_PTR,
+    ARG_BAD,        /* not encodable: the line is stored as text */
+} arg_type_t;
+
+typedef struct {
+    size_t len;         /* bytes from '%' through the conversion character */
+    int stars;          /* '*' width / precision arguments (0..2) */
+    bool prec_star;     /* precision is the last '*' argument */
+    int prec;           /* literal precision, -1 when absent */
+    bool is_signed;     /* %d / %i: integer stored zigzag */
+    arg_type_t type;
+} spec_t;
+
+enum { REC_OK, REC_SKIP, REC_GONE, REC_END };
+
+/* ── Format conversions ────────────────────────────────────────────── */
+
+static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+/* Parse the conversion starting at the '%' at @p p. Returns the character
+ * after it, or NULL if the format ends inside the conversion. */
+static const char *parse_spec(const char *p, spec_t *s)
+{
+    const char *q = p + 1;
+    s->stars = 0;
+    s->prec_star = false;
+    s->prec = -1;
+
+    while (*q == '-' || *q == '+' || *q == ' ' || *q == '#' || *q == '0') q++;
+    if (*q == '*') {
+        s->stars++;
+        q++;
+    } else {
+        while (is_digit(*q)) q++;
+    }
+    if (*q == '.') {
+        q++;
+        if (*q == '*') {
+            s->stars++;
+            s->prec_star = true;
+            q++;
+        } else {
+            int v = 0;
+            while (is_digit(*q)) v = v * 10 + (*q++ - '0');
+            s->prec = v;
+        }
+    }
+
+    char lmod = 0;      /* 'H' = hh, 'q' = ll */
+    if (*q == 'h') {
+        lmod = *q++;
+        if (*q == 'h') { lmod = 'H'; q++; }
+    } else if (*q == 'l') {
+        lmod = *q++;
+        if (*q == 'l') { lmod = 'q'; q++; }
+    } else if (*q == 'j' || *q == 'z' || *q == 't' || *q == 'L') {
+        lmod = *q++;
+    }
+
+    char c = *q;
+    if (c == '\0') return NULL;
+    q++;
+    s->len = (size_t)(q - p);
+    s->is_signed = (c == 'd' || c == 'i');
+
+    switch (c) {
+    case '%':
+        s->type = ARG_NONE;
+        break;
+    case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+        switch (lmod) {
+        case 0: case 'h': case 'H': s->type = ARG_INT;     break;
+        case 'l':                   s->type = ARG_LONG;    break;
+        case 'q':                   s->type = ARG_LLONG;   break;
+        case 'j':                   s->type = ARG_INTMAX;  break;
+        case 'z':                   s->type = ARG_SIZE;    break;
+        case 't':                   s->type = ARG_PTRDIFF; break;
+        default:                    s->type = ARG_BAD;     break;
+        }
+        break;
+    case 'c':
+        s->type = lmod ? ARG_BAD : ARG_INT;
+        break;
+    case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+        s->type = (lmod == 0 || lmod == 'l') ? ARG_DOUBLE : ARG_BAD;
+        break;
+    case 's':
+        s->type = lmod ? ARG_BAD : ARG_STR;
+        break;
+    case 'p':
+        s->type = ARG_PTR;
+        break;
+    default:
+        s->type = ARG_BAD;
+        break;
+    }
+    if (s->len >= SPEC_MAX) s->type = ARG_BAD;
+    return q;
+}
+
+/* ── Encoding ──────────────────────────────────────────────────────── */
+
+/* Integers are stored as LEB128 varints, signed ones zigzag-folded first, so
+ * the small counts and millisecond stamps that fill most lines take one to
+ * four bytes whatever their C type. Static strings are stored as the varint
+ * distance from the format pointer: a TAG usually sits next to the format in
+ * the same .rodata. */
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    bool ok;
+} enc_t;
+
+static void put(enc_t *e, const void *src, size_t n)
+{
+    if (!e->ok || e->len + n > LOG_RING_PAYLOAD_MAX) {
+        e->ok = false;
+        return;
+    }
+    memcpy(e->buf + e->len, src, n);
+    e->len += n;
+}
+
+static void put_varint(enc_t *e, uint64_t v)
+{
+    uint8_t b[10];
+    size_t n = 0;
+    do {
+        uint8_t x = v & 0x7F;
+        v >>= 7;
+        b[n++] = x | (v ? 0x80 : 0);
+    } while (v);
+    put(e, b, n);
+}
+
+static inline uint64_t zigzag(int64_t v)
+{
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t unzigzag(uint64_t v)
+{
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+/* Read an integer argument of unsigned type UT (signed counterpart ST). */
+#define INT_ARG(UT, ST) (s.is_signed ? zigzag((int64_t)(ST)va_arg(ap, UT)) \
+                                     : (uint64_t)va_arg(ap, UT))
+
+#define PUT_ARG(e, ap, type) do { type v_ = va_arg(ap, type); put(e, &v_, sizeof(v_)); } while (0)
+
+/* Encode the format pointer and every argument into @p buf. Returns the
+ * payload length, or 0 if the line has to be stored as text. */
+static size_t encode(uint8_t *buf, log_ring_static_fn is_static, const char *fmt, va_list ap)
+{
+    enc_t e = { buf, 0, true };
+    put(&e, &fmt, sizeof(fmt));
+
+    const char *p = strchr(fmt, '%');
+    while (p && e.ok) {
+        spec_t s;
+        const char *q = parse_spec(p, &s);
+        if (!q || s.type == ARG_BAD) return 0;
+
+        int star[2] = { 0, 0 };
+        for (int i = 0; i < s.stars; i++) {
+            star[i] = va_arg(ap, int);
+            put_varint(&e, zigzag(star[i]));
+        }
+
+        switch (s.type) {
+        case ARG_INT:     put_varint(&e, INT_ARG(unsigned int, int));             break;
+        case ARG_LONG:    put_varint(&e, INT_ARG(unsigned long, long));           break;
+        case ARG_LLONG:   put_varint(&e, INT_ARG(unsigned long long, long long)); break;
+        case ARG_INTMAX:  put_varint(&e, INT_ARG(uintmax_t, intmax_t));          break;
+        case ARG_SIZE:    put_varint(&e, INT_ARG(size_t, ptrdiff_t));            break;
+        case ARG_PTRDIFF: put_varint(&e, INT_ARG(size_t, ptrdiff_t));            break;
+        case ARG_DOUBLE:  PUT_ARG(&e, ap, double);                                break;
+        case ARG_PTR:     PUT_ARG(&e, ap, void *);                                break;
+        case ARG_STR: {
+            const char *str = va_arg(ap, const char *);
+            if (str == NULL || (is_static && is_static(str))) {
+                int64_t delta = (int64_t)((intptr_t)str - (intptr_t)fmt);
+                put_varint(&e, (zigzag(delta) << 1) | 1);
+                break;
+            }
+            int prec = s.prec_star ? star[s.stars - 1] : s.prec;
+            size_t lim = (prec >= 0 && prec <= STR_COPY_MAX) ? (size_t)prec : STR_COPY_MAX + 1;
+            size_t n = strnlen(str, lim);
+            if (n > STR_COPY_MAX) return 0;
+            put_varint(&e, (uint64_t)n << 1);
+            put(&e, str, n);
+            break;
+        }
+        default:
+            break;
+        }
+        p = strchr(q, '%');
+    }
+    return e.ok ? e.len : 0;
+}
+
+/* ── Decoding ──────────────────────────────────────────────────────── */
+
+#define GET_ARG(v) do {                                    \
+        if (a + sizeof(v) > end) goto done;                \
+        memcpy(&(v), a, sizeof(v));                        \
+        a += sizeof(v);                                    \
+    } while (0)
+
+#define GET_VARINT(v) do {                                 \
+        (v) = 0;                                           \
+        for (int sh_ = 0;; sh_ += 7) {                     \
+            if (a >= end || sh_ > 63) goto done;           \
+            uint8_t b_ = *a++;                             \
+            (v) |= (uint64_t)(b_ & 0x7F) << sh_;           \
+            if (!(b_ & 0x80)) break;                       \
+        }                                                  \
+    } while (0)
+
+#define EMIT(v) (s.stars == 0 ? snprintf(d, c, spec, v) :                 \
+                 s.stars == 1 ? snprintf(d, c, spec, star[0], v) :        \
+                                snprintf(d, c, spec, star[0], star[1], v))
+
+size_t log_ring_format(const log_ring_rec_t *rec, char *dst, size_t cap)
+{
+    if (!rec || !dst || cap == 0) return 0;
+    if (cap > LOG_RING_LINE_MAX) cap = LOG_RING_LINE_MAX;
+
+    size_t out = 0;
+    if (rec->kind == KIND_TEXT) {
+        uint16_t n;
+        memcpy(&n, rec->payload, sizeof(n));
+        out = n < cap - 1 ? n : cap - 1;
+        memcpy(dst, rec->payload + sizeof(n), out);
+        dst[out] = '\0';
+        return out;
+    }
+
+    const uint8_t *a = rec->payload;
+    const uint8_t *end = rec->payload + LOG_RING_PAYLOAD_MAX;
+    const char *fmt;
+    memcpy(&fmt, a, sizeof(fmt));
+    a += sizeof(fmt);
+
+    const char *p = fmt;
+    while (*p && out + 1 < cap) {
+        if (*p != '%') {
+            const char *pct = strchr(p, '%');
+            size_t n = pct ? (size_t)(pct - p) : strlen(p);
+            size_t room = cap - 1 - out;
+            memcpy(dst + out, p, n < room ? n : room);
+            out += n < room ? n : room;
+            p += n;
+            continue;
+        }
+
+        spec_t s;
+        const char *q = parse_spec(p, &s);
+        if (!q || s.type == ARG_BAD) break;   /* the encoder never stores these */
+
+        char spec[SPEC_MAX];
+        memcpy(spec, p, s.len);
+        spec[s.len] = '\0';
+        int star[2] = { 0, 0 };
+        for (int i = 0; i < s.stars; i++) {
+            uint64_t v;
+            GET_VARINT(v);
+            star[i] = (int)unzigzag(v);
+        }
+
+        uint64_t iv = 0;
+        if (s.type >= ARG_INT && s.type <= ARG_PTRDIFF) {
+            GET_VARINT(iv);
+            if (s.is_signed) iv = (uint64_t)unzigzag(iv);
+        }
+
+        char *d = dst + out;
+        size_t c = cap - out;
+        int n = 0;
+        switch (s.type) {
+        case ARG_NONE:
+            *d = '%';
+            n = 1;
+            break;
+        case ARG_INT:     n = EMIT((unsigned int)iv);       break;
+        case ARG_LONG:    n = EMIT((unsigned long)iv);      break;
+        case ARG_LLONG:   n = EMIT((unsigned long long)iv); break;
+        case ARG_INTMAX:  n = EMIT((uintmax_t)iv);          break;
+        case ARG_SIZE:    n = EMIT((size_t)iv);             break;
+        case ARG_PTRDIFF: n = EMIT((ptrdiff_t)iv);          break;
+        case ARG_DOUBLE:  { double v; GET_ARG(v); n = EMIT(v); break; }
+        case ARG_PTR:     { void *v;  GET_ARG(v); n = EMIT(v); break; }
+        case ARG_STR: {
+            uint64_t h;
+            GET_VARINT(h);
+            if (h & 1) {
+                const char *v = (const char *)((intptr_t)fmt + (intptr_t)unzigzag(h >> 1));
+                n = EMIT(v);
+            } else {
+                char v[STR_COPY_MAX + 1];
+                size_t m = (size_t)(h >> 1);
+                if (m > STR_COPY_MAX || a + m > end) goto done;
+                memcpy(v, a, m);
+                v[m] = '\0';
+                a += m;
+                n = EMIT(v);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (n > 0) out += (size_t)n < c ? (size_t)n : c - 1;
+        p = q;
+    }
+
+done:
+    dst[out] = '\0';
+    return out;
+}
+
+/* ── Ring ──────────────────────────────────────────────────────────── */
+
+/* Stamp of slot @p seq: its lap (mod 128) and whether it starts a record.
+ * Inside the live window a slot holds either this lap's stamp or an older
+ * one, so comparing the low lap bits is enough. */
+static inline uint8_t stamp_of(const log_ring_t *r, uint32_t seq, bool first)
+{
+    return (uint8_t)((((seq >> r->lap_shift) & 0x7F) << 1) | (first ? 1 : 0));
+}
+
+/* Time order that survives the 49-day wrap of the millisecond clock. */
+static inline bool time_before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+bool log_ring_init(log_ring_t *r, log_ring_slot_t *slots, uint32_t n_slots)
+{
+    if (!r || !slots || n_slots < 2 * LOG_RING_MAX_SLOTS || (n_slots & (n_slots - 1)))
+        return false;
+    r->slots = slots;
+    r->n_slots = n_slots;
+    r->lap_shift = 0;
+    while ((1u << r->lap_shift) < n_slots) r->lap_shift++;
+    /* A first-slot stamp is always odd, so zeroed slots read as empty. */
+    for (uint32_t i = 0; i < n_slots; i++)
+        atomic_init(&slots[i].stamp, 0);
+    atomic_init(&r->head, 0);
+    atomic_init(&r->floor, 0);
+    atomic_init(&r->text_records, 0);
+    return true;
+}
+
+void log_ring_clear(log_ring_t *r)
+{
+    if (!r || !r->slots) return;
+    atomic_store_explicit(&r->floor, atomic_load_explicit(&r->head, memory_order_relaxed),
+                          memory_order_relaxed);
+}
+
+/* Oldest sequence number that can still hold a live record. */
+static uint32_t window_start(const log_ring_t *r)
+{
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+    uint32_t floor = atomic_load_explicit(&r->floor, memory_order_relaxed);
+    return (head - floor <= r->n_slots) ? floor : head - r->n_slots;
+}
+
+static void commit(log_ring_t *r, uint8_t *rec, size_t payload_len)
+{
+    size_t total = LOG_RING_HDR_BYTES + payload_len;
+    uint32_t k = (uint32_t)((total + LOG_RING_SLOT_DATA - 1) / LOG_RING_SLOT_DATA);
+    uint32_t mask = r->n_slots - 1;
+    rec[0] |= (uint8_t)k;
+
+    /* Reserve, then make the reservation visible before any slot is touched:
+     * a reader that copied a byte of ours sees the head past its record. */
+    uint32_t seq = atomic_fetch_add_explicit(&r->head, k, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    for (uint32_t i = 0; i < k; i++) {
+        log_ring_slot_t *slot = &r->slots[(seq + i) & mask];
+        size_t off = (size_t)i * LOG_RING_SLOT_DATA;
+        size_t n = total - off < LOG_RING_SLOT_DATA ? total - off : LOG_RING_SLOT_DATA;
+        memcpy(slot->data, rec + off, n);
+        if (i) atomic_store_explicit(&slot->stamp, stamp_of(r, seq + i, false), memory_order_relaxed);
+    }
+    atomic_store_explicit(&r->slots[seq & mask].stamp, stamp_of(r, seq, true), memory_order_release);
+}
+
+void log_ring_vwrite(log_ring_t *r, uint32_t time_ms, log_ring_static_fn is_static,
+                     const char *fmt, va_list args)
+{
+    if (!r || !r->slots || !fmt) return;
+
+    uint8_t rec[LOG_RING_MAX_SLOTS * LOG_RING_SLOT_DATA];
+    uint8_t *payload = rec + LOG_RING_HDR_BYTES;
+    size_t len = 0;
+
+    rec[0] = KIND_FMT;
+    for (int i = 0; i < 4; i++) rec[1 + i] = (uint8_t)(time_ms >> (8 * i));
+
+    if (is_static && is_static(fmt)) {
+        va_list ap;
+        va_copy(ap, args);
+        len = encode(payload, is_static, fmt, ap);
+        va_end(ap);
+    }
+    if (len == 0) {
+        va_list ap;
+        va_copy(ap, args);
+        int n = vsnprintf((char *)payload + sizeof(uint16_t), LOG_RING_LINE_MAX, fmt, ap);
+        va_end(ap);
+        if (n <= 0) return;
+        uint16_t tl = (uint16_t)(n < LOG_RING_LINE_MAX ? n : LOG_RING_LINE_MAX - 1);
+        memcpy(payload, &tl, sizeof(tl));
+        len = sizeof(tl) + tl;
+        rec[0] = KIND_TEXT;
+        atomic_fetch_add_explicit(&r->text_records, 1, memory_order_relaxed);
+    }
+    commit(r, rec, len);
+}
+
+/* Copy the record starting at @p seq. REC_SKIP: no committed record starts
+ * there; REC_GONE: @p seq fell out of the ring; REC_END: @p seq is the head. */
+static int read_record(const log_ring_t *r, uint32_t seq, log_ring_rec_t *rec)
+{
+    uint32_t mask = r->n_slots - 1;
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+    if ((int32_t)(head - seq) <= 0) return REC_END;
+    if (head - seq > r->n_slots) return REC_GONE;
+
+    const log_ring_slot_t *first = &r->slots[seq & mask];
+    if (atomic_load_explicit(&first->stamp, memory_order_acquire) != stamp_of(r, seq, true))
+        return REC_SKIP;
+
+    uint8_t hdr[LOG_RING_HDR_BYTES];
+    memcpy(hdr, first->data, sizeof(hdr));
+    uint32_t k = hdr[0] & NSLOTS_MASK;
+    bool sane = k >= 1 && k <= LOG_RING_MAX_SLOTS && k <= head - seq;
+    if (sane) {
+        memcpy(rec->payload, first->data + LOG_RING_HDR_BYTES,
+               LOG_RING_SLOT_DATA - LOG_RING_HDR_BYTES);
+        for (uint32_t i = 1; i < k; i++) {
+            memcpy(rec->payload + i * LOG_RING_SLOT_DATA - LOG_RING_HDR_BYTES,
+                   r->slots[(seq + i) & mask].data, LOG_RING_SLOT_DATA);
+        }
+    }
+
+    /* Seqlock check: if a writer reserved any of these slots for the next lap
+     * while we copied, the copy may be torn. */
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&r->head, memory_order_relaxed) - seq > r->n_slots)
+        return REC_GONE;
+    if (!sane) return REC_SKIP;
+
+    rec->seq = seq;
+    rec->nslots = k;
+    rec->kind = hdr[0] & KIND_TEXT;
+    rec->time_ms = 0;
+    for (int i = 0; i < 4; i++) rec->time_ms |= (uint32_t)hdr[1 + i] << (8 * i);
+    return REC_OK;
+}
+
+/* Next record at or after rd->next[i] into rd->pend[i]. */
+static void reader_fill(log_ring_reader_t *rd, int i)
+{
+    const log_ring_t *r = rd->rings[i];
+    rd->has[i] = false;
+    for (;;) {
+        switch (read_record(r, rd->next[i], &rd->pend[i])) {
+        case REC_OK:
+            rd->next[i] += rd->pend[i].nslots;
+            rd->has[i] = true;
+            return;
+        case REC_SKIP:
+            rd->next[i]++;
+            break;
+        case REC_GONE:
+            rd->next[i] = window_start(r);
+            break;
+        default:
+            return;
+        }
+    }
+}
+
+/* Nearest record starting below *pos and at or above @p lo; moves *pos to it. */
+static bool prev_record(const log_ring_t *r, uint32_t lo, uint32_t *pos, log_ring_rec_t *rec)
+{
+    while ((int32_t)(*pos - lo) > 0) {
+        uint32_t s = *pos - 1;
+        int st = read_record(r, s, rec);
+        *pos = s;
+        if (st == REC_OK) return true;
+        if (st == REC_GONE) return false;
+    }
+    return false;
+}
+
+void log_ring_reader_init(log_ring_reader_t *rd, log_ring_t *const *rings,
+                          int n_rings, size_t tail_bytes)
+{
+    if (!rd) return;
+    if (n_rings > LOG_RING_MAX_RINGS) n_rings = LOG_RING_MAX_RINGS;
+    rd->n_rings = 0;
+    for (int i = 0; rings && i < n_rings; i++) {
+        if (!rings[i] || !rings[i]->slots) continue;
+        int j = rd->n_rings++;
+        rd->rings[j] = rings[i];
+        rd->next[j] = window_start(rings[i]);
+        rd->has[j] = false;
+    }
+    if (tail_bytes == 0) return;
+
+    /* Walk back from the newest line, merging by time, until the tail is
+     * full; each ring then starts at its oldest line that made it in. The
+     * pend buffers double as the backward cursors' records. */
+    uint32_t lo[LOG_RING_MAX_RINGS], pos[LOG_RING_MAX_RINGS];
+    bool have[LOG_RING_MAX_RINGS];
+    for (int i = 0; i < rd->n_rings; i++) {
+        lo[i] = rd->next[i];
+        pos[i] = atomic_load_explicit(&rd->rings[i]->head, memory_order_acquire);
+        rd->next[i] = pos[i];
+        have[i] = prev_record(rd->rings[i], lo[i], &pos[i], &rd->pend[i]);
+    }
+
+    char line[LOG_RING_LINE_MAX];
+    size_t total = 0;
+    for (;;) {
+        int pick = -1;
+        for (int i = 0; i < rd->n_rings; i++) {
+            if (have[i] && (pick < 0 || !time_before(rd->pend[i].time_ms, rd->pend[pick].time_ms)))
+                pick = i;
+        }
+        if (pick < 0) break;
+        size_t n = log_ring_format(&rd->pend[pick], line, sizeof(line));
+        if (total > 0 && total + n > tail_bytes) break;
+        total += n;
+        rd->next[pick] = rd->pend[pick].seq;
+        have[pick] = prev_record(rd->rings[pick], lo[pick], &pos[pick], &rd->pend[pick]);
+    }
+}
+
+size_t log_ring_reader_read(log_ring_reader_t *rd, char *dst, size_t cap)
+{
+    if (!rd || !dst || cap == 0) return 0;
+
+    char line[LOG_RING_LINE_MAX];
+    size_t out = 0;
+    for (;;) {
+        int pick = -1;
+        for (int i = 0; i < rd->n_rings; i++) {
+            if (!rd->has[i]) reader_fill(rd, i);
+            if (rd->has[i] && (pick < 0 || time_before(rd->pend[i].time_ms, rd->pend[pick].time_ms)))
+                pick = i;
+        }
+        if (pick < 0) break;
+
+        size_t n = log_ring_format(&rd->pend[pick], line, sizeof(line));
+        if (out + n > cap) {
+            if (out > 0) break;
+            n = cap;    /* cap below one line: truncate rather than stall */
+        }
+        memcpy(dst + out, line, n);
+        out += n;
+        rd->has[pick] = false;
+    }
+    return out;
+}
@@ -0,0 +1,132 @@
+/*
+ * log_ring.h - Pure, host-testable lock-free log record ring behind
+ * log_capture.c.
+ *
+ * Instead of formatting every line at log time, a writer stores a compact
+ * binary record: a millisecond timestamp, the format pointer and the
+ * raw argument values, decoded from the va_list by walking the format's
+ * conversions. The ESP_LOG level letter, timestamp and tag are part of that
+ * format and its first arguments, so they are stored the same way. Strings
+ * are stored by pointer when the caller's predicate says they are immutable
+ * (flash literals such as TAG), otherwise copied into the record. Text is only
+ * produced when a reader walks the ring. A line whose format is not static or
+ * uses a conversion the encoder does not handle (%n, %L..., %l[cs]) is stored
+ * as preformatted text instead, truncated to LOG_RING_LINE_MAX like before.
+ *
+ * The ring is an array of 8-byte slots; a record spans 1..LOG_RING_MAX_SLOTS
+ * consecutive slots. Each slot starts with a one-byte stamp: the lap the slot
+ * was last written in and whether it starts a record. Writers reserve slots
+ * with a single atomic fetch-add on the head sequence number, fill them and
+ * publish the record with a release store of its first stamp, so any number
+ * of tasks (on either core, or preempting each other) write without a lock.
+ * Readers never block writers: a record is copied out and then discarded if
+ * the head moved a full lap past it during the copy. A writer preempted for a
+ * whole lap can in principle collide with the writer of the same slot one lap
+ * later; that record is lost, nothing else is.
+ *
+ * log_capture keeps one ring per core so the two cores never share a head
+ * cache line; a reader merges up to LOG_RING_MAX_RINGS rings by timestamp.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LOG_RING_SLOT_BYTES  8
+#define LOG_RING_SLOT_DATA   (LOG_RING_SLOT_BYTES - 1)
+#define LOG_RING_MAX_SLOTS   40     /* longest record, header included */
+#define LOG_RING_HDR_BYTES   5      /* nslots | kind, 32-bit time */
+#define LOG_RING_PAYLOAD_MAX (LOG_RING_MAX_SLOTS * LOG_RING_SLOT_DATA - LOG_RING_HDR_BYTES)
+#define LOG_RING_LINE_MAX    256    /* longest formatted line, '\0' included */
+#define LOG_RING_MAX_RINGS   2
+
+typedef struct {
+    _Atomic uint8_t stamp;      /* (lap << 1) | first-slot, once written */
+    uint8_t data[LOG_RING_SLOT_DATA];
+} log_ring_slot_t;
+
+typedef struct {
+    log_ring_slot_t *slots;     /* caller-owned */
+    uint32_t n_slots;           /* power of two */
+    uint8_t lap_shift;          /* log2(n_slots) */
+    _Atomic uint32_t head;      /* sequence number of the next free slot */
+    _Atomic uint32_t floor;     /* records before this were cleared */
+    _Atomic uint32_t text_records;  /* lines stored preformatted */
+} log_ring_t;
+
+/* True when @p p points at memory that outlives the record (e.g. flash
+ * rodata), so a format or %s argument can be stored by pointer. */
+typedef bool (*log_ring_static_fn)(const void *p);
+
+/* One record copied out of a ring. */
+typedef struct {
+    uint32_t seq;               /* first slot */
+    uint32_t nslots;
+    uint32_t time_ms;
+    uint8_t kind;
+    uint8_t payload[LOG_RING_PAYLOAD_MAX];
+} log_ring_rec_t;
+
+/* Streaming reader over up to LOG_RING_MAX_RINGS rings, oldest line first. */
+typedef struct {
+    log_ring_t *rings[LOG_RING_MAX_RINGS];
+    int n_rings;
+    uint32_t next[LOG_RING_MAX_RINGS];   /* next sequence number to look at */
+    bool has[LOG_RING_MAX_RINGS];        /* pend[i] holds ring i's next record */
+    log_ring_rec_t pend[LOG_RING_MAX_RINGS];
+} log_ring_reader_t;
+
+/*
+ * Set up @p r over @p slots. @p n_slots must be a power of two of at least
+ * 2 * LOG_RING_MAX_SLOTS; returns false otherwise.
+ */
+bool log_ring_init(log_ring_t *r, log_ring_slot_t *slots, uint32_t n_slots);
+
+/* Hide everything written so far from readers that start afterwards. */
+void log_ring_clear(log_ring_t *r);
+
+/*
+ * Append one line. @p args is not consumed (the function works on copies), so
+ * the caller can still pass it on to the console. @p is_static may be NULL,
+ * in which case every line is stored as text.
+ */
+void log_ring_vwrite(log_ring_t *r, uint32_t time_ms, log_ring_static_fn is_static,
+                     const char *fmt, va_list args);
+
+/*
+ * Start reading @p rings. @p tail_bytes 0 starts at the oldest record;
+ * otherwise the reader starts at the oldest line such that the formatted
+ * lines from there to the current end fit in @p tail_bytes (always on a line
+ * boundary, at least the newest line).
+ */
+void log_ring_reader_init(log_ring_reader_t *rd, log_ring_t *const *rings,
+                          int n_rings, size_t tail_bytes);
+
+/*
+ * Format whole lines, oldest first, into @p dst until the next line does not
+ * fit. Lines written after init are returned too. Returns the bytes written
+ * (no terminator); 0 once the reader has caught up. @p cap should be at least
+ * LOG_RING_LINE_MAX, else lines longer than @p cap are truncated.
+ */
+size_t log_ring_reader_read(log_ring_reader_t *rd, char *dst, size_t cap);
+
+/* Format one record into @p dst (NUL-terminated); returns its length. */
+size_t log_ring_format(const log_ring_rec_t *rec, char *dst, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_RING_H */
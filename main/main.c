@@ -20,15 +20,17 @@
 #include "ui/nina_alerts.h"
 #include "ui/nina_safety.h"
 #include "ui/nina_session_stats.h"
+#include "ui/font_glyph_cache.h"
 #include "app_config.h"
 #include "axi_qos.h"
 #include "log_capture.h"
+#include "trace.h"
 #include "web_server.h"
 #include "mqtt_ha.h"
 #include "tasks.h"
 #include "esp_ota_ops.h"
 #include "ota_github.h"
-#include "driver/jpeg_decode.h"
+#include "jpeg_service.h"
 #include "display/lv_display_private.h"
 #include "draw/sw/lv_draw_sw_utils.h"
 
@@ -564,6 +566,7 @@ void app_main(void)
     /* Install the boot log capture hook early so subsequent init output is
      * recorded into the PSRAM ring (chains to the console vprintf). */
     log_capture_init();
+    trace_init();
 
     app_config_init();
 
@@ -644,6 +647,8 @@ void app_main(void)
         }
     };
     cfg.lvgl_port_cfg.task_stack = 10240; /* Default 7168 is too tight for settings page */
+    /* Decoded-glyph cache for the compressed fonts; must exist before LVGL draws. */
+    font_glyph_cache_init();
     bsp_display_start_with_config(&cfg);
     bsp_display_backlight_on();
     bsp_display_brightness_set(app_config_get()->brightness);
@@ -691,65 +696,41 @@ void app_main(void)
     /* Initialize session stats (PSRAM allocation, no LVGL) */
     nina_session_stats_init();
 
+    /* Shared HW JPEG decoder: create the engine while the internal DMA heap is
+     * still plentiful, before WiFi and TLS start carving it up. */
+    jpeg_service_init();
+
     /* ── Splash: hardware JPEG decode (no LVGL needed) ── */
     bool splash_ready = false;
     {
         const uint8_t *jpg_data = logo_jpg_start;
         size_t jpg_size = (size_t)(logo_jpg_end - logo_jpg_start);
 
-        jpeg_decode_picture_info_t pic_info = {0};
-        esp_err_t err = jpeg_decoder_get_info(jpg_data, jpg_size, &pic_info);
-
-        if (err == ESP_OK && pic_info.width > 0) {
-            uint32_t out_w = ((pic_info.width + 15) / 16) * 16;
-            uint32_t out_h = ((pic_info.height + 15) / 16) * 16;
-
-            jpeg_decode_memory_alloc_cfg_t mem_cfg = {
-                .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
-            };
-            size_t allocated = 0;
-            uint8_t *rgb_buf = (uint8_t *)jpeg_alloc_decoder_mem(out_w * out_h * 2, &mem_cfg, &allocated);
-
-            if (rgb_buf) {
-                memset(rgb_buf, 0, allocated); /* Zero buffer so PPA edge interpolation reads black, not heap garbage */
-                jpeg_decoder_handle_t decoder = NULL;
-                jpeg_decode_engine_cfg_t engine_cfg = { .intr_priority = 0, .timeout_ms = 5000 };
-                err = jpeg_new_decoder_engine(&engine_cfg, &decoder);
-                if (err == ESP_OK && decoder) {
-                    jpeg_decode_cfg_t dec_cfg = {
-                        .output_format = JPEG_DECODE_OUT_FORMAT_RGB565,
-                        .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
-                    };
-                    uint32_t out_size = 0;
-                    err = jpeg_decoder_process(decoder, &dec_cfg,
-                              jpg_data, jpg_size, rgb_buf, allocated, &out_size);
-                    jpeg_del_decoder_engine(decoder);
-
-                    if (err == ESP_OK && out_size > 0) {
-                        /* Red Night gate: live theme pointer is not set yet at splash,
-                         * so resolve the SAVED theme directly from config (loaded before
-                         * the display in app_main) and remap the logo to red/black if so. */
-                        const theme_t *saved_theme = themes_get(app_config_get()->theme_index);
-                        if (theme_is_red_night(saved_theme)) {
-                            image_red_remap_rgb565_force((uint16_t *)rgb_buf,
-                                                         (size_t)out_w * (size_t)out_h);
-                        }
-                        splash_dsc.header.magic  = LV_IMAGE_HEADER_MAGIC;
-                        splash_dsc.header.w      = (int32_t)out_w;
-                        splash_dsc.header.h      = (int32_t)out_h;
-                        splash_dsc.header.cf     = LV_COLOR_FORMAT_RGB565;
-                        splash_dsc.header.stride = out_w * 2;
-                        splash_dsc.data          = rgb_buf;
-                        splash_dsc.data_size     = out_size;
-                        splash_ready = true;
-                        ESP_LOGI(TAG, "Splash decoded: %lux%lu", (unsigned long)out_w, (unsigned long)out_h);
-                    } else {
-                        free(rgb_buf);
-                    }
-                } else {
-                    free(rgb_buf);
-                }
+        jpeg_service_frame_t frame;
+        if (jpeg_service_decode(jpg_data, jpg_size, &frame) == ESP_OK) {
+            uint32_t out_w = frame.stride_w;
+            uint32_t out_h = frame.stride_h;
+            uint32_t out_size = frame.out_size;
+            /* The splash keeps its pixels for the lifetime of the firmware */
+            uint8_t *rgb_buf = jpeg_service_take(&frame);
+
+            /* Red Night gate: live theme pointer is not set yet at splash,
+             * so resolve the SAVED theme directly from config (loaded before
+             * the display in app_main) and remap the logo to red/black if so. */
+            const theme_t *saved_theme = themes_get(app_config_get()->theme_index);
+            if (theme_is_red_night(saved_theme)) {
+                image_red_remap_rgb565_force((uint16_t *)rgb_buf,
+                                             (size_t)out_w * (size_t)out_h);
             }
+            splash_dsc.header.magic  = LV_IMAGE_HEADER_MAGIC;
+            splash_dsc.header.w      = (int32_t)out_w;
+            splash_dsc.header.h      = (int32_t)out_h;
+            splash_dsc.header.cf     = LV_COLOR_FORMAT_RGB565;
+            splash_dsc.header.stride = out_w * 2;
+            splash_dsc.data          = rgb_buf;
+            splash_dsc.data_size     = out_size;
+            splash_ready = true;
+            ESP_LOGI(TAG, "Splash decoded: %lux%lu", (unsigned long)out_w, (unsigned long)out_h);
         }
     }
 
@@ -895,7 +876,7 @@ void app_main(void)
             spotify_ensure_task_running();
         }
 
-        /* Weather poll task — always start; task sleeps when no location configured */
+        /* Weather poll job — always add; it retries at a flat 60 s while no location is configured */
         weather_client_start();
     } /* end if (!setup_mode) */
 
@@ -0,0 +1,121 @@
+/*
+ * moon_background.c - Moon page background and its slot table
+ * (see moon_background.h).
+ */
+
+#include "moon_background.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+/* 4x4 Bayer ordered-dither threshold matrix (0..15). */
+static const uint8_t s_bayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+static inline uint16_t pack565(int r, int g, int b)
+{
+    if (r < 0) r = 0;
+    if (r > 255) r = 255;
+    if (g < 0) g = 0;
+    if (g > 255) g = 255;
+    if (b < 0) b = 0;
+    if (b > 255) b = 255;
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+void moon_background_draw(uint16_t *buf, int w, int h, uint8_t bg_style,
+                          float disc_r, int y0, int y1)
+{
+    if (buf == NULL || w <= 0 || h <= 0) return;
+    if (y0 < 0) y0 = 0;
+    if (y1 > h) y1 = h;
+    if (y0 >= y1) return;
+
+    /* Black base. */
+    memset(buf + (size_t)y0 * w, 0, (size_t)(y1 - y0) * w * sizeof(uint16_t));
+
+    /* Deterministic starfield (fixed LCG seed for frame-stable stars). The
+     * whole sequence is replayed and only stars in [y0, y1) are kept, so the
+     * field is the same however the frame is split. */
+    if (bg_style & 1) {
+        uint32_t seed = 1234567u;
+        int nstars = (w * h) / 900;
+        for (int i = 0; i < nstars; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int sx = (int)((seed >> 8) % (uint32_t)w);
+            seed = seed * 1103515245u + 12345u;
+            int sy = (int)((seed >> 8) % (uint32_t)h);
+            int br = 120 + (int)((seed >> 4) & 0x7F);
+            if (sy >= y0 && sy < y1)
+                buf[(size_t)sy * w + sx] = pack565(br, br, br);
+        }
+    }
+
+    /* Soft warm glow halo: additive ring in [disc_r, disc_r*1.35], over the
+     * stars. Single precision: the P4 FPU is float-only. */
+    if ((bg_style & 2) && disc_r > 0.0f) {
+        const float cx = (float)(w - 1) * 0.5f;
+        const float cy = (float)(h - 1) * 0.5f;
+        const float R2 = disc_r * disc_r;
+        const float Rout = disc_r * 1.35f;
+        const float Rout2 = Rout * Rout;
+        const float inv_band = 1.0f / (disc_r * 0.35f);
+        for (int py = y0; py < y1; py++) {
+            float dy = (float)py - cy;
+            uint16_t *row = buf + (size_t)py * w;
+            for (int px = 0; px < w; px++) {
+                float dx = (float)px - cx;
+                float r2 = dx * dx + dy * dy;
+                if (r2 <= R2 || r2 >= Rout2) continue;
+                float dist = sqrtf(r2);
+                float t = 1.0f - (dist - disc_r) * inv_band;   /* 1 at disc edge -> 0 */
+                int add = (int)(40.0f * t);
+                uint16_t c = row[px];
+                int r = ((c >> 11) & 0x1F) * 255 / 31 + add;
+                int g = ((c >> 5)  & 0x3F) * 255 / 63 + add * 9 / 10;   /* warm */
+                int b = ( c        & 0x1F) * 255 / 31 + add * 7 / 10;   /* warm */
+                /* Ordered dither fills RGB565 truncation slack (kills rings). */
+                int dr = s_bayer4[py & 3][px & 3] >> 1;   /* 0..7 */
+                int dg = s_bayer4[py & 3][px & 3] >> 2;   /* 0..3 */
+                int db = dr;
+                row[px] = pack565(r + dr, g + dg, b + db);
+            }
+        }
+    }
+}
+
+bool moon_bg_key_equal(const moon_bg_key_t *a, const moon_bg_key_t *b)
+{
+    return a->w == b->w && a->h == b->h && a->bg_style == b->bg_style &&
+           a->disc_r == b->disc_r;
+}
+
+int moon_bg_table_find(moon_bg_table_t *t, const moon_bg_key_t *key)
+{
+    if (t == NULL || key == NULL) return -1;
+    for (int i = 0; i < t->n_slots; i++) {
+        moon_bg_slot_t *s = &t->slots[i];
+        if (s->px != NULL && moon_bg_key_equal(&s->key, key)) {
+            s->last_used = ++t->tick;
+            return i;
+        }
+    }
+    return -1;
+}
+
+int moon_bg_table_claim(moon_bg_table_t *t)
+{
+    if (t == NULL || t->n_slots <= 0) return -1;
+    int pick = -1;
+    for (int i = 0; i < t->n_slots; i++) {
+        if (t->slots[i].px == NULL) { pick = i; break; }
+        if (pick < 0 || t->slots[i].last_used < t->slots[pick].last_used) pick = i;
+    }
+    t->slots[pick].last_used = ++t->tick;
+    return pick;
+}
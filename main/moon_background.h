@@ -0,0 +1,74 @@
+/*
+ * moon_background.h - Pure, host-testable moon page background (black,
+ * starfield, warm halo) and the keyed slot table that caches it.
+ *
+ * The background depends only on the frame size, the bg_style and the pixel
+ * radius of the disc it surrounds, so moon_render.c builds it once per key
+ * into a PSRAM slot and both moon renderers copy rows out of it instead of
+ * regenerating the starfield and the per-pixel sqrtf halo every frame.
+ *
+ *   bg_style bit 0 (1 or 3): deterministic starfield
+ *   bg_style bit 1 (2 or 3): soft warm glow halo in [disc_r, disc_r*1.35]
+ *   bg_style 0:              plain black
+ *
+ * The slot table never allocates: the caller provides the slots and owns
+ * each slot's pixel buffer.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef MOON_BACKGROUND_H
+#define MOON_BACKGROUND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Draw rows [y0, y1) of the @p w x @p h RGB565 background into @p buf (the
+ * whole frame, row stride w). Rows outside the range are not touched, and
+ * the result does not depend on how the frame is split into ranges.
+ */
+void moon_background_draw(uint16_t *buf, int w, int h, uint8_t bg_style,
+                          float disc_r, int y0, int y1);
+
+typedef struct {
+    int w, h;
+    uint8_t bg_style;
+    float disc_r;
+} moon_bg_key_t;
+
+typedef struct {
+    moon_bg_key_t key;
+    uint16_t *px;           /* NULL = empty slot; owned by the caller */
+    uint32_t last_used;     /* table tick of the last lookup that hit */
+} moon_bg_slot_t;
+
+typedef struct {
+    moon_bg_slot_t *slots;
+    int n_slots;
+    uint32_t tick;
+} moon_bg_table_t;
+
+bool moon_bg_key_equal(const moon_bg_key_t *a, const moon_bg_key_t *b);
+
+/* Index of the filled slot holding @p key (marked used), or -1. */
+int moon_bg_table_find(moon_bg_table_t *t, const moon_bg_key_t *key);
+
+/*
+ * Slot to rebuild into on a miss: an empty slot if there is one, else the
+ * least recently used (marked used). The slot keeps its old key and px so
+ * the caller can reuse the buffer when the frame size matches; once it has
+ * drawn the new background it stores the new key in the slot.
+ */
+int moon_bg_table_claim(moon_bg_table_t *t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MOON_BACKGROUND_H */
@@ -0,0 +1,114 @@
+/**
+ * @file moon_bands.c
+ * @brief Two-core band renderer for the moon page. See moon_bands.h.
+ */
+
+#include "moon_bands.h"
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdbool.h>
+
+static const char *TAG = "moon_bands";
+
+/* 8192 bytes: a Renderer3D instance plus drawSphere()'s per-sector sin/cos
+ * tables live on this stack; matches the poll tasks' PSRAM stacks. */
+#define MOON_BANDS_STACK 8192
+
+typedef enum {
+    HELPER_NONE = 0,
+    HELPER_STARTING,
+    HELPER_READY,
+    HELPER_FAILED,
+} helper_state_t;
+
+static helper_state_t    s_state = HELPER_NONE;
+static portMUX_TYPE      s_state_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t      s_helper = NULL;
+static SemaphoreHandle_t s_call_mtx = NULL;   /* one frame in flight at a time */
+static SemaphoreHandle_t s_done = NULL;       /* helper -> caller: band finished */
+
+/* The band handed to the helper; written by the caller before the notify and
+ * read by the helper after it, so the notify orders the accesses. */
+static struct {
+    moon_band_fn fn;
+    void *ctx;
+    int y0, y1;
+} s_job;
+
+static void moon_bands_helper(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        s_job.fn(s_job.ctx, s_job.y0, s_job.y1);
+        xSemaphoreGive(s_done);
+    }
+}
+
+/* Spawn the helper on the core the first caller is NOT running on, at the
+ * caller's priority. Returns false while another caller is still spawning it
+ * or if spawning failed (both fall back to single-band rendering). */
+static bool ensure_helper(void)
+{
+    portENTER_CRITICAL(&s_state_mux);
+    helper_state_t state = s_state;
+    if (state == HELPER_NONE) s_state = HELPER_STARTING;
+    portEXIT_CRITICAL(&s_state_mux);
+    if (state == HELPER_READY) return true;
+    if (state != HELPER_NONE) return false;
+
+    s_call_mtx = xSemaphoreCreateMutex();
+    s_done = xSemaphoreCreateBinary();
+    StackType_t  *stack = heap_caps_malloc(MOON_BANDS_STACK * sizeof(StackType_t), MALLOC_CAP_SPIRAM);
+    StaticTask_t *tcb   = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    BaseType_t core = xPortGetCoreID() == 0 ? 1 : 0;
+    if (s_call_mtx && s_done && stack && tcb) {
+        s_helper = xTaskCreateStaticPinnedToCore(moon_bands_helper, "moon_band",
+                                                 MOON_BANDS_STACK, NULL,
+                                                 uxTaskPriorityGet(NULL),
+                                                 stack, tcb, core);
+    }
+    if (!s_helper) {
+        ESP_LOGE(TAG, "Failed to start band helper; moon renders on one core");
+        if (stack) heap_caps_free(stack);
+        if (tcb) heap_caps_free(tcb);
+        if (s_call_mtx) { vSemaphoreDelete(s_call_mtx); s_call_mtx = NULL; }
+        if (s_done) { vSemaphoreDelete(s_done); s_done = NULL; }
+        state = HELPER_FAILED;
+    } else {
+        ESP_LOGI(TAG, "band helper started on core %d", (int)core);
+        state = HELPER_READY;
+    }
+
+    portENTER_CRITICAL(&s_state_mux);
+    s_state = state;
+    portEXIT_CRITICAL(&s_state_mux);
+    return state == HELPER_READY;
+}
+
+void moon_bands_run(int w, int h, moon_band_fn fn, void *ctx)
+{
+    if (!fn || w <= 0 || h <= 0) return;
+
+    int split = moon_bands_split(w, h);
+    if (split <= 0 || split >= h || !ensure_helper()) {
+        fn(ctx, 0, h);
+        return;
+    }
+
+    xSemaphoreTake(s_call_mtx, portMAX_DELAY);
+    s_job.fn = fn;
+    s_job.ctx = ctx;
+    s_job.y0 = split;
+    s_job.y1 = h;
+    xTaskNotifyGive(s_helper);
+
+    fn(ctx, 0, split);
+
+    xSemaphoreTake(s_done, portMAX_DELAY);
+    xSemaphoreGive(s_call_mtx);
+}
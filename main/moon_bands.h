@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * @file moon_bands.h
+ * @brief Split a moon frame into two horizontal bands rendered on both cores.
+ *
+ * moon_render() and moon_sphere_render_core() rasterize every pixel of a
+ * frame independently of the other rows (the tgx sphere path via
+ * Renderer3D::setOffset() tile rendering with a per-band z-buffer slice), so
+ * the frame is cut at moon_bands_split() and the lower band is handed to a
+ * helper task pinned to the other core while the caller renders the upper
+ * band. The disc and its halo are centred, so the two halves carry the same
+ * amount of work.
+ *
+ * moon_bands_split() is pure (host-testable); moon_bands.c owns the FreeRTOS
+ * helper task.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Render rows [y0, y1) of the frame described by @p ctx. */
+typedef void (*moon_band_fn)(void *ctx, int y0, int y1);
+
+/** Band boundaries are kept on whole 128-byte lines (PPA / cache line) of an
+ *  RGB565 frame, so the two cores never write the same line. */
+#define MOON_BANDS_ALIGN_BYTES 128
+
+/**
+ * Row at which a @p w x @p h RGB565 frame is split: the first row at or
+ * below h/2 whose byte offset is a multiple of MOON_BANDS_ALIGN_BYTES.
+ * Returns 0 (render as a single band) when no such row exists in the upper
+ * half or the frame is too small to be worth splitting.
+ */
+static inline int moon_bands_split(int w, int h)
+{
+    if (w <= 0 || h < 2) return 0;
+    /* Rows per aligned step: ALIGN / gcd(row_bytes, ALIGN). */
+    uint32_t row_bytes = (uint32_t)w * 2u;
+    uint32_t g = MOON_BANDS_ALIGN_BYTES;
+    uint32_t a = row_bytes;
+    while (a) { uint32_t t = g % a; g = a; a = t; }
+    int step = (int)(MOON_BANDS_ALIGN_BYTES / g);
+    int y = (h / 2) / step * step;
+    return y;
+}
+
+/**
+ * Run @p fn over the whole @p w x @p h frame: rows [0, split) on the calling
+ * core and [split, h) on the helper core, returning once both are done.
+ * Falls back to a single inline call fn(ctx, 0, h) when the frame does not
+ * split or the helper task is unavailable. Concurrent callers are serialized.
+ */
+void moon_bands_run(int w, int h, moon_band_fn fn, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
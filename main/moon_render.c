@@ -7,17 +7,12 @@
 #include <string.h>
 #include "stb_image.h"
 #include "image_red_remap.h"
+#include "moon_bands.h"
+#include "moon_background.h"
+#include "perf_monitor.h"
 
 static const char *TAG = "moon_render";
 
-/* 4x4 Bayer ordered-dither threshold matrix (0..15). */
-static const uint8_t s_bayer4[4][4] = {
-    { 0,  8,  2, 10},
-    {12,  4, 14,  6},
-    { 3, 11,  1,  9},
-    {15,  7, 13,  5}
-};
-
 /* Embedded PNG (see CMakeLists EMBED_FILES). */
 extern const uint8_t moon_png_start[] asm("_binary_moon_texture_png_start");
 extern const uint8_t moon_png_end[]   asm("_binary_moon_texture_png_end");
@@ -47,11 +42,97 @@ bool moon_render_init(void)
     return true;
 }
 
+/* Background cache: two slots so the 240 px drag frames and the 720 px
+ * resting render do not evict each other. */
+#define MOON_BG_SLOTS 2
+static moon_bg_slot_t    s_bg_slots[MOON_BG_SLOTS];
+static moon_bg_table_t   s_bg_table = { s_bg_slots, MOON_BG_SLOTS, 0 };
+static SemaphoreHandle_t s_bg_mtx = NULL;
+static portMUX_TYPE      s_bg_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void bg_free_slots(void)
+{
+    for (int i = 0; i < MOON_BG_SLOTS; i++) {
+        if (s_bg_slots[i].px) { heap_caps_free(s_bg_slots[i].px); s_bg_slots[i].px = NULL; }
+    }
+}
+
 void moon_render_deinit(void)
 {
     if (s_tex_mtx) xSemaphoreTake(s_tex_mtx, portMAX_DELAY);
     if (s_tex) { heap_caps_free(s_tex); s_tex = NULL; s_tex_w = s_tex_h = 0; }
     if (s_tex_mtx) xSemaphoreGive(s_tex_mtx);
+
+    if (s_bg_mtx) {
+        xSemaphoreTake(s_bg_mtx, portMAX_DELAY);
+        bg_free_slots();
+        xSemaphoreGive(s_bg_mtx);
+    }
+}
+
+typedef struct {
+    uint16_t *buf;
+    const moon_bg_key_t *key;
+} bg_build_t;
+
+static void bg_build_band(void *arg, int y0, int y1)
+{
+    const bg_build_t *b = (const bg_build_t *)arg;
+    moon_background_draw(b->buf, b->key->w, b->key->h, b->key->bg_style,
+                         b->key->disc_r, y0, y1);
+}
+
+const uint16_t *moon_render_background_acquire(int w, int h, uint8_t bg_style, float disc_r)
+{
+    /* Lazy mutex: build outside the critical section, publish inside; the
+     * losing racer deletes its copy. */
+    portENTER_CRITICAL(&s_bg_mux);
+    SemaphoreHandle_t mtx = s_bg_mtx;
+    portEXIT_CRITICAL(&s_bg_mux);
+    if (!mtx) {
+        SemaphoreHandle_t fresh = xSemaphoreCreateMutex();
+        if (!fresh) return NULL;
+        portENTER_CRITICAL(&s_bg_mux);
+        if (!s_bg_mtx) s_bg_mtx = fresh;
+        mtx = s_bg_mtx;
+        portEXIT_CRITICAL(&s_bg_mux);
+        if (mtx != fresh) vSemaphoreDelete(fresh);
+    }
+    xSemaphoreTake(mtx, portMAX_DELAY);
+
+    if (bg_style == 0 || w <= 0 || h <= 0) return NULL;
+
+    moon_bg_key_t key = { .w = w, .h = h, .bg_style = bg_style, .disc_r = disc_r };
+    int slot = moon_bg_table_find(&s_bg_table, &key);
+    if (slot >= 0) {
+        perf_counter_increment(&g_perf.moon_bg_hit_count);
+        return s_bg_slots[slot].px;
+    }
+    perf_counter_increment(&g_perf.moon_bg_miss_count);
+
+    /* Miss: the key (size, style or disc radius) changed. Rebuild into the
+     * LRU slot, reusing its buffer when the frame size is unchanged. */
+    size_t bytes = (size_t)w * h * sizeof(uint16_t);
+    slot = moon_bg_table_claim(&s_bg_table);
+    moon_bg_slot_t *s = &s_bg_slots[slot];
+    if (s->px && s->key.w * s->key.h != w * h) {
+        heap_caps_free(s->px);
+        s->px = NULL;
+    }
+    if (!s->px) s->px = heap_caps_aligned_alloc(128, bytes, MALLOC_CAP_SPIRAM);
+    if (!s->px) {
+        ESP_LOGW(TAG, "background cache alloc failed (%dx%d), drawing per frame", w, h);
+        return NULL;
+    }
+    bg_build_t build = { .buf = s->px, .key = &key };
+    moon_bands_run(w, h, bg_build_band, &build);
+    s->key = key;
+    return s->px;
+}
+
+void moon_render_background_release(void)
+{
+    if (s_bg_mtx) xSemaphoreGive(s_bg_mtx);
 }
 
 static inline uint16_t rgb565(int r, int g, int b)
@@ -79,49 +160,44 @@ static bool sample_tex(float nx, float ny, int *lum, int *alpha)
     return p[3] > 40;
 }
 
-uint16_t *moon_render(int w, int h, const moon_state_t *st, uint8_t bg_style)
-{
-    /* Hold the texture lock for the whole render so moon_render_deinit()
-     * (Core 1) cannot free s_tex while sample_tex() reads it here (Core 0). */
-    if (s_tex_mtx) xSemaphoreTake(s_tex_mtx, portMAX_DELAY);
-
-    uint16_t *buf = heap_caps_malloc((size_t)w * h * 2, MALLOC_CAP_SPIRAM);
-    if (!buf) {
-        ESP_LOGE(TAG, "PSRAM render alloc failed");
-        if (s_tex_mtx) xSemaphoreGive(s_tex_mtx);
-        return NULL;
-    }
+/* Per-frame parameters shared by both bands. All per-pixel math is
+ * single-precision: the ESP32-P4 FPU is float-only, so doubles would fall back
+ * to slow soft-float (sqrt/floatsidf) and a 600x600 render would take
+ * seconds, starving the Core 0 idle task and tripping the task watchdog.
+ * float keeps it to tens of milliseconds. */
+typedef struct {
+    uint16_t *buf;
+    const uint16_t *bg;     /* cached background, or NULL to draw it */
+    int w, h;
+    uint8_t bg_style;
+    float R, R2, cx, cy, f, ca, sa;
+    int waxing;
+} moon_frame_t;
 
-    /* All per-pixel math is single-precision: the ESP32-P4 FPU is float-only,
-     * so doubles would fall back to slow soft-float (sqrt/floatsidf) and a
-     * 600x600 render would take seconds, starving the Core 0 idle task and
-     * tripping the task watchdog. float keeps it to tens of milliseconds. */
-    const float R  = (w < h ? w : h) * 0.5f * 0.92f;
-    const float cx = (w - 1) * 0.5f;
-    const float cy = (h - 1) * 0.5f;
+/* Render rows [y0, y1): background, then the disc over it. Every row depends
+ * only on the frame parameters, so the two bands run concurrently. */
+static void moon_render_band(void *arg, int y0, int y1)
+{
+    const moon_frame_t *fr = (const moon_frame_t *)arg;
+    uint16_t *buf = fr->buf;
+    const int w = fr->w, h = fr->h;
+    const float R = fr->R, R2 = fr->R2, cx = fr->cx, cy = fr->cy;
+    const float f = fr->f, ca = fr->ca, sa = fr->sa;
+    const int waxing = fr->waxing;
     const float AA = 1.5f;
-    const float f  = st->illum;
-    const int   waxing = st->waxing ? 1 : 0;
-    const float ca = cosf(st->orient_rad), sa = sinf(st->orient_rad);
-    const float R2 = R * R;
     const float tint_r = 1.02f, tint_g = 0.97f, tint_b = 0.86f;
     const float dk = 0.07f;
 
-    /* Background: black fill (single memset beats a per-pixel loop). */
-    memset(buf, 0, (size_t)w * h * 2);
-    if (bg_style == 1 || bg_style == 3) { /* deterministic starfield */
-        uint32_t seed = 1234567u;
-        for (int i = 0; i < (w*h)/900; i++) {
-            seed = seed*1103515245u + 12345u;
-            int sx = (seed >> 8) % w;
-            seed = seed*1103515245u + 12345u;
-            int sy = (seed >> 8) % h;
-            int br = 120 + ((seed >> 4) & 0x7F);
-            buf[sy*w + sx] = rgb565(br, br, br);
-        }
+    /* Background (starfield + halo outside the disc): a row copy from the
+     * cache, or drawn here if the cache could not be allocated. */
+    if (fr->bg) {
+        memcpy(buf + (size_t)y0 * w, fr->bg + (size_t)y0 * w,
+               (size_t)(y1 - y0) * w * sizeof(uint16_t));
+    } else {
+        moon_background_draw(buf, w, h, fr->bg_style, R, y0, y1);
     }
 
-    for (int py = 0; py < h; py++) {
+    for (int py = y0; py < y1; py++) {
         float dy = (float)py - cy;
         uint16_t *row = buf + (size_t)py * w;
         for (int px = 0; px < w; px++) {
@@ -159,33 +235,36 @@ uint16_t *moon_render(int w, int h, const moon_state_t *st, uint8_t bg_style)
             row[px] = rgb565(r, g, b);
         }
     }
+}
 
-    if (bg_style == 2 || bg_style == 3) {
-        /* Soft warm halo: additive ring just outside the disc. */
-        const float Rout2 = (R * 1.35f) * (R * 1.35f);
-        for (int py = 0; py < h; py++) {
-            float dy = (float)py - cy;
-            uint16_t *row = buf + (size_t)py * w;
-            for (int px = 0; px < w; px++) {
-                float dx = (float)px - cx;
-                float r2 = dx*dx + dy*dy;
-                if (r2 <= R2 || r2 >= Rout2) continue;
-                float dist = sqrtf(r2);
-                float t = 1.0f - (dist - R) / (R*0.35f);
-                int add = (int)(40.0f * t);
-                uint16_t c = row[px];
-                int r = ((c>>11)&0x1F)*255/31 + add;
-                int g = ((c>>5)&0x3F)*255/63 + add*9/10;
-                int b = (c&0x1F)*255/31 + add*7/10;
-                /* Ordered dither fills rgb565 truncation slack (kills rings). */
-                int dr = s_bayer4[py & 3][px & 3] >> 1;  /* 0..7, red step 8 */
-                int dg = s_bayer4[py & 3][px & 3] >> 2;  /* 0..3, green step 4 */
-                int db = dr;                             /* 0..7, blue step 8 */
-                row[px] = rgb565(r + dr, g + dg, b + db);
-            }
-        }
+uint16_t *moon_render(int w, int h, const moon_state_t *st, uint8_t bg_style)
+{
+    /* Hold the texture lock for the whole render so moon_render_deinit()
+     * (Core 1) cannot free s_tex while sample_tex() reads it here (Core 0). */
+    if (s_tex_mtx) xSemaphoreTake(s_tex_mtx, portMAX_DELAY);
+
+    uint16_t *buf = heap_caps_malloc((size_t)w * h * 2, MALLOC_CAP_SPIRAM);
+    if (!buf) {
+        ESP_LOGE(TAG, "PSRAM render alloc failed");
+        if (s_tex_mtx) xSemaphoreGive(s_tex_mtx);
+        return NULL;
     }
 
+    const float R = (w < h ? w : h) * 0.5f * 0.92f;
+    moon_frame_t fr = {
+        .buf = buf, .w = w, .h = h, .bg_style = bg_style,
+        .R = R, .R2 = R * R,
+        .cx = (w - 1) * 0.5f, .cy = (h - 1) * 0.5f,
+        .f = st->illum,
+        .ca = cosf(st->orient_rad), .sa = sinf(st->orient_rad),
+        .waxing = st->waxing ? 1 : 0,
+    };
+    fr.bg = moon_render_background_acquire(w, h, bg_style, R);
+    /* Both halves run under the texture lock held above; moon_bands_run()
+     * returns only once the helper core's band is done. */
+    moon_bands_run(w, h, moon_render_band, &fr);
+    moon_render_background_release();
+
     /* Red Night: remap the fully-rendered buffer (moon disc, starfield, halo)
      * to red shades by luminance. Self-gates; no-op under non-red themes, so
      * the warm/white moon is preserved exactly outside Red Night. */
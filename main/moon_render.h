@@ -19,6 +19,16 @@ void moon_render_deinit(void);
  * bg_style: 0=black, 1=starfield, 2=soft glow. */
 uint16_t *moon_render(int w, int h, const moon_state_t *st, uint8_t bg_style);
 
+/* Moon page background (black / starfield / halo around a disc of pixel
+ * radius disc_r, see moon_background.h) from a PSRAM cache keyed by
+ * (w, h, bg_style, disc_r), built on a miss. Returns NULL for bg_style 0
+ * (plain black is a memset) or when the slot cannot be allocated; the caller
+ * then draws with moon_background_draw(). Locks the cache: every acquire,
+ * NULL or not, must be paired with moon_render_background_release() once the
+ * caller has copied what it needs. Hits/misses are counted in g_perf. */
+const uint16_t *moon_render_background_acquire(int w, int h, uint8_t bg_style, float disc_r);
+void moon_render_background_release(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,9 @@
 #endif
 
 #include "moon_sphere.h"
+#include "moon_bands.h"
+#include "moon_background.h"
+#include "moon_render.h"
 
 #include "esp_log.h"
 #include "esp_heap_caps.h"
@@ -91,29 +94,6 @@ static const char *TAG = "moon_sphere";
                                    north-up reference photo */
 #endif
 
-/* RGB565 packer with clamping, named pack565() so it does not collide with the
- * tgx::RGB565 type. Mirrors moon_render.c's rgb565() bit layout. Used only to
- * draw the starfield + glow background directly into the color buffer. */
-static inline uint16_t pack565(int r, int g, int b)
-{
-    if (r < 0) r = 0;
-    if (r > 255) r = 255;
-    if (g < 0) g = 0;
-    if (g > 255) g = 255;
-    if (b < 0) b = 0;
-    if (b > 255) b = 255;
-    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
-}
-
-/* 4x4 ordered-dither (Bayer) matrix, ported from moon_render.c, used to fill
- * RGB565 truncation slack in the warm glow halo so it does not band. */
-static const uint8_t s_bayer4[4][4] = {
-    { 0,  8,  2, 10},
-    {12,  4, 14,  6},
-    { 3, 11,  1,  9},
-    {15,  7, 13,  5}
-};
-
 /* Embedded real lunar texture: main/moon_equirect.jpg (1024x512 grayscale JPEG,
  * public domain USGS Clementine 750nm). Embedded via CMakeLists.txt. */
 extern const uint8_t moon_equirect_jpg_start[] asm("_binary_moon_equirect_jpg_start");
@@ -428,102 +408,61 @@ static const Shader LOADED_SHADERS =
     SHADER_ORTHO | SHADER_ZBUFFER | SHADER_GOURAUD |
     SHADER_TEXTURE_BILINEAR | SHADER_TEXTURE_WRAP_POW2;
 
-/* Core sphere renderer. Rasterizes into `color_buf` (RGB565) using `zbuf` as the
- * depth buffer; both must be w*h uint16 and 128-byte aligned (PPA / cache line).
- * The caller owns both buffers and their lifetime — this function neither
- * allocates nor frees them. moon_sphere_render_ex() wraps this with a per-call
- * alloc/free (the resting full-res path), while the drag loop passes persistent
- * scratch buffers so no per-frame heap churn occurs. */
-static uint16_t *moon_sphere_render_core(int w, int h, const moon_state_t *st,
-                                         int nb_sectors, int nb_stacks,
-                                         uint8_t bg_style,
-                                         float yaw_deg, float pitch_deg,
-                                         moon_light_mode_t light_mode,
-                                         uint16_t *color_buf, uint16_t *zbuf)
-{
-    const size_t npix      = (size_t)w * (size_t)h;
-    const size_t color_sz  = npix * sizeof(uint16_t);
+/* Per-frame state shared by both bands of moon_sphere_render_core(). */
+struct sphere_frame_t {
+    uint16_t *color_buf;
+    uint16_t *zbuf;
+    const uint16_t *bg;    /* cached background, or NULL to draw it */
+    int       w, h;
+    int       nb_sectors, nb_stacks;
+    uint8_t   bg_style;
+    bool      explore;     /* MOON_LIGHT_EXPLORE material/light overrides */
+    fMat4     M;           /* model matrix (orientation + drag + push to z=-2) */
+    fVec3     sun_w;       /* world-space direction toward the Sun */
+};
 
-    /* Live orientation config, read once. Controls the runtime texture flips and
-     * the roll/yaw/pitch offsets applied below. Defaults are all 0 so default
-     * behavior matches the pre-config render exactly. */
-    const app_config_t *cfg = app_config_get();
+/* Disc pixel radius: the sphere is unit radius and setOrtho uses half-extent
+ * ORTHO_R (1.08f, see sphere_render_band), so the disc spans
+ * (1.0/ORTHO_R) * 0.5 * min(w,h) pixels. The halo starts at this radius. */
+static float sphere_disc_radius(int w, int h)
+{
+    const float ORTHO_R = 1.08f;
+    return (1.0f / ORTHO_R) * 0.5f * (float)((w < h) ? w : h);
+}
 
-    /* If the flip config changed since the texture was last decoded, re-decode
-     * now (frees + re-allocs the buffer with the current flips applied) so web-UI
-     * flip toggles take effect live. No-op when the flip state is unchanged. */
-    moon_sphere_reflip_if_changed();
+/* Render rows [y0, y1) of the frame: background, then the sphere. */
+static void sphere_render_band(void *arg, int y0, int y1)
+{
+    const sphere_frame_t *fr = (const sphere_frame_t *)arg;
+    const int w = fr->w, h = fr->h;
 
     /* ----- Background ----------------------------------------------------
-     * Drawn DIRECTLY into color_buf BEFORE the sphere is rasterized. The
-     * Renderer3D only writes the pixels the disc covers, so the background
-     * shows through everywhere outside the lunar disc. Do NOT call
-     * im.fillScreen() after this, it would erase the background.
-     *   bit 0 (bg_style 1 or 3): deterministic starfield
-     *   bit 1 (bg_style 2 or 3): soft warm glow halo just outside the disc
-     *   bg_style 0: plain black
-     * Ported from moon_render.c's flat-path background. Single precision. */
-    Image<RGB565> im(color_buf, w, h, w);
-
-    /* 1. Black base. */
-    memset(color_buf, 0, color_sz);   /* RGB565 0x0000 */
-
-    /* 2. Deterministic starfield (fixed LCG seed for frame-stable stars). */
-    if (bg_style & 1) {
-        uint32_t seed = 1234567u;
-        int nstars = (w * h) / 900;
-        for (int i = 0; i < nstars; i++) {
-            seed = seed * 1103515245u + 12345u;
-            int sx = (int)((seed >> 8) % (uint32_t)w);
-            seed = seed * 1103515245u + 12345u;
-            int sy = (int)((seed >> 8) % (uint32_t)h);
-            int br = 120 + (int)((seed >> 4) & 0x7F);
-            color_buf[(size_t)sy * w + sx] = pack565(br, br, br);
-        }
+     * Copied (or, without a cache slot, drawn) DIRECTLY into color_buf BEFORE
+     * the sphere is rasterized. The Renderer3D only writes the pixels the disc
+     * covers, so the background shows through everywhere outside the lunar
+     * disc. Do NOT call im.fillScreen() after this, it would erase it. */
+    if (fr->bg) {
+        memcpy(fr->color_buf + (size_t)y0 * w, fr->bg + (size_t)y0 * w,
+               (size_t)(y1 - y0) * w * sizeof(uint16_t));
+    } else {
+        moon_background_draw(fr->color_buf, w, h, fr->bg_style,
+                             sphere_disc_radius(w, h), y0, y1);
     }
 
-    /* 3. Soft warm glow halo: additive ring in [R_disc, R_disc*1.35].
-     * Disc geometry: the sphere is unit radius and setOrtho uses half-extent
-     * ORTHO_R (defined below as 1.08f), so the disc pixel radius is
-     * (1.0/ORTHO_R) * 0.5 * min(w,h). */
-    if (bg_style & 2) {
-        const float ORTHO_R = 1.08f;
-        const float R_disc  = (1.0f / ORTHO_R) * 0.5f * (float)((w < h) ? w : h);
-        const float cx = (float)(w - 1) * 0.5f;
-        const float cy = (float)(h - 1) * 0.5f;
-        const float R_disc2 = R_disc * R_disc;
-        const float Rout    = R_disc * 1.35f;
-        const float Rout2   = Rout * Rout;
-        const float inv_band = 1.0f / (R_disc * 0.35f);
-        for (int py = 0; py < h; py++) {
-            float dy = (float)py - cy;
-            uint16_t *row = color_buf + (size_t)py * w;
-            for (int px = 0; px < w; px++) {
-                float dx = (float)px - cx;
-                float r2 = dx * dx + dy * dy;
-                if (r2 <= R_disc2 || r2 >= Rout2) continue;
-                float dist = sqrtf(r2);
-                float t = 1.0f - (dist - R_disc) * inv_band;   /* 1 at disc edge -> 0 */
-                int add = (int)(40.0f * t);
-                uint16_t c = row[px];
-                int r = ((c >> 11) & 0x1F) * 255 / 31 + add;
-                int g = ((c >> 5)  & 0x3F) * 255 / 63 + add * 9 / 10;   /* warm */
-                int b = ( c        & 0x1F) * 255 / 31 + add * 7 / 10;   /* warm */
-                /* Ordered dither fills RGB565 truncation slack (kills rings). */
-                int dr = s_bayer4[py & 3][px & 3] >> 1;   /* 0..7 */
-                int dg = s_bayer4[py & 3][px & 3] >> 2;   /* 0..3 */
-                int db = dr;
-                row[px] = pack565(r + dr, g + dg, b + db);
-            }
-        }
-    }
+    Image<RGB565> im(fr->color_buf + (size_t)y0 * w, w, y1 - y0, w);
+    uint16_t *zbuf_band = fr->zbuf + (size_t)y0 * w;
 
-    /* ----- Set up the renderer ------------------------------------------- */
+    /* ----- Set up the renderer -------------------------------------------
+     * Tile rendering: the viewport is the whole w x h frame, the image is
+     * this band's rows and setOffset() places it in the viewport. The band's
+     * z-buffer slice is image-sized and cleared here, so the two bands never
+     * share depth state. Each band transforms the full sphere mesh and the
+     * rasterizer clips triangles to the band. */
     Renderer3D<RGB565, LOADED_SHADERS, uint16_t> renderer;
     renderer.setViewportSize(w, h);
-    renderer.setOffset(0, 0);
+    renderer.setOffset(0, y0);
     renderer.setImage(&im);
-    renderer.setZbuffer(zbuf);
+    renderer.setZbuffer(zbuf_band);
     renderer.clearZbuffer();
     renderer.setCulling(1);
 
@@ -547,6 +486,53 @@ static uint16_t *moon_sphere_render_core(int w, int h, const moon_state_t *st,
     renderer.setLightDiffuse(RGBf(1.0f, 1.0f, 1.0f));
     renderer.setLightSpecular(RGBf(0.0f, 0.0f, 0.0f));
 
+    renderer.setModelMatrix(fr->M);
+
+    if (fr->explore) {
+        /* Explore view: light the whole disc so the user can inspect the far
+         * side while spinning. Raise ambient near full and drop diffuse to a
+         * gentle view-aligned headlight (direction along the view axis, -Z) for
+         * mild shading with no dark/night side. The sky light vector computed
+         * above is intentionally NOT used here; only the material/light params
+         * are overridden. */
+        renderer.setMaterialAmbiantStrength(0.95f);
+        renderer.setMaterialDiffuseStrength(0.15f);
+        renderer.setLightDirection(fVec3(0.0f, 0.0f, -1.0f));
+    } else {
+        /* True sub-solar phase: keep the directional sub-solar light so the real
+         * phase terminator shows (material/light defaults set above). */
+        renderer.setLightDirection(fr->sun_w);
+    }
+
+    /* ----- Draw the textured sphere -------------------------------------- */
+    renderer.drawSphere(fr->nb_sectors, fr->nb_stacks, &s_tex);
+}
+
+/* Core sphere renderer. Rasterizes into `color_buf` (RGB565) using `zbuf` as the
+ * depth buffer; both must be w*h uint16 and 128-byte aligned (PPA / cache line).
+ * The caller owns both buffers and their lifetime — this function neither
+ * allocates nor frees them. moon_sphere_render_ex() wraps this with a per-call
+ * alloc/free (the resting full-res path), while the drag loop passes persistent
+ * scratch buffers so no per-frame heap churn occurs. The frame is rendered as
+ * two horizontal bands on both cores (moon_bands.h); only the orientation and
+ * light are computed here, once. */
+static uint16_t *moon_sphere_render_core(int w, int h, const moon_state_t *st,
+                                         int nb_sectors, int nb_stacks,
+                                         uint8_t bg_style,
+                                         float yaw_deg, float pitch_deg,
+                                         moon_light_mode_t light_mode,
+                                         uint16_t *color_buf, uint16_t *zbuf)
+{
+    /* Live orientation config, read once. Controls the runtime texture flips and
+     * the roll/yaw/pitch offsets applied below. Defaults are all 0 so default
+     * behavior matches the pre-config render exactly. */
+    const app_config_t *cfg = app_config_get();
+
+    /* If the flip config changed since the texture was last decoded, re-decode
+     * now (frees + re-allocs the buffer with the current flips applied) so web-UI
+     * flip toggles take effect live. No-op when the flip state is unchanged. */
+    moon_sphere_reflip_if_changed();
+
     /* ----- Model matrix: orient the disc -------------------------------
      * tgx sphere + camera conventions (verified against components/tgx/src):
      *
@@ -653,7 +639,6 @@ static uint16_t *moon_sphere_render_core(int w, int h, const moon_state_t *st,
     /* Push the unit sphere down -Z so it lands between zNear (0.1) and zFar (10),
      * centered at z = -2 (camera at origin looking toward -Z). */
     M.multTranslate(fVec3(0.0f, 0.0f, -2.0f));
-    renderer.setModelMatrix(M);
 
     /* ----- Lighting: directional light from the sub-solar point ----------
      * st->sun_lon / st->sun_lat are the sub-solar selenographic coordinates.
@@ -699,24 +684,22 @@ static uint16_t *moon_sphere_render_core(int w, int h, const moon_state_t *st,
         if (nd > 1e-6f) { sun_w.x /= nd; sun_w.y /= nd; sun_w.z /= nd; }
     }
 
-    if (light_mode == MOON_LIGHT_EXPLORE) {
-        /* Explore view: light the whole disc so the user can inspect the far
-         * side while spinning. Raise ambient near full and drop diffuse to a
-         * gentle view-aligned headlight (direction along the view axis, -Z) for
-         * mild shading with no dark/night side. The sky light vector computed
-         * above is intentionally NOT used here; only the material/light params
-         * are overridden. */
-        renderer.setMaterialAmbiantStrength(0.95f);
-        renderer.setMaterialDiffuseStrength(0.15f);
-        renderer.setLightDirection(fVec3(0.0f, 0.0f, -1.0f));
-    } else {
-        /* True sub-solar phase: keep the directional sub-solar light so the real
-         * phase terminator shows (material/light defaults set above). */
-        renderer.setLightDirection(fVec3(sun_w.x, sun_w.y, sun_w.z));
-    }
-
-    /* ----- Draw the textured sphere -------------------------------------- */
-    renderer.drawSphere(nb_sectors, nb_stacks, &s_tex);
+    sphere_frame_t fr;
+    fr.color_buf  = color_buf;
+    fr.zbuf       = zbuf;
+    fr.w          = w;
+    fr.h          = h;
+    fr.nb_sectors = nb_sectors;
+    fr.nb_stacks  = nb_stacks;
+    fr.bg_style   = bg_style;
+    fr.explore    = (light_mode == MOON_LIGHT_EXPLORE);
+    fr.M          = M;
+    fr.sun_w      = sun_w;
+    /* Starfield + halo depend only on (w, h, bg_style): copied from the
+     * moon_render.c cache rather than regenerated every frame. */
+    fr.bg = moon_render_background_acquire(w, h, bg_style, sphere_disc_radius(w, h));
+    moon_bands_run(w, h, sphere_render_band, &fr);
+    moon_render_background_release();
 
     /* Both buffers are caller-owned; do NOT free here. Return the color buffer
      * so callers can treat the result like the previous alloc-and-return API. */
@@ -10,8 +10,10 @@
 #include "nina_client_internal.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "cJSON.h"
 #include <string.h>
+#include <strings.h>
 #include <stdio.h>
 
 static const char *TAG = "nina_fetch";
@@ -30,6 +32,139 @@ static void nina_fetch_set_offline(nina_client_t *data) {
     }
 }
 
+/* ── Streaming extraction helpers ──
+ * The per-cycle hot endpoints (camera info, equipment bundle, guider graph,
+ * image history) are parsed with json_stream instead of a cJSON tree: each
+ * callback stages only the fields it needs, and the fetcher commits them
+ * under the client lock once the whole document has been validated. The
+ * remaining (cold) fetchers stay on cJSON; perf_monitor reports both engines
+ * (json_stream vs json_parse). */
+
+/* cJSON valuedouble/valueint semantics: a non-number reads as 0. */
+static double sv_num(const json_stream_value_t *v) {
+    return v->type == JSON_STREAM_NUMBER ? v->num : 0;
+}
+
+static int sv_int(const json_stream_value_t *v) {
+    return json_stream_value_int(v);
+}
+
+static bool sv_true(const json_stream_value_t *v) {
+    return v->type == JSON_STREAM_BOOL && v->boolean;
+}
+
+/* Copy a string value into a staging buffer; false (dst untouched) if @p v
+ * is not a string -- the streaming analogue of a NULL valuestring. */
+static bool sv_copy_str(char *dst, size_t dst_len, const json_stream_value_t *v) {
+    if (v->type != JSON_STREAM_STRING) return false;
+    size_t n = v->len < dst_len - 1 ? v->len : dst_len - 1;
+    memcpy(dst, v->str, n);
+    dst[n] = '\0';
+    return true;
+}
+
+static bool stream_key_is(const json_stream_t *js, int level, const char *key) {
+    const char *k = json_stream_key_at(js, level);
+    return k && strcmp(k, key) == 0;
+}
+
+/* Camera fields shared by /equipment/camera/info and the bundle's Camera
+ * object, staged so the lock is held only for the commit. */
+typedef struct {
+    char name[64];
+    bool has_name;
+    char state[32];
+    bool has_state;
+    float temp;
+    bool has_temp;
+    float cooler_power;
+    bool has_cooler_power;
+    float exposure_time;
+    bool is_exposing;
+    char exposure_end[40];
+    bool has_exposure_end;
+} camera_stage_t;
+
+static void camera_stage_field(camera_stage_t *c, const char *key, const json_stream_value_t *v) {
+    if (strcmp(key, "Name") == 0) {
+        c->has_name = sv_copy_str(c->name, sizeof(c->name), v);
+    } else if (strcmp(key, "CameraState") == 0) {
+        c->has_state = sv_copy_str(c->state, sizeof(c->state), v);
+    } else if (strcmp(key, "Temperature") == 0) {
+        c->temp = (float)sv_num(v);
+        c->has_temp = true;
+    } else if (strcmp(key, "CoolerPower") == 0) {
+        c->cooler_power = (float)sv_num(v);
+        c->has_cooler_power = true;
+    } else if (strcmp(key, "ExposureTime") == 0) {
+        c->exposure_time = (float)sv_num(v);
+    } else if (strcmp(key, "IsExposing") == 0) {
+        c->is_exposing = sv_true(v);
+    } else if (strcmp(key, "ExposureEndTime") == 0) {
+        c->has_exposure_end = sv_copy_str(c->exposure_end, sizeof(c->exposure_end), v);
+    }
+}
+
+/* Apply staged camera fields. Caller holds the client lock. */
+static void camera_stage_commit(nina_client_t *data, const camera_stage_t *c,
+                                int64_t date_epoch, bool log_remaining) {
+    if (c->has_name && c->name[0] != '\0')
+        strlcpy(data->camera_name, c->name, sizeof(data->camera_name));
+    if (c->has_state)
+        strlcpy(data->status, c->state, sizeof(data->status));
+    if (c->has_temp) data->camera.temp = c->temp;
+    if (c->has_cooler_power) data->camera.cooler_power = c->cooler_power;
+
+    // Exposure time (total length per frame)
+    if (c->exposure_time > 0) data->exposure_total = c->exposure_time;
+
+    data->is_exposing = c->is_exposing;
+
+    if (data->is_exposing && c->has_exposure_end) {
+        time_t end_time = parse_iso8601(c->exposure_end);
+        /* Do the remaining-time math in the NINA clock domain: Date-derived
+         * "now" needs no boot-clock sanity guard; the time(NULL) fallback
+         * keeps the >2020 guard against an unset SNTP clock. */
+        int64_t now_nina = (date_epoch > 0) ? date_epoch : (int64_t)time(NULL);
+        bool now_valid = (date_epoch > 0) || (now_nina > 1577836800);
+
+        if (now_valid && end_time > 0) {
+            int64_t remaining = (int64_t)end_time - now_nina;
+            if (remaining >= 0 && remaining <= 7200) {
+                data->exposure_current = -(float)remaining;
+                data->exposure_end_epoch = (int64_t)end_time;
+                if (data->exposure_total == 0 && remaining > 0) {
+                    data->exposure_total = (float)remaining;
+                }
+                if (log_remaining) {
+                    ESP_LOGI(TAG, "Camera exposing: %llds remaining", (long long)remaining);
+                }
+            }
+        }
+    }
+    // Do NOT clear exposure_end_epoch when !is_exposing -- UI uses it to detect completion
+}
+
+typedef struct {
+    nina_api_stream_envelope_t env;
+    camera_stage_t cam;
+} camera_info_stream_t;
+
+static bool camera_info_stream_cb(json_stream_t *js, json_stream_event_t ev,
+                                  const json_stream_value_t *v, void *ctx) {
+    camera_info_stream_t *st = (camera_info_stream_t *)ctx;
+    if (ev == JSON_STREAM_EV_RESET) {
+        memset(st, 0, sizeof(*st));
+        return true;
+    }
+    nina_api_envelope_track(js, ev, v, &st->env);
+    if (ev == JSON_STREAM_EV_VALUE && json_stream_depth(js) == 2 &&
+        stream_key_is(js, 0, "Response")) {
+        camera_stage_field(&st->cam, json_stream_key_at(js, 1), v);
+    }
+    return true;
+}
+
 /**
  * @brief Fetch camera info - ALWAYS WORKS
  * Provides: IsExposing, ExposureEndTime, Temperature, CoolerPower, CameraState
@@ -38,37 +173,32 @@ void fetch_camera_info_robust(const char *base_url, nina_client_t *data) {
     char url[256];
     snprintf(url, sizeof(url), "%sequipment/camera/info", base_url);
 
+    camera_info_stream_t st = { 0 };
+    json_stream_t js;
+    json_stream_init(&js, camera_info_stream_cb, &st);
+
     /* Capture the NINA PC's own clock from the HTTP Date header, and stamp
      * the device monotonic clock ONCE right after the fetch returns so the
      * (epoch, mono) pair describes the same instant. */
     int64_t date_epoch = 0;
-    cJSON *json = http_get_json_dated(url, &date_epoch);
+    bool ok = http_get_json_stream(url, &js, &date_epoch);
     int64_t fetch_mono_us = esp_timer_get_time();
-    if (!json) {
-        // Transport failure / non-2xx / empty body — API unreachable.
+    if (!ok) {
+        // Transport failure / non-2xx / empty or malformed body — API unreachable.
         nina_fetch_set_offline(data);
         return;
     }
 
     // Honor the application-level Success flag: connectivity requires Success==true,
-    // not merely a non-NULL body. Recomputed every poll so a stuck `true` can't latch.
-    if (!nina_api_envelope_ok(json)) {
-        cJSON_Delete(json);
-        nina_fetch_set_offline(data);
-        return;
-    }
-
-    cJSON *response = nina_api_response(json);
-    if (!response) {
-        // Envelope OK but no Response object — treat as offline this poll
+    // not merely a well-formed body. Recomputed every poll so a stuck `true` can't latch.
+    if (!st.env.success || !st.env.has_response) {
+        // No Response object is treated as offline this poll too
         // (symmetric with fetch_equipment_info_bundled).
-        cJSON_Delete(json);
         nina_fetch_set_offline(data);
         return;
     }
 
     if (!nina_client_lock(data, FETCH_LOCK_MS)) {
-        cJSON_Delete(json);
         return;
     }
     data->connected = true;
@@ -76,63 +206,8 @@ void fetch_camera_info_robust(const char *base_url, nina_client_t *data) {
         data->nina_clock_epoch = date_epoch;
         data->nina_clock_mono_us = fetch_mono_us;
     }
-    {
-        // Camera name
-        cJSON *cam_name = cJSON_GetObjectItem(response, "Name");
-        if (cam_name && cam_name->valuestring && cam_name->valuestring[0] != '\0')
-            strncpy(data->camera_name, cam_name->valuestring, sizeof(data->camera_name) - 1);
-
-        // Camera state
-        cJSON *state = cJSON_GetObjectItem(response, "CameraState");
-        if (state && state->valuestring) {
-            strncpy(data->status, state->valuestring, sizeof(data->status) - 1);
-        }
-
-        // Temperature
-        cJSON *temp = cJSON_GetObjectItem(response, "Temperature");
-        if (temp) data->camera.temp = (float)temp->valuedouble;
-
-        // Cooler power
-        cJSON *cooler = cJSON_GetObjectItem(response, "CoolerPower");
-        if (cooler) data->camera.cooler_power = (float)cooler->valuedouble;
-
-        // Exposure time (total length per frame)
-        cJSON *exp_time = cJSON_GetObjectItem(response, "ExposureTime");
-        if (exp_time && exp_time->valuedouble > 0) {
-            data->exposure_total = (float)exp_time->valuedouble;
-        }
-
-        // Exposure status
-        cJSON *is_exposing = cJSON_GetObjectItem(response, "IsExposing");
-        cJSON *exp_end = cJSON_GetObjectItem(response, "ExposureEndTime");
-
-        data->is_exposing = (is_exposing && cJSON_IsTrue(is_exposing));
-
-        if (data->is_exposing && exp_end && exp_end->valuestring) {
-            time_t end_time = parse_iso8601(exp_end->valuestring);
-            /* Do the remaining-time math in the NINA clock domain: Date-derived
-             * "now" needs no boot-clock sanity guard; the time(NULL) fallback
-             * keeps the >2020 guard against an unset SNTP clock. */
-            int64_t now_nina = (date_epoch > 0) ? date_epoch : (int64_t)time(NULL);
-            bool now_valid = (date_epoch > 0) || (now_nina > 1577836800);
-
-            if (now_valid && end_time > 0) {
-                int64_t remaining = (int64_t)end_time - now_nina;
-                if (remaining >= 0 && remaining <= 7200) {
-                    data->exposure_current = -(float)remaining;
-                    data->exposure_end_epoch = (int64_t)end_time;
-                    if (data->exposure_total == 0 && remaining > 0) {
-                        data->exposure_total = (float)remaining;
-                    }
-                    ESP_LOGI(TAG, "Camera exposing: %llds remaining", (long long)remaining);
-                }
-            }
-        }
-        // Do NOT clear exposure_end_epoch when !is_exposing -- UI uses it to detect completion
-    }
+    camera_stage_commit(data, &st.cam, date_epoch, true);
     nina_client_unlock(data);
-
-    cJSON_Delete(json);
 }
 
 /**
@@ -193,8 +268,20 @@ void fetch_filter_robust_ex(const char *base_url, nina_client_t *data, bool fetc
  * when the image count hasn't changed (eliminates ~95% of redundant fetches).
  */
 int fetch_image_count(const char *base_url) {
+    return fetch_image_count_typed(base_url, NULL);
+}
+
+/**
+ * @brief Image count restricted to one imageType (e.g. "LIGHT"), or all
+ * types when @p image_type is NULL. Returns -1 on failure.
+ */
+int fetch_image_count_typed(const char *base_url, const char *image_type) {
     char url[256];
-    snprintf(url, sizeof(url), "%simage-history?count=true", base_url);
+    if (image_type) {
+        snprintf(url, sizeof(url), "%simage-history?count=true&imageType=%s", base_url, image_type);
+    } else {
+        snprintf(url, sizeof(url), "%simage-history?count=true", base_url);
+    }
 
     cJSON *json = http_get_json(url);
     if (!json) return -1;
@@ -407,10 +494,75 @@ void fetch_focuser_robust(const char *base_url, nina_client_t *data) {
     cJSON_Delete(json);
 }
 
+/**
+ * @brief Classify one ReadonlySwitches entry into the power fields.
+ * Shared by the cJSON (parse_switch_response) and streaming bundle paths.
+ */
+static void apply_readonly_switch(nina_client_t *data, const char *n, const char *d, double value) {
+    // Voltage
+    if (strcasecmp(n, "Input Voltage") == 0 || strstr(d, "oltage") || strstr(d, "Volts")) {
+        data->power.input_voltage = (float)value;
+    }
+    // Current
+    else if (strcasecmp(n, "Total Current") == 0 || strcasecmp(n, "Amp") == 0 ||
+             strstr(d, "urrent") || strstr(d, "Ampere")) {
+        data->power.total_amps = (float)value;
+        strncpy(data->power.amps_name, n, sizeof(data->power.amps_name) - 1);
+    }
+    // PWM readbacks (must check BEFORE watts/power)
+    else if ((strncasecmp(n, "pwm", 3) == 0 || strstr(d, "PWM") ||
+              strstr(d, "power output")) && data->power.pwm_count < 4) {
+        int idx = data->power.pwm_count;
+        data->power.pwm[idx] = (float)value;
+        strncpy(data->power.pwm_names[idx], n, sizeof(data->power.pwm_names[idx]) - 1);
+        data->power.pwm_count++;
+    }
+    // Power/Watts
+    else if (strcasecmp(n, "Total Power") == 0 || strcasecmp(n, "Watt") == 0 ||
+             strstr(d, "Watt")) {
+        data->power.total_watts = (float)value;
+        strncpy(data->power.watts_name, n, sizeof(data->power.watts_name) - 1);
+    }
+}
+
+/**
+ * @brief Classify one WritableSwitches entry (dew heaters) into the PWM list.
+ * Shared by the cJSON (parse_switch_response) and streaming bundle paths.
+ */
+static void apply_writable_switch(nina_client_t *data, const char *n, const char *d,
+                                  double value, int max_val) {
+    // Skip duplicates already in PWM list
+    for (int i = 0; i < data->power.pwm_count; i++) {
+        if (strcasecmp(data->power.pwm_names[i], n) == 0) {
+            return;
+        }
+    }
+
+    if (max_val == 100 && data->power.pwm_count < 4) {
+        int idx = data->power.pwm_count;
+        data->power.pwm[idx] = (float)value;
+        strncpy(data->power.pwm_names[idx], n, sizeof(data->power.pwm_names[idx]) - 1);
+        data->power.pwm_count++;
+    } else if (max_val > 1 &&
+               (strstr(d, "Dew") || strstr(d, "PWM") || strstr(d, "pwm")) &&
+               data->power.pwm_count < 4) {
+        int idx = data->power.pwm_count;
+        data->power.pwm[idx] = (float)value * 100.0f / max_val;
+        strncpy(data->power.pwm_names[idx], n, sizeof(data->power.pwm_names[idx]) - 1);
+        data->power.pwm_count++;
+    }
+}
+
+static void log_switch_summary(const nina_client_t *data) {
+    ESP_LOGI(TAG, "Switch: %.1fV, %.2fA, %.1fW, %d PWM outputs",
+        data->power.input_voltage, data->power.total_amps,
+        data->power.total_watts, data->power.pwm_count);
+}
+
 /**
  * @brief Parse switch/power response JSON into nina_client_t power fields.
- * Shared by both fetch_switch_info() and fetch_equipment_info_bundled().
- * @param response  The switch info cJSON object (Response from individual, or Switch sub-object from bundle)
+ * Used by fetch_switch_info(); the bundled fetcher streams the same fields.
+ * @param response  The switch info cJSON object (Response from the individual endpoint)
  * @param data      Client data to populate
  */
 static void parse_switch_response(cJSON *response, nina_client_t *data) {
@@ -432,33 +584,9 @@ static void parse_switch_response(cJSON *response, nina_client_t *data) {
             cJSON *value = cJSON_GetObjectItem(sw, "Value");
             if (!name || !name->valuestring || !value) continue;
 
-            const char *n = name->valuestring;
-            const char *d = desc && desc->valuestring ? desc->valuestring : "";
-
-            // Voltage
-            if (strcasecmp(n, "Input Voltage") == 0 || strstr(d, "oltage") || strstr(d, "Volts")) {
-                data->power.input_voltage = (float)value->valuedouble;
-            }
-            // Current
-            else if (strcasecmp(n, "Total Current") == 0 || strcasecmp(n, "Amp") == 0 ||
-                     strstr(d, "urrent") || strstr(d, "Ampere")) {
-                data->power.total_amps = (float)value->valuedouble;
-                strncpy(data->power.amps_name, n, sizeof(data->power.amps_name) - 1);
-            }
-            // PWM readbacks (must check BEFORE watts/power)
-            else if ((strncasecmp(n, "pwm", 3) == 0 || strstr(d, "PWM") ||
-                      strstr(d, "power output")) && data->power.pwm_count < 4) {
-                int idx = data->power.pwm_count;
-                data->power.pwm[idx] = (float)value->valuedouble;
-                strncpy(data->power.pwm_names[idx], n, sizeof(data->power.pwm_names[idx]) - 1);
-                data->power.pwm_count++;
-            }
-            // Power/Watts
-            else if (strcasecmp(n, "Total Power") == 0 || strcasecmp(n, "Watt") == 0 ||
-                     strstr(d, "Watt")) {
-                data->power.total_watts = (float)value->valuedouble;
-                strncpy(data->power.watts_name, n, sizeof(data->power.watts_name) - 1);
-            }
+            apply_readonly_switch(data, name->valuestring,
+                                  desc && desc->valuestring ? desc->valuestring : "",
+                                  value->valuedouble);
         }
     }
 
@@ -473,39 +601,13 @@ static void parse_switch_response(cJSON *response, nina_client_t *data) {
             cJSON *maximum = cJSON_GetObjectItem(sw, "Maximum");
             if (!name || !name->valuestring || !value || !maximum) continue;
 
-            const char *n = name->valuestring;
-            const char *d = desc && desc->valuestring ? desc->valuestring : "";
-            int max_val = maximum->valueint;
-
-            // Skip duplicates already in PWM list
-            bool duplicate = false;
-            for (int i = 0; i < data->power.pwm_count; i++) {
-                if (strcasecmp(data->power.pwm_names[i], n) == 0) {
-                    duplicate = true;
-                    break;
-                }
-            }
-            if (duplicate) continue;
-
-            if (max_val == 100 && data->power.pwm_count < 4) {
-                int idx = data->power.pwm_count;
-                data->power.pwm[idx] = (float)value->valuedouble;
-                strncpy(data->power.pwm_names[idx], n, sizeof(data->power.pwm_names[idx]) - 1);
-                data->power.pwm_count++;
-            } else if (max_val > 1 &&
-                       (strstr(d, "Dew") || strstr(d, "PWM") || strstr(d, "pwm")) &&
-                       data->power.pwm_count < 4) {
-                int idx = data->power.pwm_count;
-                data->power.pwm[idx] = (float)value->valuedouble * 100.0f / max_val;
-                strncpy(data->power.pwm_names[idx], n, sizeof(data->power.pwm_names[idx]) - 1);
-                data->power.pwm_count++;
-            }
+            apply_writable_switch(data, name->valuestring,
+                                  desc && desc->valuestring ? desc->valuestring : "",
+                                  value->valuedouble, maximum->valueint);
         }
     }
 
-    ESP_LOGI(TAG, "Switch: %.1fV, %.2fA, %.1fW, %d PWM outputs",
-        data->power.input_voltage, data->power.total_amps,
-        data->power.total_watts, data->power.pwm_count);
+    log_switch_summary(data);
 }
 
 /**
@@ -558,234 +660,370 @@ void fetch_safety_monitor_info(const char *base_url, nina_client_t *data) {
     cJSON_Delete(json);
 }
 
-/**
- * @brief Fetch all equipment info from the bundled /equipment/info endpoint.
- * ninaAPI 2.2.15+ returns Camera, FilterWheel, Focuser, Guider, Mount, Switch,
- * SafetyMonitor (and more) in a single HTTP response, replacing 7+ individual calls.
- *
- * @return 0 on success, -1 on HTTP failure (offline), -2 if endpoint unavailable
- */
-int fetch_equipment_info_bundled(const char *base_url, nina_client_t *data, bool fetch_filter_list,
-                                uint16_t *out_connected_mask) {
-    if (out_connected_mask) *out_connected_mask = 0;
-
-    char url[256];
-    snprintf(url, sizeof(url), "%sequipment/info", base_url);
+/* Switch entries staged per list. NINA switch hubs (PPBA, UPBv2, ...) expose
+ * around a dozen; entries beyond this are ignored. */
+#define BUNDLE_MAX_SWITCHES 16
+
+typedef struct {
+    char name[32];
+    bool has_name;
+    char desc[64];
+    bool has_value;
+    double value;
+    bool has_max;
+    int max;
+} switch_stage_t;
+
+typedef struct {
+    char name[32];
+    bool has_name;
+    bool has_id;
+    int id;
+} filter_stage_t;
+
+/* Everything fetch_equipment_info_bundled() commits, staged while streaming.
+ * ~3KB, so it lives on the heap rather than the 8KB poll-task stack. */
+typedef struct {
+    nina_api_stream_envelope_t env;
+    uint16_t connected_mask;
+
+    bool has_camera;
+    camera_stage_t cam;
+
+    bool has_guider;
+    bool guider_conn_present;
+    bool guider_connected;
+    bool has_rms;
+    bool has_rms_total, has_rms_ra, has_rms_dec;
+    float rms_total, rms_ra, rms_dec;
+
+    char sel_filter[32];
+    bool has_sel_filter;
+    bool has_avail_filters;
+    int avail_count;                       /* elements seen (may exceed MAX_FILTERS) */
+    filter_stage_t filters[MAX_FILTERS];
+
+    bool has_focuser_pos;
+    int focuser_pos;
+
+    char meridian_flip[16];
+    bool has_meridian_flip;
+
+    bool has_switch;
+    bool switch_connected;
+    int readonly_count;
+    int writable_count;
+    switch_stage_t readonly_sw[BUNDLE_MAX_SWITCHES];
+    switch_stage_t writable_sw[BUNDLE_MAX_SWITCHES];
+
+    bool safety_connected;
+    bool safety_is_safe;
+} bundle_stream_t;
+
+/* Bit positions match equipment_type_t in nina_websocket.c:
+ * 0=Camera, 1=Mount, 2=Guider, 3=Focuser, 4=Filterwheel,
+ * 5=Rotator, 6=Safety, 7=Dome, 8=Flat, 9=Switch, 10=Weather */
+static int bundle_eq_bit(const char *key) {
+    static const struct { const char *key; int bit; } eq_map[] = {
+        {"Camera",        0}, {"Mount",         1}, {"Guider",       2},
+        {"Focuser",       3}, {"FilterWheel",   4}, {"Rotator",      5},
+        {"SafetyMonitor", 6}, {"Dome",          7}, {"FlatDevice",   8},
+        {"Switch",        9}, {"WeatherData",  10},
+    };
+    for (int i = 0; i < (int)(sizeof(eq_map) / sizeof(eq_map[0])); i++) {
+        if (strcmp(key, eq_map[i].key) == 0) return eq_map[i].bit;
+    }
+    return -1;
+}
 
-    /* Capture NINA's own clock (HTTP Date header) + a device monotonic stamp
-     * taken ONCE right after the fetch returns (same pattern as
-     * fetch_camera_info_robust). */
-    int64_t date_epoch = 0;
-    cJSON *json = http_get_json_dated(url, &date_epoch);
-    int64_t fetch_mono_us = esp_timer_get_time();
-    if (!json) {
-        // Transport failure / non-2xx / empty body — API unreachable.
-        nina_fetch_set_offline(data);
-        return -1;
+static void switch_stage_field(switch_stage_t *sw, const char *key, const json_stream_value_t *v) {
+    if (strcmp(key, "Name") == 0) {
+        sw->has_name = sv_copy_str(sw->name, sizeof(sw->name), v);
+    } else if (strcmp(key, "Description") == 0) {
+        sv_copy_str(sw->desc, sizeof(sw->desc), v);
+    } else if (strcmp(key, "Value") == 0) {
+        sw->value = sv_num(v);
+        sw->has_value = true;
+    } else if (strcmp(key, "Maximum") == 0) {
+        sw->max = sv_int(v);
+        sw->has_max = true;
     }
+}
 
-    // Honor the application-level Success flag: a 2xx body with Success!=true
-    // means the API is up but reported a failure — treat as offline this poll.
-    if (!nina_api_envelope_ok(json)) {
-        cJSON_Delete(json);
-        nina_fetch_set_offline(data);
-        return -1;
+/* Response.<Equipment>.<key> scalar (depth 3). */
+static void bundle_equipment_value(bundle_stream_t *b, const char *eq, const char *key,
+                                   const json_stream_value_t *v) {
+    if (strcmp(key, "Connected") == 0 && sv_true(v)) {
+        int bit = bundle_eq_bit(eq);
+        if (bit >= 0) b->connected_mask |= (uint16_t)(1 << bit);
     }
 
-    cJSON *response = nina_api_response(json);
-    if (!response) {
-        // Envelope OK but no Response object — may be a 404 or unsupported endpoint
-        cJSON_Delete(json);
-        nina_fetch_set_offline(data);
-        return -2;
+    if (strcmp(eq, "Camera") == 0) {
+        camera_stage_field(&b->cam, key, v);
+    } else if (strcmp(eq, "Guider") == 0) {
+        if (strcmp(key, "Connected") == 0) {
+            b->guider_conn_present = true;
+            b->guider_connected = sv_true(v);
+        } else if (strcmp(key, "RMSError") == 0) {
+            b->has_rms = true;  /* present but not an object (e.g. null) */
+        }
+    } else if (strcmp(eq, "Focuser") == 0) {
+        if (strcmp(key, "Position") == 0) {
+            b->focuser_pos = sv_int(v);
+            b->has_focuser_pos = true;
+        }
+    } else if (strcmp(eq, "Mount") == 0) {
+        if (strcmp(key, "TimeToMeridianFlipString") == 0) {
+            b->has_meridian_flip = sv_copy_str(b->meridian_flip, sizeof(b->meridian_flip), v);
+        }
+    } else if (strcmp(eq, "Switch") == 0) {
+        if (strcmp(key, "Connected") == 0) b->switch_connected = sv_true(v);
+    } else if (strcmp(eq, "SafetyMonitor") == 0) {
+        if (strcmp(key, "Connected") == 0) b->safety_connected = sv_true(v);
+        else if (strcmp(key, "IsSafe") == 0) b->safety_is_safe = sv_true(v);
     }
+}
 
-    // Envelope is OK with a Response object — the API is reachable this poll.
-    // Commit all parsed equipment fields atomically under the client lock. On
-    // timeout, skip the write section but still return success (data one cycle stale).
-    if (!nina_client_lock(data, FETCH_LOCK_MS)) {
-        cJSON_Delete(json);
-        return 0;
+static bool bundle_stream_cb(json_stream_t *js, json_stream_event_t ev,
+                             const json_stream_value_t *v, void *ctx) {
+    bundle_stream_t *b = (bundle_stream_t *)ctx;
+    if (ev == JSON_STREAM_EV_RESET) {
+        memset(b, 0, sizeof(*b));
+        return true;
     }
-    data->connected = true;
-    if (date_epoch > 0) {
-        data->nina_clock_epoch = date_epoch;
-        data->nina_clock_mono_us = fetch_mono_us;
+    nina_api_envelope_track(js, ev, v, &b->env);
+
+    int depth = json_stream_depth(js);
+    if (depth < 2 || !stream_key_is(js, 0, "Response")) return true;
+    const char *eq = json_stream_key_at(js, 1);
+    if (!eq) return true;
+
+    if (depth == 2) {
+        if (ev != JSON_STREAM_EV_OBJECT_BEGIN) return true;
+        if (strcmp(eq, "Camera") == 0) b->has_camera = true;
+        else if (strcmp(eq, "Guider") == 0) b->has_guider = true;
+        else if (strcmp(eq, "Switch") == 0) b->has_switch = true;
+        return true;
     }
 
-    // ── Camera ──
-    cJSON *camera = cJSON_GetObjectItem(response, "Camera");
-    if (camera) {
-        cJSON *cam_name = cJSON_GetObjectItem(camera, "Name");
-        if (cam_name && cam_name->valuestring && cam_name->valuestring[0] != '\0')
-            strncpy(data->camera_name, cam_name->valuestring, sizeof(data->camera_name) - 1);
-
-        cJSON *state = cJSON_GetObjectItem(camera, "CameraState");
-        if (state && state->valuestring)
-            strncpy(data->status, state->valuestring, sizeof(data->status) - 1);
-
-        cJSON *temp = cJSON_GetObjectItem(camera, "Temperature");
-        if (temp) data->camera.temp = (float)temp->valuedouble;
-
-        cJSON *cooler = cJSON_GetObjectItem(camera, "CoolerPower");
-        if (cooler) data->camera.cooler_power = (float)cooler->valuedouble;
-
-        // Exposure time (total length per frame)
-        cJSON *exp_time_cam = cJSON_GetObjectItem(camera, "ExposureTime");
-        if (exp_time_cam && exp_time_cam->valuedouble > 0) {
-            data->exposure_total = (float)exp_time_cam->valuedouble;
+    const char *key = json_stream_key_at(js, 2);
+    if (!key) return true;
+
+    if (depth == 3) {
+        if (ev == JSON_STREAM_EV_VALUE) {
+            bundle_equipment_value(b, eq, key, v);
+        } else if (ev == JSON_STREAM_EV_OBJECT_BEGIN || ev == JSON_STREAM_EV_ARRAY_BEGIN) {
+            if (strcmp(eq, "Guider") == 0 && strcmp(key, "RMSError") == 0) {
+                b->has_rms = true;
+            } else if (ev == JSON_STREAM_EV_ARRAY_BEGIN && strcmp(eq, "FilterWheel") == 0 &&
+                       strcmp(key, "AvailableFilters") == 0) {
+                b->has_avail_filters = true;
+            }
         }
+        return true;
+    }
 
-        // Exposure timing
-        cJSON *is_exposing = cJSON_GetObjectItem(camera, "IsExposing");
-        cJSON *exp_end = cJSON_GetObjectItem(camera, "ExposureEndTime");
-
-        data->is_exposing = (is_exposing && cJSON_IsTrue(is_exposing));
-
-        if (data->is_exposing && exp_end && exp_end->valuestring) {
-            time_t end_time = parse_iso8601(exp_end->valuestring);
-            /* NINA-domain "now": Date-derived needs no boot-clock guard; the
-             * time(NULL) fallback keeps the >2020 unset-SNTP guard. */
-            int64_t now_nina = (date_epoch > 0) ? date_epoch : (int64_t)time(NULL);
-            bool now_valid = (date_epoch > 0) || (now_nina > 1577836800);
-            if (now_valid && end_time > 0) {
-                int64_t remaining = (int64_t)end_time - now_nina;
-                if (remaining >= 0 && remaining <= 7200) {
-                    data->exposure_current = -(float)remaining;
-                    data->exposure_end_epoch = (int64_t)end_time;
-                    if (data->exposure_total == 0 && remaining > 0) {
-                        data->exposure_total = (float)remaining;
-                    }
-                }
+    if (ev != JSON_STREAM_EV_VALUE) {
+        /* Count array elements as they open, so a Name-less entry still
+         * occupies its index (matches the cJSON loop's indexing). */
+        if (depth == 4 && (ev == JSON_STREAM_EV_OBJECT_BEGIN || ev == JSON_STREAM_EV_ARRAY_BEGIN)) {
+            if (json_stream_path_is(js, "Response.FilterWheel.AvailableFilters[]")) {
+                b->avail_count++;
+            } else if (json_stream_path_is(js, "Response.Switch.ReadonlySwitches[]")) {
+                b->readonly_count++;
+            } else if (json_stream_path_is(js, "Response.Switch.WritableSwitches[]")) {
+                b->writable_count++;
+            }
+        }
+        return true;
+    }
+
+    if (json_stream_path_is(js, "Response.Guider.RMSError.Total.Arcseconds")) {
+        b->rms_total = (float)sv_num(v);
+        b->has_rms_total = true;
+    } else if (json_stream_path_is(js, "Response.Guider.RMSError.RA.Arcseconds")) {
+        b->rms_ra = (float)sv_num(v);
+        b->has_rms_ra = true;
+    } else if (json_stream_path_is(js, "Response.Guider.RMSError.Dec.Arcseconds")) {
+        b->rms_dec = (float)sv_num(v);
+        b->has_rms_dec = true;
+    } else if (json_stream_path_is(js, "Response.FilterWheel.SelectedFilter.Name")) {
+        b->has_sel_filter = sv_copy_str(b->sel_filter, sizeof(b->sel_filter), v);
+    } else if (depth == 5) {
+        int idx = json_stream_index_at(js, 3);
+        const char *field = json_stream_key_at(js, 4);
+        if (idx < 0 || !field) return true;
+
+        if (json_stream_path_is(js, "Response.FilterWheel.AvailableFilters[].Name") ||
+            json_stream_path_is(js, "Response.FilterWheel.AvailableFilters[].Id")) {
+            if (idx >= MAX_FILTERS) return true;
+            filter_stage_t *f = &b->filters[idx];
+            if (strcmp(field, "Name") == 0) {
+                f->has_name = sv_copy_str(f->name, sizeof(f->name), v);
+            } else {
+                f->id = sv_int(v);
+                f->has_id = true;
+            }
+        } else if (strcmp(eq, "Switch") == 0 && idx < BUNDLE_MAX_SWITCHES) {
+            if (strcmp(key, "ReadonlySwitches") == 0) {
+                switch_stage_field(&b->readonly_sw[idx], field, v);
+            } else if (strcmp(key, "WritableSwitches") == 0) {
+                switch_stage_field(&b->writable_sw[idx], field, v);
             }
         }
     }
+    return true;
+}
+
+/* Apply a staged bundle. Caller holds the client lock. Mirrors the field
+ * semantics of the per-endpoint cJSON fetchers. */
+static void bundle_stream_commit(nina_client_t *data, const bundle_stream_t *b,
+                                 bool fetch_filter_list, int64_t date_epoch) {
+    // ── Camera ──
+    if (b->has_camera) {
+        camera_stage_commit(data, &b->cam, date_epoch, false);
+    }
 
     // ── Guider ──
-    cJSON *guider = cJSON_GetObjectItem(response, "Guider");
-    if (guider) {
-        cJSON *guider_conn = cJSON_GetObjectItem(guider, "Connected");
-        cJSON *rms = cJSON_GetObjectItem(guider, "RMSError");
+    if (b->has_guider) {
         // Guider disconnected or no RMS payload: zero the values so the UI does
         // not render stale guiding numbers for a guider that is no longer guiding.
-        if ((guider_conn && !cJSON_IsTrue(guider_conn)) || !rms) {
+        if ((b->guider_conn_present && !b->guider_connected) || !b->has_rms) {
             data->guider.rms_total = 0;
             data->guider.rms_ra = 0;
             data->guider.rms_dec = 0;
         } else {
-            cJSON *total = cJSON_GetObjectItem(rms, "Total");
-            if (total) {
-                cJSON *arcsec = cJSON_GetObjectItem(total, "Arcseconds");
-                if (arcsec) data->guider.rms_total = (float)arcsec->valuedouble;
-            }
-            cJSON *ra = cJSON_GetObjectItem(rms, "RA");
-            if (ra) {
-                cJSON *arcsec = cJSON_GetObjectItem(ra, "Arcseconds");
-                if (arcsec) data->guider.rms_ra = (float)arcsec->valuedouble;
-            }
-            cJSON *dec = cJSON_GetObjectItem(rms, "Dec");
-            if (dec) {
-                cJSON *arcsec = cJSON_GetObjectItem(dec, "Arcseconds");
-                if (arcsec) data->guider.rms_dec = (float)arcsec->valuedouble;
-            }
+            if (b->has_rms_total) data->guider.rms_total = b->rms_total;
+            if (b->has_rms_ra) data->guider.rms_ra = b->rms_ra;
+            if (b->has_rms_dec) data->guider.rms_dec = b->rms_dec;
             ESP_LOGI(TAG, "Guiding RMS - Total: %.2f\", RA: %.2f\", DEC: %.2f\"",
                 data->guider.rms_total, data->guider.rms_ra, data->guider.rms_dec);
         }
     }
 
     // ── Filter Wheel ──
-    cJSON *fw = cJSON_GetObjectItem(response, "FilterWheel");
-    if (fw) {
-        cJSON *sel = cJSON_GetObjectItem(fw, "SelectedFilter");
-        if (sel) {
-            cJSON *name = cJSON_GetObjectItem(sel, "Name");
-            if (name && name->valuestring) {
-                strncpy(data->current_filter, name->valuestring, sizeof(data->current_filter) - 1);
-            }
-        }
-
-        if (fetch_filter_list) {
-            cJSON *avail = cJSON_GetObjectItem(fw, "AvailableFilters");
-            if (avail && cJSON_IsArray(avail)) {
-                int count = cJSON_GetArraySize(avail);
-                if (count > MAX_FILTERS) count = MAX_FILTERS;
-                data->filter_count = 0;
-                for (int i = 0; i < count; i++) {
-                    cJSON *f = cJSON_GetArrayItem(avail, i);
-                    if (f) {
-                        cJSON *fn = cJSON_GetObjectItem(f, "Name");
-                        cJSON *fi = cJSON_GetObjectItem(f, "Id");
-                        if (fn && fn->valuestring) {
-                            strncpy(data->filters[i].name, fn->valuestring,
-                                    sizeof(data->filters[i].name) - 1);
-                            data->filters[i].id = fi ? fi->valueint : i;
-                            data->filter_count++;
-                        }
-                    }
-                }
-                ESP_LOGI(TAG, "Found %d available filters (bundled)", data->filter_count);
+    if (b->has_sel_filter) {
+        strlcpy(data->current_filter, b->sel_filter, sizeof(data->current_filter));
+    }
+    if (fetch_filter_list && b->has_avail_filters) {
+        int count = b->avail_count;
+        if (count > MAX_FILTERS) count = MAX_FILTERS;
+        data->filter_count = 0;
+        for (int i = 0; i < count; i++) {
+            const filter_stage_t *f = &b->filters[i];
+            if (f->has_name) {
+                strncpy(data->filters[i].name, f->name, sizeof(data->filters[i].name) - 1);
+                data->filters[i].id = f->has_id ? f->id : i;
+                data->filter_count++;
             }
         }
+        ESP_LOGI(TAG, "Found %d available filters (bundled)", data->filter_count);
     }
 
     // ── Focuser ──
-    cJSON *focuser = cJSON_GetObjectItem(response, "Focuser");
-    if (focuser) {
-        cJSON *pos = cJSON_GetObjectItem(focuser, "Position");
-        if (pos) data->focuser.position = pos->valueint;
-    }
+    if (b->has_focuser_pos) data->focuser.position = b->focuser_pos;
 
     // ── Mount ──
-    cJSON *mount = cJSON_GetObjectItem(response, "Mount");
-    if (mount) {
-        cJSON *flip = cJSON_GetObjectItem(mount, "TimeToMeridianFlipString");
-        if (flip && flip->valuestring)
-            strncpy(data->meridian_flip, flip->valuestring, sizeof(data->meridian_flip) - 1);
+    if (b->has_meridian_flip) {
+        strlcpy(data->meridian_flip, b->meridian_flip, sizeof(data->meridian_flip));
     }
 
     // ── Switch ──
-    cJSON *sw = cJSON_GetObjectItem(response, "Switch");
-    if (sw) {
-        parse_switch_response(sw, data);
+    if (b->has_switch && b->switch_connected) {
+        data->power.switch_connected = true;
+        data->power.pwm_count = 0;
+
+        int n = b->readonly_count < BUNDLE_MAX_SWITCHES ? b->readonly_count : BUNDLE_MAX_SWITCHES;
+        for (int i = 0; i < n; i++) {
+            const switch_stage_t *sw = &b->readonly_sw[i];
+            if (!sw->has_name || !sw->has_value) continue;
+            apply_readonly_switch(data, sw->name, sw->desc, sw->value);
+        }
+        n = b->writable_count < BUNDLE_MAX_SWITCHES ? b->writable_count : BUNDLE_MAX_SWITCHES;
+        for (int i = 0; i < n; i++) {
+            const switch_stage_t *sw = &b->writable_sw[i];
+            if (!sw->has_name || !sw->has_value || !sw->has_max) continue;
+            apply_writable_switch(data, sw->name, sw->desc, sw->value, sw->max);
+        }
+        log_switch_summary(data);
     }
 
     // ── Safety Monitor ──
-    cJSON *safety = cJSON_GetObjectItem(response, "SafetyMonitor");
-    if (safety) {
-        cJSON *conn = cJSON_GetObjectItem(safety, "Connected");
-        if (conn && cJSON_IsTrue(conn)) {
-            data->safety_connected = true;
-            cJSON *is_safe = cJSON_GetObjectItem(safety, "IsSafe");
-            data->safety_is_safe = is_safe && cJSON_IsTrue(is_safe);
-        }
+    if (b->safety_connected) {
+        data->safety_connected = true;
+        data->safety_is_safe = b->safety_is_safe;
     }
-    nina_client_unlock(data);
+}
 
-    /* Build equipment connected bitmask from Connected fields.
-     * Bit positions match equipment_type_t in nina_websocket.c:
-     * 0=Camera, 1=Mount, 2=Guider, 3=Focuser, 4=Filterwheel,
-     * 5=Rotator, 6=Safety, 7=Dome, 8=Flat, 9=Switch, 10=Weather */
-    if (out_connected_mask) {
-        uint16_t mask = 0;
-        static const struct { const char *key; int bit; } eq_map[] = {
-            {"Camera",        0}, {"Mount",         1}, {"Guider",       2},
-            {"Focuser",       3}, {"FilterWheel",   4}, {"Rotator",      5},
-            {"SafetyMonitor", 6}, {"Dome",          7}, {"FlatDevice",   8},
-            {"Switch",        9}, {"WeatherData",  10},
-        };
-        for (int i = 0; i < (int)(sizeof(eq_map) / sizeof(eq_map[0])); i++) {
-            cJSON *eq = cJSON_GetObjectItem(response, eq_map[i].key);
-            if (eq) {
-                cJSON *conn = cJSON_GetObjectItem(eq, "Connected");
-                if (conn && cJSON_IsTrue(conn)) {
-                    mask |= (1 << eq_map[i].bit);
-                }
-            }
+/**
+ * @brief Fetch all equipment info from the bundled /equipment/info endpoint.
+ * ninaAPI 2.2.15+ returns Camera, FilterWheel, Focuser, Guider, Mount, Switch,
+ * SafetyMonitor (and more) in a single HTTP response, replacing 7+ individual calls.
+ * Streamed (json_stream): the bundle is the largest per-cycle response.
+ *
+ * @return 0 on success, -1 on HTTP failure (offline), -2 if endpoint unavailable
+ */
+int fetch_equipment_info_bundled(const char *base_url, nina_client_t *data, bool fetch_filter_list,
+                                uint16_t *out_connected_mask) {
+    if (out_connected_mask) *out_connected_mask = 0;
+
+    char url[256];
+    snprintf(url, sizeof(url), "%sequipment/info", base_url);
+
+    bundle_stream_t *b = heap_caps_calloc(1, sizeof(*b), MALLOC_CAP_SPIRAM);
+    if (!b) {
+        ESP_LOGW(TAG, "bundle: no memory for staging");
+        return -1;
+    }
+    json_stream_t js;
+    json_stream_init(&js, bundle_stream_cb, b);
+
+    /* Capture NINA's own clock (HTTP Date header) + a device monotonic stamp
+     * taken ONCE right after the fetch returns (same pattern as
+     * fetch_camera_info_robust). */
+    int64_t date_epoch = 0;
+    bool ok = http_get_json_stream(url, &js, &date_epoch);
+    int64_t fetch_mono_us = esp_timer_get_time();
+    if (!ok) {
+        // Transport failure / non-2xx / empty or malformed body — API unreachable.
+        heap_caps_free(b);
+        nina_fetch_set_offline(data);
+        return -1;
+    }
+
+    // Honor the application-level Success flag: a 2xx body with Success!=true
+    // means the API is up but reported a failure — treat as offline this poll.
+    if (!b->env.success) {
+        heap_caps_free(b);
+        nina_fetch_set_offline(data);
+        return -1;
+    }
+
+    if (!b->env.has_response) {
+        // Envelope OK but no Response object — may be a 404 or unsupported endpoint
+        heap_caps_free(b);
+        nina_fetch_set_offline(data);
+        return -2;
+    }
+
+    // Envelope is OK with a Response object — the API is reachable this poll.
+    // Commit all parsed equipment fields atomically under the client lock. On
+    // timeout, skip the write section but still return success (data one cycle stale).
+    if (nina_client_lock(data, FETCH_LOCK_MS)) {
+        data->connected = true;
+        if (date_epoch > 0) {
+            data->nina_clock_epoch = date_epoch;
+            data->nina_clock_mono_us = fetch_mono_us;
         }
-        *out_connected_mask = mask;
+        bundle_stream_commit(data, b, fetch_filter_list, date_epoch);
+        nina_client_unlock(data);
+
+        /* Equipment connected bitmask from the Connected fields (see
+         * bundle_eq_bit() for the bit layout). */
+        if (out_connected_mask) *out_connected_mask = b->connected_mask;
     }
 
-    cJSON_Delete(json);
+    heap_caps_free(b);
     return 0;
 }
 
@@ -1335,9 +1573,82 @@ void fetch_sequence_details(const char *base_url, sequence_detail_data_t *out) {
 #include "ui/nina_graph_overlay.h"
 #include <math.h>
 
+/* In-place reversal helper for the streamed guider ring below: it is
+ * unrolled into output order with three reversals, so no second
+ * GRAPH_MAX_POINTS scratch array is needed. */
+static void reverse_floats(float *a, int lo, int hi) {
+    for (hi--; lo < hi; lo++, hi--) {
+        float t = a[lo]; a[lo] = a[hi]; a[hi] = t;
+    }
+}
+
+/* Streaming state for fetch_guider_graph(): GuideSteps[] is unbounded (it
+ * grows for the whole session), so only the last `window` steps are kept, in
+ * out->ra/out->dec used as a ring. */
+typedef struct {
+    graph_rms_data_t *out;
+    int window;
+    int seen;
+    bool has_pixel_scale;
+    float pixel_scale;
+} guider_graph_stream_t;
+
+static bool guider_graph_stream_cb(json_stream_t *js, json_stream_event_t ev,
+                                   const json_stream_value_t *v, void *ctx) {
+    guider_graph_stream_t *g = (guider_graph_stream_t *)ctx;
+    graph_rms_data_t *out = g->out;
+    if (ev == JSON_STREAM_EV_RESET) {
+        memset(out, 0, sizeof(*out));
+        g->seen = 0;
+        g->has_pixel_scale = false;
+        return true;
+    }
+
+    int depth = json_stream_depth(js);
+    if (depth < 2 || !stream_key_is(js, 0, "Response")) return true;
+
+    if (depth == 3 && ev != JSON_STREAM_EV_OBJECT_END && ev != JSON_STREAM_EV_ARRAY_END &&
+        json_stream_path_is(js, "Response.GuideSteps[]")) {
+        /* New step: claim the next ring slot (zeroed, like a step with
+         * missing RADistanceRaw/DECDistanceRaw). */
+        if (g->window > 0) {
+            int slot = g->seen % g->window;
+            out->ra[slot] = 0;
+            out->dec[slot] = 0;
+        }
+        g->seen++;
+        return true;
+    }
+    if (ev != JSON_STREAM_EV_VALUE) return true;
+
+    if (depth == 4 && g->window > 0 && g->seen > 0 && stream_key_is(js, 1, "GuideSteps")) {
+        int slot = (g->seen - 1) % g->window;
+        if (json_stream_path_is(js, "Response.GuideSteps[].RADistanceRaw")) {
+            out->ra[slot] = (float)sv_num(v);
+        } else if (json_stream_path_is(js, "Response.GuideSteps[].DECDistanceRaw")) {
+            out->dec[slot] = (float)sv_num(v);
+        }
+    } else if (depth == 3 && stream_key_is(js, 1, "RMS")) {
+        const char *k = json_stream_key_at(js, 2);
+        float f = (float)sv_num(v);
+        if (!k) return true;
+        if (strcmp(k, "RA") == 0) out->rms_ra = f;
+        else if (strcmp(k, "Dec") == 0) out->rms_dec = f;
+        else if (strcmp(k, "Total") == 0) out->rms_total = f;
+        else if (strcmp(k, "PeakRA") == 0) out->peak_ra = f;
+        else if (strcmp(k, "PeakDec") == 0) out->peak_dec = f;
+        else if (strcmp(k, "Scale") == 0) out->pixel_scale = f;
+    } else if (depth == 2 && stream_key_is(js, 1, "PixelScale")) {
+        g->pixel_scale = (float)sv_num(v);
+        g->has_pixel_scale = true;
+    }
+    return true;
+}
+
 /**
  * @brief Fetch guider graph history from /equipment/guider/graph
  * Populates graph_rms_data_t with RA/DEC raw distance values and RMS summary.
+ * Streamed: only the most recent max_points steps are ever held.
  */
 void fetch_guider_graph(const char *base_url, graph_rms_data_t *out, int max_points) {
     if (!out) return;
@@ -1346,146 +1657,237 @@ void fetch_guider_graph(const char *base_url, graph_rms_data_t *out, int max_poi
     char url[256];
     snprintf(url, sizeof(url), "%sequipment/guider/graph", base_url);
 
-    cJSON *json = http_get_json(url);
-    if (!json) return;
+    if (max_points > GRAPH_MAX_POINTS) max_points = GRAPH_MAX_POINTS;
+    guider_graph_stream_t g = { .out = out, .window = max_points > 0 ? max_points : 0 };
+    json_stream_t js;
+    json_stream_init(&js, guider_graph_stream_cb, &g);
 
-    cJSON *response = cJSON_GetObjectItem(json, "Response");
-    if (!response) { cJSON_Delete(json); return; }
+    if (!http_get_json_stream(url, &js, NULL)) {
+        memset(out, 0, sizeof(graph_rms_data_t));
+        return;
+    }
 
-    /* Parse RMS summary */
-    cJSON *rms = cJSON_GetObjectItem(response, "RMS");
-    if (rms) {
-        cJSON *ra = cJSON_GetObjectItem(rms, "RA");
-        cJSON *dec = cJSON_GetObjectItem(rms, "Dec");
-        cJSON *total = cJSON_GetObjectItem(rms, "Total");
-        cJSON *peak_ra = cJSON_GetObjectItem(rms, "PeakRA");
-        cJSON *peak_dec = cJSON_GetObjectItem(rms, "PeakDec");
-        cJSON *pscale = cJSON_GetObjectItem(rms, "Scale");
-
-        if (ra) out->rms_ra = (float)ra->valuedouble;
-        if (dec) out->rms_dec = (float)dec->valuedouble;
-        if (total) out->rms_total = (float)total->valuedouble;
-        if (peak_ra) out->peak_ra = (float)peak_ra->valuedouble;
-        if (peak_dec) out->peak_dec = (float)peak_dec->valuedouble;
-        if (pscale) out->pixel_scale = (float)pscale->valuedouble;
-    }
-
-    /* Parse pixel scale from response level */
-    cJSON *ps = cJSON_GetObjectItem(response, "PixelScale");
-    if (ps) out->pixel_scale = (float)ps->valuedouble;
-
-    /* Parse guide steps array */
-    cJSON *steps = cJSON_GetObjectItem(response, "GuideSteps");
-    if (steps && cJSON_IsArray(steps)) {
-        int total_steps = cJSON_GetArraySize(steps);
-        /* Take last max_points steps (most recent) */
-        int start = 0;
-        if (total_steps > max_points) start = total_steps - max_points;
-        if (max_points > GRAPH_MAX_POINTS) max_points = GRAPH_MAX_POINTS;
-
-        int idx = 0;
-        for (int i = start; i < total_steps && idx < GRAPH_MAX_POINTS; i++) {
-            cJSON *step = cJSON_GetArrayItem(steps, i);
-            if (!step) continue;
-
-            cJSON *ra_raw = cJSON_GetObjectItem(step, "RADistanceRaw");
-            cJSON *dec_raw = cJSON_GetObjectItem(step, "DECDistanceRaw");
-
-            out->ra[idx] = ra_raw ? (float)ra_raw->valuedouble : 0;
-            out->dec[idx] = dec_raw ? (float)dec_raw->valuedouble : 0;
-            /* Total computed from RA and DEC */
-            out->total[idx] = sqrtf(out->ra[idx] * out->ra[idx] +
-                                    out->dec[idx] * out->dec[idx]);
-            idx++;
-        }
-        out->count = idx;
+    /* Response-level PixelScale wins over RMS.Scale regardless of order */
+    if (g.has_pixel_scale) out->pixel_scale = g.pixel_scale;
+
+    /* Unroll the ring oldest-first: rotate left by the oldest slot. */
+    int n = g.seen < g.window ? g.seen : g.window;
+    int head = (g.seen > g.window && g.window > 0) ? g.seen % g.window : 0;
+    if (head > 0) {
+        reverse_floats(out->ra, 0, head);
+        reverse_floats(out->ra, head, n);
+        reverse_floats(out->ra, 0, n);
+        reverse_floats(out->dec, 0, head);
+        reverse_floats(out->dec, head, n);
+        reverse_floats(out->dec, 0, n);
     }
+    for (int i = 0; i < n; i++) {
+        /* Total computed from RA and DEC */
+        out->total[i] = sqrtf(out->ra[i] * out->ra[i] + out->dec[i] * out->dec[i]);
+    }
+    out->count = n;
 
     ESP_LOGI(TAG, "Guider graph: %d steps, RMS=%.2f\"", out->count, out->rms_total);
-    cJSON_Delete(json);
 }
 
-/**
- * @brief Fetch HFR history from /image-history?all=true&imageType=LIGHT
- * Populates graph_hfr_data_t with HFR values from each captured image.
- */
-void fetch_hfr_history(const char *base_url, graph_hfr_data_t *out, int max_points) {
-    if (!out) return;
-    memset(out, 0, sizeof(graph_hfr_data_t));
+/* ── HFR history store sync ──
+ * The HFR graph is served from the per-instance hfr_store (data->hfr_ring).
+ * It is seeded by one streamed /image-history?all=true&imageType=LIGHT per
+ * connection; afterwards IMAGE-SAVE events keep it current, and while the
+ * WebSocket is down fetch_hfr_store_catchup() requests only the images newer
+ * than synced_count, one ?index= each. */
+
+_Static_assert(GRAPH_MAX_POINTS >= HFR_RING_SIZE,
+               "graph_hfr_data_t doubles as the full-sync staging buffer");
+
+/* Streaming state for the full sync: Response[] is newest-first, so the
+ * first `cap` entries with HFR are exactly the ones the store can hold.
+ * Every element is counted for synced_count, with or without HFR. */
+typedef struct {
+    nina_api_stream_envelope_t env;
+    float *hfr;
+    int   *stars;
+    int    cap;
+    int    n;
+    int    images;
+    float  cur_hfr;
+    int    cur_stars;
+} hfr_sync_stream_t;
+
+static bool hfr_sync_stream_cb(json_stream_t *js, json_stream_event_t ev,
+                               const json_stream_value_t *v, void *ctx) {
+    hfr_sync_stream_t *h = (hfr_sync_stream_t *)ctx;
+    nina_api_envelope_track(js, ev, v, &h->env);
+    if (ev == JSON_STREAM_EV_RESET) {
+        h->n = 0;
+        h->images = 0;
+        return true;
+    }
+
+    int depth = json_stream_depth(js);
+    if (depth == 2 && json_stream_path_is(js, "Response[]")) {
+        if (ev == JSON_STREAM_EV_OBJECT_BEGIN) {
+            h->cur_hfr = 0;
+            h->cur_stars = 0;
+        } else if (ev == JSON_STREAM_EV_OBJECT_END) {
+            h->images++;
+            if (h->cur_hfr > 0 && h->n < h->cap) {
+                h->hfr[h->n] = h->cur_hfr;
+                h->stars[h->n] = h->cur_stars;
+                h->n++;
+            }
+        }
+        return true;
+    }
 
+    if (ev == JSON_STREAM_EV_VALUE && depth == 3) {
+        if (json_stream_path_is(js, "Response[].HFR")) {
+            h->cur_hfr = (float)sv_num(v);
+        } else if (json_stream_path_is(js, "Response[].Stars")) {
+            h->cur_stars = sv_int(v);
+        }
+    }
+    return true;
+}
+
+/* Replace the store from the full LIGHT history, staging in @p scratch. */
+static bool hfr_store_full_sync(const char *base_url, nina_client_t *data,
+                                graph_hfr_data_t *scratch) {
     char url[256];
     snprintf(url, sizeof(url), "%simage-history?all=true&imageType=LIGHT", base_url);
 
+    hfr_sync_stream_t h = { .hfr = scratch->hfr, .stars = scratch->stars, .cap = HFR_RING_SIZE };
+    json_stream_t js;
+    json_stream_init(&js, hfr_sync_stream_cb, &h);
+
+    if (!http_get_json_stream(url, &js, NULL) || !h.env.success) {
+        ESP_LOGW(TAG, "HFR store: full sync failed");
+        return false;
+    }
+    if (!nina_client_lock(data, FETCH_LOCK_MS)) return false;
+    hfr_store_load_newest_first(&data->hfr_ring, h.hfr, h.stars, h.n, h.images);
+    nina_client_unlock(data);
+
+    ESP_LOGI(TAG, "HFR store: full sync, %d images (%d with HFR)", h.images, h.n);
+    return true;
+}
+
+/* One LIGHT image by ?index= (0 = newest). Response is a one-element array
+ * on current ninaAPI, a bare object on some older builds. */
+static bool fetch_light_image_at(const char *base_url, int index, float *hfr, int *stars) {
+    char url[256];
+    snprintf(url, sizeof(url), "%simage-history?index=%d&imageType=LIGHT", base_url, index);
+
     cJSON *json = http_get_json(url);
-    if (!json) return;
+    if (!json) return false;
+
+    cJSON *entry = cJSON_GetObjectItem(json, "Response");
+    if (cJSON_IsArray(entry)) entry = cJSON_GetArrayItem(entry, 0);
+    bool ok = cJSON_IsObject(entry);
+    if (ok) {
+        cJSON *h = cJSON_GetObjectItem(entry, "HFR");
+        cJSON *st = cJSON_GetObjectItem(entry, "Stars");
+        *hfr = cJSON_IsNumber(h) ? (float)h->valuedouble : 0.0f;
+        *stars = cJSON_IsNumber(st) ? st->valueint : 0;
+    }
+    cJSON_Delete(json);
+    return ok;
+}
 
-    cJSON *response = cJSON_GetObjectItem(json, "Response");
-    if (!response || !cJSON_IsArray(response)) { cJSON_Delete(json); return; }
+/**
+ * @brief Bring a synced HFR store up to date without re-downloading history.
+ * Compares the LIGHT image count with the store's synced_count and fetches
+ * only the new images by index. Gaps too large for that (or a shrunken
+ * history, i.e. a new session) invalidate the store so the next graph open
+ * performs a full sync. No-op while the store has never been synced.
+ */
+void fetch_hfr_store_catchup(const char *base_url, nina_client_t *data) {
+    bool synced = false;
+    if (nina_client_lock(data, FETCH_LOCK_MS)) {
+        synced = data->hfr_ring.synced;
+        nina_client_unlock(data);
+    }
+    if (!synced) return;
 
-    int total_images = cJSON_GetArraySize(response);
-    if (total_images <= 0) { cJSON_Delete(json); return; }
+    int api_count = fetch_image_count_typed(base_url, "LIGHT");
+    if (api_count < 0) return;
 
-    /* The API returns images newest-first; we want oldest-first for the chart.
-     * Take last max_points images and reverse into the output array. */
-    int start = 0;
-    if (total_images > max_points) start = total_images - max_points;
-    if (max_points > GRAPH_MAX_POINTS) max_points = GRAPH_MAX_POINTS;
+    int plan = HFR_STORE_SYNC_NONE;
+    int base = 0;
+    if (!nina_client_lock(data, FETCH_LOCK_MS)) return;
+    plan = hfr_store_plan_sync(&data->hfr_ring, api_count);
+    base = data->hfr_ring.synced_count;
+    if (plan == HFR_STORE_SYNC_FULL) hfr_store_invalidate(&data->hfr_ring);
+    nina_client_unlock(data);
 
-    /* First pass: collect from start..end into temp positions */
-    int count = 0;
-    for (int i = total_images - 1; i >= start && count < GRAPH_MAX_POINTS; i--) {
-        cJSON *item = cJSON_GetArrayItem(response, i);
-        if (!item) continue;
+    if (plan == HFR_STORE_SYNC_NONE) return;
+    if (plan == HFR_STORE_SYNC_FULL) {
+        ESP_LOGI(TAG, "HFR store: %d -> %d images, full resync on next graph open",
+                 base, api_count);
+        return;
+    }
 
-        cJSON *hfr = cJSON_GetObjectItem(item, "HFR");
-        cJSON *stars = cJSON_GetObjectItem(item, "Stars");
+    /* New images are indices plan-1 .. 0; fetch oldest first so they can be
+     * appended in capture order. */
+    float hfr[HFR_STORE_INCREMENTAL_MAX];
+    int stars[HFR_STORE_INCREMENTAL_MAX];
+    for (int i = 0; i < plan; i++) {
+        if (!fetch_light_image_at(base_url, plan - 1 - i, &hfr[i], &stars[i])) return;
+    }
 
-        float hfr_val = hfr ? (float)hfr->valuedouble : 0;
-        if (hfr_val <= 0) continue;  /* Skip images with no HFR data */
+    /* An image saved meanwhile shifts every index; retry next cycle. */
+    if (fetch_image_count_typed(base_url, "LIGHT") != api_count) return;
 
-        out->hfr[count] = hfr_val;
-        out->stars[count] = stars ? stars->valueint : 0;
-        count++;
+    if (!nina_client_lock(data, FETCH_LOCK_MS)) return;
+    /* Skip if an IMAGE-SAVE or a full sync already accounted for them */
+    bool applied = data->hfr_ring.synced && data->hfr_ring.synced_count == base;
+    if (applied) {
+        for (int i = 0; i < plan; i++) {
+            hfr_store_note_image(&data->hfr_ring, hfr[i], stars[i]);
+        }
     }
-    out->count = count;
+    nina_client_unlock(data);
 
-    ESP_LOGI(TAG, "HFR history: %d images", out->count);
-    cJSON_Delete(json);
+    if (applied) ESP_LOGI(TAG, "HFR store: +%d images by index (%d total)", plan, api_count);
 }
 
 /**
- * @brief Build HFR graph data from the local ring buffer (no HTTP fetch).
- * Extracts the most recent entries from the per-instance HFR ring buffer
- * populated by IMAGE-SAVE WebSocket events. Returns the data in oldest-first
- * order matching the format expected by the graph overlay.
+ * @brief Fetch HFR graph data for an instance.
+ * Served from the local HFR store; only the first call after (re)connect
+ * downloads /image-history?all=true&imageType=LIGHT to seed it. @p out is
+ * used as staging for that sync before receiving the graph data.
  */
-void build_hfr_from_ring(const nina_client_t *client, graph_hfr_data_t *out, int max_points) {
-    if (!out || !client || !client->hfr_ring.hfr) return;
-    memset(out, 0, sizeof(graph_hfr_data_t));
-
-    int total = client->hfr_ring.count;
-    if (total <= 0) return;
-
-    /* Number of valid entries in the ring */
-    int available = (total < HFR_RING_SIZE) ? total : HFR_RING_SIZE;
-    int use = (available < max_points) ? available : max_points;
-    if (use > GRAPH_MAX_POINTS) use = GRAPH_MAX_POINTS;
+void fetch_hfr_history(const char *base_url, nina_client_t *data, graph_hfr_data_t *out, int max_points) {
+    if (!out || !data) return;
 
-    /* Read oldest-first: start reading 'use' entries back from write_idx */
-    int read_start;
-    if (total < HFR_RING_SIZE) {
-        /* Ring hasn't wrapped yet — data starts at index 0 */
-        read_start = (available > use) ? (available - use) : 0;
-    } else {
-        /* Ring has wrapped — oldest valid entry is at write_idx */
-        read_start = (client->hfr_ring.write_idx + (available - use)) % HFR_RING_SIZE;
+    bool synced = false;
+    if (nina_client_lock(data, FETCH_LOCK_MS)) {
+        synced = data->hfr_ring.synced;
+        nina_client_unlock(data);
+    }
+    if (!synced && data->hfr_ring.hfr && hfr_store_full_sync(base_url, data, out)) {
+        /* Close the window between NINA generating the reply and the load */
+        fetch_hfr_store_catchup(base_url, data);
     }
 
-    for (int i = 0; i < use; i++) {
-        int ring_idx = (read_start + i) % HFR_RING_SIZE;
-        out->hfr[i]   = client->hfr_ring.hfr[ring_idx];
-        out->stars[i]  = client->hfr_ring.stars[ring_idx];
+    memset(out, 0, sizeof(graph_hfr_data_t));
+    if (nina_client_lock(data, FETCH_LOCK_MS)) {
+        build_hfr_from_ring(data, out, max_points);
+        nina_client_unlock(data);
     }
-    out->count = use;
-    ESP_LOGI(TAG, "HFR from ring buffer: %d points (total captured: %d)", use, total);
+}
+
+/**
+ * @brief Build HFR graph data from the local HFR store (no HTTP fetch).
+ * Extracts the most recent entries in oldest-first order matching the
+ * format expected by the graph overlay. Caller holds the client lock.
+ */
+void build_hfr_from_ring(const nina_client_t *client, graph_hfr_data_t *out, int max_points) {
+    if (!out || !client) return;
+    memset(out, 0, sizeof(graph_hfr_data_t));
+
+    if (max_points > GRAPH_MAX_POINTS) max_points = GRAPH_MAX_POINTS;
+    out->count = hfr_store_build(&client->hfr_ring, out->hfr, out->stars, max_points);
+    ESP_LOGI(TAG, "HFR from store: %d points (total captured: %d)",
+             out->count, client->hfr_ring.count);
 }
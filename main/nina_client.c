@@ -15,6 +15,7 @@
 #include "nina_connection.h"
 #include "http_fetch.h"
 #include "time_parse.h"
+#include "json_stream.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
@@ -216,8 +217,235 @@ static void http_get_json_on_attempt(const http_fetch_attempt_info_t *info, void
     }
 }
 
-cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out) {
+/**
+ * ── mDNS-bypass URL rewrite ──
+ * NINA hostnames are typically .lan (mDNS), and esp_http_client does a fresh
+ * getaddrinfo() on every connect — that DNS+connect is ~42% of avg HTTP latency
+ * and the multi-second tail. Resolve the host ONCE via the app DNS cache, rebuild
+ * the request URL with the numeric IP (so connect skips getaddrinfo), and send the
+ * ORIGINAL hostname in the Host header so NINA's HTTP routing is unaffected.
+ * On a resolve miss we fall through to the original hostname URL (current
+ * behavior) — a resolve miss never breaks a request.
+ *
+ * Returns the URL to hand to the transport (@p url or @p rewritten_url) and
+ * sets *host_hdr_out to the original hostname (in @p host_buf) or NULL.
+ */
+static const char *nina_rewrite_url(const char *url, char *rewritten_url, size_t rewritten_len,
+                                    char *host_buf, size_t host_len, const char **host_hdr_out) {
+    const char *req_url = url;          /* URL actually handed to esp_http_client */
+    *host_hdr_out = NULL;               /* original hostname for the Host header, or NULL */
+
+    const char *scheme_end = strstr(url, "://");
+    if (!scheme_end) return req_url;
+
+    const char *hstart = scheme_end + 3;
+    const char *hend = hstart;
+    while (*hend && *hend != ':' && *hend != '/') hend++;
+    size_t hlen = (size_t)(hend - hstart);
+    /* Only rewrite non-numeric hosts (a numeric host is already DNS-free). */
+    if (hlen > 0 && hlen < host_len &&
+        !(hstart[0] >= '0' && hstart[0] <= '9')) {
+        memcpy(host_buf, hstart, hlen);
+        host_buf[hlen] = '\0';
+        /* Always carry the original hostname in Host (even on resolve
+         * miss): a reused handle may have an explicit Host set from a
+         * prior request, so we must re-assert the correct one every time
+         * rather than leave a stale value behind. */
+        *host_hdr_out = host_buf;
+        char ip_str[16];  /* INET_ADDRSTRLEN for IPv4 */
+        if (nina_client_resolve_host(host_buf, ip_str, sizeof(ip_str)) &&
+            ip_str[0] != '\0') {
+            /* Rebuild: <scheme://><ip><:port/path...>  (hend points at ':' or '/') */
+            int n = snprintf(rewritten_url, rewritten_len,
+                             "%.*s%s%s",
+                             (int)(hstart - url), url, ip_str, hend);
+            if (n > 0 && n < (int)rewritten_len) {
+                req_url = rewritten_url;  /* connect to IP, skip getaddrinfo */
+            }
+            /* else: rebuild overflowed — fall back to hostname URL, Host
+             * still set to the same hostname (harmless, self-consistent). */
+        }
+    }
+    return req_url;
+}
+
+/* ── Pipelined prefetch ──
+ * nina_http_prefetch() fetches the URLs a poll cycle is about to request in
+ * one http_fetch_batch() (pipelined on the poll task's keep-alive
+ * connection), buffering each body in PSRAM. nina_http_get() then serves a
+ * matching request from that buffer instead of the network — each fetcher
+ * keeps its own parse/commit code unchanged and simply finds its response
+ * already there. Whatever is not consumed is dropped by
+ * nina_http_prefetch_release() at the end of the cycle. */
+#define NINA_PREFETCH_MAX 8
+
+typedef struct {
+    char url[192];          /* original (pre-rewrite) URL, as the fetcher builds it */
+    char *body;             /* PSRAM, NUL-terminated; NULL once handed out */
+    size_t len;
+    size_t cap;
+    bool overflow;          /* realloc failed: entry unusable */
+    char date[48];          /* captured "Date" header */
+} nina_prefetch_entry_t;
+
+struct nina_prefetch {
+    int count;
+    nina_prefetch_entry_t e[NINA_PREFETCH_MAX];
+};
+
+static void prefetch_on_begin(void *sink_ctx) {
+    nina_prefetch_entry_t *e = (nina_prefetch_entry_t *)sink_ctx;
+    e->len = 0;
+    e->overflow = false;
+}
+
+static bool prefetch_on_data(const char *data, size_t len, void *sink_ctx) {
+    nina_prefetch_entry_t *e = (nina_prefetch_entry_t *)sink_ctx;
+    if (e->len + len + 1 > e->cap) {
+        size_t want = e->cap ? e->cap : 2048;
+        while (want < e->len + len + 1) want *= 2;
+        char *nb = heap_caps_realloc(e->body, want, MALLOC_CAP_SPIRAM);
+        if (!nb) {
+            e->overflow = true;
+            return false;
+        }
+        e->body = nb;
+        e->cap = want;
+    }
+    memcpy(e->body + e->len, data, len);
+    e->len += len;
+    e->body[e->len] = '\0';
+    return true;
+}
+
+void nina_http_prefetch(const char *const *urls, int n) {
+    http_poll_ctx_t *ctx = http_poll_ctx_get();
+    if (!ctx || n < 2) return;
+    if (n > NINA_PREFETCH_MAX) n = NINA_PREFETCH_MAX;
+    nina_http_prefetch_release(ctx);
+
+    struct nina_prefetch *pf = heap_caps_calloc(1, sizeof(*pf), MALLOC_CAP_SPIRAM);
+    if (!pf) return;
+
+    /* All URLs share one base, so one rewrite decides the origin; the rest
+     * are rebuilt against the same numeric host. */
+    char host_buf[128];
+    const char *host_hdr = NULL;
+    char (*req_urls)[288] = heap_caps_malloc((size_t)n * 288, MALLOC_CAP_SPIRAM);
+    if (!req_urls) {
+        heap_caps_free(pf);
+        return;
+    }
+
+    http_fetch_batch_item_t items[NINA_PREFETCH_MAX];
+    memset(items, 0, sizeof(items));
+    for (int i = 0; i < n; i++) {
+        nina_prefetch_entry_t *e = &pf->e[i];
+        strlcpy(e->url, urls[i], sizeof(e->url));
+        const char *req = nina_rewrite_url(urls[i], req_urls[i], sizeof(req_urls[i]),
+                                           host_buf, sizeof(host_buf), &host_hdr);
+        if (req != req_urls[i]) strlcpy(req_urls[i], req, sizeof(req_urls[i]));
+        items[i] = (http_fetch_batch_item_t){
+            .url = req_urls[i],
+            .sink = { .on_begin = prefetch_on_begin, .on_data = prefetch_on_data, .sink_ctx = e },
+            .capture_out = e->date,
+            .capture_out_len = sizeof(e->date),
+        };
+    }
+    pf->count = n;
+
+    http_get_json_perf_ctx_t pctx = { 0 };
+    http_fetch_opts_t opts = {
+        .timeout_ms = 3000,
+        /* One attempt: a request the batch cannot serve is simply not
+         * cached, and its fetcher then does the usual retrying GET. */
+        .max_attempts = 1,
+        .max_response_bytes = HTTP_JSON_MAX_SIZE + 1,
+        .host_header = host_hdr,
+        .on_attempt = http_get_json_on_attempt,
+        .hook_ctx = &pctx,
+        .conn = ctx->conn,
+        .capture_header = "Date",
+    };
+
+    perf_span_t http_batch_span = perf_timer_start();
+    http_fetch_batch(items, n, &opts);
+    perf_timer_stop(&g_perf.http_batch, http_batch_span);
+
+    int served = 0;
+    for (int i = 0; i < n; i++) {
+        nina_prefetch_entry_t *e = &pf->e[i];
+        if (items[i].err != ESP_OK || e->overflow || e->len == 0) {
+            /* Not cached: the fetcher's own GET repeats it and is what
+             * counts as the request. */
+            heap_caps_free(e->body);
+            e->body = NULL;
+            e->len = 0;
+        } else {
+            perf_counter_increment(&g_perf.http_request_count);
+            if (items[i].pipelined) perf_counter_increment(&g_perf.http_pipelined_count);
+            served++;
+        }
+    }
+    heap_caps_free(req_urls);
+    ctx->prefetch = pf;
+    ESP_LOGD(TAG, "Prefetched %d/%d responses in one batch", served, n);
+}
+
+void nina_http_prefetch_release(http_poll_ctx_t *ctx) {
+    if (!ctx || !ctx->prefetch) return;
+    for (int i = 0; i < ctx->prefetch->count; i++) {
+        heap_caps_free(ctx->prefetch->e[i].body);
+    }
+    heap_caps_free(ctx->prefetch);
+    ctx->prefetch = NULL;
+}
+
+/* Hand a prefetched body to the caller of nina_http_get(), if there is one
+ * for @p url. Each entry is served once. */
+static bool prefetch_take(http_poll_ctx_t *ctx, const char *url, int64_t *date_epoch_out,
+                          const http_fetch_sink_t *sink, char **out_body, size_t *out_len,
+                          esp_err_t *err_out) {
+    if (!ctx || !ctx->prefetch) return false;
+    for (int i = 0; i < ctx->prefetch->count; i++) {
+        nina_prefetch_entry_t *e = &ctx->prefetch->e[i];
+        if (!e->body || strcmp(e->url, url) != 0) continue;
+
+        if (date_epoch_out && e->date[0] != '\0') {
+            *date_epoch_out = (int64_t)time_parse_rfc1123(e->date);
+        }
+        *err_out = ESP_OK;
+        if (sink) {
+            if (sink->on_begin) sink->on_begin(sink->sink_ctx);
+            if (!sink->on_data(e->body, e->len, sink->sink_ctx)) *err_out = ESP_FAIL;
+            heap_caps_free(e->body);
+        } else {
+            *out_body = e->body;    /* ownership moves to the caller */
+        }
+        *out_len = e->len;
+        e->body = NULL;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Transport half shared by http_get_json_dated() and http_get_json_stream():
+ * per-task keep-alive lookup, mDNS-bypass rewrite, retry/perf bridge and
+ * optional Date capture. With @p sink NULL the body is buffered into
+ * *out_body (caller frees); otherwise it is streamed into @p sink. Starts
+ * a g_perf.http_request span and hands it back in *span_out on success -- the
+ * caller stops it once the body has been consumed; on failure it is already
+ * stopped. A body served from this cycle's prefetch never starts the timer
+ * (*span_out is 0, so the caller's stop is a no-op; the batch itself is timed
+ * as http_batch).
+ */
+static esp_err_t nina_http_get(const char *url, int64_t *date_epoch_out,
+                               const http_fetch_sink_t *sink,
+                               char **out_body, size_t *out_len,
+                               perf_span_t *span_out) {
     if (date_epoch_out) *date_epoch_out = 0;
+    *span_out = 0;
 
     /* Read per-task HTTP context (set by poll tasks) for keep-alive reuse via
      * the shared fetcher (main/http_fetch.h). If no context is registered,
@@ -226,53 +454,18 @@ cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out) {
     http_poll_ctx_t *tls_ctx = http_poll_ctx_get();
     http_fetch_conn_t *reuse_conn = tls_ctx ? tls_ctx->conn : NULL;
 
-    /* ── mDNS-bypass URL rewrite ──
-     * NINA hostnames are typically .lan (mDNS), and esp_http_client does a fresh
-     * getaddrinfo() on every connect — that DNS+connect is ~42% of avg HTTP latency
-     * and the multi-second tail. Resolve the host ONCE via the app DNS cache, rebuild
-     * the request URL with the numeric IP (so connect skips getaddrinfo), and send the
-     * ORIGINAL hostname in the Host header so NINA's HTTP routing is unaffected.
-     * On a resolve miss we fall through to the original hostname URL (current
-     * behavior) — a resolve miss never breaks a request. */
-    const char *req_url = url;          /* URL actually handed to esp_http_client */
-    const char *host_hdr = NULL;        /* original hostname for the Host header, or NULL */
+    esp_err_t prefetched_err;
+    if (prefetch_take(tls_ctx, url, date_epoch_out, sink, out_body, out_len, &prefetched_err)) {
+        return prefetched_err;
+    }
+
     char rewritten_url[288];
     char host_buf[128];
-    {
-        const char *scheme_end = strstr(url, "://");
-        if (scheme_end) {
-            const char *hstart = scheme_end + 3;
-            const char *hend = hstart;
-            while (*hend && *hend != ':' && *hend != '/') hend++;
-            size_t hlen = (size_t)(hend - hstart);
-            /* Only rewrite non-numeric hosts (a numeric host is already DNS-free). */
-            if (hlen > 0 && hlen < sizeof(host_buf) &&
-                !(hstart[0] >= '0' && hstart[0] <= '9')) {
-                memcpy(host_buf, hstart, hlen);
-                host_buf[hlen] = '\0';
-                /* Always carry the original hostname in Host (even on resolve
-                 * miss): a reused handle may have an explicit Host set from a
-                 * prior request, so we must re-assert the correct one every time
-                 * rather than leave a stale value behind. */
-                host_hdr = host_buf;
-                char ip_str[16];  /* INET_ADDRSTRLEN for IPv4 */
-                if (nina_client_resolve_host(host_buf, ip_str, sizeof(ip_str)) &&
-                    ip_str[0] != '\0') {
-                    /* Rebuild: <scheme://><ip><:port/path...>  (hend points at ':' or '/') */
-                    int n = snprintf(rewritten_url, sizeof(rewritten_url),
-                                     "%.*s%s%s",
-                                     (int)(hstart - url), url, ip_str, hend);
-                    if (n > 0 && n < (int)sizeof(rewritten_url)) {
-                        req_url = rewritten_url;  /* connect to IP, skip getaddrinfo */
-                    }
-                    /* else: rebuild overflowed — fall back to hostname URL, Host
-                     * still set to the same hostname (harmless, self-consistent). */
-                }
-            }
-        }
-    }
+    const char *host_hdr = NULL;
+    const char *req_url = nina_rewrite_url(url, rewritten_url, sizeof(rewritten_url),
+                                           host_buf, sizeof(host_buf), &host_hdr);
 
-    perf_timer_start(&g_perf.http_request);
+    perf_span_t http_request_span = perf_timer_start();
     perf_counter_increment(&g_perf.http_request_count);
 
     /* Optional response-Date capture (NINA-PC clock domain). RFC-1123 dates
@@ -299,9 +492,8 @@ cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out) {
         .capture_header_out_len = date_epoch_out ? sizeof(date_buf) : 0,
     };
 
-    char *body = NULL;
-    size_t body_len = 0;
-    esp_err_t err = http_fetch_text(req_url, &opts, &body, &body_len);
+    esp_err_t err = sink ? http_fetch_stream(req_url, &opts, sink, out_len)
+                         : http_fetch_text(req_url, &opts, out_body, out_len);
 
     if (err != ESP_OK) {
         /* Extract host from URL for a clean log message. (http_fetch.c also
@@ -320,8 +512,8 @@ cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out) {
         } else {
             perf_counter_increment(&g_perf.http_unreachable_count);
         }
-        perf_timer_stop(&g_perf.http_request);
-        return NULL;  // All attempts exhausted
+        perf_timer_stop(&g_perf.http_request, http_request_span);
+        return err;  // All attempts exhausted
     }
 
     if (pctx.succeeded_late) {
@@ -334,25 +526,87 @@ cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out) {
         *date_epoch_out = (int64_t)time_parse_rfc1123(date_buf);
     }
 
+    *span_out = http_request_span;
+    return ESP_OK;
+}
+
+cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out) {
+    char *body = NULL;
+    size_t body_len = 0;
+    perf_span_t http_request_span;
+    if (nina_http_get(url, date_epoch_out, NULL, &body, &body_len,
+                      &http_request_span) != ESP_OK) {
+        return NULL;
+    }
+
     /* Guard against chunked transfer encoding or missing Content-Length.
      * NINA API always sends Content-Length; an empty body is treated as
      * error, matching the original manual-client behavior. */
     if (body_len == 0) {
         ESP_LOGW(TAG, "No Content-Length for %s (chunked?), skipping", url);
         heap_caps_free(body);
-        perf_timer_stop(&g_perf.http_request);
+        perf_timer_stop(&g_perf.http_request, http_request_span);
         return NULL;
     }
 
-    perf_timer_start(&g_perf.json_parse);
+    perf_span_t json_parse_span = perf_timer_start();
     cJSON *json = cJSON_Parse(body);
-    perf_timer_stop(&g_perf.json_parse);
+    perf_timer_stop(&g_perf.json_parse, json_parse_span);
     perf_counter_increment(&g_perf.json_parse_count);
     heap_caps_free(body);
-    perf_timer_stop(&g_perf.http_request);
+    perf_timer_stop(&g_perf.http_request, http_request_span);
     return json;
 }
 
+/* ── Streaming JSON path ──
+ * Feeds the body straight from http_fetch's read loop into a json_stream_t.
+ * Parse time is accumulated across chunks (network waits excluded) and
+ * recorded once per document as g_perf.json_stream, next to the cJSON
+ * engine's g_perf.json_parse, so the two engines compare like-for-like. */
+typedef struct {
+    json_stream_t *js;
+    int64_t parse_us;
+} nina_stream_sink_ctx_t;
+
+static void nina_stream_on_begin(void *sink_ctx) {
+    nina_stream_sink_ctx_t *sc = (nina_stream_sink_ctx_t *)sink_ctx;
+    sc->parse_us = 0;
+    json_stream_reset(sc->js);
+}
+
+static bool nina_stream_on_data(const char *data, size_t len, void *sink_ctx) {
+    nina_stream_sink_ctx_t *sc = (nina_stream_sink_ctx_t *)sink_ctx;
+    int64_t t0 = esp_timer_get_time();
+    bool ok = json_stream_feed(sc->js, data, len);
+    sc->parse_us += esp_timer_get_time() - t0;
+    return ok;
+}
+
+bool http_get_json_stream(const char *url, json_stream_t *js, int64_t *date_epoch_out) {
+    nina_stream_sink_ctx_t sc = { .js = js };
+    http_fetch_sink_t sink = {
+        .on_begin = nina_stream_on_begin,
+        .on_data = nina_stream_on_data,
+        .sink_ctx = &sc,
+    };
+    size_t body_len = 0;
+    perf_span_t http_request_span;
+    if (nina_http_get(url, date_epoch_out, &sink, NULL, &body_len,
+                      &http_request_span) != ESP_OK) {
+        return false;
+    }
+
+    bool ok = body_len > 0 && json_stream_finish(js);
+    perf_timer_record(&g_perf.json_stream, sc.parse_us);
+    perf_counter_increment(&g_perf.json_stream_count);
+    perf_timer_stop(&g_perf.http_request, http_request_span);
+    if (!ok) {
+        ESP_LOGW(TAG, "Streamed JSON incomplete/invalid for %s (%u bytes)",
+                 url, (unsigned)body_len);
+    }
+    return ok;
+}
+
 /* Thin wrapper — the common no-Date-capture case used by ~17 call sites. */
 cJSON *http_get_json(const char *url) {
     return http_get_json_dated(url, NULL);
@@ -391,6 +645,25 @@ cJSON *nina_api_response(cJSON *envelope) {
     return cJSON_GetObjectItem(envelope, "Response");
 }
 
+void nina_api_envelope_track(const json_stream_t *js, json_stream_event_t ev,
+                             const json_stream_value_t *val,
+                             nina_api_stream_envelope_t *env) {
+    if (ev == JSON_STREAM_EV_RESET) {
+        env->success = false;
+        env->has_response = false;
+        return;
+    }
+    if (json_stream_depth(js) != 1) return;
+    const char *key = json_stream_key_at(js, 0);
+    if (!key) return;
+    if (ev == JSON_STREAM_EV_VALUE && strcmp(key, "Success") == 0) {
+        env->success = (val->type == JSON_STREAM_BOOL && val->boolean);
+    } else if (strcmp(key, "Response") == 0 &&
+               ev != JSON_STREAM_EV_OBJECT_END && ev != JSON_STREAM_EV_ARRAY_END) {
+        env->has_response = true;
+    }
+}
+
 // =============================================================================
 // Exposure Timing Fixup
 // =============================================================================
@@ -416,6 +689,54 @@ static void fixup_exposure_timing(nina_client_t *data) {
     }
 }
 
+// =============================================================================
+// Poll-cycle Prefetch
+// =============================================================================
+
+/* URLs nina_client_poll() is about to GET after the connection check, in
+ * the order its fetchers will ask for them. Mirrors the gating below; a URL
+ * listed here but not requested after all is simply dropped at cycle end.
+ * Only the small equipment / image-history documents are listed:
+ * sequence/json is the largest body and is stream-parsed straight off the
+ * socket, which buffering it here would undo. */
+#define POLL_PREFETCH_URL_LEN 192
+
+static void prefetch_poll_cycle(const char *base_url, nina_client_t *data,
+                                const nina_poll_state_t *state, int64_t now_ms) {
+    static const char *const legacy_fast[] = { "equipment/guider/info" };
+    static const char *const no_ws[] = { "image-history?count=true", "equipment/filterwheel/info" };
+    static const char *const legacy_slow[] = {
+        "equipment/focuser/info", "equipment/mount/info", "equipment/switch/info",
+    };
+
+    const char *paths[8];
+    int n = 0;
+    if (state->bundle_not_available) {
+        paths[n++] = legacy_fast[0];
+        if (!data->websocket_connected) {
+            paths[n++] = no_ws[0];
+            paths[n++] = no_ws[1];
+        }
+        if (now_ms - state->last_slow_poll_ms >= NINA_POLL_SLOW_MS) {
+            for (int i = 0; i < 3; i++) paths[n++] = legacy_slow[i];
+        }
+    } else if (!data->websocket_connected) {
+        paths[n++] = no_ws[0];
+    }
+    if (n < 2) return;  /* nothing to overlap */
+
+    char *buf = heap_caps_malloc((size_t)n * POLL_PREFETCH_URL_LEN, MALLOC_CAP_SPIRAM);
+    if (!buf) return;
+    const char *urls[8];
+    for (int i = 0; i < n; i++) {
+        char *u = buf + (size_t)i * POLL_PREFETCH_URL_LEN;
+        snprintf(u, POLL_PREFETCH_URL_LEN, "%s%s", base_url, paths[i]);
+        urls[i] = u;
+    }
+    nina_http_prefetch(urls, n);
+    heap_caps_free(buf);
+}
+
 // =============================================================================
 // Public API
 // =============================================================================
@@ -445,7 +766,7 @@ void nina_client_get_data(const char *base_url, nina_client_t *data) {
         fetch_guider_robust(base_url, data);
         fetch_mount_robust(base_url, data);
         fetch_focuser_robust(base_url, data);
-        fetch_sequence_counts_optional(base_url, data);
+        fetch_sequence_counts_optional(base_url, data, NULL);
 
         fixup_exposure_timing(data);
     }
@@ -466,6 +787,9 @@ void nina_poll_state_init(nina_poll_state_t *state) {
     if (state->http_client) {
         http_fetch_conn_destroy((http_fetch_conn_t *)state->http_client);
     }
+    if (state->seq_cache) {
+        heap_caps_free(state->seq_cache);
+    }
     memset(state, 0, sizeof(nina_poll_state_t));
     state->cached_image_count = -1;  // Force initial full fetch
 }
@@ -499,10 +823,10 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
 
     // --- BUNDLED: All equipment in one request (ninaAPI 2.2.15+) ---
     if (!state->bundle_not_available) {
-        perf_timer_start(&g_perf.poll_equipment_bundle);
+        perf_span_t poll_equipment_bundle_span = perf_timer_start();
         uint16_t eq_mask = 0;
         int bundle_result = fetch_equipment_info_bundled(base_url, data, !state->static_fetched, &eq_mask);
-        perf_timer_stop(&g_perf.poll_equipment_bundle);
+        perf_timer_stop(&g_perf.poll_equipment_bundle, poll_equipment_bundle_span);
 
         if (bundle_result == 0) {
             // Seed WebSocket equipment mask from actual NINA connected state
@@ -519,9 +843,9 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
 
     if (state->bundle_not_available) {
         // --- LEGACY: Individual equipment fetchers (old ninaAPI without /equipment/info) ---
-        perf_timer_start(&g_perf.poll_camera);
+        perf_span_t poll_camera_span = perf_timer_start();
         fetch_camera_info_robust(base_url, data);
-        perf_timer_stop(&g_perf.poll_camera);
+        perf_timer_stop(&g_perf.poll_camera, poll_camera_span);
     }
 
     // --- Connection check (both bundled and legacy paths) ---
@@ -537,6 +861,7 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
         nina_connection_set_static_data_ready(instance, false);
         if (nina_client_lock(data, 100)) {
             data->prev_target_container[0] = '\0';
+            hfr_store_invalidate(&data->hfr_ring);
             nina_client_unlock(data);
         }
         http_poll_ctx_set(NULL);
@@ -548,31 +873,35 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
         state->static_fetched = false;
         state->cached_image_count = -1;
         nina_connection_set_static_data_ready(instance, false);
+        if (nina_client_lock(data, 100)) {
+            hfr_store_invalidate(&data->hfr_ring);
+            nina_client_unlock(data);
+        }
         ESP_LOGI(TAG, "Profile changed — re-fetching static data for instance %d", instance);
     }
 
     // --- ONCE: Static data (profile, image history; filters/switch/safety handled by bundle) ---
     if (!state->static_fetched) {
-        perf_timer_start(&g_perf.poll_profile);
+        perf_span_t poll_profile_span = perf_timer_start();
         fetch_profile_robust(base_url, data);
-        perf_timer_stop(&g_perf.poll_profile);
+        perf_timer_stop(&g_perf.poll_profile, poll_profile_span);
 
         if (state->bundle_not_available) {
             // Legacy: fetch equipment data individually on first connect
-            perf_timer_start(&g_perf.poll_filter);
+            perf_span_t poll_filter_span = perf_timer_start();
             fetch_filter_robust_ex(base_url, data, true);
-            perf_timer_stop(&g_perf.poll_filter);
+            perf_timer_stop(&g_perf.poll_filter, poll_filter_span);
 
-            perf_timer_start(&g_perf.poll_switch);
+            perf_span_t poll_switch_span = perf_timer_start();
             fetch_switch_info(base_url, data);
-            perf_timer_stop(&g_perf.poll_switch);
+            perf_timer_stop(&g_perf.poll_switch, poll_switch_span);
 
             fetch_safety_monitor_info(base_url, data);
         }
 
-        perf_timer_start(&g_perf.poll_image_history);
+        perf_span_t poll_image_history_span = perf_timer_start();
         fetch_image_history_robust(base_url, data);
-        perf_timer_stop(&g_perf.poll_image_history);
+        perf_timer_stop(&g_perf.poll_image_history, poll_image_history_span);
 
         snprintf(state->cached_profile, sizeof(state->cached_profile), "%s", data->profile_name);
         snprintf(state->cached_telescope, sizeof(state->cached_telescope), "%s", data->telescope_name);
@@ -604,11 +933,15 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
         nina_client_unlock(data);
     }
 
+    // --- PIPELINE: the cycle's remaining GETs go out back-to-back on one
+    // connection; each fetcher below then finds its response already buffered.
+    prefetch_poll_cycle(base_url, data, state, now_ms);
+
     if (state->bundle_not_available) {
         // --- LEGACY: Fast + conditional + slow tier fetchers ---
-        perf_timer_start(&g_perf.poll_guider);
+        perf_span_t poll_guider_span = perf_timer_start();
         fetch_guider_robust(base_url, data);
-        perf_timer_stop(&g_perf.poll_guider);
+        perf_timer_stop(&g_perf.poll_guider, poll_guider_span);
 
         if (!data->websocket_connected) {
             /* Image count gate: only fetch full image-history if the count changed.
@@ -616,16 +949,19 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
             int img_count = fetch_image_count(base_url);
             if (img_count >= 0 && img_count != state->cached_image_count) {
                 state->cached_image_count = img_count;
-                perf_timer_start(&g_perf.poll_image_history);
+                perf_span_t poll_image_history_span = perf_timer_start();
                 fetch_image_history_robust(base_url, data);
-                perf_timer_stop(&g_perf.poll_image_history);
+                perf_timer_stop(&g_perf.poll_image_history, poll_image_history_span);
+                /* No IMAGE-SAVE events without the WebSocket: pull the new
+                 * frames into the HFR store by index instead */
+                fetch_hfr_store_catchup(base_url, data);
             }
             if (data->telescope_name[0] != '\0') {
                 snprintf(state->cached_telescope, sizeof(state->cached_telescope), "%s", data->telescope_name);
             }
-            perf_timer_start(&g_perf.poll_filter);
+            perf_span_t poll_filter_span = perf_timer_start();
             fetch_filter_robust_ex(base_url, data, false);
-            perf_timer_stop(&g_perf.poll_filter);
+            perf_timer_stop(&g_perf.poll_filter, poll_filter_span);
         } else {
             if (data->telescope_name[0] != '\0') {
                 snprintf(state->cached_telescope, sizeof(state->cached_telescope), "%s", data->telescope_name);
@@ -633,17 +969,17 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
         }
 
         if (now_ms - state->last_slow_poll_ms >= NINA_POLL_SLOW_MS) {
-            perf_timer_start(&g_perf.poll_focuser);
+            perf_span_t poll_focuser_span = perf_timer_start();
             fetch_focuser_robust(base_url, data);
-            perf_timer_stop(&g_perf.poll_focuser);
+            perf_timer_stop(&g_perf.poll_focuser, poll_focuser_span);
 
-            perf_timer_start(&g_perf.poll_mount);
+            perf_span_t poll_mount_span = perf_timer_start();
             fetch_mount_robust(base_url, data);
-            perf_timer_stop(&g_perf.poll_mount);
+            perf_timer_stop(&g_perf.poll_mount, poll_mount_span);
 
-            perf_timer_start(&g_perf.poll_switch);
+            perf_span_t poll_switch_span = perf_timer_start();
             fetch_switch_info(base_url, data);
-            perf_timer_stop(&g_perf.poll_switch);
+            perf_timer_stop(&g_perf.poll_switch, poll_switch_span);
 
             state->last_slow_poll_ms = now_ms;
         }
@@ -655,9 +991,12 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
             int img_count = fetch_image_count(base_url);
             if (img_count >= 0 && img_count != state->cached_image_count) {
                 state->cached_image_count = img_count;
-                perf_timer_start(&g_perf.poll_image_history);
+                perf_span_t poll_image_history_span = perf_timer_start();
                 fetch_image_history_robust(base_url, data);
-                perf_timer_stop(&g_perf.poll_image_history);
+                perf_timer_stop(&g_perf.poll_image_history, poll_image_history_span);
+                /* No IMAGE-SAVE events without the WebSocket: pull the new
+                 * frames into the HFR store by index instead */
+                fetch_hfr_store_catchup(base_url, data);
             }
         }
         if (data->telescope_name[0] != '\0') {
@@ -672,9 +1011,9 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
         if (sequence_event) {
             ESP_LOGD(TAG, "Event-driven sequence poll triggered");
         }
-        perf_timer_start(&g_perf.poll_sequence);
-        fetch_sequence_counts_optional(base_url, data);
-        perf_timer_stop(&g_perf.poll_sequence);
+        perf_span_t poll_sequence_span = perf_timer_start();
+        fetch_sequence_counts_optional(base_url, data, state);
+        perf_timer_stop(&g_perf.poll_sequence, poll_sequence_span);
         state->last_sequence_poll_ms = now_ms;
     }
 
@@ -683,6 +1022,7 @@ void nina_client_poll(const char *base_url, nina_client_t *data, nina_poll_state
         nina_client_unlock(data);
     }
 
+    nina_http_prefetch_release(&poll_ctx);
     http_poll_ctx_set(NULL);
 
     ESP_LOGI(TAG, "=== Poll Summary ===");
@@ -749,6 +1089,10 @@ void nina_client_poll_background(const char *base_url, nina_client_t *data, nina
         state->static_fetched = false;
         state->cached_image_count = -1;
         nina_connection_set_static_data_ready(instance, false);
+        if (nina_client_lock(data, 100)) {
+            hfr_store_invalidate(&data->hfr_ring);
+            nina_client_unlock(data);
+        }
         http_poll_ctx_set(NULL);
         return;
     }
@@ -758,6 +1102,10 @@ void nina_client_poll_background(const char *base_url, nina_client_t *data, nina
         state->static_fetched = false;
         state->cached_image_count = -1;
         nina_connection_set_static_data_ready(instance, false);
+        if (nina_client_lock(data, 100)) {
+            hfr_store_invalidate(&data->hfr_ring);
+            nina_client_unlock(data);
+        }
         ESP_LOGI(TAG, "Profile changed — re-fetching static data for background instance %d", instance);
     }
 
@@ -809,7 +1157,7 @@ void nina_client_poll_background(const char *base_url, nina_client_t *data, nina
 
     // --- SEQUENCE: Timer-based polling (background instances) ---
     if (now_ms - state->last_sequence_poll_ms >= NINA_POLL_SEQUENCE_MS) {
-        fetch_sequence_counts_optional(base_url, data);
+        fetch_sequence_counts_optional(base_url, data, state);
         state->last_sequence_poll_ms = now_ms;
     }
 
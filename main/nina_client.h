@@ -7,9 +7,9 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "ui/info_overlay_types.h"
+#include "hfr_store.h"
 
 #define MAX_FILTERS 10
-#define HFR_RING_SIZE 500  // Matches GRAPH_MAX_POINTS for HFR graph overlay
 
 // Filter information
 typedef struct {
@@ -134,15 +134,12 @@ typedef struct {
     // Autofocus V-curve data (captured from WebSocket events)
     autofocus_data_t autofocus;
 
-    // Local HFR ring buffer — populated by IMAGE-SAVE WebSocket events.
-    // Used to serve HFR graph auto-refreshes without re-fetching /image-history?all=true.
-    // Allocated in PSRAM by the data task (pointer set after allocation).
-    struct {
-        float *hfr;       // HFR values [HFR_RING_SIZE], PSRAM-allocated
-        int   *stars;     // Star counts [HFR_RING_SIZE], PSRAM-allocated
-        int    count;     // Total entries written (may exceed HFR_RING_SIZE)
-        int    write_idx; // Next write position (wraps at HFR_RING_SIZE)
-    } hfr_ring;
+    // Local HFR/star store — seeded once per connection from /image-history,
+    // then kept current by IMAGE-SAVE WebSocket events (or small ?index=N
+    // catch-ups when the WebSocket is down). Serves the HFR graph without
+    // re-fetching /image-history?all=true. Buffers are allocated in PSRAM
+    // by the data task (pointers set after allocation).
+    hfr_store_t hfr_ring;
 
     // Mutex for synchronizing access between WebSocket event handler and data task.
     // Must be created with nina_client_init_mutex() before use.
@@ -198,6 +195,12 @@ typedef struct {
 
     // Set true if /equipment/info returned 404 (old ninaAPI); disables bundled fetch
     bool bundle_not_available;
+
+    // Flattened /sequence/json index and last walk (main/seq_index.h), reused
+    // across polls so an unchanged sequence shape skips the tree walk. Opaque
+    // here; allocated by fetch_sequence_counts_optional(), freed by
+    // nina_poll_state_init().
+    void *seq_cache;
 } nina_poll_state_t;
 
 // Initialize polling state (call once before polling loop)
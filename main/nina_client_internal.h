@@ -12,6 +12,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "http_fetch.h"
+#include "json_stream.h"
 #include <time.h>
 
 /* ── Per-task HTTP client context ──
@@ -30,6 +31,8 @@ typedef struct {
     http_fetch_conn_t *conn;  /* Persistent keep-alive slot, owned by the caller's
                                * nina_poll_state_t.http_client. NULL = standalone/
                                * one-shot mode (no reuse, no keep-alive). */
+    struct nina_prefetch *prefetch; /* This cycle's pipelined responses, or NULL
+                                     * (see nina_http_prefetch()). */
 } http_poll_ctx_t;
 
 /**
@@ -44,6 +47,16 @@ void http_poll_ctx_set(http_poll_ctx_t *ctx);
  */
 http_poll_ctx_t *http_poll_ctx_get(void);
 
+/* Fetch @p urls (same NINA base) in one pipelined http_fetch_batch() on the
+ * calling task's keep-alive connection and buffer the bodies in the poll
+ * context. http_get_json*() calls for those exact URLs later in the cycle are
+ * then served from the buffer (once each) instead of the network. Needs a
+ * registered poll context and at least two URLs; otherwise a no-op. */
+void nina_http_prefetch(const char *const *urls, int n);
+
+/* Drop any unconsumed prefetched bodies held by @p ctx. */
+void nina_http_prefetch_release(http_poll_ctx_t *ctx);
+
 /* HTTP GET and parse JSON response. Caller must cJSON_Delete() the result.
  * Uses per-task poll context for client reuse when available. */
 cJSON *http_get_json(const char *url);
@@ -54,6 +67,15 @@ cJSON *http_get_json(const char *url);
  * may be NULL (behaves exactly like http_get_json()). */
 cJSON *http_get_json_dated(const char *url, int64_t *date_epoch_out);
 
+/* Streaming counterpart of http_get_json_dated(): the body is fed into @p js
+ * chunk by chunk as it is read off the socket -- no body buffer, no cJSON
+ * tree. @p js must already be initialised with the caller's callback; it is
+ * reset (JSON_STREAM_EV_RESET) before each attempt's body. Returns true only
+ * if the transport succeeded AND @p js saw one complete, well-formed
+ * document. Same keep-alive reuse, mDNS bypass and perf bridge as
+ * http_get_json(); parse time lands in g_perf.json_stream. */
+bool http_get_json_stream(const char *url, json_stream_t *js, int64_t *date_epoch_out);
+
 /* Resolve an IPv4 hostname to its dotted-quad string using the app-level
  * DNS cache (60s TTL, stale fallback). On a hit, copies the cached IP into
  * ip_out and returns true; on a miss, performs a fresh getaddrinfo(), caches
@@ -78,5 +100,18 @@ bool nina_api_envelope_ok(cJSON *envelope);
  * else NULL. */
 cJSON *nina_api_response(cJSON *envelope);
 
+/* Streaming equivalent of the two helpers above: a json_stream callback calls
+ * nina_api_envelope_track() for every event and reads the result after the
+ * document completes. success mirrors nina_api_envelope_ok(); has_response
+ * mirrors nina_api_response() != NULL before the Success check. */
+typedef struct {
+    bool success;       /* top-level "Success" is true */
+    bool has_response;  /* top-level "Response" present (any type) */
+} nina_api_stream_envelope_t;
+
+void nina_api_envelope_track(const json_stream_t *js, json_stream_event_t ev,
+                             const json_stream_value_t *val,
+                             nina_api_stream_envelope_t *env);
+
 /* Parse ISO-8601 datetime string to time_t (UTC). Returns 0 on failure. */
 time_t parse_iso8601(const char *str);
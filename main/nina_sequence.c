@@ -1,30 +1,23 @@
 /**
  * @file nina_sequence.c
- * @brief Sequence JSON tree walkers for NINA.
+ * @brief Sequence summary from NINA's sequence/json endpoint.
  *
- * Handles the recursive parsing of NINA's sequence/json endpoint to
- * extract container names, step names, exposure counts, and time conditions.
+ * Streams sequence/json into a flattened index (seq_index.h) kept in the
+ * instance's poll state, and derives the target name, active container,
+ * running step, Smart Exposure counts and earliest time condition from it.
+ * The index walk is skipped while the Targets_Container shape is unchanged.
  */
 
 #include "nina_sequence.h"
 #include "nina_client_internal.h"
+#include "seq_index.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
-#include "cJSON.h"
 #include <string.h>
 #include <stdio.h>
 
 static const char *TAG = "nina_seq";
 
-// Parse "H:MM:SS" or "H:MM:" style RemainingTime string to total seconds.
-// Returns -1 on parse failure.
-static int parse_remaining_seconds(const char *str) {
-    int h = 0, m = 0, s = 0;
-    if (sscanf(str, "%d:%d:%d", &h, &m, &s) >= 2) {
-        return h * 3600 + m * 60 + s;
-    }
-    return -1;
-}
-
 // Classify a condition name into a short header label for the dashboard.
 static const char* classify_condition(const char *name) {
     if (!name) return "TIME LIMIT";
@@ -37,345 +30,179 @@ static const char* classify_condition(const char *name) {
     return "TIME LIMIT";
 }
 
-// State passed through the recursive search for the earliest condition.
+// Per-instance sequence state, kept in nina_poll_state_t.seq_cache (PSRAM):
+// the stream parser, the index it fills, and the last walk's node picks.
 typedef struct {
-    int min_seconds;          // Smallest RemainingTime found so far (-1 = none)
-    const char *reason;       // Header label for the binding constraint
-    int condition_count;      // Total conditions found (including those without time)
-    int64_t now_epoch;        // "Now" in the NINA clock domain (from
-                              // nina_client_now_epoch); ExpectedDateTime is a
-                              // NINA-PC timestamp, so the subtraction must not
-                              // use the device SNTP clock. 0 = unknown.
-} earliest_condition_t;
-
-// Recursively scan all conditions with RemainingTime or ExpectedDateTime in a
-// container tree, updating *out with the earliest (minimum) one found.
-static void find_earliest_condition(cJSON *container, earliest_condition_t *out) {
-    if (!container) return;
-
-    // Check this container's conditions
-    cJSON *conditions = cJSON_GetObjectItem(container, "Conditions");
-    if (conditions && cJSON_IsArray(conditions)) {
-        cJSON *cond = NULL;
-        cJSON_ArrayForEach(cond, conditions) {
-            out->condition_count++;
-
-            int secs = -1;
-
-            // Try RemainingTime first (countdown string like "H:MM:SS")
-            cJSON *rem = cJSON_GetObjectItem(cond, "RemainingTime");
-            if (rem && rem->valuestring && rem->valuestring[0] != '\0') {
-                secs = parse_remaining_seconds(rem->valuestring);
-            }
-
-            // Fallback: compute remaining seconds from ExpectedDateTime
-            // (used by Altitude/Horizon conditions that lack RemainingTime)
-            if (secs < 0) {
-                cJSON *edt = cJSON_GetObjectItem(cond, "ExpectedDateTime");
-                if (edt && edt->valuestring && edt->valuestring[0] != '\0') {
-                    time_t expected = parse_iso8601(edt->valuestring);
-                    // Ignore sentinel values (year 1 / parse failure)
-                    if (expected > 86400) {
-                        int64_t now_nina = out->now_epoch;
-                        if (now_nina > 0 && (int64_t)expected > now_nina) {
-                            secs = (int)((int64_t)expected - now_nina);
-                        }
-                    }
-                }
-            }
-
-            if (secs < 0) continue;
-
-            if (out->min_seconds < 0 || secs < out->min_seconds) {
-                out->min_seconds = secs;
-                cJSON *cond_name = cJSON_GetObjectItem(cond, "Name");
-                out->reason = classify_condition(
-                    cond_name ? cond_name->valuestring : NULL);
-            }
-        }
-    }
+    json_stream_t js;
+    seq_index_t   idx;
+    seq_walk_t    walk;
+} seq_cache_t;
+
+// Copy an item name, dropping NINA's "_Container" suffix.
+static void copy_stripped(char *out, size_t out_size, const char *name) {
+    strlcpy(out, name, out_size);
+    char *suffix = strstr(out, "_Container");
+    if (suffix) *suffix = '\0';
+}
 
-    // Recurse into RUNNING or CREATED child containers
-    // (CREATED containers may have valid future time conditions)
-    cJSON *items = cJSON_GetObjectItem(container, "Items");
-    if (items && cJSON_IsArray(items)) {
-        cJSON *item = NULL;
-        cJSON_ArrayForEach(item, items) {
-            cJSON *status = cJSON_GetObjectItem(item, "Status");
-            cJSON *child_items = cJSON_GetObjectItem(item, "Items");
-            if (status && status->valuestring && child_items &&
-                (strcmp(status->valuestring, "RUNNING") == 0 ||
-                 strcmp(status->valuestring, "CREATED") == 0)) {
-                find_earliest_condition(item, out);
+// Scan the conditions in scope of the target container (its own, and those of
+// RUNNING or CREATED child containers) for the earliest RemainingTime or
+// ExpectedDateTime. now_epoch is "now" in the NINA clock domain (from
+// nina_client_now_epoch); ExpectedDateTime is a NINA-PC timestamp, so the
+// subtraction must not use the device SNTP clock. 0 = unknown.
+static int find_earliest_condition(const seq_index_t *idx, int target, int64_t now_epoch,
+                                   const char **reason, int *condition_count) {
+    int min_seconds = -1;
+    *reason = "TIME LIMIT";
+    *condition_count = 0;
+    for (int i = 0; i < idx->cond_count; i++) {
+        if (!seq_index_cond_in_scope(idx, target, i)) continue;
+        const seq_cond_t *cond = &idx->conds[i];
+        (*condition_count)++;
+
+        // Try RemainingTime first (countdown string like "H:MM:SS")
+        int secs = cond->remaining_s;
+
+        // Fallback: compute remaining seconds from ExpectedDateTime
+        // (used by Altitude/Horizon conditions that lack RemainingTime)
+        if (secs < 0 && cond->expected[0] != '\0') {
+            time_t expected = parse_iso8601(cond->expected);
+            // Ignore sentinel values (year 1 / parse failure)
+            if (expected > 86400 && now_epoch > 0 && (int64_t)expected > now_epoch) {
+                secs = (int)((int64_t)expected - now_epoch);
             }
         }
-    }
-}
 
-// Find the active target container (RUNNING preferred, otherwise last FINISHED)
-static cJSON* find_active_target_container(cJSON *targets_container) {
-    cJSON *items = cJSON_GetObjectItem(targets_container, "Items");
-    if (!items || !cJSON_IsArray(items)) return NULL;
+        if (secs < 0) continue;
 
-    cJSON *running = NULL;
-    cJSON *last_finished = NULL;
-    cJSON *item = NULL;
-    cJSON_ArrayForEach(item, items) {
-        cJSON *status = cJSON_GetObjectItem(item, "Status");
-        if (!status || !status->valuestring) continue;
-        if (strcmp(status->valuestring, "RUNNING") == 0) {
-            running = item;
-            break;
-        }
-        if (strcmp(status->valuestring, "FINISHED") == 0) {
-            last_finished = item;
+        if (min_seconds < 0 || secs < min_seconds) {
+            min_seconds = secs;
+            *reason = classify_condition(cond->name[0] ? cond->name : NULL);
         }
     }
-    return running ? running : last_finished;
+    return min_seconds;
 }
 
-// Find the deepest RUNNING container name, or fall back to last FINISHED container
-static void find_active_container_name(cJSON *parent, char *out, size_t out_size) {
-    if (!parent) return;
-
-    cJSON *items = cJSON_GetObjectItem(parent, "Items");
-    if (!items || !cJSON_IsArray(items)) return;
-
-    // First pass: look for a RUNNING container child
-    cJSON *item = NULL;
-    cJSON_ArrayForEach(item, items) {
-        cJSON *item_status = cJSON_GetObjectItem(item, "Status");
-        cJSON *item_name = cJSON_GetObjectItem(item, "Name");
-        cJSON *item_items = cJSON_GetObjectItem(item, "Items");
-        if (!item_status || !item_status->valuestring || !item_name || !item_name->valuestring) continue;
-        if (!item_items || !cJSON_IsArray(item_items)) continue;
-
-        if (strcmp(item_status->valuestring, "RUNNING") == 0) {
-            strncpy(out, item_name->valuestring, out_size - 1);
-            out[out_size - 1] = '\0';
-            char *suffix = strstr(out, "_Container");
-            if (suffix) *suffix = '\0';
-            // Try to find a deeper RUNNING container
-            char deeper[64] = {0};
-            find_active_container_name(item, deeper, sizeof(deeper));
-            if (deeper[0] != '\0') {
-                strncpy(out, deeper, out_size - 1);
-                out[out_size - 1] = '\0';
-            }
-            return;
+// Fill @p data from the walked index.
+static void apply_sequence(const seq_index_t *idx, const seq_walk_t *w, nina_client_t *data) {
+    const seq_node_t *tc = &idx->nodes[w->target];
+
+    // Resolve target name from the active target container.
+    if (tc->flags & SEQ_NODE_HAS_NAME) {
+        char temp_name[64];
+        copy_stripped(temp_name, sizeof(temp_name), seq_index_name(idx, w->target));
+
+        // Is the chosen container actually RUNNING? (the pick can be a FINISHED
+        // container as fallback; only a RUNNING one is a real active target.)
+        bool tc_running = (tc->flags & SEQ_NODE_HAS_STATUS) && tc->status == SEQ_STATUS_RUNNING;
+
+        if (temp_name[0] != '\0' && tc_running &&
+            strcmp(temp_name, data->prev_target_container) != 0) {
+            // New RUNNING target container detected -> authoritative update at sequence/target start
+            strlcpy(data->target_name, temp_name, sizeof(data->target_name));
+            strlcpy(data->prev_target_container, temp_name, sizeof(data->prev_target_container));
+            ESP_LOGI(TAG, "Target (new RUNNING container): %s", data->target_name);
+        } else if (temp_name[0] != '\0' &&
+                   (data->target_name[0] == '\0' ||
+                    strcmp(data->target_name, "No Target") == 0)) {
+            // Existing fallback: fill when we have no name yet (idle/CREATED/boot)
+            strlcpy(data->target_name, temp_name, sizeof(data->target_name));
+            ESP_LOGI(TAG, "Target (fallback from sequence): %s", data->target_name);
         }
     }
 
-    // Second pass: no RUNNING container, use last FINISHED container
-    cJSON *last_finished = NULL;
-    cJSON_ArrayForEach(item, items) {
-        cJSON *item_status = cJSON_GetObjectItem(item, "Status");
-        cJSON *item_items = cJSON_GetObjectItem(item, "Items");
-        if (!item_status || !item_status->valuestring) continue;
-        if (!item_items || !cJSON_IsArray(item_items)) continue;
-        if (strcmp(item_status->valuestring, "FINISHED") == 0) {
-            last_finished = item;
-        }
+    // Active container name (left as is when there is none)
+    if (w->container != SEQ_NO_NODE) {
+        copy_stripped(data->container_name, sizeof(data->container_name),
+                      seq_index_name(idx, w->container));
     }
-    if (last_finished) {
-        cJSON *item_name = cJSON_GetObjectItem(last_finished, "Name");
-        if (item_name && item_name->valuestring) {
-            strncpy(out, item_name->valuestring, out_size - 1);
-            out[out_size - 1] = '\0';
-            char *suffix = strstr(out, "_Container");
-            if (suffix) *suffix = '\0';
-        }
+    if (data->container_name[0] != '\0') {
+        ESP_LOGI(TAG, "Active container: %s", data->container_name);
     }
-}
 
-// Find the currently running step (leaf instruction) within a container tree
-static void find_running_step_name(cJSON *parent, char *out, size_t out_size) {
-    if (!parent) return;
-
-    cJSON *items = cJSON_GetObjectItem(parent, "Items");
-    if (!items || !cJSON_IsArray(items)) return;
-
-    cJSON *item = NULL;
-    cJSON_ArrayForEach(item, items) {
-        cJSON *item_status = cJSON_GetObjectItem(item, "Status");
-        cJSON *item_name = cJSON_GetObjectItem(item, "Name");
-        if (!item_status || !item_status->valuestring || !item_name || !item_name->valuestring) continue;
+    // Find the earliest binding condition (time, horizon, dawn, etc.)
+    data->target_time_remaining[0] = '\0';
+    data->target_time_reason[0] = '\0';
+    /* now_epoch: NINA clock domain (falls back to time(NULL) while
+     * unknown). This runs on the instance's poll task — the same
+     * task that writes the clock pair in the camera-info fetcher —
+     * so the unlocked read cannot tear. */
+    const char *reason;
+    int condition_count;
+    int min_seconds = find_earliest_condition(idx, w->target, nina_client_now_epoch(data),
+                                              &reason, &condition_count);
+    data->target_condition_count = condition_count;
+    if (min_seconds >= 0) {
+        int h = min_seconds / 3600;
+        int m = (min_seconds % 3600) / 60;
+        snprintf(data->target_time_remaining,
+                 sizeof(data->target_time_remaining),
+                 "%dh %02dm", h, m);
+        strlcpy(data->target_time_reason, reason, sizeof(data->target_time_reason));
+        ESP_LOGI(TAG, "Earliest condition: %s %s (%s)",
+                 data->target_time_remaining, data->target_time_reason, reason);
+    }
 
-        if (strcmp(item_status->valuestring, "RUNNING") == 0) {
-            cJSON *child_items = cJSON_GetObjectItem(item, "Items");
-            if (child_items && cJSON_IsArray(child_items) && cJSON_GetArraySize(child_items) > 0) {
-                // This is a container - recurse deeper
-                find_running_step_name(item, out, out_size);
-                if (out[0] == '\0') {
-                    strncpy(out, item_name->valuestring, out_size - 1);
-                    out[out_size - 1] = '\0';
-                    char *suffix = strstr(out, "_Container");
-                    if (suffix) *suffix = '\0';
-                }
-            } else {
-                // Leaf instruction - this is the current step
-                strncpy(out, item_name->valuestring, out_size - 1);
-                out[out_size - 1] = '\0';
-            }
-            return;
+    // Currently running step; a container step drops its "_Container" suffix
+    data->container_step[0] = '\0';
+    if (w->step != SEQ_NO_NODE) {
+        const char *name = seq_index_name(idx, w->step);
+        if (idx->nodes[w->step].first_child != SEQ_NO_NODE) {
+            copy_stripped(data->container_step, sizeof(data->container_step), name);
+        } else {
+            strlcpy(data->container_step, name, sizeof(data->container_step));
         }
+        ESP_LOGI(TAG, "Active step: %s", data->container_step);
     }
-}
-
-// Helper function to recursively search for RUNNING Smart Exposure
-static cJSON* find_running_smart_exposure(cJSON *container) {
-    if (!container) return NULL;
 
-    cJSON *items = cJSON_GetObjectItem(container, "Items");
-    if (!items || !cJSON_IsArray(items)) return NULL;
-
-    cJSON *item = NULL;
-    cJSON_ArrayForEach(item, items) {
-        cJSON *item_name = cJSON_GetObjectItem(item, "Name");
-        cJSON *item_status = cJSON_GetObjectItem(item, "Status");
-
-        if (item_name && item_name->valuestring &&
-            strcmp(item_name->valuestring, "Smart Exposure") == 0) {
-            if (item_status && item_status->valuestring &&
-                strcmp(item_status->valuestring, "RUNNING") == 0) {
-                return item;
-            }
+    // RUNNING Smart Exposure counters
+    if (w->smart_exposure != SEQ_NO_NODE) {
+        const seq_node_t *exp = &idx->nodes[w->smart_exposure];
+        if (exp->flags & SEQ_NODE_HAS_COMPLETED) data->exposure_count = exp->completed_iterations;
+        if (exp->flags & SEQ_NODE_HAS_ITERATIONS) data->exposure_iterations = exp->iterations;
+        if (exp->flags & SEQ_NODE_HAS_EXP_COUNT) data->exposure_total_count = exp->exposure_count;
+        if (exp->flags & SEQ_NODE_HAS_EXP_TIME) {
+            data->exposure_total = exp->exposure_time;
+            ESP_LOGI(TAG, "ExposureTime (from running sequence): %.1fs", data->exposure_total);
         }
-
-        cJSON *nested = find_running_smart_exposure(item);
-        if (nested) return nested;
+        ESP_LOGI(TAG, "Exposure count: %d/%d", data->exposure_count, data->exposure_iterations);
+    } else {
+        ESP_LOGD(TAG, "No RUNNING Smart Exposure found (sequence may be idle)");
     }
-
-    return NULL;
 }
 
-void fetch_sequence_counts_optional(const char *base_url, nina_client_t *data) {
+void fetch_sequence_counts_optional(const char *base_url, nina_client_t *data,
+                                    nina_poll_state_t *state) {
     char url[256];
     snprintf(url, sizeof(url), "%ssequence/json", base_url);
 
-    cJSON *json = http_get_json(url);
-    if (!json) {
-        ESP_LOGW(TAG, "Sequence data unavailable - exposure counts will not be shown");
-        return;
-    }
-
-    cJSON *response = cJSON_GetObjectItem(json, "Response");
-    if (!response || !cJSON_IsArray(response)) {
-        cJSON_Delete(json);
-        return;
+    seq_cache_t *cache = state ? (seq_cache_t *)state->seq_cache : NULL;
+    if (!cache) {
+        cache = heap_caps_malloc(sizeof(*cache), MALLOC_CAP_SPIRAM);
+        if (!cache) {
+            ESP_LOGW(TAG, "No memory for the sequence index");
+            return;
+        }
+        seq_walk_reset(&cache->walk);
+        if (state) state->seq_cache = cache;
     }
 
-    // Search for Targets_Container
-    cJSON *item = NULL;
-    cJSON_ArrayForEach(item, response) {
-        cJSON *name = cJSON_GetObjectItem(item, "Name");
-        if (name && name->valuestring && strcmp(name->valuestring, "Targets_Container") == 0) {
-            cJSON *items = cJSON_GetObjectItem(item, "Items");
-            if (items && cJSON_IsArray(items) && cJSON_GetArraySize(items) > 0) {
-                cJSON *target_container = find_active_target_container(item);
-                if (!target_container) target_container = cJSON_GetArrayItem(items, 0);
-
-                // Resolve target name from the active target container.
-                cJSON *target_name_json = cJSON_GetObjectItem(target_container, "Name");
-                if (target_name_json && target_name_json->valuestring) {
-                    char temp_name[64];
-                    strlcpy(temp_name, target_name_json->valuestring, sizeof(temp_name));
-
-                    char *suffix = strstr(temp_name, "_Container");
-                    if (suffix) *suffix = '\0';
-
-                    // Is the chosen container actually RUNNING? (find_active_target_container can
-                    // return a FINISHED container as fallback; only a RUNNING one is a real active target.)
-                    cJSON *tc_status = cJSON_GetObjectItem(target_container, "Status");
-                    bool tc_running = (tc_status && tc_status->valuestring &&
-                                       strcmp(tc_status->valuestring, "RUNNING") == 0);
-
-                    if (temp_name[0] != '\0' && tc_running &&
-                        strcmp(temp_name, data->prev_target_container) != 0) {
-                        // New RUNNING target container detected -> authoritative update at sequence/target start
-                        strlcpy(data->target_name, temp_name, sizeof(data->target_name));
-                        strlcpy(data->prev_target_container, temp_name, sizeof(data->prev_target_container));
-                        ESP_LOGI(TAG, "Target (new RUNNING container): %s", data->target_name);
-                    } else if (temp_name[0] != '\0' &&
-                               (data->target_name[0] == '\0' ||
-                                strcmp(data->target_name, "No Target") == 0)) {
-                        // Existing fallback: fill when we have no name yet (idle/CREATED/boot)
-                        strlcpy(data->target_name, temp_name, sizeof(data->target_name));
-                        ESP_LOGI(TAG, "Target (fallback from sequence): %s", data->target_name);
-                    }
-                }
-
-                // Find the active container name
-                find_active_container_name(target_container, data->container_name, sizeof(data->container_name));
-                if (data->container_name[0] != '\0') {
-                    ESP_LOGI(TAG, "Active container: %s", data->container_name);
-                }
-
-                // Find the earliest binding condition (time, horizon, dawn, etc.)
-                data->target_time_remaining[0] = '\0';
-                data->target_time_reason[0] = '\0';
-                /* now_epoch: NINA clock domain (falls back to time(NULL) while
-                 * unknown). This runs on the instance's poll task — the same
-                 * task that writes the clock pair in the camera-info fetcher —
-                 * so the unlocked read cannot tear. */
-                earliest_condition_t earliest = { .min_seconds = -1, .reason = "TIME LIMIT",
-                                                  .condition_count = 0,
-                                                  .now_epoch = nina_client_now_epoch(data) };
-                find_earliest_condition(target_container, &earliest);
-                data->target_condition_count = earliest.condition_count;
-                if (earliest.min_seconds >= 0) {
-                    int h = earliest.min_seconds / 3600;
-                    int m = (earliest.min_seconds % 3600) / 60;
-                    snprintf(data->target_time_remaining,
-                             sizeof(data->target_time_remaining),
-                             "%dh %02dm", h, m);
-                    strlcpy(data->target_time_reason, earliest.reason,
-                            sizeof(data->target_time_reason));
-                    ESP_LOGI(TAG, "Earliest condition: %s %s (%s)",
-                             data->target_time_remaining, data->target_time_reason,
-                             earliest.reason);
-                }
-
-                // Find the currently running step
-                data->container_step[0] = '\0';
-                find_running_step_name(target_container, data->container_step, sizeof(data->container_step));
-                if (data->container_step[0] != '\0') {
-                    ESP_LOGI(TAG, "Active step: %s", data->container_step);
-                }
-
-                // Recursively search for RUNNING Smart Exposure
-                cJSON *running_exp = find_running_smart_exposure(target_container);
-
-                if (running_exp) {
-                    cJSON *completed = cJSON_GetObjectItem(running_exp, "CompletedIterations");
-                    if (completed && cJSON_IsNumber(completed)) {
-                        data->exposure_count = completed->valueint;
-                    }
-
-                    cJSON *iterations = cJSON_GetObjectItem(running_exp, "Iterations");
-                    if (iterations && cJSON_IsNumber(iterations)) {
-                        data->exposure_iterations = iterations->valueint;
-                    }
-
-                    cJSON *exp_count = cJSON_GetObjectItem(running_exp, "ExposureCount");
-                    if (exp_count && cJSON_IsNumber(exp_count)) {
-                        data->exposure_total_count = exp_count->valueint;
-                    }
-
-                    cJSON *exp_time = cJSON_GetObjectItem(running_exp, "ExposureTime");
-                    if (exp_time && cJSON_IsNumber(exp_time)) {
-                        data->exposure_total = (float)exp_time->valuedouble;
-                        ESP_LOGI(TAG, "ExposureTime (from running sequence): %.1fs", data->exposure_total);
-                    }
-
-                    ESP_LOGI(TAG, "Exposure count: %d/%d", data->exposure_count, data->exposure_iterations);
-                } else {
-                    ESP_LOGD(TAG, "No RUNNING Smart Exposure found (sequence may be idle)");
-                }
-            }
-            break;
+    json_stream_init(&cache->js, seq_index_stream_cb, &cache->idx);
+    if (!http_get_json_stream(url, &cache->js, NULL)) {
+        ESP_LOGW(TAG, "Sequence data unavailable - exposure counts will not be shown");
+    } else {
+        const seq_index_t *idx = &cache->idx;
+        if (idx->truncated) {
+            ESP_LOGW(TAG, "Sequence exceeds the index (%d items, %d conditions); rest ignored",
+                     idx->count, idx->cond_count);
+        }
+        bool walked = seq_index_walk(idx, &cache->walk);
+        if (cache->walk.target != SEQ_NO_NODE) {
+            ESP_LOGD(TAG, "Sequence: %d items, %s", idx->count,
+                     walked ? "shape changed, re-walked" : "shape unchanged, walk reused");
+            apply_sequence(idx, &cache->walk, data);
         }
     }
 
-    cJSON_Delete(json);
+    if (!state) heap_caps_free(cache);
 }
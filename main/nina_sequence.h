@@ -2,7 +2,7 @@
 
 /**
  * @file nina_sequence.h
- * @brief Sequence JSON tree walkers for NINA.
+ * @brief Sequence summary from NINA's sequence/json endpoint.
  *
  * Internal header — only included by nina_client.c.
  */
@@ -12,5 +12,10 @@
 /**
  * @brief Try to get exposure count/iterations/time from sequence (OPTIONAL - may fail).
  * This is the only part that depends on sequence structure.
+ *
+ * @param state  Poll state holding the sequence index between polls (allocated
+ *               on first use, freed by nina_poll_state_init()). NULL for a
+ *               one-off fetch: the index is built and dropped in this call.
  */
-void fetch_sequence_counts_optional(const char *base_url, nina_client_t *data);
+void fetch_sequence_counts_optional(const char *base_url, nina_client_t *data,
+                                    nina_poll_state_t *state);
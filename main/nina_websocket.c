@@ -5,7 +5,8 @@
  * Maintains one persistent WebSocket connection per NINA instance
  * (up to MAX_NINA_INSTANCES). Each connection receives IMAGE-SAVE,
  * FILTERWHEEL-CHANGED, SEQUENCE-FINISHED, SEQUENCE-STARTING,
- * GUIDER-DITHER, and GUIDER-START events independently.
+ * GUIDER-DITHER, and GUIDER-START events independently. Messages are
+ * decoded fragment by fragment with ws_event (no reassembly, no cJSON).
  */
 
 #include "nina_websocket.h"
@@ -16,11 +17,13 @@
 #include "esp_timer.h"
 #include "esp_heap_caps.h"
 #include "freertos/task.h"
-#include "cJSON.h"
 #include <string.h>
+#include <strings.h>
 #include <stdarg.h>
 #include <stdatomic.h>
 #include "perf_monitor.h"
+#include "trace.h"
+#include "ws_event.h"
 #include "nina_connection.h"
 #include "tasks.h"
 #include "ui/nina_toast.h"
@@ -34,9 +37,6 @@ static const char *TAG = "nina_ws";
 #define WS_BACKOFF_INITIAL_MS  5000
 #define WS_BACKOFF_MAX_MS      60000
 
-/* Fragmented-frame reassembly cap. Frames larger than this are dropped. */
-#define WS_REASM_MAX_BYTES     (16 * 1024)
-
 static esp_websocket_client_handle_t ws_clients[MAX_NINA_INSTANCES];
 static nina_client_t *ws_client_data[MAX_NINA_INSTANCES];
 
@@ -54,12 +54,11 @@ static SemaphoreHandle_t ws_life_mutex[MAX_NINA_INSTANCES];
 static StaticSemaphore_t ws_life_mutex_buf[MAX_NINA_INSTANCES];
 static _Atomic int       ws_life_mutex_state[MAX_NINA_INSTANCES]; // 0=uninit,1=creating,2=ready
 
-/* Per-instance fragment reassembly buffer (PSRAM, kept between messages). */
-static char    *ws_reasm_buf[MAX_NINA_INSTANCES];
-static int      ws_reasm_cap[MAX_NINA_INSTANCES];   // allocated capacity
-static int      ws_reasm_len[MAX_NINA_INSTANCES];   // expected total for active message
-static int      ws_reasm_have[MAX_NINA_INSTANCES];  // bytes accumulated
-static int64_t  ws_reasm_warn_ms[MAX_NINA_INSTANCES];
+/* Per-instance streaming event decoder (PSRAM, kept between messages). */
+static ws_event_decoder_t *ws_decoder[MAX_NINA_INSTANCES];
+static int      ws_msg_len[MAX_NINA_INSTANCES];     // expected total for active message
+static int      ws_msg_have[MAX_NINA_INSTANCES];    // bytes received
+static bool     ws_msg_done[MAX_NINA_INSTANCES];    // dispatched or rejected already
 
 static SemaphoreHandle_t ws_get_life_mutex(int index) {
     int expected = 0;
@@ -78,16 +77,13 @@ static SemaphoreHandle_t ws_get_life_mutex(int index) {
 /* ── Connect aggregation state ──────────────────────────────────────── */
 #define CONNECT_AGG_IDLE_TIMEOUT_MS 60000
 
-typedef enum {
-    EQ_CAMERA = 0, EQ_MOUNT, EQ_GUIDER, EQ_FOCUSER, EQ_FILTERWHEEL,
-    EQ_ROTATOR, EQ_SAFETY, EQ_DOME, EQ_FLAT, EQ_SWITCH, EQ_WEATHER,
-    EQ_COUNT
-} equipment_type_t;
-
+/* Indexed by ws_equipment_t (ws_event_info_t.equipment). */
 static const char *equipment_names[] = {
     "Camera", "Mount", "Guider", "Focuser", "Filterwheel",
     "Rotator", "Safety", "Dome", "Flat", "Switch", "Weather"
 };
+_Static_assert(sizeof(equipment_names) / sizeof(equipment_names[0]) == WS_EQ_COUNT,
+               "equipment_names must match ws_equipment_t");
 
 typedef struct {
     int64_t  window_start_ms;       // 0 = no active window
@@ -173,7 +169,7 @@ static void agg_timer_cb(void *arg) {
     if (connect_final) {
         /* Count connected equipment */
         int count = 0;
-        for (int i = 0; i < EQ_COUNT; i++) {
+        for (int i = 0; i < WS_EQ_COUNT; i++) {
             if (connect_final & (1 << i)) count++;
         }
 
@@ -196,7 +192,7 @@ static void agg_timer_cb(void *arg) {
                 pos = snprintf(buf, sizeof(buf), "Connected ");
 
             bool first = true;
-            for (int i = 0; i < EQ_COUNT && pos < (int)sizeof(buf) - 2; i++) {
+            for (int i = 0; i < WS_EQ_COUNT && pos < (int)sizeof(buf) - 2; i++) {
                 if (connect_final & (1 << i)) {
                     if (!first) pos += snprintf(buf + pos, sizeof(buf) - pos, ", ");
                     pos += snprintf(buf + pos, sizeof(buf) - pos, "%s", equipment_names[i]);
@@ -205,7 +201,7 @@ static void agg_timer_cb(void *arg) {
             }
         }
 
-        if ((cfg->toast_notify_mask & (1 << 0)) && !cfg->toast_instance_muted[index]) {
+        if ((cfg->toast_notify_mask & WS_TOAST_BIT(WS_TOAST_CONNECT)) && !cfg->toast_instance_muted[index]) {
             nina_toast_show(TOAST_SUCCESS, buf);
         }
     }
@@ -222,14 +218,14 @@ static void agg_timer_cb(void *arg) {
             nina_client_unlock(data);
         }
 
-        for (int i = 0; i < EQ_COUNT; i++) {
+        for (int i = 0; i < WS_EQ_COUNT; i++) {
             if (!(disc_final & (1 << i))) continue;
 
             toast_severity_t sev = TOAST_WARNING;
-            if (i == EQ_SAFETY) sev = TOAST_ERROR;
+            if (i == WS_EQ_SAFETY) sev = TOAST_ERROR;
             else if (seq_running) sev = TOAST_ERROR;
 
-            if ((cfg->toast_notify_mask & (1 << 1)) && !cfg->toast_instance_muted[index]) {
+            if ((cfg->toast_notify_mask & WS_TOAST_BIT(WS_TOAST_DISCONNECT)) && !cfg->toast_instance_muted[index]) {
                 ws_toast_fmt(index, sev, "%s disconnected", equipment_names[i]);
             }
             nina_event_log_add_fmt(sev == TOAST_ERROR ? EVENT_SEV_ERROR : EVENT_SEV_WARNING,
@@ -239,13 +235,13 @@ static void agg_timer_cb(void *arg) {
 }
 
 /* ── Record connect event (with aggregation) ────────────────────────── */
-static void record_connect_event(int index, equipment_type_t eq) {
+static void record_connect_event(int index, ws_equipment_t eq) {
     const app_config_t *cfg = app_config_get();
     int64_t now = esp_timer_get_time() / 1000;
 
     // If aggregation disabled, show individual toast
     if (cfg->toast_aggregation_window_s == 0) {
-        if ((cfg->toast_notify_mask & (1 << 0)) && !cfg->toast_instance_muted[index]) {
+        if ((cfg->toast_notify_mask & WS_TOAST_BIT(WS_TOAST_CONNECT)) && !cfg->toast_instance_muted[index]) {
             ws_toast(index, TOAST_SUCCESS, equipment_names[eq]);
         }
         nina_event_log_add_fmt(EVENT_SEV_INFO, index, "%s connected", equipment_names[eq]);
@@ -297,7 +293,7 @@ static void record_connect_event(int index, equipment_type_t eq) {
  * boundary so they can cancel with subsequent reconnects. This prevents
  * false disconnect toasts during NINA's connect handshake.
  * ──────────────────────────────────────────────────────────────────── */
-static void record_disconnect_event(int index, equipment_type_t eq) {
+static void record_disconnect_event(int index, ws_equipment_t eq) {
     const app_config_t *cfg = app_config_get();
     int64_t now = esp_timer_get_time() / 1000;
 
@@ -348,7 +344,7 @@ static void record_disconnect_event(int index, equipment_type_t eq) {
     if (!(s_ever_connected[index] & (1 << eq))) return;
 
     toast_severity_t sev = TOAST_WARNING;
-    if (eq == EQ_SAFETY) {
+    if (eq == WS_EQ_SAFETY) {
         sev = TOAST_ERROR;
     } else {
         nina_client_t *data = ws_client_data[index];
@@ -358,211 +354,140 @@ static void record_disconnect_event(int index, equipment_type_t eq) {
         }
     }
 
-    if ((cfg->toast_notify_mask & (1 << 1)) && !cfg->toast_instance_muted[index]) {
+    if ((cfg->toast_notify_mask & WS_TOAST_BIT(WS_TOAST_DISCONNECT)) && !cfg->toast_instance_muted[index]) {
         ws_toast_fmt(index, sev, "%s disconnected", equipment_names[eq]);
     }
     nina_event_log_add_fmt(sev == TOAST_ERROR ? EVENT_SEV_ERROR : EVENT_SEV_WARNING,
                            index, "%s disconnected", equipment_names[eq]);
 }
 
-/* Check if a notification category is enabled for this instance */
-static bool toast_allowed(int index, int category_bit) {
+/* Check if any of the event's notification categories is enabled for this instance */
+static bool toast_allowed(int index, const ws_event_info_t *info) {
     const app_config_t *cfg = app_config_get();
-    return (cfg->toast_notify_mask & (1 << category_bit)) &&
+    return (cfg->toast_notify_mask & info->toast_mask) &&
            !cfg->toast_instance_muted[index];
 }
 
 /**
- * @brief Process incoming WebSocket JSON event from NINA
+ * @brief Dispatch one decoded NINA WebSocket event (see ws_event.h).
  */
-static void handle_websocket_message(int index, const char *payload, int len) {
+static void handle_websocket_event(int index, const ws_event_t *ev) {
     nina_client_t *data = ws_client_data[index];
-    if (!data || !payload || len <= 0) return;
-
-    perf_counter_increment(&g_perf.ws_event_count);
-
-    cJSON *json = cJSON_ParseWithLength(payload, len);
-    if (!json) return;
-
-    cJSON *response = cJSON_GetObjectItem(json, "Response");
-    if (!response) {
-        cJSON_Delete(json);
-        return;
-    }
-
-    cJSON *evt = cJSON_GetObjectItem(response, "Event");
-    if (!evt || !evt->valuestring) {
-        cJSON_Delete(json);
-        return;
-    }
+    if (!data) return;
 
+    switch (ev->type) {
     // IMAGE-SAVE: Capture full ImageStatistics for dashboard and info overlay
-    if (strcmp(evt->valuestring, "IMAGE-SAVE") == 0) {
+    case WS_EVT_IMAGE_SAVE: {
         ESP_LOGI(TAG, "WS[%d]: IMAGE-SAVE event received", index);
+        if (!(ev->fields & WS_F_STATS)) break;
+
+        const ws_event_stats_t *st = &ev->stats;
+        float new_hfr = (ev->fields & WS_F_HFR) ? st->hfr : data->hfr;
+        int new_stars = (ev->fields & WS_F_STARS) ? st->stars : data->stars;
+        float new_exp_total = (ev->fields & WS_F_EXPOSURE) ? st->exposure_time
+                                                           : data->exposure_total;
+        const char *new_target = ((ev->fields & WS_F_STATS_TARGET) && st->target_name[0] != '\0')
+                                 ? st->target_name : NULL;
+        const char *new_telescope = (ev->fields & WS_F_TELESCOPE) ? st->telescope_name : NULL;
+
+        // Older plugin versions omit ImageType; treat those as LIGHT
+        bool is_light = !(ev->fields & WS_F_IMAGE_TYPE) ||
+                        strcasecmp(st->image_type, "LIGHT") == 0;
+
+        // Extended ImageStatistics for info overlay
+        imagestats_detail_data_t img_stats = {0};
+        img_stats.has_data = true;
+        img_stats.hfr = new_hfr;
+        img_stats.stars = new_stars;
+        img_stats.exposure_time = new_exp_total;
+        img_stats.hfr_stdev = st->hfr_stdev;
+        img_stats.mean = st->mean;
+        img_stats.median = st->median;
+        img_stats.stdev = st->stdev;
+        img_stats.min_val = st->min_val;
+        img_stats.max_val = st->max_val;
+        img_stats.gain = st->gain;
+        img_stats.offset = st->offset;
+        img_stats.temperature = st->temperature;
+        img_stats.focal_length = st->focal_length;
+        strlcpy(img_stats.filter, st->filter, sizeof(img_stats.filter));
+        strlcpy(img_stats.camera_name, st->camera_name, sizeof(img_stats.camera_name));
+        if (new_telescope)
+            strlcpy(img_stats.telescope_name, new_telescope, sizeof(img_stats.telescope_name));
+        strlcpy(img_stats.date, st->date, sizeof(img_stats.date));
+        strlcpy(img_stats.filename, st->filename, sizeof(img_stats.filename));
+
+        // Snapshots for post-unlock logging (avoid racing reads of data->)
+        int log_exposure_count = 0;
+        char log_target_name[64] = {0};
+
+        // Short critical section: write parsed values into the shared struct
+        if (nina_client_lock(data, 50)) {
+            data->hfr = new_hfr;
+            data->stars = new_stars;
+            data->exposure_total = new_exp_total;
+            if (new_target) {
+                strlcpy(data->target_name, new_target, sizeof(data->target_name));
+            }
+            if (new_telescope) {
+                strlcpy(data->telescope_name, new_telescope, sizeof(data->telescope_name));
+            }
+            data->last_image_stats = img_stats;
+            data->new_image_available = true;
+            data->ui_refresh_needed = true;
+            data->sequence_poll_needed = true;
 
-        cJSON *stats = cJSON_GetObjectItem(response, "ImageStatistics");
-        if (stats) {
-            // Extract all values from JSON before taking the lock
-            float new_hfr = data->hfr;
-            int new_stars = data->stars;
-            float new_exp_total = data->exposure_total;
-            const char *new_target = NULL;
-            const char *new_telescope = NULL;
-
-            cJSON *hfr = cJSON_GetObjectItem(stats, "HFR");
-            if (hfr) new_hfr = (float)hfr->valuedouble;
-
-            cJSON *stars = cJSON_GetObjectItem(stats, "Stars");
-            if (stars) new_stars = stars->valueint;
-
-            cJSON *exp = cJSON_GetObjectItem(stats, "ExposureTime");
-            if (exp) new_exp_total = (float)exp->valuedouble;
-
-            cJSON *target = cJSON_GetObjectItem(stats, "TargetName");
-            if (target && target->valuestring && target->valuestring[0] != '\0')
-                new_target = target->valuestring;
-
-            cJSON *telescope = cJSON_GetObjectItem(stats, "TelescopeName");
-            if (telescope && telescope->valuestring)
-                new_telescope = telescope->valuestring;
-
-            // Extract extended ImageStatistics for info overlay
-            imagestats_detail_data_t img_stats = {0};
-            img_stats.has_data = true;
-            img_stats.hfr = new_hfr;
-            img_stats.stars = new_stars;
-            img_stats.exposure_time = new_exp_total;
-
-            cJSON *hfr_stdev = cJSON_GetObjectItem(stats, "HFRStDev");
-            if (hfr_stdev) img_stats.hfr_stdev = (float)hfr_stdev->valuedouble;
-
-            cJSON *mean = cJSON_GetObjectItem(stats, "Mean");
-            if (mean) img_stats.mean = (float)mean->valuedouble;
-
-            cJSON *median = cJSON_GetObjectItem(stats, "Median");
-            if (median) img_stats.median = (float)median->valuedouble;
-
-            cJSON *stdev = cJSON_GetObjectItem(stats, "StDev");
-            if (stdev) img_stats.stdev = (float)stdev->valuedouble;
-
-            cJSON *min_val = cJSON_GetObjectItem(stats, "Min");
-            if (min_val) img_stats.min_val = min_val->valueint;
-
-            cJSON *max_val = cJSON_GetObjectItem(stats, "Max");
-            if (max_val) img_stats.max_val = max_val->valueint;
-
-            cJSON *gain = cJSON_GetObjectItem(stats, "Gain");
-            if (gain) img_stats.gain = gain->valueint;
-
-            cJSON *offset = cJSON_GetObjectItem(stats, "Offset");
-            if (offset) img_stats.offset = offset->valueint;
-
-            cJSON *temperature = cJSON_GetObjectItem(stats, "Temperature");
-            if (temperature) img_stats.temperature = (float)temperature->valuedouble;
-
-            cJSON *filter = cJSON_GetObjectItem(stats, "Filter");
-            if (filter && filter->valuestring)
-                strncpy(img_stats.filter, filter->valuestring, sizeof(img_stats.filter) - 1);
-
-            cJSON *camera_name = cJSON_GetObjectItem(stats, "CameraName");
-            if (camera_name && camera_name->valuestring)
-                strncpy(img_stats.camera_name, camera_name->valuestring, sizeof(img_stats.camera_name) - 1);
-
-            if (new_telescope)
-                strncpy(img_stats.telescope_name, new_telescope, sizeof(img_stats.telescope_name) - 1);
-
-            cJSON *focal_length = cJSON_GetObjectItem(stats, "FocalLength");
-            if (focal_length) img_stats.focal_length = focal_length->valueint;
+            // Account for the frame in the local HFR store (used for the
+            // HFR graph); only LIGHTs, matching ?imageType=LIGHT syncs
+            if (is_light) {
+                hfr_store_note_image(&data->hfr_ring, new_hfr, new_stars);
+            }
 
-            cJSON *date = cJSON_GetObjectItem(stats, "Date");
-            if (date && date->valuestring)
-                strncpy(img_stats.date, date->valuestring, sizeof(img_stats.date) - 1);
+            log_exposure_count = data->exposure_count;
+            snprintf(log_target_name, sizeof(log_target_name), "%s", data->target_name);
 
-            cJSON *filename = cJSON_GetObjectItem(stats, "Filename");
-            if (filename && filename->valuestring)
-                strncpy(img_stats.filename, filename->valuestring, sizeof(img_stats.filename) - 1);
+            nina_client_unlock(data);
+        } else {
+            ESP_LOGW(TAG, "WS[%d]: Could not acquire mutex for IMAGE-SAVE", index);
+        }
 
-            // Snapshots for post-unlock logging (avoid racing reads of data->)
-            int log_exposure_count = 0;
-            char log_target_name[64] = {0};
+        nina_event_log_add_fmt(EVENT_SEV_INFO, index,
+            "Image #%d: %s, HFR %.2f, %d stars",
+            log_exposure_count, img_stats.filter, new_hfr, new_stars);
+        nina_session_stats_add_exposure(index, new_exp_total);
 
-            // Short critical section: write parsed values into the shared struct
+        ESP_LOGI(TAG, "WS[%d]: HFR=%.2f Stars=%d Filter=%s Target=%s",
+            index, new_hfr, new_stars,
+            img_stats.filter, log_target_name);
+        break;
+    }
+    // FILTERWHEEL-CHANGED: Replaces fetch_filter_robust_ex for current filter
+    case WS_EVT_FILTERWHEEL_CHANGED:
+        if (ev->fields & WS_F_NEW_NAME) {
             if (nina_client_lock(data, 50)) {
-                data->hfr = new_hfr;
-                data->stars = new_stars;
-                data->exposure_total = new_exp_total;
-                if (new_target) {
-                    strncpy(data->target_name, new_target,
-                            sizeof(data->target_name) - 1);
-                }
-                if (new_telescope) {
-                    strncpy(data->telescope_name, new_telescope,
-                            sizeof(data->telescope_name) - 1);
-                }
-                data->last_image_stats = img_stats;
-                data->new_image_available = true;
+                strlcpy(data->current_filter, ev->new_name, sizeof(data->current_filter));
                 data->ui_refresh_needed = true;
-                data->sequence_poll_needed = true;
-
-                // Append to local HFR ring buffer (used for graph auto-refresh)
-                if (data->hfr_ring.hfr && new_hfr > 0) {
-                    int idx = data->hfr_ring.write_idx;
-                    data->hfr_ring.hfr[idx]   = new_hfr;
-                    data->hfr_ring.stars[idx]  = new_stars;
-                    data->hfr_ring.write_idx   = (idx + 1) % HFR_RING_SIZE;
-                    data->hfr_ring.count++;
-                }
-
-                log_exposure_count = data->exposure_count;
-                snprintf(log_target_name, sizeof(log_target_name), "%s", data->target_name);
-
                 nina_client_unlock(data);
-            } else {
-                ESP_LOGW(TAG, "WS[%d]: Could not acquire mutex for IMAGE-SAVE", index);
             }
-
             nina_event_log_add_fmt(EVENT_SEV_INFO, index,
-                "Image #%d: %s, HFR %.2f, %d stars",
-                log_exposure_count, img_stats.filter, new_hfr, new_stars);
-            nina_session_stats_add_exposure(index, new_exp_total);
-
-            ESP_LOGI(TAG, "WS[%d]: HFR=%.2f Stars=%d Filter=%s Target=%s",
-                index, new_hfr, new_stars,
-                img_stats.filter, log_target_name);
+                "Filter changed to %s", ev->new_name);
+            ESP_LOGI(TAG, "WS[%d]: Filter changed to %s", index, ev->new_name);
         }
-    }
-    // FILTERWHEEL-CHANGED: Replaces fetch_filter_robust_ex for current filter
-    else if (strcmp(evt->valuestring, "FILTERWHEEL-CHANGED") == 0) {
-        cJSON *new_f = cJSON_GetObjectItem(response, "New");
-        if (new_f) {
-            cJSON *name = cJSON_GetObjectItem(new_f, "Name");
-            if (name && name->valuestring) {
-                if (nina_client_lock(data, 50)) {
-                    strncpy(data->current_filter, name->valuestring,
-                            sizeof(data->current_filter) - 1);
-                    data->ui_refresh_needed = true;
-                    nina_client_unlock(data);
-                }
-                nina_event_log_add_fmt(EVENT_SEV_INFO, index,
-                    "Filter changed to %s", name->valuestring);
-                ESP_LOGI(TAG, "WS[%d]: Filter changed to %s", index, name->valuestring);
-            }
-        }
-    }
+        break;
     // SEQUENCE-FINISHED: Mark sequence as done
-    else if (strcmp(evt->valuestring, "SEQUENCE-FINISHED") == 0) {
+    case WS_EVT_SEQUENCE_FINISHED:
         if (nina_client_lock(data, 50)) {
             strcpy(data->status, "FINISHED");
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 2))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_SUCCESS, "Sequence completed");
         nina_event_log_add(EVENT_SEV_SUCCESS, index, "Sequence completed");
         ESP_LOGI(TAG, "WS[%d]: Sequence finished", index);
-    }
+        break;
     // SEQUENCE-STARTING: Mark sequence as running
-    else if (strcmp(evt->valuestring, "SEQUENCE-STARTING") == 0) {
+    case WS_EVT_SEQUENCE_STARTING:
         if (nina_client_lock(data, 50)) {
             strcpy(data->status, "RUNNING");
             data->is_waiting = false;
@@ -570,14 +495,14 @@ static void handle_websocket_message(int index, const char *payload, int len) {
             data->sequence_poll_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 2))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Sequence started");
         nina_event_log_add(EVENT_SEV_INFO, index, "Sequence started");
         nina_session_stats_reset(index);
         ESP_LOGI(TAG, "WS[%d]: Sequence starting", index);
-    }
+        break;
     // GUIDER-DITHER: Flag dithering state
-    else if (strcmp(evt->valuestring, "GUIDER-DITHER") == 0) {
+    case WS_EVT_GUIDER_DITHER:
         if (nina_client_lock(data, 50)) {
             data->is_dithering = true;
             data->ui_refresh_needed = true;
@@ -585,36 +510,36 @@ static void handle_websocket_message(int index, const char *payload, int len) {
         }
         nina_event_log_add(EVENT_SEV_INFO, index, "Dithering");
         ESP_LOGI(TAG, "WS[%d]: Dithering", index);
-    }
+        break;
     // GUIDER-START: Clear dithering flag
-    else if (strcmp(evt->valuestring, "GUIDER-START") == 0) {
+    case WS_EVT_GUIDER_START:
         if (nina_client_lock(data, 50)) {
             data->is_dithering = false;
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
         ESP_LOGI(TAG, "WS[%d]: Guiding started", index);
-    }
+        break;
     // TS-NEWTARGETSTART: New target started in sequence — instant target name update
-    else if (strcmp(evt->valuestring, "TS-NEWTARGETSTART") == 0) {
-        cJSON *target_name = cJSON_GetObjectItem(response, "TargetName");
+    case WS_EVT_TS_NEWTARGETSTART: {
+        bool has_name = (ev->fields & WS_F_TARGET_NAME) != 0;
         if (nina_client_lock(data, 50)) {
-            if (target_name && target_name->valuestring && target_name->valuestring[0] != '\0') {
-                strncpy(data->target_name, target_name->valuestring,
-                        sizeof(data->target_name) - 1);
+            if (has_name && ev->target_name[0] != '\0') {
+                strlcpy(data->target_name, ev->target_name, sizeof(data->target_name));
             }
             data->is_waiting = false;
             data->ui_refresh_needed = true;
             data->sequence_poll_needed = true;
             nina_client_unlock(data);
         }
-        if (target_name && target_name->valuestring)
-            nina_event_log_add_fmt(EVENT_SEV_INFO, index, "New target: %s", target_name->valuestring);
+        if (has_name)
+            nina_event_log_add_fmt(EVENT_SEV_INFO, index, "New target: %s", ev->target_name);
         ESP_LOGI(TAG, "WS[%d]: New target: %s", index,
-                 target_name && target_name->valuestring ? target_name->valuestring : "(null)");
+                 has_name ? ev->target_name : "(null)");
+        break;
     }
     // AUTOFOCUS-STARTING: Clear V-curve buffer and mark AF running
-    else if (strcmp(evt->valuestring, "AUTOFOCUS-STARTING") == 0) {
+    case WS_EVT_AUTOFOCUS_STARTING:
         if (nina_client_lock(data, 50)) {
             memset(&data->autofocus, 0, sizeof(data->autofocus));
             data->autofocus.af_running = true;
@@ -624,9 +549,9 @@ static void handle_websocket_message(int index, const char *payload, int len) {
         }
         nina_event_log_add(EVENT_SEV_INFO, index, "Autofocus started");
         ESP_LOGI(TAG, "WS[%d]: Autofocus starting", index);
-    }
+        break;
     // AUTOFOCUS-FINISHED: Mark AF complete, find best point
-    else if (strcmp(evt->valuestring, "AUTOFOCUS-FINISHED") == 0) {
+    case WS_EVT_AUTOFOCUS_FINISHED: {
         float best_hfr = 999.0f;
         int best_pos = 0;
         int af_count = 0;
@@ -645,21 +570,19 @@ static void handle_websocket_message(int index, const char *payload, int len) {
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 3))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_SUCCESS, "Autofocus complete");
         nina_event_log_add_fmt(EVENT_SEV_SUCCESS, index,
             "Autofocus complete: pos %d, HFR %.2f",
             best_pos, best_hfr);
         ESP_LOGI(TAG, "WS[%d]: Autofocus finished (%d points)", index, af_count);
+        break;
     }
     // AUTOFOCUS-POINT-ADDED: Add V-curve data point {Position, HFR}
-    else if (strcmp(evt->valuestring, "AUTOFOCUS-POINT-ADDED") == 0) {
-        cJSON *position = cJSON_GetObjectItem(response, "Position");
-        cJSON *af_hfr = cJSON_GetObjectItem(response, "HFR");
-
-        if (position && af_hfr) {
-            int pos = position->valueint;
-            float hfr_val = (float)af_hfr->valuedouble;
+    case WS_EVT_AUTOFOCUS_POINT_ADDED:
+        if ((ev->fields & WS_F_POSITION) && (ev->fields & WS_F_AF_HFR)) {
+            int pos = ev->position;
+            float hfr_val = ev->af_hfr;
             int af_count = 0;
 
             if (nina_client_lock(data, 50)) {
@@ -676,24 +599,23 @@ static void handle_websocket_message(int index, const char *payload, int len) {
             ESP_LOGI(TAG, "WS[%d]: AF point: pos=%d HFR=%.2f (%d/%d)",
                      index, pos, hfr_val, af_count, MAX_AF_POINTS);
         }
-    }
+        break;
     // ROTATOR-MOVED / ROTATOR-MOVED-MECHANICAL: Update rotator angle from WS
-    else if (strcmp(evt->valuestring, "ROTATOR-MOVED") == 0 ||
-             strcmp(evt->valuestring, "ROTATOR-MOVED-MECHANICAL") == 0) {
-        cJSON *to = cJSON_GetObjectItem(response, "To");
-        if (to && nina_client_lock(data, 50)) {
-            data->rotator_angle = (float)to->valuedouble;
+    case WS_EVT_ROTATOR_MOVED: {
+        bool has_to = (ev->fields & WS_F_TO) != 0;
+        if (has_to && nina_client_lock(data, 50)) {
+            data->rotator_angle = ev->to;
             data->rotator_connected = true;
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
         ESP_LOGI(TAG, "WS[%d]: Rotator moved to %.1f", index,
-                 to ? (float)to->valuedouble : 0.0f);
+                 has_to ? ev->to : 0.0f);
+        break;
     }
     // SAFETY-CHANGED: Update safety monitor state
-    else if (strcmp(evt->valuestring, "SAFETY-CHANGED") == 0) {
-        cJSON *is_safe = cJSON_GetObjectItem(response, "IsSafe");
-        bool safe = is_safe && cJSON_IsTrue(is_safe);
+    case WS_EVT_SAFETY_CHANGED: {
+        bool safe = (ev->fields & WS_F_IS_SAFE) && ev->is_safe;
         if (nina_client_lock(data, 50)) {
             data->safety_connected = true;
             data->safety_is_safe = safe;
@@ -702,11 +624,11 @@ static void handle_websocket_message(int index, const char *payload, int len) {
         }
         /* Toast + event log (thread-safe, no lock needed) */
         if (safe) {
-            if (toast_allowed(index, 7))
+            if (toast_allowed(index, ev->info))
                 ws_toast(index, TOAST_SUCCESS, "Safe");
             nina_event_log_add(EVENT_SEV_SUCCESS, index, "Observatory is safe");
         } else {
-            if (toast_allowed(index, 7))
+            if (toast_allowed(index, ev->info))
                 ws_toast(index, TOAST_ERROR, "UNSAFE");
             nina_event_log_add(EVENT_SEV_ERROR, index, "Observatory UNSAFE!");
             if (app_config_get()->alert_flash_enabled) {
@@ -716,46 +638,46 @@ static void handle_websocket_message(int index, const char *payload, int len) {
         /* Safety state update (no display lock needed — state tracking only) */
         nina_safety_update(true, safe);
         ESP_LOGI(TAG, "WS[%d]: Safety changed: %s", index, safe ? "SAFE" : "UNSAFE");
+        break;
     }
     // TS-WAITSTART: Sequence entering wait state
-    else if (strcmp(evt->valuestring, "TS-WAITSTART") == 0) {
+    case WS_EVT_TS_WAITSTART:
         if (nina_client_lock(data, 50)) {
             data->is_waiting = true;
-            cJSON *wait_time = cJSON_GetObjectItem(response, "WaitStartTime");
-            if (wait_time && wait_time->valuestring) {
-                data->wait_start_epoch = parse_iso8601(wait_time->valuestring);
+            if (ev->fields & WS_F_WAIT_START) {
+                data->wait_start_epoch = parse_iso8601(ev->wait_start);
             }
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 2))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Waiting for next target");
         nina_event_log_add(EVENT_SEV_INFO, index, "Waiting for next target");
         ESP_LOGI(TAG, "WS[%d]: Waiting for next target", index);
-    }
+        break;
     // MOUNT-BEFORE-FLIP: Meridian flip starting
-    else if (strcmp(evt->valuestring, "MOUNT-BEFORE-FLIP") == 0) {
+    case WS_EVT_MOUNT_BEFORE_FLIP:
         if (nina_client_lock(data, 50)) {
             strncpy(data->meridian_flip, "FLIPPING", sizeof(data->meridian_flip) - 1);
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
         ESP_LOGI(TAG, "WS[%d]: Meridian flip starting", index);
-    }
+        break;
     // MOUNT-AFTER-FLIP: Meridian flip completed
-    else if (strcmp(evt->valuestring, "MOUNT-AFTER-FLIP") == 0) {
+    case WS_EVT_MOUNT_AFTER_FLIP:
         if (nina_client_lock(data, 50)) {
             strncpy(data->meridian_flip, "--", sizeof(data->meridian_flip) - 1);
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 5))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Meridian flip completed");
         nina_event_log_add(EVENT_SEV_INFO, index, "Meridian flip completed");
         ESP_LOGI(TAG, "WS[%d]: Meridian flip completed", index);
-    }
+        break;
     // GUIDER-STOP: Guider stopped — clear RMS values
-    else if (strcmp(evt->valuestring, "GUIDER-STOP") == 0) {
+    case WS_EVT_GUIDER_STOP:
         if (nina_client_lock(data, 50)) {
             data->guider.rms_total = 0;
             data->guider.rms_ra = 0;
@@ -764,13 +686,13 @@ static void handle_websocket_message(int index, const char *payload, int len) {
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 6))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_WARNING, "Guider stopped");
         nina_event_log_add(EVENT_SEV_WARNING, index, "Guider stopped");
         ESP_LOGI(TAG, "WS[%d]: Guider stopped", index);
-    }
+        break;
     // PROFILE-CHANGED: Invalidate cached static data to force re-fetch
-    else if (strcmp(evt->valuestring, "PROFILE-CHANGED") == 0) {
+    case WS_EVT_PROFILE_CHANGED:
         ESP_LOGI(TAG, "WS[%d]: Profile changed, will re-fetch static data", index);
         if (nina_client_lock(data, 50)) {
             data->profile_refresh_needed = true;
@@ -782,211 +704,155 @@ static void handle_websocket_message(int index, const char *payload, int len) {
         portENTER_CRITICAL(&s_agg_lock);
         s_ever_connected[index] = 0;
         portEXIT_CRITICAL(&s_agg_lock);
-        if (toast_allowed(index, 9))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Profile changed");
         nina_event_log_add(EVENT_SEV_INFO, index, "Profile changed");
-    }
+        break;
     // AUTOFOCUS-FAILED / ERROR-AF: AF did not converge (v2 emits ERROR-AF;
     // keep AUTOFOCUS-FAILED for older plugin builds)
-    else if (strcmp(evt->valuestring, "AUTOFOCUS-FAILED") == 0 ||
-             strcmp(evt->valuestring, "ERROR-AF") == 0) {
+    case WS_EVT_AUTOFOCUS_FAILED:
         if (nina_client_lock(data, 50)) {
             data->autofocus.af_running = false;
             data->ui_refresh_needed = true;
             nina_client_unlock(data);
         }
-        if (toast_allowed(index, 3) || toast_allowed(index, 8))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_ERROR, "Autofocus failed");
         nina_event_log_add(EVENT_SEV_ERROR, index, "Autofocus failed");
         ESP_LOGW(TAG, "WS[%d]: Autofocus failed", index);
-    }
-    // CAMERA-CONNECTED: Camera connected — use aggregation
-    else if (strcmp(evt->valuestring, "CAMERA-CONNECTED") == 0) {
-        record_connect_event(index, EQ_CAMERA);
-        ESP_LOGI(TAG, "WS[%d]: Camera connected", index);
-    }
-    // CAMERA-DISCONNECTED: Direct disconnect via aggregation system
-    else if (strcmp(evt->valuestring, "CAMERA-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_CAMERA);
-        ESP_LOGW(TAG, "WS[%d]: Camera disconnected", index);
-    }
+        break;
     // MOUNT-SLEWING: Mount is slewing to target
-    else if (strcmp(evt->valuestring, "MOUNT-SLEWING") == 0) {
-        if (toast_allowed(index, 4))
+    case WS_EVT_MOUNT_SLEWING:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Mount slewing to target");
         ESP_LOGI(TAG, "WS[%d]: Mount slewing", index);
-    }
+        break;
     // MOUNT-PARKED: Mount parked
-    else if (strcmp(evt->valuestring, "MOUNT-PARKED") == 0) {
-        if (toast_allowed(index, 4))
+    case WS_EVT_MOUNT_PARKED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Mount parked");
         nina_event_log_add(EVENT_SEV_INFO, index, "Mount parked");
         ESP_LOGI(TAG, "WS[%d]: Mount parked", index);
-    }
+        break;
     // MOUNT-HOMED: Mount homed
-    else if (strcmp(evt->valuestring, "MOUNT-HOMED") == 0) {
-        if (toast_allowed(index, 4))
+    case WS_EVT_MOUNT_HOMED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Mount homed");
         ESP_LOGI(TAG, "WS[%d]: Mount homed", index);
-    }
+        break;
     // MOUNT-TRACKING-ON: Tracking started
-    else if (strcmp(evt->valuestring, "MOUNT-TRACKING-ON") == 0) {
-        if (toast_allowed(index, 4))
+    case WS_EVT_MOUNT_TRACKING_ON:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_SUCCESS, "Tracking started");
         ESP_LOGI(TAG, "WS[%d]: Tracking started", index);
-    }
+        break;
     // MOUNT-TRACKING-OFF: Tracking stopped
-    else if (strcmp(evt->valuestring, "MOUNT-TRACKING-OFF") == 0) {
-        if (toast_allowed(index, 4))
+    case WS_EVT_MOUNT_TRACKING_OFF:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_WARNING, "Tracking stopped");
         nina_event_log_add(EVENT_SEV_WARNING, index, "Tracking stopped");
         ESP_LOGW(TAG, "WS[%d]: Tracking stopped", index);
-    }
+        break;
     // ERROR*: Any error event
-    else if (strncmp(evt->valuestring, "ERROR", 5) == 0) {
-        if (toast_allowed(index, 8))
-            ws_toast_fmt(index, TOAST_ERROR, "Error: %s", evt->valuestring);
-        nina_event_log_add_fmt(EVENT_SEV_ERROR, index, "Error: %s", evt->valuestring);
-        ESP_LOGE(TAG, "WS[%d]: Error event: %s", index, evt->valuestring);
-    }
-    // Equipment connect events — aggregated
-    else if (strcmp(evt->valuestring, "GUIDER-CONNECTED") == 0) {
-        record_connect_event(index, EQ_GUIDER);
-    }
-    else if (strcmp(evt->valuestring, "GUIDER-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_GUIDER);
-    }
-    else if (strcmp(evt->valuestring, "MOUNT-CONNECTED") == 0) {
-        record_connect_event(index, EQ_MOUNT);
-    }
-    else if (strcmp(evt->valuestring, "MOUNT-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_MOUNT);
-    }
-    else if (strcmp(evt->valuestring, "MOUNT-UNPARKED") == 0) {
-        if (toast_allowed(index, 4))
+    case WS_EVT_ERROR:
+        if (toast_allowed(index, ev->info))
+            ws_toast_fmt(index, TOAST_ERROR, "Error: %s", ev->name);
+        nina_event_log_add_fmt(EVENT_SEV_ERROR, index, "Error: %s", ev->name);
+        ESP_LOGE(TAG, "WS[%d]: Error event: %s", index, ev->name);
+        break;
+    case WS_EVT_MOUNT_UNPARKED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Mount unparked");
         nina_event_log_add(EVENT_SEV_INFO, index, "Mount unparked");
-    }
-    else if (strcmp(evt->valuestring, "FOCUSER-CONNECTED") == 0) {
-        record_connect_event(index, EQ_FOCUSER);
-    }
-    else if (strcmp(evt->valuestring, "FOCUSER-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_FOCUSER);
-    }
-    else if (strcmp(evt->valuestring, "FILTERWHEEL-CONNECTED") == 0) {
-        record_connect_event(index, EQ_FILTERWHEEL);
-    }
-    else if (strcmp(evt->valuestring, "FILTERWHEEL-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_FILTERWHEEL);
-    }
-    else if (strcmp(evt->valuestring, "ROTATOR-CONNECTED") == 0) {
-        record_connect_event(index, EQ_ROTATOR);
-    }
-    else if (strcmp(evt->valuestring, "ROTATOR-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_ROTATOR);
-    }
-    else if (strcmp(evt->valuestring, "SAFETY-CONNECTED") == 0) {
-        record_connect_event(index, EQ_SAFETY);
-    }
-    else if (strcmp(evt->valuestring, "SAFETY-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_SAFETY);
-    }
-    else if (strcmp(evt->valuestring, "DOME-CONNECTED") == 0) {
-        record_connect_event(index, EQ_DOME);
-    }
-    else if (strcmp(evt->valuestring, "DOME-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_DOME);
-    }
-    else if (strcmp(evt->valuestring, "DOME-SHUTTER-OPENED") == 0) {
-        if (toast_allowed(index, 10))
+        break;
+    case WS_EVT_DOME_SHUTTER_OPENED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Dome shutter opened");
         nina_event_log_add(EVENT_SEV_INFO, index, "Dome shutter opened");
-    }
-    else if (strcmp(evt->valuestring, "DOME-SHUTTER-CLOSED") == 0) {
-        if (toast_allowed(index, 10))
+        break;
+    case WS_EVT_DOME_SHUTTER_CLOSED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Dome shutter closed");
         nina_event_log_add(EVENT_SEV_INFO, index, "Dome shutter closed");
-    }
-    else if (strcmp(evt->valuestring, "FLAT-CONNECTED") == 0) {
-        record_connect_event(index, EQ_FLAT);
-    }
-    else if (strcmp(evt->valuestring, "FLAT-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_FLAT);
-    }
-    else if (strcmp(evt->valuestring, "FLAT-LIGHT-TOGGLED") == 0) {
-        if (toast_allowed(index, 11))
+        break;
+    case WS_EVT_FLAT_LIGHT_TOGGLED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Flat light toggled");
         nina_event_log_add(EVENT_SEV_INFO, index, "Flat light toggled");
-    }
-    else if (strcmp(evt->valuestring, "FLAT-COVER-OPENED") == 0) {
-        if (toast_allowed(index, 11))
+        break;
+    case WS_EVT_FLAT_COVER_OPENED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Flat cover opened");
         nina_event_log_add(EVENT_SEV_INFO, index, "Flat cover opened");
-    }
-    else if (strcmp(evt->valuestring, "FLAT-COVER-CLOSED") == 0) {
-        if (toast_allowed(index, 11))
+        break;
+    case WS_EVT_FLAT_COVER_CLOSED:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_INFO, "Flat cover closed");
         nina_event_log_add(EVENT_SEV_INFO, index, "Flat cover closed");
-    }
-    else if (strcmp(evt->valuestring, "SWITCH-CONNECTED") == 0) {
-        record_connect_event(index, EQ_SWITCH);
-    }
-    else if (strcmp(evt->valuestring, "SWITCH-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_SWITCH);
-    }
-    else if (strcmp(evt->valuestring, "WEATHER-CONNECTED") == 0) {
-        record_connect_event(index, EQ_WEATHER);
-    }
-    else if (strcmp(evt->valuestring, "WEATHER-DISCONNECTED") == 0) {
-        record_disconnect_event(index, EQ_WEATHER);
-    }
-    else if (strcmp(evt->valuestring, "CAMERA-DOWNLOAD-TIMEOUT") == 0) {
-        if (toast_allowed(index, 1) || toast_allowed(index, 8))
+        break;
+    case WS_EVT_CAMERA_DOWNLOAD_TIMEOUT:
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_ERROR, "Camera download timeout");
         nina_event_log_add(EVENT_SEV_ERROR, index, "Camera download timeout");
-    }
-    else if (strcmp(evt->valuestring, "SEQUENCE-ENTITY-FAILED") == 0) {
-        cJSON *entity = cJSON_GetObjectItem(response, "Entity");
-        cJSON *error_msg = cJSON_GetObjectItem(response, "Error");
+        break;
+    case WS_EVT_SEQUENCE_ENTITY_FAILED: {
         char msg[128];
-        if (entity && entity->valuestring && error_msg && error_msg->valuestring) {
-            snprintf(msg, sizeof(msg), "%s: %s", entity->valuestring, error_msg->valuestring);
+        if ((ev->fields & WS_F_ENTITY) && (ev->fields & WS_F_ERROR)) {
+            snprintf(msg, sizeof(msg), "%.40s: %.80s", ev->entity, ev->error);
         } else {
             snprintf(msg, sizeof(msg), "Sequence entity failed");
         }
-        if (toast_allowed(index, 2) || toast_allowed(index, 8))
+        if (toast_allowed(index, ev->info))
             ws_toast(index, TOAST_ERROR, msg);
         nina_event_log_add_fmt(EVENT_SEV_ERROR, index, "Entity failed: %s", msg);
+        break;
     }
-    else {
-        ESP_LOGD(TAG, "WS[%d]: Unhandled event: %s", index, evt->valuestring);
+    default:
+        // *-CONNECTED / *-DISCONNECTED: the table row names the equipment
+        if (ev->info->equipment != WS_EQ_NONE) {
+            if (ev->info->connected) {
+                record_connect_event(index, (ws_equipment_t)ev->info->equipment);
+            } else {
+                record_disconnect_event(index, (ws_equipment_t)ev->info->equipment);
+            }
+            ESP_LOGI(TAG, "WS[%d]: %s", index, ev->name);
+        } else {
+            ESP_LOGD(TAG, "WS[%d]: Unhandled event: %s", index, ev->name);
+        }
+        break;
     }
 
-    // Record timestamp for WS-to-UI latency measurement
-    if (g_perf.enabled) g_perf.last_ws_event_time_us = esp_timer_get_time();
-
-    cJSON_Delete(json);
-
-    // Wake UI coordinator for immediate UI refresh
-    if (data_task_handle) {
-        xTaskNotifyGive(data_task_handle);
+    // Wake only the tasks this event gave work to: toast/log-only events
+    // (dome, flat, errors) wake neither.
+    if (ev->info->wake & WS_WAKE_UI) {
+        // Record timestamp for WS-to-UI latency measurement
+        if (g_perf.enabled) g_perf.last_ws_event_time_us = esp_timer_get_time();
+        perf_counter_increment(&g_perf.ws_ui_wake_count);
+        if (data_task_handle) {
+            xTaskNotifyGive(data_task_handle);
+        }
     }
     // Wake the relevant poll task for immediate re-poll (e.g., sequence_poll_needed)
-    if (index >= 0 && index < MAX_NINA_INSTANCES && poll_task_handles[index]) {
+    if ((ev->info->wake & WS_WAKE_POLL) &&
+        index >= 0 && index < MAX_NINA_INSTANCES && poll_task_handles[index]) {
         xTaskNotifyGive(poll_task_handles[index]);
     }
 }
 
 /**
- * @brief Reassemble a possibly-fragmented text frame and dispatch it.
+ * @brief Decode a possibly-fragmented text frame in place and dispatch it.
  *
  * esp_websocket_client posts payloads larger than buffer_size as multiple
  * DATA events: the first carries op_code 0x01 with payload_offset 0, and
  * continuation chunks carry op_code 0x00 with increasing payload_offset;
- * payload_len is the full message length on every event. Accumulate into a
- * per-instance PSRAM buffer and dispatch once complete. Runs only in the WS
- * client task, so buffer state needs no lock; nina_websocket_stop frees the
- * buffer after the client is destroyed (no concurrent handler).
+ * payload_len is the full message length on every event. Each chunk is fed
+ * straight from the client's receive buffer into a per-instance ws_event
+ * decoder (no reassembly copy, no cJSON DOM). The event is dispatched as soon
+ * as the decoder has everything its handler reads -- for most event types
+ * that is Response.Event in the first chunk -- and the rest of the message
+ * is skipped. Runs only in the WS client task, so decoder state needs no
+ * lock; nina_websocket_stop frees it after the client is destroyed (no
+ * concurrent handler).
  */
 static void ws_handle_data_frame(int index, esp_websocket_event_data_t *d) {
     int total = d->payload_len;
@@ -994,64 +860,59 @@ static void ws_handle_data_frame(int index, esp_websocket_event_data_t *d) {
     int chunk = d->data_len;
     if (total <= 0 || chunk < 0) return;
 
-    /* Whole message delivered in one frame — dispatch directly. */
-    if (off == 0 && chunk == total) {
-        handle_websocket_message(index, (const char *)d->data_ptr, total);
-        return;
-    }
-
-    /* Oversize message — discard with a rate-limited warning. */
-    if (total > WS_REASM_MAX_BYTES) {
-        int64_t now = esp_timer_get_time() / 1000;
-        if (now - ws_reasm_warn_ms[index] > 5000) {
-            ESP_LOGW(TAG, "WS[%d]: message %d bytes exceeds %d cap, dropped",
-                     index, total, WS_REASM_MAX_BYTES);
-            ws_reasm_warn_ms[index] = now;
+    if (!ws_decoder[index]) {
+        ws_decoder[index] = heap_caps_malloc(sizeof(ws_event_decoder_t), MALLOC_CAP_SPIRAM);
+        if (!ws_decoder[index]) {
+            ESP_LOGW(TAG, "WS[%d]: event decoder alloc failed", index);
+            return;
         }
-        ws_reasm_len[index] = 0;
-        ws_reasm_have[index] = 0;
-        return;
+        ws_msg_len[index] = 0;
     }
+    ws_event_decoder_t *dec = ws_decoder[index];
 
-    /* Start of a new message resets accumulator. */
+    /* Start of a new message resets the decoder. */
     if (off == 0) {
-        ws_reasm_len[index] = total;
-        ws_reasm_have[index] = 0;
-    } else if (off != ws_reasm_have[index] || total != ws_reasm_len[index]) {
+        ws_event_decoder_begin(dec);
+        ws_msg_len[index] = total;
+        ws_msg_have[index] = 0;
+        ws_msg_done[index] = false;
+        perf_counter_increment(&g_perf.ws_event_count);
+    } else if (ws_msg_len[index] == 0 || off != ws_msg_have[index] ||
+               total != ws_msg_len[index]) {
         /* Continuation without a matching active message (e.g. binary
          * continuation, or a lost start) — drop and wait for a fresh start. */
-        ws_reasm_len[index] = 0;
-        ws_reasm_have[index] = 0;
+        ws_msg_len[index] = 0;
         return;
     }
+    ws_msg_have[index] += chunk;
 
-    if (ws_reasm_cap[index] < total) {
-        char *nb = heap_caps_malloc(total, MALLOC_CAP_SPIRAM);
-        if (!nb) {
-            ESP_LOGW(TAG, "WS[%d]: reassembly alloc failed (%d bytes)", index, total);
-            ws_reasm_len[index] = 0;
-            ws_reasm_have[index] = 0;
-            return;
-        }
-        if (ws_reasm_buf[index]) heap_caps_free(ws_reasm_buf[index]);
-        ws_reasm_buf[index] = nb;
-        ws_reasm_cap[index] = total;
-    }
-
-    if (off + chunk > ws_reasm_cap[index]) {
-        ws_reasm_len[index] = 0;
-        ws_reasm_have[index] = 0;
+    /* Already dispatched from an earlier chunk: just track the offsets. */
+    if (ws_msg_done[index]) {
+        if (ws_msg_have[index] >= ws_msg_len[index]) ws_msg_len[index] = 0;
         return;
     }
 
-    memcpy(ws_reasm_buf[index] + off, d->data_ptr, chunk);
-    ws_reasm_have[index] += chunk;
-
-    if (ws_reasm_have[index] >= ws_reasm_len[index]) {
-        handle_websocket_message(index, ws_reasm_buf[index], ws_reasm_len[index]);
-        ws_reasm_len[index] = 0;
-        ws_reasm_have[index] = 0;
+    ws_event_status_t st = ws_event_decoder_feed(dec, (const char *)d->data_ptr, (size_t)chunk);
+    bool last = ws_msg_have[index] >= ws_msg_len[index];
+    if (st == WS_EVENT_MORE && last) {
+        st = ws_event_decoder_finish(dec);
+    }
+    if (st != WS_EVENT_MORE) {
+        ws_msg_done[index] = true;
+        if (st == WS_EVENT_READY) {
+            const ws_event_t *ev = ws_event_decoder_event(dec);
+            /* Span name must be a literal; the event type goes in the arg.
+             * IMAGE-SAVE gets its own name as it drives the thumbnail path. */
+            const char *span = ev->type == WS_EVT_IMAGE_SAVE ? "ws_image_save" : "ws_event";
+            trace_begin(span, (int32_t)ev->type);
+            perf_span_t dispatch_span = perf_timer_start();
+            handle_websocket_event(index, ev);
+            int64_t dispatch_us = perf_timer_stop(&g_perf.ws_dispatch, dispatch_span);
+            if (dispatch_span) perf_ws_type_record(ev->info->type, dispatch_us);
+            trace_end(span);
+        }
     }
+    if (last) ws_msg_len[index] = 0;
 }
 
 /**
@@ -1061,6 +922,7 @@ static void ws_handle_data_frame(int index, esp_websocket_event_data_t *d) {
 static void websocket_event_handler(void *handler_args, esp_event_base_t base,
                                      int32_t event_id, void *event_data)
 {
+    (void)base;
     int index = (int)(intptr_t)handler_args;
     esp_websocket_event_data_t *data = (esp_websocket_event_data_t *)event_data;
 
@@ -1092,7 +954,7 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
         break;
 
     case WEBSOCKET_EVENT_DATA:
-        // Text frame (0x01) and continuation (0x00) — reassemble fragments.
+        // Text frame (0x01) and continuation (0x00) — decoded per fragment.
         // Binary/ping/pong/close opcodes are ignored.
         if (data->op_code == 0x01 || data->op_code == 0x00) {
             ws_handle_data_frame(index, data);
@@ -1155,15 +1017,15 @@ static void ws_stop_locked(int index) {
     }
     memset(&s_agg[index], 0, sizeof(connect_agg_state_t));
 
-    /* Free the reassembly buffer — safe now that the client (and its event
+    /* Free the event decoder — safe now that the client (and its event
      * handler) is destroyed, so no concurrent writer remains. */
-    if (ws_reasm_buf[index]) {
-        heap_caps_free(ws_reasm_buf[index]);
-        ws_reasm_buf[index] = NULL;
+    if (ws_decoder[index]) {
+        heap_caps_free(ws_decoder[index]);
+        ws_decoder[index] = NULL;
     }
-    ws_reasm_cap[index] = 0;
-    ws_reasm_len[index] = 0;
-    ws_reasm_have[index] = 0;
+    ws_msg_len[index] = 0;
+    ws_msg_have[index] = 0;
+    ws_msg_done[index] = false;
 }
 
 /* Init/start the client. Caller must hold ws_life_mutex[index]. */
@@ -28,6 +28,7 @@ static const char *TAG = "ota_github";
 #define MAX_RESPONSE_SIZE (128 * 1024)
 #define OTA_ASSET_NAME    "nina-display-ota.bin"
 #define SND_ALPHA_TAG     "snd-alpha"   /* fixed tag of the rolling Alpha (snd) pre-release */
+#define RELEASE_CACHE_PAGES 2      /* pages whose bodies are kept for 304 replay (a check rarely reads more) */
 
 /* ── Semver comparison ──────────────────────────────────────────────── */
 
@@ -274,10 +275,37 @@ static esp_err_t redirect_event_handler(esp_http_client_event_t *evt) {
  * 128 KB response buffer overflowed (so the caller can apply the history fail-safe);
  * it is left untouched on other failures. The helper frees its own response buffer.
  */
+/* Conditional-GET cache for the releases pages. GitHub answers an unchanged
+ * page with a 304 that does not count against the unauthenticated rate limit;
+ * the retained body is replayed and parsed as usual. Created on first use;
+ * ota_github_check() runs from both the poll task and httpd handlers, so the
+ * publish is guarded and a losing racer destroys its copy. */
+static http_validator_cache_t *s_release_validators = NULL;
+static portMUX_TYPE s_release_validators_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static http_validator_cache_t *release_validators(void) {
+    portENTER_CRITICAL(&s_release_validators_mux);
+    http_validator_cache_t *cache = s_release_validators;
+    portEXIT_CRITICAL(&s_release_validators_mux);
+    if (cache) return cache;
+
+    http_validator_cache_t *fresh = http_validator_cache_create(RELEASE_CACHE_PAGES,
+                                                                MAX_RESPONSE_SIZE);
+    if (!fresh) return NULL;
+    portENTER_CRITICAL(&s_release_validators_mux);
+    if (!s_release_validators) s_release_validators = fresh;
+    cache = s_release_validators;
+    portEXIT_CRITICAL(&s_release_validators_mux);
+    if (cache != fresh) http_validator_cache_destroy(fresh);
+    return cache;
+}
+
 static cJSON *fetch_releases_page(int page, bool *overflow_out) {
     char url[RELEASE_URL_BUF];
     snprintf(url, sizeof(url), "%s&page=%d", GITHUB_API_URL, page);
 
+    bool not_modified = false;
+
     http_fetch_opts_t opts = {
         .timeout_ms = 10000,
         .use_tls_bundle = true,
@@ -286,6 +314,8 @@ static cJSON *fetch_releases_page(int page, bool *overflow_out) {
         .max_response_bytes = MAX_RESPONSE_SIZE,
         .user_agent = "ESP32-NINA-Display",
         .accept = "application/vnd.github.v3+json",
+        .validators = release_validators(),
+        .not_modified_out = &not_modified,
     };
 
     char *body = NULL;
@@ -305,12 +335,14 @@ static cJSON *fetch_releases_page(int page, bool *overflow_out) {
         return NULL;
     }
 
-    ESP_LOGI(TAG, "GitHub API response (page %d): %u bytes", page, (unsigned)body_len);
+    ESP_LOGI(TAG, "GitHub API response (page %d): %u bytes%s", page, (unsigned)body_len,
+             not_modified ? " (304, cached)" : "");
 
     cJSON *releases = cJSON_Parse(body);
     heap_caps_free(body);
     if (!releases || !cJSON_IsArray(releases)) {
         ESP_LOGW(TAG, "Failed to parse GitHub releases JSON (page %d)", page);
+        http_validator_forget(s_release_validators, url);
         if (releases) {
             cJSON_Delete(releases);
         }
@@ -0,0 +1,71 @@
+/**
+ * @file perf_hist.c
+ * @brief Log-scale latency histogram. See perf_hist.h.
+ */
+
+#include "perf_hist.h"
+
+#include <math.h>
+
+int perf_hist_bucket(int64_t us)
+{
+    if (us < 4) return us < 0 ? 0 : (int)us;
+    uint64_t v = (uint64_t)us;
+    int msb = 63 - __builtin_clzll(v);
+    int b = 2 * msb + (int)((v >> (msb - 1)) & 1);
+    return b < PERF_HIST_BUCKETS ? b : PERF_HIST_BUCKETS - 1;
+}
+
+int64_t perf_hist_bucket_lo(int b)
+{
+    if (b < 4) return b;
+    int msb = b / 2;
+    return ((int64_t)1 << msb) + (int64_t)(b & 1) * ((int64_t)1 << (msb - 1));
+}
+
+static int64_t bucket_width(int b)
+{
+    return b < 4 ? 1 : (int64_t)1 << (b / 2 - 1);
+}
+
+void perf_hist_add(perf_hist_t *h, int64_t us)
+{
+    int b = perf_hist_bucket(us);
+    if (h->n[b] == UINT16_MAX) {
+        for (int i = 0; i < PERF_HIST_BUCKETS; i++) {
+            h->n[i] = (uint16_t)((h->n[i] + 1) / 2);
+        }
+    }
+    h->n[b]++;
+}
+
+uint32_t perf_hist_total(const perf_hist_t *h)
+{
+    uint32_t total = 0;
+    for (int i = 0; i < PERF_HIST_BUCKETS; i++) total += h->n[i];
+    return total;
+}
+
+double perf_hist_percentile(const perf_hist_t *h, double pct)
+{
+    uint32_t total = perf_hist_total(h);
+    if (total == 0) return 0.0;
+    if (pct > 100.0) pct = 100.0;
+
+    /* Rank of the sample at pct (1-based), then find its bucket. */
+    double rank = ceil(pct / 100.0 * (double)total);
+    if (rank < 1.0) rank = 1.0;
+
+    uint32_t below = 0;
+    for (int b = 0; b < PERF_HIST_BUCKETS; b++) {
+        uint32_t c = h->n[b];
+        if (c == 0) continue;
+        if (rank <= (double)(below + c)) {
+            /* Spread the bucket's samples evenly across its width. */
+            double frac = (rank - (double)below - 0.5) / (double)c;
+            return (double)perf_hist_bucket_lo(b) + frac * (double)bucket_width(b);
+        }
+        below += c;
+    }
+    return (double)perf_hist_bucket_lo(PERF_HIST_BUCKETS - 1);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file perf_hist.h
+ * @brief Fixed-size log-scale latency histogram behind every perf_timer_t.
+ *
+ * Min/max/avg hide the tail (a UI lock wait that is usually 0.2 ms but
+ * sometimes 40 ms averages out to nothing), so each timer also counts its
+ * samples into PERF_HIST_BUCKETS buckets and the report derives p50/p95/p99
+ * from them. Buckets are exact for 0..3 us, then split every power of two
+ * into two halves, i.e. at most ~41% wide: [4,6) [6,8) [8,12) [12,16) ...
+ * up to ~16.8 s; longer samples land in the last bucket. A percentile is
+ * interpolated linearly within its bucket.
+ *
+ * Counts are 16-bit so the histogram costs 96 bytes per timer with no
+ * allocation. When a bucket would overflow, every bucket is halved, which
+ * keeps the distribution's shape and slowly ages old samples.
+ *
+ * Not thread-safe by itself: perf_monitor serializes updates. No ESP-IDF
+ * dependencies; standard C only so the module can be compiled unmodified into
+ * the host test suite (test/host).
+ */
+
+#include <stdint.h>
+
+#define PERF_HIST_BUCKETS 48
+
+typedef struct {
+    uint16_t n[PERF_HIST_BUCKETS];
+} perf_hist_t;
+
+/** Bucket index for a duration in microseconds (negative counts as 0). */
+int perf_hist_bucket(int64_t us);
+
+/** Lowest duration (us) that lands in bucket @p b. */
+int64_t perf_hist_bucket_lo(int b);
+
+/** Add one sample. */
+void perf_hist_add(perf_hist_t *h, int64_t us);
+
+/** Samples currently held (after any halving). */
+uint32_t perf_hist_total(const perf_hist_t *h);
+
+/**
+ * @brief Estimate the @p pct percentile (0 < pct <= 100) in microseconds.
+ * @return 0 when the histogram is empty.
+ */
+double perf_hist_percentile(const perf_hist_t *h, double pct);
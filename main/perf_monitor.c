@@ -1,4 +1,6 @@
 #include "perf_monitor.h"
+#include "goes_client.h"   // g_image_frames
+#include "poll_task.h"     // poll_task_get_stats
 
 #include <string.h>
 #include <stdlib.h>
@@ -49,97 +51,64 @@ uint32_t perf_get_alloc_fail_count(void)
     return s_alloc_fail_count;
 }
 
-// ── Start-time storage ──────────────────────────────────────────────
-// Simple hash table to store start times, indexed by pointer hash.
-// 32 slots should be sufficient since we never have more than a few
-// timers running concurrently.
-
-#define START_TIME_SLOTS 32
-
-typedef struct {
-    const perf_timer_t *key;
-    int64_t             start_us;
-} start_time_entry_t;
-
-static start_time_entry_t s_start_times[START_TIME_SLOTS];
-
-static uint32_t ptr_hash(const perf_timer_t *p)
+// ── Timer functions ─────────────────────────────────────────────────
+//
+// Start times live in the caller's perf_span_t, so starting a timer touches
+// no shared state. Recording a sample updates the timer's stats and histogram
+// under that timer's own spinlock: a handful of stores, safe for two tasks on
+// different cores finishing the same timer at once, and unrelated timers
+// never contend. The lock word is free at 0, so timers zeroed by memset
+// (perf_monitor_init, perf_monitor_reset_all) need no further setup.
+
+static inline UBaseType_t perf_lock(volatile uint32_t *lock)
 {
-    uintptr_t v = (uintptr_t)p;
-    // Simple hash: shift out low bits (alignment) and mask to slot count
-    return (uint32_t)((v >> 2) ^ (v >> 14)) & (START_TIME_SLOTS - 1);
+    // Mask interrupts so nothing on this core preempts the holder, then spin
+    // against the other core.
+    UBaseType_t irq = portSET_INTERRUPT_MASK_FROM_ISR();
+    while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE) != 0) {
+    }
+    return irq;
 }
 
-// ── Timer functions ─────────────────────────────────────────────────
-
-void perf_timer_start(perf_timer_t *t)
+static inline void perf_unlock(volatile uint32_t *lock, UBaseType_t irq)
 {
-    if (!g_perf.enabled) return;
-
-    int64_t now = esp_timer_get_time();
-    uint32_t idx = ptr_hash(t);
-    // Linear probe to find an empty slot or existing key
-    for (int i = 0; i < START_TIME_SLOTS; i++) {
-        uint32_t slot = (idx + i) & (START_TIME_SLOTS - 1);
-        if (s_start_times[slot].key == NULL || s_start_times[slot].key == t) {
-            s_start_times[slot].key = t;
-            s_start_times[slot].start_us = now;
-            return;
-        }
-    }
-    // Table full -- should not happen in normal operation
-    ESP_LOGW(TAG, "start_time table full, dropping measurement");
+    __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
 }
 
-int64_t perf_timer_stop(perf_timer_t *t)
+perf_span_t perf_timer_start(void)
 {
     if (!g_perf.enabled) return 0;
+    return esp_timer_get_time();
+}
 
-    int64_t now = esp_timer_get_time();
-    int64_t start = 0;
-    bool found = false;
-
-    uint32_t idx = ptr_hash(t);
-    for (int i = 0; i < START_TIME_SLOTS; i++) {
-        uint32_t slot = (idx + i) & (START_TIME_SLOTS - 1);
-        if (s_start_times[slot].key == t) {
-            start = s_start_times[slot].start_us;
-            s_start_times[slot].key = NULL;  // Release slot
-            found = true;
-            break;
-        }
-        if (s_start_times[slot].key == NULL) {
-            break;  // Empty slot means key was never inserted
-        }
-    }
-
-    if (!found) {
-        return 0;
-    }
+int64_t perf_timer_stop(perf_timer_t *t, perf_span_t span)
+{
+    if (!g_perf.enabled || span == 0) return 0;
 
-    int64_t elapsed = now - start;
-    t->last_us = elapsed;
-    t->total_us += elapsed;
-    t->count++;
-    if (elapsed < t->min_us || t->count == 1) {
-        t->min_us = elapsed;
-    }
-    if (elapsed > t->max_us) {
-        t->max_us = elapsed;
-    }
+    int64_t elapsed = esp_timer_get_time() - span;
+    perf_timer_record(t, elapsed);
     return elapsed;
 }
 
 void perf_timer_reset(perf_timer_t *t)
 {
     if (!g_perf.enabled) return;
-    memset(t, 0, sizeof(*t));
+    UBaseType_t irq = perf_lock(&t->lock);
+    t->last_us = 0;
+    t->min_us = 0;
+    t->max_us = 0;
+    t->total_us = 0;
+    t->count = 0;
+    memset(&t->hist, 0, sizeof(t->hist));
+    perf_unlock(&t->lock, irq);
 }
 
 void perf_timer_record(perf_timer_t *t, int64_t duration_us)
 {
     if (!g_perf.enabled) return;
 
+    UBaseType_t irq = perf_lock(&t->lock);
     t->last_us = duration_us;
     t->total_us += duration_us;
     t->count++;
@@ -149,6 +118,32 @@ void perf_timer_record(perf_timer_t *t, int64_t duration_us)
     if (duration_us > t->max_us) {
         t->max_us = duration_us;
     }
+    perf_hist_add(&t->hist, duration_us);
+    perf_unlock(&t->lock, irq);
+}
+
+static void perf_stat_record(perf_stat_t *st, volatile uint32_t *lock, int64_t duration_us)
+{
+    uint32_t us = duration_us < 0 ? 0 : duration_us > UINT32_MAX ? UINT32_MAX : (uint32_t)duration_us;
+    UBaseType_t irq = perf_lock(lock);
+    st->count.total++;
+    st->count.per_interval++;
+    if (us < st->min_us || st->count.total == 1) st->min_us = us;
+    if (us > st->max_us) st->max_us = us;
+    st->total_us += us;
+    perf_unlock(lock, irq);
+}
+
+void perf_ws_type_record(ws_event_type_t type, int64_t duration_us)
+{
+    if (!g_perf.enabled || (unsigned)type >= WS_EVT_COUNT) return;
+    perf_stat_record(&g_perf.ws_types[type], &g_perf.ws_types_lock, duration_us);
+}
+
+void perf_ha_tile_record(int tile, int64_t duration_us)
+{
+    if (!g_perf.enabled || (unsigned)tile >= PERF_HA_MAX_TILES) return;
+    perf_stat_record(&g_perf.ha_tiles[tile], &g_perf.ha_tiles_lock, duration_us);
 }
 
 // ── Counter functions ───────────────────────────────────────────────
@@ -160,6 +155,13 @@ void perf_counter_increment(perf_counter_t *c)
     c->per_interval++;
 }
 
+void perf_counter_add(perf_counter_t *c, uint32_t n)
+{
+    if (!g_perf.enabled) return;
+    c->total += n;
+    c->per_interval += n;
+}
+
 void perf_counter_reset_interval(perf_counter_t *c)
 {
     if (!g_perf.enabled) return;
@@ -171,7 +173,6 @@ void perf_counter_reset_interval(perf_counter_t *c)
 void perf_monitor_init(uint32_t report_interval_s)
 {
     memset(&g_perf, 0, sizeof(g_perf));
-    memset(s_start_times, 0, sizeof(s_start_times));
     g_perf.report_interval_s = report_interval_s;
     g_perf.last_report_time_us = esp_timer_get_time();
     // g_perf.enabled stays false until perf_monitor_set_enabled(true)
@@ -194,9 +195,9 @@ void perf_monitor_set_enabled(bool enable)
         // Turning on: reset all metrics to start fresh
         uint32_t interval = g_perf.report_interval_s;
         memset(&g_perf, 0, sizeof(g_perf));
-        memset(s_start_times, 0, sizeof(s_start_times));
         g_perf.report_interval_s = interval;
         g_perf.last_report_time_us = esp_timer_get_time();
+        g_perf.metrics_start_us = g_perf.last_report_time_us;
         g_perf.enabled = true;
         s_cpu_first_sample = true;
         s_prev_task_count = 0;
@@ -241,6 +242,9 @@ void perf_monitor_capture_memory(void)
         ? (float)g_perf.psram_largest_free_block / (float)g_perf.psram_free_bytes
         : 0.0f;
 
+    // Image frame slots: lock-free atomic reads, allocates nothing
+    frame_pool_get_stats(&g_image_frames, &g_perf.image_frames);
+
     // Task stack high-water marks (if task handles are available)
     // These are set externally by the tasks themselves via:
     //   g_perf.data_task_stack_hwm = uxTaskGetStackHighWaterMark(NULL) * sizeof(StackType_t);
@@ -471,6 +475,16 @@ bool perf_monitor_dma_heap_watchdog(void)
 
 // ── Serial log report ───────────────────────────────────────────────
 
+// Histogram percentile, clamped to the observed range (the estimate is only
+// as precise as its bucket, which may extend past min/max).
+static double timer_pct_ms(const perf_timer_t *t, double pct)
+{
+    double us = perf_hist_percentile(&t->hist, pct);
+    if (us < (double)t->min_us) us = (double)t->min_us;
+    if (us > (double)t->max_us) us = (double)t->max_us;
+    return us / 1000.0;
+}
+
 static void log_timer(const char *name, const perf_timer_t *t)
 {
     if (t->count == 0) {
@@ -481,8 +495,18 @@ static void log_timer(const char *name, const perf_timer_t *t)
     double min_ms = (double)t->min_us / 1000.0;
     double max_ms = (double)t->max_us / 1000.0;
     double last_ms = (double)t->last_us / 1000.0;
-    ESP_LOGI(TAG, "  %-24s avg=%7.1f  min=%7.1f  max=%7.1f  last=%7.1f ms  [n=%"PRIu32"]",
-             name, avg_ms, min_ms, max_ms, last_ms, t->count);
+    ESP_LOGI(TAG, "  %-24s avg=%7.1f  min=%7.1f  max=%7.1f  last=%7.1f  p50=%7.1f  p95=%7.1f  p99=%7.1f ms  [n=%"PRIu32"]",
+             name, avg_ms, min_ms, max_ms, last_ms,
+             timer_pct_ms(t, 50), timer_pct_ms(t, 95), timer_pct_ms(t, 99), t->count);
+}
+
+// Conditional-GET savings as an hourly rate over the whole metrics window
+// (a single 30s interval is too coarse: one skipped 1 MB image dominates it).
+static double perf_cond_saved_kb_per_hour(void)
+{
+    int64_t elapsed_us = esp_timer_get_time() - g_perf.metrics_start_us;
+    if (elapsed_us <= 0) return 0.0;
+    return (double)g_perf.http_cond_saved_kb.total * 3600e6 / (double)elapsed_us;
 }
 
 void perf_monitor_report(void)
@@ -514,6 +538,7 @@ void perf_monitor_report(void)
     log_timer("http_connect",    &g_perf.http_connect);
     log_timer("http_ttfb",       &g_perf.http_ttfb);
     log_timer("http_body",       &g_perf.http_body);
+    log_timer("http_batch",      &g_perf.http_batch);
     ESP_LOGI(TAG, "  HTTP requests:  %"PRIu32" (interval) / %"PRIu32" (total)",
              g_perf.http_request_count.per_interval, g_perf.http_request_count.total);
     ESP_LOGI(TAG, "  HTTP retries:   %"PRIu32" (interval) / %"PRIu32" (total)",
@@ -524,8 +549,41 @@ void perf_monitor_report(void)
              g_perf.http_unreachable_count.per_interval, g_perf.http_unreachable_count.total);
     ESP_LOGI(TAG, "  HTTP attempt0 fail:%"PRIu32" (interval) / %"PRIu32" (total)",
              g_perf.http_attempt0_fail_count.per_interval, g_perf.http_attempt0_fail_count.total);
+    ESP_LOGI(TAG, "  HTTP pipelined: %"PRIu32" (interval) / %"PRIu32" (total)",
+             g_perf.http_pipelined_count.per_interval, g_perf.http_pipelined_count.total);
+    ESP_LOGI(TAG, "  HTTP 304 hits:  %"PRIu32" (interval) / %"PRIu32" (total), misses %"PRIu32" / %"PRIu32,
+             g_perf.http_cond_hit_count.per_interval, g_perf.http_cond_hit_count.total,
+             g_perf.http_cond_miss_count.per_interval, g_perf.http_cond_miss_count.total);
+    ESP_LOGI(TAG, "  HTTP 304 saved: %"PRIu32" KB (interval) / %"PRIu32" KB (total), %.0f KB/h",
+             g_perf.http_cond_saved_kb.per_interval, g_perf.http_cond_saved_kb.total,
+             perf_cond_saved_kb_per_hour());
     ESP_LOGI(TAG, "  WS events:      %"PRIu32" (interval) / %"PRIu32" (total)",
              g_perf.ws_event_count.per_interval, g_perf.ws_event_count.total);
+    ESP_LOGI(TAG, "  WS UI wakes:    %"PRIu32" (interval) / %"PRIu32" (total)",
+             g_perf.ws_ui_wake_count.per_interval, g_perf.ws_ui_wake_count.total);
+    log_timer("ws_dispatch", &g_perf.ws_dispatch);
+    for (int t = 0; t < WS_EVT_COUNT; t++) {
+        const perf_stat_t *w = &g_perf.ws_types[t];
+        if (w->count.total == 0) continue;
+        ESP_LOGI(TAG, "    %-24s %"PRIu32" (interval) / %"PRIu32" (total)  avg=%6.2f  min=%6.2f  max=%6.2f ms",
+                 ws_event_type_name((ws_event_type_t)t), w->count.per_interval, w->count.total,
+                 (double)w->total_us / (double)w->count.total / 1000.0,
+                 w->min_us / 1000.0, w->max_us / 1000.0);
+    }
+
+    ESP_LOGI(TAG, "── Poll Jobs ──");
+    {
+        poll_sched_job_t jobs[POLL_SCHED_MAX_JOBS];
+        int n = poll_task_get_stats(jobs, POLL_SCHED_MAX_JOBS);
+        if (n == 0) ESP_LOGI(TAG, "  (none)");
+        for (int i = 0; i < n; i++) {
+            const poll_sched_job_t *j = &jobs[i];
+            double avg_ms = j->runs ? (double)j->busy_ms_total / (double)j->runs : 0.0;
+            ESP_LOGI(TAG, "  %-12s runs=%"PRIu32"  failures=%"PRIu32"  busy avg=%7.1f  max=%"PRIu32"  last=%"PRIu32" ms  total=%.1f s",
+                     j->name, j->runs, j->failures, avg_ms, j->busy_ms_max, j->busy_ms_last,
+                     (double)j->busy_ms_total / 1000.0);
+        }
+    }
 
     ESP_LOGI(TAG, "── JSON Parsing ──");
     log_timer("json_parse",        &g_perf.json_parse);
@@ -533,6 +591,9 @@ void perf_monitor_report(void)
     log_timer("json_config_color", &g_perf.json_config_color_parse);
     ESP_LOGI(TAG, "  Parse calls:    %"PRIu32" (interval) / %"PRIu32" (total)",
              g_perf.json_parse_count.per_interval, g_perf.json_parse_count.total);
+    log_timer("json_stream",       &g_perf.json_stream);
+    ESP_LOGI(TAG, "  Stream docs:    %"PRIu32" (interval) / %"PRIu32" (total)",
+             g_perf.json_stream_count.per_interval, g_perf.json_stream_count.total);
 
     ESP_LOGI(TAG, "── UI Updates ──");
     log_timer("ui_update_total",    &g_perf.ui_update_total);
@@ -546,6 +607,31 @@ void perf_monitor_report(void)
     ESP_LOGI(TAG, "── JPEG ──");
     log_timer("jpeg_decode", &g_perf.jpeg_decode);
     log_timer("jpeg_fetch",  &g_perf.jpeg_fetch);
+    ESP_LOGI(TAG, "  Pool buffers:   %"PRIu32" hits / %"PRIu32" misses (interval), %"PRIu32" / %"PRIu32" (total)",
+             g_perf.jpeg_pool_hit_count.per_interval, g_perf.jpeg_pool_miss_count.per_interval,
+             g_perf.jpeg_pool_hit_count.total, g_perf.jpeg_pool_miss_count.total);
+
+    ESP_LOGI(TAG, "── Image ──");
+    log_timer("image_fetch_decode", &g_perf.image_fetch_decode);
+    {
+        const frame_pool_stats_t *fs = &g_perf.image_frames;
+        ESP_LOGI(TAG, "  Frame slots:    %d/%d allocated, producer=%d prefetch=%d source=%d display=%d idle=%d, high_water=%d",
+                 fs->allocated, fs->slots, fs->owned[FRAME_OWNER_PRODUCER],
+                 fs->owned[FRAME_OWNER_PREFETCH], fs->owned[FRAME_OWNER_SOURCE],
+                 fs->owned[FRAME_OWNER_DISPLAY], fs->owned[FRAME_OWNER_FREE], fs->high_water);
+        ESP_LOGI(TAG, "  Frame acquires: %"PRIu32" from slots / %"PRIu32" one-off (total)",
+                 fs->hits, fs->fallbacks);
+    }
+
+    ESP_LOGI(TAG, "── Moon ──");
+    {
+        uint32_t hits = g_perf.moon_bg_hit_count.total;
+        uint32_t lookups = hits + g_perf.moon_bg_miss_count.total;
+        ESP_LOGI(TAG, "  Bg cache hits:  %"PRIu32" (interval) / %"PRIu32" (total), misses %"PRIu32" / %"PRIu32" (%.1f%% hit)",
+                 g_perf.moon_bg_hit_count.per_interval, hits,
+                 g_perf.moon_bg_miss_count.per_interval, g_perf.moon_bg_miss_count.total,
+                 lookups ? 100.0 * hits / lookups : 0.0);
+    }
 
     ESP_LOGI(TAG, "── Spotify ──");
     log_timer("spotify_poll_cycle",  &g_perf.spotify_poll_cycle);
@@ -560,6 +646,20 @@ void perf_monitor_report(void)
     ESP_LOGI(TAG, "  Spotify art:      %"PRIu32" (interval) / %"PRIu32" (total)",
              g_perf.spotify_art_fetch_count.per_interval, g_perf.spotify_art_fetch_count.total);
 
+    ESP_LOGI(TAG, "── Home Assistant ──");
+    log_timer("ha_poll_fetch",       &g_perf.ha_poll_fetch);
+    log_timer("ha_entity_fetch",     &g_perf.ha_entity_fetch);
+    ESP_LOGI(TAG, "  HA late entities: %"PRIu32" (interval) / %"PRIu32" (total)",
+             g_perf.ha_entity_late_count.per_interval, g_perf.ha_entity_late_count.total);
+    for (int t = 0; t < PERF_HA_MAX_TILES; t++) {
+        const perf_stat_t *w = &g_perf.ha_tiles[t];
+        if (w->count.total == 0) continue;
+        ESP_LOGI(TAG, "    tile %-2d %"PRIu32" (interval) / %"PRIu32" (total)  avg=%6.2f  min=%6.2f  max=%6.2f ms",
+                 t, w->count.per_interval, w->count.total,
+                 (double)w->total_us / (double)w->count.total / 1000.0,
+                 w->min_us / 1000.0, w->max_us / 1000.0);
+    }
+
     ESP_LOGI(TAG, "── WiFi ──");
     if (g_perf.wifi_rssi_samples > 0) {
         int8_t avg_rssi = (int8_t)(g_perf.wifi_rssi_sum / (int32_t)g_perf.wifi_rssi_samples);
@@ -637,11 +737,28 @@ void perf_monitor_report(void)
     perf_counter_reset_interval(&g_perf.http_failure_count);
     perf_counter_reset_interval(&g_perf.http_unreachable_count);
     perf_counter_reset_interval(&g_perf.http_attempt0_fail_count);
+    perf_counter_reset_interval(&g_perf.http_pipelined_count);
+    perf_counter_reset_interval(&g_perf.http_cond_hit_count);
+    perf_counter_reset_interval(&g_perf.http_cond_miss_count);
+    perf_counter_reset_interval(&g_perf.http_cond_saved_kb);
     perf_counter_reset_interval(&g_perf.ws_event_count);
+    perf_counter_reset_interval(&g_perf.ws_ui_wake_count);
+    for (int t = 0; t < WS_EVT_COUNT; t++) {
+        perf_counter_reset_interval(&g_perf.ws_types[t].count);
+    }
     perf_counter_reset_interval(&g_perf.json_parse_count);
+    perf_counter_reset_interval(&g_perf.json_stream_count);
+    perf_counter_reset_interval(&g_perf.jpeg_pool_hit_count);
+    perf_counter_reset_interval(&g_perf.jpeg_pool_miss_count);
+    perf_counter_reset_interval(&g_perf.moon_bg_hit_count);
+    perf_counter_reset_interval(&g_perf.moon_bg_miss_count);
     perf_counter_reset_interval(&g_perf.spotify_poll_count);
     perf_counter_reset_interval(&g_perf.spotify_error_count);
     perf_counter_reset_interval(&g_perf.spotify_art_fetch_count);
+    perf_counter_reset_interval(&g_perf.ha_entity_late_count);
+    for (int t = 0; t < PERF_HA_MAX_TILES; t++) {
+        perf_counter_reset_interval(&g_perf.ha_tiles[t].count);
+    }
     perf_counter_reset_interval(&g_perf.wifi_disconnect_count);
     g_perf.wifi_rssi_sum = 0;
     g_perf.wifi_rssi_samples = 0;
@@ -660,8 +777,8 @@ void perf_monitor_reset_all(void)
     g_perf.enabled = was_enabled;
     g_perf.report_interval_s = interval;
     g_perf.last_report_time_us = esp_timer_get_time();
+    g_perf.metrics_start_us = g_perf.last_report_time_us;
     s_cpu_first_sample = true;
-    memset(s_start_times, 0, sizeof(s_start_times));
     ESP_LOGI(TAG, "All performance metrics reset");
 }
 
@@ -677,12 +794,18 @@ static cJSON *timer_to_json(const perf_timer_t *t)
         cJSON_AddNumberToObject(obj, "min_ms", 0);
         cJSON_AddNumberToObject(obj, "max_ms", 0);
         cJSON_AddNumberToObject(obj, "last_ms", 0);
+        cJSON_AddNumberToObject(obj, "p50_ms", 0);
+        cJSON_AddNumberToObject(obj, "p95_ms", 0);
+        cJSON_AddNumberToObject(obj, "p99_ms", 0);
         cJSON_AddNumberToObject(obj, "count", 0);
     } else {
         cJSON_AddNumberToObject(obj, "avg_ms", (double)t->total_us / (double)t->count / 1000.0);
         cJSON_AddNumberToObject(obj, "min_ms", (double)t->min_us / 1000.0);
         cJSON_AddNumberToObject(obj, "max_ms", (double)t->max_us / 1000.0);
         cJSON_AddNumberToObject(obj, "last_ms", (double)t->last_us / 1000.0);
+        cJSON_AddNumberToObject(obj, "p50_ms", timer_pct_ms(t, 50));
+        cJSON_AddNumberToObject(obj, "p95_ms", timer_pct_ms(t, 95));
+        cJSON_AddNumberToObject(obj, "p99_ms", timer_pct_ms(t, 99));
         cJSON_AddNumberToObject(obj, "count", t->count);
     }
     return obj;
@@ -833,12 +956,34 @@ char *perf_monitor_report_json(void)
     cJSON_AddItemToObject(network, "http_connect",      timer_to_json(&g_perf.http_connect));
     cJSON_AddItemToObject(network, "http_ttfb",         timer_to_json(&g_perf.http_ttfb));
     cJSON_AddItemToObject(network, "http_body",         timer_to_json(&g_perf.http_body));
+    cJSON_AddItemToObject(network, "http_batch",        timer_to_json(&g_perf.http_batch));
     cJSON_AddItemToObject(network, "http_request_count", counter_to_json(&g_perf.http_request_count));
     cJSON_AddItemToObject(network, "http_retry_count",   counter_to_json(&g_perf.http_retry_count));
     cJSON_AddItemToObject(network, "http_failure_count", counter_to_json(&g_perf.http_failure_count));
     cJSON_AddItemToObject(network, "http_unreachable_count", counter_to_json(&g_perf.http_unreachable_count));
     cJSON_AddItemToObject(network, "http_attempt0_fail_count", counter_to_json(&g_perf.http_attempt0_fail_count));
+    cJSON_AddItemToObject(network, "http_pipelined_count", counter_to_json(&g_perf.http_pipelined_count));
+    cJSON_AddItemToObject(network, "http_cond_hit_count", counter_to_json(&g_perf.http_cond_hit_count));
+    cJSON_AddItemToObject(network, "http_cond_miss_count", counter_to_json(&g_perf.http_cond_miss_count));
+    cJSON_AddItemToObject(network, "http_cond_saved_kb", counter_to_json(&g_perf.http_cond_saved_kb));
+    cJSON_AddNumberToObject(network, "http_cond_saved_kb_per_hour", perf_cond_saved_kb_per_hour());
     cJSON_AddItemToObject(network, "ws_event_count",     counter_to_json(&g_perf.ws_event_count));
+    cJSON_AddItemToObject(network, "ws_ui_wake_count",   counter_to_json(&g_perf.ws_ui_wake_count));
+    cJSON_AddItemToObject(network, "ws_dispatch",        timer_to_json(&g_perf.ws_dispatch));
+    // Per event type, only types seen since the last reset (percentiles are
+    // in ws_dispatch, shared by all types)
+    cJSON *ws_types = cJSON_CreateObject();
+    for (int t = 0; t < WS_EVT_COUNT; t++) {
+        const perf_stat_t *w = &g_perf.ws_types[t];
+        if (w->count.total == 0) continue;
+        cJSON *type = cJSON_CreateObject();
+        cJSON_AddItemToObject(type, "count", counter_to_json(&w->count));
+        cJSON_AddNumberToObject(type, "avg_ms", (double)w->total_us / (double)w->count.total / 1000.0);
+        cJSON_AddNumberToObject(type, "min_ms", w->min_us / 1000.0);
+        cJSON_AddNumberToObject(type, "max_ms", w->max_us / 1000.0);
+        cJSON_AddItemToObject(ws_types, ws_event_type_name((ws_event_type_t)t), type);
+    }
+    cJSON_AddItemToObject(network, "ws_event_types", ws_types);
     cJSON_AddItemToObject(root, "network", network);
 
     // JSON parsing
@@ -847,6 +992,8 @@ char *perf_monitor_report_json(void)
     cJSON_AddItemToObject(json_parsing, "json_sequence",     timer_to_json(&g_perf.json_sequence_parse));
     cJSON_AddItemToObject(json_parsing, "json_config_color", timer_to_json(&g_perf.json_config_color_parse));
     cJSON_AddItemToObject(json_parsing, "json_parse_count",  counter_to_json(&g_perf.json_parse_count));
+    cJSON_AddItemToObject(json_parsing, "json_stream",       timer_to_json(&g_perf.json_stream));
+    cJSON_AddItemToObject(json_parsing, "json_stream_count", counter_to_json(&g_perf.json_stream_count));
     cJSON_AddItemToObject(root, "json_parsing", json_parsing);
 
     // UI
@@ -915,8 +1062,36 @@ char *perf_monitor_report_json(void)
     cJSON *jpeg = cJSON_CreateObject();
     cJSON_AddItemToObject(jpeg, "jpeg_decode", timer_to_json(&g_perf.jpeg_decode));
     cJSON_AddItemToObject(jpeg, "jpeg_fetch",  timer_to_json(&g_perf.jpeg_fetch));
+    cJSON_AddItemToObject(jpeg, "pool_hit_count",  counter_to_json(&g_perf.jpeg_pool_hit_count));
+    cJSON_AddItemToObject(jpeg, "pool_miss_count", counter_to_json(&g_perf.jpeg_pool_miss_count));
     cJSON_AddItemToObject(root, "jpeg", jpeg);
 
+    // GOES / solar / custom image fetches
+    cJSON *image = cJSON_CreateObject();
+    cJSON_AddItemToObject(image, "fetch_decode",   timer_to_json(&g_perf.image_fetch_decode));
+    {
+        const frame_pool_stats_t *fs = &g_perf.image_frames;
+        cJSON *slots = cJSON_CreateObject();
+        cJSON_AddNumberToObject(slots, "total",      fs->slots);
+        cJSON_AddNumberToObject(slots, "allocated",  fs->allocated);
+        cJSON_AddNumberToObject(slots, "producer",   fs->owned[FRAME_OWNER_PRODUCER]);
+        cJSON_AddNumberToObject(slots, "prefetch",   fs->owned[FRAME_OWNER_PREFETCH]);
+        cJSON_AddNumberToObject(slots, "source",     fs->owned[FRAME_OWNER_SOURCE]);
+        cJSON_AddNumberToObject(slots, "display",    fs->owned[FRAME_OWNER_DISPLAY]);
+        cJSON_AddNumberToObject(slots, "idle",       fs->owned[FRAME_OWNER_FREE]);
+        cJSON_AddNumberToObject(slots, "high_water", fs->high_water);
+        cJSON_AddNumberToObject(slots, "hits",       fs->hits);
+        cJSON_AddNumberToObject(slots, "fallbacks",  fs->fallbacks);
+        cJSON_AddItemToObject(image, "frame_slots", slots);
+    }
+    cJSON_AddItemToObject(root, "image", image);
+
+    // Moon background cache
+    cJSON *moon = cJSON_CreateObject();
+    cJSON_AddItemToObject(moon, "bg_hit_count",  counter_to_json(&g_perf.moon_bg_hit_count));
+    cJSON_AddItemToObject(moon, "bg_miss_count", counter_to_json(&g_perf.moon_bg_miss_count));
+    cJSON_AddItemToObject(root, "moon", moon);
+
     // Spotify
     cJSON *spotify = cJSON_CreateObject();
     cJSON_AddItemToObject(spotify, "poll_cycle",  timer_to_json(&g_perf.spotify_poll_cycle));
@@ -929,6 +1104,27 @@ char *perf_monitor_report_json(void)
     cJSON_AddItemToObject(spotify, "art_fetch_count", counter_to_json(&g_perf.spotify_art_fetch_count));
     cJSON_AddItemToObject(root, "spotify", spotify);
 
+    // Home Assistant
+    cJSON *ha = cJSON_CreateObject();
+    cJSON_AddItemToObject(ha, "poll_fetch",   timer_to_json(&g_perf.ha_poll_fetch));
+    cJSON_AddItemToObject(ha, "entity_fetch", timer_to_json(&g_perf.ha_entity_fetch));
+    cJSON_AddItemToObject(ha, "entity_late_count", counter_to_json(&g_perf.ha_entity_late_count));
+    // Per tile (by row-major index), only tiles fetched since the last reset
+    cJSON *ha_tiles = cJSON_CreateArray();
+    for (int t = 0; t < PERF_HA_MAX_TILES; t++) {
+        const perf_stat_t *w = &g_perf.ha_tiles[t];
+        if (w->count.total == 0) continue;
+        cJSON *tile = cJSON_CreateObject();
+        cJSON_AddNumberToObject(tile, "tile", t);
+        cJSON_AddItemToObject(tile, "count", counter_to_json(&w->count));
+        cJSON_AddNumberToObject(tile, "avg_ms", (double)w->total_us / (double)w->count.total / 1000.0);
+        cJSON_AddNumberToObject(tile, "min_ms", w->min_us / 1000.0);
+        cJSON_AddNumberToObject(tile, "max_ms", w->max_us / 1000.0);
+        cJSON_AddItemToArray(ha_tiles, tile);
+    }
+    cJSON_AddItemToObject(ha, "tiles", ha_tiles);
+    cJSON_AddItemToObject(root, "ha", ha);
+
     // CPU utilization
     if (g_perf.cpu.valid) {
         cJSON *cpu = cJSON_CreateObject();
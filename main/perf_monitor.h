@@ -5,6 +5,9 @@
 #include "esp_wifi_types.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "frame_pool.h"
+#include "perf_hist.h"
+#include "ws_event.h"
 
 // ── Timing Metrics ──────────────────────────────────────────────────
 
@@ -14,12 +17,22 @@ typedef struct {
     int64_t  max_us;         // Maximum observed
     int64_t  total_us;       // Running total for average calculation
     uint32_t count;          // Number of samples
+    perf_hist_t hist;        // Duration distribution (p50/p95/p99)
+    volatile uint32_t lock;  // Per-timer spinlock guarding the fields above; 0 = free
 } perf_timer_t;
 
-// Start/stop a named timer. Returns elapsed microseconds.
-void     perf_timer_start(perf_timer_t *t);
-int64_t  perf_timer_stop(perf_timer_t *t);
-void     perf_timer_reset(perf_timer_t *t);
+// One measurement in flight: its start time, kept by the call site (on the
+// caller's stack) so any number of tasks on either core can time the same
+// perf_timer_t at once. 0 = not measuring (perf was disabled at start).
+typedef int64_t perf_span_t;
+
+// Start a measurement; stop it into a timer. Returns elapsed microseconds.
+//   perf_span_t span = perf_timer_start();
+//   ...
+//   perf_timer_stop(&g_perf.poll_camera, span);
+perf_span_t perf_timer_start(void);
+int64_t     perf_timer_stop(perf_timer_t *t, perf_span_t span);
+void        perf_timer_reset(perf_timer_t *t);
 
 // ── CPU Utilization ────────────────────────────────────────────────
 
@@ -61,7 +74,21 @@ typedef struct {
     uint32_t per_interval;   // Count since last report
 } perf_counter_t;
 
+// Latency stats for one key of a keyed set (a WebSocket event type, an HA
+// tile). No histogram: most keys stay idle, and the distribution is in the
+// set's shared timer (ws_dispatch, ha_entity_fetch).
+typedef struct {
+    perf_counter_t count;    // Samples recorded
+    uint32_t min_us;         // Fastest
+    uint32_t max_us;         // Slowest
+    uint64_t total_us;       // Running total for average calculation
+} perf_stat_t;
+
+// HA tiles with their own latency stats (== JSON_MAX_TILES, asserted in ha_client.c)
+#define PERF_HA_MAX_TILES 15
+
 void perf_counter_increment(perf_counter_t *c);
+void perf_counter_add(perf_counter_t *c, uint32_t n);
 void perf_counter_reset_interval(perf_counter_t *c);
 
 // ── Global Profiling State ──────────────────────────────────────────
@@ -96,17 +123,28 @@ typedef struct {
     perf_counter_t http_failure_count;    // HTTP failures per interval (connected but failed)
     perf_counter_t http_unreachable_count;// Host unreachable (connection refused/timeout)
     perf_counter_t ws_event_count;        // WebSocket events received per interval
+    perf_counter_t ws_ui_wake_count;      // of those, events that woke the UI coordinator
+    perf_timer_t ws_dispatch;             // handle_websocket_event duration (per event)
+    perf_stat_t ws_types[WS_EVT_COUNT];   // per ws_event_type_t count and dispatch min/max/avg
+    volatile uint32_t ws_types_lock;      // guards ws_types (perf_ws_type_record); 0 = free
     // Per-phase HTTP timing (for resolve-once / numeric-IP latency diagnosis)
     perf_timer_t http_connect;            // esp_http_client_open: DNS + TCP connect
     perf_timer_t http_ttfb;               // fetch_headers: request sent -> response headers
     perf_timer_t http_body;               // body read loop
     perf_counter_t http_attempt0_fail_count; // request succeeded only on a retry (first attempt failed though host reachable)
+    perf_timer_t http_batch;              // http_fetch_batch wall time (all requests of one pipelined batch)
+    perf_counter_t http_pipelined_count;  // requests served on a pipelined connection per interval
+    perf_counter_t http_cond_hit_count;   // conditional GETs answered 304 (body not re-sent)
+    perf_counter_t http_cond_miss_count;  // full 2xx bodies downloaded for validator-cached URLs
+    perf_counter_t http_cond_saved_kb;    // KB of response bodies not re-downloaded thanks to 304s
 
     // JSON parsing
     perf_timer_t json_parse;              // cJSON_Parse duration (per-parse)
     perf_timer_t json_sequence_parse;     // Sequence JSON specifically (heaviest parse)
     perf_timer_t json_config_color_parse; // app_config_get_filter_color parse timing
     perf_counter_t json_parse_count;      // Total cJSON_Parse calls per interval
+    perf_timer_t json_stream;             // json_stream_feed time per streamed document (excl. network waits)
+    perf_counter_t json_stream_count;     // Streamed (no-DOM) documents per interval
 
     // Memory snapshots (captured at each reporting interval)
     uint32_t heap_free_bytes;
@@ -141,6 +179,16 @@ typedef struct {
     // JPEG thumbnail decode timing
     perf_timer_t jpeg_decode;
     perf_timer_t jpeg_fetch;
+    perf_counter_t jpeg_pool_hit_count;   // decodes into a reserved output buffer
+    perf_counter_t jpeg_pool_miss_count;  // decodes that had to allocate one
+
+    // GOES / solar / custom image fetches
+    perf_timer_t   image_fetch_decode;     // fetch start to decoded frame (download + HW/SW decode)
+    frame_pool_stats_t image_frames;       // frame slot occupancy, sampled with memory
+
+    // Moon page background cache (starfield + halo, keyed by size/style)
+    perf_counter_t moon_bg_hit_count;     // frames that copied a cached background
+    perf_counter_t moon_bg_miss_count;    // backgrounds (re)built on a key change
 
     // Spotify metrics
     perf_timer_t spotify_poll_cycle;          // Full spotify poll loop iteration
@@ -153,6 +201,13 @@ typedef struct {
     perf_counter_t spotify_art_fetch_count;   // Art fetches per interval
     uint32_t spotify_task_stack_hwm;          // Stack high-water mark
 
+    // Home Assistant metrics (REST fallback fan-out in ha_client.c)
+    perf_timer_t ha_poll_fetch;               // ha_client_poll fan-out: dispatch -> last result or deadline
+    perf_timer_t ha_entity_fetch;             // one entity GET on a fetch-pool worker (per entity)
+    perf_counter_t ha_entity_late_count;      // entities not back by the poll deadline
+    perf_stat_t ha_tiles[PERF_HA_MAX_TILES];  // per tile: its entity's GET (late ones not counted)
+    volatile uint32_t ha_tiles_lock;          // guards ha_tiles (perf_ha_tile_record); 0 = free
+
     // WiFi metrics
     int8_t   wifi_rssi;              // Current RSSI (dBm)
     int8_t   wifi_rssi_min;          // Minimum RSSI in interval
@@ -174,6 +229,7 @@ typedef struct {
 
     // Report control
     int64_t last_report_time_us;
+    int64_t metrics_start_us;             // When counters last started from zero (enable / reset_all)
     uint32_t report_interval_s;           // How often to print report (default 30s)
 } perf_state_t;
 
@@ -216,6 +272,12 @@ char *perf_monitor_report_json(void);
 // Helper to manually record a duration (for intervals measured externally)
 void perf_timer_record(perf_timer_t *t, int64_t duration_us);
 
+// Record one handled WebSocket event of @p type into g_perf.ws_types.
+void perf_ws_type_record(ws_event_type_t type, int64_t duration_us);
+
+// Record one fetch of HA tile @p tile's entity into g_perf.ha_tiles.
+void perf_ha_tile_record(int tile, int64_t duration_us);
+
 // ── Failed-allocation catcher ───────────────────────────────────────
 //
 // Registers an ESP-IDF heap failed-alloc hook that prints one compact,
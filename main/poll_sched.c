@@ -0,0 +1,109 @@
+/**
+ * @file poll_sched.c
+ * @brief Deadline table for the shared poll scheduler. See poll_sched.h.
+ */
+
+#include "poll_sched.h"
+#include "poll_backoff.h"
+
+#include <string.h>
+
+static bool valid_id(const poll_sched_t *s, int id)
+{
+    return s && id >= 0 && id < s->count;
+}
+
+void poll_sched_init(poll_sched_t *s, uint32_t coalesce_ms)
+{
+    memset(s, 0, sizeof(*s));
+    s->coalesce_ms = coalesce_ms;
+}
+
+int poll_sched_add(poll_sched_t *s, const char *name, int64_t now_ms)
+{
+    if (!s || s->count >= POLL_SCHED_MAX_JOBS) return -1;
+    int id = s->count++;
+    poll_sched_job_t *j = &s->jobs[id];
+    memset(j, 0, sizeof(*j));
+    j->name = name;
+    j->due_ms = now_ms;
+    return id;
+}
+
+int poll_sched_take(poll_sched_t *s, int64_t now_ms)
+{
+    int best = -1;
+    int64_t horizon = now_ms + s->coalesce_ms;
+    for (int i = 0; i < s->count; i++) {
+        const poll_sched_job_t *j = &s->jobs[i];
+        if (j->running || j->due_ms > horizon) continue;
+        if (best < 0 || j->due_ms < s->jobs[best].due_ms) best = i;
+    }
+    if (best >= 0) {
+        s->jobs[best].running = true;
+        s->jobs[best].kicked = false;
+    }
+    return best;
+}
+
+int64_t poll_sched_next_due(const poll_sched_t *s)
+{
+    int64_t next = POLL_SCHED_NEVER;
+    for (int i = 0; i < s->count; i++) {
+        const poll_sched_job_t *j = &s->jobs[i];
+        if (!j->running && j->due_ms < next) next = j->due_ms;
+    }
+    return next;
+}
+
+/* Return a taken job to the table, due @p delay_ms from now unless a kick
+ * arrived while it was out. */
+static void release(poll_sched_job_t *j, int64_t now_ms, uint32_t delay_ms)
+{
+    j->running = false;
+    j->due_ms = j->kicked ? now_ms : now_ms + delay_ms;
+    j->kicked = false;
+}
+
+void poll_sched_defer(poll_sched_t *s, int id, int64_t now_ms, uint32_t delay_ms)
+{
+    if (!valid_id(s, id) || !s->jobs[id].running) return;
+    release(&s->jobs[id], now_ms, delay_ms);
+}
+
+uint32_t poll_sched_finish(poll_sched_t *s, int id, int64_t now_ms, bool ok,
+                           uint32_t interval_ms, uint32_t backoff_initial_ms,
+                           uint32_t backoff_max_ms, uint32_t busy_ms)
+{
+    if (!valid_id(s, id) || !s->jobs[id].running) return 0;
+    poll_sched_job_t *j = &s->jobs[id];
+
+    j->runs++;
+    j->busy_ms_total += busy_ms;
+    j->busy_ms_last = busy_ms;
+    if (busy_ms > j->busy_ms_max) j->busy_ms_max = busy_ms;
+
+    uint32_t wait_ms;
+    if (ok) {
+        j->backoff_ms = 0;
+        wait_ms = interval_ms;
+    } else {
+        j->failures++;
+        if (backoff_initial_ms == 0) {
+            wait_ms = interval_ms;
+        } else {
+            j->backoff_ms = poll_backoff_next(j->backoff_ms, backoff_initial_ms, backoff_max_ms);
+            wait_ms = j->backoff_ms;
+        }
+    }
+    release(j, now_ms, wait_ms);
+    return wait_ms;
+}
+
+void poll_sched_kick(poll_sched_t *s, int id, int64_t now_ms)
+{
+    if (!valid_id(s, id)) return;
+    poll_sched_job_t *j = &s->jobs[id];
+    if (j->running) j->kicked = true;
+    else if (j->due_ms > now_ms) j->due_ms = now_ms;
+}
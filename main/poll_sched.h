@@ -0,0 +1,94 @@
+#pragma once
+
+/**
+ * @file poll_sched.h
+ * @brief Deadline table behind the shared poll scheduler (poll_task.c).
+ *
+ * The background pollers (AllSky, JSON, Home Assistant, weather) each used to
+ * own a FreeRTOS task with a 6-16 KB PSRAM stack that spent nearly all of its
+ * life asleep in ulTaskNotifyTake(). They now register as jobs with one
+ * scheduler whose small worker pool runs whichever job is due next. This is
+ * the bookkeeping half: a fixed table of jobs, each with the absolute time it
+ * is next due, its failure backoff (poll_backoff.h) and run statistics. The
+ * FreeRTOS half -- workers, locking, gating, wakeups -- lives in poll_task.c.
+ *
+ * poll_sched_take() hands out the earliest job due within the coalesce window,
+ * so jobs whose deadlines fall within a few hundred ms of each other run
+ * back-to-back off one wakeup instead of one wakeup each. A taken job is
+ * invisible to other workers until poll_sched_finish() or poll_sched_defer()
+ * puts it back with its next deadline. A kick while it runs is remembered and
+ * makes it due again as soon as it finishes, matching a task notify that
+ * arrives mid-poll.
+ *
+ * Not thread-safe; the caller serialises access. Times are caller-supplied
+ * milliseconds on any monotonic clock.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define POLL_SCHED_MAX_JOBS 8
+#define POLL_SCHED_NEVER    INT64_MAX   /**< poll_sched_next_due(): nothing scheduled */
+
+typedef struct {
+    const char *name;
+    int64_t  due_ms;          /**< Next run; meaningless while running */
+    uint32_t backoff_ms;      /**< Current failure backoff; 0 = not backing off */
+    bool     running;
+    bool     kicked;          /**< Kicked while running: due again on finish */
+
+    uint32_t runs;
+    uint32_t failures;
+    uint64_t busy_ms_total;   /**< Time spent inside the job's poll */
+    uint32_t busy_ms_max;
+    uint32_t busy_ms_last;
+} poll_sched_job_t;
+
+typedef struct {
+    poll_sched_job_t jobs[POLL_SCHED_MAX_JOBS];
+    int              count;
+    uint32_t         coalesce_ms;
+} poll_sched_t;
+
+void poll_sched_init(poll_sched_t *s, uint32_t coalesce_ms);
+
+/** Add a job due at @p now_ms. Returns its id, or -1 when the table is full. */
+int poll_sched_add(poll_sched_t *s, const char *name, int64_t now_ms);
+
+/**
+ * Take the job with the earliest deadline at or before now_ms + coalesce_ms
+ * and mark it running. Returns its id, or -1 if nothing is due.
+ */
+int poll_sched_take(poll_sched_t *s, int64_t now_ms);
+
+/** Earliest deadline among jobs not running, or POLL_SCHED_NEVER. */
+int64_t poll_sched_next_due(const poll_sched_t *s);
+
+/**
+ * Put a taken job back without running it (gated off, OTA, no WiFi yet), due
+ * again @p delay_ms from now. Backoff and statistics are untouched.
+ */
+void poll_sched_defer(poll_sched_t *s, int id, int64_t now_ms, uint32_t delay_ms);
+
+/**
+ * Record a finished run and schedule the next one: @p interval_ms after a
+ * success, or after a failure when backoff_initial_ms is 0; otherwise after
+ * the next poll_backoff_next() step. Returns the delay chosen.
+ */
+uint32_t poll_sched_finish(poll_sched_t *s, int id, int64_t now_ms, bool ok,
+                           uint32_t interval_ms, uint32_t backoff_initial_ms,
+                           uint32_t backoff_max_ms, uint32_t busy_ms);
+
+/** Make a job due now (or, if running, as soon as it finishes). */
+void poll_sched_kick(poll_sched_t *s, int id, int64_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,54 +1,214 @@
 /**
  * @file poll_task.c
- * @brief Shared poll-loop skeleton. See poll_task.h for scope.
+ * @brief Shared poll scheduler. See poll_task.h for scope.
  */
 
 #include "poll_task.h"
-#include "poll_backoff.h"
 #include "tasks.h"
+#include "trace.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <string.h>
 
 static const char *TAG = "poll_task";
 
-void poll_loop_run(const poll_loop_spec_t *spec, void *arg) {
-    if (!spec || !spec->poll_once || !spec->interval_ms) {
-        ESP_LOGE(TAG, "poll_loop_run: invalid spec");
-        return;
-    }
+/* Two workers: one long fetch (a slow HTTPS source, a weather provider
+ * timing out) must not hold every other poller hostage. 16 KB matches the
+ * largest stack the per-poller tasks needed (weather; JSON and HA run an
+ * mbedTLS handshake too). */
+#define POLL_TASK_WORKERS      2
+#define POLL_TASK_STACK_BYTES  16384
+#define POLL_TASK_PRIORITY     3
 
-    if (spec->wifi_group) {
-        xEventGroupWaitBits(spec->wifi_group, spec->wifi_bits, pdFALSE, pdFALSE, portMAX_DELAY);
-    }
-    ESP_LOGI(TAG, "%s: WiFi connected, starting poll loop", spec->name);
+/* Jobs due within this window of each other run off one wakeup. */
+#define POLL_TASK_COALESCE_MS  250
+
+/* How soon a job skipped for OTA, no WiFi or a closed gate is looked at again.
+ * Page entry kicks the job directly, so this only bounds the missed case. */
+#define POLL_TASK_RECHECK_MS   1000
+
+typedef struct {
+    const poll_loop_spec_t *spec;
+    void *arg;
+    bool  online;   /* WiFi seen once; the wait is not repeated after that */
+} poll_job_binding_t;
 
-    uint32_t backoff_ms = 0; /* 0 = not currently backing off */
+static poll_sched_t       s_sched;
+static poll_job_binding_t s_bindings[POLL_SCHED_MAX_JOBS];
+static SemaphoreHandle_t  s_lock;
+static SemaphoreHandle_t  s_wake;
+static _Atomic int        s_state;   /* 0 = not started, 1 = starting, 2 = running */
+
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+/* True if @p b may poll now; logs the first WiFi connect like the old loop. */
+static bool job_ready(poll_job_binding_t *b)
+{
+    const poll_loop_spec_t *spec = b->spec;
+    if (!b->online && spec->wifi_group) {
+        EventBits_t bits = xEventGroupGetBits(spec->wifi_group);
+        if ((bits & spec->wifi_bits) == 0) return false;
+    }
+    if (!b->online) {
+        b->online = true;
+        ESP_LOGI(TAG, "%s: WiFi connected, starting poll job", spec->name);
+    }
+    return !ota_in_progress && !(spec->page_active && !*spec->page_active);
+}
 
+static void poll_worker(void *arg)
+{
+    (void)arg;
     while (1) {
-        /* Suspend during OTA updates or while gated inactive (page not visible). */
-        while (ota_in_progress || (spec->page_active && !*spec->page_active)) {
-            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        int64_t now = now_ms();
+        int id = poll_sched_take(&s_sched, now);
+        int64_t next = poll_sched_next_due(&s_sched);
+        poll_job_binding_t *b = id >= 0 ? &s_bindings[id] : NULL;
+        xSemaphoreGive(s_lock);
+
+        if (!b) {
+            TickType_t wait = portMAX_DELAY;
+            if (next != POLL_SCHED_NEVER) {
+                int64_t ms = next > now ? next - now : 0;
+                wait = pdMS_TO_TICKS((uint32_t)ms);
+            }
+            /* A kick or a newly added job gives s_wake. */
+            xSemaphoreTake(s_wake, wait);
+            continue;
         }
 
-        bool ok = spec->poll_once(arg);
+        if (!job_ready(b)) {
+            xSemaphoreTake(s_lock, portMAX_DELAY);
+            poll_sched_defer(&s_sched, id, now_ms(), POLL_TASK_RECHECK_MS);
+            xSemaphoreGive(s_lock);
+            continue;
+        }
 
-        uint32_t wait_ms;
-        if (ok) {
-            backoff_ms = 0;
-            wait_ms = spec->interval_ms(arg);
-        } else if (spec->backoff_initial_ms == 0) {
-            /* Backoff disabled -- just retry at the normal interval. */
-            wait_ms = spec->interval_ms(arg);
-        } else {
-            backoff_ms = poll_backoff_next(backoff_ms, spec->backoff_initial_ms, spec->backoff_max_ms);
-            wait_ms = backoff_ms;
+        const poll_loop_spec_t *spec = b->spec;
+        int64_t start_us = esp_timer_get_time();
+        trace_begin(spec->name, id);
+        bool ok = spec->poll_once(b->arg);
+        trace_end(spec->name);
+        uint32_t busy_ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+        uint32_t interval = spec->interval_ms(b->arg);
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        uint32_t wait_ms = poll_sched_finish(&s_sched, id, now_ms(), ok, interval,
+                                             spec->backoff_initial_ms, spec->backoff_max_ms,
+                                             busy_ms);
+        xSemaphoreGive(s_lock);
+
+        if (!ok && spec->backoff_initial_ms != 0) {
             ESP_LOGW(TAG, "%s: poll failed, retrying in %u ms", spec->name, (unsigned)wait_ms);
         }
+    }
+}
+
+/* Create the lock, wake semaphore and workers once. Callers may race here
+ * (boot task, httpd runtime enable, app_main); the loser waits for the winner. */
+static bool poll_task_start(void)
+{
+    int expected = 0;
+    if (!atomic_compare_exchange_strong(&s_state, &expected, 1)) {
+        while (atomic_load(&s_state) == 1) vTaskDelay(1);
+        return s_lock != NULL;
+    }
 
-        /* A pending task notify (e.g. WebSocket wake, config change) wakes
-         * this early instead of sleeping the full interval. */
-        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms));
+    poll_sched_init(&s_sched, POLL_TASK_COALESCE_MS);
+    s_lock = xSemaphoreCreateMutex();
+    s_wake = xSemaphoreCreateCounting(POLL_TASK_WORKERS, 0);
+    if (!s_lock || !s_wake) {
+        ESP_LOGE(TAG, "Failed to create scheduler semaphores");
+        if (s_lock) vSemaphoreDelete(s_lock);
+        if (s_wake) vSemaphoreDelete(s_wake);
+        s_lock = s_wake = NULL;
+        atomic_store(&s_state, 2);
+        return false;
     }
+
+    int started = 0;
+    for (int i = 0; i < POLL_TASK_WORKERS; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "poll_wk%d", i);
+        /* PSRAM stack, internal TCB, pinned to Core 0 (networking) like the
+         * per-poller tasks these replace. */
+        StackType_t  *stack = heap_caps_malloc(POLL_TASK_STACK_BYTES, MALLOC_CAP_SPIRAM);
+        StaticTask_t *tcb   = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (stack && tcb &&
+            xTaskCreateStaticPinnedToCore(poll_worker, name, POLL_TASK_STACK_BYTES, NULL,
+                                          POLL_TASK_PRIORITY, stack, tcb, 0)) {
+            started++;
+        } else {
+            ESP_LOGE(TAG, "Failed to allocate poll worker %d", i);
+            if (stack) heap_caps_free(stack);
+            if (tcb) heap_caps_free(tcb);
+        }
+    }
+    ESP_LOGI(TAG, "Poll scheduler started with %d worker(s)", started);
+    atomic_store(&s_state, 2);
+    return true;
+}
+
+int poll_task_add(const poll_loop_spec_t *spec, void *arg)
+{
+    if (!spec || !spec->poll_once || !spec->interval_ms) {
+        ESP_LOGE(TAG, "poll_task_add: invalid spec");
+        return -1;
+    }
+    if (!poll_task_start()) return -1;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int id = -1;
+    for (int i = 0; i < s_sched.count; i++) {
+        if (s_bindings[i].spec == spec) {
+            id = i;
+            break;
+        }
+    }
+    bool added = false;
+    if (id < 0) {
+        id = poll_sched_add(&s_sched, spec->name, now_ms());
+        if (id >= 0) {
+            s_bindings[id] = (poll_job_binding_t){ .spec = spec, .arg = arg };
+            added = true;
+        }
+    }
+    xSemaphoreGive(s_lock);
+
+    if (id < 0) {
+        ESP_LOGE(TAG, "%s: job table full", spec->name);
+    } else if (added) {
+        ESP_LOGI(TAG, "%s: poll job added", spec->name);
+        xSemaphoreGive(s_wake);
+    }
+    return id;
+}
+
+void poll_task_kick(int job)
+{
+    if (job < 0 || atomic_load(&s_state) != 2 || !s_lock) return;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    poll_sched_kick(&s_sched, job, now_ms());
+    xSemaphoreGive(s_lock);
+    xSemaphoreGive(s_wake);
+}
+
+int poll_task_get_stats(poll_sched_job_t *out, int max)
+{
+    if (!out || max <= 0 || atomic_load(&s_state) != 2 || !s_lock) return 0;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int n = s_sched.count < max ? s_sched.count : max;
+    memcpy(out, s_sched.jobs, (size_t)n * sizeof(out[0]));
+    xSemaphoreGive(s_lock);
+    return n;
 }
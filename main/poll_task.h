@@ -2,26 +2,35 @@
 
 /**
  * @file poll_task.h
- * @brief Shared poll-loop skeleton for independent background pollers.
+ * @brief Shared poll scheduler for independent background pollers.
  *
- * Expresses the shape common to allsky_poll_task (main/tasks.c) and
- * weather_poll_task (main/weather_client.c): wait for WiFi once, then loop
- * suspending while OTA is in progress or (optionally) while some page-active
- * flag is false, call a poll function, and sleep for a live-config interval
- * -- with exponential backoff on failure if the caller opts in.
+ * Runs the pollers that share one shape -- AllSky, JSON Display, Home
+ * Assistant (main/tasks.c) and weather (main/weather_client.c): wait for WiFi
+ * once, then repeatedly call a poll function and wait a live-config interval,
+ * skipping while OTA is in progress or (optionally) while some page-active
+ * flag is false, with exponential backoff on failure if the caller opts in.
  *
- * The pure backoff step lives in poll_backoff.h (host-testable). This header
- * + poll_task.c own the FreeRTOS wait/notify plumbing around it.
+ * Each poller used to spin this loop on its own FreeRTOS task. They are now
+ * jobs on one scheduler: a deadline table (poll_sched.h, host-testable) served
+ * by POLL_TASK_WORKERS worker tasks, which run whichever job is due next and
+ * sleep until the next deadline in between. Gating, backoff, coalescing of
+ * near-simultaneous deadlines and per-job network-time accounting are handled
+ * here once instead of in every loop.
+ *
+ * Pollers whose loops carry more state than this -- the per-instance NINA
+ * pollers (WebSocket wakes, shutdown), GOES (prefetch hand-off), Spotify and
+ * the fetch worker (queue-driven) -- keep their own tasks.
  */
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
+#include "poll_sched.h"
 #include <stdbool.h>
 #include <stdatomic.h>
 #include <stdint.h>
 
 typedef struct {
-    const char *name;              /**< Log tag for this poll loop. */
+    const char *name;              /**< Log tag and trace span name for this job. */
     EventGroupHandle_t wifi_group; /**< Waited on once before the first poll. */
     EventBits_t wifi_bits;         /**< Bits to wait for (e.g. WIFI_CONNECTED_BIT). */
 
@@ -31,11 +40,11 @@ typedef struct {
     _Atomic bool *page_active;
 
     /** Perform one fetch. Return false on failure (triggers backoff, if
-     * configured). @p arg is the opaque pointer passed to poll_loop_run(). */
+     * configured). @p arg is the opaque pointer passed to poll_task_add(). */
     bool (*poll_once)(void *arg);
 
-    /** Live-config poll interval in ms, re-read every cycle so a config
-     * change takes effect on the very next sleep. */
+    /** Live-config poll interval in ms, re-read after every run so a config
+     * change takes effect on the very next wait. */
     uint32_t (*interval_ms)(void *arg);
 
     uint32_t backoff_initial_ms; /**< 0 = no failure backoff (retry at interval_ms()). */
@@ -43,7 +52,18 @@ typedef struct {
 } poll_loop_spec_t;
 
 /**
- * Run the poll loop described by @p spec. Never returns -- call this as (or
- * from) a FreeRTOS task entry point.
+ * Register @p spec as a job, due immediately; starts the worker pool on first
+ * use. @p spec must outlive the job (jobs are never removed). Registering the
+ * same spec again returns the existing job, so "ensure running" callers need
+ * no locking of their own. Returns the job id, or -1 on failure.
  */
-void poll_loop_run(const poll_loop_spec_t *spec, void *arg);
+int poll_task_add(const poll_loop_spec_t *spec, void *arg);
+
+/**
+ * Make job @p job due now -- page entry, config change, manual refresh. A kick
+ * during a run makes the job run again as soon as it finishes. Ignores -1.
+ */
+void poll_task_kick(int job);
+
+/** Copy up to @p max job entries (with run statistics) into @p out; returns the count. */
+int poll_task_get_stats(poll_sched_job_t *out, int max);
@@ -0,0 +1,103 @@
+/*
+ * red_remap_kernel.c - RGB565 Red Night remap kernels (see red_remap_kernel.h).
+ */
+
+#include "red_remap_kernel.h"
+
+#include <string.h>
+
+/* Widest native word: 2 pixels per op on the P4, 4 on a 64-bit host. */
+#if UINTPTR_MAX > 0xFFFFFFFFu
+typedef uint64_t red_word_t;
+#define RED_LANES(v) ((red_word_t)(v) * 0x0001000100010001ull)
+#else
+typedef uint32_t red_word_t;
+#define RED_LANES(v) ((red_word_t)(v) * 0x00010001u)
+#endif
+
+#define RED_WORD_PX (sizeof(red_word_t) / sizeof(uint16_t))
+
+void red_remap_rgb565_scalar(uint16_t *buf, size_t px_count)
+{
+    if (buf == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < px_count; i++) {
+        buf[i] = red_remap_px(buf[i]);
+    }
+}
+
+/*
+ * Per 16-bit lane: expand the channels to 8 bits exactly as red_remap_px()
+ * does, then S = 77*r8 + 150*g8 + 29*b8 <= 256*255 fits the lane. The output
+ * ((S >> 8) >> 3) << 11 is just S with everything below bit 11 cleared.
+ * The right shifts that pull bits in from the next lane up are masked back
+ * to the lane's own field.
+ */
+static inline red_word_t remap_word(red_word_t w)
+{
+    red_word_t r5 = (w >> 11) & RED_LANES(0x1f);
+    red_word_t g6 = (w >> 5) & RED_LANES(0x3f);
+    red_word_t b5 = w & RED_LANES(0x1f);
+    red_word_t r8 = (r5 << 3) | ((r5 >> 2) & RED_LANES(0x07));
+    red_word_t g8 = (g6 << 2) | ((g6 >> 4) & RED_LANES(0x03));
+    red_word_t b8 = (b5 << 3) | ((b5 >> 2) & RED_LANES(0x07));
+    red_word_t sum = 77 * r8 + 150 * g8 + 29 * b8;
+    return sum & RED_LANES(0xf800);
+}
+
+void red_remap_rgb565_packed(uint16_t *buf, size_t px_count)
+{
+    if (buf == NULL) {
+        return;
+    }
+    /* Scalar head up to word alignment. */
+    size_t i = 0;
+    while (i < px_count && ((uintptr_t)(buf + i) % sizeof(red_word_t)) != 0) {
+        buf[i] = red_remap_px(buf[i]);
+        i++;
+    }
+
+    /* memcpy keeps the word access alias-safe; it compiles to a plain
+     * load/store since the address is aligned. Four words per iteration
+     * give the in-order core independent multiply chains. */
+    for (; i + 4 * RED_WORD_PX <= px_count; i += 4 * RED_WORD_PX) {
+        red_word_t w[4];
+        memcpy(w, buf + i, sizeof(w));
+        w[0] = remap_word(w[0]);
+        w[1] = remap_word(w[1]);
+        w[2] = remap_word(w[2]);
+        w[3] = remap_word(w[3]);
+        memcpy(buf + i, w, sizeof(w));
+    }
+    for (; i + RED_WORD_PX <= px_count; i += RED_WORD_PX) {
+        red_word_t w;
+        memcpy(&w, buf + i, sizeof(w));
+        w = remap_word(w);
+        memcpy(buf + i, &w, sizeof(w));
+    }
+
+    for (; i < px_count; i++) {
+        buf[i] = red_remap_px(buf[i]);
+    }
+}
+
+void red_remap_rgb565_lut(uint16_t *buf, size_t px_count, const uint16_t *lut)
+{
+    if (buf == NULL || lut == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < px_count; i++) {
+        buf[i] = lut[buf[i]];
+    }
+}
+
+void red_remap_lut_build(uint16_t *lut)
+{
+    if (lut == NULL) {
+        return;
+    }
+    for (uint32_t px = 0; px < RED_REMAP_LUT_ENTRIES; px++) {
+        lut[px] = red_remap_px((uint16_t)px);
+    }
+}
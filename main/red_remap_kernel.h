@@ -0,0 +1,58 @@
+/*
+ * red_remap_kernel.h - Pure, host-testable RGB565 Red Night remap kernels
+ * behind image_red_remap.c.
+ *
+ * Every kernel maps each pixel to a red shade by luminance (R = luma,
+ * G = B = 0) and produces exactly the output of red_remap_px():
+ *
+ *   scalar  one pixel per iteration (the reference).
+ *   packed  several pixels per machine word (2 on the 32-bit P4, 4 on a
+ *           64-bit host). The weighted luma sum of one pixel never exceeds
+ *           16 bits, so all lanes are multiplied and summed in one register
+ *           without carries crossing into the neighbouring pixel.
+ *   lut     one load per pixel from a 64K-entry (128 KB) table indexed by
+ *           the source pixel; the caller owns the table.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef RED_REMAP_KERNEL_H
+#define RED_REMAP_KERNEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RED_REMAP_LUT_ENTRIES 65536u
+#define RED_REMAP_LUT_BYTES   (RED_REMAP_LUT_ENTRIES * sizeof(uint16_t))
+
+/* Reference mapping of one RGB565 pixel. */
+static inline uint16_t red_remap_px(uint16_t px) {
+    uint8_t r5 = (uint8_t)((px >> 11) & 0x1f);
+    uint8_t g6 = (uint8_t)((px >> 5) & 0x3f);
+    uint8_t b5 = (uint8_t)(px & 0x1f);
+    uint8_t r8 = (uint8_t)((r5 << 3) | (r5 >> 2));
+    uint8_t g8 = (uint8_t)((g6 << 2) | (g6 >> 4));
+    uint8_t b8 = (uint8_t)((b5 << 3) | (b5 >> 2));
+    uint8_t luma8 = (uint8_t)((77 * r8 + 150 * g8 + 29 * b8) >> 8);
+    return (uint16_t)((luma8 >> 3) << 11);
+}
+
+/* In-place remaps of @p px_count pixels; @p buf only needs uint16_t
+ * alignment. */
+void red_remap_rgb565_scalar(uint16_t *buf, size_t px_count);
+void red_remap_rgb565_packed(uint16_t *buf, size_t px_count);
+void red_remap_rgb565_lut(uint16_t *buf, size_t px_count, const uint16_t *lut);
+
+/* Fill @p lut (RED_REMAP_LUT_ENTRIES entries) for red_remap_rgb565_lut(). */
+void red_remap_lut_build(uint16_t *lut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RED_REMAP_KERNEL_H */
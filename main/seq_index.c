@@ -0,0 +1,363 @@
+/**
+ * @file seq_index.c
+ * @brief Flattened /sequence/json index and its cached walk (see seq_index.h).
+ */
+
+#include "seq_index.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+static uint32_t mix_bytes(uint32_t h, const void *data, size_t len) {
+    const unsigned char *p = data;
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+/* Strings are mixed with their NUL so "ab"+"c" and "a"+"bc" differ. */
+static uint32_t mix_str(uint32_t h, const char *s) {
+    return mix_bytes(h, s, strlen(s) + 1);
+}
+
+static uint32_t mix_u32(uint32_t h, uint32_t v) {
+    unsigned char b[4] = { (unsigned char)v, (unsigned char)(v >> 8),
+                           (unsigned char)(v >> 16), (unsigned char)(v >> 24) };
+    return mix_bytes(h, b, sizeof(b));
+}
+
+// Parse "H:MM:SS" or "H:MM:" style RemainingTime string to total seconds.
+// Returns -1 on parse failure.
+static int32_t parse_remaining_seconds(const char *str) {
+    int h = 0, m = 0, s = 0;
+    if (sscanf(str, "%d:%d:%d", &h, &m, &s) >= 2) {
+        return h * 3600 + m * 60 + s;
+    }
+    return -1;
+}
+
+static seq_status_t parse_status(const char *s) {
+    if (strcmp(s, "RUNNING") == 0) return SEQ_STATUS_RUNNING;
+    if (strcmp(s, "FINISHED") == 0) return SEQ_STATUS_FINISHED;
+    if (strcmp(s, "CREATED") == 0) return SEQ_STATUS_CREATED;
+    return SEQ_STATUS_OTHER;
+}
+
+void seq_index_begin(seq_index_t *idx) {
+    idx->count = 0;
+    idx->cond_count = 0;
+    idx->truncated = false;
+    idx->targets = SEQ_NO_NODE;
+    idx->names[0] = '\0';        /* offset 0 is the shared "" */
+    idx->names_used = 1;
+    idx->levels = 0;
+    idx->top_last = SEQ_NO_NODE;
+    idx->cond = -1;
+    idx->skip_depth = 0;
+}
+
+const char *seq_index_name(const seq_index_t *idx, int node) {
+    if (node < 0 || node >= idx->count) return "";
+    return idx->names + idx->nodes[node].name;
+}
+
+/* ── Building ──────────────────────────────────────────────────────── */
+
+static bool key_is(const json_stream_t *js, int level, const char *key) {
+    const char *k = json_stream_key_at(js, level);
+    return k && strcmp(k, key) == 0;
+}
+
+/* Is the object opening at @p depth an element of the "<key>" array of the
+ * innermost open item (or, with no item open, of the top-level Response)? */
+static bool opens_element_of(const seq_index_t *idx, const json_stream_t *js, int depth,
+                             const char *key) {
+    int d = idx->levels ? idx->open_depth[idx->levels - 1] : 0;
+    return depth == d + 2 && key_is(js, d, key) && json_stream_index_at(js, d + 1) >= 0;
+}
+
+static void open_item(seq_index_t *idx, int depth) {
+    if (idx->count >= SEQ_INDEX_MAX_NODES || idx->levels >= SEQ_INDEX_MAX_LEVELS) {
+        idx->truncated = true;
+        idx->skip_depth = depth;
+        return;
+    }
+    int16_t n = (int16_t)idx->count++;
+    int16_t parent = idx->levels ? idx->open[idx->levels - 1] : SEQ_NO_NODE;
+    seq_node_t *node = &idx->nodes[n];
+    memset(node, 0, sizeof(*node));
+    node->parent = parent;
+    node->first_child = SEQ_NO_NODE;
+    node->next_sibling = SEQ_NO_NODE;
+    node->level = (uint8_t)idx->levels;
+    node->hash = FNV_OFFSET;
+
+    int16_t *prev = idx->levels ? &idx->last_child[idx->levels - 1] : (int16_t *)NULL;
+    int16_t last = prev ? *prev : (int16_t)idx->top_last;
+    if (last != SEQ_NO_NODE) {
+        idx->nodes[last].next_sibling = n;
+    } else if (parent != SEQ_NO_NODE) {
+        idx->nodes[parent].first_child = n;
+    }
+    if (prev) *prev = n;
+    else idx->top_last = n;
+
+    idx->open[idx->levels] = n;
+    idx->open_depth[idx->levels] = (uint8_t)depth;
+    idx->last_child[idx->levels] = SEQ_NO_NODE;
+    idx->levels++;
+}
+
+static void close_item(seq_index_t *idx) {
+    int16_t n = idx->open[--idx->levels];
+    seq_node_t *node = &idx->nodes[n];
+    node->hash = mix_u32(node->hash, node->flags & (SEQ_NODE_HAS_NAME | SEQ_NODE_HAS_STATUS |
+                                                    SEQ_NODE_CONTAINER));
+    if (node->status == SEQ_STATUS_RUNNING) node->flags |= SEQ_NODE_RUNNING_BELOW;
+    if (node->parent != SEQ_NO_NODE) {
+        seq_node_t *parent = &idx->nodes[node->parent];
+        parent->hash = mix_u32(parent->hash, node->hash);
+        parent->flags |= node->flags & SEQ_NODE_RUNNING_BELOW;
+    }
+}
+
+static void set_name(seq_index_t *idx, int16_t n, const char *s) {
+    seq_node_t *node = &idx->nodes[n];
+    node->hash = mix_str(node->hash, s);
+    size_t len = strnlen(s, SEQ_INDEX_NAME_MAX - 1);
+    if (idx->names_used + len + 1 > sizeof(idx->names)) {
+        idx->truncated = true;
+        return;
+    }
+    memcpy(idx->names + idx->names_used, s, len);
+    idx->names[idx->names_used + len] = '\0';
+    node->name = (uint16_t)idx->names_used;
+    node->flags |= SEQ_NODE_HAS_NAME;
+    idx->names_used += len + 1;
+
+    if (node->level == 0 && idx->targets == SEQ_NO_NODE && strcmp(s, "Targets_Container") == 0) {
+        idx->targets = n;
+    }
+}
+
+static void item_value(seq_index_t *idx, int16_t n, const char *key, const json_stream_value_t *v) {
+    seq_node_t *node = &idx->nodes[n];
+    if (v->type == JSON_STREAM_STRING) {
+        if (strcmp(key, "Name") == 0) {
+            set_name(idx, n, v->str);
+        } else if (strcmp(key, "Status") == 0) {
+            node->status = (uint8_t)parse_status(v->str);
+            node->flags |= SEQ_NODE_HAS_STATUS;
+            node->hash = mix_str(node->hash, v->str);
+        }
+    } else if (v->type == JSON_STREAM_NUMBER) {
+        if (strcmp(key, "CompletedIterations") == 0) {
+            node->completed_iterations = (int32_t)v->num;
+            node->flags |= SEQ_NODE_HAS_COMPLETED;
+        } else if (strcmp(key, "Iterations") == 0) {
+            node->iterations = (int32_t)v->num;
+            node->flags |= SEQ_NODE_HAS_ITERATIONS;
+        } else if (strcmp(key, "ExposureCount") == 0) {
+            node->exposure_count = (int32_t)v->num;
+            node->flags |= SEQ_NODE_HAS_EXP_COUNT;
+        } else if (strcmp(key, "ExposureTime") == 0) {
+            node->exposure_time = (float)v->num;
+            node->flags |= SEQ_NODE_HAS_EXP_TIME;
+        }
+    }
+}
+
+static void cond_value(seq_cond_t *c, const char *key, const json_stream_value_t *v) {
+    if (v->type != JSON_STREAM_STRING) return;
+    if (strcmp(key, "Name") == 0) {
+        snprintf(c->name, sizeof(c->name), "%s", v->str);
+    } else if (strcmp(key, "RemainingTime") == 0) {
+        if (v->str[0] != '\0') c->remaining_s = parse_remaining_seconds(v->str);
+    } else if (strcmp(key, "ExpectedDateTime") == 0) {
+        snprintf(c->expected, sizeof(c->expected), "%s", v->str);
+    }
+}
+
+bool seq_index_stream_cb(json_stream_t *js, json_stream_event_t ev,
+                         const json_stream_value_t *val, void *ctx) {
+    seq_index_t *idx = (seq_index_t *)ctx;
+    if (ev == JSON_STREAM_EV_RESET) {
+        seq_index_begin(idx);
+        return true;
+    }
+    int depth = json_stream_depth(js);
+
+    /* Inside an item dropped for capacity: ignore it and everything below. */
+    if (idx->skip_depth) {
+        if (ev == JSON_STREAM_EV_OBJECT_END && depth == idx->skip_depth) idx->skip_depth = 0;
+        return true;
+    }
+
+    if (ev == JSON_STREAM_EV_OBJECT_BEGIN) {
+        if (idx->levels == 0 ? opens_element_of(idx, js, depth, "Response")
+                             : opens_element_of(idx, js, depth, "Items")) {
+            open_item(idx, depth);
+        } else if (idx->levels && idx->cond < 0 && opens_element_of(idx, js, depth, "Conditions")) {
+            if (idx->cond_count < SEQ_INDEX_MAX_CONDS) {
+                seq_cond_t *c = &idx->conds[idx->cond_count];
+                memset(c, 0, sizeof(*c));
+                c->node = idx->open[idx->levels - 1];
+                c->remaining_s = -1;
+                idx->cond = idx->cond_count++;
+            } else {
+                idx->truncated = true;
+            }
+        }
+        return true;
+    }
+    if (idx->levels == 0) return true;
+
+    int d = idx->open_depth[idx->levels - 1];
+    int16_t n = idx->open[idx->levels - 1];
+    switch (ev) {
+    case JSON_STREAM_EV_OBJECT_END:
+        if (depth == d) {
+            close_item(idx);
+        } else if (idx->cond >= 0 && depth == d + 2) {
+            idx->cond = -1;
+        }
+        break;
+    case JSON_STREAM_EV_ARRAY_BEGIN:
+        if (depth == d + 1 && key_is(js, d, "Items")) idx->nodes[n].flags |= SEQ_NODE_CONTAINER;
+        break;
+    case JSON_STREAM_EV_VALUE:
+        if (depth == d + 1) {
+            const char *key = json_stream_key_at(js, d);
+            if (key) item_value(idx, n, key, val);
+        } else if (idx->cond >= 0 && depth == d + 3) {
+            const char *key = json_stream_key_at(js, d + 2);
+            if (key) cond_value(&idx->conds[idx->cond], key, val);
+        }
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+/* ── Walking ───────────────────────────────────────────────────────── */
+
+static bool node_is(const seq_index_t *idx, int n, seq_status_t status) {
+    const seq_node_t *node = &idx->nodes[n];
+    return (node->flags & SEQ_NODE_HAS_STATUS) && node->status == status;
+}
+
+bool seq_index_cond_in_scope(const seq_index_t *idx, int root, int cond) {
+    if (cond < 0 || cond >= idx->cond_count) return false;
+    for (int n = idx->conds[cond].node; n != SEQ_NO_NODE; n = idx->nodes[n].parent) {
+        if (n == root) return true;
+        const seq_node_t *node = &idx->nodes[n];
+        if (!(node->flags & SEQ_NODE_CONTAINER)) return false;
+        if (!node_is(idx, n, SEQ_STATUS_RUNNING) && !node_is(idx, n, SEQ_STATUS_CREATED)) {
+            return false;
+        }
+    }
+    return false;
+}
+
+// Active target: RUNNING preferred, otherwise last FINISHED, otherwise the first
+static int pick_target(const seq_index_t *idx, int targets) {
+    int last_finished = SEQ_NO_NODE;
+    for (int c = idx->nodes[targets].first_child; c != SEQ_NO_NODE; c = idx->nodes[c].next_sibling) {
+        if (node_is(idx, c, SEQ_STATUS_RUNNING)) return c;
+        if (node_is(idx, c, SEQ_STATUS_FINISHED)) last_finished = c;
+    }
+    return last_finished != SEQ_NO_NODE ? last_finished : idx->nodes[targets].first_child;
+}
+
+// Deepest RUNNING container, or fall back to the last FINISHED container
+static int pick_container(const seq_index_t *idx, int parent) {
+    int last_finished = SEQ_NO_NODE;
+    for (int c = idx->nodes[parent].first_child; c != SEQ_NO_NODE; c = idx->nodes[c].next_sibling) {
+        const seq_node_t *node = &idx->nodes[c];
+        if (!(node->flags & SEQ_NODE_CONTAINER)) continue;
+        if ((node->flags & SEQ_NODE_HAS_NAME) && node_is(idx, c, SEQ_STATUS_RUNNING)) {
+            int deeper = pick_container(idx, c);
+            return deeper != SEQ_NO_NODE ? deeper : c;
+        }
+        if (node_is(idx, c, SEQ_STATUS_FINISHED)) last_finished = c;
+    }
+    if (last_finished != SEQ_NO_NODE && !(idx->nodes[last_finished].flags & SEQ_NODE_HAS_NAME)) {
+        return SEQ_NO_NODE;
+    }
+    return last_finished;
+}
+
+// Currently running step: the leaf instruction under the RUNNING path, or the
+// deepest RUNNING container with no running child
+static int pick_step(const seq_index_t *idx, int parent) {
+    for (int c = idx->nodes[parent].first_child; c != SEQ_NO_NODE; c = idx->nodes[c].next_sibling) {
+        const seq_node_t *node = &idx->nodes[c];
+        if (!(node->flags & SEQ_NODE_HAS_NAME) || !node_is(idx, c, SEQ_STATUS_RUNNING)) continue;
+        if (node->first_child == SEQ_NO_NODE) return c;
+        int deeper = pick_step(idx, c);
+        return deeper != SEQ_NO_NODE ? deeper : c;
+    }
+    return SEQ_NO_NODE;
+}
+
+// First RUNNING "Smart Exposure" in preorder; only RUNNING subtrees can hold one
+static int find_smart_exposure(const seq_index_t *idx, int parent) {
+    for (int c = idx->nodes[parent].first_child; c != SEQ_NO_NODE; c = idx->nodes[c].next_sibling) {
+        const seq_node_t *node = &idx->nodes[c];
+        if (!(node->flags & SEQ_NODE_RUNNING_BELOW)) continue;
+        if (node->status == SEQ_STATUS_RUNNING && (node->flags & SEQ_NODE_HAS_NAME) &&
+            strcmp(seq_index_name(idx, c), "Smart Exposure") == 0) {
+            return c;
+        }
+        int nested = find_smart_exposure(idx, c);
+        if (nested != SEQ_NO_NODE) return nested;
+    }
+    return SEQ_NO_NODE;
+}
+
+void seq_walk_reset(seq_walk_t *w) {
+    w->target = w->container = w->step = w->smart_exposure = SEQ_NO_NODE;
+    w->valid = false;
+    w->shape = 0;
+    w->base = SEQ_NO_NODE;
+}
+
+static int shift(int node, int by) {
+    return node == SEQ_NO_NODE ? SEQ_NO_NODE : node + by;
+}
+
+bool seq_index_walk(const seq_index_t *idx, seq_walk_t *w) {
+    int t = idx->targets;
+    if (t == SEQ_NO_NODE || idx->nodes[t].first_child == SEQ_NO_NODE) {
+        seq_walk_reset(w);
+        return false;
+    }
+
+    uint32_t shape = idx->nodes[t].hash;
+    if (w->valid && w->shape == shape) {
+        /* Same subtree shape: the picks sit at the same offsets from
+         * Targets_Container, which itself may have moved. */
+        int by = t - w->base;
+        w->target = shift(w->target, by);
+        w->container = shift(w->container, by);
+        w->step = shift(w->step, by);
+        w->smart_exposure = shift(w->smart_exposure, by);
+        w->base = t;
+        return false;
+    }
+
+    w->target = pick_target(idx, t);
+    w->container = pick_container(idx, w->target);
+    w->step = pick_step(idx, w->target);
+    w->smart_exposure = find_smart_exposure(idx, w->target);
+    w->valid = true;
+    w->shape = shape;
+    w->base = t;
+    return true;
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+/**
+ * @file seq_index.h
+ * @brief Flattened index of NINA's live /sequence/json tree.
+ *
+ * /sequence/json is the largest document the poll loop reads: a big
+ * multi-target Target Scheduler sequence is hundreds of instruction objects
+ * deep, and it used to be parsed into a cJSON DOM and then walked four times
+ * (active target, active container, running step, running Smart Exposure,
+ * earliest condition) on every 15 s poll and every sequence event.
+ *
+ * Here the body streams through json_stream into a flat, preorder array of
+ * the sequence items (one seq_node_t per object in a Response[] or Items[]
+ * array) holding only what those walks read -- name, status, parent / child /
+ * sibling links, the Smart Exposure counters -- plus the Conditions in a
+ * side table. No DOM is ever built.
+ *
+ * Every node also carries a shape hash over its Name, Status and children's
+ * hashes. seq_index_walk() remembers the Targets_Container hash it last
+ * walked: while only values change between polls (iteration counters,
+ * RemainingTime), the shape is the same, so the node picks from the previous
+ * walk are reused and just re-read. When the shape does change, the walk
+ * descends only into subtrees that contain a RUNNING item
+ * (SEQ_NODE_RUNNING_BELOW) instead of visiting every branch.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "json_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SEQ_INDEX_MAX_NODES  512
+#define SEQ_INDEX_MAX_CONDS  64
+#define SEQ_INDEX_NAMES      8192   /**< Name pool bytes (names are capped at SEQ_INDEX_NAME_MAX) */
+#define SEQ_INDEX_NAME_MAX   64
+#define SEQ_INDEX_MAX_LEVELS (JSON_STREAM_MAX_DEPTH / 2)
+#define SEQ_NO_NODE          (-1)
+
+typedef enum {
+    SEQ_STATUS_OTHER = 0,   /**< SKIPPED, FAILED, DISABLED, missing, ... */
+    SEQ_STATUS_CREATED,
+    SEQ_STATUS_RUNNING,
+    SEQ_STATUS_FINISHED,
+} seq_status_t;
+
+/* seq_node_t.flags */
+#define SEQ_NODE_HAS_NAME       0x01   /**< string "Name" present */
+#define SEQ_NODE_HAS_STATUS     0x02   /**< string "Status" present */
+#define SEQ_NODE_CONTAINER      0x04   /**< has an "Items" array (possibly empty) */
+#define SEQ_NODE_RUNNING_BELOW  0x08   /**< this node or a descendant is RUNNING */
+#define SEQ_NODE_HAS_COMPLETED  0x10   /**< numeric CompletedIterations */
+#define SEQ_NODE_HAS_ITERATIONS 0x20
+#define SEQ_NODE_HAS_EXP_COUNT  0x40
+#define SEQ_NODE_HAS_EXP_TIME   0x80
+
+typedef struct {
+    int16_t  parent;          /**< SEQ_NO_NODE for a top-level Response[] item */
+    int16_t  first_child;
+    int16_t  next_sibling;
+    uint8_t  level;           /**< 0 = top level */
+    uint8_t  status;          /**< seq_status_t */
+    uint8_t  flags;           /**< SEQ_NODE_* */
+    uint16_t name;            /**< offset into seq_index_t.names */
+    uint32_t hash;            /**< shape hash: Name, Status, children's hashes */
+    int32_t  completed_iterations;
+    int32_t  iterations;
+    int32_t  exposure_count;
+    float    exposure_time;
+} seq_node_t;
+
+typedef struct {
+    int16_t node;             /**< owning item */
+    int32_t remaining_s;      /**< RemainingTime ("H:MM:SS") in seconds, -1 if absent */
+    char    name[40];         /**< condition Name, "" if absent */
+    char    expected[40];     /**< ExpectedDateTime as sent, "" if absent */
+} seq_cond_t;
+
+typedef struct {
+    int  count;
+    int  cond_count;
+    bool truncated;           /**< capacity exceeded; later items/conditions were dropped */
+    int16_t targets;          /**< the top-level "Targets_Container", or SEQ_NO_NODE */
+
+    seq_node_t nodes[SEQ_INDEX_MAX_NODES];
+    seq_cond_t conds[SEQ_INDEX_MAX_CONDS];
+    char       names[SEQ_INDEX_NAMES];
+    size_t     names_used;
+
+    /* Build state (seq_index_stream_cb) */
+    int16_t open[SEQ_INDEX_MAX_LEVELS];   /**< open items, outermost first */
+    uint8_t open_depth[SEQ_INDEX_MAX_LEVELS];   /**< json_stream depth of each */
+    int16_t last_child[SEQ_INDEX_MAX_LEVELS];   /**< previous sibling per open level */
+    int     levels;
+    int     top_last;         /**< previous top-level item */
+    int     cond;             /**< condition being filled, -1 = none */
+    int     skip_depth;       /**< > 0: inside an item dropped for capacity */
+} seq_index_t;
+
+/** Clear @p idx for a new document. */
+void seq_index_begin(seq_index_t *idx);
+
+/**
+ * json_stream callback building @p ctx (a seq_index_t). Pass to
+ * json_stream_init(); JSON_STREAM_EV_RESET restarts the index, so a
+ * transport retry rebuilds it from scratch.
+ */
+bool seq_index_stream_cb(json_stream_t *js, json_stream_event_t ev,
+                         const json_stream_value_t *val, void *ctx);
+
+/** Name of @p node ("" if it had none). */
+const char *seq_index_name(const seq_index_t *idx, int node);
+
+/**
+ * True if condition @p cond is in scope of @p root for the earliest-condition
+ * search: it belongs to @p root itself, or to an item below it reached only
+ * through RUNNING or CREATED containers.
+ */
+bool seq_index_cond_in_scope(const seq_index_t *idx, int root, int cond);
+
+/**
+ * Node picks of one walk, as indexes into the seq_index_t last passed to
+ * seq_index_walk() (SEQ_NO_NODE = none). Keep it between polls: the cached
+ * shape hash is what lets the next walk be skipped.
+ */
+typedef struct {
+    int target;           /**< RUNNING child of Targets_Container, else last FINISHED,
+                               else the first child; SEQ_NO_NODE if it has none */
+    int container;        /**< deepest RUNNING container below target, else its last
+                               FINISHED container; SEQ_NO_NODE if neither */
+    int step;             /**< running step below target: a leaf instruction, or the
+                               deepest RUNNING container with no running child */
+    int smart_exposure;   /**< first RUNNING "Smart Exposure" below target (preorder) */
+
+    bool     valid;
+    uint32_t shape;       /**< Targets_Container hash these picks were made on */
+    int      base;        /**< Targets_Container node index they were made on */
+} seq_walk_t;
+
+/** Reset @p w so the next seq_index_walk() walks in full. */
+void seq_walk_reset(seq_walk_t *w);
+
+/**
+ * Pick the target, container, step and Smart Exposure nodes of @p idx into
+ * @p w. Reuses the previous picks when the Targets_Container shape hash has
+ * not changed since they were made. Returns true if it walked, false if it
+ * reused (or there is no Targets_Container, in which case every pick is
+ * SEQ_NO_NODE).
+ */
+bool seq_index_walk(const seq_index_t *idx, seq_walk_t *w);
+
+#ifdef __cplusplus
+}
+#endif
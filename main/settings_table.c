@@ -2,6 +2,8 @@
 #include "app_config.h"
 #include "themes.h"
 #include "cJSON.h"
+#include "config_tlv.h"
+#include <stddef.h>
 #include <string.h>
 
 /* -- settings_defaults_apply() ------------------------------------------- */
@@ -233,3 +235,65 @@ void settings_json_parse(const cJSON *root, app_config_t *cfg) {
 #undef CLAMP_ENUM
 #undef CLAMP_STR
 #undef CLAMP_STR_RESET
+
+/* -- settings_store_schema() ---------------------------------------------
+ * One config_tlv_field_t per table row and per CONFIG_STORE_EXTRA_FIELDS
+ * entry. Bools, numbers and enums are stored as raw scalars; strings up to
+ * their NUL. */
+
+#define STORE_FIELD(field, name, kind) \
+    { name, (uint16_t)offsetof(app_config_t, field), \
+      (uint16_t)sizeof(((app_config_t *)0)->field), \
+      (uint8_t)__alignof__(((app_config_t *)0)->field), kind, 0 },
+#define STORE_BOOL(field, json_key, def) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_RAW)
+#define STORE_INT(field, json_key, def, min, max) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_RAW)
+#define STORE_INT_RESET(field, json_key, def, min, max) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_RAW)
+#define STORE_FLT(field, json_key, def, min, max) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_RAW)
+#define STORE_FLT_RESET(field, json_key, def, min, max) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_RAW)
+#define STORE_ENUM(field, json_key, def, count_expr) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_RAW)
+#define STORE_STR(field, json_key, def) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_STR)
+#define STORE_STR_RESET(field, json_key, def) \
+    STORE_FIELD(field, json_key, CONFIG_TLV_STR)
+#define STORE_EXTRA_RAW(field) STORE_FIELD(field, #field, CONFIG_TLV_RAW)
+#define STORE_EXTRA_ARR(field) STORE_FIELD(field, #field, CONFIG_TLV_ARRAY)
+#define STORE_EXTRA_STR(field) STORE_FIELD(field, #field, CONFIG_TLV_STR)
+
+static config_tlv_field_t s_store_fields[] = {
+    SETTINGS_TABLE(STORE_BOOL, STORE_INT, STORE_INT_RESET, STORE_FLT, STORE_FLT_RESET,
+                   STORE_ENUM, STORE_STR, STORE_STR_RESET)
+    CONFIG_STORE_EXTRA_FIELDS(STORE_EXTRA_RAW, STORE_EXTRA_ARR, STORE_EXTRA_STR)
+};
+
+#undef STORE_FIELD
+#undef STORE_BOOL
+#undef STORE_INT
+#undef STORE_INT_RESET
+#undef STORE_FLT
+#undef STORE_FLT_RESET
+#undef STORE_ENUM
+#undef STORE_STR
+#undef STORE_STR_RESET
+#undef STORE_EXTRA_RAW
+#undef STORE_EXTRA_ARR
+#undef STORE_EXTRA_STR
+
+const config_tlv_schema_t *settings_store_schema(void) {
+    static config_tlv_schema_t schema;
+    static bool ready;
+    if (!ready) {
+        if (!config_tlv_schema_init(&schema, s_store_fields,
+                                    sizeof(s_store_fields) / sizeof(s_store_fields[0]),
+                                    sizeof(app_config_t))) {
+            return NULL;
+        }
+        ready = true;
+    }
+    return &schema;
+}
@@ -2,6 +2,7 @@
 
 #include "app_config.h"   /* app_config_t */
 #include "cJSON.h"        /* cJSON, used by settings_json_serialize/parse */
+#include "config_tlv.h"   /* config_tlv_schema_t, used by settings_store_schema */
 
 /* X-macro table of "simple" app_config_t settings: one row per field that has
  * a plain 1:1 default value and (optionally) a range check. Driven by
@@ -165,6 +166,62 @@
     INT_RESET (custom_orientation,           "custom_orientation",           0,     0,     3) \
     INT_RESET (custom_update_interval_s,     "custom_update_interval_s",     60,    10,    7200)
 
+/* Every other persisted app_config_t field: arrays, JSON blobs, secrets,
+ * page targets and retired fields that the table above deliberately leaves
+ * out. Together with the SETTINGS_TABLE rows this is the field list of the
+ * tagged NVS store (settings_store_schema(), config_tlv.h); config_version
+ * is the only field in neither, since the store is not versioned.
+ *
+ * Each field is stored under a tag derived from its name (the json_key for
+ * table rows, the field name here), so neither may be renamed without
+ * losing the stored value. A new app_config_t field must be added to one of
+ * the two lists; test_config_tlv fails on any field that is in neither.
+ *
+ * Kinds: RAW (field) scalar, restored only at its exact size;
+ *        ARR (field) array, common prefix restored if its length changes;
+ *        STR (field) char[], stored up to its NUL. */
+#define CONFIG_STORE_EXTRA_FIELDS(RAW, ARR, STR) \
+    /* -- NINA instances -- */ \
+    ARR (api_url) \
+    ARR (filter_colors) \
+    ARR (rms_thresholds) \
+    ARR (hfr_thresholds) \
+    ARR (instance_enabled) \
+    RAW (update_rate_s) \
+    RAW (graph_update_interval_s) \
+    /* -- Secrets -- */ \
+    STR (mqtt_password) \
+    STR (admin_password) \
+    STR (spotify_client_id) \
+    ARR (wifi_networks) \
+    /* -- Pages / rotation (incl. fields retired in v44, kept for downgrades) -- */ \
+    RAW (active_page_override) \
+    RAW (idle_page_override_target) \
+    RAW (home_page_lock) \
+    RAW (auto_rotate_pages) \
+    RAW (auto_rotate_pages_hi) \
+    ARR (auto_rotate_order) \
+    RAW (auto_rotate_order_ext) \
+    ARR (auto_rotate_order2) \
+    /* -- Toast -- */ \
+    RAW (toast_notify_mask) \
+    ARR (toast_instance_muted) \
+    /* -- AllSky -- */ \
+    STR (allsky_field_config) \
+    STR (allsky_thresholds) \
+    /* -- Moon -- */ \
+    RAW (moon_drag_light_mode) \
+    /* -- JSON Display -- */ \
+    RAW (json_enabled) \
+    STR (json_url) \
+    STR (json_auth_header) \
+    RAW (json_update_interval_s) \
+    /* -- Home Assistant -- */ \
+    RAW (ha_enabled) \
+    STR (ha_base_url) \
+    STR (ha_token) \
+    RAW (ha_update_interval_s)
+
 /* Apply every row's default value to *cfg. Called from set_defaults()
  * immediately after the memset(). Does not touch excluded/complex fields
  * (arrays, JSON blobs, secrets, cross-field page targets) — those keep their
@@ -193,3 +250,8 @@ void settings_json_serialize(const app_config_t *cfg, cJSON *root);
  * settings_table.c). If the key is absent, or present with the wrong JSON
  * type, cfg->field is left completely untouched. */
 void settings_json_parse(const cJSON *root, app_config_t *cfg);
+
+/* Field list of the tagged NVS config store: every SETTINGS_TABLE row (tagged
+ * by json_key) plus CONFIG_STORE_EXTRA_FIELDS (tagged by field name). Tagged
+ * and sorted on first call; NULL if two names share a tag. */
+const config_tlv_schema_t *settings_store_schema(void);
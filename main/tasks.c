@@ -55,11 +55,12 @@
 #include <math.h>          /* expf — framerate-independent settle ease */
 #include <stdatomic.h>     /* atomic_exchange — read-and-clear WS event flags */
 #include "perf_monitor.h"
+#include "trace.h"
 #include "power_mgmt.h"
 #include "crash_log.h"
 #include "demo_data.h"
 #include "weather_client.h"
-#include "driver/jpeg_decode.h"
+#include "jpeg_service.h"
 #include "freertos/queue.h"
 #include "ui/nina_thumbnail.h"
 #include "poll_task.h"
@@ -154,14 +155,13 @@ _Atomic bool screen_asleep = false;
 TaskHandle_t data_task_handle = NULL;
 TaskHandle_t poll_task_handles[MAX_NINA_INSTANCES] = {NULL};
 static int64_t last_graph_fetch_ms = 0;  /* Timestamp of last graph data fetch */
-static bool hfr_graph_seeded = false;   /* True after initial API fetch for current HFR graph session */
 
 /* Per-instance poll contexts (shared between UI coordinator and poll tasks) */
 static instance_poll_ctx_t poll_contexts[MAX_NINA_INSTANCES];
 
 /* Feature task state and page-active flags.
- * Each flag is set by data_update_task and read by the corresponding poll task.
- * When false, the poll task suspends and frees resources. */
+ * Each flag is set by data_update_task and read by the corresponding poll task
+ * or poll job. When false, the poller suspends (or is skipped) and frees resources. */
 TaskHandle_t spotify_task_handle = NULL;
 _Atomic bool spotify_page_active = false;
 _Atomic bool allsky_page_active  = false;
@@ -170,17 +170,17 @@ _Atomic bool ha_page_active      = false;
 _Atomic bool clock_page_active   = false;
 _Atomic bool nina_pages_active   = false;
 
-/* AllSky polling state */
+/* AllSky polling state (job id on the shared poll scheduler, -1 = not added) */
 static allsky_data_t allsky_data;
-static TaskHandle_t allsky_task_handle = NULL;
+static int allsky_job = -1;
 
 /* JSON Display polling state */
 static json_data_t json_data;
-static TaskHandle_t json_task_handle = NULL;
+static int json_job = -1;
 
 /* Home Assistant polling state */
 static ha_data_t ha_data;
-static TaskHandle_t ha_task_handle = NULL;
+static int ha_job = -1;
 
 /* GOES / Image Display polling state.
  * Non-static: tasks.h externs these and web handlers use goes_task_handle /
@@ -502,7 +502,9 @@ void instance_poll_task(void *arg) {
                 ESP_LOGD(TAG, "Poll[%d] (page-idle): connected=%d", idx + 1, ctx->client->connected);
             }
         } else if (ctx->is_active) {
+            trace_begin("nina_poll", idx);
             nina_client_poll(url, ctx->client, ctx->poll_state, idx);
+            trace_end("nina_poll");
             if (nina_connection_is_connected(idx))
                 ctx->client->last_successful_poll_ms = now_ms;
             if (app_config_get()->debug_mode) {
@@ -520,7 +522,9 @@ void instance_poll_task(void *arg) {
             }
         } else {
             if (now_ms - ctx->last_heartbeat_ms >= HEARTBEAT_INTERVAL_MS) {
+                trace_begin("nina_poll_bg", idx);
                 nina_client_poll_background(url, ctx->client, ctx->poll_state, idx);
+                trace_end("nina_poll_bg");
                 if (nina_connection_is_connected(idx))
                     ctx->client->last_successful_poll_ms = now_ms;
                 ctx->last_heartbeat_ms = now_ms;
@@ -580,7 +584,7 @@ static void ota_progress_cb(int percent) {
 }
 
 // =============================================================================
-// AllSky Poll Task — independent poller pinned to Core 0
+// AllSky poll job — runs on the shared poll scheduler (poll_task.c)
 // =============================================================================
 
 static bool allsky_poll_once(void *arg) {
@@ -608,26 +612,20 @@ static uint32_t allsky_interval_ms(void *arg) {
     return interval_ms;
 }
 
-void allsky_poll_task(void *arg) {
-    (void)arg;
-    ESP_LOGI(TAG, "AllSky poll task started");
-
-    poll_loop_spec_t spec = {
-        .name = "allsky",
-        .wifi_group = s_wifi_event_group,
-        .wifi_bits = WIFI_CONNECTED_BIT,
-        .page_active = &allsky_page_active,
-        .poll_once = allsky_poll_once,
-        .interval_ms = allsky_interval_ms,
-        .backoff_initial_ms = 0,
-        .backoff_max_ms = 0,
-    };
-
-    poll_loop_run(&spec, NULL);
-}
+/* wifi_group is filled in on registration: s_wifi_event_group is created at
+ * runtime, so it cannot appear in a static initializer. */
+static poll_loop_spec_t allsky_spec = {
+    .name = "allsky",
+    .wifi_bits = WIFI_CONNECTED_BIT,
+    .page_active = &allsky_page_active,
+    .poll_once = allsky_poll_once,
+    .interval_ms = allsky_interval_ms,
+    .backoff_initial_ms = 0,
+    .backoff_max_ms = 0,
+};
 
 // =============================================================================
-// JSON Display Poll Task — independent poller pinned to Core 0
+// JSON Display poll job — runs on the shared poll scheduler (poll_task.c)
 // =============================================================================
 
 static bool json_poll_once(void *arg) {
@@ -656,58 +654,30 @@ static uint32_t json_interval_ms(void *arg) {
     return interval_ms;
 }
 
-void json_poll_task(void *arg) {
-    (void)arg;
-    ESP_LOGI(TAG, "JSON Display poll task started");
-
-    poll_loop_spec_t spec = {
-        .name = "json",
-        .wifi_group = s_wifi_event_group,
-        .wifi_bits = WIFI_CONNECTED_BIT,
-        .page_active = &json_page_active,
-        .poll_once = json_poll_once,
-        .interval_ms = json_interval_ms,
-        .backoff_initial_ms = 0,
-        .backoff_max_ms = 0,
-    };
-
-    poll_loop_run(&spec, NULL);
-}
-
-void json_ensure_task_running(void)
+static poll_loop_spec_t json_spec = {
+    .name = "json",
+    .wifi_bits = WIFI_CONNECTED_BIT,
+    .page_active = &json_page_active,
+    .poll_once = json_poll_once,
+    .interval_ms = json_interval_ms,
+    .backoff_initial_ms = 0,
+    .backoff_max_ms = 0,
+};
+
+void json_ensure_polling(void)
 {
-    /* Only spawn when the page is enabled; a runtime enable via the web UI must
-     * start polling without a reboot (mirrors goes_ensure_task_running). */
+    /* Only add when the page is enabled; a runtime enable via the web UI must
+     * start polling without a reboot (mirrors goes_ensure_task_running).
+     * poll_task_add() returns the existing job on a repeat call, so the boot
+     * task and an httpd task racing here cannot add it twice. */
     if (!app_config_get()->json_enabled) return;
 
-    /* Guard check-and-assign against a double-spawn race: this may be called
-     * concurrently from the boot task and an httpd task (runtime enable). */
-    static portMUX_TYPE json_spawn_mux = portMUX_INITIALIZER_UNLOCKED;
-    portENTER_CRITICAL(&json_spawn_mux);
-    bool already = (json_task_handle != NULL);
-    portEXIT_CRITICAL(&json_spawn_mux);
-    if (already) return;
-
-    /* PSRAM stack 10240 words, pinned to Core 0, priority 3 — mirrors the boot
-     * spawn in data_update_task exactly. 10240 (not 6144) gives TLS headroom:
-     * an https JSON source runs an mbedTLS handshake on this task's stack. */
-    StackType_t  *stack = heap_caps_malloc(10240 * sizeof(StackType_t), MALLOC_CAP_SPIRAM);
-    StaticTask_t *tcb   = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    if (stack && tcb) {
-        portENTER_CRITICAL(&json_spawn_mux);
-        json_task_handle = xTaskCreateStaticPinnedToCore(
-            json_poll_task, "json", 10240, NULL, 3, stack, tcb, 0);
-        portEXIT_CRITICAL(&json_spawn_mux);
-        ESP_LOGI(TAG, "JSON Display poll task spawned");
-    } else {
-        ESP_LOGE(TAG, "Failed to allocate JSON Display poll task stack");
-        if (stack) heap_caps_free(stack);
-        if (tcb) heap_caps_free(tcb);
-    }
+    json_spec.wifi_group = s_wifi_event_group;
+    json_job = poll_task_add(&json_spec, NULL);
 }
 
 // =============================================================================
-// Home Assistant Poll Task — independent poller pinned to Core 0
+// Home Assistant poll job — runs on the shared poll scheduler (poll_task.c)
 // =============================================================================
 
 static bool ha_poll_once(void *arg) {
@@ -736,54 +706,24 @@ static uint32_t ha_interval_ms(void *arg) {
     return interval_ms;
 }
 
-void ha_poll_task(void *arg) {
-    (void)arg;
-    ESP_LOGI(TAG, "Home Assistant poll task started");
-
-    poll_loop_spec_t spec = {
-        .name = "ha",
-        .wifi_group = s_wifi_event_group,
-        .wifi_bits = WIFI_CONNECTED_BIT,
-        .page_active = &ha_page_active,
-        .poll_once = ha_poll_once,
-        .interval_ms = ha_interval_ms,
-        .backoff_initial_ms = 0,
-        .backoff_max_ms = 0,
-    };
-
-    poll_loop_run(&spec, NULL);
-}
-
-void ha_ensure_task_running(void)
+static poll_loop_spec_t ha_spec = {
+    .name = "ha",
+    .wifi_bits = WIFI_CONNECTED_BIT,
+    .page_active = &ha_page_active,
+    .poll_once = ha_poll_once,
+    .interval_ms = ha_interval_ms,
+    .backoff_initial_ms = 0,
+    .backoff_max_ms = 0,
+};
+
+void ha_ensure_polling(void)
 {
-    /* Only spawn when the page is enabled; a runtime enable via the web UI must
-     * start polling without a reboot (mirrors json_ensure_task_running). */
+    /* Only add when the page is enabled; a runtime enable via the web UI must
+     * start polling without a reboot (mirrors json_ensure_polling). */
     if (!app_config_get()->ha_enabled) return;
 
-    /* Guard check-and-assign against a double-spawn race: this may be called
-     * concurrently from the boot task and an httpd task (runtime enable). */
-    static portMUX_TYPE ha_spawn_mux = portMUX_INITIALIZER_UNLOCKED;
-    portENTER_CRITICAL(&ha_spawn_mux);
-    bool already = (ha_task_handle != NULL);
-    portEXIT_CRITICAL(&ha_spawn_mux);
-    if (already) return;
-
-    /* PSRAM stack 10240 words, pinned to Core 0, priority 3 — mirrors the boot
-     * spawn in data_update_task exactly. 10240 (not 6144) gives TLS headroom:
-     * an https HA base runs an mbedTLS handshake on this task's stack. */
-    StackType_t  *stack = heap_caps_malloc(10240 * sizeof(StackType_t), MALLOC_CAP_SPIRAM);
-    StaticTask_t *tcb   = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-    if (stack && tcb) {
-        portENTER_CRITICAL(&ha_spawn_mux);
-        ha_task_handle = xTaskCreateStaticPinnedToCore(
-            ha_poll_task, "ha", 10240, NULL, 3, stack, tcb, 0);
-        portEXIT_CRITICAL(&ha_spawn_mux);
-        ESP_LOGI(TAG, "Home Assistant poll task spawned");
-    } else {
-        ESP_LOGE(TAG, "Failed to allocate Home Assistant poll task stack");
-        if (stack) heap_caps_free(stack);
-        if (tcb) heap_caps_free(tcb);
-    }
+    ha_spec.wifi_group = s_wifi_event_group;
+    ha_job = poll_task_add(&ha_spec, NULL);
 }
 
 // =============================================================================
@@ -1021,6 +961,45 @@ void moon_overlay_info(char *age,  size_t age_sz,
     fmt_moon_event(set,  set_sz,  "Set",  s_rs_set,  s_rs_set_v,  now, use_24h);
 }
 
+/* Depth buffer for moon_render_frame(): goes_poll_task-only scratch, kept
+ * across renders and freed on Image Display page leave. It is not a frame,
+ * so it stays out of g_image_frames. */
+static uint16_t *s_moon_zbuf       = NULL;
+static size_t    s_moon_zbuf_bytes = 0;
+
+static void moon_zbuf_free(void)
+{
+    if (s_moon_zbuf) { heap_caps_free(s_moon_zbuf); s_moon_zbuf = NULL; }
+    s_moon_zbuf_bytes = 0;
+}
+
+/* Render a moon frame into g_image_frames: the colour buffer is a slot handed
+ * to @p owner, the depth buffer is s_moon_zbuf. Same pixels as
+ * moon_sphere_render_ex(), without its per-frame colour/z allocations. */
+static uint16_t *moon_render_frame(int size, const moon_state_t *st, uint8_t bg_style,
+                                   float yaw, float pitch, moon_light_mode_t light,
+                                   frame_owner_t owner)
+{
+    size_t bytes = (size_t)size * size * 2;
+    if (s_moon_zbuf_bytes < bytes) {
+        moon_zbuf_free();
+        s_moon_zbuf = heap_caps_aligned_alloc(128, (bytes + 127) & ~(size_t)127, MALLOC_CAP_SPIRAM);
+        if (!s_moon_zbuf) return NULL;
+        s_moon_zbuf_bytes = bytes;
+    }
+    uint16_t *color = frame_pool_acquire(&g_image_frames, bytes, FRAME_OWNER_PRODUCER);
+    uint16_t *img = color
+        ? moon_sphere_render_into(size, size, st, 96, 48, bg_style, yaw, pitch, light, color,
+                                  s_moon_zbuf)
+        : NULL;
+    if (!img) {
+        frame_pool_release(&g_image_frames, color);
+        return NULL;
+    }
+    frame_pool_handoff(&g_image_frames, img, owner);
+    return img;
+}
+
 /* ── Prefetch PRODUCER (Phase 4) ────────────────────────────────────────────
  * Consume any pending prefetch request (s_prefetch_source, set by the arbiter via
  * image_source_trigger_prefetch) and build that source's frame INTO
@@ -1035,33 +1014,35 @@ void moon_overlay_info(char *age,  size_t age_sz,
  * s_prefetch_ready false, so the consumer simply does a normal foreground fetch
  * later — the existing "Loading image..." graceful-miss path, no new code.
  *
- * MEMORY: every frame written here is heap_caps_malloc'd in PSRAM by the fetch/
- * render helper (goes_client_poll* allocate the decoded RGB565; moon_sphere_render
- * allocates the rendered RGB565). The buffer is owned by goes_prefetch_data until
- * EITHER the swap consumer moves it into goes_data (and NULLs prefetch.image_buf),
- * OR a subsequent prefetch overwrites it — so this helper frees any unconsumed
- * prefetch frame before installing a new one, preventing a leak when two prefetch
- * requests land without an intervening swap. */
+ * MEMORY: every frame written here is a g_image_frames slot (goes_client_poll*
+ * decode into one; moon_render_frame() renders into one), handed to
+ * FRAME_OWNER_PREFETCH. The slot is owned by goes_prefetch_data until EITHER the
+ * swap consumer moves it into goes_data (handing it to FRAME_OWNER_SOURCE and
+ * NULLing prefetch.image_buf), OR a subsequent prefetch overwrites it — so this
+ * helper releases any unconsumed prefetch frame before installing a new one,
+ * preventing a leaked slot when two prefetch requests land without an
+ * intervening swap. */
 static void image_prefetch_run(const app_config_t *cfg)
 {
     int8_t pf = atomic_exchange(&s_prefetch_source, -1);
     if (pf < 0) return;
 
     /* A prior prefetch frame that was never swapped in would leak when the new
-     * fetch below replaces the pointer (goes_client_poll* free the OLD buffer they
-     * find in the target, but the moon render assigns directly), so clear it here
-     * under the prefetch lock and drop the stale ready flag. */
+     * fetch below replaces the pointer (goes_client_poll* release the OLD buffer
+     * they find in the target, but the moon render assigns directly), so release
+     * it here under the prefetch lock and drop the stale ready flag. Doing it
+     * before the fetch also frees its slot for the new frame. */
     if (goes_data_lock(&goes_prefetch_data, 1000)) {
-        if (goes_prefetch_data.image_buf) {
-            heap_caps_free(goes_prefetch_data.image_buf);
-            goes_prefetch_data.image_buf = NULL;
-        }
+        frame_pool_release(&g_image_frames, goes_prefetch_data.image_buf);
+        goes_prefetch_data.image_buf = NULL;
+        goes_prefetch_data.image_url[0] = '\0';
         goes_data_unlock(&goes_prefetch_data);
     }
     atomic_store(&s_prefetch_ready, false);
     atomic_store(&s_prefetch_ready_src, -1);
 
     esp_err_t err = ESP_FAIL;
+    trace_begin("image_prefetch", pf);
     if (pf == 1) {
         /* Moon: render locally (synchronous, ~300ms). Skip until the clock is
          * valid so the phase/orientation is correct. */
@@ -1072,8 +1053,9 @@ static void image_prefetch_run(const app_config_t *cfg)
             if (lat == 0.0 && lon == 0.0) { lat = cfg->weather_lat; lon = cfg->weather_lon; }
             moon_state_t live;
             moon_compute(now, lat, lon, &live);
-            uint16_t *img = moon_sphere_render(SCREEN_SIZE, SCREEN_SIZE, &live,
-                                               96, 48, cfg->moon_bg_style);
+            uint16_t *img = moon_render_frame(SCREEN_SIZE, &live, cfg->moon_bg_style,
+                                              0.0f, 0.0f, MOON_LIGHT_TRUE_PHASE,
+                                              FRAME_OWNER_PREFETCH);
             if (img) {
                 if (goes_data_lock(&goes_prefetch_data, 1000)) {
                     goes_prefetch_data.image_buf    = (uint8_t *)img;
@@ -1082,13 +1064,14 @@ static void image_prefetch_run(const app_config_t *cfg)
                     goes_prefetch_data.vflip        = false;
                     goes_prefetch_data.label[0]     = '\0';
                     goes_prefetch_data.src_kind     = 1;   /* Moon */
+                    goes_prefetch_data.image_url[0] = '\0';
                     goes_prefetch_data.error_msg[0] = '\0';
                     goes_prefetch_data.connected    = true;
                     goes_prefetch_data.last_poll_ms = esp_timer_get_time() / 1000;
                     goes_data_unlock(&goes_prefetch_data);
                     err = ESP_OK;
                 } else {
-                    heap_caps_free(img);
+                    frame_pool_release(&g_image_frames, img);
                 }
             }
         }
@@ -1108,6 +1091,8 @@ static void image_prefetch_run(const app_config_t *cfg)
         err = goes_client_poll(cfg->goes_region, &goes_prefetch_data);
     }
 
+    trace_end("image_prefetch");
+
     if (err == ESP_OK) {
         atomic_store(&s_prefetch_ready_src, pf);
         atomic_store(&s_prefetch_ready, true);
@@ -1152,8 +1137,9 @@ void goes_poll_task(void *arg)
          * reader contract (nina_image_display_update locks goes_data, never the
          * prefetch struct). Holding goes_data's lock across the buffer pointer move
          * means the UI reader never sees a torn buffer. After the move the prefetch
-         * struct's image_buf is NULLed so ownership is transferred and a later
-         * prefetch re-mallocs cleanly (no double-free).
+         * struct's image_buf is NULLed and the slot handed to FRAME_OWNER_SOURCE,
+         * so ownership is transferred and a later prefetch acquires a fresh slot
+         * (no double-release).
          *
          * swap_satisfies_eff records whether the swapped-in buffer is the source we
          * are about to display this iteration. If it is, we skip the redundant
@@ -1169,9 +1155,11 @@ void goes_poll_task(void *arg)
                 bool moved = false;
                 if (goes_data_lock(&goes_data, 1000)) {
                     if (goes_data_lock(&goes_prefetch_data, 1000)) {
-                        /* Free the frame being displaced, then move ownership of the
-                         * prefetched frame + its metadata into goes_data. */
-                        if (goes_data.image_buf) heap_caps_free(goes_data.image_buf);
+                        /* Release the frame being displaced, then move ownership of
+                         * the prefetched frame + its metadata into goes_data. */
+                        frame_pool_release(&g_image_frames, goes_data.image_buf);
+                        frame_pool_handoff(&g_image_frames, goes_prefetch_data.image_buf,
+                                           FRAME_OWNER_SOURCE);
                         goes_data.image_buf    = goes_prefetch_data.image_buf;
                         goes_data.image_w      = goes_prefetch_data.image_w;
                         goes_data.image_h      = goes_prefetch_data.image_h;
@@ -1180,6 +1168,7 @@ void goes_poll_task(void *arg)
                         goes_data.connected    = goes_prefetch_data.connected;
                         goes_data.last_poll_ms = esp_timer_get_time() / 1000;
                         strlcpy(goes_data.label, goes_prefetch_data.label, sizeof(goes_data.label));
+                        strlcpy(goes_data.image_url, goes_prefetch_data.image_url, sizeof(goes_data.image_url));
                         goes_data.error_msg[0] = '\0';   /* a successful prefetch clears any stale error */
                         goes_prefetch_data.image_buf = NULL;   /* ownership transferred */
                         goes_data_unlock(&goes_prefetch_data);
@@ -1498,13 +1487,14 @@ void goes_poll_task(void *arg)
                                                                cfg->moon_bg_style, yaw, pitch, light);
                         if (fimg) {
                             if (goes_data_lock(&goes_data, 1000)) {
-                                if (goes_data.image_buf) heap_caps_free(goes_data.image_buf);
+                                frame_pool_release(&g_image_frames, goes_data.image_buf);
                                 goes_data.image_buf = (uint8_t *)fimg;
                                 goes_data.image_w = MOON_DRAG_SZ_TOUCH;
                                 goes_data.image_h = MOON_DRAG_SZ_TOUCH;
                                 goes_data.vflip = false;
                                 goes_data.label[0] = '\0';
                                 goes_data.src_kind = 1;   /* Moon */
+                                goes_data.image_url[0] = '\0';
                                 goes_data.connected = true;
                                 goes_data.last_poll_ms = esp_timer_get_time() / 1000;
                                 goes_data_unlock(&goes_data);
@@ -1513,7 +1503,7 @@ void goes_poll_task(void *arg)
                                     bsp_display_unlock();
                                 }
                             } else {
-                                heap_caps_free(fimg);
+                                frame_pool_release(&g_image_frames, fimg);
                             }
                         }
                     }
@@ -1541,22 +1531,23 @@ void goes_poll_task(void *arg)
                  * home and `continue` so the inner settle loop runs the snap-back +
                  * resting commit exactly as the rubber-band path does. */
                 if (freespin_hold) {
-                    /* One crisp held-orientation frame at native 720. moon_sphere_render_ex
-                     * owns its own PSRAM buffer; update() takes ownership and crossfades. */
+                    /* One crisp held-orientation frame at native 720, rendered into a
+                     * frame slot that goes_data then owns; update() crossfades it. */
                     float hy, hp; moon_drag_get(&hy, &hp);
-                    uint16_t *hold_img = moon_sphere_render_ex(SCREEN_SIZE, SCREEN_SIZE, &live,
-                                                               96, 48, cfg->moon_bg_style,
-                                                               hy, hp, (moon_light_mode_t)cfg->moon_drag_light_mode);
+                    uint16_t *hold_img = moon_render_frame(SCREEN_SIZE, &live, cfg->moon_bg_style,
+                                                           hy, hp, (moon_light_mode_t)cfg->moon_drag_light_mode,
+                                                           FRAME_OWNER_SOURCE);
                     if (hold_img && image_display_page_active && eff_src == 1 &&
                         !moon_drag_active()) {
                         if (goes_data_lock(&goes_data, 1000)) {
-                            if (goes_data.image_buf) heap_caps_free(goes_data.image_buf);
+                            frame_pool_release(&g_image_frames, goes_data.image_buf);
                             goes_data.image_buf = (uint8_t *)hold_img;
                             goes_data.image_w = SCREEN_SIZE;
                             goes_data.image_h = SCREEN_SIZE;
                             goes_data.vflip = false;
                             goes_data.label[0] = '\0';
                             goes_data.src_kind = 1;   /* Moon */
+                            goes_data.image_url[0] = '\0';
                             goes_data.connected = true;
                             goes_data.last_poll_ms = esp_timer_get_time() / 1000;
                             goes_data_unlock(&goes_data);
@@ -1566,10 +1557,10 @@ void goes_poll_task(void *arg)
                                 bsp_display_unlock();
                             }
                         } else {
-                            heap_caps_free(hold_img);
+                            frame_pool_release(&g_image_frames, hold_img);
                         }
                     } else if (hold_img) {
-                        heap_caps_free(hold_img);
+                        frame_pool_release(&g_image_frames, hold_img);
                     }
 
                     /* Sleep-poll the hold window. The configured seconds are read each
@@ -1662,17 +1653,20 @@ void goes_poll_task(void *arg)
                     }
                 }
                 int64_t t0 = esp_timer_get_time();
-                uint16_t *img = moon_sphere_render(MOON_SZ, MOON_SZ, &live, 96, 48, cfg->moon_bg_style);
+                uint16_t *img = moon_render_frame(MOON_SZ, &live, cfg->moon_bg_style,
+                                                  0.0f, 0.0f, MOON_LIGHT_TRUE_PHASE,
+                                                  FRAME_OWNER_SOURCE);
                 ESP_LOGI(TAG, "tgx moon %dx%d render %lld ms", MOON_SZ, MOON_SZ, (esp_timer_get_time()-t0)/1000);
                 if (img) {
                     if (goes_data_lock(&goes_data, 1000)) {
-                        if (goes_data.image_buf) heap_caps_free(goes_data.image_buf);
+                        frame_pool_release(&g_image_frames, goes_data.image_buf);
                         goes_data.image_buf = (uint8_t *)img;
                         goes_data.image_w = MOON_SZ;
                         goes_data.image_h = MOON_SZ;
                         goes_data.vflip = false;
                         goes_data.label[0] = '\0';
                         goes_data.src_kind = 1;   /* Moon */
+                        goes_data.image_url[0] = '\0';
                         goes_data.connected = true;
                         goes_data.last_poll_ms = esp_timer_get_time() / 1000;
                         goes_data_unlock(&goes_data);
@@ -1698,7 +1692,7 @@ void goes_poll_task(void *arg)
                             }
                         }
                     } else {
-                        heap_caps_free(img);
+                        frame_pool_release(&g_image_frames, img);
                     }
                 }
             }
@@ -1756,7 +1750,14 @@ void goes_poll_task(void *arg)
             }
         }
 
+        /* The overlay is only dismissed by a committed frame, so a shown
+         * overlay must not be answered by a 304 that keeps the old one. */
+        if (show_wait) {
+            goes_client_force_full_fetch(&goes_data);
+        }
+
         esp_err_t fetch_err = ESP_OK;
+        trace_begin("image_fetch", eff_src);
         if (eff_src == 3) {                                         /* Custom image URL */
             if (cfg->custom_image_url[0] == '\0') {
                 /* No URL configured: skip the fetch and surface the reason so the
@@ -1787,6 +1788,7 @@ void goes_poll_task(void *arg)
              * manual-fetch overlay instead of leaving it stuck. */
             fetch_err = ESP_FAIL;
         }
+        trace_end("image_fetch");
 
         /* On a failed manual fetch the new image never arrives, so
          * nina_image_display_update() will not hide the overlay — clear it here
@@ -1923,12 +1925,12 @@ void spotify_poll_task(void *arg)
             }
         }
 
-        perf_timer_start(&g_perf.spotify_poll_cycle);
+        perf_span_t spotify_poll_cycle_span = perf_timer_start();
 
         spotify_playback_t pb;
-        perf_timer_start(&g_perf.spotify_api_fetch);
+        perf_span_t spotify_api_fetch_span = perf_timer_start();
         esp_err_t err = spotify_client_get_currently_playing(&pb);
-        perf_timer_stop(&g_perf.spotify_api_fetch);
+        perf_timer_stop(&g_perf.spotify_api_fetch, spotify_api_fetch_span);
         perf_counter_increment(&g_perf.spotify_poll_count);
 
         if (err == ESP_OK) {
@@ -1937,9 +1939,9 @@ void spotify_poll_task(void *arg)
             /* Update text UI immediately so the user sees new track info
              * without waiting for the album art TLS handshake + download. */
             if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
-                perf_timer_start(&g_perf.spotify_ui_update);
+                perf_span_t spotify_ui_update_span = perf_timer_start();
                 nina_spotify_update(&pb);
-                perf_timer_stop(&g_perf.spotify_ui_update);
+                perf_timer_stop(&g_perf.spotify_ui_update, spotify_ui_update_span);
                 bsp_display_unlock();
             }
 
@@ -1958,114 +1960,72 @@ void spotify_poll_task(void *arg)
 
                     uint8_t *jpg_buf = NULL;
                     size_t jpg_size = 0;
-                    perf_timer_start(&g_perf.spotify_art_fetch);
+                    perf_span_t spotify_art_fetch_span = perf_timer_start();
                     bool art_fetch_ok = (spotify_client_fetch_album_art(pb.album_art_url, &jpg_buf, &jpg_size) == ESP_OK
                         && jpg_buf && jpg_size > 0);
-                    perf_timer_stop(&g_perf.spotify_art_fetch);
+                    perf_timer_stop(&g_perf.spotify_art_fetch, spotify_art_fetch_span);
                     perf_counter_increment(&g_perf.spotify_art_fetch_count);
                     if (art_fetch_ok) {
                         /* Strip COM markers that the HW JPEG decoder can't handle */
                         jpg_size = strip_jpeg_com_markers(jpg_buf, jpg_size);
 
-                        /* Hardware JPEG decode to RGB565.
-                         * Buffer always rounded to 16px — the ESP32-P4 HW decoder
-                         * outputs with 16-pixel MCU alignment regardless of subsampling.
-                         * PPA uses actual pic_info dimensions to crop MCU padding. */
-                        perf_timer_start(&g_perf.spotify_art_decode);
-                        jpeg_decode_picture_info_t pic_info = {0};
-                        esp_err_t info_err = jpeg_decoder_get_info(jpg_buf, jpg_size, &pic_info);
-                        if (info_err == ESP_OK && pic_info.width > 0) {
-                            uint32_t out_w = ((pic_info.width + 15) / 16) * 16;
-                            uint32_t out_h = ((pic_info.height + 15) / 16) * 16;
-
-                            jpeg_decode_memory_alloc_cfg_t mem_cfg = {
-                                .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
-                            };
-                            size_t allocated = 0;
-                            uint8_t *rgb_buf = (uint8_t *)jpeg_alloc_decoder_mem(
-                                out_w * out_h * 2, &mem_cfg, &allocated);
-
-                            if (rgb_buf) {
-                                memset(rgb_buf, 0, allocated); /* Zero buffer so PPA edge interpolation reads black, not heap garbage */
-                                jpeg_decoder_handle_t decoder = NULL;
-                                jpeg_decode_engine_cfg_t engine_cfg = {
-                                    .intr_priority = 0, .timeout_ms = 5000
-                                };
-                                esp_err_t dec_err = jpeg_new_decoder_engine(&engine_cfg, &decoder);
-                                if (dec_err == ESP_OK && decoder) {
-                                    jpeg_decode_cfg_t dec_cfg = {
-                                        .output_format = JPEG_DECODE_OUT_FORMAT_RGB565,
-                                        .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
-                                    };
-                                    uint32_t out_size = 0;
-                                    dec_err = jpeg_decoder_process(decoder, &dec_cfg,
-                                        jpg_buf, jpg_size, rgb_buf, allocated, &out_size);
-                                    jpeg_del_decoder_engine(decoder);
-
-                                    if (dec_err == ESP_OK && out_size > 0) {
-                                        /* Pre-scale to 720x720 using PPA hardware to
-                                         * eliminate per-frame LVGL software scaling */
-                                        uint8_t *final_buf = rgb_buf;
-                                        uint32_t final_w = out_w, final_h = out_h;
-                                        size_t final_size = out_size;
-
-                                        if (pic_info.width != 720 || pic_info.height != 720) {
-                                            size_t scaled_size = 0;
-                                            uint8_t *scaled = ppa_scale_rgb565(
-                                                rgb_buf, pic_info.width, pic_info.height,
-                                                out_w, 720, 720, &scaled_size);
-                                            if (scaled) {
-                                                free(rgb_buf);
-                                                final_buf = scaled;
-                                                final_w = 720;
-                                                final_h = 720;
-                                                final_size = scaled_size;
-                                            }
-                                            /* If PPA fails, fall through with original —
-                                             * LVGL will SW-scale as before */
-                                        }
-
-                                        perf_timer_stop(&g_perf.spotify_art_decode);
-
-                                        if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
-                                            nina_spotify_set_album_art(final_buf, final_w, final_h, final_size);
-                                            bsp_display_unlock();
-                                            art_ok = true;
-                                            /* Ownership transferred to UI — don't free final_buf */
-                                        } else {
-                                            /* Lock timed out — free the buffer and leave
-                                             * art_ok false so the art is retried next poll. */
-                                            free(final_buf);
-                                        }
-                                    } else {
-                                        perf_timer_stop(&g_perf.spotify_art_decode);
-                                        ESP_LOGW(TAG, "HW JPEG decode failed, trying SW fallback");
-                                        free(rgb_buf);
-                                        rgb_buf = NULL;
-                                        /* SW fallback (stb_image) — handles CMYK and other unsupported formats */
-                                        goto sw_fallback;
-                                    }
-                                } else {
-                                    perf_timer_stop(&g_perf.spotify_art_decode);
-                                    ESP_LOGW(TAG, "HW decoder engine creation failed, trying SW");
-                                    free(rgb_buf);
-                                    goto sw_fallback;
+                        /* Hardware JPEG decode to RGB565 on the shared engine.
+                         * The frame keeps the decoder's 16px MCU padding;
+                         * PPA uses the picture dimensions to crop it. */
+                        perf_span_t spotify_art_decode_span = perf_timer_start();
+                        jpeg_service_frame_t frame;
+                        esp_err_t dec_err = jpeg_service_decode(jpg_buf, jpg_size, &frame);
+                        if (dec_err == ESP_OK) {
+                            /* Pre-scale to 720x720 using PPA hardware to
+                             * eliminate per-frame LVGL software scaling */
+                            uint8_t *final_buf = NULL;
+                            uint32_t final_w = frame.stride_w, final_h = frame.stride_h;
+                            size_t final_size = frame.out_size;
+
+                            if (frame.width != 720 || frame.height != 720) {
+                                size_t scaled_size = 0;
+                                uint8_t *scaled = ppa_scale_rgb565(
+                                    frame.buf, frame.width, frame.height,
+                                    frame.stride_w, 720, 720, &scaled_size);
+                                if (scaled) {
+                                    jpeg_service_release(&frame);
+                                    final_buf = scaled;
+                                    final_w = 720;
+                                    final_h = 720;
+                                    final_size = scaled_size;
                                 }
+                            }
+                            /* Already 720x720, or PPA failed (LVGL will
+                             * SW-scale as before): keep the decoded frame */
+                            if (!final_buf) {
+                                final_buf = jpeg_service_take(&frame);
+                            }
+
+                            perf_timer_stop(&g_perf.spotify_art_decode, spotify_art_decode_span);
+
+                            if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
+                                nina_spotify_set_album_art(final_buf, final_w, final_h, final_size);
+                                bsp_display_unlock();
+                                art_ok = true;
+                                /* Ownership transferred to UI — don't free final_buf */
                             } else {
-                                perf_timer_stop(&g_perf.spotify_art_decode);
-                                ESP_LOGW(TAG, "HW decoder mem alloc failed, trying SW");
-                                goto sw_fallback;
+                                /* Lock timed out — free the buffer and leave
+                                 * art_ok false so the art is retried next poll. */
+                                free(final_buf);
                             }
                         } else {
-                            perf_timer_stop(&g_perf.spotify_art_decode);
-                        sw_fallback: ;
+                            perf_timer_stop(&g_perf.spotify_art_decode, spotify_art_decode_span);
+                            /* SW fallback (stb_image) — handles CMYK, progressive
+                             * and other formats the HW decoder rejects */
+                            ESP_LOGW(TAG, "HW JPEG decode failed (%s), trying SW fallback",
+                                     esp_err_to_name(dec_err));
                             uint8_t *sw_buf = NULL;
                             uint32_t sw_w = 0, sw_h = 0;
                             size_t sw_size = 0;
-                            perf_timer_start(&g_perf.spotify_art_decode);
+                            perf_span_t spotify_art_decode_span = perf_timer_start();
                             bool sw_ok = jpeg_sw_decode_rgb565(jpg_buf, jpg_size,
                                 &sw_buf, &sw_w, &sw_h, &sw_size);
-                            perf_timer_stop(&g_perf.spotify_art_decode);
+                            perf_timer_stop(&g_perf.spotify_art_decode, spotify_art_decode_span);
                             if (sw_ok && sw_buf) {
                                 uint8_t *final_buf = sw_buf;
                                 uint32_t final_w = sw_w, final_h = sw_h;
@@ -2140,7 +2100,7 @@ void spotify_poll_task(void *arg)
             if (backoff > 30000) backoff = 30000;
             interval = backoff;
         }
-        perf_timer_stop(&g_perf.spotify_poll_cycle);
+        perf_timer_stop(&g_perf.spotify_poll_cycle, spotify_poll_cycle_span);
         vTaskDelay(pdMS_TO_TICKS(interval));
     }
 }
@@ -2190,86 +2150,34 @@ void fetch_worker_task(void *arg) {
             .success = false,
         };
 
+        /* One span per request; arg is the fetch_type_t. */
+        trace_begin("fetch_request", req.type);
         switch (req.type) {
         case FETCH_THUMBNAIL: {
             size_t jpeg_size = 0;
-            perf_timer_start(&g_perf.jpeg_fetch);
+            perf_span_t jpeg_fetch_span = perf_timer_start();
             uint8_t *jpeg_buf = nina_client_fetch_prepared_image(req.url, 720, 720, 70, &jpeg_size);
-            perf_timer_stop(&g_perf.jpeg_fetch);
+            perf_timer_stop(&g_perf.jpeg_fetch, jpeg_fetch_span);
             if (!jpeg_buf || jpeg_size == 0) break;
 
-            jpeg_decode_picture_info_t pic_info = {0};
-            esp_err_t err = jpeg_decoder_get_info(jpeg_buf, jpeg_size, &pic_info);
-            if (err != ESP_OK || pic_info.width == 0 || pic_info.height == 0) {
-                free(jpeg_buf);
-                break;
-            }
-
-            bool is_gray = (pic_info.sample_method == JPEG_DOWN_SAMPLING_GRAY);
-            uint32_t out_w = ((pic_info.width + 15) / 16) * 16;
-            uint32_t out_h = ((pic_info.height + 15) / 16) * 16;
-            uint32_t decode_buf_size = out_w * out_h * (is_gray ? 1 : 2);
-
-            jpeg_decode_memory_alloc_cfg_t mem_cfg = {
-                .buffer_direction = JPEG_DEC_ALLOC_OUTPUT_BUFFER,
-            };
-            size_t allocated_size = 0;
-            uint8_t *decode_buf = (uint8_t *)jpeg_alloc_decoder_mem(decode_buf_size, &mem_cfg, &allocated_size);
-            if (!decode_buf) { free(jpeg_buf); break; }
-            memset(decode_buf, 0, allocated_size); /* Zero buffer so PPA edge interpolation reads black, not heap garbage */
-
-            size_t free_dma = heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
-            if (free_dma < 20 * 1024) {
-                ESP_LOGW(TAG, "Fetch worker: low DMA heap (%d bytes), skipping HW decode", (int)free_dma);
-                free(decode_buf);
-                free(jpeg_buf);
-                break;
-            }
-
-            jpeg_decoder_handle_t decoder = NULL;
-            jpeg_decode_engine_cfg_t engine_cfg = { .intr_priority = 0, .timeout_ms = 5000 };
-            err = jpeg_new_decoder_engine(&engine_cfg, &decoder);
-            if (err != ESP_OK || !decoder) { free(decode_buf); free(jpeg_buf); break; }
-
-            jpeg_decode_cfg_t decode_cfg = {
-                .output_format = is_gray ? JPEG_DECODE_OUT_FORMAT_GRAY : JPEG_DECODE_OUT_FORMAT_RGB565,
-                .rgb_order = JPEG_DEC_RGB_ELEMENT_ORDER_BGR,
-            };
-            uint32_t out_size = 0;
-            perf_timer_start(&g_perf.jpeg_decode);
-            err = jpeg_decoder_process(decoder, &decode_cfg, jpeg_buf, jpeg_size,
-                                       decode_buf, allocated_size, &out_size);
-            perf_timer_stop(&g_perf.jpeg_decode);
-            jpeg_del_decoder_engine(decoder);
-
-            if (err != ESP_OK || out_size == 0) {
-                free(decode_buf);
-                free(jpeg_buf);
+            jpeg_service_frame_t frame;
+            perf_span_t jpeg_decode_span = perf_timer_start();
+            trace_begin("thumbnail_decode", (int32_t)jpeg_size);
+            esp_err_t err = jpeg_service_decode(jpeg_buf, jpeg_size, &frame);
+            trace_end("thumbnail_decode");
+            perf_timer_stop(&g_perf.jpeg_decode, jpeg_decode_span);
+            free(jpeg_buf);
+            if (err != ESP_OK) {
+                ESP_LOGW(TAG, "Fetch worker: thumbnail decode failed: %s", esp_err_to_name(err));
                 break;
             }
 
-            uint8_t *rgb_buf = decode_buf;
-            uint32_t rgb_size = out_size;
-
-            if (is_gray) {
-                uint32_t pixel_count = out_w * out_h;
-                rgb_size = pixel_count * 2;
-                rgb_buf = heap_caps_malloc(rgb_size, MALLOC_CAP_SPIRAM);
-                if (!rgb_buf) { free(decode_buf); free(jpeg_buf); break; }
-                uint16_t *dst = (uint16_t *)rgb_buf;
-                for (uint32_t i = 0; i < pixel_count; i++) {
-                    uint8_t g = decode_buf[i];
-                    dst[i] = ((g >> 3) << 11) | ((g >> 2) << 5) | (g >> 3);
-                }
-                free(decode_buf);
-            }
-
+            /* Ownership passes to the UI with the result */
             result.success = true;
-            result.thumbnail.rgb565_data = rgb_buf;
-            result.thumbnail.w = out_w;
-            result.thumbnail.h = out_h;
-            result.thumbnail.data_size = rgb_size;
-            free(jpeg_buf);
+            result.thumbnail.w = frame.stride_w;
+            result.thumbnail.h = frame.stride_h;
+            result.thumbnail.data_size = frame.out_size;
+            result.thumbnail.rgb565_data = jpeg_service_take(&frame);
             break;
         }
 
@@ -2283,26 +2191,14 @@ void fetch_worker_task(void *arg) {
             break;
 
         case FETCH_GRAPH_HFR:
-            if (hfr_buf) {
+            if (hfr_buf && req.client) {
                 memset(hfr_buf, 0, sizeof(*hfr_buf));
-                fetch_hfr_history(req.url, hfr_buf, req.max_points);
+                fetch_hfr_history(req.url, req.client, hfr_buf, req.max_points);
                 result.success = true;
                 result.data = hfr_buf;
             }
             break;
 
-        case FETCH_GRAPH_HFR_RING:
-            if (hfr_buf && req.client) {
-                memset(hfr_buf, 0, sizeof(*hfr_buf));
-                if (nina_client_lock(req.client, 50)) {
-                    build_hfr_from_ring(req.client, hfr_buf, req.max_points);
-                    nina_client_unlock(req.client);
-                    result.success = true;
-                    result.data = hfr_buf;
-                }
-            }
-            break;
-
         case FETCH_INFO_CAMERA: {
             camera_detail_data_t *cam = heap_caps_calloc(1, sizeof(camera_detail_data_t), MALLOC_CAP_SPIRAM);
             if (cam) {
@@ -2350,6 +2246,8 @@ void fetch_worker_task(void *arg) {
         }
         }
 
+        trace_end("fetch_request");
+
         /* Post result (non-blocking — drop if queue full, next cycle will retry) */
         if (result.success) {
             if (xQueueSend(s_fetch_result_queue, &result, 0) != pdTRUE) {
@@ -2401,7 +2299,7 @@ void data_update_task(void *arg) {
     for (int i = 0; i < MAX_NINA_INSTANCES; i++) {
         nina_poll_state_init(&poll_states[i]);
         nina_client_init_mutex(&instances[i]);
-        /* Allocate per-instance HFR ring buffer in PSRAM (~4 KB per instance) */
+        /* Allocate per-instance HFR store buffers in PSRAM (~4 KB per instance) */
         instances[i].hfr_ring.hfr   = heap_caps_calloc(HFR_RING_SIZE, sizeof(float), MALLOC_CAP_SPIRAM);
         instances[i].hfr_ring.stars = heap_caps_calloc(HFR_RING_SIZE, sizeof(int),   MALLOC_CAP_SPIRAM);
     }
@@ -2451,6 +2349,7 @@ void data_update_task(void *arg) {
          * (a later web-handler enable + page entry would otherwise NULL-deref). */
         goes_data_init(&goes_data);
         goes_data_init(&goes_prefetch_data);
+        goes_prefetch_data.frame_owner = FRAME_OWNER_PREFETCH;
 
         instance_count = app_config_get_instance_count();
         instance_count = 3;  /* demo mode always shows all 3 instance profiles */
@@ -2614,65 +2513,29 @@ boot_update_check_done:
         }
     }
 
-    /* Spawn AllSky poll task (pinned to Core 0, networking) */
+    /* AllSky, JSON Display and Home Assistant run as jobs on the shared poll
+     * scheduler (poll_task.c) rather than tasks of their own. */
     allsky_data_init(&allsky_data);
     if (app_config_get()->allsky_enabled) {
-        StackType_t *as_stack = heap_caps_malloc(6144 * sizeof(StackType_t), MALLOC_CAP_SPIRAM);
-        StaticTask_t *as_tcb = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        if (as_stack && as_tcb) {
-            allsky_task_handle = xTaskCreateStaticPinnedToCore(
-                allsky_poll_task, "allsky", 6144, NULL, 3, as_stack, as_tcb, 0);
-            ESP_LOGI(TAG, "AllSky poll task spawned");
-        } else {
-            ESP_LOGE(TAG, "Failed to allocate AllSky poll task stack");
-            if (as_stack) heap_caps_free(as_stack);
-            if (as_tcb) heap_caps_free(as_tcb);
-        }
+        allsky_spec.wifi_group = s_wifi_event_group;
+        allsky_job = poll_task_add(&allsky_spec, NULL);
     }
 
-    /* JSON Display poll task (pinned to Core 0, networking).
-     * json_data_init runs UNCONDITIONALLY so the mutex exists before any later
-     * web-handler-triggered enable + page entry; the task itself is spawned only
-     * when the page is enabled. */
+    /* json_client_init / ha_client_init run UNCONDITIONALLY so the mutex exists
+     * before any later web-handler-triggered enable + page entry; the jobs
+     * themselves are added only when the page is enabled. */
     json_client_init(&json_data);
-    if (app_config_get()->json_enabled) {
-        StackType_t *js_stack = heap_caps_malloc(10240 * sizeof(StackType_t), MALLOC_CAP_SPIRAM);
-        StaticTask_t *js_tcb = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        if (js_stack && js_tcb) {
-            json_task_handle = xTaskCreateStaticPinnedToCore(
-                json_poll_task, "json", 10240, NULL, 3, js_stack, js_tcb, 0);
-            ESP_LOGI(TAG, "JSON Display poll task spawned");
-        } else {
-            ESP_LOGE(TAG, "Failed to allocate JSON Display poll task stack");
-            if (js_stack) heap_caps_free(js_stack);
-            if (js_tcb) heap_caps_free(js_tcb);
-        }
-    }
+    json_ensure_polling();
 
-    /* Home Assistant poll task (pinned to Core 0, networking).
-     * ha_client_init runs UNCONDITIONALLY so the mutex exists before any later
-     * web-handler-triggered enable + page entry; the task itself is spawned only
-     * when the page is enabled. */
     ha_client_init(&ha_data);
-    if (app_config_get()->ha_enabled) {
-        StackType_t *ha_stack = heap_caps_malloc(10240 * sizeof(StackType_t), MALLOC_CAP_SPIRAM);
-        StaticTask_t *ha_tcb = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-        if (ha_stack && ha_tcb) {
-            ha_task_handle = xTaskCreateStaticPinnedToCore(
-                ha_poll_task, "ha", 10240, NULL, 3, ha_stack, ha_tcb, 0);
-            ESP_LOGI(TAG, "Home Assistant poll task spawned");
-        } else {
-            ESP_LOGE(TAG, "Failed to allocate Home Assistant poll task stack");
-            if (ha_stack) heap_caps_free(ha_stack);
-            if (ha_tcb) heap_caps_free(ha_tcb);
-        }
-    }
+    ha_ensure_polling();
 
     /* GOES / Image Display poll task.
      * goes_data_init must run UNCONDITIONALLY so the mutex exists before any
      * later web-handler-triggered enable + page entry. */
     goes_data_init(&goes_data);
     goes_data_init(&goes_prefetch_data);
+    goes_prefetch_data.frame_owner = FRAME_OWNER_PREFETCH;
     if (app_config_get()->image_display_enabled) {
         goes_ensure_task_running();
     }
@@ -2708,7 +2571,7 @@ main_loop:
             }
             prev_cycle_start = cycle_now;
         }
-        perf_timer_start(&g_perf.poll_cycle_total);
+        perf_span_t poll_cycle_total_span = perf_timer_start();
 
         /* ── Drain async fetch results from Core 0 worker ── */
         {
@@ -2719,8 +2582,10 @@ main_loop:
                     fetch_thumbnail_pending = false;
                     if (fres.success && fres.thumbnail.rgb565_data) {
                         if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
+                            trace_begin("thumbnail_apply", fres.instance_idx);
                             nina_dashboard_set_thumbnail(fres.thumbnail.rgb565_data,
                                 fres.thumbnail.w, fres.thumbnail.h, fres.thumbnail.data_size);
+                            trace_end("thumbnail_apply");
                             bsp_display_unlock();
                             /* Ownership transferred to UI */
                         } else {
@@ -2748,7 +2613,6 @@ main_loop:
                     break;
 
                 case FETCH_GRAPH_HFR:
-                case FETCH_GRAPH_HFR_RING:
                     fetch_graph_pending = false;
                     if (fres.success && fres.data) {
                         if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
@@ -2756,7 +2620,6 @@ main_loop:
                             bsp_display_unlock();
                         }
                     }
-                    if (fres.type == FETCH_GRAPH_HFR) hfr_graph_seeded = true;
                     last_graph_fetch_ms = esp_timer_get_time() / 1000;
                     break;
 
@@ -2881,33 +2744,33 @@ main_loop:
             prev_on_spotify = on_spotify;
             spotify_page_active = on_spotify;
 
-            /* AllSky and Clock flags — wake tasks immediately on page entry */
+            /* AllSky and Clock flags — run their poll jobs immediately on page entry */
             static bool prev_on_allsky = false;
-            if (on_allsky && !prev_on_allsky && allsky_task_handle) {
-                xTaskNotifyGive(allsky_task_handle);
+            if (on_allsky && !prev_on_allsky) {
+                poll_task_kick(allsky_job);
             }
             prev_on_allsky = on_allsky;
             allsky_page_active = on_allsky;
 
-            /* JSON Display flag — wake task immediately on page entry */
+            /* JSON Display flag — run its poll job immediately on page entry */
             static bool prev_on_json = false;
-            if (on_json && !prev_on_json && json_task_handle) {
-                xTaskNotifyGive(json_task_handle);
+            if (on_json && !prev_on_json) {
+                poll_task_kick(json_job);
             }
             prev_on_json = on_json;
             json_page_active = on_json;
 
-            /* Home Assistant flag — wake task immediately on page entry */
+            /* Home Assistant flag — run its poll job immediately on page entry */
             static bool prev_on_ha = false;
-            if (on_ha && !prev_on_ha && ha_task_handle) {
-                xTaskNotifyGive(ha_task_handle);
+            if (on_ha && !prev_on_ha) {
+                poll_task_kick(ha_job);
             }
             prev_on_ha = on_ha;
             ha_page_active = on_ha;
 
             static bool prev_on_clock = false;
             if (on_clock && !prev_on_clock) {
-                weather_client_force_refresh();  /* Wakes weather task via xTaskNotifyGive */
+                weather_client_force_refresh();  /* Kicks the weather poll job */
             }
             prev_on_clock = on_clock;
             clock_page_active = on_clock;
@@ -2927,12 +2790,16 @@ main_loop:
                     bsp_display_unlock();
                 }
                 goes_client_cleanup(&goes_data);
+                /* Give the idle frame slots' PSRAM back to the other pages; the
+                 * next visit refills them on its first frames. */
+                frame_pool_trim(&g_image_frames);
                 moon_render_deinit();   /* release the cached moon texture */
                 /* Free the moon drag-to-rotate render scratch (color/z). The page's
                  * own software-scale copy buffers are freed inside
                  * nina_image_display_cleanup() above, so each side frees only what it
                  * owns — no leak, no double-free. */
                 moon_drag_buffers_free();
+                moon_zbuf_free();
                 /* Reset drag orientation so a visit that ended mid-settle does not
                  * carry a stale s_cur_* into the next visit (which would snap the
                  * disc home on the first frame). */
@@ -3241,16 +3108,16 @@ main_loop:
             for (int j = 0; j < instance_count; j++)
                 locked[j] = nina_client_lock(&instances[j], 15);
 
-            perf_timer_start(&g_perf.ui_update_total);
+            perf_span_t ui_update_total_span = perf_timer_start();
             int64_t lock_start = g_perf.enabled ? esp_timer_get_time() : 0;
             if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
                 if (g_perf.enabled) perf_timer_record(&g_perf.ui_lock_wait, esp_timer_get_time() - lock_start);
-                perf_timer_start(&g_perf.ui_summary_update);
+                perf_span_t ui_summary_update_span = perf_timer_start();
                 summary_page_update(instances, instance_count, locked);
-                perf_timer_stop(&g_perf.ui_summary_update);
+                perf_timer_stop(&g_perf.ui_summary_update, ui_summary_update_span);
                 bsp_display_unlock();
             }
-            perf_timer_stop(&g_perf.ui_update_total);
+            perf_timer_stop(&g_perf.ui_update_total, ui_update_total_span);
 
             for (int j = 0; j < instance_count; j++)
                 if (locked[j]) nina_client_unlock(&instances[j]);
@@ -3262,13 +3129,19 @@ main_loop:
              * for dashboard update + status dot (combined, no separate lock) */
             if (nina_client_lock(&instances[active_nina_idx], 15)) {
 
-                perf_timer_start(&g_perf.ui_update_total);
+                perf_span_t ui_update_total_span = perf_timer_start();
+                trace_begin("ui_update", active_nina_idx);
                 int64_t lock_start2 = g_perf.enabled ? esp_timer_get_time() : 0;
-                if (bsp_display_lock(LVGL_LOCK_TIMEOUT_MS)) {
+                trace_begin("ui_lock_wait", 0);
+                bool ui_locked = bsp_display_lock(LVGL_LOCK_TIMEOUT_MS);
+                trace_end("ui_lock_wait");
+                if (ui_locked) {
                     if (g_perf.enabled) perf_timer_record(&g_perf.ui_lock_wait, esp_timer_get_time() - lock_start2);
-                    perf_timer_start(&g_perf.ui_dashboard_update);
+                    perf_span_t ui_dashboard_update_span = perf_timer_start();
+                    trace_begin("dashboard_redraw", active_nina_idx);
                     update_nina_dashboard_page(active_nina_idx, &instances[active_nina_idx]);
-                    perf_timer_stop(&g_perf.ui_dashboard_update);
+                    trace_end("dashboard_redraw");
+                    perf_timer_stop(&g_perf.ui_dashboard_update, ui_dashboard_update_span);
 
                     // Measure WS-to-UI latency if a recent event was received
                     if (g_perf.enabled && g_perf.last_ws_event_time_us > 0) {
@@ -3284,7 +3157,8 @@ main_loop:
                                                  nina_connection_is_connected(active_nina_idx), true);
                     bsp_display_unlock();
                 }
-                perf_timer_stop(&g_perf.ui_update_total);
+                trace_end("ui_update");
+                perf_timer_stop(&g_perf.ui_update_total, ui_update_total_span);
 
                 nina_client_unlock(&instances[active_nina_idx]);
             }
@@ -3315,11 +3189,6 @@ main_loop:
                 }
             }
 
-            /* Reset HFR graph seed flag when graph is hidden */
-            if (!nina_graph_visible()) {
-                hfr_graph_seeded = false;
-            }
-
             /* Auto-refresh graph at defined interval while visible */
             if (nina_graph_visible() && !nina_graph_requested()) {
                 int64_t now_graph = esp_timer_get_time() / 1000;
@@ -3345,10 +3214,8 @@ main_loop:
 
                     if (gtype == GRAPH_TYPE_RMS) {
                         req.type = FETCH_GRAPH_RMS;
-                    } else if (!hfr_graph_seeded) {
-                        req.type = FETCH_GRAPH_HFR;
                     } else {
-                        req.type = FETCH_GRAPH_HFR_RING;
+                        req.type = FETCH_GRAPH_HFR;
                         req.client = &instances[active_nina_idx];
                     }
 
@@ -3718,7 +3585,7 @@ main_loop:
         }
 
         // ── Perf: End cycle, capture memory, periodic report ──
-        perf_timer_stop(&g_perf.poll_cycle_total);
+        perf_timer_stop(&g_perf.poll_cycle_total, poll_cycle_total_span);
         perf_monitor_capture_memory();
         if (g_perf.enabled) {
             g_perf.data_task_stack_hwm = uxTaskGetStackHighWaterMark(NULL) * sizeof(StackType_t);
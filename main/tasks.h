@@ -58,20 +58,11 @@ void input_task(void *arg);
 /** FreeRTOS task: per-instance NINA data poller (one per configured instance). */
 void instance_poll_task(void *arg);
 
-/** FreeRTOS task: AllSky API poller — polls at allsky_update_interval_s rate. */
-void allsky_poll_task(void *arg);
+/** Add the JSON Display poll job (poll_task.h) if the page is enabled. Safe to call multiple times. */
+void json_ensure_polling(void);
 
-/** FreeRTOS task: JSON Display API poller — polls at json_update_interval_s rate. */
-void json_poll_task(void *arg);
-
-/** Create the JSON Display poll task if it isn't already running. Safe to call multiple times. */
-void json_ensure_task_running(void);
-
-/** FreeRTOS task: Home Assistant API poller — polls at ha_update_interval_s rate. */
-void ha_poll_task(void *arg);
-
-/** Create the Home Assistant poll task if it isn't already running. Safe to call multiple times. */
-void ha_ensure_task_running(void);
+/** Add the Home Assistant poll job (poll_task.h) if the page is enabled. Safe to call multiple times. */
+void ha_ensure_polling(void);
 
 /** Feature poll task handles and page-active flags — defined in tasks.c. */
 extern TaskHandle_t spotify_task_handle;
@@ -117,8 +108,8 @@ extern _Atomic bool moon_anim_request;
  *  Consumed (cleared) once by goes_poll_task via atomic_exchange. */
 extern _Atomic bool image_display_manual_fetch;
 
-/** Weather poll task — spawned by weather_client_start() when location is configured. */
-/* (Task handle is internal to weather_client.c; no extern needed here.) */
+/** Weather polls as a job on the shared poll scheduler — added by weather_client_start(). */
+/* (Job id is internal to weather_client.c; no extern needed here.) */
 
 /** FreeRTOS task: Spotify API poller — fetches currently-playing, album art on track change. */
 void spotify_poll_task(void *arg);
@@ -141,8 +132,7 @@ void data_update_task(void *arg);
 typedef enum {
     FETCH_THUMBNAIL,
     FETCH_GRAPH_RMS,
-    FETCH_GRAPH_HFR,
-    FETCH_GRAPH_HFR_RING,   /* Build from local ring buffer (no HTTP) */
+    FETCH_GRAPH_HFR,        /* From the local HFR store; HTTP only for its first sync */
     FETCH_INFO_CAMERA,
     FETCH_INFO_MOUNT,
     FETCH_INFO_SEQUENCE,
@@ -157,7 +147,7 @@ typedef struct {
     int          instance_idx;     /* NINA instance index */
     char         url[128];         /* API base URL */
     int          max_points;       /* For graph requests */
-    nina_client_t *client;         /* For ring buffer reads (FETCH_GRAPH_HFR_RING) */
+    nina_client_t *client;         /* For HFR store reads (FETCH_GRAPH_HFR) */
 } fetch_request_t;
 
 /** Fetch result — posted to s_fetch_result_queue by fetch worker */
@@ -0,0 +1,145 @@
+/**
+ * @file trace.c
+ * @brief PSRAM timeline trace ring + Chrome trace export. See trace.h.
+ */
+
+#include "trace.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "trace";
+
+/* Chrome groups tracks by process; everything here is one process. */
+#define TRACE_PID 1
+
+/* The slot array (PSRAM). NULL when allocation failed -> tracing disabled.
+ * The head fetch-add stays on the ring header below, in internal RAM. */
+static trace_slot_t *s_slots;
+static trace_ring_t s_ring;
+
+void trace_init(void)
+{
+    if (s_slots) {
+        return;  /* already initialised */
+    }
+
+    s_slots = heap_caps_malloc(TRACE_EVENTS * sizeof(trace_slot_t), MALLOC_CAP_SPIRAM);
+    if (!s_slots) {
+        ESP_LOGW(TAG, "PSRAM alloc of %u bytes failed; tracing disabled",
+                 (unsigned)(TRACE_EVENTS * sizeof(trace_slot_t)));
+        return;
+    }
+    trace_ring_init(&s_ring, s_slots, TRACE_EVENTS);
+
+    ESP_LOGI(TAG, "Trace ring active (%d events, %u KB PSRAM)",
+             TRACE_EVENTS, (unsigned)(TRACE_EVENTS * sizeof(trace_slot_t) / 1024));
+}
+
+static void trace_record(uint8_t phase, const char *name, int32_t arg)
+{
+    if (!s_slots) {
+        return;
+    }
+    trace_event_t ev = {
+        .ts_us = esp_timer_get_time(),
+        .name  = name,
+        /* The TCB address: stable for the task's life, and what the export
+         * matches against uxTaskGetSystemState() to name the track. */
+        .tid   = (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle(),
+        .arg   = arg,
+        .phase = phase,
+        .core  = (uint8_t)xPortGetCoreID(),
+    };
+    trace_ring_record(&s_ring, &ev);
+}
+
+void trace_begin(const char *name, int32_t arg)
+{
+    trace_record(TRACE_PH_BEGIN, name, arg);
+}
+
+void trace_end(const char *name)
+{
+    trace_record(TRACE_PH_END, name, 0);
+}
+
+void trace_instant(const char *name, int32_t arg)
+{
+    trace_record(TRACE_PH_INSTANT, name, arg);
+}
+
+bool trace_open(trace_cursor_t *cur)
+{
+    if (!cur) {
+        return false;
+    }
+    trace_ring_reader_init(cur, s_slots ? &s_ring : NULL);
+    return s_slots != NULL;
+}
+
+size_t trace_read_json(trace_cursor_t *cur, bool *first, char *dst, size_t cap)
+{
+    if (!s_slots || cap < TRACE_RING_JSON_MAX + 1) {
+        return 0;
+    }
+
+    size_t len = 0;
+    trace_event_t ev;
+    while (cap - len >= TRACE_RING_JSON_MAX + 1) {
+        if (!trace_ring_reader_next(cur, &s_ring, &ev)) {
+            break;
+        }
+        size_t sep = *first ? 0 : 1;
+        size_t n = trace_ring_format_json(&ev, TRACE_PID, dst + len + sep, cap - len - sep);
+        if (n == 0) {
+            continue;   /* cannot happen at this capacity */
+        }
+        if (sep) {
+            dst[len] = ',';
+        }
+        len += sep + n;
+        *first = false;
+    }
+    return len;
+}
+
+size_t trace_thread_names_json(bool *first, char *dst, size_t cap)
+{
+    UBaseType_t n = uxTaskGetNumberOfTasks() + 2;   /* headroom for tasks created meanwhile */
+    TaskStatus_t *tasks = heap_caps_malloc(n * sizeof(TaskStatus_t), MALLOC_CAP_SPIRAM);
+    if (!tasks) {
+        return 0;
+    }
+    n = uxTaskGetSystemState(tasks, n, NULL);
+
+    size_t len = 0;
+    for (UBaseType_t i = 0; i < n; i++) {
+        int w = snprintf(dst + len, cap - len,
+                         "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                         "\"tid\":%" PRIu32 ",\"args\":{\"name\":\"%s\"}}",
+                         *first ? "" : ",", TRACE_PID,
+                         (uint32_t)(uintptr_t)tasks[i].xHandle, tasks[i].pcTaskName);
+        if (w < 0 || (size_t)w >= cap - len) {
+            break;
+        }
+        len += (size_t)w;
+        *first = false;
+    }
+    heap_caps_free(tasks);
+    return len;
+}
+
+void trace_clear(void)
+{
+    if (!s_slots) {
+        return;
+    }
+    trace_ring_clear(&s_ring);
+}
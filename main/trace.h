@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file trace.h
+ * @brief Always-on timeline trace recorder, exported as Chrome trace JSON.
+ *
+ * perf_monitor aggregates; this keeps the individual events, so one UI update
+ * can be followed across tasks: the WebSocket event that woke it, the fetch
+ * worker request it queued, the LVGL lock wait and the redraw. Tasks mark
+ * spans with trace_begin()/trace_end() and points with trace_instant(); each
+ * call is a timestamp plus one lock-free slot write into a fixed PSRAM ring
+ * (see trace_ring.h), cheap enough to leave on in normal operation. The
+ * oldest events are overwritten once the ring is full.
+ *
+ * GET /api/trace downloads the ring as Chrome trace-event JSON for
+ * chrome://tracing or ui.perfetto.dev; each FreeRTOS task is one track.
+ *
+ * Names must be string literals (they are stored by pointer). If the PSRAM
+ * allocation fails at init, every call is a no-op.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "trace_ring.h"
+
+/* Ring capacity. 8192 events x 32 B = 256 KB of PSRAM, a few minutes of
+ * normal activity. */
+#define TRACE_EVENTS 8192
+
+/* Read position over the ring; see trace_open(). */
+typedef trace_ring_reader_t trace_cursor_t;
+
+/**
+ * @brief Allocate the PSRAM ring. Call once early in app_main(); on
+ *        allocation failure logs one warning and leaves tracing disabled.
+ */
+void trace_init(void);
+
+/** @brief Start a span named @p name on the calling task. */
+void trace_begin(const char *name, int32_t arg);
+
+/** @brief End the calling task's innermost span; @p name should match its begin. */
+void trace_end(const char *name);
+
+/** @brief Record a point event on the calling task. */
+void trace_instant(const char *name, int32_t arg);
+
+/**
+ * @brief Position @p cur at the oldest event in the ring.
+ * @return false when tracing is disabled (nothing to read).
+ */
+bool trace_open(trace_cursor_t *cur);
+
+/**
+ * @brief Format the next whole events, oldest first, as comma-separated
+ *        Chrome trace-event objects into @p dst.
+ *
+ * Only events recorded before trace_open() are returned. @p first is set by
+ * the caller to true before the first call and tracks whether a separator is
+ * needed.
+ *
+ * @param cap  Capacity of @p dst; at least TRACE_RING_JSON_MAX + 1.
+ * @return Bytes written (no terminator); 0 once the cursor has caught up.
+ */
+size_t trace_read_json(trace_cursor_t *cur, bool *first, char *dst, size_t cap);
+
+/**
+ * @brief Format Chrome "thread_name" metadata for every live task, so each
+ *        track is labelled with its FreeRTOS task name. Same separator
+ *        handling as trace_read_json(); tasks that do not fit are left out.
+ * @return Bytes written (no terminator).
+ */
+size_t trace_thread_names_json(bool *first, char *dst, size_t cap);
+
+/** @brief Hide everything recorded so far from subsequent reads. */
+void trace_clear(void);
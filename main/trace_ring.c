@@ -0,0 +1,131 @@
+/*
+ * trace_ring.c - Lock-free timeline event ring (see trace_ring.h).
+ */
+
+#include "trace_ring.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+bool trace_ring_init(trace_ring_t *r, trace_slot_t *slots, uint32_t n_slots)
+{
+    if (!r || !slots || n_slots < TRACE_RING_MIN_EVENTS || (n_slots & (n_slots - 1)))
+        return false;
+    r->slots = slots;
+    r->n_slots = n_slots;
+    /* Slot seq is live only while its stamp is seq + 1; 0 never matches
+     * inside the first lap. */
+    for (uint32_t i = 0; i < n_slots; i++)
+        atomic_init(&slots[i].stamp, 0);
+    atomic_init(&r->head, 0);
+    atomic_init(&r->floor, 0);
+    return true;
+}
+
+void trace_ring_clear(trace_ring_t *r)
+{
+    if (!r || !r->slots) return;
+    atomic_store_explicit(&r->floor, atomic_load_explicit(&r->head, memory_order_relaxed),
+                          memory_order_relaxed);
+}
+
+void trace_ring_record(trace_ring_t *r, const trace_event_t *ev)
+{
+    if (!r || !r->slots || !ev) return;
+
+    /* Reserve, then make the reservation visible before the slot is touched:
+     * a reader that copied a byte of ours sees the head a lap past its event. */
+    uint32_t seq = atomic_fetch_add_explicit(&r->head, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    trace_slot_t *slot = &r->slots[seq & (r->n_slots - 1)];
+    slot->ev = *ev;
+    atomic_store_explicit(&slot->stamp, seq + 1, memory_order_release);
+}
+
+uint32_t trace_ring_recorded(const trace_ring_t *r)
+{
+    return r && r->slots ? atomic_load_explicit(&r->head, memory_order_relaxed) : 0;
+}
+
+void trace_ring_reader_init(trace_ring_reader_t *rd, const trace_ring_t *r)
+{
+    rd->next = rd->end = rd->lost = 0;
+    if (!r || !r->slots) return;
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+    uint32_t floor = atomic_load_explicit(&r->floor, memory_order_relaxed);
+    rd->next = (head - floor <= r->n_slots) ? floor : head - r->n_slots;
+    rd->end = head;
+}
+
+bool trace_ring_reader_next(trace_ring_reader_t *rd, const trace_ring_t *r,
+                            trace_event_t *out)
+{
+    if (!r || !r->slots) return false;
+
+    while ((int32_t)(rd->end - rd->next) > 0) {
+        uint32_t seq = rd->next;
+        uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (head - seq > r->n_slots) {
+            /* Overwritten while we were reading: skip to the oldest live one. */
+            uint32_t oldest = head - r->n_slots;
+            if ((int32_t)(oldest - rd->end) > 0) oldest = rd->end;
+            rd->lost += oldest - seq;
+            rd->next = oldest;
+            continue;
+        }
+        rd->next++;
+
+        const trace_slot_t *slot = &r->slots[seq & (r->n_slots - 1)];
+        if (atomic_load_explicit(&slot->stamp, memory_order_acquire) != seq + 1) {
+            rd->lost++;     /* reserved but not yet published */
+            continue;
+        }
+        *out = slot->ev;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&r->head, memory_order_relaxed) - seq > r->n_slots) {
+            rd->lost++;     /* a writer a lap ahead reached the slot mid-copy */
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+/* Copy @p name as a JSON string body: escape quote and backslash, drop
+ * control characters, stop at TRACE_RING_NAME_MAX source bytes. */
+static size_t json_name(const char *name, char *dst)
+{
+    size_t n = 0;
+    if (!name) name = "?";
+    for (size_t i = 0; name[i] && i < TRACE_RING_NAME_MAX; i++) {
+        char c = name[i];
+        if ((unsigned char)c < 0x20) continue;
+        if (c == '"' || c == '\\') dst[n++] = '\\';
+        dst[n++] = c;
+    }
+    dst[n] = '\0';
+    return n;
+}
+
+size_t trace_ring_format_json(const trace_event_t *ev, uint32_t pid, char *dst, size_t cap)
+{
+    if (!ev || !dst || cap == 0) return 0;
+
+    char name[2 * TRACE_RING_NAME_MAX + 1];
+    json_name(ev->name, name);
+
+    char ph = (ev->phase == TRACE_PH_BEGIN || ev->phase == TRACE_PH_END)
+                  ? (char)ev->phase : (char)TRACE_PH_INSTANT;
+    int n = snprintf(dst, cap,
+                     "{\"name\":\"%s\",\"ph\":\"%c\",%s\"ts\":%" PRId64
+                     ",\"pid\":%" PRIu32 ",\"tid\":%" PRIu32
+                     ",\"args\":{\"core\":%u,\"v\":%" PRId32 "}}",
+                     name, ph, ph == TRACE_PH_INSTANT ? "\"s\":\"t\"," : "",
+                     ev->ts_us, pid, ev->tid, (unsigned)ev->core, ev->arg);
+    if (n < 0 || (size_t)n >= cap) {
+        dst[0] = '\0';
+        return 0;
+    }
+    return (size_t)n;
+}
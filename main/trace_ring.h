@@ -0,0 +1,115 @@
+/*
+ * trace_ring.h - Pure, host-testable lock-free ring of timeline events behind
+ * trace.c.
+ *
+ * perf_monitor only keeps aggregates, which cannot show how one WebSocket
+ * event, the fetch it triggers, the LVGL lock wait and the redraw line up.
+ * This ring keeps the individual events instead: each is a fixed-size slot
+ * holding a phase (begin / end / instant), a microsecond timestamp, the
+ * recording task and core, an integer argument and a name pointer. Names are
+ * string literals, stored by pointer, so recording an event formats nothing.
+ *
+ * Writers reserve a slot with a single atomic fetch-add on the head sequence
+ * number, fill it and publish it with a release store of its stamp (sequence
+ * number + 1), so any number of tasks on either core record without a lock.
+ * When the ring is full the oldest events are overwritten. Readers never block
+ * writers: an event is copied out and then discarded if the head moved a full
+ * lap past it during the copy.
+ *
+ * trace_ring_format_json() renders one event as a Chrome trace-event object
+ * ("B"/"E"/"i" phases), so the ring can be exported for chrome://tracing or
+ * Perfetto.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACE_RING_MIN_EVENTS 16
+#define TRACE_RING_JSON_MAX   320   /* longest formatted event, '\0' included */
+#define TRACE_RING_NAME_MAX   64    /* longer names are truncated in the JSON */
+
+/* Chrome trace-event phases. */
+typedef enum {
+    TRACE_PH_BEGIN   = 'B',
+    TRACE_PH_END     = 'E',
+    TRACE_PH_INSTANT = 'i',
+} trace_phase_t;
+
+/* One event as copied out of the ring. */
+typedef struct {
+    int64_t     ts_us;
+    const char *name;           /* string literal */
+    uint32_t    tid;            /* recording task (any stable per-task id) */
+    int32_t     arg;
+    uint8_t     phase;          /* trace_phase_t */
+    uint8_t     core;
+} trace_event_t;
+
+typedef struct {
+    _Atomic uint32_t stamp;     /* sequence number + 1 once published */
+    trace_event_t    ev;
+} trace_slot_t;
+
+typedef struct {
+    trace_slot_t    *slots;     /* caller-owned */
+    uint32_t         n_slots;   /* power of two */
+    _Atomic uint32_t head;      /* sequence number of the next free slot */
+    _Atomic uint32_t floor;     /* events before this were cleared */
+} trace_ring_t;
+
+/* Reads the events that were in the ring when it was opened, oldest first. */
+typedef struct {
+    uint32_t next;
+    uint32_t end;
+    uint32_t lost;              /* overwritten or unpublished while reading */
+} trace_ring_reader_t;
+
+/*
+ * Set up @p r over @p slots. @p n_slots must be a power of two of at least
+ * TRACE_RING_MIN_EVENTS; returns false otherwise.
+ */
+bool trace_ring_init(trace_ring_t *r, trace_slot_t *slots, uint32_t n_slots);
+
+/* Hide everything recorded so far from readers that start afterwards. */
+void trace_ring_clear(trace_ring_t *r);
+
+/* Append one event. @p ev->name must outlive the ring (a string literal). */
+void trace_ring_record(trace_ring_t *r, const trace_event_t *ev);
+
+/* Events recorded since init (including overwritten and cleared ones). */
+uint32_t trace_ring_recorded(const trace_ring_t *r);
+
+void trace_ring_reader_init(trace_ring_reader_t *rd, const trace_ring_t *r);
+
+/*
+ * Copy the next event into @p out. Returns false once the reader reaches the
+ * head as it was at init; events recorded after that are left for the next
+ * reader.
+ */
+bool trace_ring_reader_next(trace_ring_reader_t *rd, const trace_ring_t *r,
+                            trace_event_t *out);
+
+/*
+ * Format @p ev as one Chrome trace-event JSON object (no separator) into
+ * @p dst, NUL-terminated. @p pid is the trace's process id. Returns the
+ * length, or 0 when it does not fit in @p cap.
+ */
+size_t trace_ring_format_json(const trace_event_t *ev, uint32_t pid, char *dst, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RING_H */
@@ -0,0 +1,103 @@
+/**
+ * @file font_glyph_cache.c
+ * @brief Decode-once PSRAM glyph cache for the compressed fonts. See font_glyph_cache.h.
+ */
+
+#include "font_glyph_cache.h"
+#include "glyph_rle.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "glyph_cache";
+
+static glyph_cache_t s_cache;
+static SemaphoreHandle_t s_lock;
+
+static void *psram_alloc(size_t bytes)
+{
+    return heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+}
+
+void font_glyph_cache_init(void)
+{
+    if (s_lock) {
+        return;
+    }
+    glyph_cache_init(&s_cache, FONT_GLYPH_CACHE_BYTES, psram_alloc, heap_caps_free);
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        ESP_LOGW(TAG, "No memory for glyph cache lock; fonts decode on every draw");
+    }
+}
+
+const void *font_glyph_cache_get_bitmap(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf)
+{
+    const lv_font_t *font = g_dsc->resolved_font;
+    const lv_font_fmt_txt_dsc_t *fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = g_dsc->gid.index;
+
+    if (!s_lock || !draw_buf || gid == 0 || fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN
+        || !glyph_rle_bpp_supported(fdsc->bpp)) {
+        return lv_font_get_bitmap_fmt_txt(g_dsc, draw_buf);
+    }
+
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    uint16_t w = gdsc->box_w;
+    uint16_t h = gdsc->box_h;
+    if ((size_t)w * h == 0) {
+        return NULL;
+    }
+
+    bool copied = false;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    const uint8_t *a8 = glyph_cache_get(&s_cache, font, gid);
+    if (!a8) {
+        uint8_t *slot = glyph_cache_put(&s_cache, font, gid, (size_t)w * h);
+        if (slot) {
+            glyph_rle_decode(&fdsc->glyph_bitmap[gdsc->bitmap_index], slot, w, h, fdsc->bpp,
+                             fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED);
+            a8 = slot;
+        }
+    }
+    if (a8) {
+        /* Copy out under the lock: the entry may be evicted by the next draw. */
+        uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+        uint8_t *out = draw_buf->data;
+        for (uint16_t y = 0; y < h; y++) {
+            memcpy(out, a8, w);
+            out += stride;
+            a8 += w;
+        }
+        copied = true;
+    }
+    xSemaphoreGive(s_lock);
+
+    return copied ? draw_buf : lv_font_get_bitmap_fmt_txt(g_dsc, draw_buf);
+}
+
+void font_glyph_cache_clear(void)
+{
+    if (!s_lock) {
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    glyph_cache_clear(&s_cache);
+    xSemaphoreGive(s_lock);
+}
+
+void font_glyph_cache_get_stats(glyph_cache_stats_t *out)
+{
+    if (!s_lock) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    glyph_cache_get_stats(&s_cache, out);
+    xSemaphoreGive(s_lock);
+}
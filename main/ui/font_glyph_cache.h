@@ -0,0 +1,35 @@
+#pragma once
+
+/**
+ * @file font_glyph_cache.h
+ * @brief get_glyph_bitmap hook for the compressed display fonts.
+ *
+ * The large fonts in main/ui keep their glyphs compressed in flash
+ * (compress_fonts.py) and name font_glyph_cache_get_bitmap as their
+ * get_glyph_bitmap callback. The first draw of a glyph decodes it
+ * (glyph_rle.h) into an A8 bitmap in PSRAM; later draws copy that bitmap
+ * straight into LVGL's draw buffer. Decoded bitmaps live in a glyph_cache_t
+ * bounded to FONT_GLYPH_CACHE_BYTES, least recently used evicted first.
+ *
+ * Until font_glyph_cache_init() has run, or when a glyph cannot be cached
+ * (bigger than the budget, out of PSRAM), the hook falls back to LVGL's own
+ * lv_font_get_bitmap_fmt_txt(), which decodes the same format on every draw
+ * (CONFIG_LV_USE_FONT_COMPRESSED).
+ */
+
+#include "lvgl.h"
+#include "glyph_cache.h"
+
+/** PSRAM budget for decoded glyphs -- every clock digit plus headroom. */
+#define FONT_GLYPH_CACHE_BYTES (256 * 1024)
+
+/** Create the cache and its lock. Call once before the display starts. */
+void font_glyph_cache_init(void);
+
+/** lv_font_t.get_glyph_bitmap for the compressed fonts. */
+const void *font_glyph_cache_get_bitmap(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf);
+
+/** Free every decoded glyph; each is decoded again on its next draw. */
+void font_glyph_cache_clear(void);
+
+void font_glyph_cache_get_stats(glyph_cache_stats_t *out);
@@ -0,0 +1,116 @@
+/**
+ * @file glyph_cache.c
+ * @brief Bounded LRU of decoded glyph bitmaps. See glyph_cache.h.
+ */
+
+#include "glyph_cache.h"
+
+#include <string.h>
+
+void glyph_cache_init(glyph_cache_t *c, size_t budget,
+                      glyph_cache_alloc_fn alloc, glyph_cache_free_fn free_fn)
+{
+    memset(c, 0, sizeof(*c));
+    c->budget = budget;
+    c->alloc = alloc;
+    c->free = free_fn;
+}
+
+const uint8_t *glyph_cache_get(glyph_cache_t *c, const void *font, uint32_t gid)
+{
+    for (int i = 0; i < GLYPH_CACHE_MAX_ENTRIES; i++) {
+        glyph_cache_entry_t *e = &c->entry[i];
+        if (e->font && e->font == font && e->gid == gid) {
+            e->last_use = ++c->tick;
+            c->hits++;
+            return e->bitmap;
+        }
+    }
+    c->misses++;
+    return NULL;
+}
+
+static void evict(glyph_cache_t *c, glyph_cache_entry_t *e)
+{
+    c->free(e->bitmap);
+    c->used -= e->bytes;
+    memset(e, 0, sizeof(*e));
+    c->evictions++;
+}
+
+/* Least recently used entry in use, or NULL when the cache is empty. */
+static glyph_cache_entry_t *oldest(glyph_cache_t *c)
+{
+    glyph_cache_entry_t *lru = NULL;
+    for (int i = 0; i < GLYPH_CACHE_MAX_ENTRIES; i++) {
+        glyph_cache_entry_t *e = &c->entry[i];
+        if (e->font && (!lru || e->last_use < lru->last_use)) {
+            lru = e;
+        }
+    }
+    return lru;
+}
+
+static glyph_cache_entry_t *free_entry(glyph_cache_t *c)
+{
+    for (int i = 0; i < GLYPH_CACHE_MAX_ENTRIES; i++) {
+        if (!c->entry[i].font) {
+            return &c->entry[i];
+        }
+    }
+    return NULL;
+}
+
+uint8_t *glyph_cache_put(glyph_cache_t *c, const void *font, uint32_t gid, size_t bytes)
+{
+    if (!font || bytes == 0 || bytes > c->budget) {
+        return NULL;
+    }
+    while (c->used + bytes > c->budget) {
+        evict(c, oldest(c));
+    }
+    glyph_cache_entry_t *e = free_entry(c);
+    if (!e) {
+        e = oldest(c);
+        evict(c, e);
+    }
+
+    uint8_t *bitmap = c->alloc(bytes);
+    if (!bitmap) {
+        return NULL;
+    }
+    e->font = font;
+    e->gid = gid;
+    e->bytes = (uint32_t)bytes;
+    e->last_use = ++c->tick;
+    e->bitmap = bitmap;
+    c->used += bytes;
+    return bitmap;
+}
+
+void glyph_cache_clear(glyph_cache_t *c)
+{
+    for (int i = 0; i < GLYPH_CACHE_MAX_ENTRIES; i++) {
+        glyph_cache_entry_t *e = &c->entry[i];
+        if (e->font) {
+            c->free(e->bitmap);
+            memset(e, 0, sizeof(*e));
+        }
+    }
+    c->used = 0;
+}
+
+void glyph_cache_get_stats(const glyph_cache_t *c, glyph_cache_stats_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->hits = c->hits;
+    out->misses = c->misses;
+    out->evictions = c->evictions;
+    out->bytes_used = c->used;
+    out->budget = c->budget;
+    for (int i = 0; i < GLYPH_CACHE_MAX_ENTRIES; i++) {
+        if (c->entry[i].font) {
+            out->entries++;
+        }
+    }
+}
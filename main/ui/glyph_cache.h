@@ -0,0 +1,85 @@
+#pragma once
+
+/**
+ * @file glyph_cache.h
+ * @brief Bounded LRU of decoded glyph bitmaps, keyed by (font, glyph id).
+ *
+ * Compressed glyphs (glyph_rle.h) cost a full decode each time LVGL asks for
+ * them, and the clock and dashboard redraw the same few large digits over
+ * and over. The cache keeps each decoded bitmap after its first draw, up to
+ * a byte budget and GLYPH_CACHE_MAX_ENTRIES glyphs; when either would be
+ * exceeded the least recently used glyphs are freed first. A glyph larger
+ * than the whole budget is never cached.
+ *
+ * Not thread-safe: the caller serialises access (font_glyph_cache.c holds a
+ * mutex, since LVGL renders labels on more than one draw unit).
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host). The allocator is supplied
+ * by the caller.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLYPH_CACHE_MAX_ENTRIES 128
+
+typedef void *(*glyph_cache_alloc_fn)(size_t bytes);
+typedef void  (*glyph_cache_free_fn)(void *p);
+
+typedef struct {
+    const void *font;           /* NULL = empty entry */
+    uint32_t    gid;
+    uint32_t    bytes;
+    uint64_t    last_use;
+    uint8_t    *bitmap;
+} glyph_cache_entry_t;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    int      entries;
+    size_t   bytes_used;
+    size_t   budget;
+} glyph_cache_stats_t;
+
+typedef struct {
+    glyph_cache_entry_t  entry[GLYPH_CACHE_MAX_ENTRIES];
+    size_t               budget;
+    size_t               used;
+    uint64_t             tick;
+    glyph_cache_alloc_fn alloc;
+    glyph_cache_free_fn  free;
+    uint32_t             hits;
+    uint32_t             misses;
+    uint32_t             evictions;
+} glyph_cache_t;
+
+/** Empty cache holding at most @p budget bytes of bitmaps. */
+void glyph_cache_init(glyph_cache_t *c, size_t budget,
+                      glyph_cache_alloc_fn alloc, glyph_cache_free_fn free_fn);
+
+/** Cached bitmap of (@p font, @p gid) marked most recently used, or NULL. */
+const uint8_t *glyph_cache_get(glyph_cache_t *c, const void *font, uint32_t gid);
+
+/**
+ * Allocate a @p bytes buffer for (@p font, @p gid), evicting least recently
+ * used glyphs as needed; the caller fills it before the next call. Returns
+ * NULL when @p bytes exceeds the budget or the allocation fails (nothing is
+ * cached then). The glyph must not already be cached.
+ */
+uint8_t *glyph_cache_put(glyph_cache_t *c, const void *font, uint32_t gid, size_t bytes);
+
+/** Free every cached bitmap. Counters are kept. */
+void glyph_cache_clear(glyph_cache_t *c);
+
+void glyph_cache_get_stats(const glyph_cache_t *c, glyph_cache_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
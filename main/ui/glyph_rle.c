@@ -0,0 +1,114 @@
+/**
+ * @file glyph_rle.c
+ * @brief lv_font_conv compressed glyph decoder. See glyph_rle.h.
+ */
+
+#include "glyph_rle.h"
+
+#define RLE_REPEAT_BITS   11   /* 1-bits before the repeat counter follows */
+#define RLE_COUNTER_BITS  6
+
+typedef struct {
+    const uint8_t *in;
+    uint32_t pos;              /* bit position */
+} bit_reader_t;
+
+/* Read @p len (1..8) bits MSB first. Only touches the next byte when the
+ * field actually crosses into it, so the last glyph never reads past the
+ * end of the font's bitmap array. */
+static inline uint8_t read_bits(bit_reader_t *r, uint8_t len)
+{
+    uint32_t byte = r->pos >> 3;
+    uint32_t off = r->pos & 7;
+    uint32_t v = (uint32_t)r->in[byte] << 8;
+    if (off + len > 8) {
+        v |= r->in[byte + 1];
+    }
+    r->pos += len;
+    return (uint8_t)((v >> (16 - off - len)) & ((1u << len) - 1));
+}
+
+static const uint8_t *opa_table(uint8_t bpp)
+{
+    static const uint8_t opa1[2] = { 0, 255 };
+    static const uint8_t opa2[4] = { 0, 85, 170, 255 };
+    static const uint8_t opa4[16] = {
+        0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+    };
+    switch (bpp) {
+        case 1: return opa1;
+        case 2: return opa2;
+        case 4: return opa4;
+        default: return NULL;   /* 8 bpp is already opacity */
+    }
+}
+
+bool glyph_rle_bpp_supported(uint8_t bpp)
+{
+    return bpp == 1 || bpp == 2 || bpp == 4 || bpp == 8;
+}
+
+size_t glyph_rle_decode(const uint8_t *in, uint8_t *out, uint16_t w, uint16_t h,
+                        uint8_t bpp, bool prefilter)
+{
+    size_t count = (size_t)w * h;
+    if (count == 0 || !glyph_rle_bpp_supported(bpp)) {
+        return 0;
+    }
+
+    /* Same state machine as LVGL's own decompress() in lv_font_fmt_txt.c. */
+    enum { SINGLE, REPEAT, COUNTER } state = SINGLE;
+    bit_reader_t r = { in, 0 };
+    uint8_t prev = 0;
+    uint32_t cnt = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t v;
+        if (state == SINGLE) {
+            v = read_bits(&r, bpp);
+            if (i != 0 && v == prev) {
+                cnt = 0;
+                state = REPEAT;
+            }
+            prev = v;
+        } else if (state == REPEAT) {
+            cnt++;
+            if (read_bits(&r, 1)) {
+                v = prev;
+                if (cnt == RLE_REPEAT_BITS) {
+                    cnt = read_bits(&r, RLE_COUNTER_BITS);
+                    if (cnt != 0) {
+                        state = COUNTER;
+                    } else {
+                        v = prev = read_bits(&r, bpp);
+                        state = SINGLE;
+                    }
+                }
+            } else {
+                v = prev = read_bits(&r, bpp);
+                state = SINGLE;
+            }
+        } else {
+            if (--cnt == 0) {
+                v = prev = read_bits(&r, bpp);
+                state = SINGLE;
+            } else {
+                v = prev;
+            }
+        }
+        out[i] = v;
+    }
+
+    if (prefilter) {
+        for (size_t i = w; i < count; i++) {
+            out[i] ^= out[i - w];
+        }
+    }
+    const uint8_t *opa = opa_table(bpp);
+    if (opa) {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = opa[out[i]];
+        }
+    }
+    return (r.pos + 7) >> 3;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @file glyph_rle.h
+ * @brief Decoder for lv_font_conv's compressed glyph bitmaps.
+ *
+ * The big display fonts (playfair 228/90, montserrat 64, overpass 27, the
+ * 128 px warning icon) are stored compressed -- see compress_fonts.py -- the
+ * way lv_font_conv writes them without --no-compress: each row XORed with the
+ * row above, then run-length coded. A value read twice in a row switches to
+ * repeat mode, where each 1-bit repeats it again; the 11th 1-bit is followed
+ * by a 6-bit counter of further repeats, and a 0-bit (or the counter running
+ * out) is followed by the next value. Bits are read MSB first.
+ *
+ * glyph_rle_decode() expands one glyph straight to A8 opacity (0..255, one
+ * byte per pixel, stride == width), which is what LVGL's software renderer
+ * draws from. font_glyph_cache.c calls it once per glyph and keeps the result.
+ *
+ * No ESP-IDF or LVGL dependencies; standard C only so the module can be
+ * compiled unmodified into the host test suite (test/host).
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** True for the bit depths glyph_rle_decode() handles (1, 2, 4, 8). */
+bool glyph_rle_bpp_supported(uint8_t bpp);
+
+/**
+ * Decode a @p w x @p h glyph from @p in into @p out (w * h bytes of A8).
+ * @p prefilter is true for LV_FONT_FMT_TXT_COMPRESSED and false for
+ * LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER. Returns the number of input bytes
+ * the glyph occupied, or 0 for an empty glyph or an unsupported @p bpp.
+ */
+size_t glyph_rle_decode(const uint8_t *in, uint8_t *out, uint16_t w, uint16_t h,
+                        uint8_t bpp, bool prefilter);
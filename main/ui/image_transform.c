@@ -0,0 +1,191 @@
+/**
+ * @file image_transform.c
+ * @brief Single-pass crop / caption-mask / flip / rotate. See image_transform.h.
+ */
+
+#include "image_transform.h"
+
+#include <string.h>
+
+/* v = x * X + y * Y + c over destination coordinates (X, Y). */
+typedef struct {
+    int32_t x, y, c;
+} lin_t;
+
+static lin_t lin(int32_t x, int32_t y, int32_t c)
+{
+    lin_t l = { x, y, c };
+    return l;
+}
+
+/* k - v */
+static lin_t lin_rev(int32_t k, lin_t v)
+{
+    return lin(-v.x, -v.y, k - v.c);
+}
+
+/* Destination interval [*lo, *hi) of the axis coordinate T, within [0, n),
+ * where v = s * T + c (s = +-1) falls in [v_lo, v_hi). */
+static void lin_range(int32_t s, int32_t c, int32_t v_lo, int32_t v_hi, int32_t n,
+                      int32_t *lo, int32_t *hi)
+{
+    int32_t a, b;
+    if (s > 0) {
+        a = v_lo - c;
+        b = v_hi - c;
+    } else {
+        a = c - v_hi + 1;
+        b = c - v_lo + 1;
+    }
+    if (a < 0) a = 0;
+    if (b > n) b = n;
+    *lo = a;
+    *hi = b > a ? b : a;
+}
+
+bool image_transform_plan(const image_transform_t *t, image_transform_plan_t *p)
+{
+    if (!t || !p || !t->src || t->orient > 3) return false;
+    if (t->crop_w == 0 || t->crop_h == 0 ||
+        (uint32_t)t->crop_x + t->crop_w > t->src_w ||
+        (uint32_t)t->crop_y + t->crop_h > t->src_h) {
+        return false;
+    }
+    memset(p, 0, sizeof(*p));
+    p->src = t->src;
+
+    int32_t w = t->crop_w, h = t->crop_h;
+    bool transpose = (t->orient == 1 || t->orient == 3);
+    p->dst_w = (uint16_t)(transpose ? h : w);
+    p->dst_h = (uint16_t)(transpose ? w : h);
+
+    /* Rotation: destination -> flipped-frame coordinates (fx, fy). */
+    lin_t fx, fy;
+    switch (t->orient) {
+    case 0:  fx = lin(1, 0, 0);  fy = lin(0, 1, 0);           break;
+    case 1:  fx = lin(0, 1, 0);  fy = lin(-1, 0, h - 1);      break;
+    case 2:  fx = lin(-1, 0, w - 1); fy = lin(0, -1, h - 1);  break;
+    default: fx = lin(0, -1, w - 1); fy = lin(1, 0, 0);       break;
+    }
+
+    /* Flips -> cropped-frame coordinates, crop -> upright source coordinates. */
+    lin_t ux = t->hflip ? lin_rev(w - 1, fx) : fx;
+    lin_t uy = t->vflip ? lin_rev(h - 1, fy) : fy;
+    ux.c += t->crop_x;
+    uy.c += t->crop_y;
+
+    /* Stored source row. */
+    lin_t sy = t->src_vflip ? lin_rev(t->src_h - 1, uy) : uy;
+
+    int32_t sw = t->src_w;
+    p->step_x = sy.x * sw + ux.x;
+    p->step_y = sy.y * sw + ux.y;
+    p->base   = sy.c * sw + ux.c;
+
+    if (t->mask_on && t->mask_x1 > t->mask_x0 && t->mask_y1 > t->mask_y0) {
+        /* ux and uy each follow exactly one destination axis, so the mask is
+         * a destination rectangle. */
+        int32_t x0, x1, y0, y1;
+        int32_t ax_lo, ax_hi, ay_lo, ay_hi;   /* ranges along the axis ux follows, then uy */
+        int32_t ux_n = ux.x ? p->dst_w : p->dst_h;
+        int32_t uy_n = uy.x ? p->dst_w : p->dst_h;
+        lin_range(ux.x ? ux.x : ux.y, ux.c, t->mask_x0, t->mask_x1, ux_n, &ax_lo, &ax_hi);
+        lin_range(uy.x ? uy.x : uy.y, uy.c, t->mask_y0, t->mask_y1, uy_n, &ay_lo, &ay_hi);
+        if (ux.x) {
+            x0 = ax_lo; x1 = ax_hi; y0 = ay_lo; y1 = ay_hi;
+        } else {
+            x0 = ay_lo; x1 = ay_hi; y0 = ax_lo; y1 = ax_hi;
+        }
+        if (x1 > x0 && y1 > y0) {
+            p->mask = true;
+            p->mask_x0 = (uint16_t)x0;
+            p->mask_x1 = (uint16_t)x1;
+            p->mask_y0 = (uint16_t)y0;
+            p->mask_y1 = (uint16_t)y1;
+            p->mask_step_x = sy.x * sw;
+            p->mask_step_y = sy.y * sw;
+            p->mask_base   = sy.c * sw + t->mask_sample_x;
+        }
+    }
+
+    /* Source block read by the main map: its lowest-index corner. */
+    int32_t lo = p->base;
+    int32_t corners[3] = {
+        p->base + (p->dst_w - 1) * p->step_x,
+        p->base + (p->dst_h - 1) * p->step_y,
+        p->base + (p->dst_w - 1) * p->step_x + (p->dst_h - 1) * p->step_y,
+    };
+    for (int i = 0; i < 3; i++) {
+        if (corners[i] < lo) lo = corners[i];
+    }
+    p->block_x = (uint16_t)(lo % sw);
+    p->block_y = (uint16_t)(lo / sw);
+
+    if (p->mask) {
+        p->kind = IMAGE_TRANSFORM_GENERAL;
+    } else if (p->step_x == 1 && p->step_y == sw) {
+        p->kind = IMAGE_TRANSFORM_COPY;
+    } else if (p->step_x == -1 && p->step_y == -sw) {
+        p->kind = IMAGE_TRANSFORM_ROT180;
+    } else {
+        p->kind = IMAGE_TRANSFORM_GENERAL;
+    }
+    return true;
+}
+
+static void run_seg(const uint16_t *src, uint16_t *d, int32_t i, int32_t step, uint32_t n)
+{
+    if (step == 1) {
+        memcpy(d, src + i, n * sizeof(uint16_t));
+        return;
+    }
+    for (uint32_t x = 0; x < n; x++, i += step) {
+        d[x] = src[i];
+    }
+}
+
+/* Destination row Y, columns [x0, x1). */
+static void run_span(const image_transform_plan_t *p, uint16_t *drow,
+                     uint32_t Y, uint32_t x0, uint32_t x1)
+{
+    uint32_t m0 = x1, m1 = x1;
+    if (p->mask && Y >= p->mask_y0 && Y < p->mask_y1) {
+        m0 = p->mask_x0 > x0 ? p->mask_x0 : x0;
+        m1 = p->mask_x1 < x1 ? p->mask_x1 : x1;
+        if (m0 >= m1) m0 = m1 = x1;
+    }
+
+    int32_t row = p->base + (int32_t)Y * p->step_y;
+    run_seg(p->src, drow + x0, row + (int32_t)x0 * p->step_x, p->step_x, m0 - x0);
+    if (m1 > m0) {
+        int32_t mrow = p->mask_base + (int32_t)Y * p->mask_step_y;
+        run_seg(p->src, drow + m0, mrow + (int32_t)m0 * p->mask_step_x, p->mask_step_x, m1 - m0);
+        run_seg(p->src, drow + m1, row + (int32_t)m1 * p->step_x, p->step_x, x1 - m1);
+    }
+}
+
+void image_transform_apply(const image_transform_plan_t *p, uint16_t *dst)
+{
+    if (!p || !dst) return;
+    uint32_t dw = p->dst_w, dh = p->dst_h;
+
+    /* Row-major maps read the source sequentially (forwards or backwards). */
+    if (p->step_x == 1 || p->step_x == -1) {
+        for (uint32_t Y = 0; Y < dh; Y++) {
+            run_span(p, dst + (size_t)Y * dw, Y, 0, dw);
+        }
+        return;
+    }
+
+    /* Transposing maps: each destination row walks a source column, so work
+     * in tiles whose source footprint (TILE rows x TILE pixels) stays cached. */
+    for (uint32_t ty = 0; ty < dh; ty += IMAGE_TRANSFORM_TILE) {
+        uint32_t ty1 = ty + IMAGE_TRANSFORM_TILE < dh ? ty + IMAGE_TRANSFORM_TILE : dh;
+        for (uint32_t tx = 0; tx < dw; tx += IMAGE_TRANSFORM_TILE) {
+            uint32_t tx1 = tx + IMAGE_TRANSFORM_TILE < dw ? tx + IMAGE_TRANSFORM_TILE : dw;
+            for (uint32_t Y = ty; Y < ty1; Y++) {
+                run_span(p, dst + (size_t)Y * dw, Y, tx, tx1);
+            }
+        }
+    }
+}
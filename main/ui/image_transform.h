@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file image_transform.h
+ * @brief Single-pass crop / caption-mask / flip / rotate for RGB565 frames.
+ *
+ * The image display page used to build each frame in several full-buffer
+ * passes (cropped copy with mask, vflip row swap, hflip, then a rotation into
+ * a second buffer). Every one of those steps maps a destination pixel to a
+ * source pixel by a ±1 / ±stride step along each axis, so the whole chain
+ * composes into one affine index map: src[base + X * step_x + Y * step_y].
+ * image_transform_plan() builds that map (plus a second one for the caption
+ * mask, whose pixels all sample a fixed source column) and
+ * image_transform_apply() writes every destination pixel exactly once.
+ * Transposing maps (90/270) walk the destination in small square tiles so
+ * the strided source reads stay in cache.
+ *
+ * Extracted from nina_image_display.c so the index math can be unit tested on
+ * the host without LVGL. No LVGL/ESP includes here. Output must stay
+ * pixel-for-pixel identical to the multi-pass code it replaced.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Destination tile edge (pixels) for transposing maps. */
+#define IMAGE_TRANSFORM_TILE 32
+
+/** What the page wants done to one source frame, in pipeline order. */
+typedef struct {
+    const uint16_t *src;         /**< RGB565 source, stride == src_w */
+    uint16_t src_w, src_h;
+    bool     src_vflip;          /**< Source rows are stored bottom-up */
+    /* Crop rectangle in upright source coordinates. */
+    uint16_t crop_x, crop_y, crop_w, crop_h;
+    /* Caption mask in upright source coordinates: pixels with x in
+     * [mask_x0, mask_x1) and y in [mask_y0, mask_y1) take the colour of
+     * column mask_sample_x in the same upright row. */
+    bool     mask_on;
+    int      mask_x0, mask_x1, mask_y0, mask_y1;
+    int      mask_sample_x;
+    bool     vflip;              /**< Mirror the cropped frame top<->bottom */
+    bool     hflip;              /**< Mirror the cropped frame left<->right */
+    uint8_t  orient;             /**< Then rotate 0/1/2/3 = 0/90/180/270 deg clockwise */
+} image_transform_t;
+
+typedef enum {
+    IMAGE_TRANSFORM_COPY,        /**< Rows are straight copies (no mask) */
+    IMAGE_TRANSFORM_ROT180,      /**< 180 deg turn of a source block (no mask) */
+    IMAGE_TRANSFORM_GENERAL,
+} image_transform_kind_t;
+
+/** Compiled index map for one transform. */
+typedef struct {
+    const uint16_t *src;
+    uint16_t dst_w, dst_h;
+    int32_t  base, step_x, step_y;   /* main map, in source pixels */
+    bool     mask;                   /* mask rectangle non-empty */
+    uint16_t mask_x0, mask_x1, mask_y0, mask_y1;  /* in destination pixels */
+    int32_t  mask_base, mask_step_x, mask_step_y;
+    image_transform_kind_t kind;
+    /* Top-left of the source block the main map reads (for HW offload). */
+    uint16_t block_x, block_y;
+} image_transform_plan_t;
+
+/**
+ * @brief Compile @p t into @p plan.
+ * @return false when the crop rectangle is empty or outside the source, or
+ *         @p orient is out of range.
+ */
+bool image_transform_plan(const image_transform_t *t, image_transform_plan_t *plan);
+
+/**
+ * @brief Write the plan's dst_w x dst_h frame (stride dst_w) into @p dst.
+ */
+void image_transform_apply(const image_transform_plan_t *plan, uint16_t *dst);
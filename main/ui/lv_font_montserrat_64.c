@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 64 px
  * Bpp: 4
- * Opts: --font managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf --size 64 --bpp 4 --format lvgl --range 0x20-0x7E --range 0xB0 --no-compress --force-fast-kern-format --lv-include lvgl.h -o main/ui/lv_font_montserrat_64.c
+ * Opts: --font managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf --size 64 --bpp 4 --format lvgl --range 0x20-0x7E --range 0xB0 --force-fast-kern-format --lv-include lvgl.h -o main/ui/lv_font_montserrat_64.c
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -9,6 +9,7 @@
 #else
 #include "lvgl.h"
 #endif
+#include "font_glyph_cache.h"
 
 #ifndef LV_FONT_MONTSERRAT_64
 #define LV_FONT_MONTSERRAT_64 1
@@ -25,8216 +26,3392 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0xf, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff,
-    0xf2, 0xe, 0xff, 0xff, 0xff, 0x10, 0xef, 0xff,
-    0xff, 0xf1, 0xd, 0xff, 0xff, 0xff, 0x0, 0xcf,
-    0xff, 0xff, 0xf0, 0xc, 0xff, 0xff, 0xff, 0x0,
-    0xbf, 0xff, 0xff, 0xe0, 0xb, 0xff, 0xff, 0xfe,
-    0x0, 0xaf, 0xff, 0xff, 0xd0, 0x9, 0xff, 0xff,
-    0xfc, 0x0, 0x9f, 0xff, 0xff, 0xc0, 0x8, 0xff,
-    0xff, 0xfb, 0x0, 0x8f, 0xff, 0xff, 0xa0, 0x7,
-    0xff, 0xff, 0xfa, 0x0, 0x6f, 0xff, 0xff, 0x90,
-    0x6, 0xff, 0xff, 0xf9, 0x0, 0x5f, 0xff, 0xff,
-    0x80, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x4f, 0xff,
-    0xff, 0x70, 0x3, 0xff, 0xff, 0xf6, 0x0, 0x3f,
-    0xff, 0xff, 0x50, 0x2, 0xff, 0xff, 0xf5, 0x0,
-    0x2f, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0xf4,
-    0x0, 0xf, 0xff, 0xff, 0x30, 0x0, 0xff, 0xff,
-    0xf2, 0x0, 0xf, 0xff, 0xff, 0x20, 0x0, 0xef,
-    0xff, 0xf1, 0x0, 0xe, 0xff, 0xff, 0x0, 0x0,
-    0x67, 0x77, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x9,
-    0xff, 0xfb, 0x10, 0xb, 0xff, 0xff, 0xfd, 0x4,
-    0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xff,
-    0xb8, 0xff, 0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff,
-    0xff, 0x60, 0xaf, 0xff, 0xff, 0xc0, 0x0, 0x7d,
-    0xfe, 0x80, 0x0,
+    0xf, 0xff, 0x8c, 0x3, 0xf0, 0x80, 0x80, 0x78,
+    0xc0, 0x3f, 0xc6, 0x1, 0xe1, 0x1, 0x0, 0xff,
+    0xe2, 0xb8, 0x7, 0x8, 0x7, 0xfc, 0x20, 0x1c,
+    0x60, 0x3, 0x0, 0xe1, 0x0, 0xff, 0x84, 0x3,
+    0x9c, 0x3, 0xf0, 0x80, 0x3c, 0x3, 0xf0, 0x80,
+    0x71, 0x80, 0x7f, 0xc6, 0x1, 0xc2, 0x1, 0xfb,
+    0xc0, 0x2, 0x1, 0xf9, 0xc0, 0x38, 0x40, 0x3f,
+    0x18, 0x0, 0x40, 0x3f, 0xf8, 0x42, 0x0, 0x30,
+    0xf, 0xc2, 0x1, 0xce, 0x1, 0xf8, 0x40, 0x3f,
+    0xf0, 0x80, 0x63, 0x0, 0xfc, 0x20, 0x14, 0x47,
+    0x0, 0x66, 0x77, 0xc0, 0x1f, 0xfd, 0xe1, 0x0,
+    0xf4, 0xff, 0x7d, 0x88, 0x2, 0xd8, 0x2, 0x4c,
+    0x4, 0x40, 0x7, 0x13, 0xe0, 0x7, 0xd8, 0x1,
+    0xf8, 0x70, 0x3, 0xec, 0x45, 0x0, 0xe3, 0x60,
+    0xa8, 0x20, 0x17, 0xc0,
 
     /* U+0022 "\"" */
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xef, 0xff, 0xf5, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xee, 0xff, 0xff, 0x40, 0x0, 0x0, 0x5f,
-    0xff, 0xfe, 0xdf, 0xff, 0xf4, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xdd, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x4f, 0xff, 0xfd, 0xdf, 0xff, 0xf3, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xdc, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x3f, 0xff, 0xfc, 0xcf, 0xff, 0xf2, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xcc, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x2f, 0xff, 0xfb, 0xbf, 0xff, 0xf2,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xbb, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x2f, 0xff, 0xfb, 0xbf, 0xff,
-    0xf1, 0x0, 0x0, 0x1, 0xff, 0xff, 0xaa, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfa, 0xaf,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x99,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9,
-    0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x91, 0x22, 0x22, 0x0, 0x0, 0x0, 0x2, 0x22,
-    0x21,
+    0xff, 0xe6, 0x0, 0xe6, 0xff, 0xe0, 0xe, 0x30,
+    0xe, 0x30, 0xe, 0x10, 0xf, 0xfe, 0x18, 0x80,
+    0x70, 0x80, 0x7f, 0xc6, 0x1, 0xfe, 0x10, 0xc,
+    0x60, 0x1f, 0xfc, 0xa7, 0x0, 0xe7, 0x0, 0xe1,
+    0x0, 0xff, 0xe1, 0x88, 0x7, 0x8, 0x7, 0xff,
+    0x28, 0x40, 0x33, 0xb8, 0x3, 0xff, 0x92, 0x60,
+    0x1f, 0xfc, 0xa3, 0x0, 0xc2, 0x20, 0xc, 0x20,
+    0x1f, 0xfc, 0xf3, 0x30, 0x7, 0xf8, 0x40, 0x3f,
+    0xf9, 0x51, 0xbb, 0x80, 0x3e, 0xdd, 0xd0,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x2a, 0xaa, 0xaa, 0xaa, 0xab, 0xff, 0xff,
-    0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xef, 0xff,
-    0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x2, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xcf, 0xff, 0xfa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xae, 0xff, 0xfe, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0xaf, 0xfe, 0x30, 0xf, 0xfb,
+    0x3f, 0xec, 0x0, 0xff, 0xe4, 0x90, 0x6, 0x20,
+    0xf, 0xf8, 0x80, 0x26, 0x0, 0xff, 0xe4, 0xf0,
+    0x6, 0x10, 0xf, 0xf8, 0x40, 0x22, 0x0, 0xff,
+    0xe4, 0x90, 0x4, 0x40, 0x1f, 0xf0, 0x80, 0x6e,
+    0x0, 0xff, 0xe4, 0xb0, 0x4, 0xc0, 0x1f, 0xf1,
+    0x0, 0x63, 0x0, 0xff, 0xe4, 0x98, 0x4, 0x40,
+    0x1f, 0xf3, 0x0, 0x66, 0x0, 0xff, 0xe4, 0x88,
+    0x4, 0x20, 0x1f, 0xf1, 0x0, 0x62, 0x0, 0xff,
+    0xe4, 0x10, 0x6, 0xe0, 0xf, 0xfb, 0x80, 0x30,
+    0x80, 0x7f, 0xf2, 0x18, 0x3, 0x10, 0x7, 0xfc,
+    0x40, 0x11, 0x0, 0x7f, 0xf2, 0x48, 0x3, 0x30,
+    0x7, 0xfc, 0xc0, 0x13, 0x0, 0x7f, 0xf2, 0x78,
+    0x3, 0x10, 0x7, 0xfc, 0x40, 0x11, 0x0, 0x7f,
+    0xf2, 0x48, 0x2, 0x10, 0xf, 0xfe, 0x27, 0x0,
+    0x7f, 0xc7, 0xff, 0xfc, 0xa0, 0x10, 0xff, 0xff,
+    0xe0, 0xd, 0x1f, 0xff, 0x90, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xec, 0x15, 0x5f, 0xc8, 0x1, 0x91,
+    0x57, 0xfe, 0x10, 0xc, 0xab, 0xfc, 0xc0, 0x2,
+    0xaa, 0xfd, 0xa0, 0x1a, 0x6a, 0xbf, 0xe2, 0x0,
+    0x8e, 0xab, 0xf8, 0x80, 0x3f, 0xee, 0x0, 0xc4,
+    0x1, 0xff, 0x10, 0x4, 0xc0, 0x1f, 0xfc, 0x92,
+    0x0, 0x84, 0x3, 0xff, 0x8, 0x4, 0x40, 0x1f,
+    0xfc, 0x96, 0x0, 0x88, 0x3, 0xfe, 0x20, 0xd,
+    0xc0, 0x1f, 0xfc, 0x92, 0x0, 0x98, 0x3, 0xfe,
+    0x60, 0xc, 0x40, 0x1f, 0xfc, 0x91, 0x0, 0x88,
+    0x3, 0xfe, 0x20, 0xc, 0xc0, 0x1f, 0xfc, 0x82,
+    0x0, 0xdc, 0x1, 0xff, 0x70, 0x6, 0x20, 0xf,
+    0xfe, 0x43, 0x0, 0x62, 0x0, 0xff, 0x88, 0x2,
+    0x10, 0xf, 0xfe, 0x49, 0x0, 0x66, 0x0, 0xff,
+    0x98, 0x2, 0x20, 0xf, 0xfe, 0x4f, 0x0, 0x62,
+    0x0, 0xff, 0x88, 0x2, 0x60, 0xf, 0xfe, 0x49,
+    0x0, 0x42, 0x1, 0xff, 0x84, 0x2, 0x20, 0xf,
+    0xfe, 0x4b, 0x0, 0x44, 0x1, 0xff, 0x10, 0x6,
+    0xe0, 0xf, 0xf9, 0x3f, 0xff, 0x8c, 0x2, 0x3f,
+    0xff, 0xfb, 0x40, 0x34, 0xff, 0xfe, 0x30, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xb1, 0x95, 0x7f, 0x18,
+    0x6, 0x55, 0xff, 0xc2, 0x1, 0xa, 0xaf, 0xf0,
+    0x80, 0xa, 0xab, 0xf2, 0x0, 0x6a, 0xaf, 0xfc,
+    0x1, 0x92, 0xab, 0xf8, 0x80, 0x3f, 0xe2, 0x0,
+    0x84, 0x3, 0xff, 0x8, 0x4, 0x40, 0x1f, 0xfc,
+    0x96, 0x0, 0x88, 0x3, 0xfe, 0x20, 0xd, 0xc0,
+    0x1f, 0xfc, 0x92, 0x0, 0x98, 0x3, 0xfe, 0x60,
+    0xc, 0x40, 0x1f, 0xfc, 0x91, 0x0, 0x88, 0x3,
+    0xfe, 0x20, 0xc, 0xc0, 0x1f, 0xfc, 0x82, 0x0,
+    0xdc, 0x1, 0xff, 0x70, 0x6, 0x20, 0xf, 0xfe,
+    0x43, 0x0, 0x62, 0x0, 0xff, 0x88, 0x2, 0x10,
+    0xf, 0xfe, 0x49, 0x0, 0x66, 0x0, 0xff, 0x98,
+    0x2, 0x20, 0xf, 0xfe, 0x4f, 0x0, 0x62, 0x0,
+    0xff, 0x88, 0x2, 0x60, 0xf, 0xfe, 0x49, 0x0,
+    0x42, 0x1, 0xff, 0x84, 0x2, 0x20, 0xf, 0xfe,
+    0x4b, 0x0, 0x44, 0x1, 0xff, 0x10, 0x6, 0xe0,
+    0xf, 0xfe, 0x8,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x88, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x46, 0xef, 0xff,
-    0x97, 0x64, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xd7, 0x30, 0xdf, 0xff, 0x42, 0x35, 0x9c, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x28, 0xef, 0xfe, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfe,
-    0x71, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb6, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x6a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x44, 0x9e,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x7d,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0,
-    0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x50, 0x6, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xfe, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xe8, 0x30, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x4c, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb9, 0x76, 0xef, 0xff,
-    0x88, 0xae, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x69, 0xbd, 0xef,
-    0xff, 0xff, 0xff, 0xda, 0x62, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x88, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0xe2, 0x34, 0x44, 0x40, 0x1f, 0xfd,
+    0x3b, 0x77, 0x98, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xf7, 0xa, 0x31, 0x80, 0x5a,
+    0xec, 0x82, 0x1, 0xff, 0xc9, 0x5a, 0xee, 0x5c,
+    0x88, 0x4, 0xd1, 0x37, 0xdc, 0xa6, 0x10, 0xf,
+    0xfe, 0x1b, 0xf5, 0x28, 0x80, 0x7f, 0xe1, 0x59,
+    0xea, 0x30, 0xf, 0xf9, 0x3a, 0x4, 0x3, 0xff,
+    0x8e, 0xb9, 0x64, 0x1, 0xf9, 0xec, 0x40, 0x3f,
+    0xf9, 0x69, 0xa2, 0x1, 0xe6, 0x80, 0xf, 0xfe,
+    0x71, 0x88, 0x7, 0x1c, 0x80, 0x7c, 0x51, 0x9e,
+    0x40, 0x15, 0xee, 0x53, 0x18, 0x7, 0xa4, 0x3,
+    0xde, 0x1, 0xe1, 0xbd, 0x73, 0x0, 0xf1, 0x1a,
+    0xce, 0x6b, 0x88, 0x0, 0x54, 0x3, 0x94, 0xc0,
+    0x38, 0xfd, 0x0, 0x3f, 0xf8, 0x45, 0x1c, 0xe0,
+    0xc0, 0x1e, 0xf0, 0xf, 0x68, 0x80, 0x7f, 0xf1,
+    0xa3, 0xa4, 0x3, 0xca, 0x1, 0xd0, 0x20, 0x1f,
+    0xfc, 0x81, 0x10, 0x7, 0x10, 0x7, 0x94, 0x3,
+    0xff, 0xa0, 0x20, 0x1e, 0x20, 0xf, 0xfe, 0x83,
+    0x80, 0x7f, 0xf5, 0xdc, 0x3, 0xc6, 0x1, 0xff,
+    0xd0, 0x20, 0xf, 0x48, 0x7, 0xff, 0x40, 0x48,
+    0x3, 0x95, 0x40, 0x1f, 0xfd, 0x5, 0x0, 0xf5,
+    0x40, 0x7, 0xff, 0x3e, 0x40, 0x3e, 0x7e, 0x71,
+    0x0, 0xff, 0xe6, 0xc, 0x80, 0x7c, 0x31, 0xd6,
+    0xc0, 0x1f, 0xfc, 0xb6, 0x70, 0xf, 0xe4, 0x92,
+    0x0, 0x84, 0x3, 0xff, 0x8f, 0x10, 0x0, 0xff,
+    0xe1, 0x57, 0x52, 0x80, 0x7f, 0xf1, 0x5e, 0xc8,
+    0x3, 0xff, 0x82, 0x2b, 0x5f, 0x6a, 0x1, 0xff,
+    0xc3, 0x4d, 0xa3, 0x0, 0xff, 0xe1, 0xa5, 0x7c,
+    0x8, 0x7, 0xff, 0x9, 0x73, 0x5c, 0x80, 0x3f,
+    0xf8, 0x6f, 0xcc, 0x1, 0xff, 0xc3, 0x28, 0xdd,
+    0x4a, 0x80, 0x7f, 0xf0, 0xa6, 0x40, 0x1f, 0xfc,
+    0x52, 0x6a, 0x20, 0xf, 0xfe, 0x13, 0x50, 0x7,
+    0xff, 0x2e, 0xec, 0xc2, 0x1, 0xf9, 0x5c, 0x3,
+    0xff, 0x96, 0x93, 0xd2, 0x40, 0x1f, 0x40, 0x80,
+    0x7f, 0xf3, 0x5b, 0x60, 0x3, 0xe6, 0x0, 0xff,
+    0xe7, 0xbd, 0x0, 0x7a, 0xc0, 0x3f, 0xfa, 0xa,
+    0xa0, 0xe, 0x30, 0xf, 0xfe, 0x8f, 0x80, 0x7f,
+    0xf5, 0xd8, 0x3, 0xc2, 0x1, 0xff, 0xd7, 0x10,
+    0x8, 0x40, 0x3f, 0xf9, 0x8a, 0x1, 0xc2, 0x1,
+    0x3e, 0x10, 0x7, 0xff, 0x2e, 0x80, 0x39, 0x40,
+    0x29, 0x2d, 0x70, 0xf, 0xfe, 0x4b, 0x18, 0x7,
+    0x70, 0x1, 0x84, 0x1, 0x1a, 0xc0, 0x1f, 0xfc,
+    0x66, 0x90, 0xe, 0x15, 0x0, 0x58, 0x6, 0x29,
+    0xe8, 0x30, 0xf, 0xfe, 0xa, 0x64, 0x80, 0x7a,
+    0xc0, 0x6, 0x40, 0x1e, 0x17, 0xcf, 0xb9, 0x76,
+    0x30, 0xb, 0x22, 0xba, 0xcc, 0x3, 0xca, 0xa0,
+    0x1, 0xd0, 0x7, 0xf9, 0x1a, 0x24, 0x40, 0x27,
+    0x72, 0x88, 0x7, 0xc7, 0x40, 0x19, 0x79, 0x0,
+    0x3f, 0xf9, 0xcb, 0x80, 0x1e, 0x1b, 0xc4, 0x0,
+    0xff, 0xe5, 0xc, 0xd0, 0x7, 0xf1, 0xde, 0xb9,
+    0x0, 0x7f, 0xf1, 0x4a, 0x79, 0x80, 0x3f, 0xf1,
+    0x46, 0xea, 0x59, 0x8, 0x40, 0x3e, 0x25, 0x9d,
+    0xd3, 0x0, 0x7f, 0xf1, 0x49, 0xa6, 0xf7, 0xbc,
+    0x80, 0x2a, 0xfd, 0xa6, 0x20, 0xf, 0xfe, 0x90,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0x1b, 0x77, 0x98, 0x3, 0xff, 0x86,
 
     /* U+0025 "%" */
-    0x0, 0x0, 0x0, 0x0, 0x35, 0x76, 0x52, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x9e, 0xff, 0xff, 0xff,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x94, 0x23, 0x6c, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xe3, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x6f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x20, 0x0, 0x2, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xfb, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfa,
-    0x10, 0x0, 0x4, 0xdf, 0xff, 0xf2, 0x0, 0x0,
-    0x7f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfc, 0xab, 0xdf, 0xff, 0xff, 0x60, 0x0,
-    0x2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x20, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xdb, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,
-    0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x20, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0xba, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0x0,
-    0x0, 0x3f, 0xff, 0xfd, 0x30, 0x0, 0x1, 0xbf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe,
-    0x10, 0x0, 0x3, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf5, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0xf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x30, 0x0, 0x1, 0xaf, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfd, 0xaa, 0xcf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad,
-    0xff, 0xeb, 0x71, 0x0, 0x0, 0x0,
+    0x0, 0xfc, 0x6a, 0xec, 0xa4, 0x1, 0xff, 0xdd,
+    0x19, 0xec, 0xa8, 0x9a, 0xdd, 0x28, 0x7, 0xff,
+    0x26, 0x3f, 0xf3, 0x0, 0x7f, 0xc9, 0xec, 0x20,
+    0x1e, 0x2a, 0xc1, 0x0, 0xff, 0xe3, 0x1b, 0x80,
+    0x48, 0xc0, 0x1f, 0xe5, 0xb1, 0x0, 0xff, 0x1e,
+    0x8, 0x7, 0xff, 0x17, 0x80, 0x21, 0xa0, 0xf,
+    0xf1, 0x50, 0x6, 0x6b, 0xdc, 0x93, 0x0, 0x8a,
+    0x80, 0x3f, 0xf8, 0x92, 0x40, 0x15, 0x88, 0x7,
+    0xfb, 0xc0, 0x21, 0xc9, 0x42, 0x36, 0xc8, 0x0,
+    0x91, 0x80, 0x3f, 0xf8, 0x48, 0xc0, 0x12, 0xa8,
+    0x3, 0xfc, 0xa4, 0x1, 0x69, 0x80, 0x79, 0xd8,
+    0x2, 0x80, 0xf, 0xfe, 0x15, 0x0, 0x43, 0x60,
+    0x1f, 0xf4, 0x80, 0x4c, 0x60, 0x1f, 0xa4, 0x40,
+    0x2, 0xa0, 0x1f, 0xfa, 0x44, 0x2, 0xb1, 0x0,
+    0xff, 0x9, 0x80, 0x54, 0x1, 0xfe, 0x70, 0xb,
+    0x0, 0x3f, 0xe4, 0x60, 0x9, 0x54, 0x1, 0xff,
+    0x28, 0x4, 0x26, 0x1, 0xfe, 0xd0, 0x9, 0x0,
+    0x3f, 0xc3, 0x40, 0x10, 0xd8, 0x7, 0xfe, 0x30,
+    0x9, 0x40, 0x3f, 0xe5, 0x0, 0x88, 0x3, 0xfd,
+    0x62, 0x1, 0x50, 0x80, 0x7f, 0xef, 0x0, 0x88,
+    0x3, 0xfe, 0x10, 0xc, 0x20, 0x1f, 0x95, 0x40,
+    0x13, 0x20, 0x7, 0xff, 0x4, 0x40, 0x21, 0x0,
+    0xff, 0xe2, 0x18, 0x7, 0xc3, 0x60, 0x11, 0x48,
+    0x7, 0xff, 0x18, 0x40, 0x3f, 0xf8, 0x86, 0x1,
+    0xf5, 0x88, 0x5, 0xc0, 0x1f, 0xfc, 0x31, 0x0,
+    0x8c, 0x3, 0xff, 0x88, 0x20, 0x1e, 0x55, 0x0,
+    0x4e, 0x60, 0x1f, 0xfc, 0x3e, 0x0, 0x98, 0x3,
+    0xfe, 0x20, 0xf, 0xf0, 0xd8, 0x4, 0x50, 0x1,
+    0xff, 0xc4, 0x40, 0x8, 0xc0, 0x3f, 0xe4, 0x0,
+    0x90, 0x3, 0xd4, 0x20, 0x17, 0x0, 0x7f, 0xf1,
+    0x48, 0x40, 0x26, 0x0, 0xff, 0x68, 0x4, 0x60,
+    0x1c, 0xc8, 0x1, 0x39, 0x80, 0x7f, 0xf1, 0x98,
+    0x2, 0xb0, 0xf, 0xe4, 0x40, 0x5, 0x40, 0x18,
+    0xa4, 0x2, 0x28, 0x0, 0xff, 0xe3, 0xd0, 0x4,
+    0x52, 0x1, 0xf0, 0xc8, 0x4, 0x84, 0x1, 0xb8,
+    0x3, 0x78, 0x7, 0xff, 0x20, 0x9c, 0x2, 0x6a,
+    0x10, 0xc, 0x98, 0x40, 0x14, 0x80, 0x67, 0x30,
+    0xa, 0x8, 0x3, 0xff, 0x93, 0x6, 0x1, 0x2f,
+    0x65, 0x5e, 0xd9, 0x0, 0x52, 0x40, 0x11, 0x40,
+    0x4, 0x6e, 0x1, 0xff, 0xcb, 0xc3, 0x0, 0xc6,
+    0xa8, 0x40, 0x1a, 0x58, 0x3, 0x70, 0x6, 0xe0,
+    0xf, 0x2d, 0x6f, 0xfb, 0x6d, 0xc4, 0x3, 0xfd,
+    0x8e, 0x1, 0xfc, 0x56, 0xc0, 0x19, 0xcc, 0x2,
+    0x92, 0x0, 0xcb, 0xd4, 0xa4, 0x0, 0x24, 0x8e,
+    0x80, 0xf, 0xf4, 0x74, 0x20, 0x80, 0x9, 0x6b,
+    0x50, 0x3, 0x14, 0x0, 0x48, 0xc0, 0x1a, 0x28,
+    0x40, 0x3f, 0x9f, 0x0, 0x3f, 0xc2, 0xf7, 0xdf,
+    0xed, 0xa5, 0x0, 0xf7, 0x80, 0x69, 0x0, 0xce,
+    0xe0, 0xc, 0x48, 0xa6, 0x1, 0x8f, 0x0, 0x3f,
+    0xf9, 0x70, 0x40, 0x14, 0x90, 0x4, 0x70, 0x1,
+    0x16, 0x6d, 0xd6, 0x72, 0x0, 0x47, 0x0, 0x1f,
+    0xfc, 0x93, 0x70, 0x9, 0x18, 0x3, 0x78, 0x4,
+    0x7a, 0x60, 0x18, 0x6d, 0x40, 0x27, 0x20, 0xf,
+    0xfe, 0x47, 0x0, 0x43, 0x40, 0x18, 0xcc, 0x1,
+    0x70, 0x7, 0xea, 0x20, 0xa, 0x80, 0x3f, 0xf8,
+    0xf2, 0x40, 0x15, 0x88, 0x6, 0xa0, 0x9, 0x48,
+    0x3, 0xfa, 0xc0, 0x26, 0x0, 0xff, 0xe3, 0x23,
+    0x0, 0x4a, 0xa0, 0xe, 0x40, 0xb, 0x80, 0x3f,
+    0xcc, 0x1, 0x9, 0x0, 0x7f, 0xf1, 0x64, 0x2,
+    0x1b, 0x0, 0xf1, 0x0, 0x4a, 0x1, 0xff, 0x10,
+    0x4, 0x80, 0x1f, 0xfc, 0x49, 0x20, 0xa, 0xc4,
+    0x3, 0x84, 0x3, 0x8, 0x7, 0xfc, 0xe0, 0x10,
+    0x80, 0x7f, 0xf0, 0xd1, 0x80, 0x25, 0x50, 0x7,
+    0x8c, 0x2, 0x10, 0xf, 0xfc, 0x60, 0x17, 0x80,
+    0x7f, 0xf0, 0x86, 0x80, 0x21, 0xb0, 0xf, 0x84,
+    0x3, 0xff, 0xaf, 0x62, 0x1, 0x50, 0x80, 0x7c,
+    0x40, 0x10, 0x80, 0x7f, 0xe3, 0x0, 0xbc, 0x3,
+    0xff, 0x82, 0xaa, 0x0, 0x99, 0x0, 0x3f, 0x8,
+    0x6, 0x10, 0xf, 0xf9, 0xc0, 0x21, 0x0, 0xff,
+    0xc3, 0x60, 0x11, 0x48, 0x7, 0xf8, 0x80, 0x25,
+    0x0, 0xff, 0x88, 0x2, 0x40, 0xf, 0xfd, 0x62,
+    0x1, 0x70, 0x7, 0xfc, 0x80, 0x17, 0x0, 0x7f,
+    0x98, 0x2, 0x12, 0x0, 0xff, 0x95, 0x40, 0x13,
+    0x98, 0x7, 0xfd, 0x40, 0x12, 0x90, 0x7, 0xf5,
+    0x80, 0x4e, 0x1, 0xff, 0xd, 0x80, 0x45, 0x0,
+    0x1f, 0xf8, 0xcc, 0x1, 0x70, 0x7, 0xe9, 0x20,
+    0xa, 0xc0, 0x3f, 0xea, 0x10, 0xb, 0x80, 0x3f,
+    0xf8, 0x5e, 0x1, 0x1e, 0x18, 0x6, 0x1a, 0x60,
+    0x9, 0xc8, 0x3, 0xfc, 0xc8, 0x1, 0x39, 0x80,
+    0x7f, 0xf0, 0x8d, 0xc0, 0x23, 0xcd, 0xaa, 0x67,
+    0x28, 0x4, 0x70, 0x1, 0xfe, 0x29, 0x0, 0x8a,
+    0x0, 0x3f, 0xf8, 0x90, 0xe0, 0x18, 0x95, 0x46,
+    0x1, 0x8f, 0x0, 0x3f, 0xee, 0x0, 0xde, 0x1,
+    0xff, 0xc6, 0x8a, 0x10, 0xf, 0xe7, 0xc0, 0xf,
+    0xf9, 0xcc, 0x2, 0x82, 0x0, 0xff, 0xe3, 0xaf,
+    0x52, 0x90, 0x0, 0x52, 0x3a, 0x0, 0x38,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x56, 0x76, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0x72, 0x0,
-    0x3, 0x8f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xe2,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xd1, 0x5e, 0xff, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x50,
-    0xa, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd8, 0x30, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf8, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x40, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x5,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x50, 0x0,
-    0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xcb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x2, 0x7d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xa9, 0x9a, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xb, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6b,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x72, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x67, 0x77,
-    0x65, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x9a, 0xb3, 0xb2, 0x98, 0x7,
+    0xff, 0x4d, 0x73, 0xf2, 0xa6, 0x26, 0xb3, 0xed,
+    0x0, 0x3f, 0xf9, 0xc9, 0xd4, 0x60, 0x1f, 0xc9,
+    0x76, 0x10, 0xf, 0xfe, 0x5c, 0x58, 0x80, 0x7f,
+    0xf0, 0x53, 0xc8, 0x3, 0xff, 0x92, 0xee, 0x0,
+    0xff, 0xe2, 0xe, 0x0, 0x7f, 0xf2, 0xe, 0x0,
+    0x38, 0x63, 0x7f, 0xec, 0x70, 0xe, 0x19, 0x0,
+    0xff, 0xe3, 0xf8, 0x7, 0x27, 0xb9, 0x0, 0x47,
+    0x1a, 0x40, 0x19, 0x80, 0x3f, 0xf8, 0xc2, 0x60,
+    0x18, 0x6c, 0x40, 0x3e, 0x2e, 0x0, 0xe5, 0x0,
+    0xff, 0xe2, 0xb8, 0x7, 0x40, 0x7, 0xf8, 0xcc,
+    0x1, 0x88, 0x3, 0xff, 0x8b, 0xc0, 0x1c, 0x80,
+    0x1f, 0xf2, 0x80, 0x6e, 0x0, 0xff, 0xe2, 0x88,
+    0x7, 0x18, 0x7, 0xff, 0x10, 0x40, 0x3f, 0xf8,
+    0xa2, 0x1, 0xc4, 0x1, 0xff, 0x20, 0x6, 0xf0,
+    0xf, 0xfe, 0x2f, 0x0, 0x72, 0x0, 0x7f, 0x90,
+    0x80, 0x32, 0x0, 0x7f, 0xf1, 0x54, 0x3, 0xa8,
+    0x3, 0xf8, 0x68, 0x3, 0x9, 0x80, 0x7f, 0xf1,
+    0x4c, 0x80, 0x31, 0x38, 0x7, 0xc3, 0x82, 0x1,
+    0xa0, 0x3, 0xff, 0x8f, 0x60, 0x1d, 0x6, 0x1,
+    0xc9, 0xe4, 0x1, 0x8d, 0x80, 0x3f, 0xf8, 0xec,
+    0x40, 0x1d, 0xa4, 0x1, 0x4d, 0x88, 0x6, 0x2d,
+    0x0, 0xff, 0xe4, 0xf0, 0x7, 0xf, 0x8a, 0xf3,
+    0x0, 0x71, 0x78, 0x80, 0x7f, 0xf2, 0x4e, 0x40,
+    0x38, 0xba, 0x84, 0x3, 0x93, 0x8, 0x3, 0xff,
+    0x96, 0xcc, 0x0, 0xff, 0xd1, 0x62, 0x1, 0xff,
+    0xcd, 0x95, 0x0, 0xfe, 0x3c, 0x70, 0xf, 0xfe,
+    0x7a, 0x38, 0x7, 0xe8, 0xc3, 0x0, 0xff, 0xe7,
+    0xd, 0x59, 0x0, 0x7e, 0xb1, 0x0, 0xff, 0xe7,
+    0x27, 0xa8, 0x7, 0xf8, 0xf4, 0x40, 0x3f, 0xf9,
+    0x91, 0x62, 0x1, 0xc8, 0x80, 0xe, 0x3d, 0x10,
+    0xf, 0xf1, 0x80, 0x7f, 0xd4, 0xe0, 0x1c, 0x35,
+    0x76, 0x50, 0xe, 0x3d, 0x10, 0xf, 0xc9, 0x9b,
+    0x6, 0x1, 0xf5, 0xa8, 0x7, 0x2f, 0xa8, 0x2,
+    0x94, 0x3, 0x8f, 0x44, 0x3, 0xec, 0x2, 0x7c,
+    0xa0, 0xe, 0x94, 0x0, 0xe8, 0xa1, 0x0, 0xd4,
+    0xa0, 0x1c, 0x7a, 0x20, 0x1e, 0x40, 0xc, 0x40,
+    0x19, 0x18, 0x3, 0xa9, 0xc0, 0x3e, 0xa5, 0x0,
+    0xe3, 0xd1, 0x0, 0xc2, 0x60, 0x1b, 0x0, 0x34,
+    0x80, 0x74, 0x28, 0x7, 0xf5, 0x20, 0x7, 0x1e,
+    0x88, 0x4, 0xe0, 0x1c, 0x80, 0x12, 0x90, 0x6,
+    0x27, 0x0, 0xff, 0xad, 0x0, 0x38, 0xf4, 0x2,
+    0xa0, 0xc, 0x80, 0x1b, 0xc0, 0x3a, 0xc0, 0x3f,
+    0xf8, 0x36, 0x80, 0x1c, 0x78, 0x6, 0x60, 0xd,
+    0xc0, 0x19, 0x0, 0x39, 0xc0, 0x3f, 0xf8, 0x56,
+    0x80, 0x1c, 0x79, 0x0, 0x18, 0x54, 0x3, 0x8,
+    0x7, 0x8, 0x7, 0xff, 0xe, 0xd0, 0x3, 0x8d,
+    0x0, 0x33, 0x0, 0x61, 0x0, 0xe1, 0x0, 0xff,
+    0xe2, 0xda, 0x0, 0x7f, 0xa4, 0x3, 0xfc, 0x20,
+    0x1f, 0xfc, 0x6b, 0x40, 0xf, 0xce, 0x20, 0x18,
+    0x40, 0x3c, 0xa0, 0x1f, 0xfc, 0x6b, 0x40, 0xf,
+    0xa4, 0x3, 0xc8, 0x1, 0xd0, 0x1, 0xff, 0xc7,
+    0x30, 0xf, 0xb4, 0x3, 0xda, 0x1, 0xc5, 0x40,
+    0x1f, 0xfc, 0x5a, 0x70, 0xf, 0x8f, 0x0, 0x39,
+    0x84, 0x3, 0x96, 0xc8, 0x3, 0xff, 0x82, 0xbc,
+    0xa0, 0x1f, 0xc7, 0x80, 0x1d, 0x60, 0x1e, 0x4d,
+    0x93, 0x0, 0xfc, 0x4f, 0xb4, 0x20, 0x1f, 0xf1,
+    0xe0, 0x6, 0x57, 0x0, 0xf9, 0xb3, 0xf2, 0xa6,
+    0x55, 0x9f, 0xb0, 0x40, 0x1e, 0x5f, 0x40, 0xe,
+    0x3c, 0x0, 0xd0, 0xe0, 0x1f, 0xc6, 0xac, 0xc5,
+    0x30, 0xf, 0xe8, 0xa0, 0xb4, 0x0, 0xe3, 0xa0,
+    0xd, 0x14, 0x20, 0x1f, 0xfc, 0x83, 0xc7, 0x0,
+    0xad, 0x0, 0x3a, 0x40, 0x39, 0x7d, 0xc0, 0x3f,
+    0xf8, 0xa7, 0x58, 0x60, 0x1d, 0x68, 0x1, 0x51,
+    0x80, 0x78, 0x63, 0xe5, 0x4, 0x3, 0xfc, 0x71,
+    0xb8, 0xa0, 0x1f, 0xad, 0x42, 0x14, 0x3, 0xfc,
+    0xd7, 0xdb, 0x73, 0x11, 0x4d, 0x67, 0xe3, 0x90,
+    0x7, 0xfd, 0x52, 0xe0, 0x0,
 
     /* U+0027 "'" */
-    0xff, 0xff, 0xf6, 0xff, 0xff, 0xf5, 0xef, 0xff,
-    0xf5, 0xef, 0xff, 0xf4, 0xdf, 0xff, 0xf4, 0xdf,
-    0xff, 0xf4, 0xdf, 0xff, 0xf3, 0xcf, 0xff, 0xf3,
-    0xcf, 0xff, 0xf2, 0xcf, 0xff, 0xf2, 0xbf, 0xff,
-    0xf2, 0xbf, 0xff, 0xf1, 0xbf, 0xff, 0xf1, 0xaf,
-    0xff, 0xf0, 0xaf, 0xff, 0xf0, 0x9f, 0xff, 0xf0,
-    0x9f, 0xff, 0xf0, 0x12, 0x22, 0x20,
+    0xff, 0xe6, 0x0, 0xe3, 0x10, 0xf, 0xf0, 0x98,
+    0x7, 0xff, 0x11, 0xc4, 0x3, 0xfc, 0x20, 0x1e,
+    0x70, 0xf, 0xf1, 0x80, 0x78, 0x40, 0x30, 0x80,
+    0x78, 0xc0, 0x3f, 0xe8, 0xdd, 0xc0,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x3, 0x88, 0x88, 0x83, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4,
+    0x0, 0xf8, 0xe2, 0x38, 0xc0, 0x3e, 0xe7, 0x7c,
+    0xc6, 0x1, 0xe7, 0x20, 0xd, 0x20, 0x1e, 0x18,
+    0x0, 0xc2, 0xe0, 0x1e, 0x90, 0xe, 0x90, 0xf,
+    0x98, 0x3, 0x9c, 0x3, 0xcc, 0x20, 0x19, 0x80,
+    0x3e, 0xb0, 0xe, 0xb0, 0xf, 0x19, 0x0, 0x63,
+    0x20, 0xf, 0x50, 0x7, 0x50, 0x7, 0xce, 0x1,
+    0xce, 0x1, 0xe3, 0x10, 0xc, 0x82, 0x1, 0xeb,
+    0x0, 0xec, 0x0, 0xf9, 0x40, 0x39, 0x40, 0x3c,
+    0x24, 0x1, 0x84, 0x80, 0x3c, 0xa0, 0x1c, 0x80,
+    0x1f, 0x60, 0x7, 0x68, 0x7, 0xc6, 0x1, 0xc6,
+    0x1, 0xf2, 0x80, 0x72, 0x0, 0x78, 0x44, 0x1,
+    0x84, 0x3, 0xe2, 0x0, 0xe2, 0x0, 0xf9, 0x40,
+    0x39, 0x40, 0x3e, 0x10, 0xe, 0x10, 0xf, 0xb8,
+    0x3, 0xb8, 0x3, 0xe3, 0x0, 0xe3, 0x0, 0xf9,
+    0x80, 0x38, 0x40, 0x3e, 0x10, 0xe, 0x70, 0xf,
+    0xfe, 0x8, 0x80, 0x7f, 0xf2, 0x4c, 0x3, 0x8c,
+    0x3, 0xff, 0x9e, 0x60, 0x1f, 0x18, 0x7, 0xff,
+    0x3c, 0x40, 0x38, 0x40, 0x3e, 0x70, 0xe, 0x70,
+    0xf, 0x84, 0x3, 0x88, 0x3, 0xe2, 0x0, 0xe1,
+    0x0, 0xfb, 0xc0, 0x3b, 0xc0, 0x3e, 0x30, 0xe,
+    0x30, 0xf, 0x98, 0x3, 0x98, 0x3, 0xe2, 0x0,
+    0xe2, 0x0, 0xfc, 0x40, 0x1c, 0x40, 0x1f, 0x38,
+    0x7, 0x38, 0x7, 0xd8, 0x1, 0xd8, 0x1, 0xf2,
+    0x0, 0x72, 0x80, 0x7c, 0x42, 0x1, 0x8c, 0x3,
+    0xf2, 0x0, 0x72, 0x0, 0x7d, 0xe0, 0x1d, 0xa0,
+    0x1f, 0x20, 0x7, 0x38, 0x7, 0xc2, 0x80, 0x18,
+    0x4c, 0x3, 0xee, 0x0, 0xea, 0x0, 0xf9, 0x40,
+    0x39, 0xc0, 0x3f, 0x30, 0x6, 0x15, 0x0, 0xfa,
+    0xc0, 0x3a, 0x40, 0x3e, 0x24, 0x0, 0xc6, 0x60,
+    0xf, 0xa0, 0x3, 0xa4, 0x3, 0xe3, 0x40, 0xc,
+    0xa6, 0x1, 0xf4, 0x80, 0x74, 0x0, 0x7c, 0x4c,
+    0x1, 0x91, 0x0,
 
     /* U+0029 ")" */
-    0x68, 0x88, 0x87, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0,
+    0x68, 0x8c, 0xe0, 0x1f, 0xce, 0xfa, 0x1c, 0x3,
+    0xe6, 0x20, 0xd, 0x2, 0x1, 0xf4, 0x0, 0x74,
+    0x0, 0x7c, 0xa4, 0x1, 0x98, 0x40, 0x3e, 0xa0,
+    0xe, 0x80, 0xf, 0x9c, 0x3, 0x98, 0x40, 0x3e,
+    0x70, 0xe, 0x60, 0xf, 0xac, 0x3, 0xa8, 0x3,
+    0xe3, 0x20, 0xc, 0x46, 0x1, 0xf5, 0x0, 0x75,
+    0x80, 0x7c, 0xa0, 0x1c, 0xa0, 0x1f, 0x11, 0x0,
+    0x31, 0x10, 0x3, 0xe4, 0x0, 0xe5, 0x0, 0xfb,
+    0x40, 0x3b, 0x0, 0x3e, 0x50, 0xe, 0x50, 0xf,
+    0x84, 0x80, 0x30, 0x90, 0x7, 0xce, 0x1, 0xc8,
+    0x1, 0xf6, 0x80, 0x77, 0x0, 0x7c, 0x60, 0x1c,
+    0x60, 0x1f, 0x30, 0x7, 0x30, 0x7, 0xc4, 0x1,
+    0xc4, 0x1, 0xf8, 0x40, 0x38, 0x40, 0x3e, 0x20,
+    0xe, 0x20, 0xf, 0x9c, 0x3, 0x9c, 0x3, 0xe1,
+    0x0, 0xe2, 0x0, 0xf8, 0xc0, 0x3f, 0xf8, 0x22,
+    0x1, 0xc2, 0x1, 0xff, 0xc9, 0xf0, 0xe, 0xf0,
+    0xf, 0xfe, 0x4f, 0x80, 0x7f, 0xf1, 0xfc, 0x3,
+    0xe1, 0x0, 0xff, 0xe3, 0x88, 0x7, 0xc6, 0x1,
+    0xc6, 0x1, 0xf3, 0x0, 0x73, 0x0, 0x7c, 0x20,
+    0x1c, 0x20, 0x1f, 0x10, 0x7, 0x18, 0x7, 0x84,
+    0x3, 0x84, 0x40, 0x1e, 0x20, 0xe, 0x20, 0xf,
+    0x94, 0x3, 0x94, 0x3, 0xee, 0x0, 0xee, 0x0,
+    0xf9, 0x0, 0x38, 0xc0, 0x3e, 0x30, 0xe, 0x40,
+    0xf, 0x18, 0x7, 0x18, 0x7, 0xca, 0x1, 0xca,
+    0x1, 0xf6, 0x80, 0x76, 0x80, 0x7c, 0x80, 0x1c,
+    0x80, 0x1e, 0x40, 0xe, 0x40, 0xf, 0xb8, 0x3,
+    0xb4, 0x3, 0xe5, 0x0, 0xe6, 0x0, 0xf3, 0x0,
+    0x73, 0x0, 0x7d, 0x40, 0x1d, 0x40, 0x1e, 0x33,
+    0x0, 0x63, 0x30, 0x7, 0xa4, 0x3, 0xa4, 0x3,
+    0xc4, 0xa0, 0x18, 0x94, 0x3, 0xd0, 0x1, 0xd0,
+    0x1, 0xe2, 0x50, 0xc, 0x8a, 0x1, 0xe9, 0x0,
+    0xe9, 0x0, 0xf8,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbb, 0xb8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x60, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x25, 0x0, 0x6, 0xfd, 0x40, 0x0,
-    0x1, 0xff, 0xfa, 0x0, 0x0, 0x8, 0xff, 0x10,
-    0x1e, 0xff, 0xfb, 0x20, 0x1, 0xff, 0xfa, 0x0,
-    0x5, 0xef, 0xff, 0x90, 0x8f, 0xff, 0xff, 0xf8,
-    0x1, 0xff, 0xfa, 0x3, 0xcf, 0xff, 0xff, 0xf2,
-    0x19, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xfb, 0x9f,
-    0xff, 0xff, 0xfe, 0x60, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x30, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xfa, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xfa, 0x20,
-    0x8f, 0xff, 0xff, 0xfc, 0x31, 0xff, 0xfa, 0x6,
-    0xef, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xfe, 0x50,
-    0x1, 0xff, 0xfa, 0x0, 0x19, 0xff, 0xff, 0xc0,
-    0x9, 0xff, 0x80, 0x0, 0x1, 0xff, 0xfa, 0x0,
-    0x0, 0x3c, 0xff, 0x30, 0x1, 0xa2, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x58, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x1b, 0xba, 0x0, 0x3f, 0xf9, 0x8,
+    0x91, 0x80, 0x7f, 0xfc, 0x18, 0x3, 0xff, 0x8a,
+    0x4a, 0x1, 0x34, 0xea, 0x0, 0x7e, 0x10, 0xe,
+    0x8d, 0xa1, 0x1, 0x80, 0x2b, 0xb1, 0x0, 0x7f,
+    0x97, 0x9c, 0x1, 0x1, 0x22, 0x1, 0x26, 0xc0,
+    0x7, 0xc7, 0x94, 0x20, 0x13, 0x14, 0xb0, 0x7,
+    0x3f, 0x30, 0x4, 0x33, 0x86, 0x1, 0x86, 0x48,
+    0x67, 0x50, 0x3, 0xc, 0x0, 0x48, 0xc0, 0x1c,
+    0xfc, 0xc0, 0x11, 0x5d, 0x8c, 0x3, 0xff, 0x37,
+    0x40, 0x7, 0xc9, 0x94, 0x40, 0x1f, 0x93, 0x64,
+    0x40, 0x3f, 0xce, 0xc0, 0x1f, 0xb0, 0x80, 0x3f,
+    0xc3, 0x1a, 0x80, 0x1f, 0xa3, 0x94, 0x3, 0xf3,
+    0xfb, 0x80, 0x7f, 0xc3, 0x58, 0x60, 0x19, 0x76,
+    0x4, 0x3, 0x28, 0x4, 0x44, 0x0, 0xc7, 0x94,
+    0x41, 0x14, 0x40, 0x18, 0xf2, 0xc0, 0x27, 0xd9,
+    0x10, 0xc, 0xba, 0x54, 0x1, 0x86, 0xb0, 0xc0,
+    0x3c, 0xde, 0xc0, 0x18, 0xc8, 0x8c, 0x0, 0x7e,
+    0x50, 0xf, 0xe1, 0x9c, 0x30, 0x7, 0x80, 0x21,
+    0x76, 0x0, 0x3f, 0xf8, 0x27, 0x94, 0xe6, 0x0,
+    0x1a, 0x20, 0xf, 0xe1, 0x0, 0xf2, 0xc0, 0x7,
+    0xff, 0xf8,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xdd,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xdb, 0xbc, 0x80, 0x1f, 0xfc, 0xa1,
+    0x22, 0xe1, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xbf,
+    0xff, 0xf7, 0x0, 0x75, 0x7f, 0xff, 0xc0, 0x1f,
+    0xff, 0xf0, 0xf, 0xfe, 0xed, 0xff, 0xff, 0xb8,
+    0x3, 0xab, 0xff, 0xfe, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0x50,
 
     /* U+002C "," */
-    0x0, 0x5a, 0xb9, 0x20, 0x0, 0xaf, 0xff, 0xff,
-    0x40, 0x6f, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff,
-    0xff, 0xf5, 0xef, 0xff, 0xff, 0xff, 0x7c, 0xff,
-    0xff, 0xff, 0xf6, 0x7f, 0xff, 0xff, 0xff, 0x40,
-    0xbf, 0xff, 0xff, 0xf0, 0x0, 0x8f, 0xff, 0xfa,
-    0x0, 0x7, 0xff, 0xff, 0x50, 0x0, 0xbf, 0xff,
-    0xf0, 0x0, 0xf, 0xff, 0xfa, 0x0, 0x3, 0xff,
-    0xff, 0x40, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0xb,
-    0xff, 0xf9, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0,
-    0x3f, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xf9, 0x0,
-    0x0,
+    0x0, 0x2d, 0x5c, 0x90, 0x5, 0x54, 0x54, 0x6d,
+    0x40, 0x65, 0x0, 0xeb, 0x1a, 0x0, 0xf9, 0x8,
+    0x3, 0xe2, 0x20, 0x7, 0xc3, 0x60, 0x1f, 0x13,
+    0xa0, 0x7, 0x90, 0x2d, 0xc0, 0x32, 0x80, 0x5e,
+    0x1, 0xbc, 0x2, 0xc0, 0xc, 0xa0, 0x12, 0x0,
+    0x4a, 0x1, 0x18, 0x6, 0xe0, 0x9, 0x0, 0x21,
+    0x40, 0xb, 0x0, 0x27, 0x0, 0xc8, 0x1, 0x68,
+    0x4, 0x60, 0x10, 0xa0, 0x4, 0x80, 0x13, 0x80,
+    0x60,
 
     /* U+002D "-" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x43, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x14, 0x4f, 0xfe, 0x21, 0xa5, 0xdf, 0xff, 0x13,
+    0x80, 0x3f, 0xff, 0x80,
 
     /* U+002E "." */
-    0x0, 0x4, 0x9a, 0x82, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x40, 0x7, 0xff, 0xff, 0xff, 0xe1, 0xe,
-    0xff, 0xff, 0xff, 0xf5, 0xf, 0xff, 0xff, 0xff,
-    0xf7, 0xf, 0xff, 0xff, 0xff, 0xf6, 0xa, 0xff,
-    0xff, 0xff, 0xf2, 0x1, 0xef, 0xff, 0xff, 0x70,
-    0x0, 0x19, 0xef, 0xc5, 0x0,
+    0x0, 0x92, 0x6a, 0x8, 0x3, 0x55, 0xb2, 0xbe,
+    0xa0, 0x1, 0xd4, 0x3, 0xa8, 0x42, 0x40, 0x3c,
+    0x28, 0x2, 0x1, 0xf1, 0x0, 0x7f, 0x8, 0x28,
+    0x7, 0xc8, 0x16, 0x20, 0x1d, 0x4, 0x3, 0xec,
+    0x20, 0x74, 0xe0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0xe4, 0xef, 0xfe, 0xb0, 0xf, 0xfe,
+    0x41, 0x90, 0x6, 0xe0, 0xf, 0xfe, 0x45, 0x80,
+    0x72, 0x80, 0x7f, 0xf2, 0x18, 0x3, 0x28, 0x7,
+    0xff, 0x21, 0x4, 0x3, 0x70, 0x7, 0xff, 0x23,
+    0x40, 0x30, 0xa0, 0x7, 0xff, 0x21, 0xc0, 0x33,
+    0x80, 0x7f, 0xf2, 0x14, 0x40, 0x36, 0x80, 0x7f,
+    0xf2, 0x3c, 0x3, 0xa, 0x0, 0x7f, 0xf2, 0x14,
+    0x3, 0x30, 0x7, 0xff, 0x21, 0x40, 0x3a, 0xc0,
+    0x3f, 0xf9, 0x1c, 0x1, 0x88, 0xc0, 0x3f, 0xf8,
+    0xe2, 0x80, 0x1a, 0x80, 0x3f, 0xf9, 0xe, 0x1,
+    0xca, 0x1, 0xff, 0xc8, 0xa0, 0xc, 0x64, 0x1,
+    0xff, 0xc7, 0x23, 0x0, 0xd4, 0x1, 0xff, 0xc8,
+    0x50, 0xe, 0x70, 0xf, 0xfe, 0x45, 0x0, 0x64,
+    0x10, 0xf, 0xfe, 0x39, 0x90, 0x6, 0xd0, 0xf,
+    0xfe, 0x45, 0x80, 0x73, 0x0, 0x7f, 0xf2, 0x18,
+    0x3, 0x28, 0x7, 0xff, 0x20, 0xc4, 0x3, 0x78,
+    0x7, 0xff, 0x22, 0x80, 0x39, 0x40, 0x3f, 0xf9,
+    0xe, 0x1, 0x98, 0x3, 0xff, 0x90, 0x82, 0x1,
+    0xb4, 0x3, 0xff, 0x91, 0xc0, 0x18, 0x50, 0x3,
+    0xff, 0x90, 0xa0, 0x19, 0xc0, 0x3f, 0xf9, 0xa,
+    0x1, 0xd4, 0x1, 0xff, 0xc8, 0xe0, 0xc, 0x46,
+    0x1, 0xff, 0xc7, 0x14, 0x0, 0xca, 0x1, 0xff,
+    0xc8, 0x70, 0xe, 0xa0, 0xf, 0xfe, 0x45, 0x0,
+    0x63, 0x20, 0xf, 0xfe, 0x38, 0x98, 0x6, 0xb0,
+    0xf, 0xfe, 0x43, 0x0, 0x73, 0x0, 0x7f, 0xf2,
+    0x28, 0x3, 0x18, 0x80, 0x7f, 0xf1, 0xc8, 0x80,
+    0x1a, 0x80, 0x3f, 0xf9, 0x14, 0x1, 0xce, 0x1,
+    0xff, 0xc8, 0x50, 0xc, 0x82, 0x1, 0xff, 0xc7,
+    0x32, 0x0, 0xdc, 0x1, 0xff, 0xc8, 0xa0, 0xe,
+    0x50, 0xf, 0xfe, 0x43, 0x80, 0x65, 0x0, 0xff,
+    0xe4, 0x20, 0x80, 0x6e, 0x0, 0xff, 0xe4, 0x70,
+    0x6, 0x14, 0x0, 0xff, 0xe4, 0x28, 0x6, 0x70,
+    0xf, 0xfe, 0x42, 0x80, 0x75, 0x0, 0x7f, 0xf2,
+    0x38, 0x3, 0x9, 0x80, 0x7f, 0xf1, 0xc5, 0x0,
+    0x33, 0x0, 0x7f, 0xf2, 0x1c, 0x3, 0xa8, 0x3,
+    0xff, 0x91, 0x40, 0x18, 0x88, 0x1, 0xff, 0xc7,
+    0x13, 0x0, 0xd4, 0x1, 0xff, 0xc8, 0x60, 0xe,
+    0x50, 0xf, 0xfe, 0x45, 0x80, 0x63, 0x20, 0xf,
+    0xfe, 0x39, 0x18, 0x6, 0xa0, 0xf, 0xfe, 0x45,
+    0x0, 0x73, 0x80, 0x7f, 0xf2, 0x14, 0x3, 0x20,
+    0x80, 0x7f, 0xf1, 0xcc, 0x80, 0x37, 0x0, 0x7f,
+    0xf2, 0x28, 0x3, 0x94, 0x3, 0xff, 0x90, 0xe0,
+    0x19, 0x40, 0x3f, 0xf9, 0x8, 0x20, 0x1b, 0x80,
+    0x3f, 0xf9, 0x1a, 0x1, 0x85, 0x0, 0x3f, 0xf9,
+    0x0,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x57, 0x76, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x53,
-    0x23, 0x59, 0xef, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf5, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x20, 0xc, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0,
-    0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfe, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf1, 0x9f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x3b,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf6, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf8, 0xef,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x9e, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf9, 0xef, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x9d, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf8, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfe, 0x0, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0,
-    0xc, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf6, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x20, 0x1, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xb0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfd,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xd8, 0x53, 0x23, 0x69, 0xef,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xb6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x67, 0x76, 0x53, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0xa2, 0xbb, 0x99, 0x4c, 0x3,
+    0xff, 0x9c, 0x4f, 0xbf, 0x75, 0x10, 0x9a, 0xcf,
+    0xb6, 0x0, 0xff, 0xe4, 0x8d, 0x6c, 0x10, 0x7,
+    0xf2, 0x4f, 0xb8, 0x7, 0xff, 0x19, 0xb9, 0x40,
+    0x3f, 0xf8, 0x71, 0xa6, 0x1, 0xff, 0xc3, 0xa9,
+    0x0, 0xff, 0xe3, 0x16, 0x30, 0x7, 0xff, 0x6,
+    0xd4, 0x3, 0xff, 0x93, 0x2c, 0x1, 0xff, 0x52,
+    0x0, 0x7c, 0x4f, 0x59, 0xb9, 0x4c, 0x20, 0x1f,
+    0x4a, 0x80, 0x7f, 0x32, 0x80, 0x78, 0xaf, 0x61,
+    0x4c, 0x8d, 0x67, 0xa0, 0x3, 0xea, 0x20, 0xf,
+    0x8a, 0x40, 0x3c, 0xba, 0x80, 0x1f, 0xcf, 0xa4,
+    0x1, 0xee, 0x0, 0xfa, 0x0, 0x3c, 0xd4, 0x1,
+    0xff, 0x8b, 0x8, 0x3, 0x8d, 0x40, 0x38, 0xd4,
+    0x3, 0x8e, 0x40, 0x3f, 0xf8, 0x43, 0xe0, 0x1e,
+    0x80, 0xe, 0x90, 0xf, 0x78, 0x7, 0xff, 0x10,
+    0x9c, 0x3, 0x89, 0x40, 0x21, 0x50, 0xe, 0x63,
+    0x0, 0xff, 0xe2, 0xc0, 0x80, 0x77, 0x0, 0x4c,
+    0x1, 0xeb, 0x0, 0xff, 0xe3, 0xc8, 0x7, 0x21,
+    0x0, 0x2c, 0x3, 0x8c, 0x80, 0x3f, 0xf8, 0xec,
+    0x1, 0xe4, 0x0, 0x18, 0x7, 0x58, 0x7, 0xff,
+    0x20, 0x4c, 0x3, 0xb0, 0xc, 0x3, 0xc8, 0x1,
+    0xff, 0xc9, 0x40, 0xe, 0x40, 0x50, 0xf, 0x18,
+    0x7, 0xff, 0x27, 0x40, 0x38, 0x45, 0xe0, 0x1c,
+    0x40, 0x1f, 0xfc, 0xa7, 0x0, 0xf1, 0x10, 0x3,
+    0x9c, 0x3, 0xff, 0x94, 0x40, 0x1e, 0x57, 0x0,
+    0xe3, 0x0, 0xff, 0xe5, 0x88, 0x7, 0x8, 0x80,
+    0x3f, 0xfa, 0xfe, 0x60, 0x1c, 0x20, 0x1f, 0xfc,
+    0xb3, 0x0, 0xe1, 0x0, 0xf7, 0x80, 0x7f, 0xf2,
+    0xc4, 0x3, 0xff, 0x78, 0x7, 0xff, 0x2c, 0x40,
+    0x3c, 0x60, 0x1c, 0x20, 0x1f, 0xfc, 0xb3, 0x0,
+    0xe1, 0x10, 0x7, 0xff, 0x5f, 0xdc, 0x3, 0x88,
+    0x3, 0xff, 0x96, 0x20, 0x1c, 0x24, 0x1, 0xcc,
+    0x1, 0xff, 0xca, 0x20, 0xf, 0x2f, 0x80, 0x71,
+    0x0, 0x7f, 0xf2, 0x9c, 0x3, 0xc4, 0xa0, 0x1e,
+    0x30, 0xf, 0xfe, 0x4e, 0x80, 0x70, 0x88, 0xc0,
+    0x3c, 0x80, 0x1f, 0xfc, 0x94, 0x0, 0xe4, 0x0,
+    0x18, 0x7, 0x58, 0x7, 0xff, 0x20, 0x8c, 0x3,
+    0xb0, 0x1, 0x60, 0x1c, 0x64, 0x1, 0xff, 0xc7,
+    0x50, 0xf, 0x20, 0x1, 0x80, 0x3d, 0x60, 0x1f,
+    0xfc, 0x79, 0x0, 0xe4, 0x20, 0x0, 0xa8, 0x7,
+    0x31, 0x80, 0x7f, 0xf1, 0x60, 0x40, 0x3b, 0x80,
+    0x34, 0x80, 0x7b, 0xc0, 0x3f, 0xf8, 0x84, 0xe0,
+    0x1c, 0x4a, 0x1, 0x8d, 0x40, 0x38, 0xe4, 0x3,
+    0xff, 0x84, 0x3e, 0x1, 0xe8, 0x0, 0xf4, 0x0,
+    0x79, 0xa8, 0x3, 0xff, 0x16, 0x10, 0x7, 0x1a,
+    0x80, 0x78, 0xa4, 0x3, 0xcb, 0xa8, 0x1, 0xfc,
+    0xfa, 0x40, 0x1e, 0xe0, 0xf, 0xcc, 0xa0, 0x1e,
+    0x2b, 0xd8, 0x53, 0x23, 0x69, 0xe8, 0x0, 0xfa,
+    0x88, 0x3, 0xfa, 0x90, 0x3, 0xe2, 0x7a, 0xcd,
+    0xc9, 0x61, 0x0, 0xfa, 0x54, 0x3, 0xfe, 0xb5,
+    0x0, 0xff, 0xe4, 0xcb, 0x0, 0x7f, 0xf0, 0x6a,
+    0x40, 0x3f, 0xf8, 0xc5, 0x8c, 0x1, 0xff, 0xc3,
+    0x6e, 0x50, 0xf, 0xfe, 0x1c, 0x69, 0x80, 0x7f,
+    0xf1, 0x46, 0xb6, 0x8, 0x3, 0xf9, 0x27, 0xdc,
+    0x3, 0xff, 0x92, 0x4f, 0xbd, 0x73, 0x10, 0x9a,
+    0xcf, 0xb6, 0x0, 0xff, 0xc0,
 
     /* U+0031 "1" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x88, 0x88, 0x88, 0x88, 0x8b,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xfe, 0x20, 0x7, 0xff, 0xe0, 0xdd,
+    0xff, 0x90, 0x3, 0xc9, 0x11, 0xfd, 0xa0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfe, 0x80,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x56,
-    0x77, 0x65, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa6,
-    0x43, 0x23, 0x46, 0x9e, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xb4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0xaf, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xfe, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0xff, 0xc2, 0x6a, 0xce, 0xe6, 0x54, 0x10,
+    0xf, 0xfe, 0x52, 0xce, 0xf6, 0x54, 0xc4, 0x26,
+    0xaf, 0xb9, 0x48, 0x1, 0xff, 0xc4, 0x19, 0xea,
+    0x62, 0x0, 0xff, 0xa, 0xdf, 0x30, 0x7, 0xff,
+    0x6, 0x79, 0x84, 0x3, 0xff, 0x88, 0x33, 0x84,
+    0x1, 0xfc, 0x7c, 0xc0, 0x1f, 0xfc, 0x93, 0xc3,
+    0x0, 0xf9, 0xb0, 0x40, 0x3f, 0xf9, 0x63, 0xa4,
+    0x1, 0xcd, 0x20, 0x1f, 0x85, 0x66, 0xf3, 0x72,
+    0xe5, 0x84, 0x3, 0xe1, 0xe0, 0xe, 0xd0, 0xf,
+    0x92, 0xfa, 0x99, 0xc, 0x8d, 0x1a, 0x7a, 0x84,
+    0x3, 0xc6, 0xc0, 0x1a, 0xd4, 0x3, 0x16, 0x5a,
+    0x0, 0x7f, 0xcb, 0xe6, 0x1, 0xeb, 0x0, 0xea,
+    0x70, 0x2, 0x69, 0x80, 0x7f, 0xf0, 0x87, 0x44,
+    0x3, 0x88, 0x80, 0x1d, 0x12, 0x96, 0x1, 0xff,
+    0xc5, 0x18, 0x0, 0xf2, 0x0, 0x79, 0xac, 0x3,
+    0xff, 0x8e, 0xe0, 0x1e, 0xe0, 0xf, 0xfe, 0x78,
+    0x88, 0x3, 0x84, 0x3, 0xff, 0xa0, 0x40, 0x1f,
+    0xfd, 0x61, 0x0, 0xe1, 0x0, 0xff, 0xe8, 0x10,
+    0x7, 0x70, 0x7, 0xff, 0x3c, 0xc0, 0x3c, 0x40,
+    0x1f, 0xfc, 0xfb, 0x0, 0xf2, 0x0, 0x7f, 0xf3,
+    0x85, 0x80, 0x39, 0x40, 0x3f, 0xf9, 0xf0, 0x20,
+    0x1d, 0x20, 0x1f, 0xfc, 0xe4, 0x60, 0xe, 0x43,
+    0x0, 0xff, 0xe6, 0x95, 0x0, 0x7a, 0x40, 0x3f,
+    0xf9, 0xa3, 0xe2, 0x1, 0xd0, 0x40, 0x1f, 0xfc,
+    0xc1, 0xc2, 0x0, 0xe4, 0x70, 0xf, 0xfe, 0x60,
+    0xe1, 0x0, 0x71, 0xd8, 0x7, 0xff, 0x30, 0x70,
+    0x80, 0x38, 0xb4, 0x3, 0xff, 0x98, 0x5e, 0x40,
+    0x1c, 0x58, 0x20, 0x1f, 0xfc, 0xb2, 0xc1, 0x0,
+    0xe2, 0xc1, 0x0, 0xff, 0xe5, 0x96, 0x8, 0x7,
+    0x16, 0x8, 0x7, 0xff, 0x2c, 0xb0, 0x40, 0x38,
+    0xb0, 0x40, 0x3f, 0xf9, 0x67, 0x82, 0x1, 0xc7,
+    0x82, 0x1, 0xff, 0xcb, 0x3c, 0x10, 0xe, 0x3c,
+    0x10, 0xf, 0xfe, 0x59, 0xe0, 0x7, 0x8f, 0x0,
+    0x3f, 0xf9, 0x89, 0x80, 0x1e, 0x4c, 0x0, 0xff,
+    0xe6, 0x25, 0x80, 0x79, 0x2c, 0x3, 0xff, 0x98,
+    0x96, 0x1, 0xe5, 0xb0, 0xf, 0xfe, 0x62, 0xd8,
+    0x7, 0x96, 0x80, 0x3f, 0xf9, 0x8b, 0x40, 0x1e,
+    0x5a, 0x0, 0xff, 0xe6, 0x2d, 0x0, 0x79, 0xa8,
+    0x3, 0xff, 0x98, 0xd4, 0x1, 0xe6, 0x90, 0xf,
+    0xfe, 0x63, 0x48, 0x7, 0x84, 0x51, 0x1f, 0xfc,
+    0x94, 0x0, 0x34, 0x80, 0x7c, 0x2e, 0xff, 0xfc,
+    0xad, 0x0, 0x60, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xe4,
 
     /* U+0033 "3" */
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x58, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x8a, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x13, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf6, 0x0, 0x1b, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf3, 0x0, 0x9f, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xd0, 0x3, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0x70, 0xc, 0xff,
-    0xff, 0xff, 0xb5, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x96, 0x43, 0x23,
-    0x46, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x59, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x34, 0x67, 0x77, 0x65, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x57, 0xff, 0xff, 0x44, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xf0, 0x30, 0xd, 0xee, 0xff, 0xfc,
+    0x85, 0x0, 0xf0, 0xe8, 0x6, 0x58, 0x8f, 0xfe,
+    0x43, 0x0, 0x7b, 0x44, 0x3, 0xff, 0x99, 0x46,
+    0x1, 0xd2, 0x60, 0x1f, 0xfc, 0xc7, 0x50, 0xe,
+    0x66, 0x0, 0x7f, 0xf3, 0x12, 0x0, 0x38, 0xe4,
+    0x3, 0xff, 0x98, 0x54, 0x1, 0xc3, 0xa0, 0x1f,
+    0xfc, 0xdf, 0x10, 0xe, 0xd1, 0x0, 0xff, 0xe6,
+    0x59, 0x0, 0x75, 0x18, 0x7, 0xff, 0x32, 0x10,
+    0x3, 0x9d, 0x40, 0x3f, 0xf9, 0x8a, 0xe0, 0x1c,
+    0x90, 0x1, 0xff, 0xcc, 0x2a, 0x0, 0xe2, 0xa0,
+    0xf, 0xfe, 0x60, 0xf8, 0x7, 0xbc, 0x40, 0x3f,
+    0xf9, 0x94, 0x40, 0x1d, 0x44, 0x1, 0xff, 0xcc,
+    0x84, 0x0, 0xe6, 0x50, 0xf, 0xfe, 0x61, 0xb8,
+    0x7, 0x9b, 0xae, 0xc, 0x3, 0xff, 0x92, 0xc0,
+    0x1f, 0x85, 0x1f, 0x3a, 0x4, 0x3, 0xff, 0xa6,
+    0x2f, 0xcc, 0x1, 0xff, 0xd5, 0x9a, 0x0, 0xff,
+    0xea, 0xad, 0x80, 0x7f, 0xf0, 0xd7, 0xff, 0xbb,
+    0x25, 0x40, 0x3f, 0x24, 0x0, 0x7f, 0xf2, 0x4,
+    0xda, 0xbe, 0x44, 0x3, 0xce, 0x40, 0x1f, 0xfc,
+    0xc6, 0xf2, 0x0, 0xf4, 0x0, 0x7f, 0xf3, 0x47,
+    0x4, 0x3, 0x94, 0x3, 0xff, 0x9c, 0x30, 0x1,
+    0xe5, 0x0, 0xff, 0xe7, 0x30, 0x7, 0xb4, 0x3,
+    0xff, 0x9e, 0x60, 0x1c, 0x40, 0x1f, 0xfc, 0xf7,
+    0x0, 0xe1, 0x0, 0xff, 0xea, 0x88, 0x7, 0xff,
+    0x3d, 0x80, 0x38, 0xc0, 0x3f, 0xf9, 0xc4, 0x40,
+    0xe, 0xf0, 0x0, 0xd8, 0x80, 0x7f, 0xf2, 0x6c,
+    0x3, 0xca, 0x0, 0x84, 0xf4, 0x0, 0xff, 0xe3,
+    0xa3, 0x0, 0x71, 0x18, 0x1b, 0x0, 0xdd, 0x88,
+    0x3, 0xff, 0x88, 0x96, 0x1, 0xea, 0x0, 0x78,
+    0x6, 0x4d, 0xb5, 0x10, 0xf, 0xf8, 0xaa, 0xc0,
+    0x3c, 0x2e, 0xa, 0x60, 0x1e, 0x4a, 0xec, 0x96,
+    0x43, 0x23, 0x46, 0x9d, 0xd2, 0x80, 0x7d, 0x40,
+    0x6, 0x10, 0xf, 0xe3, 0x69, 0xbc, 0xdc, 0xb9,
+    0x62, 0x0, 0xfd, 0x28, 0x0, 0x3f, 0x40, 0xf,
+    0xfe, 0x74, 0xb0, 0x6, 0x1b, 0xb1, 0x80, 0x7f,
+    0xf2, 0x8b, 0x18, 0x3, 0xe4, 0xcb, 0x50, 0xf,
+    0xfe, 0x30, 0xce, 0x98, 0x7, 0xf9, 0x2b, 0xa9,
+    0x88, 0x3, 0xfe, 0x16, 0xbe, 0x60, 0xf, 0xfe,
+    0x10, 0xac, 0xef, 0xe5, 0xcc, 0x45, 0x35, 0x9d,
+    0xc9, 0x40, 0xf, 0xe0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x2, 0x44, 0x44,
-    0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x7b, 0xff, 0xff, 0xfc, 0x77, 0x77,
-    0x77, 0x77, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe5, 0xf, 0x7f, 0xf6, 0x80, 0x7f,
+    0xf5, 0x74, 0x40, 0x3b, 0xc0, 0x3f, 0xfa, 0x92,
+    0x60, 0x1d, 0x44, 0x1, 0xff, 0xd3, 0x56, 0x0,
+    0xe7, 0x50, 0xf, 0xfe, 0x99, 0x50, 0x7, 0x1c,
+    0x0, 0x7f, 0xf5, 0x3c, 0x3, 0x87, 0x40, 0x3f,
+    0xfa, 0x96, 0x40, 0x1d, 0x42, 0x1, 0xff, 0xd3,
+    0x74, 0x0, 0xe8, 0x40, 0xf, 0xfe, 0x9a, 0x40,
+    0x7, 0x23, 0x80, 0x7f, 0xf4, 0xc6, 0x80, 0x38,
+    0xa8, 0x3, 0xff, 0xa9, 0xa2, 0x1, 0xdc, 0x20,
+    0x1f, 0xfd, 0x39, 0x30, 0xe, 0x93, 0x0, 0xff,
+    0xe9, 0xab, 0x0, 0x72, 0xb0, 0x7, 0xff, 0x4c,
+    0xa8, 0x3, 0x8a, 0x80, 0x3f, 0xfa, 0x9e, 0x1,
+    0xef, 0x0, 0xff, 0xea, 0x51, 0x0, 0x75, 0x10,
+    0x7, 0xff, 0x4d, 0xd4, 0x3, 0x9d, 0x40, 0x3f,
+    0xfa, 0x67, 0x0, 0x1c, 0x70, 0x1, 0xff, 0xd3,
+    0x1d, 0x0, 0xe1, 0xd0, 0xf, 0xc4, 0x89, 0xc4,
+    0x1, 0xff, 0xc5, 0xd1, 0x0, 0xea, 0x10, 0xf,
+    0xcb, 0x77, 0xd4, 0x1, 0xff, 0xc4, 0x83, 0x0,
+    0xe8, 0x40, 0xf, 0xfe, 0x9a, 0xb8, 0x7, 0x23,
+    0x80, 0x7f, 0xf4, 0xca, 0x80, 0x38, 0xa8, 0x3,
+    0xff, 0xa9, 0xe0, 0x1e, 0xe1, 0x0, 0xff, 0xe9,
+    0xd1, 0x0, 0x74, 0x98, 0x7, 0xff, 0x4d, 0x94,
+    0x3, 0x95, 0x80, 0x3f, 0xfa, 0x67, 0x20, 0x1c,
+    0x54, 0x1, 0xff, 0xd3, 0x1d, 0x0, 0xf7, 0x80,
+    0x7f, 0xf5, 0x28, 0x40, 0x39, 0x15, 0xdf, 0xff,
+    0x87, 0x80, 0x1c, 0x8e, 0xff, 0x81, 0xd0, 0x3,
+    0xc9, 0x11, 0xff, 0xc4, 0x40, 0xe, 0x38, 0x8f,
+    0xc1, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0x6, 0x7f, 0xff, 0xf9, 0x8a, 0x1,
+    0xcf, 0xff, 0xf8, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x80,
 
     /* U+0035 "5" */
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x80, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xdb, 0x97, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x5, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0xab,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x37, 0xdf, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf2, 0x0, 0x49, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xe0, 0x0, 0xdf, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x90, 0x6, 0xff, 0xff,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x30, 0x1e, 0xff,
-    0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x86, 0x43, 0x23,
-    0x46, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x6a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x35, 0x67, 0x77, 0x65, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe5, 0xff, 0xff, 0xe6, 0x80, 0x7e, 0x30,
+    0xf, 0xfe, 0xaf, 0x0, 0x7f, 0xf5, 0x48, 0x3,
+    0xff, 0xaa, 0x20, 0x1f, 0xfd, 0x56, 0x0, 0xe6,
+    0x77, 0xff, 0xe3, 0x80, 0x7e, 0x30, 0xe, 0x98,
+    0x8f, 0xfe, 0x38, 0x7, 0xe1, 0x0, 0xc2, 0x1,
+    0xff, 0xcf, 0x20, 0xe, 0x20, 0xf, 0xfe, 0x78,
+    0x80, 0x73, 0x80, 0x7f, 0xf3, 0xd8, 0x3, 0x88,
+    0x3, 0xff, 0x9e, 0x40, 0x1c, 0x20, 0x1f, 0xfc,
+    0xff, 0x0, 0xee, 0x0, 0xff, 0xe7, 0x90, 0x7,
+    0x18, 0x7, 0xff, 0x3c, 0x40, 0x39, 0x80, 0x3f,
+    0xf9, 0xec, 0x1, 0xc4, 0x1, 0xff, 0xcf, 0x20,
+    0xe, 0x10, 0xf, 0xfe, 0xa0, 0x80, 0x7f, 0xf3,
+    0xc8, 0x3, 0x87, 0xff, 0xee, 0xdb, 0x97, 0x30,
+    0xf, 0xfe, 0x10, 0x80, 0x7f, 0xf0, 0x44, 0x91,
+    0xa3, 0x3e, 0xd4, 0x3, 0xfe, 0x60, 0xf, 0xfe,
+    0x42, 0x57, 0x28, 0x7, 0xf1, 0x0, 0x7f, 0xf2,
+    0x86, 0xac, 0x40, 0x3e, 0xf0, 0xf, 0xfe, 0x62,
+    0x60, 0x80, 0x7b, 0x5d, 0xff, 0xe6, 0x54, 0x20,
+    0xf, 0xf1, 0x68, 0x7, 0x96, 0x23, 0xfe, 0x9a,
+    0xbd, 0xfc, 0x82, 0x0, 0xf8, 0xe4, 0x3, 0xff,
+    0x94, 0x6f, 0xb4, 0x20, 0x1e, 0x62, 0x0, 0xff,
+    0xe6, 0x2e, 0x10, 0x7, 0xac, 0x3, 0xff, 0x9a,
+    0x5c, 0x1, 0xe7, 0x0, 0xff, 0xe7, 0x1b, 0x0,
+    0x70, 0x98, 0x7, 0xff, 0x3a, 0x80, 0x3c, 0xc0,
+    0x1f, 0xfc, 0xe3, 0x0, 0xf1, 0x0, 0x7f, 0xff,
+    0xc0, 0x3f, 0xf8, 0xe2, 0x1, 0xe2, 0x0, 0xff,
+    0xe7, 0x38, 0x7, 0x9c, 0x0, 0x92, 0x1, 0xff,
+    0xca, 0xb0, 0xe, 0x12, 0x0, 0x4b, 0x61, 0x0,
+    0x7f, 0xf1, 0xe0, 0x80, 0x39, 0xc0, 0xc, 0x40,
+    0x7b, 0x22, 0x1, 0xff, 0xc4, 0x87, 0x0, 0xf5,
+    0x0, 0xc0, 0x6, 0x6e, 0xa4, 0x0, 0xff, 0xc9,
+    0xae, 0x1, 0xe5, 0x30, 0x81, 0x0, 0xf2, 0xdf,
+    0xdc, 0x32, 0x19, 0x1a, 0x34, 0xf5, 0x90, 0x7,
+    0x86, 0xc0, 0x1e, 0x1, 0xfe, 0x47, 0x9b, 0xcd,
+    0xcb, 0x96, 0x10, 0xf, 0xd4, 0x20, 0x6, 0xc3,
+    0x0, 0xff, 0xe6, 0x8d, 0xa0, 0x6, 0x3c, 0x91,
+    0x0, 0xff, 0xe5, 0x1e, 0x20, 0x7, 0xcd, 0xd4,
+    0x80, 0x1f, 0xfc, 0x62, 0xac, 0x20, 0xf, 0xf2,
+    0xdf, 0x4a, 0x90, 0x7, 0xfc, 0x4d, 0x9a, 0xa0,
+    0x1f, 0xfc, 0x21, 0x6a, 0xde, 0xca, 0x98, 0x8a,
+    0x6b, 0x3b, 0x64, 0xc0, 0x3f, 0x80,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x56, 0x77, 0x66, 0x42, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xfe, 0xa6, 0x31, 0x0, 0x1, 0x36, 0x9e, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x26, 0xac, 0xef, 0xff, 0xeb,
-    0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xa0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf9, 0x0, 0x2c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x80, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0xe, 0xff, 0xff, 0xf7, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xef, 0xff, 0xff, 0xbf,
-    0xff, 0xff, 0xff, 0xb7, 0x43, 0x23, 0x58, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf6,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xd0, 0xaf, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf6, 0x6f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x93, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xb0, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfb, 0x6, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x90, 0x1f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf6, 0x0, 0x9f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x30,
-    0x2, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xd0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x39,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xba, 0xbc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x77, 0x65,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe2, 0x9a, 0xb3, 0xb9, 0x98, 0x84,
+    0x1, 0xff, 0xca, 0x38, 0xdf, 0xca, 0x98, 0x84,
+    0xca, 0xf7, 0xf1, 0xcc, 0x3, 0xff, 0x88, 0xdb,
+    0x8e, 0x40, 0x1f, 0xf1, 0xc6, 0x61, 0x40, 0x3f,
+    0xf2, 0xf4, 0x90, 0x7, 0xff, 0x14, 0xe8, 0xc0,
+    0x3f, 0xd5, 0x41, 0x0, 0xff, 0xe4, 0x21, 0x80,
+    0x7e, 0x1c, 0x50, 0xf, 0xfe, 0x54, 0x0, 0x7e,
+    0x1c, 0x30, 0xf, 0x85, 0x67, 0x3b, 0xfe, 0xec,
+    0x96, 0x10, 0x1, 0x98, 0x3, 0xf6, 0x90, 0x7,
+    0x8a, 0x7a, 0x98, 0xc4, 0x2, 0x13, 0x69, 0xea,
+    0x18, 0x0, 0xfd, 0x26, 0x1, 0xe7, 0xd6, 0x0,
+    0xff, 0xe0, 0xaf, 0x20, 0x7, 0xc6, 0xc0, 0x1e,
+    0xa8, 0x0, 0xff, 0xe6, 0xf8, 0x7, 0xa5, 0x40,
+    0x3f, 0xf9, 0xaa, 0x60, 0x1c, 0xac, 0x1, 0xff,
+    0xce, 0x90, 0xe, 0x1b, 0x0, 0xff, 0xe7, 0x19,
+    0x80, 0x3a, 0x4, 0x3, 0xff, 0x9d, 0x60, 0x1e,
+    0x60, 0xf, 0xfe, 0x7a, 0x80, 0x73, 0x0, 0x7f,
+    0xf3, 0xc4, 0x80, 0x3b, 0x40, 0x3f, 0xf9, 0xe8,
+    0x1, 0xe5, 0x0, 0xff, 0xe7, 0x90, 0x7, 0x8,
+    0x80, 0x3f, 0xf9, 0xfc, 0x1, 0xca, 0x1, 0xe2,
+    0x6a, 0xce, 0xff, 0xba, 0xe5, 0x44, 0x3, 0xf8,
+    0x80, 0x38, 0x40, 0x32, 0xe6, 0xca, 0x98, 0x80,
+    0x42, 0x8d, 0x5d, 0x46, 0x1, 0xf3, 0x80, 0x71,
+    0x80, 0xb, 0x28, 0xc0, 0x3f, 0xf8, 0x2b, 0x94,
+    0x20, 0x1c, 0x20, 0x1c, 0x20, 0xba, 0x60, 0x1f,
+    0xfc, 0x55, 0xf4, 0x0, 0xc6, 0x1, 0xde, 0xd4,
+    0x1, 0xff, 0xc8, 0x1b, 0x40, 0xf, 0xec, 0x90,
+    0xf, 0x24, 0x5e, 0x6e, 0x53, 0x98, 0x7, 0xeb,
+    0x20, 0xf, 0xc8, 0x1, 0xcf, 0xd6, 0xe8, 0x64,
+    0x6b, 0x19, 0xaa, 0x1, 0xf7, 0x80, 0xc, 0x3,
+    0xf8, 0x72, 0x4, 0x3, 0xf8, 0xaa, 0xc0, 0x3c,
+    0x4c, 0x2, 0x1, 0xf8, 0x70, 0xc0, 0x3f, 0xf8,
+    0x29, 0x60, 0x1e, 0xb0, 0x60, 0xf, 0xd4, 0x40,
+    0x1f, 0xfc, 0x34, 0x70, 0xe, 0x23, 0x20, 0xf,
+    0x91, 0x0, 0x1f, 0xfc, 0x59, 0x0, 0xf2, 0xf0,
+    0x7, 0xdc, 0x1, 0xff, 0xc6, 0x14, 0x0, 0xef,
+    0x50, 0xf, 0x9c, 0x3, 0xff, 0x8e, 0x40, 0x1c,
+    0x46, 0x1, 0xf1, 0x0, 0x7f, 0xf1, 0xf8, 0x3,
+    0xe4, 0x0, 0xff, 0xe7, 0x78, 0x7, 0xda, 0x1,
+    0xe3, 0x0, 0xff, 0xe3, 0x90, 0x7, 0x10, 0x38,
+    0x7, 0x90, 0x3, 0xff, 0x8e, 0x80, 0x1d, 0xe0,
+    0x2c, 0x1, 0xd2, 0x1, 0xff, 0xc6, 0x41, 0x0,
+    0xe5, 0x0, 0x58, 0x7, 0xc, 0x80, 0x7f, 0xf1,
+    0x64, 0x3, 0x88, 0xc0, 0x4, 0xe0, 0x1c, 0xce,
+    0x1, 0xff, 0xc3, 0xb2, 0x0, 0xeb, 0x0, 0xd0,
+    0x40, 0x1d, 0x14, 0x20, 0x1f, 0xf1, 0x62, 0x0,
+    0x71, 0x30, 0x7, 0x78, 0x7, 0x97, 0xa4, 0xc0,
+    0x3e, 0x39, 0xd3, 0x0, 0xf7, 0x0, 0x78, 0xac,
+    0x3, 0xe6, 0xcf, 0xcb, 0xab, 0xcf, 0xc6, 0x0,
+    0xfa, 0x8c, 0x3, 0xe4, 0xb1, 0x0, 0xfc, 0x68,
+    0xa8, 0x60, 0x1f, 0xd4, 0xa0, 0x1f, 0xc9, 0x86,
+    0x1, 0xff, 0xc7, 0x2c, 0x50, 0xf, 0xf8, 0xb2,
+    0x88, 0x3, 0xff, 0x86, 0x31, 0xa6, 0x1, 0xff,
+    0xc2, 0x5d, 0xb6, 0x20, 0xf, 0xf2, 0x57, 0x38,
+    0x7, 0xff, 0x19, 0x27, 0x7a, 0xe6, 0x22, 0x9a,
+    0xdf, 0xb5, 0x0, 0xfe,
 
     /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91,
-    0xff, 0xff, 0xff, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0xcf, 0xff, 0xff,
-    0xf3, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xfc, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x40, 0x1f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xd0, 0x1, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x1f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x99, 0x99, 0x99, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfe, 0xad, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfe, 0x84, 0x1, 0xf3, 0xbf, 0xff, 0x20,
+    0xc0, 0x3d, 0x40, 0x1f, 0x4c, 0x47, 0xff, 0x1c,
+    0x40, 0x38, 0xcc, 0x1, 0xff, 0xce, 0x52, 0x0,
+    0xe8, 0x0, 0xff, 0xe7, 0xc8, 0x7, 0x12, 0x0,
+    0x7f, 0xf3, 0x8c, 0xc0, 0x1d, 0x60, 0x1f, 0xfc,
+    0xf8, 0x0, 0xe1, 0x60, 0xf, 0xfe, 0x71, 0x20,
+    0x7, 0x30, 0x7, 0xff, 0x3e, 0xc0, 0x3d, 0x20,
+    0x10, 0xb3, 0x78, 0x40, 0x3f, 0xf8, 0x62, 0xc0,
+    0x1c, 0xa2, 0x1, 0xa6, 0x7c, 0x1, 0xff, 0xc4,
+    0x60, 0xf, 0x40, 0x7, 0xff, 0x3e, 0x40, 0x39,
+    0x8, 0x3, 0xff, 0x9c, 0xc2, 0x1, 0xde, 0x1,
+    0xff, 0xcf, 0xb0, 0xe, 0x24, 0x0, 0xff, 0xe7,
+    0x21, 0x0, 0x75, 0x80, 0x7f, 0xf3, 0xfc, 0x3,
+    0x85, 0x80, 0x3f, 0xf9, 0xc4, 0x80, 0x1c, 0xc0,
+    0x1f, 0xfc, 0xf8, 0x0, 0xf4, 0x80, 0x7f, 0xf3,
+    0x85, 0x40, 0x39, 0x84, 0x3, 0xff, 0x9d, 0x20,
+    0x1e, 0xb0, 0xf, 0xfe, 0x7b, 0x0, 0x72, 0x10,
+    0x7, 0xff, 0x39, 0x84, 0x3, 0xbc, 0x3, 0xff,
+    0x9f, 0x60, 0x1c, 0x48, 0x1, 0xff, 0xce, 0x52,
+    0x0, 0xeb, 0x0, 0xff, 0xe7, 0xc8, 0x7, 0xb,
+    0x0, 0x7f, 0xf3, 0x8c, 0xc0, 0x1c, 0xc0, 0x1f,
+    0xfc, 0xf9, 0x0, 0xf4, 0x80, 0x7f, 0xf3, 0x89,
+    0x40, 0x39, 0x84, 0x3, 0xff, 0x9d, 0x60, 0x1e,
+    0xb0, 0xf, 0xfe, 0x70, 0xb0, 0x7, 0x21, 0x0,
+    0x7f, 0xf3, 0x98, 0x3, 0xde, 0x1, 0xff, 0xcf,
+    0x90, 0xe, 0x24, 0x0, 0xff, 0xe7, 0x28, 0x80,
+    0x75, 0x80, 0x7f, 0xf3, 0xe0, 0x3, 0x85, 0x80,
+    0x3f, 0xf9, 0xc8, 0x40, 0x1d, 0x20, 0x1f, 0xfc,
+    0xff, 0x0, 0xf3, 0x0, 0x7f, 0xf3, 0x89, 0x0,
+    0x39, 0x84, 0x3, 0xff, 0x9d, 0x60, 0x1e, 0xb0,
+    0xf, 0xfe, 0x70, 0xb0, 0x7, 0x21, 0x0, 0x7f,
+    0xf3, 0xa4, 0x3, 0xde, 0x1, 0xff, 0xcf, 0x60,
+    0xe, 0x24, 0x0, 0xff, 0xe2, 0x80,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0x67, 0x77, 0x65, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xec, 0xba, 0xbc, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x0,
-    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x10,
-    0x0, 0x0, 0x14, 0x9e, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x31, 0x0,
-    0x1, 0x36, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xfd, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf6,
-    0x0, 0x9f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xc0, 0xd, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x52, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf6, 0x1f, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x50,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf3, 0xc, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xa0, 0x1,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfb, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xa5, 0x10, 0x0, 0x0, 0x0, 0x14,
-    0xaf, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xba,
-    0xbc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x35, 0x67, 0x77, 0x65, 0x31, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x12, 0xb3, 0xbc, 0xca, 0x60,
+    0x1f, 0xfc, 0xc2, 0x7c, 0xfd, 0xa9, 0x88, 0xa6,
+    0xb3, 0xf6, 0xc, 0x3, 0xff, 0x8c, 0x77, 0xb0,
+    0x60, 0x1f, 0xf1, 0x3e, 0x6a, 0x80, 0x7f, 0xf0,
+    0x86, 0xb1, 0x0, 0x3f, 0xf8, 0xa5, 0x58, 0x40,
+    0x1f, 0xf1, 0x62, 0x80, 0x7f, 0xf2, 0x4f, 0xc,
+    0x3, 0xf8, 0x7c, 0x80, 0x3f, 0x9, 0xa2, 0xa1,
+    0x88, 0x7, 0xe1, 0xc3, 0x0, 0xfd, 0x44, 0x1,
+    0xe1, 0x7d, 0xec, 0xba, 0xbc, 0xee, 0x41, 0x0,
+    0x7d, 0xa0, 0x1f, 0x2a, 0x0, 0x79, 0xba, 0x8,
+    0x3, 0xe1, 0x7d, 0x80, 0xf, 0xc, 0x0, 0x7a,
+    0x40, 0x3d, 0x12, 0x1, 0xff, 0xc1, 0x7b, 0x0,
+    0xf3, 0x80, 0x71, 0x18, 0x7, 0x23, 0x80, 0x7f,
+    0xf0, 0xd2, 0x0, 0x3c, 0xa0, 0x19, 0xc0, 0x3d,
+    0x0, 0x1f, 0xfc, 0x57, 0x10, 0xe, 0xc0, 0xc,
+    0x40, 0x1c, 0x26, 0x1, 0xff, 0xc6, 0x40, 0xe,
+    0x20, 0xd, 0xe0, 0x1c, 0x40, 0x1f, 0xfc, 0x72,
+    0x0, 0xe7, 0x0, 0xff, 0xec, 0x38, 0x6, 0xe0,
+    0xe, 0x20, 0xf, 0xfe, 0x39, 0x0, 0x70, 0x80,
+    0x65, 0x0, 0xe1, 0x30, 0xf, 0xfe, 0x32, 0x80,
+    0x76, 0x0, 0x63, 0x10, 0xe, 0xf0, 0xf, 0xfe,
+    0x2c, 0x0, 0x79, 0xc0, 0x39, 0x80, 0x38, 0xe0,
+    0x3, 0xff, 0x86, 0xae, 0x1, 0xca, 0x20, 0x1d,
+    0x2, 0x1, 0xcf, 0x42, 0x1, 0xff, 0xa2, 0x80,
+    0x3d, 0x0, 0x1f, 0x68, 0x7, 0x97, 0xa9, 0x44,
+    0x3, 0x85, 0x27, 0x9c, 0x3, 0xd4, 0x40, 0x1f,
+    0x1d, 0x88, 0x7, 0x96, 0xbb, 0xfb, 0x7b, 0xfa,
+    0xd8, 0x40, 0x3d, 0x4a, 0x1, 0xfc, 0x9e, 0x80,
+    0x1f, 0xc2, 0x42, 0x1, 0xfc, 0x78, 0xa0, 0x1f,
+    0xf0, 0xd1, 0x80, 0x7f, 0xf1, 0xcb, 0x8c, 0x3,
+    0xff, 0x47, 0x18, 0x7, 0xff, 0x1c, 0xb6, 0x84,
+    0x3, 0xf8, 0xb5, 0xc0, 0x3f, 0xf9, 0x6b, 0xe8,
+    0x1, 0xf1, 0xe9, 0x0, 0x7c, 0xb3, 0x9d, 0xff,
+    0x76, 0x4b, 0x8, 0x7, 0x86, 0xd4, 0x3, 0x87,
+    0x40, 0x3c, 0x33, 0xf4, 0xc6, 0x20, 0x10, 0x9b,
+    0x4f, 0x50, 0x80, 0x7a, 0x8c, 0x3, 0x50, 0x80,
+    0x71, 0xfb, 0x0, 0x7f, 0xf0, 0x57, 0x94, 0x3,
+    0xdc, 0x1, 0x1a, 0x0, 0x71, 0xe0, 0x80, 0x7f,
+    0xf1, 0x29, 0x40, 0x38, 0x98, 0x1, 0x40, 0x1e,
+    0xe0, 0xf, 0xfe, 0x3d, 0x8, 0x7, 0x50, 0x1,
+    0x0, 0x39, 0x48, 0x3, 0xff, 0x91, 0x20, 0x1c,
+    0x62, 0x4, 0x1, 0xd8, 0x1, 0xff, 0xc9, 0x50,
+    0xf, 0x29, 0x0, 0x78, 0x80, 0x3f, 0xf9, 0x26,
+    0x1, 0xe1, 0x0, 0xff, 0xe8, 0x88, 0x7, 0x8c,
+    0xc0, 0x1e, 0x10, 0xf, 0xfe, 0x49, 0x0, 0x78,
+    0xc4, 0x3, 0xde, 0x1, 0xff, 0xc9, 0x40, 0xf,
+    0x30, 0x18, 0x7, 0x28, 0x80, 0x7f, 0xf2, 0x28,
+    0x3, 0xc6, 0x16, 0x1, 0xeb, 0x0, 0xff, 0xe3,
+    0xb9, 0x80, 0x72, 0x80, 0x18, 0x3, 0xcb, 0x0,
+    0x1f, 0xfc, 0x56, 0x80, 0xf, 0x70, 0x0, 0x5c,
+    0x3, 0xcf, 0x64, 0x1, 0xff, 0xc1, 0x1a, 0x90,
+    0xf, 0x22, 0x0, 0x28, 0x30, 0xf, 0x26, 0xd2,
+    0x88, 0x7, 0xc2, 0x95, 0xca, 0x1, 0xe1, 0xa0,
+    0xe, 0xd2, 0x0, 0xf9, 0x6b, 0xb9, 0x97, 0x57,
+    0x9d, 0xcb, 0x50, 0xf, 0xda, 0x20, 0x1c, 0x38,
+    0x60, 0x1f, 0xc2, 0x68, 0xa8, 0x62, 0x1, 0xfc,
+    0x38, 0x60, 0x1f, 0xe, 0x38, 0x7, 0xff, 0x2d,
+    0x7c, 0xc0, 0x3f, 0xd1, 0xcc, 0x1, 0xff, 0xc7,
+    0x5c, 0xa1, 0x0, 0xff, 0xc3, 0x3f, 0x4a, 0x20,
+    0x1f, 0xf0, 0xa4, 0xf5, 0x18, 0x7, 0xff, 0x15,
+    0x6b, 0xb9, 0x95, 0x31, 0x14, 0xd6, 0x77, 0x2d,
+    0x84, 0x3, 0xf8,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x67,
-    0x77, 0x64, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xdb, 0xaa, 0xbd, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xfd, 0x61, 0x0, 0x0, 0x0, 0x15, 0xcf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0x90, 0x0, 0x9, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf1, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf8, 0x0,
-    0xf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfd, 0x0, 0x2f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x30, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x70, 0x2f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xb0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xe0, 0xe, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xf0, 0xa, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0xef, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0x31, 0x0, 0x13, 0x6b, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0xf6, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x30, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x59, 0xdf, 0xff, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xc7, 0x42, 0x0, 0x0,
-    0x14, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x35, 0x67, 0x76, 0x64, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc2, 0x6c, 0xef, 0x32, 0x10, 0x7,
+    0xff, 0x30, 0xa3, 0x7b, 0x26, 0x22, 0x9b, 0xdf,
+    0xb6, 0x10, 0xf, 0xfe, 0x31, 0x5e, 0xb9, 0x0,
+    0x7f, 0x92, 0x7a, 0x44, 0x3, 0xff, 0x87, 0x1a,
+    0x80, 0x1f, 0xfc, 0x46, 0xe6, 0x0, 0xff, 0xe0,
+    0xdb, 0x80, 0x7f, 0xf2, 0x26, 0x80, 0x3f, 0xec,
+    0x40, 0xf, 0xc4, 0x8a, 0xa4, 0x20, 0xf, 0xcb,
+    0x60, 0x1f, 0xd2, 0x60, 0x1e, 0x29, 0xed, 0xba,
+    0xa5, 0xef, 0x51, 0x80, 0x79, 0x24, 0x3, 0xe4,
+    0x60, 0xf, 0x46, 0xb0, 0x80, 0x78, 0x57, 0x28,
+    0x40, 0x39, 0x98, 0x1, 0xe9, 0x0, 0xf5, 0xb8,
+    0x7, 0xfe, 0x5f, 0x20, 0xe, 0x91, 0x0, 0xc8,
+    0x40, 0x1d, 0x28, 0x1, 0xff, 0xc2, 0x1f, 0x10,
+    0xe, 0x80, 0xd, 0xa0, 0x1c, 0x4c, 0x1, 0xff,
+    0xc4, 0x28, 0x0, 0xe6, 0x10, 0x9, 0x0, 0x3a,
+    0x80, 0x3f, 0xf8, 0xcc, 0x20, 0x1d, 0x20, 0x11,
+    0x0, 0x72, 0x80, 0x7f, 0xf1, 0xd0, 0x3, 0x94,
+    0x0, 0x40, 0x1e, 0x30, 0xf, 0xfe, 0x39, 0x0,
+    0x71, 0x18, 0x8, 0x7, 0x84, 0x3, 0xff, 0x8f,
+    0xe0, 0x1e, 0x40, 0x10, 0xf, 0x8, 0x7, 0xff,
+    0x1f, 0xc0, 0x3d, 0x80, 0x60, 0x1e, 0x50, 0xf,
+    0xfe, 0x3a, 0x0, 0x79, 0x40, 0x44, 0x1, 0xd8,
+    0x1, 0xff, 0xc6, 0x23, 0x0, 0xf0, 0x80, 0x10,
+    0x3, 0x9c, 0x40, 0x3f, 0xf8, 0xb0, 0x1, 0xf8,
+    0x83, 0xc0, 0x3d, 0x60, 0x1f, 0xfc, 0x46, 0x50,
+    0xf, 0xcc, 0xa, 0x20, 0x1c, 0xb2, 0x1, 0xff,
+    0xc2, 0x69, 0x0, 0xfe, 0x10, 0x5, 0x80, 0x79,
+    0xb0, 0xc0, 0x3f, 0xc5, 0x72, 0x1, 0xfe, 0x30,
+    0x2, 0xa8, 0x3, 0xc7, 0x98, 0x73, 0x10, 0x0,
+    0x9b, 0x5e, 0xa0, 0x6, 0x20, 0xf, 0xf5, 0x98,
+    0x7, 0xc7, 0x19, 0xdf, 0xee, 0xc9, 0x40, 0xe,
+    0x1f, 0x0, 0xff, 0xe, 0x98, 0x7, 0xff, 0x20,
+    0x70, 0x80, 0x3c, 0x60, 0x18, 0x71, 0xc0, 0x3f,
+    0xf8, 0xcb, 0xe4, 0x20, 0x1e, 0x10, 0xf, 0x46,
+    0xb0, 0x7, 0xff, 0x9, 0x32, 0x84, 0xc, 0x3,
+    0xce, 0x1, 0xf1, 0x4f, 0xd3, 0x10, 0x7, 0x89,
+    0x67, 0xac, 0xc0, 0x21, 0x0, 0xf1, 0x0, 0x7f,
+    0x96, 0x77, 0xfb, 0xb7, 0xed, 0x30, 0x80, 0x73,
+    0x0, 0x78, 0x40, 0x3f, 0xf8, 0x42, 0x38, 0x3,
+    0xfd, 0x80, 0x1c, 0x40, 0x1f, 0xfd, 0x15, 0x0,
+    0xe4, 0x0, 0xff, 0xe8, 0x9, 0x80, 0x76, 0x0,
+    0x7f, 0xf4, 0x18, 0x3, 0xca, 0x1, 0xff, 0xd0,
+    0x90, 0xe, 0x40, 0xf, 0xfe, 0x83, 0x8, 0x7,
+    0x78, 0x7, 0xff, 0x3c, 0xa4, 0x3, 0x89, 0x0,
+    0x3f, 0xf9, 0xfc, 0x1, 0xe8, 0x0, 0xff, 0xe7,
+    0xd9, 0x80, 0x72, 0x28, 0x7, 0xff, 0x34, 0xf5,
+    0x0, 0x3d, 0x20, 0x1f, 0xd9, 0x22, 0x1, 0xff,
+    0x8a, 0x70, 0x80, 0x3d, 0x64, 0x1, 0xf9, 0xd,
+    0xbb, 0x1d, 0x8, 0x3, 0xa, 0x3e, 0x6b, 0x0,
+    0x7d, 0x8, 0x1, 0xfd, 0xe0, 0x11, 0xc5, 0xef,
+    0xfe, 0xeb, 0x83, 0x0, 0xfd, 0x2e, 0x1, 0xfc,
+    0x68, 0x1, 0xff, 0xc9, 0x1b, 0x60, 0xf, 0xf4,
+    0x0, 0x7f, 0xf2, 0x57, 0xd0, 0x3, 0xfe, 0xa6,
+    0x0, 0xff, 0xe3, 0x2e, 0xd0, 0x80, 0x7f, 0xe1,
+    0x9f, 0xa5, 0x10, 0xf, 0xf0, 0xa4, 0xf5, 0x10,
+    0x7, 0xff, 0x15, 0x6b, 0xb9, 0x95, 0x31, 0x9,
+    0x95, 0xf7, 0x2d, 0x84, 0x3, 0xff, 0x82,
 
     /* U+003A ":" */
-    0x0, 0x19, 0xef, 0xd6, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0x80, 0xa, 0xff, 0xff, 0xff, 0xf2, 0xf,
-    0xff, 0xff, 0xff, 0xf6, 0xf, 0xff, 0xff, 0xff,
-    0xf7, 0xe, 0xff, 0xff, 0xff, 0xf5, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0xaf, 0xff, 0xff, 0x30,
-    0x0, 0x5, 0x9a, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9a,
-    0x82, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x40, 0x7,
-    0xff, 0xff, 0xff, 0xe1, 0xe, 0xff, 0xff, 0xff,
-    0xf5, 0xf, 0xff, 0xff, 0xff, 0xf7, 0xf, 0xff,
-    0xff, 0xff, 0xf6, 0xa, 0xff, 0xff, 0xff, 0xf2,
-    0x1, 0xef, 0xff, 0xff, 0x70, 0x0, 0x19, 0xef,
-    0xc5, 0x0,
+    0x0, 0xc, 0xf7, 0xeb, 0x0, 0x43, 0xec, 0x20,
+    0x53, 0x0, 0xb, 0x10, 0xe, 0x72, 0x5, 0x0,
+    0xf9, 0x0, 0x3f, 0x84, 0x4, 0x3, 0xe2, 0x9,
+    0x0, 0xf0, 0xa8, 0x3a, 0x80, 0x76, 0x80, 0x55,
+    0x46, 0x57, 0xe3, 0x0, 0xcb, 0x35, 0x2, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x72, 0x4d,
+    0x41, 0x0, 0x6a, 0xb6, 0x57, 0xd4, 0x0, 0x3a,
+    0x80, 0x75, 0x8, 0x48, 0x7, 0x85, 0x0, 0x40,
+    0x3e, 0x20, 0xf, 0xe1, 0x5, 0x0, 0xf9, 0x2,
+    0xc4, 0x3, 0xa0, 0x80, 0x7d, 0x84, 0xe, 0x9c,
+    0x0,
 
     /* U+003B ";" */
-    0x0, 0x19, 0xef, 0xd6, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0x80, 0xa, 0xff, 0xff, 0xff, 0xf2, 0xf,
-    0xff, 0xff, 0xff, 0xf6, 0xf, 0xff, 0xff, 0xff,
-    0xf7, 0xe, 0xff, 0xff, 0xff, 0xf5, 0x7, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0xaf, 0xff, 0xff, 0x30,
-    0x0, 0x5, 0x9a, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xef, 0xd6, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0x80, 0x8, 0xff, 0xff, 0xff,
-    0xf2, 0xd, 0xff, 0xff, 0xff, 0xf6, 0xe, 0xff,
-    0xff, 0xff, 0xf7, 0xb, 0xff, 0xff, 0xff, 0xf6,
-    0x4, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x7f, 0xff,
-    0xff, 0xe0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0,
-    0x8, 0xff, 0xff, 0x30, 0x0, 0xc, 0xff, 0xfe,
-    0x0, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0x4f,
-    0xff, 0xf3, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0,
-    0x0, 0xcf, 0xff, 0x80, 0x0, 0x0, 0xff, 0xff,
-    0x20, 0x0, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x6,
-    0xbb, 0xb6, 0x0, 0x0,
+    0x0, 0xc, 0xf7, 0xeb, 0x0, 0x43, 0xec, 0x20,
+    0x53, 0x0, 0xb, 0x10, 0xe, 0x72, 0x5, 0x0,
+    0xf9, 0x0, 0x3f, 0x84, 0x4, 0x3, 0xe2, 0x9,
+    0x0, 0xf0, 0xa8, 0x3a, 0x80, 0x76, 0x80, 0x55,
+    0x46, 0x57, 0xe3, 0x0, 0xcb, 0x35, 0x2, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf0,
+    0x86, 0x7b, 0xf5, 0x80, 0x21, 0xc6, 0x10, 0x29,
+    0x80, 0x4, 0x90, 0x7, 0x39, 0x2, 0x80, 0x7c,
+    0x80, 0x60, 0x1f, 0x8, 0x28, 0x7, 0xc2, 0x1e,
+    0x1, 0xf2, 0x82, 0x40, 0x7, 0x9, 0x80, 0x1e,
+    0x80, 0x33, 0x80, 0x6d, 0x0, 0xd4, 0x1, 0x90,
+    0x2, 0x13, 0x0, 0xc6, 0x1, 0x30, 0x6, 0x40,
+    0xd, 0x60, 0x1b, 0x0, 0x22, 0x30, 0xc, 0x80,
+    0x12, 0x80, 0x71, 0x80, 0x54, 0x1, 0x90, 0x2,
+    0x22, 0x0, 0x62, 0x44, 0xac, 0x3,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xae, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7d, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x80,
+    0x0, 0xff, 0xe8, 0x8, 0x7, 0xff, 0x39, 0x2b,
+    0xc0, 0x3f, 0xf9, 0x62, 0xfb, 0x6a, 0x20, 0x1f,
+    0xfc, 0x94, 0xbe, 0x82, 0x0, 0xff, 0xe4, 0x94,
+    0x75, 0xa0, 0x7, 0xff, 0x29, 0x6f, 0x5c, 0x40,
+    0x3f, 0xf9, 0x25, 0x3d, 0x48, 0x1, 0xfc, 0xd8,
+    0x1, 0xff, 0x36, 0x6b, 0x8, 0x7, 0xe3, 0xaf,
+    0x93, 0x0, 0xfc, 0x73, 0xf2, 0x60, 0x1f, 0x85,
+    0xf7, 0x14, 0x3, 0xf0, 0xb6, 0xe3, 0x0, 0x7f,
+    0x2d, 0xf4, 0x10, 0x7, 0xe3, 0xae, 0x92, 0x0,
+    0xfc, 0x51, 0xd4, 0x80, 0x1f, 0x85, 0xf7, 0x14,
+    0x3, 0xf0, 0xb6, 0x6b, 0x88, 0x7, 0xfa, 0xa0,
+    0x80, 0x3f, 0x25, 0x74, 0x98, 0x7, 0xff, 0x24,
+    0x5f, 0xad, 0x40, 0x3f, 0xf9, 0x47, 0x7d, 0x2,
+    0x1, 0xff, 0xcc, 0x38, 0x60, 0xf, 0xfe, 0x79,
+    0xcf, 0xc9, 0x80, 0x7f, 0xf1, 0x70, 0x40, 0x3f,
+    0x36, 0x6b, 0x88, 0x7, 0xff, 0x9, 0xfa, 0x8c,
+    0x3, 0xf1, 0x47, 0x5a, 0x0, 0x7f, 0xf0, 0x97,
+    0x35, 0xc4, 0x3, 0xf2, 0x5f, 0x41, 0x0, 0x7f,
+    0xf0, 0x4a, 0x3a, 0x90, 0x3, 0xf0, 0xbe, 0xe3,
+    0x0, 0x7f, 0xf0, 0x96, 0xfa, 0x4, 0x3, 0xf1,
+    0xcf, 0xc9, 0x80, 0x7f, 0xf0, 0x45, 0xfa, 0xd4,
+    0x3, 0xf9, 0xb3, 0x5c, 0x40, 0x3f, 0xf8, 0x29,
+    0x5d, 0x4, 0x1, 0xf8, 0xa3, 0xa8, 0x3, 0xff,
+    0x84, 0x2f, 0xb8, 0xa0, 0x1f, 0xca, 0x1, 0xff,
+    0xc5, 0x3a, 0xe9, 0x30, 0xf, 0xfe, 0x70, 0xb6,
+    0x61, 0x80, 0x3f, 0xf9, 0xe7, 0x3f, 0x26, 0x1,
+    0xff, 0xcf, 0x6c, 0xd7,
 
     /* U+003D "=" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0,
+    0x0, 0xff, 0xe8, 0xdf, 0xff, 0xff, 0x40, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xdd, 0xbf, 0xff, 0xfe,
+    0x80, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xec, 0x5f, 0xff, 0xff,
+    0x40, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xdd,
 
     /* U+003E ">" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xe8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0xf, 0xfe, 0x85, 0x62, 0x80, 0x7f, 0xf3,
+    0xce, 0xba, 0x48, 0x3, 0xff, 0x9c, 0x2d, 0xb8,
+    0xc0, 0x1f, 0xfc, 0xf3, 0x9f, 0x93, 0x0, 0xff,
+    0xe7, 0xb6, 0x6b, 0x88, 0x7, 0xff, 0xe, 0x5c,
+    0x40, 0x3f, 0x14, 0x75, 0x20, 0x7, 0xff, 0x4,
+    0xa3, 0xad, 0x40, 0x3f, 0x96, 0xf5, 0xc4, 0x3,
+    0xff, 0x82, 0x95, 0xd2, 0x60, 0x1f, 0x8a, 0x3a,
+    0xd0, 0x3, 0xff, 0x82, 0x2d, 0x9a, 0xc2, 0x1,
+    0xf9, 0x2f, 0xa0, 0x80, 0x3f, 0xf8, 0x25, 0x3d,
+    0x48, 0x1, 0xf8, 0x5f, 0x6d, 0x40, 0x3f, 0xf8,
+    0x4b, 0x7d, 0x4, 0x1, 0xf9, 0x2b, 0xa0, 0x80,
+    0x3f, 0xf8, 0x22, 0xfb, 0x8c, 0x1, 0xf8, 0x5f,
+    0x40, 0x3f, 0xf8, 0x87, 0x3f, 0x26, 0x1, 0xff,
+    0xcf, 0x6c, 0xd6, 0x0, 0xff, 0xe7, 0x24, 0x30,
+    0x7, 0xff, 0x2c, 0x5f, 0x6d, 0x40, 0x3f, 0xf9,
+    0x4b, 0x7d, 0x4, 0x1, 0xf9, 0x40, 0x3f, 0xf1,
+    0xcf, 0x52, 0x0, 0x7e, 0x28, 0xea, 0x0, 0xfe,
+    0x17, 0xdc, 0x61, 0x0, 0xfc, 0xb9, 0xae, 0x20,
+    0x1f, 0x92, 0xba, 0x8, 0x3, 0xf1, 0xcf, 0xd1,
+    0x80, 0x7e, 0x28, 0xeb, 0x50, 0xf, 0xe6, 0xcc,
+    0x30, 0x7, 0xf3, 0x66, 0xb8, 0x80, 0x7e, 0x3a,
+    0xf9, 0x30, 0xf, 0xe7, 0xf9, 0x30, 0xf, 0xc2,
+    0xfb, 0x8a, 0x1, 0xff, 0xb0, 0x3, 0xf9, 0x2b,
+    0xa0, 0x80, 0x3f, 0xf9, 0x22, 0xfb, 0x6a, 0x1,
+    0xff, 0xca, 0x4b, 0xe8, 0x20, 0xf, 0xfe, 0x49,
+    0x47, 0x5a, 0x0, 0x7f, 0xf2, 0xb6, 0xf5, 0xc4,
+    0x3, 0xff, 0x98,
 
     /* U+003F "?" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x56,
-    0x77, 0x65, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x62, 0x0, 0x0, 0x2, 0x6c, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0x70, 0x4, 0xef, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xfd, 0x0, 0x1, 0xbf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x69,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x88,
-    0x88, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xfe,
-    0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc2, 0x6a, 0xce, 0xe6, 0x54, 0x10,
+    0xf, 0xfe, 0x38, 0xb5, 0x77, 0x32, 0xa6, 0x21,
+    0x35, 0x7d, 0xcb, 0x50, 0xf, 0xfe, 0x11, 0x57,
+    0x4a, 0x88, 0x7, 0xf8, 0x52, 0xbd, 0xc0, 0x3f,
+    0xc3, 0x5a, 0xa0, 0x1f, 0xfc, 0x68, 0xd3, 0x0,
+    0xf9, 0x3d, 0x40, 0x3f, 0xf9, 0x25, 0x8a, 0x1,
+    0xcd, 0x62, 0x1, 0xff, 0x8, 0x7, 0xfe, 0xa4,
+    0x0, 0x9a, 0x40, 0x3f, 0x2c, 0xef, 0xfb, 0xbf,
+    0xdb, 0x26, 0x1, 0xfa, 0x80, 0x5, 0x20, 0x1e,
+    0x18, 0xfa, 0x62, 0x0, 0xe2, 0x6c, 0xc1, 0x0,
+    0x78, 0x5c, 0xa, 0xc4, 0x3, 0x27, 0xb8, 0x7,
+    0xfe, 0x3c, 0x30, 0xf, 0x50, 0x1, 0x3d, 0x0,
+    0xd, 0x62, 0x1, 0xff, 0xc2, 0x1d, 0x0, 0xf1,
+    0x8, 0x0, 0x6e, 0x5a, 0x40, 0x3f, 0xf8, 0xa2,
+    0xc0, 0x1e, 0x20, 0xc, 0xd2, 0x1, 0xff, 0xc7,
+    0xd0, 0xf, 0x38, 0x7, 0xff, 0x35, 0x80, 0x3f,
+    0xfa, 0x82, 0x1, 0xe6, 0x0, 0xff, 0xe6, 0xb0,
+    0x7, 0x88, 0x3, 0xff, 0x9b, 0xe0, 0x1c, 0x80,
+    0x1f, 0xfc, 0xd3, 0x50, 0xe, 0xd0, 0xf, 0xfe,
+    0x60, 0xe8, 0x7, 0xb, 0x0, 0x7f, 0xf2, 0xc7,
+    0x4, 0x3, 0xac, 0x3, 0xff, 0x96, 0x38, 0x40,
+    0x1c, 0xca, 0x1, 0xff, 0xca, 0x2f, 0x20, 0xe,
+    0x59, 0x0, 0xff, 0xe5, 0x1e, 0x8, 0x7, 0x2d,
+    0x0, 0x7f, 0xf2, 0x8f, 0x4, 0x3, 0x96, 0x80,
+    0x3f, 0xf9, 0x47, 0x80, 0x1e, 0x6a, 0x0, 0xff,
+    0xe5, 0xe, 0x80, 0x79, 0xe4, 0x3, 0xff, 0x97,
+    0x42, 0x1, 0xcd, 0x0, 0x1f, 0xfc, 0xb4, 0x40,
+    0x7, 0x24, 0x80, 0x7f, 0xf3, 0x3c, 0x3, 0xd4,
+    0x1, 0xff, 0xcd, 0x40, 0xe, 0x71, 0x0, 0xff,
+    0xe6, 0x18, 0x7, 0xac, 0x3, 0xff, 0x9a, 0xc0,
+    0x1e, 0x30, 0xf, 0xfe, 0x6b, 0x3b, 0xf8, 0x3,
+    0xff, 0x9c, 0x71, 0x1e, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xe1, 0x0, 0xff, 0xe9,
+    0x37, 0x73, 0xf0, 0xc0, 0x3f, 0xf9, 0xcf, 0x22,
+    0x0, 0x3c, 0x20, 0xf, 0xfe, 0x60, 0xc0, 0x7,
+    0xa4, 0x3, 0xff, 0x98, 0xa0, 0x1f, 0x28, 0x7,
+    0xff, 0x31, 0xc0, 0x3f, 0xfa, 0x86, 0x1, 0xf2,
+    0x0, 0x7f, 0xf3, 0x64, 0x3, 0x86, 0xc0, 0x3f,
+    0xf9, 0xad, 0x66, 0x2, 0xbe, 0x20, 0x1f, 0xf0,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x45, 0x67, 0x76,
-    0x65, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x7a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed,
-    0xcb, 0xbc, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x63, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x24, 0x7c, 0xff, 0xff, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xad, 0xef, 0xfe, 0xc9, 0x51, 0x0, 0x0,
-    0x5, 0xcc, 0xcc, 0xc1, 0x0, 0x4, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x6f,
-    0xff, 0xff, 0x20, 0x0, 0x9, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x6, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x2f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x6f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff,
-    0xff, 0xff, 0xc7, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf1, 0x0, 0x1, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfa, 0x51, 0x0, 0x0, 0x37, 0xdf, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x60, 0x0, 0x6f, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x0, 0xb, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1,
-    0x0, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40, 0x3f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf7, 0x6, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xa0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0xb, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xe0, 0xcf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0, 0xef, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x1e, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf0, 0xdf, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xc, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0,
-    0xbf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfe, 0xa, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xb0, 0x7f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf9, 0x4, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x60, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfd, 0x0, 0x7,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x70, 0x0, 0x2f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xf9, 0x40, 0x0, 0x0, 0x27, 0xdf, 0xff, 0xff,
-    0x9d, 0xff, 0xff, 0xfa, 0x10, 0x3, 0xcf, 0xff,
-    0xf8, 0x0, 0x0, 0x6, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f,
-    0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xad, 0xef, 0xfe, 0xca, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfd, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x97, 0x65, 0x44,
-    0x56, 0x7a, 0xcf, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x68, 0xbd,
-    0xde, 0xff, 0xed, 0xca, 0x85, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0xff, 0xe6, 0x92, 0x2b, 0x3b, 0x99, 0x8a,
+    0x82, 0x1, 0xff, 0xe1, 0x27, 0xad, 0xfd, 0xba,
+    0x98, 0x84, 0xca, 0xaf, 0xbf, 0x25, 0x0, 0x3f,
+    0xfb, 0x45, 0x1b, 0xa8, 0x52, 0x0, 0xff, 0xe0,
+    0x9b, 0x5f, 0xda, 0x80, 0x7f, 0xf5, 0x4e, 0xf5,
+    0xc8, 0x3, 0xff, 0x92, 0x95, 0xce, 0x20, 0x1f,
+    0xfd, 0x2, 0xcc, 0x20, 0x7, 0xf0, 0x91, 0xa2,
+    0xc, 0xc4, 0x1, 0xfc, 0x31, 0xce, 0x1, 0xff,
+    0xce, 0x8d, 0x30, 0xf, 0x96, 0x73, 0xb9, 0xb9,
+    0x76, 0xcc, 0x6f, 0xed, 0xc1, 0x80, 0x7d, 0x1a,
+    0x60, 0x1f, 0xfc, 0xa2, 0xd7, 0x0, 0xf2, 0xdf,
+    0xd3, 0x18, 0x80, 0x7f, 0x12, 0x3e, 0x74, 0x98,
+    0x7, 0x16, 0x40, 0x7, 0xff, 0x21, 0x74, 0x80,
+    0x39, 0xfa, 0x90, 0x3, 0xff, 0x8c, 0x2d, 0x98,
+    0x40, 0xe, 0x7b, 0x0, 0xff, 0xe3, 0x3d, 0x0,
+    0x72, 0x74, 0x8, 0x7, 0xff, 0x2c, 0xee, 0xc4,
+    0x1, 0x93, 0x44, 0x3, 0xff, 0x86, 0xd0, 0x1,
+    0x86, 0xac, 0x40, 0x3f, 0xf9, 0xe9, 0xae, 0x1,
+    0x8b, 0x40, 0x3f, 0xf8, 0x4b, 0x20, 0x18, 0xb1,
+    0x40, 0x3f, 0xfa, 0x71, 0x40, 0x18, 0xec, 0x3,
+    0xff, 0x1d, 0x0, 0x63, 0xc2, 0x0, 0xff, 0xea,
+    0xae, 0x8, 0x4, 0x92, 0x1, 0xff, 0x70, 0x6,
+    0x2d, 0x10, 0xf, 0xfe, 0xb9, 0xe8, 0x6, 0x64,
+    0x0, 0xfe, 0x82, 0x0, 0x87, 0x4, 0x3, 0xfe,
+    0x16, 0xad, 0xef, 0xf7, 0x64, 0xa8, 0x80, 0x72,
+    0xe6, 0x70, 0x80, 0xe, 0xc0, 0x35, 0x8, 0x7,
+    0xc6, 0xe0, 0x1a, 0x84, 0x3, 0xfc, 0x97, 0xd2,
+    0xa4, 0x20, 0x1, 0x36, 0xae, 0xa2, 0x0, 0x8c,
+    0xfe, 0x0, 0x91, 0x80, 0x21, 0x80, 0xf, 0xa0,
+    0x3, 0x32, 0x0, 0x7f, 0xd, 0xd9, 0x0, 0x3f,
+    0xf2, 0xec, 0x0, 0x7f, 0xf0, 0x64, 0x80, 0x26,
+    0x10, 0xe, 0x24, 0x0, 0x86, 0x40, 0x3f, 0x8f,
+    0xd0, 0x3, 0xff, 0x88, 0xf6, 0x1, 0xff, 0xc1,
+    0x90, 0xd, 0x0, 0x1d, 0x0, 0x1a, 0x0, 0x3f,
+    0x93, 0x4, 0x3, 0xf8, 0x44, 0x1, 0xf2, 0x60,
+    0x80, 0x7f, 0xc8, 0x60, 0x13, 0x8, 0x4, 0x2a,
+    0x1, 0xb, 0x0, 0x7e, 0x2b, 0x0, 0xf9, 0x6b,
+    0xbf, 0xb9, 0xf9, 0x4, 0x1, 0x8e, 0x40, 0x3f,
+    0xf4, 0x0, 0x67, 0x0, 0x9c, 0x3, 0x48, 0x7,
+    0xf7, 0x80, 0x79, 0x36, 0x94, 0x40, 0x31, 0xbe,
+    0xc8, 0x6, 0x10, 0xf, 0xfc, 0x84, 0x1, 0x68,
+    0x5, 0xa0, 0x19, 0x40, 0x3f, 0x41, 0x0, 0x73,
+    0xd9, 0x0, 0x7f, 0x9b, 0x48, 0x3, 0xff, 0x88,
+    0xa0, 0x12, 0x8, 0x1, 0x0, 0x22, 0x20, 0x7,
+    0xc2, 0xe0, 0x1c, 0xf0, 0x1, 0xff, 0xc1, 0x2c,
+    0x10, 0xf, 0xfe, 0x1d, 0x80, 0x65, 0x3, 0x0,
+    0xca, 0x1, 0xf9, 0x80, 0x38, 0xe0, 0x3, 0xff,
+    0x86, 0x34, 0x1, 0xff, 0xc3, 0x30, 0xc, 0x60,
+    0xa0, 0x1b, 0x40, 0x3f, 0x50, 0x7, 0x78, 0x7,
+    0xff, 0x15, 0x14, 0x3, 0xff, 0x86, 0x60, 0x16,
+    0x87, 0x80, 0x67, 0x0, 0xf8, 0x88, 0x1, 0x8c,
+    0xc0, 0x1f, 0xfc, 0x69, 0x0, 0xff, 0xe1, 0xa8,
+    0x4, 0xe0, 0x40, 0x18, 0x80, 0x3e, 0x40, 0xe,
+    0xb0, 0xf, 0xfe, 0x39, 0x90, 0x7, 0xff, 0xb,
+    0xc0, 0x23, 0x7, 0x0, 0x84, 0x3, 0xf7, 0x80,
+    0x72, 0x0, 0x7f, 0xf2, 0x10, 0x3, 0xff, 0x8c,
+    0x20, 0x20, 0x11, 0x80, 0x7e, 0x20, 0xe, 0x30,
+    0xf, 0xfe, 0x47, 0x80, 0x7f, 0xf0, 0x8c, 0x3,
+    0x8c, 0x2, 0x10, 0xf, 0xce, 0x1, 0xff, 0xce,
+    0x30, 0xf, 0xfe, 0x10, 0x80, 0x61, 0x0, 0xff,
+    0xe3, 0x8, 0x7, 0xff, 0x24, 0x40, 0x3f, 0xf8,
+    0xe2, 0x60, 0x10, 0x80, 0x7f, 0xf0, 0x44, 0x3,
+    0xff, 0x92, 0x20, 0x1f, 0xfc, 0x21, 0x0, 0xe1,
+    0x0, 0x8c, 0x3, 0xf3, 0x80, 0x7f, 0xf3, 0x8c,
+    0x3, 0xff, 0x90, 0xe0, 0x10, 0x80, 0x7e, 0x20,
+    0xe, 0x30, 0xf, 0xfe, 0x47, 0x80, 0x7f, 0xf0,
+    0x88, 0x2, 0x10, 0x10, 0xc, 0x20, 0x1f, 0x78,
+    0x7, 0x20, 0x7, 0xff, 0x21, 0x0, 0x3f, 0xf8,
+    0x5c, 0x1, 0x28, 0x68, 0x6, 0x50, 0xf, 0x90,
+    0x3, 0xac, 0x3, 0xff, 0x8e, 0x64, 0x1, 0xff,
+    0xc2, 0x50, 0x8, 0x80, 0xc0, 0x31, 0x80, 0x7c,
+    0x44, 0x0, 0xc6, 0x60, 0xf, 0xfe, 0x34, 0x80,
+    0x7f, 0xf0, 0xcc, 0x2, 0xf0, 0x50, 0xd, 0x80,
+    0x1f, 0xa8, 0x3, 0xbc, 0x3, 0xff, 0x8a, 0x8a,
+    0x1, 0xff, 0xc2, 0x40, 0xc, 0x80, 0x24, 0x1,
+    0x20, 0x7, 0xe6, 0x0, 0xe3, 0x80, 0xf, 0xfe,
+    0x18, 0xd0, 0x7, 0xc2, 0x1, 0xf7, 0x0, 0x44,
+    0x40, 0x5, 0x0, 0x65, 0x0, 0xf8, 0x60, 0x3,
+    0x9e, 0x0, 0x3f, 0xf8, 0x25, 0x82, 0x1, 0xf2,
+    0x80, 0x78, 0xd4, 0x2, 0xa0, 0x9, 0x40, 0x34,
+    0x80, 0x7e, 0x72, 0x0, 0xe7, 0xb2, 0x0, 0xff,
+    0x2e, 0x10, 0x7, 0xea, 0x0, 0xe1, 0xe0, 0xc,
+    0xc0, 0x11, 0x10, 0x2, 0x33, 0x0, 0x7e, 0xf1,
+    0x0, 0xe4, 0xd9, 0x40, 0xe, 0x27, 0xda, 0x10,
+    0x9, 0x88, 0x3, 0x1d, 0x8, 0x0, 0xf4, 0x80,
+    0x27, 0x10, 0xd, 0x60, 0x1a, 0x0, 0x3f, 0x15,
+    0x0, 0x7c, 0xd7, 0xfe, 0xdd, 0x7e, 0xc1, 0x0,
+    0x63, 0x9a, 0x0, 0xe5, 0xed, 0xec, 0x30, 0x8,
+    0x64, 0x3, 0x98, 0x40, 0x24, 0x40, 0x7, 0xe4,
+    0xc1, 0x0, 0xfe, 0x22, 0x0, 0x7c, 0x78, 0xc,
+    0x20, 0x1e, 0x21, 0x0, 0xea, 0x10, 0xf, 0x40,
+    0x6, 0xa1, 0x0, 0xfc, 0x7e, 0xa0, 0x1f, 0xfc,
+    0x47, 0xc0, 0x0, 0xd8, 0x7, 0xfe, 0xa4, 0x0,
+    0xf9, 0x88, 0x2, 0x1b, 0x0, 0xfe, 0x1a, 0xc4,
+    0x0, 0xff, 0xcb, 0xb0, 0x1, 0x96, 0xc4, 0x3,
+    0xf1, 0xe2, 0x80, 0x7f, 0x78, 0x6, 0x58, 0x0,
+    0xff, 0x1d, 0xf4, 0xa9, 0x8, 0x0, 0x4d, 0x67,
+    0xa8, 0x80, 0x3c, 0x9f, 0x8, 0x20, 0x2, 0x5b,
+    0xc3, 0x0, 0xff, 0x14, 0x0, 0x67, 0x60, 0xf,
+    0xf8, 0x5a, 0xb7, 0xbf, 0xdd, 0x94, 0xc2, 0x1,
+    0xfc, 0x2f, 0x7d, 0xfe, 0xda, 0x40, 0xf, 0xfe,
+    0xb, 0xa0, 0x6, 0x97, 0x0, 0xff, 0xf5, 0x59,
+    0x80, 0x68, 0x90, 0xf, 0xff, 0x56, 0x90, 0x6,
+    0x6d, 0x30, 0xf, 0xff, 0x40, 0xe1, 0x80, 0x62,
+    0xc9, 0x10, 0xf, 0xff, 0x38, 0xe2, 0x80, 0x73,
+    0x74, 0x90, 0x7, 0xff, 0x20, 0xa1, 0xc0, 0x3f,
+    0xfa, 0x15, 0x0, 0x1e, 0x6d, 0xc7, 0x30, 0xf,
+    0xfe, 0x11, 0xbd, 0xeb, 0xd0, 0x7, 0xff, 0x45,
+    0xf9, 0x0, 0x3c, 0x71, 0x9f, 0x92, 0xec, 0xa8,
+    0x85, 0x67, 0xac, 0xfc, 0x84, 0x0, 0x11, 0x80,
+    0x7f, 0xf4, 0x46, 0xec, 0x60, 0x1f, 0x8d, 0xa2,
+    0x6a, 0xed, 0x53, 0xa, 0x60, 0x1f, 0x50, 0x7,
+    0xff, 0x4d, 0x33, 0x8, 0x1, 0xff, 0xcb, 0x17,
+    0xb0, 0xf, 0xfe, 0xa9, 0xdf, 0x4a, 0x0, 0x7f,
+    0xf1, 0x45, 0x6b, 0xa0, 0x80, 0x3f, 0xfa, 0xe2,
+    0xd7, 0xf9, 0x2e, 0x84, 0x41, 0x0, 0x9, 0x1a,
+    0xbd, 0x6f, 0x52, 0x80, 0x7f, 0xf2, 0x0,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0x4f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf8, 0xd, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf2, 0x6, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xa0, 0x0, 0xef, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x30, 0x0, 0x8f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xe1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x13, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0xef, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
-    0x6, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3,
-    0xd, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfa,
+    0x0, 0xff, 0xe4, 0xff, 0xfb, 0x0, 0x3f, 0xfb,
+    0x8e, 0x1, 0xe3, 0x30, 0x7, 0xff, 0x6e, 0x40,
+    0x3e, 0x80, 0xf, 0xfe, 0xd2, 0x88, 0x7, 0xc8,
+    0x40, 0x1f, 0xfd, 0x99, 0x0, 0xfe, 0xb0, 0xf,
+    0xfe, 0xc2, 0x18, 0x7, 0xf3, 0x8, 0x7, 0xff,
+    0x5f, 0xc0, 0x3f, 0xe9, 0x0, 0xff, 0xeb, 0x12,
+    0x0, 0x61, 0xb0, 0xe, 0x60, 0xf, 0xfe, 0xb5,
+    0x80, 0x73, 0x21, 0x0, 0x61, 0x60, 0xf, 0xfe,
+    0xa0, 0xb0, 0x7, 0x50, 0x58, 0x7, 0x58, 0x7,
+    0xff, 0x52, 0x40, 0x39, 0x48, 0x18, 0x40, 0x31,
+    0x20, 0x7, 0xff, 0x4d, 0x80, 0x3a, 0x40, 0x26,
+    0x0, 0xe8, 0x0, 0xff, 0xe9, 0x30, 0x80, 0x62,
+    0x30, 0xa, 0x40, 0x38, 0xcc, 0x1, 0xff, 0xd1,
+    0xb0, 0xe, 0xb0, 0xc, 0x2a, 0x1, 0xd2, 0x1,
+    0xff, 0xd0, 0x52, 0x0, 0xc2, 0xc0, 0x1d, 0x20,
+    0x1c, 0xa4, 0x1, 0xff, 0xcf, 0x90, 0xe, 0x60,
+    0xf, 0x19, 0x80, 0x3a, 0xc0, 0x3f, 0xf9, 0xc6,
+    0x60, 0xe, 0x90, 0xf, 0xa4, 0x3, 0x98, 0x40,
+    0x3f, 0xf9, 0xb2, 0x1, 0xca, 0x20, 0x1f, 0x28,
+    0x80, 0x73, 0x0, 0x7f, 0xf3, 0x9, 0x40, 0x3a,
+    0x40, 0x3f, 0xa4, 0x3, 0xa4, 0x3, 0xff, 0x99,
+    0x60, 0x1c, 0x66, 0x0, 0xfe, 0x60, 0xe, 0x16,
+    0x0, 0xff, 0xe5, 0xb, 0x0, 0x74, 0x80, 0x7f,
+    0x85, 0x80, 0x3a, 0xc0, 0x3f, 0xf9, 0x4c, 0x1,
+    0xc2, 0xa0, 0x1f, 0xf5, 0x0, 0x71, 0x20, 0x7,
+    0xff, 0x26, 0x40, 0x3a, 0x40, 0x3f, 0xf1, 0x98,
+    0x3, 0xbc, 0x3, 0xff, 0x90, 0xc2, 0x1, 0xcc,
+    0x1, 0xff, 0xc1, 0x90, 0xe, 0x42, 0x0, 0xff,
+    0xe3, 0xd8, 0x7, 0x30, 0x80, 0x7f, 0xf0, 0x54,
+    0x40, 0x3a, 0x0, 0x3f, 0xf8, 0xc8, 0x40, 0x1d,
+    0x60, 0x1f, 0xfc, 0x39, 0x0, 0xe5, 0x10, 0xf,
+    0xfe, 0x2f, 0x80, 0x71, 0x90, 0x7, 0xff, 0xd,
+    0x80, 0x3d, 0x20, 0x1f, 0xfc, 0x42, 0x40, 0xe,
+    0x90, 0xf, 0xfe, 0x20, 0xb0, 0x7, 0x38, 0x7,
+    0xff, 0x12, 0x0, 0x38, 0x50, 0x47, 0xff, 0x8b,
+    0x40, 0x1e, 0x70, 0xf, 0xfe, 0x10, 0xa8, 0x7,
+    0xf, 0x77, 0xff, 0x1b, 0x0, 0x3d, 0x20, 0x1f,
+    0xfc, 0x29, 0x0, 0xff, 0xea, 0xa, 0x80, 0x7f,
+    0xf0, 0x58, 0x3, 0xff, 0xab, 0x20, 0x1f, 0xf9,
+    0x84, 0x3, 0xff, 0xaa, 0x68, 0x1, 0xff, 0x58,
+    0x7, 0xff, 0x5f, 0xc0, 0x3f, 0xca, 0x40, 0x1d,
+    0x9f, 0xff, 0xfc, 0xb7, 0x0, 0xe4, 0x20, 0xf,
+    0xe9, 0x0, 0xe3, 0x30, 0x7, 0xff, 0x2e, 0x40,
+    0x3d, 0x60, 0x1f, 0x8c, 0xc0, 0x1d, 0x20, 0x1f,
+    0xfc, 0xc1, 0x60, 0xe, 0x61, 0x0, 0xfa, 0x40,
+    0x38, 0x94, 0x3, 0xff, 0x9b, 0x60, 0x1e, 0x90,
+    0xf, 0x12, 0x80, 0x75, 0x0, 0x7f, 0xf3, 0x89,
+    0x0, 0x39, 0x80, 0x3d, 0x60, 0x1e, 0x70, 0xf,
+    0xfe, 0x7f, 0x80, 0x70, 0xb0, 0x6, 0x16, 0x0,
+    0xe7, 0x0, 0xff, 0xe8, 0x21, 0x0, 0x75, 0x80,
+    0x66, 0x0, 0xf4, 0x80, 0x7f, 0xf4, 0x6c, 0x3,
+    0x89, 0x40, 0x29, 0x0, 0xe5, 0x10, 0xf, 0xfe,
+    0x8b, 0x8, 0x7, 0x48, 0x1, 0x84, 0x3, 0xa4,
+    0x3, 0xff, 0xa7, 0x20, 0x1c, 0x66, 0xb, 0x0,
+    0xe3, 0x30, 0x7, 0xff, 0x4d, 0x80, 0x3d, 0x20,
 
     /* U+0042 "B" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xed, 0xc9, 0x63, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf4,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x47,
-    0x9e, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xc0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xd0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xd0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x90, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf4,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x46,
-    0x9e, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x81, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x24, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x10,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x70, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xc0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf3, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf3,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xb0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x60,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x4f, 0xff, 0xff, 0xf4,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23,
-    0x46, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xed, 0xb8, 0x63, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xfe, 0x4f, 0x6e, 0x4b, 0x18, 0x7,
+    0xff, 0x58, 0x48, 0xda, 0x73, 0xa0, 0x80, 0x3f,
+    0xfb, 0x22, 0xfb, 0x22, 0x1, 0xff, 0xda, 0x6f,
+    0x30, 0xf, 0xfe, 0xd0, 0xe1, 0x80, 0x7f, 0xeb,
+    0xdd, 0xff, 0xe0, 0xe5, 0xc3, 0x8, 0x7, 0xed,
+    0x10, 0xf, 0xf9, 0x88, 0xbf, 0xf8, 0x26, 0x8f,
+    0x3d, 0x64, 0x1, 0xe1, 0xb0, 0xf, 0xfe, 0x92,
+    0x6a, 0x80, 0x79, 0x44, 0x3, 0xff, 0xa7, 0x48,
+    0x1, 0xe7, 0x0, 0xff, 0xea, 0x48, 0x7, 0xb0,
+    0x3, 0xff, 0xa8, 0x46, 0x1, 0xcc, 0x1, 0xff,
+    0xd5, 0x50, 0xe, 0x10, 0xf, 0xfe, 0xa8, 0x80,
+    0x7f, 0xf6, 0xc4, 0x3, 0x98, 0x3, 0xff, 0xaa,
+    0xa0, 0x1c, 0x40, 0x1f, 0xfd, 0x42, 0x30, 0xe,
+    0xc0, 0xf, 0xfe, 0xa4, 0x80, 0x70, 0xa8, 0x7,
+    0xff, 0x4e, 0x50, 0x3, 0xa4, 0x3, 0xff, 0xa4,
+    0x9a, 0xc0, 0x1c, 0x6e, 0x1, 0xff, 0x31, 0x17,
+    0xff, 0x4, 0xd1, 0xa7, 0xac, 0x80, 0x38, 0x74,
+    0x3, 0xff, 0x5e, 0xef, 0xff, 0x7, 0x2e, 0x58,
+    0x40, 0x3c, 0x58, 0x20, 0x1f, 0xfd, 0x87, 0xd2,
+    0x0, 0xff, 0xec, 0xb4, 0x8, 0x7, 0xff, 0x64,
+    0x5f, 0x9c, 0x3, 0xff, 0xb7, 0x16, 0x1, 0xff,
+    0x6f, 0xff, 0xff, 0xf, 0xb6, 0xe1, 0x0, 0x3e,
+    0x4b, 0x0, 0xff, 0xe7, 0x9, 0x23, 0xdf, 0x30,
+    0x7, 0x91, 0xc0, 0x3f, 0xfa, 0x43, 0x36, 0x1,
+    0xe8, 0x10, 0xf, 0xfe, 0x9a, 0x50, 0x7, 0x98,
+    0x3, 0xff, 0xa8, 0xa6, 0x1, 0xd6, 0x1, 0xff,
+    0xd5, 0xb0, 0xe, 0x30, 0xf, 0xfe, 0xa9, 0x0,
+    0x78, 0x80, 0x3f, 0xfa, 0x8c, 0x1, 0xe1, 0x0,
+    0xff, 0xea, 0x30, 0x7, 0xff, 0x6c, 0x80, 0x3c,
+    0x20, 0x1f, 0xfd, 0x4a, 0x0, 0xf1, 0x0, 0x7f,
+    0xf4, 0xd8, 0x80, 0x39, 0x0, 0x3f, 0xfa, 0x6b,
+    0x20, 0x1e, 0xd0, 0xf, 0xfe, 0x89, 0x55, 0x0,
+    0x3c, 0x2c, 0x1, 0xf9, 0x88, 0xbf, 0xf8, 0x66,
+    0x8d, 0x3b, 0xa5, 0x0, 0xfa, 0x80, 0x3f, 0xaf,
+    0x77, 0xff, 0x87, 0x97, 0x2c, 0x40, 0x1f, 0xa5,
+    0x0, 0x3f, 0xfb, 0x34, 0xc0, 0x1f, 0xfd, 0x85,
+    0xe5, 0x0, 0xff, 0xeb, 0xb, 0xed, 0x8, 0x7,
+    0xff, 0x40, 0x44, 0x48, 0xf3, 0x9d, 0x4, 0x1,
+    0xf0,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x45, 0x67, 0x76, 0x53, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xea, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x85, 0x43, 0x23,
-    0x57, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x85, 0x43,
-    0x33, 0x57, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x27, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xea, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x46, 0x67, 0x76, 0x53, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x92, 0x2b, 0x3b, 0x99, 0x4c,
+    0x40, 0x3f, 0xf9, 0xe4, 0xf9, 0xfb, 0x75, 0x31,
+    0x9, 0xac, 0xee, 0x53, 0x8, 0x7, 0xff, 0x25,
+    0x77, 0x50, 0x60, 0x1f, 0xf0, 0xac, 0xf5, 0x18,
+    0x7, 0xff, 0x15, 0xba, 0x88, 0x3, 0xff, 0x8c,
+    0xb9, 0x64, 0x1, 0xff, 0xc1, 0x2c, 0x91, 0x0,
+    0xff, 0xe5, 0x26, 0xc0, 0x7, 0xfc, 0xda, 0x60,
+    0x1f, 0xfc, 0xe7, 0xb1, 0x0, 0xfd, 0x12, 0x1,
+    0xfe, 0x47, 0xab, 0xcd, 0xca, 0x84, 0x10, 0xf,
+    0xc9, 0x82, 0x1, 0xe9, 0x70, 0xf, 0xc9, 0x5f,
+    0x70, 0xa8, 0x64, 0x6a, 0xf7, 0xd4, 0x80, 0x1f,
+    0x14, 0x0, 0x74, 0x30, 0x7, 0xc7, 0x96, 0xa0,
+    0x1f, 0xf9, 0x6f, 0x8, 0x3, 0x92, 0x40, 0x32,
+    0xb8, 0x7, 0xd3, 0x86, 0x1, 0xff, 0xc4, 0x3d,
+    0x70, 0x9, 0x2c, 0x3, 0xd, 0x80, 0x78, 0x71,
+    0x80, 0x3f, 0xf9, 0x11, 0x20, 0xb6, 0x1, 0xd4,
+    0x20, 0x1c, 0x38, 0x60, 0x1f, 0xfc, 0xa6, 0xca,
+    0x0, 0xe4, 0x40, 0x7, 0xb4, 0x80, 0x3f, 0xf9,
+    0x86, 0x1, 0xe8, 0x0, 0xf4, 0x18, 0x7, 0xff,
+    0x4c, 0xcc, 0x1, 0xc4, 0xe0, 0x1f, 0xfd, 0x4a,
+    0x0, 0xf4, 0x0, 0x7f, 0xf5, 0x5c, 0x3, 0x89,
+    0x40, 0x3f, 0xfa, 0x86, 0x20, 0x1d, 0x40, 0x1f,
+    0xfd, 0x55, 0x0, 0xf2, 0x80, 0x7f, 0xf5, 0x7c,
+    0x3, 0x84, 0x80, 0x3f, 0xfa, 0xa4, 0x1, 0xca,
+    0x1, 0xff, 0xd6, 0x70, 0xe, 0x20, 0xf, 0xfe,
+    0xb0, 0x80, 0x70, 0x80, 0x7f, 0xf5, 0x8c, 0x3,
+    0xbc, 0x3, 0xff, 0xac, 0x60, 0x1d, 0xe0, 0x1f,
+    0xfd, 0x61, 0x0, 0xe1, 0x0, 0xff, 0xeb, 0x38,
+    0x7, 0x10, 0x7, 0xff, 0x58, 0x80, 0x39, 0x40,
+    0x3f, 0xfa, 0xde, 0x1, 0xc2, 0x40, 0x1f, 0xfd,
+    0x55, 0x0, 0xf2, 0x80, 0x7f, 0xf5, 0x4c, 0x40,
+    0x3a, 0x80, 0x3f, 0xfa, 0xce, 0x1, 0xc4, 0xa0,
+    0x1f, 0xfd, 0x5a, 0x0, 0xf4, 0x0, 0x7f, 0xf5,
+    0x4d, 0x0, 0x38, 0x9c, 0x3, 0xff, 0xab, 0x0,
+    0x1e, 0x83, 0x0, 0xff, 0xea, 0x1a, 0x0, 0x7b,
+    0x48, 0x3, 0xff, 0x98, 0x80, 0x1f, 0x50, 0x80,
+    0x70, 0xe1, 0x80, 0x7f, 0xf2, 0x9e, 0xec, 0x1,
+    0xe1, 0xb0, 0xf, 0xe, 0x30, 0x7, 0xff, 0x22,
+    0x60, 0x13, 0x0, 0x3c, 0xae, 0x1, 0xf4, 0xe1,
+    0x80, 0x7f, 0xf1, 0x13, 0x58, 0x2, 0x3c, 0x10,
+    0xe, 0x86, 0x0, 0xf8, 0xf2, 0xd4, 0x3, 0xff,
+    0x2e, 0x59, 0x0, 0x71, 0xc0, 0x7, 0xa5, 0xc0,
+    0x3f, 0x25, 0x7d, 0xc2, 0xa1, 0x9c, 0xaf, 0x7f,
+    0x46, 0x1, 0xf1, 0xc8, 0x7, 0xd1, 0x20, 0x1f,
+    0xe4, 0x7a, 0xbc, 0xca, 0xa1, 0x0, 0x3f, 0x97,
+    0x0, 0x3f, 0x9b, 0x4c, 0x3, 0xff, 0x9d, 0x14,
+    0x1, 0xff, 0x16, 0x48, 0x80, 0x7f, 0xf2, 0x93,
+    0x5c, 0x3, 0xff, 0x84, 0xdd, 0x24, 0x1, 0xff,
+    0xc6, 0x5c, 0xb2, 0x0, 0xff, 0xe2, 0xb6, 0xea,
+    0xc, 0x3, 0xfe, 0x15, 0xaf, 0xa3, 0x0, 0xff,
+    0xe4, 0x93, 0xe7, 0xed, 0xcc, 0xa2, 0x13, 0x59,
+    0xdc, 0xa5, 0x0, 0xfe,
 
     /* U+0044 "D" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xdb, 0x96, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x9a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x70, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf1, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf7, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf9,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfc, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf9, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf7, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf1, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xc0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x70, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x10,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf9, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x9a, 0xce, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xdc, 0x96, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xfe, 0x47, 0x6d, 0xcb, 0x18, 0x7,
+    0xff, 0x68, 0x49, 0x1a, 0x73, 0xa9, 0x40, 0x3f,
+    0xfb, 0xa2, 0xb5, 0xce, 0x20, 0x1f, 0xfd, 0xd1,
+    0x8f, 0x60, 0xf, 0xfe, 0xf0, 0xce, 0x10, 0x7,
+    0xff, 0xd, 0x9d, 0xff, 0xf3, 0x29, 0x88, 0x7,
+    0xf8, 0xf1, 0x0, 0x3f, 0xf8, 0x57, 0x11, 0xff,
+    0xa6, 0xb3, 0xb6, 0x50, 0x3, 0xf0, 0xda, 0x80,
+    0x7f, 0xf4, 0x89, 0xaf, 0x5c, 0x3, 0xf5, 0x20,
+    0x7, 0xff, 0x50, 0xa3, 0x50, 0x3, 0xeb, 0x30,
+    0xf, 0xfe, 0xa9, 0x5c, 0x0, 0x7d, 0xc0, 0x1f,
+    0xfd, 0x77, 0xa0, 0xf, 0x14, 0x0, 0x7f, 0xf5,
+    0xd6, 0x40, 0x3c, 0xe4, 0x1, 0xff, 0xd7, 0x65,
+    0x0, 0xf5, 0x80, 0x7f, 0xf6, 0x2c, 0x40, 0x39,
+    0x84, 0x3, 0xff, 0xae, 0x32, 0x1, 0xe6, 0x0,
+    0xff, 0xec, 0x38, 0x80, 0x75, 0x80, 0x7f, 0xf6,
+    0x5c, 0x3, 0x8c, 0x40, 0x3f, 0xfb, 0x1a, 0x1,
+    0xe5, 0x0, 0xff, 0xec, 0x20, 0x7, 0x8c, 0x3,
+    0xff, 0xb2, 0x40, 0x1d, 0xc0, 0x1f, 0xfd, 0x96,
+    0x0, 0xe3, 0x0, 0xff, 0xec, 0x88, 0x7, 0x8,
+    0x7, 0xff, 0x7d, 0xc0, 0x3f, 0xfb, 0xee, 0x1,
+    0xff, 0xd9, 0x10, 0xe, 0x10, 0xf, 0xfe, 0xcb,
+    0x0, 0x71, 0x80, 0x7f, 0xf6, 0x48, 0x3, 0xb8,
+    0x3, 0xff, 0xb0, 0x80, 0x1e, 0x30, 0xf, 0xfe,
+    0xc6, 0x80, 0x79, 0x40, 0x3f, 0xfb, 0xe, 0x1,
+    0xc6, 0x20, 0x1f, 0xfd, 0x76, 0x10, 0xe, 0xb0,
+    0xf, 0xfe, 0xc4, 0x0, 0x79, 0x80, 0x3f, 0xfa,
+    0xf2, 0x20, 0x1c, 0xc2, 0x1, 0xff, 0xd6, 0x66,
+    0x0, 0x7a, 0xc0, 0x3f, 0xfa, 0xcb, 0x20, 0x1e,
+    0x72, 0x0, 0xff, 0xea, 0xbd, 0x0, 0x78, 0xa0,
+    0x3, 0xff, 0xa8, 0x57, 0x0, 0x1f, 0x70, 0x7,
+    0xff, 0x4c, 0x63, 0x50, 0x3, 0xeb, 0x30, 0xf,
+    0xfe, 0x80, 0xb5, 0xf3, 0x80, 0x7e, 0xa4, 0x0,
+    0xff, 0xd7, 0x11, 0xff, 0xa6, 0xb3, 0xb9, 0x28,
+    0x1, 0xf8, 0x6d, 0x40, 0x3f, 0xf8, 0x2c, 0xef,
+    0xff, 0x99, 0x4c, 0x40, 0x3f, 0xc7, 0x88, 0x1,
+    0xff, 0xdb, 0x19, 0xc2, 0x0, 0xff, 0xed, 0xc,
+    0x7b, 0x0, 0x7f, 0xf6, 0x45, 0x6b, 0x9c, 0x40,
+    0x3f, 0xfa, 0x82, 0x46, 0xd3, 0x9d, 0x4a, 0x1,
+    0xff, 0xc2,
 
     /* U+0045 "E" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x4f, 0xff, 0xff,
-    0xf9, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x20, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf7, 0x66,
-    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x63, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x81,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x4f, 0xff, 0xfe, 0x9a, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0x2c, 0xef, 0xff, 0xcd, 0x0, 0xfd,
+    0x71, 0x1f, 0xfc, 0xc2, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x75, 0x59,
+    0xbf, 0xf9, 0x26, 0x1, 0xff, 0x44, 0xcf, 0xff,
+    0x26, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xcd,
+    0xff, 0xff, 0xe4, 0xc8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x15,
+    0xc4, 0x7f, 0xf3, 0x44, 0x3, 0xe6, 0x77, 0xff,
+    0xe6, 0x90, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xe2,
 
     /* U+0046 "F" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0x98, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x82, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x87, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x40, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0xfe, 0x9a, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfe, 0x8c, 0xef, 0xff, 0xcd, 0x0, 0xfa,
+    0xe2, 0x3f, 0xf9, 0x84, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x1e, 0x9d, 0xff, 0xf9, 0x28, 0x1, 0xfe,
+    0x78, 0x8f, 0xfe, 0x4e, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfe, 0xfb, 0xff, 0xff, 0xc9, 0x90, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0xb0,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x45, 0x67, 0x76, 0x64, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6b, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc8, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x85, 0x43, 0x23, 0x46, 0x9d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xef, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff,
-    0xf3, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xcc, 0xcc, 0xb0,
-    0xdf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0xcf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x9f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x6f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0xe, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x8, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0xbf, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x85, 0x43, 0x33, 0x46, 0x9d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x45, 0x67, 0x77, 0x64, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x8a, 0x2b, 0x3b, 0x99, 0x88,
+    0x40, 0x1f, 0xfd, 0x2, 0x6b, 0xee, 0x5d, 0x4c,
+    0x42, 0x65, 0x7b, 0xf9, 0x6, 0x1, 0xff, 0xca,
+    0x5c, 0xd9, 0x41, 0x0, 0xff, 0x8d, 0xf3, 0x58,
+    0x3, 0xff, 0x8c, 0xdb, 0x46, 0x1, 0xff, 0xc6,
+    0x29, 0xe6, 0x0, 0xff, 0xe1, 0x16, 0x49, 0x0,
+    0x7f, 0xf2, 0x86, 0x70, 0x80, 0x3f, 0xe6, 0xd3,
+    0x0, 0xff, 0xe7, 0x1e, 0xa8, 0x7, 0xf4, 0x48,
+    0x7, 0xf9, 0x1e, 0xaf, 0x37, 0x2e, 0x58, 0x80,
+    0x3f, 0xa9, 0x80, 0x3e, 0x97, 0x0, 0xfc, 0x75,
+    0xf7, 0xa, 0x86, 0x46, 0x8d, 0x3b, 0xa7, 0x10,
+    0xf, 0xa0, 0x40, 0x3a, 0x18, 0x3, 0xe3, 0xcc,
+    0x28, 0x7, 0xfe, 0x28, 0xe7, 0x0, 0xf6, 0x88,
+    0x6, 0x57, 0x0, 0xfa, 0x30, 0xc0, 0x3f, 0xf8,
+    0xb1, 0xa6, 0x1, 0x61, 0x80, 0x61, 0xb0, 0xf,
+    0xe, 0x38, 0x7, 0xff, 0x20, 0xb1, 0x43, 0xc,
+    0x3, 0xa8, 0x40, 0x38, 0x70, 0xc0, 0x3f, 0xf9,
+    0x75, 0xa6, 0x1, 0xc6, 0x80, 0x1e, 0xd2, 0x0,
+    0xff, 0xe6, 0x90, 0x7, 0xa0, 0x3, 0xd0, 0x60,
+    0x1f, 0xfd, 0x43, 0x40, 0xe, 0x27, 0x0, 0xff,
+    0xea, 0xd8, 0x7, 0xa4, 0x3, 0xff, 0xac, 0xc0,
+    0x1c, 0x48, 0x1, 0xff, 0xd5, 0x31, 0x0, 0xea,
+    0x0, 0xff, 0xeb, 0x28, 0x7, 0x94, 0x3, 0xff,
+    0xad, 0xe0, 0x1c, 0x24, 0x1, 0xff, 0xd6, 0x20,
+    0xe, 0x50, 0xf, 0xfe, 0xbb, 0x80, 0x71, 0x0,
+    0x7f, 0xf5, 0xc4, 0x3, 0x84, 0x3, 0xff, 0xae,
+    0x60, 0x1d, 0xe0, 0x1f, 0xfc, 0xf2, 0xcc, 0xeb,
+    0x3, 0x0, 0xef, 0x0, 0xff, 0xe7, 0x89, 0x9f,
+    0x28, 0x8, 0x7, 0x8, 0x7, 0xff, 0x5d, 0xc0,
+    0x38, 0x80, 0x3f, 0xfa, 0xe4, 0x1, 0xca, 0x1,
+    0xff, 0xd7, 0xf0, 0xe, 0x12, 0x0, 0xff, 0xeb,
+    0x20, 0x7, 0x94, 0x3, 0xff, 0xac, 0x42, 0x1,
+    0xd4, 0x1, 0xff, 0xd7, 0x60, 0xe, 0x25, 0x0,
+    0xff, 0xeb, 0x58, 0x7, 0xa0, 0x3, 0xff, 0xac,
+    0x68, 0x1, 0xc5, 0x0, 0x1f, 0xfd, 0x68, 0x0,
+    0xf3, 0xa0, 0x7, 0xff, 0x54, 0xd4, 0x3, 0xd6,
+    0x60, 0x1f, 0xfd, 0x5b, 0x10, 0xf, 0x62, 0x0,
+    0x7f, 0xf5, 0x6, 0x80, 0x3e, 0xb7, 0x0, 0xff,
+    0xea, 0x24, 0x0, 0x7d, 0x1a, 0x80, 0x1f, 0xfc,
+    0x56, 0xd0, 0xf, 0xfc, 0xee, 0x0, 0xf8, 0xaf,
+    0x14, 0x3, 0xff, 0xb, 0xec, 0x88, 0x7, 0xff,
+    0x6, 0x20, 0x1, 0xf8, 0xeb, 0xee, 0x15, 0xc,
+    0xe4, 0x69, 0xde, 0x82, 0x0, 0xff, 0xe2, 0x3d,
+    0x0, 0x7f, 0x91, 0xea, 0xf3, 0x2b, 0x96, 0x20,
+    0xf, 0xe2, 0xc0, 0xf, 0xe5, 0xd4, 0x0, 0xff,
+    0xe7, 0xbe, 0x90, 0x7, 0xf8, 0xae, 0x88, 0x3,
+    0xff, 0x96, 0xbb, 0x0, 0x1f, 0xfc, 0x25, 0xda,
+    0x30, 0xf, 0xfe, 0x30, 0xbe, 0xd1, 0x0, 0x7f,
+    0xf1, 0x57, 0x36, 0x10, 0x40, 0x3f, 0xe3, 0x7c,
+    0xe8, 0x20, 0xf, 0xfe, 0x49, 0x3d, 0xf7, 0x2e,
+    0xa6, 0x22, 0x9b, 0xdf, 0xc8, 0x30, 0xf, 0xe0,
 
     /* U+0048 "H" */
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf9,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x9f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4,
+    0x4f, 0xff, 0x10, 0x7, 0xff, 0x30, 0xbf, 0xfc,
+    0x80, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x45,
+    0xc4, 0x7f, 0xf3, 0x2c, 0x3, 0xff, 0x84, 0xce,
+    0xff, 0xfc, 0xc6, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xf9, 0x9b, 0xff, 0xff, 0xcc,
+    0xd0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0x8a,
 
     /* U+0049 "I" */
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xf2,
+    0x4f, 0xff, 0x10, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xfa, 0x0,
 
     /* U+004A "J" */
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x8e, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf0,
-    0x0, 0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xb0, 0x4, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0x62,
-    0x0, 0x3, 0x7e, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xd8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x36, 0x77, 0x65, 0x41, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xfe, 0x54, 0x0, 0x7f, 0xff,
+    0xc0, 0x3f, 0xfb, 0xce, 0xff, 0xfc, 0x41, 0x0,
+    0xff, 0xa2, 0x3f, 0xf8, 0x86, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0x78, 0x7, 0xff, 0x24, 0xc0, 0x3f,
+    0xf9, 0xe2, 0x1, 0xc4, 0x1, 0xff, 0xc8, 0x10,
+    0xf, 0x8, 0x6, 0x10, 0xf, 0xfe, 0x1a, 0x80,
+    0x79, 0x80, 0x29, 0xd0, 0xf, 0xfe, 0x1e, 0x80,
+    0x78, 0x80, 0xc, 0xc3, 0x90, 0xf, 0xfe, 0x8,
+    0xb0, 0x7, 0x20, 0x1, 0x24, 0x0, 0xd4, 0x1,
+    0xff, 0xac, 0x3, 0xda, 0x5, 0x60, 0x19, 0x74,
+    0xc0, 0x3f, 0xa9, 0x40, 0x3c, 0xc0, 0x20, 0x1e,
+    0x2c, 0xb6, 0x20, 0x8, 0xdf, 0x94, 0x3, 0xce,
+    0x0, 0x39, 0x0, 0xf9, 0x27, 0x7f, 0xec, 0x81,
+    0x0, 0xf1, 0x40, 0x4, 0xd2, 0x1, 0xff, 0xc9,
+    0xf0, 0xe, 0x6b, 0x10, 0xf, 0xfe, 0x29, 0x69,
+    0x0, 0x79, 0x39, 0xc0, 0x3f, 0xf8, 0x6d, 0x84,
+    0x1, 0xfd, 0x1d, 0x6, 0x1, 0xfc, 0x4f, 0xd2,
+    0x20, 0x1f, 0xf0, 0xbe, 0x7e, 0x4c, 0x42, 0x6a,
+    0xfb, 0x60, 0x40, 0x3e,
 
     /* U+004B "K" */
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0x40, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf5, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x7f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xb0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0x10, 0x7, 0xff, 0x28, 0xbb, 0xff,
+    0xc8, 0x1, 0xff, 0xd2, 0x2c, 0x10, 0xe, 0xa4,
+    0x0, 0xff, 0xe8, 0x8f, 0x88, 0x7, 0x4a, 0x80,
+    0x7f, 0xf4, 0x47, 0x8, 0x3, 0xa5, 0x80, 0x3f,
+    0xfa, 0x23, 0x84, 0x1, 0xd0, 0xc0, 0x1f, 0xfd,
+    0x11, 0xd2, 0x0, 0xe7, 0x70, 0x7, 0xff, 0x4b,
+    0x4c, 0x3, 0x9a, 0x0, 0x3f, 0xfa, 0x58, 0x60,
+    0x1c, 0xb2, 0x1, 0xff, 0xd2, 0xb3, 0x0, 0xe5,
+    0xa0, 0xf, 0xfe, 0x95, 0xa0, 0x7, 0x25, 0x0,
+    0x7f, 0xf4, 0xad, 0x0, 0x38, 0xec, 0x3, 0xff,
+    0xa5, 0x48, 0x1, 0xc7, 0x80, 0x1f, 0xfd, 0x2a,
+    0x50, 0xe, 0x2d, 0x0, 0xff, 0xe9, 0x4a, 0x80,
+    0x71, 0x60, 0x80, 0x7f, 0xf4, 0x65, 0x80, 0x38,
+    0x7c, 0x40, 0x3f, 0xfa, 0x30, 0xc0, 0x1c, 0x38,
+    0x40, 0x1f, 0xfd, 0x18, 0x70, 0xf, 0x69, 0x0,
+    0x7f, 0xf4, 0x5d, 0xc0, 0x1e, 0xc3, 0x0, 0xff,
+    0xe8, 0xbc, 0x0, 0x7a, 0xcc, 0x3, 0xff, 0xa2,
+    0xd0, 0x1, 0xea, 0x40, 0xf, 0xfe, 0x8b, 0x48,
+    0x7, 0x89, 0x40, 0x3f, 0xfa, 0x2b, 0x20, 0x1f,
+    0x14, 0x80, 0x7f, 0xf4, 0x16, 0x80, 0x3f, 0x99,
+    0xc0, 0x3f, 0xf9, 0xc9, 0x40, 0x1f, 0xf4, 0x20,
+    0x7, 0xff, 0x31, 0x2c, 0x3, 0xff, 0x83, 0x44,
+    0x1, 0xff, 0xcb, 0x90, 0xf, 0x14, 0x80, 0x78,
+    0x7c, 0x40, 0x3f, 0xfa, 0x5, 0x8d, 0x0, 0x1e,
+    0x2a, 0x0, 0xff, 0xe7, 0x96, 0x8, 0x3b, 0x0,
+    0x79, 0x20, 0x3, 0xff, 0x9a, 0x58, 0x20, 0x14,
+    0xa0, 0x7, 0x9d, 0x80, 0x3f, 0xf9, 0x65, 0x82,
+    0x1, 0xd6, 0x40, 0x1e, 0x93, 0x0, 0xff, 0xe4,
+    0x96, 0x8, 0x7, 0xd8, 0x20, 0x1e, 0xd1, 0x0,
+    0xff, 0xe3, 0x96, 0x8, 0x7, 0xe1, 0xd0, 0xf,
+    0xe, 0x80, 0x7f, 0xf1, 0x8b, 0x4, 0x3, 0xfc,
+    0x74, 0x1, 0xe3, 0xa0, 0xf, 0xfe, 0x2f, 0x8,
+    0x7, 0xfe, 0x58, 0x0, 0xf2, 0xb8, 0x7, 0xff,
+    0x10, 0x40, 0x3f, 0xf8, 0x4e, 0xc0, 0x1e, 0x85,
+    0x0, 0xff, 0xe9, 0xca, 0x0, 0x7a, 0x88, 0x3,
+    0xff, 0xa7, 0x66, 0x1, 0xec, 0x10, 0xf, 0xfe,
+    0x9e, 0x88, 0x7, 0xe, 0x80, 0x7f, 0xf4, 0xc7,
+    0x0, 0x3c, 0x72, 0x1, 0xff, 0xd3, 0x2b, 0x0,
+    0xf3, 0x30, 0x3, 0xff, 0xa6, 0x92, 0x1, 0xe9,
+    0x40, 0xf, 0xfe, 0x9b, 0x38, 0x7, 0xa8, 0x80,
+    0x3f, 0xfa, 0x70, 0xa0, 0x1c, 0x3e, 0x1, 0xff,
+    0xd4, 0xa3, 0x0, 0xe2, 0xb0, 0xf, 0xfe, 0xa6,
+    0x90, 0x7, 0x24, 0x0,
 
     /* U+004C "L" */
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf9, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x83,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x4f, 0xff, 0x10, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x8e,
+    0xe2, 0x3f, 0xf9, 0x66, 0x1, 0xf3, 0x3b, 0xff,
+    0xf2, 0xd4, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xe9,
 
     /* U+004D "M" */
-    0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x54, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf5, 0x4f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x54, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf5, 0x4f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0x54, 0xff,
-    0xff, 0xfd, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xf5, 0x4f,
-    0xff, 0xff, 0xd0, 0xdf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xd0, 0xcf, 0xff, 0xff, 0x54,
-    0xff, 0xff, 0xfd, 0x4, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf3, 0xc, 0xff, 0xff, 0xf5,
-    0x4f, 0xff, 0xff, 0xd0, 0xb, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfa, 0x0, 0xcf, 0xff, 0xff,
-    0x54, 0xff, 0xff, 0xfd, 0x0, 0x2f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x10, 0xc, 0xff, 0xff,
-    0xf5, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x8f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x70, 0x0, 0xcf, 0xff,
-    0xff, 0x54, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0xc, 0xff,
-    0xff, 0xf5, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x54, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x54, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x54, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf5, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x54, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0xef, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf5, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xc0, 0x0, 0x8f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x60, 0x2f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfe, 0x1b, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x64,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x64, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf6, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x64, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x64, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x64, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x64, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60,
+    0x4f, 0xfe, 0x40, 0xf, 0xfe, 0xb9, 0xff, 0xf2,
+    0x80, 0x7a, 0x40, 0x3f, 0xfa, 0xfe, 0x1, 0xff,
+    0x89, 0xc0, 0x3f, 0xfa, 0xaa, 0x60, 0x1f, 0xfc,
+    0x18, 0x10, 0xf, 0xfe, 0xa5, 0x80, 0x7f, 0xf0,
+    0xec, 0x3, 0xff, 0xa7, 0x2, 0x1, 0xff, 0xc3,
+    0x53, 0x0, 0xff, 0xe8, 0x93, 0x80, 0x7f, 0xf1,
+    0x7c, 0x3, 0xff, 0xa3, 0x20, 0x1f, 0xfc, 0x63,
+    0x60, 0xf, 0xfe, 0x7a, 0x20, 0x3, 0xff, 0x8f,
+    0x2, 0x1, 0xff, 0xce, 0x90, 0xf, 0xfe, 0x40,
+    0xc0, 0x7, 0xff, 0x35, 0xc8, 0x3, 0xff, 0x92,
+    0xc4, 0x1, 0xff, 0xcb, 0x18, 0x0, 0xff, 0xe5,
+    0xf0, 0x7, 0xff, 0x2e, 0x0, 0x3f, 0xf8, 0xc2,
+    0x1, 0xc6, 0xa0, 0x1f, 0xfc, 0x93, 0x60, 0xc,
+    0x22, 0x0, 0xff, 0xc7, 0x0, 0x1d, 0x60, 0x1f,
+    0xfc, 0x9f, 0x0, 0xe8, 0x30, 0xf, 0xfe, 0xb,
+    0x90, 0x6, 0x18, 0x0, 0xff, 0xe3, 0xa9, 0x80,
+    0x62, 0x61, 0x0, 0xff, 0xe1, 0x48, 0x7, 0x39,
+    0x0, 0x7f, 0xf1, 0xac, 0x3, 0xb8, 0x3, 0xff,
+    0x88, 0x88, 0x0, 0xe9, 0x0, 0xff, 0xe2, 0xc0,
+    0x80, 0x65, 0x30, 0xf, 0xfe, 0x2c, 0x80, 0x72,
+    0x20, 0x3, 0xff, 0x86, 0x4e, 0x1, 0xd6, 0x1,
+    0xff, 0xc6, 0x27, 0x0, 0xe9, 0x0, 0xff, 0xe1,
+    0xc8, 0x7, 0x40, 0x80, 0x7f, 0xf1, 0xe0, 0x80,
+    0x31, 0x38, 0x7, 0xff, 0x5, 0x10, 0x1, 0x89,
+    0xc0, 0x3f, 0xf9, 0x32, 0x1, 0xd0, 0x20, 0x1f,
+    0xfa, 0x40, 0x3a, 0x40, 0x3f, 0xf9, 0x48, 0x80,
+    0xe, 0xb0, 0xf, 0xf9, 0xc8, 0x3, 0x2a, 0x0,
+    0x7f, 0xf2, 0xe4, 0x3, 0x95, 0x0, 0x3f, 0x86,
+    0x0, 0x3a, 0x0, 0x3f, 0xf9, 0x84, 0xe0, 0x1d,
+    0x20, 0x1f, 0xd0, 0x1, 0xce, 0x40, 0x1f, 0xfc,
+    0xd8, 0x10, 0xc, 0x4e, 0x1, 0xf1, 0xb0, 0x6,
+    0x28, 0x0, 0xff, 0xe7, 0xd8, 0x7, 0x40, 0x80,
+    0x7b, 0xc0, 0x3a, 0x0, 0x3f, 0xfa, 0xa, 0x80,
+    0x1d, 0x60, 0x1c, 0xa6, 0x1, 0x91, 0x40, 0x3f,
+    0xfa, 0x32, 0x1, 0xca, 0x60, 0x1a, 0xc0, 0x3a,
+    0x40, 0x3f, 0xfa, 0x44, 0xe0, 0x1d, 0xe0, 0x14,
+    0x8, 0x6, 0x72, 0x0, 0xff, 0xe1, 0x18, 0x7,
+    0xff, 0x12, 0x4, 0x3, 0x1b, 0x1, 0x38, 0x6,
+    0x18, 0x0, 0xff, 0xea, 0xd8, 0x7, 0x40, 0xc8,
+    0x7, 0x58, 0x7, 0xff, 0x59, 0x50, 0x3, 0xe,
+    0xa0, 0x6, 0x35, 0x0, 0xff, 0xeb, 0xc8, 0x7,
+    0x18, 0x7, 0x70, 0x7, 0xff, 0x60, 0x9c, 0x3,
+    0xf9, 0x88, 0x3, 0xff, 0xb3, 0x2, 0x1, 0xf0,
+    0xc0, 0x7, 0xff, 0x6e, 0xc0, 0x3e, 0x81, 0x0,
+    0xff, 0xed, 0xaa, 0x0, 0x71, 0xb0, 0x7, 0xff,
+    0x76, 0x40, 0x3b, 0xc0, 0x3f, 0xfb, 0xc4, 0xe0,
+    0x13, 0x18, 0x7, 0xff, 0x7e, 0x1d, 0xe8, 0x0,
+    0xff, 0xf0, 0xc4, 0x42, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xfe, 0x0,
 
     /* U+004E "N" */
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf3, 0xef, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x6, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x60,
-    0x2f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfe,
-    0x4f, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xf4,
+    0x4f, 0xfe, 0x50, 0xf, 0xfe, 0x69, 0x7f, 0xf9,
+    0x0, 0x3d, 0x46, 0x1, 0xff, 0xdb, 0xd1, 0x0,
+    0xff, 0xed, 0xe, 0x80, 0x7f, 0xf6, 0xce, 0x40,
+    0x3f, 0xfb, 0x6c, 0xa0, 0x1f, 0xfd, 0xba, 0x30,
+    0xf, 0xfe, 0xde, 0x88, 0x7, 0xff, 0x68, 0x74,
+    0x3, 0xff, 0xb6, 0x72, 0x1, 0xff, 0xdb, 0x65,
+    0x0, 0xff, 0xea, 0x10, 0x7, 0xa8, 0xc0, 0x3f,
+    0xfa, 0x7c, 0x20, 0x1e, 0xd1, 0x0, 0xff, 0xe9,
+    0xe, 0x80, 0x78, 0x74, 0x3, 0xff, 0xa6, 0x72,
+    0x1, 0xe3, 0x90, 0xf, 0xfe, 0x9b, 0x30, 0x3,
+    0xcc, 0xc0, 0xf, 0xfe, 0x9c, 0x98, 0x7, 0xa4,
+    0xc0, 0x3f, 0xfa, 0x7a, 0x20, 0x1e, 0xd1, 0x0,
+    0xff, 0xe9, 0xe, 0x80, 0x78, 0x74, 0x3, 0xff,
+    0xa6, 0x72, 0x1, 0xe3, 0x90, 0xf, 0xfe, 0x9b,
+    0x30, 0x3, 0xcc, 0xc0, 0xf, 0xfe, 0x9c, 0x98,
+    0x7, 0xa4, 0xc0, 0x3f, 0xfa, 0x7a, 0x20, 0x1e,
+    0xd1, 0x0, 0xff, 0xe9, 0xe, 0x80, 0x78, 0x74,
+    0x3, 0xff, 0xa6, 0x72, 0x1, 0xe3, 0x90, 0xf,
+    0xfe, 0x9b, 0x30, 0x3, 0xcc, 0xc0, 0xf, 0xfe,
+    0x9c, 0x98, 0x7, 0xa4, 0xc0, 0x3f, 0xfa, 0x7a,
+    0x20, 0x1e, 0xd1, 0x0, 0xff, 0xe9, 0xe, 0x80,
+    0x78, 0x74, 0x3, 0xff, 0xa6, 0x72, 0x1, 0xe3,
+    0x90, 0xf, 0xfe, 0x9b, 0x30, 0x3, 0xcc, 0xc0,
+    0xf, 0xfe, 0x9c, 0x98, 0x7, 0xa4, 0xc0, 0x3f,
+    0xfa, 0x7a, 0x20, 0x1e, 0xd6, 0x0, 0xff, 0xe9,
+    0xe, 0x80, 0x78, 0x64, 0x3, 0xff, 0xa6, 0x72,
+    0x1, 0xe2, 0x0, 0xff, 0xea, 0x33, 0x0, 0x3f,
+    0xfb, 0x72, 0x60, 0x1f, 0xfd, 0xbd, 0x10, 0xf,
+    0xfe, 0xd0, 0xe8, 0x7, 0xff, 0x6c, 0xe4, 0x3,
+    0xff, 0xb6, 0xcc, 0x0, 0xff, 0xed, 0xc9, 0x80,
+    0x7f, 0xf6, 0xf4, 0x40, 0x3f, 0xfb, 0x43, 0xa0,
+    0x1f, 0xfd, 0xb3, 0x90, 0xf,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x45, 0x67, 0x76, 0x54, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x75, 0x32, 0x34, 0x58, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf8, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfe, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x50,
-    0xd, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xa0,
-    0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2,
-    0x9f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5,
-    0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7,
-    0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf9,
-    0xdf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfa,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0xdf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfa,
-    0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf9,
-    0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf7,
-    0x9f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf5,
-    0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0xd, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xa0,
-    0x8, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x50,
-    0x2, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x85, 0x43, 0x34, 0x58, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x45, 0x67, 0x76, 0x54, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x8a, 0x2b, 0x3b, 0x99, 0x50,
+    0x40, 0x3f, 0xfa, 0xc4, 0xf7, 0xdc, 0xba, 0x98,
+    0x84, 0xd5, 0xf7, 0x2d, 0x84, 0x3, 0xff, 0xa0,
+    0xb9, 0xb0, 0x82, 0x1, 0xfe, 0x14, 0x9e, 0xb4,
+    0x0, 0xff, 0xe6, 0x2e, 0xd1, 0x80, 0x7f, 0xf1,
+    0x92, 0xf1, 0x0, 0x3f, 0xf9, 0x5, 0x74, 0x40,
+    0x1f, 0xfc, 0xa3, 0xb9, 0x10, 0xf, 0xfe, 0x2a,
+    0xea, 0x0, 0x7f, 0xf3, 0x9b, 0xcc, 0x3, 0xff,
+    0x86, 0xf4, 0x1, 0xfe, 0x58, 0xac, 0xdc, 0xba,
+    0x74, 0x0, 0xfe, 0x1c, 0x50, 0xf, 0xfe, 0xc,
+    0x40, 0x3, 0xf2, 0x5f, 0xd3, 0xa9, 0x91, 0xa2,
+    0xc5, 0xfd, 0x18, 0x7, 0xea, 0x50, 0xf, 0xf9,
+    0xdc, 0x1, 0xf1, 0xe5, 0xa0, 0x7, 0xfe, 0x5c,
+    0xb2, 0x0, 0xfa, 0x90, 0x3, 0xf9, 0x20, 0x3,
+    0xe9, 0xc3, 0x0, 0xff, 0xe2, 0x26, 0xb8, 0x7,
+    0xd6, 0x40, 0x1f, 0xd, 0x0, 0x78, 0x71, 0x80,
+    0x3f, 0xf9, 0x11, 0x20, 0x1f, 0x70, 0x7, 0xd6,
+    0x20, 0x1c, 0x38, 0x60, 0x1f, 0xfc, 0xa6, 0xa0,
+    0xf, 0x1b, 0x80, 0x71, 0xa8, 0x7, 0xb4, 0x80,
+    0x3f, 0xf9, 0x8b, 0x0, 0x1e, 0x81, 0x0, 0xd0,
+    0x1, 0xe8, 0x30, 0xf, 0xfe, 0x73, 0xa0, 0x7,
+    0xa4, 0x2, 0x24, 0x0, 0xe2, 0x70, 0xf, 0xfe,
+    0x84, 0x80, 0x79, 0x80, 0x2a, 0x0, 0xf4, 0x0,
+    0x7f, 0xf4, 0x49, 0x80, 0x38, 0x54, 0x0, 0xa0,
+    0x1c, 0x4a, 0x1, 0xff, 0xd2, 0x80, 0xf, 0x78,
+    0x11, 0x0, 0x3a, 0x80, 0x3f, 0xfa, 0x62, 0x80,
+    0x1c, 0xa0, 0x80, 0x1e, 0x50, 0xf, 0xfe, 0xa6,
+    0x80, 0x78, 0xbc, 0x3, 0x84, 0x80, 0x3f, 0xfa,
+    0x88, 0x1, 0xe7, 0x20, 0xe, 0x50, 0xf, 0xfe,
+    0xa9, 0x0, 0x78, 0x9c, 0x3, 0x88, 0x3, 0xff,
+    0xac, 0x40, 0x1d, 0xc2, 0x1, 0xc2, 0x1, 0xff,
+    0xd6, 0x10, 0xe, 0x33, 0x0, 0x77, 0x80, 0x7f,
+    0xf5, 0x9c, 0x3, 0xc6, 0x1, 0xde, 0x1, 0xff,
+    0xd6, 0x70, 0xf, 0x8, 0x7, 0x8, 0x7, 0xff,
+    0x58, 0x40, 0x38, 0xdc, 0x3, 0x88, 0x3, 0xff,
+    0xac, 0x40, 0x1d, 0xc4, 0x1, 0xca, 0x1, 0xff,
+    0xd5, 0x20, 0xf, 0x17, 0x80, 0x70, 0x90, 0x7,
+    0xff, 0x51, 0x0, 0x3c, 0xe8, 0x1, 0xe5, 0x0,
+    0xff, 0xea, 0x68, 0x7, 0x88, 0xa0, 0xe, 0xa0,
+    0xf, 0xfe, 0x98, 0xa0, 0x7, 0x28, 0x1, 0x40,
+    0x38, 0x94, 0x3, 0xff, 0xa5, 0x0, 0x1e, 0xf0,
+    0x5, 0x0, 0x7a, 0x0, 0x3f, 0xfa, 0x24, 0xc0,
+    0x1c, 0x2a, 0x0, 0x24, 0x0, 0xe2, 0x70, 0xf,
+    0xfe, 0x84, 0x80, 0x7a, 0x40, 0x34, 0x0, 0x7a,
+    0xc, 0x3, 0xff, 0x9c, 0xe8, 0x1, 0xc2, 0xe0,
+    0x18, 0xd4, 0x3, 0xda, 0x40, 0x1f, 0xfc, 0xc5,
+    0x80, 0xf, 0x48, 0x7, 0xac, 0x40, 0x38, 0x70,
+    0xc0, 0x3f, 0xf9, 0x4d, 0x40, 0x1e, 0x37, 0x0,
+    0xf0, 0xd0, 0x7, 0x87, 0x18, 0x3, 0xff, 0x91,
+    0x12, 0x1, 0xf7, 0x0, 0x7e, 0x48, 0x0, 0xfa,
+    0x70, 0xc0, 0x3f, 0xf8, 0x89, 0xae, 0x1, 0xf5,
+    0x90, 0x7, 0xf3, 0xb8, 0x3, 0xe3, 0xcb, 0x40,
+    0xf, 0xfc, 0xb9, 0x64, 0x1, 0xf5, 0x20, 0x7,
+    0xfd, 0x10, 0x0, 0xfc, 0x97, 0xf7, 0xa, 0x86,
+    0x64, 0x58, 0xbf, 0xa3, 0x0, 0xfd, 0x4a, 0x1,
+    0xff, 0xc1, 0x7a, 0x0, 0xff, 0x23, 0xd5, 0xe6,
+    0x2e, 0x9d, 0x0, 0x3f, 0x87, 0x14, 0x3, 0xff,
+    0x86, 0xba, 0x80, 0x1f, 0xfc, 0xe6, 0xf3, 0x0,
+    0xff, 0xe2, 0x95, 0xd1, 0x0, 0x7f, 0xf2, 0x8e,
+    0xe4, 0x40, 0x3f, 0xf9, 0xb, 0xb4, 0x60, 0x1f,
+    0xfc, 0x64, 0xbc, 0x40, 0xf, 0xfe, 0x62, 0xe6,
+    0xc2, 0x8, 0x7, 0xf8, 0x52, 0x7a, 0xd0, 0x3,
+    0xff, 0xa0, 0x4f, 0x7d, 0xcb, 0xa9, 0x88, 0x4d,
+    0x5f, 0x72, 0xd8, 0x40, 0x3f, 0xf8, 0x60,
 
     /* U+0050 "P" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xed, 0xb8, 0x51, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x98, 0x88, 0x88, 0x88, 0x88, 0x89, 0x9a, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf4, 0x4, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xb0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf5, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x94, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xfb, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xd4, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfc, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xa4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf7, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xe0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xf8, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x18, 0xff, 0xff, 0xff, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x12, 0x47, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77,
-    0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x4f, 0xff, 0xfe, 0x3f, 0x6d, 0xc2, 0x88, 0x7,
+    0xff, 0x4c, 0x49, 0x1e, 0xbb, 0x18, 0x3, 0xff,
+    0xae, 0x73, 0xcc, 0x1, 0xff, 0xd7, 0x19, 0xc2,
+    0x0, 0xff, 0xeb, 0x9e, 0x98, 0x7, 0xfc, 0xce,
+    0xff, 0xe6, 0x62, 0x90, 0x7, 0xfb, 0xc, 0x3,
+    0xfd, 0x71, 0x1f, 0xe9, 0x95, 0x6f, 0xda, 0x80,
+    0x7e, 0xd1, 0x0, 0xff, 0xe6, 0xa5, 0x72, 0x80,
+    0x78, 0x68, 0x3, 0xff, 0x9e, 0x35, 0x20, 0x1e,
+    0x44, 0x0, 0x7f, 0xf4, 0x1a, 0x0, 0x3d, 0xe0,
+    0x1f, 0xfd, 0x17, 0x20, 0xe, 0x41, 0x0, 0xff,
+    0xe8, 0xc8, 0x7, 0x90, 0x3, 0xff, 0xa2, 0x80,
+    0x1e, 0xc0, 0xf, 0xfe, 0x92, 0x0, 0x71, 0x0,
+    0x7f, 0xf4, 0x84, 0x3, 0x98, 0x3, 0xff, 0xa4,
+    0x40, 0x1f, 0xfd, 0x81, 0x0, 0xff, 0xec, 0x18,
+    0x7, 0x8, 0x7, 0xff, 0x49, 0xc0, 0x39, 0x80,
+    0x3f, 0xfa, 0x24, 0x40, 0xe, 0xd0, 0xf, 0xfe,
+    0x8d, 0x0, 0x78, 0xc0, 0x3f, 0xfa, 0x4, 0xe0,
+    0x1c, 0x28, 0x1, 0xff, 0xcf, 0x1f, 0x0, 0xf3,
+    0x0, 0x7f, 0xf3, 0xcb, 0x48, 0x3, 0xd2, 0x1,
+    0xff, 0xcd, 0x18, 0xd3, 0x0, 0xf4, 0x88, 0x7,
+    0xff, 0x20, 0x49, 0x1e, 0xf9, 0xc0, 0x3e, 0x56,
+    0x0, 0xfe, 0xdf, 0xff, 0xfb, 0xb6, 0xe1, 0x0,
+    0x3f, 0x25, 0x0, 0x7f, 0xf5, 0x9a, 0xc0, 0x3f,
+    0xfa, 0xa3, 0x52, 0x1, 0xff, 0xd4, 0x18, 0xe5,
+    0x0, 0xff, 0xe9, 0x13, 0x5f, 0x38, 0x7, 0xff,
+    0xd, 0x9d, 0xff, 0xe8, 0x85, 0x67, 0x6c, 0xa0,
+    0x7, 0xff, 0x16, 0xe2, 0x3f, 0xe7, 0x72, 0x98,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xf0,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x45, 0x67, 0x76, 0x54, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xb6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x75, 0x32, 0x34, 0x58, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xb2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4d, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0xe, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xf0, 0x0, 0x6f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf5, 0x0, 0xbf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf8, 0x0, 0xcf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf9, 0x0, 0xdf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xfa, 0x0, 0xef,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa, 0x0,
-    0xdf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfa,
-    0x0, 0xcf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf9, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf7, 0x0, 0x8f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf4, 0x0, 0x6f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf2, 0x0, 0x2f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xe0, 0x0, 0xd, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x90, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xcf, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xe9,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xca, 0x87, 0x78, 0xad, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x47, 0xad, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x83, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xf9, 0x41, 0x1, 0x37, 0xcf, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7a,
-    0xde, 0xff, 0xdb, 0x72, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x8a, 0x2b, 0x3b, 0x99, 0x50,
+    0x40, 0x3f, 0xfb, 0x4, 0xf7, 0xdc, 0xba, 0x98,
+    0x84, 0xd5, 0xf7, 0x2d, 0x84, 0x3, 0xff, 0xa4,
+    0xb9, 0xb0, 0x82, 0x1, 0xfe, 0x14, 0x9e, 0xb4,
+    0x0, 0xff, 0xe7, 0x2e, 0xd1, 0x80, 0x7f, 0xf1,
+    0x92, 0xf1, 0x0, 0x3f, 0xf9, 0x45, 0x74, 0x40,
+    0x1f, 0xfc, 0xa3, 0xba, 0x10, 0xf, 0xfe, 0x3a,
+    0xea, 0x0, 0x7f, 0xf3, 0x97, 0xcc, 0x3, 0xff,
+    0x8b, 0x14, 0x1, 0xfe, 0x58, 0xac, 0xdc, 0xba,
+    0x74, 0x0, 0xfe, 0x1c, 0x60, 0xf, 0xfe, 0x1c,
+    0xb8, 0x7, 0xe4, 0xbf, 0xa7, 0x53, 0x23, 0x45,
+    0x8b, 0xfa, 0x30, 0xf, 0xd2, 0xc0, 0x1f, 0xfc,
+    0x17, 0x60, 0xf, 0x93, 0x6d, 0x0, 0x3f, 0xf2,
+    0xe5, 0x90, 0x7, 0xd2, 0xa0, 0x1f, 0xf2, 0x40,
+    0x7, 0xd3, 0x64, 0x1, 0xff, 0xc4, 0x4d, 0x70,
+    0xf, 0xa8, 0x80, 0x3f, 0x86, 0x80, 0x3c, 0x38,
+    0xc0, 0x1f, 0xfc, 0x88, 0xa0, 0xf, 0xbc, 0x3,
+    0xfa, 0xc4, 0x3, 0x87, 0xc, 0x3, 0xff, 0x94,
+    0xb6, 0x1, 0xe2, 0x80, 0xf, 0x8d, 0x40, 0x3d,
+    0xa4, 0x1, 0xff, 0xcc, 0x49, 0x0, 0xf3, 0x88,
+    0x7, 0xa0, 0x3, 0xd0, 0x60, 0x1f, 0xfc, 0xe6,
+    0x40, 0xf, 0x48, 0x7, 0x1a, 0x0, 0x71, 0xb8,
+    0x7, 0xff, 0x42, 0x80, 0x3c, 0xe0, 0x1d, 0x60,
+    0x1e, 0x80, 0xf, 0xfe, 0x88, 0xb8, 0x7, 0x94,
+    0x3, 0x30, 0x7, 0x1a, 0x0, 0x7f, 0xf4, 0xa4,
+    0x3, 0xdc, 0x1, 0x10, 0x80, 0x75, 0x0, 0x7f,
+    0xf4, 0xc5, 0x0, 0x39, 0x0, 0x24, 0x0, 0xf3,
+    0x80, 0x7f, 0xf5, 0x38, 0x3, 0xc4, 0x0, 0xf0,
+    0xe, 0x11, 0x0, 0x7f, 0xf5, 0x1c, 0x3, 0xce,
+    0x0, 0x20, 0xe, 0x50, 0xf, 0xfe, 0xa9, 0x0,
+    0x7b, 0x40, 0xe, 0x1, 0xc4, 0x1, 0xff, 0xd6,
+    0x20, 0xe, 0x10, 0x0, 0x80, 0x70, 0x80, 0x7f,
+    0xf5, 0x84, 0x3, 0x8c, 0x0, 0x60, 0x1d, 0xe0,
+    0x1f, 0xfd, 0x67, 0x0, 0xfc, 0x60, 0x1d, 0xe0,
+    0x1f, 0xfd, 0x67, 0x0, 0xfc, 0x20, 0x1c, 0x20,
+    0x1f, 0xfd, 0x61, 0x0, 0xe3, 0x0, 0x38, 0x7,
+    0x28, 0x7, 0xff, 0x58, 0x80, 0x3b, 0x80, 0x6,
+    0x1, 0xc6, 0x1, 0xff, 0xd5, 0x30, 0xf, 0x18,
+    0x3, 0x80, 0x3c, 0x60, 0x1f, 0xfd, 0x44, 0x0,
+    0xf3, 0x0, 0x10, 0x3, 0xd6, 0x1, 0xff, 0xd4,
+    0xb0, 0xe, 0x12, 0x0, 0x11, 0x0, 0x39, 0x80,
+    0x3f, 0xfa, 0x64, 0x60, 0x1c, 0xe0, 0x19, 0x40,
+    0x38, 0x58, 0x3, 0xff, 0xa5, 0x0, 0x1e, 0xd0,
+    0xd, 0x40, 0x1e, 0x81, 0x0, 0xff, 0xe8, 0x1a,
+    0x80, 0x71, 0x20, 0x6, 0x25, 0x0, 0xe1, 0xb0,
+    0xf, 0xfe, 0x87, 0x0, 0x7a, 0xc0, 0x3d, 0x20,
+    0x1e, 0x56, 0x0, 0xff, 0xe7, 0x51, 0x0, 0x71,
+    0x30, 0x7, 0x8d, 0x80, 0x3d, 0x2a, 0x1, 0xff,
+    0xcc, 0x95, 0x0, 0xf4, 0x0, 0x7e, 0x81, 0x0,
+    0xf5, 0x38, 0x7, 0xff, 0x2a, 0x98, 0x3, 0xca,
+    0xa0, 0xf, 0xc3, 0x40, 0x1f, 0x45, 0x8, 0x7,
+    0xff, 0x18, 0xf1, 0x40, 0x3c, 0x54, 0x1, 0xfe,
+    0x49, 0x0, 0xf9, 0x7d, 0xc0, 0x3f, 0xf8, 0x63,
+    0x38, 0x60, 0x1e, 0x1f, 0x0, 0xff, 0xcc, 0xe0,
+    0x1f, 0xc, 0x74, 0xa0, 0x7, 0xf9, 0x6b, 0x98,
+    0x3, 0xe1, 0xd2, 0x0, 0xff, 0xe0, 0xc4, 0x80,
+    0x7e, 0x16, 0xbf, 0xca, 0x87, 0x74, 0x56, 0xfd,
+    0x28, 0x7, 0xe2, 0xc3, 0x0, 0xff, 0xe1, 0xb5,
+    0x88, 0x7, 0xf8, 0xd5, 0xe2, 0xe, 0xa4, 0x1,
+    0xfe, 0x4c, 0x20, 0xf, 0xfe, 0x2a, 0x7a, 0x0,
+    0x7f, 0xf3, 0x46, 0x6c, 0x40, 0x3f, 0xf8, 0xe3,
+    0x76, 0x30, 0xf, 0xfe, 0x53, 0xf3, 0x0, 0x7f,
+    0xf2, 0xd3, 0x2d, 0x40, 0x3f, 0xf8, 0xa7, 0x3f,
+    0x0, 0x1f, 0xfc, 0xf4, 0xaf, 0xb8, 0x52, 0x10,
+    0xf, 0xe7, 0xec, 0x60, 0xf, 0xfe, 0xa2, 0x3d,
+    0x6f, 0x7d, 0x80, 0x7c, 0xc4, 0x1, 0xff, 0xc2,
+    0x83, 0x0, 0xff, 0xe6, 0x25, 0x80, 0x78, 0x71,
+    0x40, 0x3f, 0xf4, 0xbe, 0x88, 0x7, 0xff, 0x31,
+    0x30, 0x40, 0x3d, 0x52, 0x20, 0x1f, 0x8f, 0x58,
+    0x7, 0x40, 0x3f, 0xf9, 0xa7, 0x82, 0x1, 0xe6,
+    0xe9, 0x41, 0x1, 0x37, 0xcc, 0x10, 0x4, 0x72,
+    0x1, 0xff, 0xcd, 0x2f, 0x30, 0xf, 0x9a, 0xfb,
+    0xfb, 0x20, 0xc0, 0x3d, 0x40, 0x1f, 0xfc, 0xe1,
+    0xc7, 0x0, 0xff, 0xe3, 0xe, 0x18, 0x7, 0xff,
+    0x42, 0x30, 0x80, 0x3f, 0xf8, 0x69, 0xe6, 0x1,
+    0xff, 0xd2, 0x3d, 0xa2, 0x0, 0xff, 0x8e, 0xec,
+    0x20, 0x1f, 0xfd, 0x55, 0xdd, 0x42, 0x90, 0x80,
+    0x9, 0x23, 0x71, 0x0, 0x30,
 
     /* U+0052 "R" */
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xed, 0xb8, 0x51, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf9, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x99, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfb, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x10, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x50, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x90, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xb0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xd0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xd0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xa0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x70, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x30, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfe, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xf8, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x24, 0x7b, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf7, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x5c,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfd,
-    0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x90, 0x4f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf4,
+    0x4f, 0xff, 0xfe, 0x3f, 0x6d, 0xc2, 0x88, 0x7,
+    0xff, 0x50, 0x49, 0x1e, 0xbb, 0x18, 0x3, 0xff,
+    0xb0, 0x73, 0xcc, 0x1, 0xff, 0xd8, 0x19, 0xc2,
+    0x0, 0xff, 0xec, 0x1e, 0x98, 0x7, 0xfe, 0x67,
+    0x7f, 0xf3, 0x31, 0x48, 0x3, 0xfd, 0x86, 0x1,
+    0xff, 0x5c, 0x47, 0xfa, 0x65, 0x5b, 0xf6, 0xa0,
+    0x1f, 0xb4, 0x40, 0x3f, 0xf9, 0xc9, 0x5c, 0xa0,
+    0x1e, 0x1a, 0x0, 0xff, 0xe8, 0xd, 0x48, 0x7,
+    0x91, 0x0, 0x1f, 0xfd, 0x16, 0x80, 0xf, 0x78,
+    0x7, 0xff, 0x49, 0xcc, 0x3, 0x90, 0x40, 0x3f,
+    0xfa, 0x50, 0x1, 0xe4, 0x0, 0xff, 0xe9, 0x20,
+    0x7, 0xb0, 0x3, 0xff, 0xa6, 0x80, 0x1c, 0x40,
+    0x1f, 0xfd, 0x31, 0x0, 0xe6, 0x0, 0xff, 0xe9,
+    0x90, 0x7, 0xff, 0x64, 0x40, 0x3f, 0xfb, 0x26,
+    0x1, 0xc2, 0x1, 0xff, 0xd3, 0x70, 0xe, 0x60,
+    0xf, 0xfe, 0x91, 0x10, 0x3, 0xb4, 0x3, 0xff,
+    0xa5, 0x40, 0x1e, 0x40, 0xf, 0xfe, 0x89, 0x38,
+    0x7, 0x9, 0x80, 0x7f, 0xf4, 0x7, 0xc0, 0x3c,
+    0xc0, 0x1f, 0xfd, 0x2, 0xc2, 0x0, 0xe1, 0x90,
+    0xf, 0xfe, 0x70, 0xc6, 0x90, 0x7, 0xa0, 0x40,
+    0x3f, 0xf9, 0x22, 0x48, 0xf7, 0xce, 0x1, 0xf3,
+    0x30, 0x3, 0xfd, 0xbf, 0xff, 0xf7, 0x6d, 0xc2,
+    0x0, 0x7e, 0x49, 0x0, 0xff, 0xeb, 0xb5, 0x80,
+    0x7f, 0xf5, 0x8a, 0xe4, 0x3, 0xff, 0xaa, 0x75,
+    0xa8, 0x1, 0xff, 0xd6, 0xa5, 0x0, 0xff, 0xe2,
+    0x44, 0xcf, 0xfd, 0x54, 0x30, 0xe, 0x92, 0x0,
+    0xff, 0xe2, 0x2b, 0x37, 0xfc, 0xaa, 0xe0, 0xf,
+    0x70, 0x7, 0xff, 0x48, 0xa4, 0x3, 0x8e, 0x0,
+    0x3f, 0xfa, 0x4c, 0x80, 0x1c, 0xe6, 0x1, 0xff,
+    0xd2, 0xa1, 0x0, 0xee, 0x0, 0xff, 0xe9, 0xd,
+    0x80, 0x71, 0x50, 0x7, 0xff, 0x49, 0x58, 0x3,
+    0x95, 0x40, 0x1f, 0xfd, 0x29, 0x20, 0xe, 0xb1,
+    0x0, 0xff, 0xe9, 0x70, 0x7, 0xd, 0x0, 0x7f,
+    0xf4, 0x8e, 0x0, 0x39, 0x1c, 0x3, 0xff, 0xa4,
+    0xe6, 0x1, 0xd0, 0x60, 0x1f, 0xfd, 0x2e, 0x0,
+    0xf7, 0x0, 0x7f, 0xf4, 0x8a, 0x40, 0x38, 0xa4,
+    0x3, 0xff, 0xa4, 0xca, 0x1, 0xcc, 0x80,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x67, 0x77, 0x75, 0x42, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xe9, 0x52, 0x0, 0x0, 0x1, 0x47,
-    0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2a, 0xf9,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x32, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x37, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0,
-    0x0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xc0, 0x0, 0xcf, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x70, 0x4, 0xff, 0xff, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0x10, 0xb, 0xff,
-    0xff, 0xff, 0xc5, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x84, 0x20,
-    0x0, 0x0, 0x3, 0x5a, 0xef, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0xad,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x56, 0x77, 0x76, 0x64, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x12, 0x33, 0xbe, 0x54, 0x20,
+    0xf, 0xfe, 0x51, 0xc6, 0x7e, 0xdc, 0xc4, 0x6a,
+    0xbd, 0xfc, 0x83, 0x0, 0xff, 0xe2, 0x2e, 0x61,
+    0xcc, 0x3, 0xff, 0x1b, 0xe7, 0x41, 0x0, 0x7f,
+    0xc5, 0x94, 0x60, 0x1f, 0xfc, 0x61, 0x7d, 0x91,
+    0x0, 0xfc, 0x9a, 0x60, 0x1f, 0xfc, 0xb6, 0xe1,
+    0x0, 0xf2, 0xd8, 0x7, 0xfe, 0x10, 0xf, 0xfe,
+    0x9, 0x8, 0x7, 0x15, 0x0, 0x7c, 0x2d, 0x5b,
+    0xfe, 0xef, 0xf7, 0x5c, 0x20, 0x7, 0xd6, 0x1,
+    0xe9, 0x0, 0xfa, 0x3a, 0x54, 0x80, 0x38, 0x51,
+    0xef, 0xe9, 0x0, 0x33, 0x0, 0x72, 0x20, 0x3,
+    0x87, 0x5c, 0x3, 0xff, 0x84, 0xb7, 0xaa, 0xc,
+    0x1, 0xee, 0x0, 0xf6, 0x10, 0x7, 0xff, 0x14,
+    0xab, 0x2c, 0x3, 0xc8, 0x1, 0xce, 0x40, 0x1f,
+    0xfc, 0x83, 0x20, 0xe, 0x21, 0x0, 0xeb, 0x0,
+    0xff, 0xe8, 0x8, 0x7, 0x8c, 0x3, 0xff, 0xa0,
+    0xe0, 0x1f, 0xfd, 0x77, 0x0, 0xf1, 0x0, 0x7f,
+    0xf4, 0x8, 0x3, 0xd4, 0x1, 0xff, 0xd0, 0x11,
+    0x0, 0x73, 0xa0, 0x7, 0xff, 0x41, 0xc0, 0x3d,
+    0x6e, 0x1, 0xff, 0xcf, 0xb0, 0xf, 0xa3, 0x14,
+    0x3, 0xff, 0x9a, 0x4c, 0x1, 0xf1, 0xd7, 0x42,
+    0x0, 0x7f, 0xf2, 0xe4, 0xc0, 0x3f, 0xb, 0xdf,
+    0xdb, 0x98, 0x7, 0xff, 0x23, 0x10, 0x3, 0xfe,
+    0x48, 0xcf, 0xb7, 0x20, 0xf, 0xfe, 0x2d, 0xb8,
+    0x7, 0xff, 0x9, 0x23, 0x75, 0x6, 0x1, 0xff,
+    0xc3, 0x8d, 0x50, 0xf, 0xfe, 0x19, 0x3e, 0x6b,
+    0x0, 0x7f, 0xf0, 0x8a, 0xba, 0xc, 0x3, 0xff,
+    0x86, 0x53, 0xa6, 0x1, 0xff, 0xc2, 0x17, 0xce,
+    0x95, 0x10, 0xf, 0xfe, 0x9, 0x63, 0x0, 0x7f,
+    0xf1, 0x5, 0xab, 0xb2, 0x10, 0x3, 0xff, 0x4b,
+    0x80, 0x7f, 0xf1, 0xcd, 0xef, 0xf1, 0xcc, 0x3,
+    0xfa, 0x10, 0x3, 0xff, 0x94, 0x71, 0x9a, 0xc0,
+    0x1f, 0xa8, 0x3, 0xff, 0x9a, 0x53, 0xc8, 0x1,
+    0xe1, 0x60, 0xf, 0xfe, 0x70, 0xdb, 0x0, 0x7b,
+    0x40, 0x3f, 0xfa, 0x12, 0x40, 0x1c, 0xa0, 0x1f,
+    0xfd, 0x1b, 0x0, 0xe1, 0x0, 0xff, 0xe8, 0xa8,
+    0x7, 0x84, 0x3, 0xff, 0xe8, 0xc0, 0x1e, 0x10,
+    0x2, 0xd8, 0x7, 0xff, 0x33, 0xc0, 0x38, 0xc0,
+    0x29, 0x4e, 0x40, 0xf, 0xfe, 0x49, 0xa8, 0x7,
+    0x58, 0x1, 0xc, 0x6, 0xec, 0x60, 0x1f, 0xfc,
+    0x63, 0xd0, 0xf, 0x30, 0x3, 0xc0, 0x32, 0x66,
+    0x14, 0x40, 0x3f, 0xf8, 0x4f, 0x82, 0x1, 0xcc,
+    0x20, 0x48, 0x1, 0xe3, 0xae, 0xb8, 0x42, 0x0,
+    0xf1, 0xad, 0x74, 0x0, 0x78, 0xa0, 0x0, 0x4c,
+    0x1, 0xfc, 0x8f, 0x7b, 0xfe, 0xef, 0xfb, 0x29,
+    0x44, 0x3, 0xc3, 0xe2, 0x1, 0x4d, 0x8, 0x7,
+    0xff, 0x4, 0x40, 0x3f, 0xf0, 0xe1, 0x0, 0x72,
+    0xf4, 0x8, 0x7, 0xff, 0x2d, 0x7c, 0x80, 0x3f,
+    0x3f, 0x52, 0x0, 0x7f, 0xf1, 0xd3, 0x28, 0x40,
+    0x3f, 0xe5, 0xbe, 0xa5, 0x20, 0xf, 0xfc, 0x91,
+    0xd6, 0x60, 0x1f, 0xfc, 0x31, 0x5a, 0xdf, 0xca,
+    0x98, 0x8a, 0x65, 0x7b, 0xf6, 0xe2, 0x1, 0xfc,
 
     /* U+0054 "T" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x68,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8b, 0xff,
-    0xff, 0xff, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xff, 0xfe, 0xc2, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0xe0, 0xa, 0x77, 0xff, 0xe1, 0x20,
+    0x7, 0x9d, 0xff, 0xf8, 0x8d, 0x11, 0xff, 0xc2,
+    0xd0, 0xf, 0x44, 0x7f, 0xf0, 0xc8, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xf1, 0xc0,
 
     /* U+0055 "U" */
-    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0xaf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x3a, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0xaf, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x3a, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x3a, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x3a,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x3a, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf3, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0xaf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x3a, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0xaf, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x3a, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x3a, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x3a,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x29, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf2, 0x8f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf0, 0x4f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfd, 0x1, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0,
-    0xd, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf6, 0x0, 0x9f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x20, 0x3,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xd0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xa6, 0x43, 0x34, 0x57, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x35, 0x67, 0x77,
-    0x64, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xaf, 0xfe, 0xb0, 0xf, 0xfe, 0x6f, 0xff, 0x8c,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1e, 0x70, 0xf, 0xfe, 0x98, 0x98, 0x7,
+    0x8, 0x7, 0xff, 0x30, 0x40, 0x3e, 0x10, 0xe,
+    0x30, 0xf, 0xfe, 0x61, 0x80, 0x78, 0xf8, 0x3,
+    0x84, 0x40, 0x1f, 0xfc, 0xb7, 0x0, 0xf0, 0x90,
+    0x7, 0x94, 0x3, 0xff, 0x97, 0xa0, 0x1c, 0x40,
+    0xa0, 0x1e, 0x30, 0xf, 0xfe, 0x5a, 0x0, 0x73,
+    0x80, 0x90, 0x7, 0x50, 0x7, 0xff, 0x28, 0x4c,
+    0x3, 0xb0, 0x0, 0x80, 0x1c, 0x46, 0x1, 0xff,
+    0xc9, 0x90, 0xf, 0x20, 0x2, 0x80, 0x3d, 0x0,
+    0x1f, 0xfc, 0x81, 0x60, 0xe, 0x22, 0x0, 0xc,
+    0x80, 0x39, 0x18, 0x3, 0xff, 0x8f, 0x42, 0x1,
+    0xd6, 0x1, 0xac, 0x3, 0xd2, 0x80, 0x1f, 0xfc,
+    0x58, 0x40, 0xe, 0x16, 0x0, 0xcc, 0x40, 0x1e,
+    0xb5, 0x0, 0xff, 0xe1, 0xd3, 0x80, 0x7a, 0x0,
+    0x3d, 0xc0, 0x1f, 0x56, 0x18, 0x7, 0xfc, 0xdc,
+    0xa0, 0x1e, 0x36, 0x0, 0xf1, 0xc8, 0x7, 0xc7,
+    0x9d, 0x4c, 0x86, 0x64, 0x57, 0xbf, 0x91, 0x0,
+    0xf0, 0xe8, 0x7, 0xe6, 0x70, 0xf, 0xc2, 0xb3,
+    0x79, 0x8b, 0xa8, 0x40, 0xf, 0xc3, 0x82, 0x1,
+    0xfd, 0x12, 0x1, 0xff, 0xcc, 0x2c, 0x20, 0xf,
+    0xf9, 0xb0, 0x80, 0x3f, 0xf9, 0x2d, 0xa4, 0x1,
+    0xff, 0xc1, 0x3d, 0x92, 0x0, 0xff, 0xe2, 0xa6,
+    0x48, 0x7, 0xff, 0x15, 0xb6, 0xd8, 0x80, 0x3f,
+    0xe3, 0x8e, 0xb3, 0x0, 0xff, 0xe4, 0x24, 0xef,
+    0x65, 0x4c, 0x45, 0x37, 0xbf, 0x8e, 0x20, 0x1f,
+    0xf0,
 
     /* U+0056 "V" */
-    0xd, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x60,
-    0x6f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0,
-    0xef, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x10, 0x0, 0x1f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0xa, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x10, 0x1, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf7, 0x0, 0x8f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xe0, 0xe, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x56, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfc, 0xdf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xd, 0xff, 0xf0, 0x80, 0x7f, 0xf4, 0xff, 0xfc,
+    0xc1, 0x60, 0x1e, 0x60, 0xf, 0xfe, 0x93, 0x0,
+    0x70, 0xb0, 0x30, 0x80, 0x74, 0x80, 0x7f, 0xf4,
+    0xac, 0x3, 0x98, 0x2, 0x60, 0xe, 0x15, 0x0,
+    0xff, 0xe8, 0x21, 0x0, 0x74, 0x80, 0x52, 0x1,
+    0xe9, 0x0, 0xff, 0xe8, 0x78, 0x7, 0x28, 0x80,
+    0x42, 0xa0, 0x1c, 0x66, 0x0, 0xff, 0xe7, 0x12,
+    0x0, 0x74, 0x80, 0x74, 0x80, 0x7a, 0x40, 0x3f,
+    0xf9, 0xd0, 0x1, 0xc6, 0x60, 0xe, 0x33, 0x0,
+    0x72, 0x90, 0x7, 0xff, 0x30, 0x54, 0x3, 0xa4,
+    0x3, 0xe9, 0x0, 0xf5, 0x0, 0x7f, 0xf3, 0x24,
+    0x3, 0x85, 0x40, 0x3e, 0x51, 0x0, 0xe7, 0x0,
+    0xff, 0xe6, 0x30, 0x7, 0x48, 0x7, 0xf4, 0x80,
+    0x79, 0x80, 0x3f, 0xf9, 0x4c, 0x20, 0x1c, 0xc0,
+    0x1f, 0xcc, 0x1, 0xeb, 0x0, 0xff, 0xe5, 0x58,
+    0x7, 0x30, 0x80, 0x7f, 0xb, 0x0, 0x71, 0x20,
+    0x7, 0xff, 0x21, 0x8, 0x3, 0xac, 0x3, 0xfe,
+    0xb0, 0xf, 0x78, 0x7, 0xff, 0x23, 0xc0, 0x39,
+    0x8, 0x3, 0xfe, 0x24, 0x0, 0xe4, 0x20, 0xf,
+    0xfe, 0x31, 0x20, 0x7, 0x78, 0x7, 0xff, 0x7,
+    0xc0, 0x3d, 0x60, 0x1f, 0xfc, 0x6b, 0x0, 0xe2,
+    0x40, 0xf, 0xfe, 0xa, 0x10, 0x7, 0x30, 0x80,
+    0x7f, 0xf1, 0x5, 0x80, 0x3a, 0xc0, 0x3f, 0xf8,
+    0x76, 0x1, 0xe6, 0x0, 0xff, 0xe2, 0x30, 0x7,
+    0x98, 0x3, 0xff, 0x86, 0xc2, 0x1, 0xd2, 0x1,
+    0xff, 0xc4, 0x90, 0xe, 0x70, 0xf, 0xfe, 0x2b,
+    0x0, 0x70, 0xa8, 0x7, 0xff, 0x9, 0x44, 0x3,
+    0xa8, 0x3, 0xff, 0x8b, 0x20, 0x1e, 0x90, 0xf,
+    0xfe, 0x14, 0x80, 0x72, 0x90, 0x7, 0xff, 0x14,
+    0x54, 0x3, 0x8c, 0xc0, 0x1f, 0xf8, 0xcc, 0x1,
+    0xd2, 0x1, 0xff, 0xc7, 0x90, 0xf, 0x48, 0x7,
+    0xfe, 0x90, 0xe, 0x33, 0x0, 0x7f, 0xf1, 0xcc,
+    0xc0, 0x1c, 0xa2, 0x1, 0xfe, 0x15, 0x0, 0xe9,
+    0x0, 0xff, 0xe4, 0xc8, 0x7, 0xa4, 0x3, 0xfd,
+    0x20, 0x1c, 0x2a, 0x1, 0xff, 0xc9, 0x51, 0x0,
+    0xe6, 0x0, 0xff, 0x30, 0x7, 0x48, 0x7, 0xff,
+    0x2e, 0x40, 0x38, 0x58, 0x3, 0xf3, 0x8, 0x7,
+    0x30, 0x7, 0xff, 0x2d, 0x80, 0x3d, 0x60, 0x1f,
+    0xac, 0x3, 0x98, 0x40, 0x3f, 0xf9, 0x62, 0xc0,
+    0x1c, 0x48, 0x1, 0xe4, 0x20, 0xe, 0xb0, 0xf,
+    0xfe, 0x6d, 0x80, 0x7b, 0xc0, 0x3d, 0xe0, 0x1c,
+    0x84, 0x1, 0xff, 0xcd, 0x24, 0x0, 0xe4, 0x20,
+    0xc, 0x48, 0x1, 0xde, 0x1, 0xff, 0xcf, 0xf0,
+    0xf, 0x58, 0x6, 0x80, 0xe, 0x24, 0x0, 0xff,
+    0xe7, 0xa1, 0x0, 0x73, 0x8, 0x0, 0x54, 0x3,
+    0xa8, 0x3, 0xff, 0xa3, 0x60, 0x1e, 0x60, 0x4,
+    0x80, 0x79, 0xc0, 0x3f, 0xfa, 0x2c, 0x20, 0x1d,
+    0x20, 0x6, 0x0, 0xe6, 0x0, 0xff, 0xe9, 0xb0,
+    0x7, 0xa, 0xb0, 0x80, 0x75, 0x80, 0x7f, 0xf4,
+    0xe4, 0x3, 0xd3, 0x60, 0x1c, 0x84, 0x1, 0xff,
+    0xd3, 0x15, 0x0, 0xe3, 0x20, 0xe, 0xf0, 0xf,
+    0xfe, 0xac, 0x80, 0x7f, 0xc4, 0x80, 0x1f, 0xfd,
+    0x53, 0x30, 0x7, 0xfa, 0xc0, 0x3f, 0xfa, 0xf2,
+    0x1, 0xfc, 0x2c, 0x1, 0xff, 0xd7, 0x51, 0x0,
+    0xfc, 0xc0, 0x1f, 0xfd, 0x99, 0x0, 0xfd, 0x20,
+    0x1f, 0xfd, 0x96, 0x0, 0xf9, 0x44, 0x3, 0xff,
+    0xb2, 0x2c, 0x1, 0xe9, 0x0, 0xff, 0xe3, 0x80,
 
     /* U+0057 "W" */
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfd, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x80, 0x0, 0x2f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xec,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf9, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0xb,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf9, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x30, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0xb,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x30, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x7, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x20, 0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xb0, 0x0, 0x2f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf7, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10, 0x8,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0, 0x0, 0xaf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0xdf, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x20, 0xf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf7, 0x5, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x18, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0xaf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0xef, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xcf, 0xfe, 0xc0, 0xf, 0xfe, 0x66, 0xff, 0xf3,
+    0x0, 0x7f, 0xf2, 0xcf, 0xff, 0xb4, 0x2c, 0x3,
+    0x8c, 0x80, 0x3f, 0xf9, 0x44, 0x40, 0xe, 0xd0,
+    0xf, 0xfe, 0x5d, 0x0, 0x72, 0x83, 0x0, 0x79,
+    0x40, 0x3f, 0xf9, 0x54, 0x1, 0xe4, 0x10, 0xf,
+    0xfe, 0x53, 0x80, 0x75, 0x0, 0x98, 0x7, 0x58,
+    0x7, 0xff, 0x29, 0x40, 0x3e, 0x70, 0xf, 0xfe,
+    0x49, 0x88, 0x6, 0x22, 0x0, 0x2c, 0x3, 0x8c,
+    0x80, 0x3f, 0xf9, 0x6, 0x40, 0x1f, 0x68, 0x7,
+    0xff, 0x26, 0x80, 0x39, 0x40, 0x25, 0x0, 0xf2,
+    0x80, 0x7f, 0xf2, 0x2c, 0x3, 0xf2, 0x8, 0x7,
+    0xff, 0x21, 0xc0, 0x3a, 0x80, 0x22, 0x30, 0xe,
+    0xb0, 0xf, 0xfe, 0x43, 0x0, 0x7f, 0x38, 0x7,
+    0xff, 0x1d, 0x4, 0x3, 0x11, 0x0, 0x35, 0x80,
+    0x71, 0x88, 0x7, 0xff, 0x18, 0xc4, 0x3, 0xfa,
+    0x80, 0x3f, 0xf8, 0xfa, 0x1, 0xca, 0x1, 0xca,
+    0x1, 0xe6, 0x0, 0xff, 0xe3, 0x50, 0x7, 0xf8,
+    0xc4, 0x3, 0xff, 0x8c, 0xe0, 0x1d, 0x40, 0x1c,
+    0x46, 0x1, 0xd6, 0x1, 0xff, 0xc6, 0x70, 0xc,
+    0x26, 0x1, 0xce, 0x1, 0xff, 0xc5, 0x41, 0x0,
+    0xc4, 0x40, 0xf, 0x58, 0x7, 0x18, 0x80, 0x7f,
+    0xf1, 0x10, 0x40, 0x33, 0xd0, 0x7, 0x50, 0x7,
+    0xff, 0x17, 0x40, 0x39, 0x40, 0x3e, 0x50, 0xf,
+    0x30, 0x7, 0xff, 0x13, 0x40, 0x3b, 0x5c, 0x3,
+    0x8c, 0x40, 0x3f, 0xf8, 0x8e, 0x1, 0xd6, 0x1,
+    0xf1, 0x18, 0x7, 0x58, 0x7, 0xff, 0x11, 0x80,
+    0x30, 0xa0, 0xa0, 0x7, 0x38, 0x7, 0xff, 0xd,
+    0x4, 0x3, 0x11, 0x80, 0x7e, 0xb0, 0xe, 0x31,
+    0x0, 0xff, 0xe1, 0x28, 0x7, 0x38, 0x3, 0x40,
+    0x3a, 0x80, 0x3f, 0xf8, 0x7a, 0x1, 0xca, 0x1,
+    0xfc, 0xa0, 0x1e, 0x70, 0xf, 0xfe, 0x17, 0x80,
+    0x75, 0x0, 0x1c, 0x3, 0x8c, 0x40, 0x3f, 0xf8,
+    0x4e, 0x1, 0xd6, 0x1, 0xfc, 0x46, 0x1, 0xd4,
+    0x1, 0xff, 0xc2, 0x50, 0xc, 0x26, 0x0, 0x14,
+    0x0, 0xe6, 0x0, 0xff, 0xe0, 0xa0, 0x80, 0x62,
+    0x30, 0xf, 0xf5, 0x80, 0x71, 0x88, 0x7, 0xfe,
+    0x50, 0xe, 0x70, 0xd, 0xa0, 0x1d, 0x60, 0x1f,
+    0xfc, 0x1d, 0x0, 0xe5, 0x0, 0xff, 0x94, 0x3,
+    0xce, 0x1, 0xff, 0xb8, 0x3, 0xa8, 0x3, 0x38,
+    0x7, 0x18, 0x80, 0x7f, 0xe7, 0x0, 0xeb, 0x0,
+    0xff, 0x88, 0xc0, 0x3a, 0x80, 0x3f, 0xf2, 0x0,
+    0x61, 0x30, 0xc, 0x28, 0x1, 0xcc, 0x1, 0xff,
+    0x20, 0x80, 0x62, 0x30, 0xf, 0xfd, 0x60, 0x1c,
+    0x62, 0x1, 0xfe, 0x60, 0xe, 0x60, 0xf, 0x70,
+    0x7, 0x58, 0x7, 0xfd, 0xa0, 0x1c, 0xa0, 0x1f,
+    0xfc, 0x15, 0x0, 0xf3, 0x80, 0x7f, 0xb4, 0x3,
+    0xac, 0x3, 0xca, 0x1, 0xc6, 0x20, 0x1f, 0xe7,
+    0x0, 0xeb, 0x0, 0xff, 0xe0, 0x91, 0x80, 0x76,
+    0x80, 0x7f, 0xa, 0x0, 0x62, 0x30, 0xf, 0x94,
+    0x3, 0x98, 0x3, 0xf9, 0x4, 0x3, 0x11, 0x80,
+    0x7f, 0xf0, 0xac, 0x3, 0x90, 0x40, 0x3f, 0x38,
+    0x7, 0x28, 0x7, 0xef, 0x0, 0xeb, 0x0, 0xfe,
+    0xe0, 0xe, 0x50, 0xf, 0xfe, 0x1a, 0x80, 0x79,
+    0xc0, 0x3f, 0x50, 0x7, 0x50, 0x7, 0xe5, 0x0,
+    0xe3, 0x20, 0xf, 0xca, 0x1, 0xd6, 0x1, 0xff,
+    0xc3, 0x23, 0x0, 0xed, 0x0, 0xf8, 0x4c, 0x3,
+    0x11, 0x0, 0x3f, 0x94, 0x3, 0x94, 0x3, 0xe4,
+    0x0, 0xe2, 0x30, 0xf, 0xfe, 0x25, 0x80, 0x72,
+    0x8, 0x7, 0x98, 0x3, 0x94, 0x3, 0xfd, 0xe0,
+    0x1d, 0x60, 0x1f, 0x70, 0x7, 0x28, 0x7, 0xff,
+    0x15, 0x40, 0x3c, 0xe0, 0x1e, 0xb0, 0xe, 0xa0,
+    0xf, 0xf2, 0x80, 0x71, 0x90, 0x7, 0x94, 0x3,
+    0xac, 0x3, 0xff, 0x8a, 0x46, 0x1, 0xda, 0x1,
+    0xc4, 0x60, 0x18, 0x88, 0x1, 0xff, 0x28, 0x7,
+    0x28, 0x7, 0x20, 0x7, 0x11, 0x80, 0x7f, 0xf1,
+    0xac, 0x3, 0x90, 0x40, 0x32, 0x80, 0x75, 0x0,
+    0x7f, 0xee, 0x0, 0xeb, 0x0, 0xee, 0x0, 0xe5,
+    0x0, 0xff, 0xe3, 0xa8, 0x7, 0x9c, 0x3, 0x50,
+    0x7, 0x28, 0x7, 0xfe, 0x41, 0x0, 0xc6, 0x40,
+    0x19, 0x40, 0x3a, 0xc0, 0x3f, 0xf8, 0xe4, 0x60,
+    0x1d, 0xa0, 0x11, 0x10, 0x3, 0x19, 0x0, 0x7f,
+    0xf0, 0x5c, 0x3, 0x94, 0x2, 0x50, 0xe, 0x23,
+    0x0, 0xff, 0xe4, 0x58, 0x7, 0x20, 0x80, 0x28,
+    0x3, 0xac, 0x3, 0xff, 0x85, 0xa0, 0x1d, 0x60,
+    0x17, 0x80, 0x72, 0x80, 0x7f, 0xf2, 0x54, 0x3,
+    0xce, 0x0, 0x50, 0xe, 0x50, 0xf, 0xfe, 0x12,
+    0x8, 0x6, 0x32, 0x0, 0x28, 0x7, 0x58, 0x7,
+    0xff, 0x24, 0x8c, 0x3, 0xb4, 0xc, 0x80, 0x31,
+    0x90, 0x7, 0xff, 0xd, 0xc0, 0x39, 0x41, 0x40,
+    0x38, 0x8c, 0x3, 0xff, 0x95, 0x60, 0x1c, 0x83,
+    0x60, 0x1d, 0x60, 0x1f, 0xfc, 0x4d, 0x0, 0xea,
+    0xf, 0x0, 0xe5, 0x0, 0xff, 0xe5, 0xa8, 0x7,
+    0x9d, 0x80, 0x39, 0x80, 0x3f, 0xf8, 0x88, 0x20,
+    0x18, 0x8d, 0x40, 0x3a, 0xc0, 0x3f, 0xf9, 0x64,
+    0x60, 0x1d, 0x2, 0x1, 0x8c, 0x40, 0x3f, 0xf8,
+    0xae, 0x1, 0xde, 0x1, 0xc4, 0x60, 0x1f, 0xfc,
+    0xcb, 0x0, 0xe1, 0x0, 0xea, 0x0, 0xff, 0xe3,
+    0x50, 0x7, 0x18, 0x7, 0x28, 0x7, 0xff, 0x35,
+    0x40, 0x3f, 0xe7, 0x0, 0xff, 0xe3, 0x18, 0x80,
+    0x7f, 0xac, 0x3, 0xff, 0x9a, 0x46, 0x1, 0xfc,
+    0x82, 0x1, 0xff, 0xc7, 0x60, 0xf, 0xe2, 0x30,
+    0xf, 0xfe, 0x75, 0x80, 0x7f, 0x68, 0x7, 0xff,
+    0x22, 0xc0, 0x3f, 0x94, 0x3, 0xff, 0x9e, 0xa0,
+    0x1f, 0xce, 0x1, 0xff, 0xc8, 0x31, 0x0, 0xfd,
+    0x60, 0x1f, 0xfc, 0xf2, 0x30, 0xf, 0x90, 0x40,
+    0x3f, 0xf9, 0x2c, 0x1, 0xf0, 0x98, 0x7, 0xff,
+    0x42, 0xc0, 0x3e, 0xd0, 0xf, 0xfe, 0x55, 0x80,
+    0x7c, 0xc0, 0x1f, 0xfd, 0x15, 0x0, 0xf9, 0xc0,
+    0x3f, 0xf9, 0x46, 0x40, 0x1e, 0xb0, 0xf, 0xfe,
+    0x18,
 
     /* U+0058 "X" */
-    0x0, 0xcf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfa, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xf6, 0x1, 0xef, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf2, 0xbf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa, 0xc,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xfe, 0x10, 0x1f, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x20, 0xc, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x0,
+    0x0, 0x67, 0xff, 0xa0, 0x3, 0xff, 0x96, 0x9f,
+    0xfe, 0xb0, 0xd, 0xa0, 0x1e, 0x74, 0x0, 0xff,
+    0xe4, 0x8d, 0x0, 0x70, 0xd0, 0x6, 0x1a, 0x0,
+    0xf5, 0x8, 0x7, 0xff, 0x22, 0xc4, 0x3, 0xa8,
+    0x40, 0x39, 0x58, 0x3, 0x86, 0x80, 0x3f, 0xf8,
+    0xec, 0xa0, 0x1c, 0xe8, 0x1, 0xf4, 0x90, 0x7,
+    0x23, 0x0, 0x7f, 0xf1, 0x4a, 0x40, 0x38, 0xe0,
+    0x3, 0xfb, 0x80, 0x3d, 0x24, 0x1, 0xff, 0xc4,
+    0xe0, 0xf, 0x70, 0x7, 0xf8, 0xe0, 0x3, 0xde,
+    0x1, 0xff, 0xc3, 0x83, 0x0, 0xea, 0x20, 0xf,
+    0xf9, 0xd0, 0x3, 0x8a, 0x40, 0x3f, 0xf8, 0x28,
+    0xe0, 0x1c, 0xaa, 0x0, 0xff, 0xe0, 0xd0, 0x80,
+    0x73, 0x28, 0x7, 0xfc, 0x34, 0x1, 0xc5, 0x40,
+    0x1f, 0xfc, 0x21, 0xa0, 0xf, 0x58, 0x80, 0x7f,
+    0xa8, 0x40, 0x3b, 0x80, 0x3f, 0xf8, 0x88, 0xc0,
+    0x1c, 0x3a, 0x1, 0xfc, 0xc8, 0x1, 0xd0, 0x60,
+    0x1f, 0xfc, 0x59, 0x20, 0xe, 0x37, 0x0, 0xf8,
+    0xa4, 0x3, 0x91, 0xc0, 0x3f, 0xf8, 0xfe, 0x1,
+    0xe8, 0x30, 0xf, 0x78, 0x7, 0xd, 0x0, 0x7f,
+    0xf2, 0xa, 0x40, 0x3d, 0xa2, 0x1, 0xa4, 0x80,
+    0x3a, 0x84, 0x3, 0xff, 0x92, 0xc8, 0x1, 0xc3,
+    0x60, 0x12, 0x30, 0x7, 0x3a, 0x0, 0x7f, 0xf2,
+    0xe8, 0x40, 0x39, 0x58, 0x6, 0x80, 0x38, 0xe0,
+    0x3, 0xff, 0x98, 0x34, 0x1, 0xe9, 0x2a, 0x10,
+    0xe, 0xe0, 0xf, 0xfe, 0x72, 0x38, 0x7, 0xb1,
+    0x0, 0x3a, 0x88, 0x3, 0xff, 0x9f, 0x6, 0x1,
+    0xc2, 0x1, 0xca, 0xa0, 0xf, 0xfe, 0x8f, 0x0,
+    0x7f, 0x8a, 0x80, 0x3f, 0xfa, 0x45, 0x40, 0x1f,
+    0xdc, 0x1, 0xff, 0xd4, 0x55, 0x0, 0x7c, 0xe6,
+    0x1, 0xff, 0xd5, 0x60, 0xf, 0x90, 0x3, 0xff,
+    0xaa, 0xe6, 0x1, 0xf1, 0xc8, 0x7, 0xff, 0x4c,
+    0xe0, 0x3, 0xf9, 0x90, 0x3, 0xff, 0xa2, 0x3a,
+    0x1, 0xff, 0x50, 0x80, 0x7f, 0xf4, 0x2c, 0x40,
+    0x38, 0xc0, 0x38, 0x68, 0x3, 0xff, 0x9e, 0xca,
+    0x1, 0xcb, 0x86, 0x1, 0xc8, 0xe0, 0x1f, 0xfc,
+    0xd2, 0x90, 0xe, 0x1b, 0xd, 0x0, 0xf4, 0x18,
+    0x7, 0xff, 0x33, 0xc0, 0x3d, 0x42, 0x3, 0x40,
+    0x1e, 0xd0, 0xf, 0xfe, 0x5c, 0x90, 0x7, 0x3a,
+    0x0, 0x4a, 0xc0, 0x1c, 0x34, 0x1, 0xff, 0xc9,
+    0x56, 0x0, 0xe3, 0x80, 0xe, 0x92, 0x0, 0xe5,
+    0x60, 0xf, 0xfe, 0x38, 0xd8, 0x7, 0xb8, 0x3,
+    0xee, 0x0, 0xf4, 0x90, 0x7, 0xff, 0x1b, 0x44,
+    0x3, 0xa4, 0x80, 0x3e, 0x38, 0x0, 0xf7, 0x80,
+    0x7f, 0xf1, 0x60, 0xc0, 0x39, 0x58, 0x3, 0xf9,
+    0xd0, 0x3, 0x8a, 0x40, 0x3f, 0xf8, 0x68, 0xe0,
+    0x1c, 0x36, 0x1, 0xff, 0x50, 0x80, 0x73, 0x28,
+    0x7, 0xff, 0x4, 0x68, 0x3, 0xd4, 0x20, 0x1f,
+    0xf0, 0xd0, 0x7, 0xac, 0x40, 0x3f, 0xf5, 0x8,
+    0x7, 0x3a, 0x0, 0x7f, 0xf0, 0x51, 0xc0, 0x38,
+    0x74, 0x3, 0xfe, 0x64, 0x0, 0xe3, 0x80, 0xf,
+    0xfe, 0x1c, 0x18, 0x7, 0x1b, 0x80, 0x7f, 0x1c,
+    0x80, 0x7b, 0x80, 0x3f, 0xf8, 0xbc, 0x1, 0xe8,
+    0x30, 0xf, 0xdc, 0x1, 0xe9, 0x20, 0xf, 0xfe,
+    0x29, 0x48, 0x7, 0xb4, 0x40, 0x3d, 0x24, 0x1,
+    0xca, 0xc0, 0x1f, 0xfc, 0x76, 0x50, 0xe, 0x1b,
+    0x0, 0xe5, 0x60, 0xe, 0x1b, 0x0, 0xff, 0xe4,
+    0xd1, 0x0, 0x72, 0xb0, 0x4, 0x54, 0x1, 0xea,
+    0x10, 0xf, 0xfe, 0x57, 0x0, 0x7a, 0x48, 0x1,
+    0xc0, 0x1e, 0x74, 0x0, 0xff, 0xe5, 0x9c, 0x0,
+    0x7b, 0xc0,
 
     /* U+0059 "Y" */
-    0xe, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x50, 0x5f, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xb0, 0x0, 0xbf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x8, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfe,
-    0x10, 0x2, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf9, 0x0, 0xbf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xce, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xed, 0x0, 0xff, 0xe7, 0x8f, 0x7f,
+    0xf2, 0x85, 0x80, 0x71, 0x38, 0x7, 0xff, 0x3a,
+    0x4, 0x3, 0x22, 0x82, 0xa0, 0x7, 0x41, 0x0,
+    0x7f, 0xf3, 0xd, 0x80, 0x3a, 0x40, 0x29, 0x0,
+    0xf4, 0x80, 0x7f, 0xf3, 0x3c, 0x3, 0x9c, 0x80,
+    0x22, 0x70, 0xe, 0x44, 0x0, 0x7f, 0xf2, 0x98,
+    0xc0, 0x30, 0xc0, 0x7, 0x40, 0x80, 0x75, 0x0,
+    0x7f, 0xf2, 0x46, 0x0, 0x3a, 0xc0, 0x3e, 0xa0,
+    0xe, 0x18, 0x0, 0xff, 0xe4, 0x40, 0x80, 0x64,
+    0x50, 0xf, 0x91, 0x0, 0x1c, 0xe4, 0x1, 0xff,
+    0xc6, 0x36, 0x0, 0xe9, 0x0, 0xfe, 0x90, 0xf,
+    0x48, 0x7, 0xff, 0x1b, 0x80, 0x39, 0xc8, 0x3,
+    0xf8, 0xa0, 0x3, 0x91, 0x40, 0x3f, 0xf8, 0x8e,
+    0x40, 0x18, 0x60, 0x3, 0xfe, 0x72, 0x0, 0xeb,
+    0x0, 0xff, 0xe1, 0x8c, 0x0, 0x75, 0x80, 0x7f,
+    0xf0, 0x64, 0x3, 0x86, 0x0, 0x3f, 0xf8, 0x56,
+    0x1, 0xc8, 0xa0, 0x1f, 0xfc, 0x14, 0x50, 0xe,
+    0x72, 0x0, 0xff, 0xc8, 0xa0, 0x1d, 0x20, 0x1f,
+    0xfc, 0x3b, 0x0, 0xf4, 0x80, 0x7f, 0xe9, 0x0,
+    0xe7, 0x20, 0xf, 0xfe, 0x18, 0xc0, 0x7, 0x22,
+    0x80, 0x7f, 0x9c, 0x80, 0x31, 0x40, 0x7, 0xff,
+    0x15, 0xc8, 0x3, 0xac, 0x3, 0xf8, 0xa0, 0x3,
+    0xa4, 0x3, 0xff, 0x8f, 0xc0, 0x1c, 0x30, 0x1,
+    0xfa, 0x40, 0x39, 0x10, 0x1, 0xff, 0xc7, 0x35,
+    0x0, 0xe7, 0x20, 0xf, 0x22, 0x0, 0x3a, 0x80,
+    0x3f, 0xf9, 0x36, 0x1, 0xee, 0x0, 0xf4, 0x80,
+    0x74, 0x8, 0x7, 0xff, 0x24, 0x64, 0x3, 0x8d,
+    0x40, 0x34, 0x10, 0x6, 0x27, 0x0, 0xff, 0xe5,
+    0xb1, 0x80, 0x75, 0x88, 0x0, 0x9c, 0x3, 0xa4,
+    0x3, 0xff, 0x9b, 0xe0, 0x1c, 0x30, 0x0, 0x90,
+    0xe, 0x54, 0x0, 0xff, 0xe6, 0x9b, 0x0, 0x73,
+    0x1a, 0xa0, 0x7, 0x58, 0x7, 0xff, 0x3e, 0x4,
+    0x3, 0xbe, 0xc0, 0x3a, 0x4, 0x3, 0xff, 0x9e,
+    0x30, 0x1, 0xc6, 0x20, 0x18, 0x9c, 0x3, 0xff,
+    0xa2, 0xc6, 0x1, 0xfe, 0x90, 0xf, 0xfe, 0x9f,
+    0x80, 0x7f, 0x2a, 0x0, 0x7f, 0xf4, 0xcd, 0x80,
+    0x3f, 0x58, 0x7, 0xff, 0x56, 0x44, 0x3, 0xd0,
+    0x20, 0x1f, 0xfd, 0x69, 0x0, 0xe1, 0x70, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0x90,
 
     /* U+005A "Z" */
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8a,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xc8, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x81, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
+    0xc, 0xff, 0xff, 0xeb, 0xa8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xcc, 0x0, 0xa7, 0x7f,
+    0xfe, 0x72, 0x80, 0x7d, 0x26, 0x0, 0x68, 0x8f,
+    0xfe, 0x73, 0x80, 0x79, 0x58, 0x3, 0xff, 0xa3,
+    0x44, 0x1, 0xc7, 0x40, 0x1f, 0xfd, 0x17, 0x50,
+    0xe, 0x1d, 0x0, 0xff, 0xe8, 0xa4, 0x0, 0x7a,
+    0x84, 0x3, 0xff, 0xa0, 0x54, 0x1, 0xe9, 0x40,
+    0xf, 0xfe, 0x8f, 0x88, 0x7, 0x2b, 0x0, 0x7f,
+    0xf4, 0x68, 0x80, 0x38, 0xe8, 0x3, 0xff, 0xa2,
+    0xea, 0x1, 0xc3, 0xa0, 0x1f, 0xfd, 0x14, 0x80,
+    0xf, 0x50, 0x80, 0x7f, 0xf4, 0xa, 0x80, 0x3d,
+    0x8, 0x1, 0xff, 0xd1, 0xf1, 0x0, 0xe5, 0x70,
+    0xf, 0xfe, 0x8d, 0x10, 0x7, 0x15, 0x0, 0x7f,
+    0xf4, 0x5d, 0x40, 0x38, 0x7c, 0x3, 0xff, 0xa2,
+    0x90, 0x1, 0xea, 0x20, 0xf, 0xfe, 0x81, 0x58,
+    0x7, 0xa1, 0x0, 0x3f, 0xfa, 0x3e, 0x1, 0xe5,
+    0x70, 0xf, 0xfe, 0x8d, 0x10, 0x7, 0x15, 0x0,
+    0x7f, 0xf4, 0x5d, 0x40, 0x38, 0x7c, 0x3, 0xff,
+    0xa2, 0x90, 0x1, 0xea, 0x20, 0xf, 0xfe, 0x81,
+    0x58, 0x7, 0xa1, 0x0, 0x3f, 0xfa, 0x3e, 0x1,
+    0xe5, 0x70, 0xf, 0xfe, 0x8d, 0x90, 0x7, 0x15,
+    0x0, 0x7f, 0xf4, 0x5d, 0x0, 0x38, 0x7c, 0x3,
+    0xff, 0xa2, 0x90, 0x1, 0xea, 0x20, 0xf, 0xfe,
+    0x81, 0x58, 0x7, 0xa1, 0x0, 0x3f, 0xfa, 0x3e,
+    0x1, 0xe5, 0x70, 0xf, 0xfe, 0x8d, 0x90, 0x7,
+    0x15, 0x0, 0x7f, 0xf4, 0x61, 0x0, 0x3d, 0xe0,
+    0x1f, 0xfd, 0x14, 0x70, 0xf, 0x59, 0x0, 0x7f,
+    0xf4, 0xa, 0xc0, 0x3d, 0x8, 0x1, 0xff, 0xd1,
+    0xf0, 0xf, 0x23, 0x80, 0x7f, 0xf4, 0x6c, 0x80,
+    0x38, 0xac, 0x3, 0xff, 0xa3, 0x8, 0x1, 0xef,
+    0x0, 0xff, 0xe8, 0xab, 0x80, 0x78, 0xea, 0x23,
+    0xff, 0x9e, 0x22, 0xa0, 0xf, 0x8d, 0xdf, 0xff,
+    0xa0, 0x4a, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x70,
 
     /* U+005B "[" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
+    0x0, 0xff, 0xe1, 0xa7, 0xff, 0xff, 0x4, 0x40,
+    0x3f, 0xfe, 0xc5, 0xff, 0xf0, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfc, 0xe5, 0xff, 0xf0, 0x80,
+    0x7f, 0xfc, 0x0,
 
     /* U+005C "\\" */
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf1,
+    0x4f, 0xfe, 0x50, 0xf, 0xfe, 0x4a, 0x8, 0x6,
+    0xf0, 0xf, 0xfe, 0x53, 0x0, 0x65, 0x0, 0xff,
+    0xe5, 0x58, 0x7, 0x28, 0x7, 0xff, 0x24, 0xc8,
+    0x3, 0x70, 0x7, 0xff, 0x29, 0x40, 0x32, 0x8,
+    0x7, 0xff, 0x26, 0x80, 0x39, 0xc0, 0x3f, 0xf9,
+    0x24, 0x60, 0x1a, 0x80, 0x3f, 0xf9, 0x56, 0x1,
+    0x8c, 0x80, 0x3f, 0xf9, 0x2c, 0x1, 0xca, 0x1,
+    0xff, 0xc9, 0x14, 0x0, 0xd4, 0x1, 0xff, 0xca,
+    0xd0, 0xc, 0x44, 0x0, 0xff, 0xe4, 0xb8, 0x7,
+    0x50, 0x7, 0xff, 0x24, 0x50, 0x3, 0x30, 0x7,
+    0xff, 0x2b, 0x80, 0x30, 0x98, 0x7, 0xff, 0x25,
+    0x40, 0x3a, 0x80, 0x3f, 0xf9, 0x4a, 0x1, 0x9c,
+    0x3, 0xff, 0x95, 0xc0, 0x18, 0x50, 0x3, 0xff,
+    0x92, 0x82, 0x1, 0xb8, 0x3, 0xff, 0x94, 0xe0,
+    0x19, 0x40, 0x3f, 0xf9, 0x54, 0x1, 0xca, 0x1,
+    0xff, 0xc9, 0x32, 0x0, 0xdc, 0x1, 0xff, 0xca,
+    0x50, 0xc, 0x82, 0x1, 0xff, 0xc9, 0xa0, 0xe,
+    0x70, 0xf, 0xfe, 0x49, 0x10, 0x3, 0x50, 0x7,
+    0xff, 0x2a, 0x80, 0x31, 0x88, 0x7, 0xff, 0x25,
+    0x80, 0x39, 0x80, 0x3f, 0xf9, 0x22, 0x60, 0x1a,
+    0x80, 0x3f, 0xf9, 0x54, 0x1, 0x88, 0x80, 0x1f,
+    0xfc, 0x97, 0x0, 0xea, 0x0, 0xff, 0xe4, 0x8a,
+    0x0, 0x65, 0x0, 0xff, 0xe5, 0x70, 0x6, 0x23,
+    0x0, 0xff, 0xe4, 0xa8, 0x7, 0x50, 0x7, 0xff,
+    0x29, 0x40, 0x33, 0x80, 0x7f, 0xf2, 0xb8, 0x3,
+    0xa, 0x0, 0x7f, 0xf2, 0x50, 0x40, 0x37, 0x0,
+    0x7f, 0xf2, 0x9c, 0x3, 0x28, 0x7, 0xff, 0x2a,
+    0x80, 0x39, 0x40, 0x3f, 0xf9, 0x26, 0x20, 0x1b,
+    0xc0, 0x3f, 0xf9, 0x4c, 0x1, 0x94, 0x40, 0x3f,
+    0xf9, 0x34, 0x1, 0xce, 0x1, 0xff, 0xc9, 0x22,
+    0x0, 0x6d, 0x0, 0xff, 0xe5, 0x50, 0x6, 0x41,
+    0x0, 0xff, 0xe4, 0xa8, 0x7, 0x30, 0x7, 0xff,
+    0x24, 0x8c, 0x3, 0x58, 0x7, 0xff, 0x2a, 0x80,
+    0x31, 0x90, 0x7, 0xff, 0x25, 0xc0, 0x3a, 0x80,
+    0x3f, 0xf9, 0x22, 0x80, 0x19, 0x40, 0x3f, 0xf9,
+    0x5c, 0x1, 0x88, 0xc0, 0x3f, 0xf9, 0x2a, 0x1,
+    0xd6, 0x1, 0xff, 0xca, 0x50, 0xc, 0xc0, 0x1f,
+    0xfc, 0xae, 0x0, 0xc2, 0x80, 0x1f, 0xfc, 0x94,
+    0x10, 0xd, 0xa0, 0x1f, 0xfc, 0xa7, 0x0, 0xce,
+    0x1, 0xff, 0xca, 0xd0, 0xc, 0x2a, 0x1, 0xff,
+    0xc9, 0x41, 0x0, 0xde, 0x1, 0xff, 0xca, 0x60,
+    0xc, 0xa0, 0x1f, 0xfc, 0xab, 0x0, 0xe5, 0x0,
+    0xff, 0xe4, 0x99, 0x0, 0x6e, 0x0, 0xff, 0xe5,
+    0x50, 0x6, 0x41,
 
     /* U+005D "]" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf9, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9,
+    0x0, 0xff, 0xe1, 0x67, 0xff, 0xfe, 0x90, 0xf,
+    0xff, 0x66, 0x7f, 0xf9, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x16, 0x7f, 0xf9, 0xc0, 0x3f, 0xfe, 0x40,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x88,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfe,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x4e, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xd0, 0x8f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xf7, 0x1, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x10, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0x90,
-    0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0, 0x0,
-    0xdf, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x6, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf2, 0x0, 0x0,
-    0x4f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0xb, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x10, 0x2, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xf7, 0x0, 0x9f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xd0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x40,
+    0x0, 0xff, 0xcf, 0x11, 0x88, 0x3, 0xff, 0x94,
+    0x90, 0xef, 0xa0, 0x3, 0xff, 0x95, 0xe0, 0x1c,
+    0xa2, 0x1, 0xff, 0xc8, 0x24, 0x0, 0xf4, 0x80,
+    0x7f, 0xf2, 0x2c, 0x3, 0xe6, 0x0, 0xff, 0xe4,
+    0x30, 0x4, 0x20, 0x10, 0xa8, 0x7, 0xff, 0x19,
+    0xc0, 0x35, 0x8, 0x5, 0x20, 0x1f, 0xfc, 0x6a,
+    0x0, 0x89, 0x18, 0x2, 0x33, 0x0, 0x7f, 0xf1,
+    0x10, 0x80, 0x2a, 0x9, 0x0, 0xd2, 0x1, 0xff,
+    0xc4, 0xf0, 0xc, 0xc0, 0x2a, 0x1, 0x28, 0x80,
+    0x7f, 0xf0, 0x89, 0x0, 0x26, 0x10, 0x7, 0x0,
+    0x66, 0x0, 0xff, 0xe1, 0x58, 0x6, 0xa0, 0x9,
+    0x8, 0x2, 0x90, 0xf, 0xfe, 0x13, 0x0, 0x46,
+    0x60, 0xd, 0x60, 0x10, 0xa8, 0x7, 0xfe, 0x60,
+    0xd, 0x20, 0x1c, 0xc0, 0x1a, 0x40, 0x3f, 0xf5,
+    0x80, 0x42, 0xa0, 0x1e, 0x60, 0x8, 0xcc, 0x1,
+    0xfe, 0x42, 0x0, 0x98, 0x3, 0xeb, 0x0, 0xd2,
+    0x1, 0xfe, 0xf0, 0xd, 0x20, 0x1f, 0x11, 0x80,
+    0x4a, 0x20, 0x1f, 0x89, 0x0, 0x24, 0x10, 0xf,
+    0xd2, 0x1, 0x98, 0x3, 0xf5, 0x80, 0x6f, 0x0,
+    0xfe, 0x51, 0x0, 0xa4, 0x3, 0xf3, 0x0, 0x44,
+    0x80, 0x1f, 0xe6, 0x0, 0x85, 0x40, 0x3c, 0xc0,
+    0x1a, 0x80, 0x3f, 0xea, 0x0, 0xd2, 0x1, 0xeb,
+    0x0, 0xcc, 0x1, 0xff, 0x12, 0x0, 0x46, 0x40,
+    0x19, 0x8, 0x2, 0x61, 0x0, 0xff, 0xde, 0x1,
+    0xac, 0x3, 0x78, 0x6, 0xa0, 0xf, 0xfe, 0xa,
+    0x10, 0x4, 0xc2, 0x0, 0x24, 0x0, 0x8c, 0xc0,
+    0x1f, 0xfc, 0x2a, 0x0, 0xcc, 0x0, 0xb0, 0xd,
+    0x20, 0x1f, 0xfc, 0x36, 0x0, 0xd4, 0x0, 0x60,
+    0x8, 0x54, 0x3, 0xff, 0x86, 0x2a, 0x1, 0x12,
+    0x0,
 
     /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xea, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xf9, 0x20,
 
     /* U+0060 "`" */
-    0x17, 0x88, 0x88, 0x88, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x70,
+    0x17, 0x88, 0xf2, 0x0, 0x7e, 0x13, 0x77, 0xf5,
+    0xa8, 0x7, 0xe4, 0xd2, 0x0, 0xea, 0x50, 0xf,
+    0xc5, 0xaa, 0x1, 0xd4, 0xc0, 0x1f, 0xd5, 0x0,
+    0x1d, 0x2c, 0x1, 0xfc, 0xf6, 0x20, 0x1a, 0x58,
+    0x3, 0xf9, 0x30, 0xc0, 0x34, 0xb8, 0x7, 0xf1,
+    0x62, 0x80, 0x68, 0x70, 0xf, 0xf5, 0x48, 0x6,
+    0x87,
 
     /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x0, 0x26, 0x9c, 0xdf, 0xff,
-    0xed, 0xc8, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xb8, 0x65, 0x45, 0x69, 0xdf, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x8f, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0xe, 0xf8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x4, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x3, 0x7a, 0xce,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x8, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xc9, 0x76, 0x66, 0x66, 0x66,
-    0x66, 0x6a, 0xff, 0xff, 0xfb, 0xb, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfb, 0xaf, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfb, 0xcf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb,
-    0xbf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb, 0xaf,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xfb, 0x7f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xfb, 0xa, 0xff, 0xff, 0xff,
-    0xf7, 0x20, 0x0, 0x0, 0x4, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xfe, 0xcb, 0xbd, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0xfb, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff,
-    0xfb, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x2, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x30, 0x2, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x4, 0x8b, 0xde, 0xff, 0xec, 0xa6,
-    0x20, 0x0, 0x2, 0xff, 0xff, 0xfb,
+    0x0, 0xfc, 0x4d, 0x39, 0xbf, 0xf7, 0x6e, 0x42,
+    0x88, 0x7, 0xff, 0x4, 0xe7, 0xb6, 0x58, 0xc8,
+    0x2, 0x12, 0x37, 0xae, 0xa3, 0x0, 0xfe, 0x3b,
+    0xc6, 0x10, 0xf, 0xfe, 0x12, 0xe4, 0x80, 0x7d,
+    0x58, 0x80, 0x1f, 0xfc, 0x76, 0xd1, 0x0, 0xd4,
+    0xa0, 0x1f, 0xfc, 0xa2, 0xd0, 0xd, 0x0, 0x1f,
+    0x91, 0xe6, 0xae, 0xa5, 0x88, 0x3, 0xe3, 0xa0,
+    0x8, 0x9c, 0x3, 0x2e, 0x7d, 0xc3, 0x2a, 0x2b,
+    0x4e, 0xe2, 0x0, 0x79, 0x48, 0x2, 0x81, 0x7,
+    0xea, 0x30, 0xf, 0xf1, 0xdb, 0x80, 0x7a, 0x0,
+    0x35, 0x6c, 0x8, 0x7, 0xff, 0xa, 0x14, 0x3,
+    0x94, 0x3, 0x21, 0x0, 0x7f, 0xf1, 0x6c, 0x3,
+    0xc6, 0x1, 0xff, 0xca, 0x13, 0x0, 0xe4, 0x0,
+    0xff, 0xe5, 0xa0, 0x7, 0x78, 0x7, 0xff, 0x2f,
+    0xc0, 0x38, 0x40, 0x3f, 0xfa, 0x26, 0x1, 0xf1,
+    0xbd, 0x67, 0x73, 0xff, 0xfd, 0x0, 0x1c, 0x20,
+    0x1d, 0x1d, 0x90, 0xa6, 0x22, 0x0, 0xff, 0xe4,
+    0x27, 0x38, 0x80, 0x7f, 0xf3, 0x52, 0xc4, 0x3,
+    0xff, 0x9c, 0x56, 0x1, 0xf1, 0xb4, 0x4c, 0xff,
+    0x94, 0x3, 0xe9, 0x0, 0xf3, 0x76, 0x4b, 0xb3,
+    0x7f, 0xb4, 0x3, 0xc4, 0x80, 0x1d, 0x32, 0x10,
+    0xf, 0xfe, 0x42, 0x80, 0x71, 0xb0, 0x7, 0xff,
+    0x2b, 0x40, 0x3a, 0x80, 0x3f, 0xf9, 0x6c, 0x1,
+    0xc4, 0x1, 0xff, 0xc4, 0xe0, 0xf, 0x38, 0x7,
+    0x8, 0x7, 0xff, 0xc, 0x58, 0x3, 0xc2, 0x1,
+    0xd8, 0x1, 0xff, 0xc3, 0xa0, 0xf, 0xb4, 0x3,
+    0x98, 0x40, 0x3f, 0xf8, 0x34, 0x80, 0x1f, 0x28,
+    0x7, 0xb0, 0x40, 0x3f, 0xc5, 0x8a, 0x1, 0xf8,
+    0x94, 0x3, 0x8b, 0x9c, 0x80, 0x3c, 0x93, 0xa6,
+    0x1, 0xfe, 0xb1, 0x0, 0xf4, 0x6f, 0x65, 0xdb,
+    0x7e, 0xd8, 0x3, 0x20, 0x7, 0xc3, 0xa2, 0x1,
+    0xf0, 0x9a, 0x20, 0x80, 0x3c, 0x92, 0x1, 0xf8,
+    0xf0, 0xc0, 0x3f, 0xf8, 0x8d, 0x60, 0x1f, 0xe2,
+    0xc9, 0x20, 0xf, 0xfc, 0x99, 0x20, 0x1f, 0xfc,
+    0x16, 0xdb, 0x74, 0x21, 0x0, 0x9, 0xac, 0xed,
+    0x98, 0x7, 0xf0,
 
     /* U+0062 "b" */
-    0x2, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2, 0x7a, 0xde, 0xff, 0xec, 0xa7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x76, 0x56,
-    0x8b, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfe, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x60,
-    0x2f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xd0, 0x2f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x2f, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfe, 0x2f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfe,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xd0, 0x2f, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfe, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc4, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x2f, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xea, 0x75, 0x56, 0x8b, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xb0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0,
-    0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x2, 0x7a, 0xdf, 0xff,
-    0xed, 0xa7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x2f, 0x0, 0x7f, 0xf4, 0x4b, 0x77, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xf3, 0x9, 0xeb, 0x7b,
+    0xfd, 0xd9, 0x4e, 0x40, 0x1f, 0xfc, 0xa5, 0xcd,
+    0x85, 0x21, 0x0, 0x9, 0xac, 0x6e, 0x98, 0x3,
+    0xff, 0x8c, 0x59, 0x46, 0x1, 0xff, 0x8a, 0x79,
+    0x0, 0x3f, 0xf8, 0x69, 0xa6, 0x1, 0xff, 0xc4,
+    0x1b, 0xa0, 0xf, 0xfe, 0xa, 0x58, 0x7, 0xff,
+    0x21, 0x70, 0x40, 0x3f, 0xeb, 0x0, 0xf0, 0xac,
+    0x4d, 0x4b, 0xa0, 0x7, 0xe3, 0xd0, 0xf, 0xfe,
+    0x21, 0xdf, 0x53, 0xb2, 0xb4, 0x5f, 0x40, 0x80,
+    0x78, 0xe8, 0x3, 0xff, 0x85, 0x38, 0x80, 0x1f,
+    0x85, 0xfd, 0x40, 0x3c, 0xaa, 0x0, 0xff, 0xd8,
+    0xc0, 0x1f, 0xf8, 0x69, 0x80, 0x3d, 0x60, 0x1f,
+    0xf5, 0x98, 0x7, 0xff, 0xe, 0x54, 0x3, 0x85,
+    0x80, 0x3f, 0x99, 0x0, 0x3f, 0xf8, 0xb6, 0x20,
+    0x1d, 0x60, 0x1f, 0xd0, 0x1, 0xff, 0xc6, 0x19,
+    0x0, 0xe2, 0x20, 0x7, 0xca, 0x20, 0x1f, 0xfc,
+    0x77, 0x0, 0xf2, 0x80, 0x7d, 0xe0, 0x1f, 0xfc,
+    0x94, 0x0, 0xed, 0x0, 0xf9, 0xc0, 0x3f, 0xf9,
+    0x38, 0x1, 0xcc, 0x1, 0xf1, 0x0, 0x7f, 0xf2,
+    0x48, 0x3, 0x84, 0x3, 0xc2, 0x1, 0xff, 0xca,
+    0x10, 0xe, 0x30, 0xf, 0xfe, 0xf0, 0x80, 0x7f,
+    0xf2, 0x84, 0x3, 0x8c, 0x3, 0xe2, 0x0, 0xff,
+    0xe4, 0xe8, 0x7, 0x8, 0x7, 0xce, 0x1, 0xff,
+    0xc9, 0x30, 0xe, 0x50, 0xf, 0xbc, 0x3, 0xff,
+    0x90, 0x28, 0x1, 0xde, 0x1, 0xf2, 0x88, 0x7,
+    0xff, 0x1d, 0x80, 0x3c, 0x80, 0x1f, 0xac, 0x3,
+    0xff, 0x8c, 0x32, 0x1, 0xc4, 0x40, 0xf, 0xca,
+    0xa0, 0xf, 0xfe, 0x2d, 0x8, 0x7, 0x58, 0x7,
+    0xfa, 0x90, 0x3, 0xff, 0x87, 0x28, 0x1, 0xc2,
+    0xc0, 0x1f, 0xf5, 0xb0, 0x7, 0xfe, 0x1b, 0x60,
+    0xf, 0x58, 0x7, 0xff, 0x6, 0x71, 0x0, 0x3f,
+    0xb, 0xfa, 0x0, 0x79, 0x54, 0x1, 0xf8, 0x80,
+    0x38, 0xef, 0xa9, 0xd5, 0x4d, 0x17, 0xd0, 0x20,
+    0x1e, 0x3a, 0x0, 0xfe, 0x6b, 0x0, 0xf0, 0xac,
+    0x55, 0x25, 0xd0, 0x3, 0xf1, 0xe8, 0x7, 0xfc,
+    0x96, 0x1, 0xff, 0xc8, 0x5c, 0x10, 0xf, 0xfc,
+    0x9a, 0x60, 0x1f, 0xfc, 0x41, 0xaa, 0x0, 0x7f,
+    0xf0, 0xcb, 0x28, 0xc0, 0x3f, 0xf1, 0x4f, 0x28,
+    0x7, 0xff, 0x19, 0x73, 0x61, 0x48, 0x2, 0x12,
+    0x58, 0xdd, 0x30, 0x7, 0xf0,
 
     /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x9c,
-    0xef, 0xff, 0xec, 0x96, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xa7, 0x65, 0x67, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xb1, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfe, 0x50, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa9, 0x10, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xa1, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe6, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xfc, 0x20, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x76, 0x56,
-    0x7b, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69,
-    0xce, 0xff, 0xfe, 0xc9, 0x61, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0xff, 0xc2, 0xd3, 0x9d, 0xff, 0x76, 0x4b,
+    0x8, 0x7, 0xff, 0x19, 0x73, 0xa5, 0x8c, 0x40,
+    0x21, 0x36, 0x9e, 0xb4, 0x0, 0xff, 0xe1, 0x26,
+    0xd1, 0x80, 0x7f, 0xf0, 0x52, 0xf0, 0x80, 0x3f,
+    0xea, 0xb2, 0x0, 0xff, 0xe2, 0x9e, 0xa8, 0x7,
+    0xe1, 0xd5, 0x0, 0xff, 0xe4, 0xd3, 0x0, 0x78,
+    0x70, 0x80, 0x3f, 0x2c, 0x4d, 0x4c, 0x20, 0x7,
+    0xe9, 0x40, 0xe, 0xd2, 0x0, 0xf1, 0xd7, 0xd3,
+    0xb2, 0xb3, 0xdf, 0xc8, 0x80, 0x7a, 0x84, 0x2,
+    0x83, 0x0, 0xf4, 0x62, 0x80, 0x7f, 0x37, 0x28,
+    0x7, 0x28, 0x4, 0x4e, 0x1, 0xeb, 0x70, 0xf,
+    0xfe, 0xd, 0x38, 0x0, 0x6a, 0xc4, 0x1, 0x0,
+    0x1e, 0xa4, 0x0, 0xff, 0xe1, 0xc2, 0xb7, 0xa8,
+    0x4, 0x4a, 0x1, 0xca, 0xa0, 0xf, 0xfe, 0x2d,
+    0x48, 0x80, 0x65, 0x0, 0xf5, 0x80, 0x7f, 0xf3,
+    0x6c, 0x3, 0x94, 0x40, 0x3f, 0xf9, 0xa6, 0x1,
+    0xde, 0x1, 0xff, 0xcd, 0x20, 0xf, 0x38, 0x7,
+    0xff, 0x34, 0x40, 0x3c, 0x40, 0x1f, 0xfc, 0xd7,
+    0x0, 0xe1, 0x0, 0xff, 0xf7, 0xb8, 0x7, 0x8,
+    0x7, 0xff, 0x38, 0x40, 0x3c, 0x40, 0x1f, 0xfc,
+    0xd2, 0x0, 0xf3, 0x80, 0x7f, 0xf3, 0x8c, 0x3,
+    0xbc, 0x3, 0xff, 0x9d, 0x60, 0x1c, 0xa2, 0x1,
+    0xff, 0xcd, 0x60, 0xf, 0x58, 0x7, 0xff, 0x34,
+    0x54, 0x3, 0x95, 0x40, 0x1f, 0xfc, 0x5a, 0xa0,
+    0x80, 0x74, 0x0, 0x7a, 0x90, 0x3, 0xff, 0x87,
+    0xa, 0xaf, 0x60, 0xc, 0x50, 0x1, 0xeb, 0x70,
+    0xf, 0xfe, 0xd, 0x38, 0x0, 0x67, 0x8, 0x2,
+    0x73, 0x0, 0xf4, 0x62, 0x80, 0x7f, 0x37, 0x28,
+    0x7, 0x11, 0x80, 0x6d, 0x20, 0xf, 0x1d, 0x7d,
+    0x3b, 0x2b, 0x3d, 0xfc, 0x88, 0x7, 0xa8, 0x40,
+    0x30, 0xe1, 0x80, 0x7e, 0x58, 0x9a, 0x98, 0x40,
+    0xf, 0xd2, 0x80, 0x1e, 0x1c, 0x50, 0xf, 0xfe,
+    0x4d, 0x30, 0x7, 0xf5, 0x59, 0x0, 0x7f, 0xf1,
+    0x53, 0x54, 0x3, 0xfe, 0x4d, 0xa3, 0x0, 0xff,
+    0xe0, 0xa5, 0xd8, 0x80, 0x3f, 0xf8, 0x4b, 0x9d,
+    0x2c, 0x62, 0x1, 0x9, 0xb4, 0xf5, 0xa0, 0x7,
+    0x80,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
-    0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0xbd, 0xef, 0xfe, 0xc9, 0x50,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa2, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x15, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd6, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xea, 0x76, 0x56,
-    0x8b, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfd,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xcf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfd,
-    0x3, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xfd, 0x8, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfd, 0xc, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xfd, 0xf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfd,
-    0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfd, 0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x4f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x4f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x3f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xfd, 0xc, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfd,
-    0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xfd, 0x2, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xfd, 0x0, 0xcf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xea, 0x76, 0x56, 0x8b, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x11, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0xbd, 0xef, 0xfe,
-    0xc9, 0x51, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
+    0x0, 0xff, 0xe9, 0x11, 0x78, 0x3, 0xff, 0xa2,
+    0xbb, 0xbd, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xfc, 0xa4, 0x5e, 0xf7,
+    0xfb, 0xb2, 0x54, 0x3, 0xff, 0x94, 0x31, 0xd6,
+    0xe8, 0x42, 0x0, 0x13, 0x6a, 0xfa, 0x20, 0xf,
+    0xfe, 0x34, 0x73, 0x88, 0x7, 0xfe, 0x5d, 0x80,
+    0xf, 0xfe, 0x19, 0x6b, 0x80, 0x7f, 0xf1, 0x5f,
+    0x4, 0x3, 0xff, 0x26, 0x90, 0x7, 0xff, 0x1c,
+    0xf0, 0xc0, 0x3f, 0xc7, 0x60, 0x1f, 0x85, 0x62,
+    0x6a, 0x5d, 0x0, 0x3c, 0x50, 0x1, 0xfc, 0x3a,
+    0x1, 0xf1, 0xdf, 0x53, 0xb2, 0xb4, 0x5f, 0xc0,
+    0x80, 0x61, 0x0, 0xfe, 0xa1, 0x0, 0xf4, 0xe2,
+    0x0, 0x7f, 0x3f, 0xa8, 0x7, 0xfe, 0x44, 0x0,
+    0x7a, 0xd8, 0x3, 0xff, 0xd, 0x38, 0x7, 0xfd,
+    0x0, 0x1e, 0xa4, 0x0, 0xff, 0xe1, 0xc2, 0x80,
+    0x7f, 0x19, 0x80, 0x39, 0x54, 0x1, 0xff, 0xc5,
+    0xb1, 0x0, 0xfd, 0x60, 0x1e, 0xb0, 0xf, 0xfe,
+    0x30, 0xc8, 0x7, 0xe4, 0x0, 0xe5, 0x10, 0xf,
+    0xfe, 0x3b, 0x80, 0x7e, 0x30, 0xe, 0xf0, 0xf,
+    0xfe, 0x4a, 0x0, 0x78, 0x80, 0x3c, 0xe0, 0x1f,
+    0xfc, 0x9c, 0x0, 0xf0, 0x80, 0x78, 0x80, 0x3f,
+    0xf9, 0x24, 0x1, 0xe7, 0x0, 0xe1, 0x0, 0xff,
+    0xe5, 0x8, 0x7, 0xff, 0x79, 0xc0, 0x38, 0x40,
+    0x3f, 0xf9, 0x42, 0x1, 0xe1, 0x0, 0xf1, 0x0,
+    0x7f, 0xf2, 0x48, 0x3, 0xc4, 0x1, 0xe7, 0x0,
+    0xff, 0xe4, 0xe0, 0x7, 0xc6, 0x1, 0xde, 0x1,
+    0xff, 0xc9, 0x40, 0xf, 0x90, 0x3, 0x94, 0x80,
+    0x3f, 0xf8, 0xee, 0x1, 0xfa, 0x80, 0x3d, 0x0,
+    0x1f, 0xfc, 0x61, 0x90, 0xf, 0xc4, 0x60, 0x1c,
+    0xaa, 0x0, 0xff, 0xe2, 0xd0, 0x80, 0x7f, 0x40,
+    0x7, 0xa9, 0x0, 0x3f, 0xf8, 0x72, 0x80, 0x1f,
+    0xe4, 0x50, 0xf, 0x5b, 0x80, 0x7f, 0xe1, 0xb6,
+    0x0, 0xff, 0xd6, 0x20, 0x1e, 0x8c, 0x50, 0xf,
+    0xc2, 0xfe, 0x80, 0x1f, 0xfc, 0x11, 0xd0, 0xf,
+    0x8e, 0xba, 0x9d, 0x95, 0xa2, 0xfa, 0x4, 0x3,
+    0x18, 0x7, 0xf8, 0xec, 0x3, 0xf0, 0xac, 0x4d,
+    0x4b, 0xa0, 0x7, 0x8b, 0x80, 0x3f, 0xe4, 0xd2,
+    0x0, 0xff, 0xe3, 0x9e, 0x18, 0x7, 0xfe, 0x2d,
+    0x70, 0xf, 0xfe, 0x2b, 0xe0, 0x80, 0x7f, 0xf0,
+    0xe3, 0x98, 0x40, 0x3f, 0xf2, 0xec, 0x0, 0x7f,
+    0xf1, 0x86, 0x7a, 0xdd, 0x8, 0x40, 0x2, 0x6d,
+    0x5d, 0x44, 0x1, 0xfe,
 
     /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbd,
-    0xef, 0xfe, 0xc9, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x53,
-    0x23, 0x47, 0xbf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x70, 0x0, 0xb, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfe, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf5,
-    0x0, 0x7f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xa0, 0xc, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x0, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff,
-    0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-    0x66, 0x66, 0x66, 0xaf, 0xff, 0xff, 0x43, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xa0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x87, 0x55, 0x78, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x59, 0xbd, 0xef, 0xfe, 0xdb, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc9, 0x17, 0xbd, 0xfe, 0xec, 0x96,
+    0x10, 0xf, 0xfe, 0x40, 0xc7, 0x5b, 0xa1, 0x8,
+    0x0, 0x4d, 0xa7, 0xad, 0x0, 0x3f, 0xf8, 0xb1,
+    0xce, 0x20, 0x1f, 0xf9, 0x2e, 0xc4, 0x1, 0xff,
+    0xc1, 0x2d, 0x70, 0xf, 0xfe, 0x2a, 0x6a, 0x80,
+    0x7f, 0xc7, 0x84, 0x1, 0xff, 0xc8, 0xa7, 0x0,
+    0xfe, 0x2c, 0x10, 0xf, 0x13, 0x56, 0x6e, 0x5c,
+    0x20, 0x7, 0xd0, 0xc0, 0x1f, 0xe, 0x0, 0x78,
+    0xab, 0x65, 0x4c, 0x8d, 0x1e, 0xf5, 0x40, 0x3d,
+    0x26, 0x1, 0xeb, 0x10, 0xe, 0x5d, 0x50, 0xf,
+    0xe2, 0xaa, 0x0, 0x7b, 0x80, 0x38, 0xd4, 0x3,
+    0x9a, 0x80, 0x3f, 0xf8, 0x2b, 0x60, 0x1c, 0x4e,
+    0x1, 0xa0, 0x3, 0x8e, 0x40, 0x3f, 0xf8, 0x69,
+    0x20, 0x1d, 0x20, 0x11, 0x20, 0x7, 0x70, 0x7,
+    0xff, 0x15, 0x90, 0x3, 0xa, 0x80, 0x14, 0x3,
+    0x94, 0x80, 0x3f, 0xf8, 0xde, 0x1, 0xde, 0x0,
+    0xb0, 0xe, 0xe0, 0xf, 0xfe, 0x3a, 0x8, 0x6,
+    0x50, 0x1, 0x80, 0x72, 0x0, 0x7f, 0xf2, 0x10,
+    0x3, 0x88, 0x80, 0x1c, 0x2c, 0xdf, 0xfc, 0x90,
+    0xf, 0x30, 0x80, 0x70, 0xcc, 0xff, 0xf2, 0x54,
+    0x3, 0x89, 0xc0, 0x3f, 0xfa, 0xa2, 0x1, 0xff,
+    0xd7, 0x70, 0xf, 0xfe, 0xa8, 0x88, 0x3, 0x87,
+    0xff, 0xff, 0x9e, 0xc4, 0x1, 0xc2, 0x40, 0x1f,
+    0xfd, 0x3, 0x0, 0xe5, 0x0, 0xff, 0xe8, 0x58,
+    0x7, 0x48, 0x7, 0xff, 0x41, 0x40, 0x38, 0x5c,
+    0x3, 0xff, 0x9e, 0x4a, 0x1, 0xd0, 0x60, 0x1f,
+    0xfc, 0x61, 0x0, 0xfd, 0x20, 0x1e, 0xc4, 0x0,
+    0xff, 0xe2, 0x17, 0xd0, 0x7, 0xc6, 0xe0, 0x1e,
+    0xb7, 0x0, 0xff, 0xe1, 0x2e, 0xa, 0xc0, 0x7,
+    0xd0, 0x40, 0x1e, 0x8d, 0x60, 0xf, 0xf2, 0xe5,
+    0x8, 0x1, 0xd8, 0x3, 0xec, 0x10, 0xf, 0x14,
+    0xfe, 0x43, 0xaa, 0x9e, 0x2f, 0xe8, 0xc0, 0x3a,
+    0x44, 0x3, 0xc3, 0x84, 0x1, 0xf8, 0xde, 0x2a,
+    0x90, 0xe8, 0x1, 0xfa, 0x84, 0x3, 0xe2, 0xd5,
+    0x0, 0xff, 0xe4, 0x8d, 0xa8, 0x7, 0xfa, 0xac,
+    0x80, 0x3f, 0xf8, 0xcb, 0xe8, 0x1, 0xff, 0x93,
+    0x68, 0xc0, 0x3f, 0xf8, 0x4b, 0xb4, 0x20, 0x1f,
+    0xfc, 0x35, 0xce, 0xa6, 0x42, 0x10, 0x0, 0x92,
+    0x3d, 0xfd, 0x10, 0x7, 0xc0,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xfe, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x93, 0x10,
-    0x26, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x51, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe0, 0xac, 0xe7, 0x7f, 0xba, 0xe0,
+    0xc0, 0x3f, 0xf8, 0x2d, 0xd4, 0xc6, 0x20, 0x1,
+    0x47, 0xcc, 0x18, 0x7, 0xf0, 0xdc, 0x88, 0x7,
+    0xf8, 0xe8, 0x3, 0xfb, 0x50, 0x3, 0xff, 0x83,
+    0x40, 0x1f, 0xa0, 0xc0, 0x3f, 0xf8, 0x24, 0x60,
+    0x1f, 0xb, 0x80, 0x79, 0xb3, 0xbf, 0x64, 0xc2,
+    0xc0, 0x3f, 0x48, 0x7, 0xb2, 0x4c, 0x40, 0x9b,
+    0x29, 0xc0, 0x3f, 0x28, 0x7, 0x41, 0x80, 0x7c,
+    0xa2, 0x1, 0xf0, 0x90, 0x7, 0x30, 0x7, 0xff,
+    0x14, 0xc0, 0x38, 0x84, 0x3, 0xff, 0x8a, 0x20,
+    0x1c, 0x20, 0x1f, 0xfc, 0x67, 0x0, 0xe7, 0x0,
+    0xff, 0xf9, 0xff, 0xf5, 0x80, 0x72, 0x7f, 0xff,
+    0x48, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xa1, 0xff,
+    0xd6, 0x1, 0xc5, 0xff, 0xfd, 0x20, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xfe, 0x78,
 
     /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbd,
-    0xef, 0xfe, 0xca, 0x62, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x29,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60,
-    0x0, 0x8, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd3, 0x0, 0x8f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x8f, 0xff, 0xff, 0x40, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xa7, 0x65, 0x67, 0x9e,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf4, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x1, 0xef, 0xff, 0xff, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x8f, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1f,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xf4, 0x6, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x40, 0xbf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf4, 0xf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x42, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf4, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x44, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf4, 0x1f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x40,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf4, 0xb, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0x40, 0x5f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0x40, 0x7, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xea, 0x86, 0x56, 0x7a, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x7e, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0xef, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0xe,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x8b, 0xde, 0xff, 0xed,
-    0xa6, 0x20, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x5, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfc, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xb8, 0x66, 0x56, 0x79, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x9b,
-    0xde, 0xff, 0xff, 0xdc, 0x96, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc9, 0x17, 0xbd, 0xfe, 0xec, 0xa6,
+    0x20, 0xf, 0x47, 0xff, 0x20, 0x7, 0xf1, 0x4f,
+    0xdb, 0xa1, 0x8, 0x0, 0x4d, 0x67, 0x71, 0x80,
+    0x3f, 0xf8, 0xc3, 0x5a, 0xc0, 0x1f, 0xfc, 0x13,
+    0x9d, 0x30, 0xf, 0xfe, 0x1a, 0xf2, 0x80, 0x7f,
+    0xf1, 0x4b, 0x1c, 0x3, 0xff, 0x82, 0xf4, 0x1,
+    0xff, 0xc9, 0x88, 0x0, 0x7f, 0xcf, 0x0, 0x1f,
+    0x85, 0x62, 0x6a, 0x61, 0x84, 0x3, 0xce, 0xc0,
+    0x1f, 0xc9, 0x0, 0x1f, 0x26, 0x75, 0x3b, 0x2b,
+    0x3c, 0xf6, 0xa8, 0x7, 0x8, 0x7, 0xe1, 0xa0,
+    0xf, 0xd, 0xd8, 0xc0, 0x3f, 0x8a, 0xb0, 0x80,
+    0x3f, 0xf4, 0x88, 0x7, 0x17, 0xa0, 0x7, 0xff,
+    0x4, 0xf4, 0xc0, 0x3f, 0xc2, 0xe0, 0x1c, 0x3e,
+    0x20, 0x1f, 0xfc, 0x4d, 0x20, 0xf, 0xe7, 0x0,
+    0xf5, 0x90, 0x7, 0xff, 0x14, 0x78, 0x3, 0xfb,
+    0x40, 0x38, 0xd4, 0x3, 0xff, 0x8e, 0x6a, 0x1,
+    0xf9, 0x0, 0x3a, 0xc0, 0x3f, 0xf9, 0x3e, 0x1,
+    0xf1, 0x0, 0x79, 0x40, 0x3f, 0xf9, 0x2a, 0x1,
+    0xf0, 0x80, 0x78, 0x80, 0x3f, 0xf9, 0x42, 0x1,
+    0xe7, 0x0, 0xe1, 0x0, 0xff, 0xe5, 0x90, 0x7,
+    0xff, 0x7d, 0xc0, 0x38, 0x40, 0x3f, 0xf9, 0x62,
+    0x1, 0xe2, 0x0, 0xf1, 0x80, 0x7f, 0xf2, 0x88,
+    0x3, 0xc2, 0x20, 0xe, 0x40, 0xf, 0xfe, 0x4a,
+    0x80, 0x7e, 0x50, 0xe, 0xa0, 0xf, 0xfe, 0x4f,
+    0x0, 0x7e, 0xe0, 0xe, 0x26, 0x0, 0xff, 0xe3,
+    0xa2, 0x0, 0x3f, 0x28, 0x7, 0xa4, 0x80, 0x3f,
+    0xf8, 0xa3, 0x40, 0x1f, 0xe8, 0x0, 0xf6, 0x10,
+    0x7, 0xff, 0xc, 0x70, 0x40, 0x3f, 0xce, 0x20,
+    0x1c, 0x3a, 0xa0, 0x1f, 0xfc, 0x13, 0xf2, 0x0,
+    0xff, 0xda, 0x1, 0xf5, 0x62, 0x0, 0x7f, 0x1d,
+    0x60, 0x80, 0x7f, 0xf0, 0x4e, 0x40, 0x3e, 0x3b,
+    0xea, 0x86, 0x56, 0x7a, 0xec, 0x50, 0xf, 0xfe,
+    0x23, 0x48, 0x7, 0xe1, 0x57, 0x9a, 0x98, 0x51,
+    0x0, 0xf4, 0x8, 0x7, 0xfc, 0xd6, 0x20, 0x1f,
+    0xfc, 0x89, 0x70, 0xf, 0xfe, 0xa, 0x7b, 0x0,
+    0x7f, 0xf1, 0x4b, 0x18, 0x3, 0xe7, 0x0, 0xf8,
+    0x67, 0x58, 0x3, 0xff, 0x82, 0x75, 0xa6, 0x0,
+    0x10, 0xf, 0xfe, 0x19, 0x4f, 0xdb, 0xa1, 0x8,
+    0x0, 0x49, 0x67, 0x71, 0x40, 0x3f, 0xc2, 0x1,
+    0xff, 0x92, 0x2f, 0x7b, 0xfd, 0xdb, 0x4c, 0x40,
+    0x1c, 0x40, 0x1e, 0x20, 0xf, 0xfe, 0x8a, 0x0,
+    0x70, 0x80, 0x7f, 0xf4, 0xb0, 0x3, 0x94, 0x3,
+    0xff, 0xa2, 0x2a, 0x1, 0xd8, 0x1, 0xe6, 0x0,
+    0xff, 0xe5, 0x58, 0x7, 0x94, 0x3, 0x96, 0x74,
+    0xc0, 0x3f, 0xf8, 0xec, 0xa0, 0x1c, 0x84, 0x1,
+    0xd6, 0x5, 0x94, 0x60, 0x1f, 0xfc, 0x48, 0x90,
+    0xf, 0x78, 0x7, 0x48, 0x80, 0x4b, 0x98, 0x72,
+    0x0, 0xff, 0x9b, 0x5c, 0x3, 0xc8, 0x80, 0xc,
+    0x6c, 0x1, 0xe3, 0x8d, 0xeb, 0x86, 0x62, 0xb3,
+    0xce, 0x7c, 0x90, 0x7, 0x86, 0x80, 0x38, 0x8c,
+    0x3, 0xf8, 0x51, 0xe6, 0x55, 0x30, 0xc6, 0x1,
+    0xf8, 0x74, 0x40, 0x38, 0x72, 0x0, 0x3f, 0xf9,
+    0xa5, 0x86, 0x1, 0xf9, 0xf9, 0xc0, 0x3f, 0xf9,
+    0x4f, 0xa4, 0x1, 0xfe, 0x18, 0xfa, 0x40, 0xf,
+    0xfe, 0x20, 0xbf, 0x40, 0x7, 0xff, 0xd, 0x6f,
+    0xf2, 0x59, 0x8, 0x40, 0x31, 0x1b, 0x4e, 0xf4,
+    0x8, 0x7, 0xe0,
 
     /* U+0068 "h" */
-    0x2, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x3, 0x7b, 0xde, 0xff,
-    0xec, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x6, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x87, 0x89, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x82, 0x0, 0x0, 0x0, 0x1, 0x8f,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xfa, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x10, 0x2f,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x50,
-    0x2f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x90, 0x2f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xc0, 0x2f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xd0, 0x2f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
+    0x2, 0x2f, 0x0, 0x7f, 0xf3, 0xcb, 0x77, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xfe, 0x9b, 0xde, 0xf7, 0xfb, 0xb2, 0x98,
+    0x80, 0x3f, 0xf9, 0xd, 0xb9, 0x8, 0x42, 0x0,
+    0x13, 0x59, 0xdb, 0x30, 0xf, 0xfe, 0x22, 0x6c,
+    0x90, 0x7, 0xfe, 0x4c, 0x90, 0xf, 0xfe, 0x13,
+    0xd9, 0x0, 0x7f, 0xf1, 0x1b, 0x4, 0x3, 0xfe,
+    0x88, 0x0, 0x7f, 0xf1, 0xcf, 0x40, 0x3f, 0xe7,
+    0x0, 0xf1, 0x2b, 0xc3, 0xb1, 0x80, 0x7e, 0x3a,
+    0x0, 0xff, 0xe1, 0xbe, 0xea, 0xa1, 0xe2, 0x73,
+    0x9c, 0x3, 0xe5, 0x30, 0xf, 0xfc, 0x7d, 0x4,
+    0x1, 0xf0, 0xc6, 0x90, 0x7, 0xa4, 0x3, 0xfe,
+    0x4c, 0x10, 0xf, 0xf8, 0xbc, 0x3, 0xca, 0x20,
+    0x1f, 0xc3, 0x40, 0x1f, 0xfc, 0x22, 0x90, 0xf,
+    0x20, 0x7, 0xf5, 0x88, 0x7, 0xff, 0xd, 0x84,
+    0x3, 0xb0, 0x3, 0xf1, 0x28, 0x7, 0xff, 0x15,
+    0xc0, 0x39, 0x40, 0x3f, 0x28, 0x7, 0xff, 0x1b,
+    0xc0, 0x38, 0x40, 0x3f, 0x60, 0x7, 0xff, 0x19,
+    0x40, 0x38, 0xc0, 0x3f, 0x28, 0x7, 0xff, 0x18,
+    0x40, 0x38, 0x40, 0x3f, 0x8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0x68,
 
     /* U+0069 "i" */
-    0x0, 0x4c, 0xff, 0xb3, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0x30, 0xe, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xf0, 0xe, 0xff, 0xff, 0xff, 0xb0, 0x5, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x3b, 0xee, 0xa2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x26, 0x7f, 0xac, 0xc0, 0x25, 0xb3, 0x0,
+    0x26, 0x18, 0x2, 0xc0, 0x3d, 0xe0, 0x62, 0x1,
+    0xe3, 0x0, 0xff, 0x8c, 0x40, 0x3c, 0x80, 0xb,
+    0x0, 0xe1, 0x90, 0x2, 0xe2, 0x8, 0x97, 0x8,
+    0x2, 0x3b, 0xee, 0x51, 0x0, 0x7f, 0xfa, 0x4b,
+    0xff, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xd4,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xde,
-    0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xef, 0xc5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x70, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf8, 0x0, 0x6, 0xfd,
-    0x84, 0x33, 0x5a, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xed, 0xa6, 0x10, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0xc3, 0x3b, 0xd8, 0xa0, 0x1f, 0xfc,
+    0x11, 0xf6, 0x21, 0x3a, 0x70, 0xf, 0xfd, 0x2,
+    0x1, 0xd0, 0x20, 0x1f, 0xf3, 0x80, 0x7c, 0x80,
+    0x1f, 0xfd, 0x34, 0x0, 0xf9, 0x0, 0x3f, 0xe8,
+    0x10, 0xe, 0x81, 0x0, 0xff, 0x8b, 0x14, 0x40,
+    0xe9, 0xc0, 0x3f, 0xf8, 0x25, 0x5d, 0xf8, 0xa0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0x7e, 0xff, 0xf2,
+    0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0xc6,
+    0x1, 0xce, 0x1, 0xff, 0xc1, 0x10, 0xe, 0x10,
+    0xf, 0xfc, 0x60, 0x1e, 0x30, 0xf, 0xfd, 0x40,
+    0x1c, 0x42, 0x1, 0x38, 0x7, 0xca, 0xc0, 0x1c,
+    0xa0, 0x13, 0x46, 0xc2, 0x19, 0x96, 0xa8, 0x1,
+    0xea, 0x0, 0xac, 0x9, 0xef, 0x31, 0x4a, 0x1,
+    0xe6, 0x20, 0x2, 0x10, 0x7, 0xff, 0x4, 0xa4,
+    0x2, 0xf0, 0xf, 0xfe, 0x9, 0xe0, 0x6, 0x83,
+    0x0, 0xff, 0x9f, 0x4, 0x3, 0x1e, 0x61, 0xd0,
+    0x40, 0x2, 0x4b, 0x3d, 0x0, 0x1e,
 
     /* U+006B "k" */
-    0x2, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0x60, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbf,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x1, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xff, 0xf8, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xf2, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xd0,
+    0x2, 0x2f, 0x0, 0x7f, 0xf4, 0xb, 0x77, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xf2, 0x8b, 0xbf, 0xfc,
+    0xc0, 0x1f, 0xfc, 0xd3, 0xc1, 0x0, 0xe9, 0x60,
+    0xf, 0xfe, 0x62, 0x60, 0x80, 0x75, 0x30, 0x7,
+    0xff, 0x31, 0x6c, 0x3, 0xd4, 0xa0, 0x1f, 0xfc,
+    0xc7, 0xa0, 0xf, 0x52, 0x80, 0x7f, 0xf3, 0x22,
+    0x0, 0x1e, 0xa5, 0x0, 0xff, 0xe6, 0x4b, 0x80,
+    0x7a, 0xd4, 0x3, 0xff, 0x99, 0x6c, 0x1, 0xeb,
+    0x40, 0xf, 0xfe, 0x66, 0x20, 0x7, 0xad, 0x0,
+    0x3f, 0xf9, 0x63, 0xa6, 0x1, 0xeb, 0x40, 0xf,
+    0xfe, 0x59, 0x61, 0x0, 0x7a, 0xd0, 0x3, 0xff,
+    0x96, 0x58, 0x40, 0x1e, 0xc4, 0x0, 0xff, 0xe5,
+    0x9e, 0x88, 0x7, 0xb0, 0xc0, 0x3f, 0xf9, 0x69,
+    0x80, 0x1f, 0x61, 0x80, 0x7f, 0xf2, 0xda, 0xc0,
+    0x3e, 0x12, 0x0, 0xff, 0xe5, 0xbc, 0x80, 0x7e,
+    0x1a, 0x0, 0xff, 0xe5, 0x44, 0x0, 0x3f, 0xc9,
+    0x0, 0x1f, 0xfc, 0x97, 0x0, 0xff, 0xce, 0xa0,
+    0x1f, 0xfc, 0xe5, 0x40, 0xf, 0x51, 0x0, 0x7f,
+    0xf3, 0x1a, 0xa8, 0x40, 0x1e, 0xf0, 0xf, 0xfe,
+    0x5b, 0xc8, 0xf, 0x80, 0x78, 0xa8, 0x3, 0xff,
+    0x93, 0x10, 0x0, 0x8a, 0x80, 0x3c, 0xae, 0x1,
+    0xff, 0xc7, 0x97, 0x0, 0xe5, 0x70, 0xf, 0x42,
+    0x0, 0x7f, 0xf1, 0x6d, 0x80, 0x3e, 0x84, 0x0,
+    0xf5, 0x8, 0x7, 0xff, 0xf, 0x10, 0x3, 0xfa,
+    0x88, 0x3, 0x87, 0x40, 0x3f, 0xf8, 0x66, 0x1,
+    0xfe, 0x1f, 0x0, 0xf1, 0xc8, 0x7, 0xff, 0x38,
+    0xac, 0x3, 0xcc, 0xc0, 0xf, 0xfe, 0x72, 0x40,
+    0x7, 0xa4, 0xc0, 0x3f, 0xf9, 0xce, 0xa0, 0x1e,
+    0xd1, 0x0, 0xff, 0xe7, 0x51, 0x0, 0x70, 0xd0,
+    0x7, 0xff, 0x3f, 0xc4, 0x3, 0x92, 0x0, 0x3f,
+    0xf9, 0xc5, 0x40, 0x1e, 0x75, 0x0, 0xff, 0xe7,
+    0x24, 0x0, 0x7a, 0x88, 0x3, 0xff, 0x9c, 0xea,
+    0x1, 0xef, 0x0,
 
     /* U+006C "l" */
-    0x2, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff,
-    0xff, 0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff,
-    0xf2, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2,
-    0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff,
-    0xff, 0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff,
-    0xff, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff,
+    0x2, 0x2f, 0xb7, 0x7c, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfc, 0xa0,
 
     /* U+006D "m" */
-    0x2f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x5, 0x9c,
-    0xef, 0xff, 0xdb, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x6a, 0xce, 0xff, 0xed, 0xb7,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xb0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc9, 0x87, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x4f, 0xff, 0xff, 0xff, 0xfc, 0x98, 0x78, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0x10, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfd, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x40, 0x2f, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x70, 0x2f, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xb0, 0x2f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf1, 0x2f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf2,
+    0x2f, 0xfe, 0xb0, 0xf, 0x2c, 0xe7, 0x7f, 0xdb,
+    0x70, 0x60, 0x1f, 0xfc, 0x11, 0x6a, 0xce, 0xff,
+    0x76, 0xdb, 0x98, 0x7, 0xff, 0x1c, 0x67, 0xe9,
+    0x8c, 0x40, 0x22, 0x47, 0xcd, 0x50, 0xf, 0xe4,
+    0xbe, 0x95, 0x31, 0x0, 0x9, 0x24, 0x66, 0xa8,
+    0x7, 0xff, 0x11, 0xb9, 0x80, 0x3f, 0xf1, 0x56,
+    0x8, 0x7, 0x16, 0x5a, 0x0, 0x7f, 0xe2, 0xac,
+    0x10, 0xf, 0xfe, 0xd, 0x48, 0x7, 0xff, 0x10,
+    0xfc, 0xc0, 0x25, 0xd3, 0x0, 0xff, 0xe2, 0x1f,
+    0x98, 0x7, 0xfd, 0x2a, 0x1, 0xff, 0xc6, 0x1d,
+    0x10, 0x6a, 0x0, 0xff, 0xe3, 0x8e, 0x88, 0x7,
+    0xf2, 0x30, 0x7, 0x8d, 0x9e, 0x19, 0x0, 0x3f,
+    0xd, 0x24, 0x80, 0x7c, 0x6c, 0xf0, 0xe8, 0x1,
+    0xf8, 0x74, 0x3, 0xff, 0x84, 0x33, 0xf9, 0x30,
+    0xf3, 0x7f, 0x22, 0x1, 0xe4, 0xb0, 0xe, 0x18,
+    0xec, 0x98, 0x78, 0xbf, 0xa2, 0x0, 0xf1, 0xb0,
+    0x7, 0xfe, 0x5e, 0x60, 0xf, 0xcd, 0xe6, 0x1,
+    0xff, 0x1f, 0xb8, 0x80, 0x7c, 0xba, 0x80, 0x1e,
+    0xb0, 0xf, 0xf9, 0x68, 0x3, 0xfe, 0x1d, 0x10,
+    0xf, 0xe4, 0xc1, 0x0, 0xff, 0xac, 0x80, 0x38,
+    0x90, 0x3, 0xf8, 0xa8, 0x3, 0xff, 0x82, 0x36,
+    0x1, 0xf8, 0x68, 0x3, 0xff, 0x85, 0xc0, 0x1e,
+    0x30, 0xf, 0xe9, 0x0, 0xff, 0xe1, 0xa9, 0x0,
+    0x7d, 0x62, 0x1, 0xff, 0xc2, 0x33, 0x0, 0x76,
+    0x0, 0x7e, 0x24, 0x0, 0xff, 0xe2, 0x28, 0x7,
+    0x85, 0x40, 0x3f, 0xf8, 0x96, 0x1, 0xca, 0x1,
+    0xf9, 0x40, 0x3f, 0xf8, 0xba, 0x1, 0xe7, 0x0,
+    0xff, 0xe2, 0x98, 0x7, 0x8, 0x7, 0xec, 0x0,
+    0xff, 0xe2, 0xb0, 0x7, 0xb0, 0x3, 0xff, 0x8a,
+    0xa0, 0x1e, 0x10, 0xf, 0x94, 0x3, 0xff, 0x8a,
+    0x20, 0x1e, 0x60, 0xf, 0xfe, 0x28, 0x80, 0x78,
+    0xc0, 0x3e, 0x10, 0xf, 0xfe, 0x29, 0x80, 0x78,
+    0x40, 0x3f, 0xfd, 0xa6, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xc0,
 
     /* U+006E "n" */
-    0x2f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3, 0x7b,
-    0xde, 0xff, 0xec, 0xa6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xb0, 0x0, 0x7, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0, 0x5, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xda, 0x87, 0x89, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x82, 0x0, 0x0, 0x0,
-    0x1, 0x8f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xfa, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x10, 0x2f, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x50, 0x2f, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x90, 0x2f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xc0, 0x2f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xd0, 0x2f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x2f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0,
+    0x2f, 0xfe, 0xb0, 0xf, 0x1b, 0xde, 0xf7, 0xfb,
+    0xb2, 0x98, 0x80, 0x3f, 0xf9, 0xf, 0xb9, 0x8,
+    0x42, 0x0, 0x13, 0x59, 0xdb, 0x30, 0xf, 0xfe,
+    0x22, 0xf4, 0x10, 0x7, 0xfe, 0x4c, 0x90, 0xf,
+    0xfe, 0x14, 0x50, 0x80, 0x7f, 0xf1, 0x1b, 0x4,
+    0x3, 0xfe, 0x87, 0x0, 0xff, 0xe3, 0x9e, 0x80,
+    0x7f, 0x91, 0xc0, 0x3c, 0x4a, 0xf0, 0xec, 0x60,
+    0x1f, 0x8e, 0x80, 0x3f, 0xf8, 0x6f, 0xba, 0xa8,
+    0x78, 0x9c, 0xe7, 0x0, 0xf9, 0x4c, 0x3, 0xff,
+    0x1f, 0x41, 0x0, 0x7c, 0x31, 0xa4, 0x1, 0xe9,
+    0x0, 0xff, 0x93, 0x4, 0x3, 0xfe, 0x2f, 0x0,
+    0xf2, 0x88, 0x7, 0xf0, 0xd0, 0x7, 0xff, 0x8,
+    0xa4, 0x3, 0xc8, 0x1, 0xfd, 0x62, 0x1, 0xff,
+    0xc3, 0x61, 0x0, 0xec, 0x0, 0xfc, 0x4a, 0x1,
+    0xff, 0xc5, 0x70, 0xe, 0x50, 0xf, 0xca, 0x1,
+    0xff, 0xc6, 0xf0, 0xe, 0x10, 0xf, 0xd8, 0x1,
+    0xff, 0xc6, 0x50, 0xe, 0x30, 0xf, 0xca, 0x1,
+    0xff, 0xc6, 0x10, 0xe, 0x10, 0xf, 0xc2, 0x1,
+    0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xda,
 
     /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9c,
-    0xef, 0xfe, 0xeb, 0x95, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xea, 0x76, 0x56, 0x8b, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0x50, 0x2, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xc0, 0x7, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1,
-    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf6, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf9, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf9, 0xc, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xf6, 0x7, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1, 0x1, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0x76, 0x56, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0x9c, 0xef, 0xff, 0xeb, 0x95, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc4, 0xd3, 0x9d, 0xfe, 0xee, 0x5c,
+    0xa8, 0x7, 0xff, 0x29, 0xb7, 0x52, 0xc6, 0x20,
+    0x1, 0x12, 0x35, 0x7d, 0x98, 0x7, 0xff, 0x15,
+    0x7a, 0x48, 0x3, 0xff, 0x82, 0x99, 0x82, 0x0,
+    0xff, 0xe0, 0x8d, 0xd0, 0x80, 0x7f, 0xf1, 0x4f,
+    0x5c, 0x3, 0xfe, 0x2c, 0x40, 0xf, 0xfe, 0x4c,
+    0x50, 0x7, 0xf0, 0xe1, 0x0, 0x7c, 0x2b, 0x13,
+    0x52, 0xe8, 0x1, 0xf9, 0x68, 0x3, 0xf6, 0x8,
+    0x7, 0x8e, 0xfa, 0x9d, 0x95, 0xa2, 0xfe, 0x4,
+    0x3, 0xca, 0xe0, 0x1e, 0x92, 0x0, 0xf4, 0xe2,
+    0x0, 0x7f, 0x3f, 0x28, 0x7, 0xa0, 0xc0, 0x31,
+    0xb0, 0x7, 0xad, 0x80, 0x3f, 0xf8, 0x34, 0xe0,
+    0x1e, 0xf0, 0xd, 0x0, 0x1e, 0xa4, 0x0, 0xff,
+    0xe1, 0xc2, 0x80, 0x71, 0xa8, 0x0, 0x90, 0x3,
+    0x95, 0x40, 0x1f, 0xfc, 0x5b, 0x10, 0xe, 0x90,
+    0x2, 0x80, 0x7a, 0xc0, 0x3f, 0xf8, 0xc3, 0x20,
+    0x1c, 0x62, 0x16, 0x1, 0xca, 0x20, 0x1f, 0xfc,
+    0x77, 0x0, 0xf3, 0x81, 0x80, 0x77, 0x80, 0x7f,
+    0xf2, 0x50, 0x3, 0xbc, 0x80, 0x3c, 0xe0, 0x1f,
+    0xfc, 0x9c, 0x0, 0xe5, 0x10, 0xf, 0x10, 0x7,
+    0xff, 0x24, 0x80, 0x38, 0x5c, 0x3, 0x84, 0x3,
+    0xff, 0x94, 0x20, 0x1c, 0x60, 0x1f, 0xfd, 0x87,
+    0x0, 0xe1, 0x0, 0xff, 0xe5, 0x8, 0x7, 0x18,
+    0x80, 0x78, 0x80, 0x3f, 0xf9, 0x24, 0x1, 0xc2,
+    0x40, 0x1e, 0x70, 0xf, 0xfe, 0x4e, 0x0, 0x72,
+    0x81, 0x80, 0x77, 0x80, 0x7f, 0xf2, 0x50, 0x3,
+    0xbc, 0x2c, 0x3, 0x94, 0x80, 0x3f, 0xf8, 0xee,
+    0x1, 0xe7, 0x6, 0x0, 0xf4, 0x0, 0x7f, 0xf1,
+    0x86, 0x40, 0x39, 0x4, 0x5, 0x40, 0x39, 0x54,
+    0x1, 0xff, 0xc5, 0xa1, 0x0, 0xef, 0x0, 0xa0,
+    0x3, 0xd4, 0x80, 0x1f, 0xfc, 0x39, 0x40, 0xe,
+    0x34, 0x0, 0x89, 0xc0, 0x3d, 0x6e, 0x1, 0xff,
+    0x86, 0x98, 0x3, 0xdc, 0x1, 0xd0, 0x60, 0x1e,
+    0x8c, 0x50, 0xf, 0xe7, 0xf5, 0x0, 0xf4, 0x10,
+    0x7, 0xb4, 0x80, 0x3c, 0x75, 0xd4, 0xec, 0xad,
+    0x17, 0xf0, 0x20, 0x1e, 0x67, 0x0, 0xf8, 0x7c,
+    0x80, 0x3e, 0x15, 0x89, 0xa9, 0x74, 0x0, 0xfc,
+    0xd2, 0x1, 0xfc, 0x5a, 0xa0, 0x1f, 0xfc, 0x99,
+    0x90, 0x7, 0xfe, 0xaa, 0x8, 0x7, 0xff, 0x15,
+    0x35, 0x80, 0x3f, 0xf8, 0x4b, 0xd2, 0x60, 0x1f,
+    0xfc, 0x14, 0xcb, 0x20, 0xf, 0xfe, 0x2b, 0x66,
+    0xcb, 0x18, 0x80, 0x42, 0x8d, 0x5f, 0x66, 0x1,
+    0xfc,
 
     /* U+0070 "p" */
-    0x2f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x2, 0x7b,
-    0xde, 0xff, 0xec, 0xa7, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0, 0x0, 0x5,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xb0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xea, 0x76, 0x56, 0x8b, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xef, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xfe, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0x60, 0x2f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xd0, 0x2f, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf7, 0x2f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x2f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf9, 0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x2f, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xd0,
-    0x2f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x60, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc4, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x2f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xea,
-    0x75, 0x56, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x4, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x2, 0x7a, 0xdf, 0xff, 0xed, 0xa7, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0xb0, 0xf, 0x13, 0xde, 0xf7, 0xfb,
+    0xb2, 0x9c, 0x80, 0x3f, 0xf9, 0x4b, 0x9b, 0x8,
+    0x42, 0x0, 0x13, 0x58, 0xdd, 0x30, 0x7, 0xff,
+    0x18, 0xb6, 0x8c, 0x3, 0xff, 0x14, 0xf2, 0x0,
+    0x7f, 0xf0, 0xd7, 0x48, 0x3, 0xff, 0x88, 0x37,
+    0x40, 0x1f, 0xfc, 0x15, 0xa0, 0xf, 0xfe, 0x42,
+    0xe0, 0x80, 0x7f, 0x9a, 0x80, 0x3c, 0x2b, 0x13,
+    0x52, 0xe8, 0x1, 0xf8, 0xf4, 0x3, 0xfc, 0x40,
+    0x1c, 0x55, 0xd4, 0xec, 0xad, 0x17, 0xd0, 0x20,
+    0x1e, 0x3a, 0x0, 0xff, 0xe1, 0x46, 0xa8, 0x7,
+    0xe1, 0x7f, 0x50, 0xf, 0x2a, 0x80, 0x3f, 0xf5,
+    0xb8, 0x7, 0xfe, 0x1a, 0x60, 0xf, 0x58, 0x7,
+    0xfd, 0x28, 0x1, 0xff, 0xc3, 0x95, 0x0, 0xe1,
+    0x60, 0xf, 0xe5, 0x60, 0xf, 0xfe, 0x2d, 0x88,
+    0x7, 0x58, 0x7, 0xf4, 0x0, 0x7f, 0xf1, 0x86,
+    0x40, 0x38, 0x88, 0x1, 0xf2, 0x90, 0x7, 0xff,
+    0x1d, 0xc0, 0x3c, 0xa0, 0x1f, 0x78, 0x7, 0xff,
+    0x25, 0x0, 0x3b, 0x40, 0x3e, 0x70, 0xf, 0xfe,
+    0x4e, 0x0, 0x73, 0x0, 0x7c, 0x40, 0x1f, 0xfc,
+    0x92, 0x0, 0xe1, 0x0, 0xf0, 0x80, 0x7f, 0xf2,
+    0x84, 0x3, 0x8c, 0x3, 0xff, 0xbc, 0x20, 0x1f,
+    0xfc, 0xa1, 0x0, 0xe3, 0x0, 0xf8, 0x80, 0x3f,
+    0xf9, 0x3a, 0x1, 0xc2, 0x1, 0xf3, 0x80, 0x7f,
+    0xf2, 0x4c, 0x3, 0x94, 0x3, 0xef, 0x0, 0xff,
+    0xe4, 0xa, 0x0, 0x77, 0x80, 0x7c, 0xa2, 0x1,
+    0xff, 0xc7, 0x60, 0xf, 0x20, 0x7, 0xeb, 0x0,
+    0xff, 0xe3, 0xc, 0x80, 0x71, 0x10, 0x3, 0xf2,
+    0xa8, 0x3, 0xff, 0x8b, 0x42, 0x1, 0xd6, 0x1,
+    0xfe, 0xa4, 0x0, 0xff, 0xe1, 0xca, 0x0, 0x70,
+    0xb0, 0x7, 0xfd, 0x6c, 0x1, 0xff, 0x86, 0xd8,
+    0x3, 0xd6, 0x1, 0xff, 0xc1, 0x9c, 0x40, 0xf,
+    0xc2, 0xfe, 0x80, 0x1e, 0x55, 0x0, 0x7f, 0x8,
+    0x6, 0x3b, 0xea, 0x75, 0x53, 0x45, 0xf4, 0x8,
+    0x7, 0x8e, 0x80, 0x3f, 0xda, 0x1, 0xe1, 0x58,
+    0xaa, 0x4b, 0xa0, 0x7, 0xe3, 0xd0, 0xf, 0xf8,
+    0xf0, 0x40, 0x3f, 0xf8, 0xeb, 0x82, 0x1, 0xff,
+    0x8f, 0xd0, 0x3, 0xff, 0x88, 0x35, 0x40, 0xf,
+    0xfe, 0x18, 0xdd, 0x8c, 0x3, 0xff, 0x14, 0xf2,
+    0x80, 0x7f, 0xf1, 0x93, 0x36, 0x14, 0x80, 0x21,
+    0x25, 0x8d, 0xd3, 0x0, 0x7f, 0xf2, 0x89, 0xeb,
+    0x7f, 0xee, 0xda, 0x72, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x50,
 
     /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0xbd,
-    0xef, 0xfe, 0xc9, 0x51, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0,
-    0x1, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x11, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xea, 0x76, 0x56, 0x8b, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xfd, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xfd, 0x3, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfd, 0x8, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd,
-    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfd, 0xf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xfd, 0x3f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x4f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x2f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
-    0xf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xfd, 0xc, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfd, 0x8, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x2, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xfd,
-    0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0x76, 0x56, 0x8b, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0xbd, 0xef, 0xfe, 0xc9, 0x50, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd,
+    0x0, 0xff, 0xc9, 0x17, 0xbd, 0xfe, 0xec, 0x95,
+    0x10, 0xe, 0x1f, 0xfe, 0xd0, 0xf, 0xe1, 0x8e,
+    0xb7, 0x42, 0x10, 0x0, 0x9b, 0x57, 0x51, 0x0,
+    0x7f, 0xf1, 0xa3, 0x9c, 0x40, 0x3f, 0xf2, 0xec,
+    0x80, 0x7f, 0xf0, 0xcb, 0x5c, 0x3, 0xff, 0x8a,
+    0xda, 0x20, 0x1f, 0xf9, 0x34, 0x80, 0x3f, 0xf8,
+    0xe5, 0xe6, 0x1, 0xfe, 0x3b, 0x0, 0xfc, 0x2b,
+    0x13, 0x52, 0xe8, 0x1, 0xe1, 0xf0, 0xf, 0xe1,
+    0xd0, 0xf, 0x8e, 0xfa, 0x9d, 0x95, 0xa2, 0xf9,
+    0xc0, 0x38, 0x80, 0x3f, 0xa8, 0x40, 0x3d, 0x38,
+    0x80, 0x1f, 0x86, 0x39, 0x0, 0x3f, 0xf2, 0x20,
+    0x3, 0xd6, 0xc0, 0x1f, 0xf8, 0x6d, 0x40, 0x3f,
+    0xe8, 0x0, 0xf5, 0x20, 0x7, 0xff, 0xe, 0x90,
+    0x3, 0xf8, 0xcc, 0x1, 0xca, 0xa0, 0xf, 0xfe,
+    0x2d, 0x8, 0x7, 0xeb, 0x0, 0xf5, 0x80, 0x7f,
+    0xf1, 0x86, 0x40, 0x3f, 0x20, 0x7, 0x28, 0x80,
+    0x7f, 0xf1, 0xd8, 0x3, 0xf1, 0x80, 0x77, 0x80,
+    0x7f, 0xf2, 0x5, 0x0, 0x3c, 0x40, 0x1e, 0x70,
+    0xf, 0xfe, 0x4e, 0x0, 0x78, 0x40, 0x3c, 0x40,
+    0x1f, 0xfc, 0x92, 0x0, 0xf3, 0x80, 0x70, 0x80,
+    0x7f, 0xf2, 0x84, 0x3, 0xff, 0xbc, 0xe0, 0x1c,
+    0x20, 0x1f, 0xfc, 0xa1, 0x0, 0xf0, 0x80, 0x78,
+    0x80, 0x3f, 0xf9, 0x24, 0x1, 0xe2, 0x0, 0xf3,
+    0x80, 0x7f, 0xf2, 0x70, 0x3, 0xe3, 0x0, 0xef,
+    0x0, 0xff, 0xe4, 0xa0, 0x7, 0xc8, 0x1, 0xca,
+    0x40, 0x1f, 0xfc, 0x77, 0x0, 0xfd, 0x40, 0x1e,
+    0x80, 0xf, 0xfe, 0x30, 0xc8, 0x7, 0xe2, 0x30,
+    0xe, 0x55, 0x0, 0x7f, 0xf1, 0x68, 0x40, 0x3f,
+    0xa0, 0x3, 0xd4, 0x80, 0x1f, 0xfc, 0x39, 0x40,
+    0xf, 0xf2, 0x28, 0x7, 0xad, 0xc0, 0x3f, 0xf0,
+    0xdb, 0x0, 0x7f, 0xeb, 0x10, 0xf, 0x46, 0x28,
+    0x7, 0xe1, 0x7f, 0x40, 0xf, 0xfe, 0x8, 0xe8,
+    0x7, 0xc7, 0x5d, 0x4e, 0xca, 0xd1, 0x7d, 0x2,
+    0x1, 0x84, 0x3, 0xfc, 0x76, 0x1, 0xf8, 0x56,
+    0x26, 0xa5, 0xd0, 0x3, 0xc7, 0x60, 0x1f, 0xf2,
+    0x69, 0x0, 0x7f, 0xf1, 0xd3, 0x0, 0x3f, 0xf8,
+    0x25, 0xae, 0x1, 0xff, 0xc5, 0x8b, 0x0, 0xff,
+    0xe2, 0x47, 0x30, 0x80, 0x7f, 0xe6, 0xe7, 0x0,
+    0xff, 0xe3, 0xc, 0xf5, 0xba, 0x10, 0x80, 0x4,
+    0xda, 0xbe, 0x44, 0x3, 0xff, 0x94, 0x91, 0x7b,
+    0xdf, 0xee, 0xc9, 0x50, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xf5, 0x80,
 
     /* U+0072 "r" */
-    0x2f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3, 0x8b,
-    0xde, 0xf0, 0x2f, 0xff, 0xff, 0xb0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xf1, 0x2f, 0xff, 0xff, 0xb0,
-    0x4, 0xef, 0xff, 0xff, 0xff, 0xf1, 0x2f, 0xff,
-    0xff, 0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x2f, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x2f, 0xff, 0xff, 0xce, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xd0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x30, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0xb0, 0xf, 0x1c, 0x5e, 0xf7, 0x80,
+    0x7f, 0xe7, 0xec, 0x74, 0x21, 0x1, 0x0, 0xfe,
+    0x4e, 0x81, 0x0, 0xff, 0xe1, 0xb5, 0x88, 0x7,
+    0xff, 0x11, 0x24, 0x3, 0xff, 0x8a, 0xf4, 0x1,
+    0xfc, 0x44, 0x10, 0xf, 0x18, 0x80, 0x61, 0x7c,
+    0xff, 0x6e, 0x80, 0x3f, 0xf4, 0x74, 0x18, 0x7,
+    0xff, 0x8, 0x71, 0xc0, 0x3f, 0xf8, 0xb4, 0x60,
+    0x1f, 0xfc, 0x56, 0x40, 0xf, 0xfe, 0x34, 0x0,
+    0x7f, 0xf1, 0x94, 0x40, 0x3f, 0xf8, 0xd8, 0x1,
+    0xff, 0xc7, 0x50, 0xf, 0xfe, 0x39, 0x0, 0x7f,
+    0xf1, 0xc4, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfd, 0x0,
 
     /* U+0073 "s" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x69, 0xcd, 0xef,
-    0xfe, 0xdb, 0x85, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x94, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xfb, 0x75, 0x43, 0x45, 0x69, 0xcf, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6c, 0xff, 0x30,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xb5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xa6, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xea, 0x73, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xea, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x47, 0x9c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x5a, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2, 0x0,
-    0x17, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0, 0x8f,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xd0, 0x1, 0xff, 0xff,
-    0xe9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xc8, 0x75, 0x44, 0x56, 0x8c, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x58, 0xbd, 0xef, 0xff, 0xed,
-    0xb8, 0x51, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x26, 0x9c, 0xde, 0xff, 0x76, 0xdc,
+    0x29, 0x0, 0x7f, 0xf0, 0x9b, 0x36, 0x58, 0xc8,
+    0x40, 0x2, 0x48, 0xf5, 0xbd, 0x28, 0x1, 0xfc,
+    0x9b, 0x26, 0x1, 0xff, 0xc2, 0x16, 0xbd, 0x40,
+    0xf, 0x35, 0x90, 0x7, 0xff, 0x1c, 0xa4, 0x3,
+    0x9a, 0x40, 0x3f, 0xf9, 0x50, 0x1, 0x8a, 0x40,
+    0x3e, 0x48, 0xab, 0xcb, 0xa9, 0x63, 0x0, 0xe3,
+    0x50, 0xd, 0x0, 0x1e, 0x5e, 0xb7, 0x54, 0x34,
+    0x56, 0x9c, 0xe9, 0x30, 0x7, 0x80, 0x72, 0x80,
+    0x73, 0x50, 0x80, 0x7f, 0x85, 0xb2, 0xdc, 0xc0,
+    0x31, 0x80, 0x70, 0xc8, 0x7, 0xff, 0xd, 0x20,
+    0x3, 0x98, 0x3, 0x94, 0x3, 0xff, 0xa2, 0xe0,
+    0x1f, 0xfc, 0xb1, 0x0, 0xe3, 0x20, 0xf, 0xfe,
+    0x52, 0x80, 0x7b, 0xc, 0x3, 0xff, 0x92, 0x28,
+    0x1, 0xc3, 0x96, 0xa2, 0x1, 0xff, 0xc7, 0x80,
+    0xf, 0x92, 0xbb, 0x69, 0x8c, 0x40, 0x3f, 0xf8,
+    0x47, 0x20, 0x1f, 0xc4, 0xb3, 0x9d, 0xca, 0x73,
+    0x0, 0xff, 0x9a, 0x80, 0x3f, 0xf8, 0x22, 0xb1,
+    0x9d, 0x46, 0x1, 0xfc, 0xbc, 0xc0, 0x1f, 0xfc,
+    0x31, 0x5c, 0xa1, 0x0, 0xfc, 0x33, 0xf4, 0xa4,
+    0x1, 0xff, 0xc2, 0x5c, 0x20, 0xf, 0xf2, 0xd6,
+    0xf5, 0xc3, 0x18, 0x7, 0xf8, 0xbc, 0x3, 0xff,
+    0x82, 0x28, 0xf3, 0x9f, 0xb4, 0xa0, 0x1f, 0x13,
+    0x80, 0x7f, 0xf1, 0x89, 0x6b, 0xdc, 0x3, 0xd4,
+    0x1, 0xff, 0xca, 0x88, 0x0, 0x71, 0x8, 0x7,
+    0xff, 0x29, 0xc0, 0x3c, 0x60, 0x1f, 0xfd, 0x41,
+    0x70, 0xf, 0xfe, 0x31, 0x0, 0x78, 0x80, 0x13,
+    0x1a, 0xa0, 0x1f, 0xfc, 0x49, 0x0, 0xe2, 0x0,
+    0xb, 0x81, 0x57, 0x49, 0x80, 0x7f, 0xc5, 0x68,
+    0x1, 0xd4, 0x0, 0xb0, 0xc, 0x2d, 0x9f, 0x90,
+    0xea, 0x88, 0x56, 0x8c, 0xd4, 0x0, 0xe1, 0x60,
+    0x25, 0x0, 0xfc, 0x6f, 0x15, 0x76, 0xa9, 0x73,
+    0x0, 0xfa, 0x84, 0xd, 0x0, 0x3f, 0xf9, 0x96,
+    0x80, 0x1, 0xbb, 0x18, 0x7, 0xff, 0x20, 0xf5,
+    0x0, 0x39, 0x33, 0xe, 0x40, 0x1f, 0xfc, 0x34,
+    0xbc, 0x20, 0xf, 0xc7, 0x1b, 0xaa, 0x74, 0x21,
+    0x0, 0x84, 0x91, 0xeb, 0xad, 0x0, 0x3c,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0x0, 0x28, 0x88, 0x88, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x6, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xfb, 0x53, 0x24, 0x7d, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7b,
-    0xde, 0xfe, 0xda, 0x61, 0x0,
+    0x0, 0xf1, 0x44, 0x73, 0x0, 0x7f, 0xf1, 0x99,
+    0xdf, 0xac, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xe0, 0xff, 0xf5, 0x80, 0x71, 0x7f,
+    0xff, 0x48, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xa1,
+    0xff, 0xd6, 0x1, 0xc5, 0xff, 0xfd, 0x20, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xfa, 0x18, 0x7, 0xff, 0x19, 0xc0, 0x38, 0x40,
+    0x3f, 0xf8, 0xc2, 0x1, 0xe3, 0x0, 0xff, 0xe2,
+    0x90, 0x7, 0xa8, 0x3, 0xff, 0x8c, 0x80, 0x1c,
+    0xcc, 0x0, 0xf9, 0x84, 0x3, 0xf7, 0x0, 0x7a,
+    0x6d, 0x4c, 0x91, 0xf6, 0x64, 0x1, 0xf9, 0x48,
+    0x3, 0xc9, 0x59, 0xb7, 0x4, 0xc, 0x1, 0xfd,
+    0xe0, 0x1f, 0xfc, 0x21, 0x60, 0xf, 0xc5, 0x82,
+    0x1, 0xff, 0xc1, 0xd0, 0xf, 0xe3, 0xf5, 0x0,
+    0xff, 0x9a, 0xc0, 0x3f, 0xc3, 0x5b, 0x8, 0x42,
+    0x2, 0x4b, 0x3d, 0x20,
 
     /* U+0075 "u" */
-    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x78, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf7, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x78, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf7, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x78, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x78, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x78, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x78, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf7, 0x8f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x78, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf7, 0x8f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x78,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf7,
-    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x78, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf7, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x77, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x75, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf7, 0x4f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x71, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf7, 0xd, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0x70, 0x9f, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xf7, 0x2, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x70, 0xa, 0xff,
-    0xff, 0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xea, 0x87, 0x89, 0xbf,
-    0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0x70, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x6f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x6, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x20, 0x0, 0x6f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x36, 0xad, 0xef,
-    0xfe, 0xda, 0x61, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf7,
+    0x8f, 0xfe, 0xa0, 0xf, 0xfe, 0x3d, 0xff, 0xf3,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xf9, 0x38, 0x7, 0xbc, 0x3, 0x84, 0x3, 0xff,
+    0x8e, 0x20, 0x1e, 0x10, 0xe, 0x70, 0xf, 0xfe,
+    0x39, 0x0, 0x78, 0xc0, 0x38, 0x80, 0x3f, 0xf8,
+    0xc8, 0x1, 0xf0, 0x80, 0x70, 0x90, 0x7, 0xff,
+    0x17, 0x40, 0x3e, 0x50, 0xf, 0x28, 0x7, 0xff,
+    0x10, 0x58, 0x3, 0xe1, 0x20, 0xe, 0x90, 0xf,
+    0xfe, 0x25, 0x80, 0x7f, 0x20, 0x7, 0xc, 0x80,
+    0x7f, 0xf0, 0x9d, 0x40, 0x3f, 0xac, 0x3, 0xcd,
+    0x0, 0x1f, 0xfa, 0x60, 0x3, 0xfc, 0x4a, 0x1,
+    0xe7, 0xc4, 0x0, 0xfc, 0xba, 0xc0, 0x1f, 0xfa,
+    0x4, 0x3, 0xc7, 0x7d, 0x50, 0xf1, 0x37, 0xf4,
+    0x40, 0x18, 0x40, 0x3f, 0x15, 0x0, 0x7e, 0x15,
+    0x78, 0x76, 0x40, 0xf, 0x1c, 0x0, 0x7f, 0x25,
+    0x0, 0x7f, 0xf1, 0xcf, 0x40, 0x3f, 0xe5, 0xd2,
+    0x0, 0xff, 0xe2, 0x3e, 0x8, 0x7, 0xfe, 0x2d,
+    0xa2, 0x0, 0xff, 0xcb, 0xb0, 0x1, 0xff, 0xc4,
+    0x5d, 0xc9, 0x52, 0x10, 0x0, 0x92, 0xcf, 0x51,
+    0x0, 0x7f, 0x80,
 
     /* U+0076 "v" */
-    0xe, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x90, 0x7f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf3, 0x1, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfc, 0x0,
-    0x9, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x50, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x2, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0,
-    0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x40, 0x6, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfb, 0x0, 0xdf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x9b, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xe7, 0x0, 0xff, 0xe5, 0x37, 0xff,
+    0x48, 0x48, 0x7, 0x48, 0x7, 0xff, 0x2a, 0xc0,
+    0x3a, 0x81, 0x80, 0x38, 0x54, 0x3, 0xff, 0x90,
+    0x84, 0x1, 0x8c, 0xc0, 0x2c, 0x1, 0xd2, 0x1,
+    0xff, 0xc8, 0xf0, 0xe, 0x90, 0xa, 0xc0, 0x38,
+    0xcc, 0x1, 0xff, 0xc6, 0x24, 0x0, 0xc4, 0xa0,
+    0x11, 0x20, 0x7, 0x50, 0x7, 0xff, 0x1a, 0xc0,
+    0x3a, 0x80, 0x3b, 0xc0, 0x39, 0x84, 0x3, 0xff,
+    0x8a, 0xc0, 0x1c, 0xe0, 0x1c, 0x84, 0x1, 0xcc,
+    0x1, 0xff, 0xc4, 0x70, 0xe, 0x60, 0xf, 0xac,
+    0x3, 0xa4, 0x3, 0xff, 0x89, 0x40, 0x1d, 0x60,
+    0x1f, 0x30, 0x80, 0x61, 0x50, 0xf, 0xfe, 0x12,
+    0x90, 0x6, 0x42, 0x0, 0xfc, 0xc0, 0x1d, 0x20,
+    0x1f, 0xfc, 0x29, 0x0, 0xef, 0x0, 0xfe, 0x90,
+    0xe, 0x32, 0x0, 0xff, 0xc6, 0x60, 0xc, 0x48,
+    0x1, 0xfc, 0x2a, 0x1, 0xd6, 0x1, 0xff, 0xa4,
+    0x3, 0xac, 0x3, 0xfe, 0x90, 0xe, 0x61, 0x0,
+    0xff, 0xa, 0x80, 0x61, 0x60, 0xf, 0xf8, 0xcc,
+    0x1, 0xcc, 0x1, 0xfe, 0x90, 0xe, 0x60, 0xf,
+    0xfe, 0xc, 0x80, 0x74, 0x80, 0x7f, 0x98, 0x3,
+    0xa4, 0x3, 0xff, 0x82, 0xa2, 0x1, 0x85, 0x40,
+    0x3f, 0x30, 0x80, 0x65, 0x10, 0xf, 0xfe, 0x14,
+    0x80, 0x77, 0x0, 0x7e, 0xb0, 0xe, 0x90, 0xf,
+    0xfe, 0x1b, 0x0, 0x72, 0x10, 0x7, 0x90, 0x80,
+    0x31, 0x98, 0x3, 0xff, 0x86, 0x2c, 0x1, 0xd6,
+    0x1, 0xef, 0x0, 0xe9, 0x0, 0xff, 0xe2, 0xd8,
+    0x7, 0x30, 0x80, 0x62, 0x40, 0xc, 0x4a, 0x1,
+    0xff, 0xc5, 0x24, 0x0, 0xe6, 0x0, 0xd6, 0x1,
+    0xd4, 0x1, 0xff, 0xc7, 0xf0, 0xe, 0xa0, 0xc,
+    0xc0, 0x1c, 0xe0, 0x1f, 0xfc, 0x74, 0x20, 0xc,
+    0x48, 0x0, 0x60, 0xe, 0x60, 0xf, 0xfe, 0x4d,
+    0x80, 0x77, 0x80, 0x2c, 0x3, 0xac, 0x3, 0xff,
+    0x92, 0xc0, 0x1c, 0x84, 0x84, 0x1, 0x90, 0x80,
+    0x3f, 0xf9, 0x4e, 0x1, 0xd7, 0xe0, 0x1d, 0xe0,
+    0x1f, 0xfc, 0xba, 0x0, 0xe6, 0x40, 0xc, 0x48,
+    0x1, 0xff, 0xcb, 0x25, 0x0, 0xff, 0x58, 0x7,
+    0xff, 0x36, 0x40, 0x3f, 0x85, 0x80, 0x3f, 0xf9,
+    0xa6, 0x60, 0xf, 0xcc, 0x1, 0xff, 0xcf, 0xa0,
+    0xf, 0xd2, 0x1, 0xff, 0xcf, 0x61, 0x0, 0xf2,
+    0x88, 0x7, 0xff, 0x41, 0x80, 0x3d, 0x20, 0x1f,
+    0xfc, 0x20,
 
     /* U+0077 "w" */
-    0x6f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0x90, 0xa, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x30, 0x5,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfd, 0x0, 0x0, 0xef, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xcf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
-    0x5, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xf8, 0x0, 0xef, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0,
-    0x3f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x60, 0x0, 0xd, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf9, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x0, 0x0, 0xdf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf6, 0x0, 0x5, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x60, 0x3, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfc, 0x0, 0xb, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xc0, 0x9, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x20,
-    0x1f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf2,
-    0xe, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xe0, 0xdf, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfd, 0xbf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x6f, 0xfe, 0x60, 0xf, 0xfe, 0x3f, 0x7f, 0xea,
+    0x0, 0xff, 0xe3, 0xc7, 0xfe, 0xe0, 0x70, 0xe,
+    0xd0, 0xf, 0xfe, 0x32, 0x8, 0x6, 0x51, 0x0,
+    0xff, 0xe3, 0x30, 0x6, 0x70, 0x15, 0x0, 0xc8,
+    0x20, 0x1f, 0xfc, 0x5e, 0x0, 0xf3, 0x80, 0x7f,
+    0xf1, 0x50, 0x40, 0x35, 0x0, 0x3c, 0x3, 0x98,
+    0x3, 0xff, 0x8a, 0xa0, 0x1e, 0xa0, 0xf, 0xfe,
+    0x2f, 0x0, 0x62, 0x30, 0x2, 0x88, 0x6, 0xa0,
+    0xf, 0xfe, 0x23, 0x0, 0x7c, 0x64, 0x1, 0xff,
+    0xc3, 0x15, 0x0, 0xd4, 0x1, 0x9c, 0x3, 0x11,
+    0x80, 0x7f, 0xf0, 0xe8, 0x3, 0xf5, 0x0, 0x7f,
+    0xf0, 0xdc, 0x3, 0x98, 0x3, 0x50, 0x7, 0x50,
+    0x7, 0xff, 0x8, 0x8c, 0x3, 0xf3, 0x0, 0x7f,
+    0xf0, 0xe8, 0x3, 0x20, 0x80, 0x63, 0x20, 0xc,
+    0xe0, 0x1f, 0xfc, 0x2a, 0x0, 0xfe, 0x14, 0x0,
+    0xff, 0xe0, 0x91, 0x80, 0x6e, 0x0, 0xf5, 0x0,
+    0x61, 0x40, 0xf, 0xfe, 0xb, 0x0, 0x63, 0x0,
+    0xed, 0x0, 0xff, 0xe0, 0xd0, 0x7, 0x28, 0x7,
+    0x98, 0x3, 0xb8, 0x3, 0xff, 0x20, 0x80, 0x68,
+    0x40, 0xc, 0xc0, 0x1f, 0xfc, 0x16, 0x0, 0xcc,
+    0x1, 0xf0, 0xa0, 0x6, 0x50, 0xf, 0xfd, 0xc0,
+    0x18, 0x53, 0x80, 0x39, 0x40, 0x3f, 0xe4, 0x10,
+    0xd, 0x40, 0x1f, 0xb8, 0x3, 0x98, 0x3, 0xfc,
+    0x2a, 0x1, 0x98, 0x14, 0x40, 0x37, 0x0, 0x7f,
+    0xdc, 0x1, 0x88, 0xc0, 0x3f, 0x28, 0x7, 0x50,
+    0x7, 0xf9, 0xc0, 0x3a, 0x80, 0xe, 0x1, 0x90,
+    0x40, 0x3f, 0xca, 0x1, 0xa8, 0x3, 0xfc, 0xc0,
+    0x18, 0xc4, 0x3, 0xfa, 0x80, 0x31, 0x90, 0x2,
+    0x80, 0x39, 0x80, 0x3f, 0x98, 0x3, 0x94, 0x3,
+    0xfd, 0x40, 0x1c, 0xc0, 0x1f, 0x88, 0xc0, 0x35,
+    0x0, 0x46, 0x40, 0x1a, 0x80, 0x3f, 0xa8, 0x3,
+    0x19, 0x0, 0x7f, 0x8c, 0x80, 0x35, 0x0, 0x7e,
+    0xb0, 0xe, 0x60, 0xd, 0x40, 0x18, 0x8c, 0x3,
+    0xe2, 0x30, 0xd, 0x40, 0x1f, 0xf9, 0x40, 0x31,
+    0x18, 0x7, 0xce, 0x1, 0x98, 0x3, 0x98, 0x3,
+    0xa8, 0x3, 0xe5, 0x0, 0xe6, 0x0, 0xff, 0xd4,
+    0x1, 0xd4, 0x1, 0xe5, 0x10, 0xd, 0x40, 0x1c,
+    0x2a, 0x1, 0x9c, 0x3, 0xea, 0x0, 0xca, 0x1,
+    0xff, 0xc1, 0x23, 0x0, 0xce, 0x1, 0xee, 0x0,
+    0xc4, 0x60, 0x1e, 0xe0, 0xc, 0x2a, 0x1, 0xc6,
+    0x40, 0x1b, 0x80, 0x3f, 0xf8, 0x54, 0x1, 0x85,
+    0x0, 0x30, 0xa0, 0x6, 0xa0, 0xf, 0x90, 0x40,
+    0x37, 0x80, 0x75, 0x0, 0x61, 0x40, 0xf, 0xfe,
+    0x13, 0x0, 0x77, 0x0, 0x66, 0x0, 0xe6, 0x0,
+    0xfc, 0xc0, 0x19, 0x44, 0x3, 0x30, 0x6, 0x60,
+    0xf, 0xfe, 0x22, 0x80, 0x65, 0x0, 0xd4, 0x1,
+    0x94, 0x40, 0x3f, 0x50, 0x7, 0x38, 0x4, 0xa0,
+    0x1d, 0x40, 0x1f, 0xfc, 0x4e, 0x0, 0xe6, 0x0,
+    0x19, 0x0, 0x6e, 0x0, 0xfe, 0x23, 0x0, 0xd4,
+    0x1, 0x70, 0x6, 0x32, 0x0, 0xff, 0xe2, 0x20,
+    0x80, 0x6a, 0x0, 0x50, 0x6, 0x14, 0x0, 0xff,
+    0x50, 0x6, 0x32, 0x1, 0x40, 0xd, 0x40, 0x1f,
+    0xfc, 0x66, 0x0, 0xc6, 0x40, 0xe0, 0x19, 0x80,
+    0x3f, 0xe6, 0x0, 0xea, 0x6, 0x0, 0xe6, 0x0,
+    0xff, 0xe3, 0x50, 0x7, 0x2a, 0x84, 0x3, 0x50,
+    0x7, 0xfe, 0x50, 0xc, 0xc1, 0x40, 0x19, 0x40,
+    0x3f, 0xf8, 0xe4, 0x60, 0x1a, 0xb8, 0x3, 0x19,
+    0x0, 0x7f, 0xee, 0x0, 0xc2, 0xe4, 0x1, 0xb8,
+    0x3, 0xff, 0x91, 0x40, 0x18, 0x90, 0x3, 0x50,
+    0x7, 0xff, 0x5, 0x8, 0x3, 0x40, 0x6, 0x14,
+    0x0, 0xff, 0xe4, 0x38, 0x7, 0xf9, 0x80, 0x3f,
+    0xf8, 0x54, 0x1, 0xfc, 0xc0, 0x1f, 0xfc, 0x91,
+    0x50, 0xf, 0xcc, 0x1, 0xff, 0xc3, 0x60, 0xf,
+    0xea, 0x0, 0xff, 0xe5, 0x78, 0x7, 0xea, 0x0,
+    0xff, 0xe1, 0x8a, 0x0, 0x7c, 0x64, 0x1, 0xff,
+    0xca, 0x51, 0x0, 0xf1, 0x18, 0x7, 0xff, 0x13,
+    0x80, 0x3e, 0xa0, 0xf, 0xfe, 0x63, 0x80, 0x7a,
+    0x80, 0x3f, 0xf8, 0xaa, 0x1, 0xf3, 0x80, 0x7f,
+    0xf3, 0x28, 0x3, 0xcc, 0x1, 0xff, 0xc6, 0x60,
+    0xe, 0x51, 0x0, 0xff, 0xc0,
 
     /* U+0078 "x" */
-    0x2, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf5, 0x0, 0x5, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x60,
-    0x1d, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x3b, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x5e, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x80, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xb0, 0x0, 0x7f, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf7, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xf4, 0x0, 0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xe1,
+    0x2, 0xff, 0xf6, 0x0, 0x7f, 0xf1, 0x57, 0xff,
+    0xca, 0x0, 0x2a, 0x0, 0xe3, 0x80, 0xf, 0xfe,
+    0x19, 0x50, 0x7, 0x32, 0x80, 0x4a, 0xe0, 0x1c,
+    0xe8, 0x1, 0xff, 0xc2, 0xf0, 0xe, 0x39, 0x0,
+    0xe8, 0x30, 0xe, 0xa2, 0x0, 0xff, 0xd4, 0x40,
+    0x18, 0x74, 0x3, 0xed, 0x10, 0xc, 0x3c, 0x1,
+    0xff, 0x32, 0x80, 0x75, 0x8, 0x7, 0xc3, 0x40,
+    0x1c, 0x72, 0x1, 0xfc, 0x52, 0x1, 0xd0, 0x80,
+    0x1f, 0xc9, 0x0, 0x1c, 0xca, 0x1, 0xfb, 0xc0,
+    0x39, 0x1c, 0x3, 0xfe, 0x74, 0x0, 0xea, 0x20,
+    0xf, 0x51, 0x0, 0x61, 0xa0, 0xf, 0xfe, 0xd,
+    0x8, 0x7, 0x78, 0x7, 0x32, 0x80, 0x76, 0x88,
+    0x7, 0xff, 0x4, 0x74, 0x3, 0x8a, 0x80, 0x23,
+    0x90, 0xe, 0x93, 0x0, 0xff, 0xe1, 0x9c, 0x80,
+    0x72, 0xb0, 0xf, 0x0, 0x72, 0xb0, 0x7, 0xff,
+    0x15, 0x94, 0x3, 0xa4, 0xe8, 0x80, 0x31, 0x50,
+    0x7, 0xff, 0x1e, 0x88, 0x3, 0xb1, 0x0, 0x3b,
+    0xc0, 0x3f, 0xf9, 0x3e, 0x1, 0xff, 0x51, 0x0,
+    0x7f, 0xf2, 0x4a, 0x80, 0x3f, 0x9d, 0x40, 0x3f,
+    0xf9, 0x6a, 0xc0, 0x1f, 0x1c, 0x0, 0x7f, 0xf3,
+    0x64, 0x40, 0x3d, 0xc0, 0x1f, 0xfc, 0xe6, 0x10,
+    0xf, 0x58, 0x7, 0xff, 0x34, 0xe4, 0x3, 0xe6,
+    0x60, 0x7, 0xff, 0x2c, 0x74, 0x3, 0xfa, 0x4c,
+    0x3, 0xff, 0x95, 0x42, 0x1, 0xfe, 0xe1, 0x0,
+    0xff, 0xe4, 0x3a, 0x0, 0x75, 0x8, 0x6, 0x2a,
+    0x0, 0xff, 0xe3, 0xa4, 0x0, 0x73, 0xae, 0x80,
+    0x72, 0x38, 0x7, 0xff, 0x14, 0x68, 0x3, 0x92,
+    0x0, 0xe0, 0x3, 0xa1, 0x0, 0x3f, 0xf8, 0x9a,
+    0x20, 0x18, 0x68, 0x2, 0x74, 0x0, 0xea, 0x20,
+    0xf, 0xfe, 0x14, 0x98, 0x7, 0x68, 0x80, 0x6a,
+    0x10, 0xc, 0x3c, 0x1, 0xff, 0xc1, 0x56, 0x0,
+    0xe8, 0x30, 0xe, 0x1d, 0x0, 0xe3, 0x90, 0xf,
+    0xf8, 0xa8, 0x3, 0x91, 0xc0, 0x3e, 0x38, 0x0,
+    0xe6, 0x60, 0x7, 0xfb, 0xc0, 0x38, 0xa8, 0x3,
+    0xf9, 0xd4, 0x3, 0xa4, 0xc0, 0x3f, 0x51, 0x0,
+    0x77, 0x8, 0x7, 0xfa, 0xc8, 0x3, 0xb8, 0x40,
+    0x3c, 0xca, 0x1, 0xd2, 0x60, 0x1f, 0xf0, 0xf0,
+    0x7, 0x15, 0x0, 0x71, 0xc8, 0x7, 0x2b, 0x0,
+    0x7f, 0xf0, 0x4e, 0x40, 0x39, 0x1c, 0x2, 0x1d,
+    0x0, 0xe2, 0xa0, 0xf, 0xfe, 0x1b, 0x28, 0x7,
+    0x42, 0x0, 0x28, 0x40, 0x3b, 0xc0, 0x3f, 0xf8,
+    0xb4, 0x40, 0x1d, 0x42,
 
     /* U+0079 "y" */
-    0x0, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xf9, 0x0, 0x7f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf2, 0x0, 0xf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xb0, 0x0, 0x8, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x7,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf2, 0xe, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf9, 0x5f, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa2,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xb6, 0x43, 0x59, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0xbd, 0xff, 0xed, 0x95, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0x77, 0xff, 0x38, 0x7, 0xff, 0x29, 0xbf,
+    0xfa, 0x40, 0x12, 0x1, 0xd2, 0x1, 0xff, 0xca,
+    0xb0, 0xe, 0xb0, 0x3, 0x80, 0x70, 0xa8, 0x7,
+    0xff, 0x21, 0x8, 0x3, 0x21, 0x0, 0x4e, 0x1,
+    0xd0, 0x1, 0xff, 0xc8, 0xf0, 0xe, 0xf0, 0xd,
+    0x20, 0x1c, 0x48, 0x1, 0xff, 0xc6, 0x24, 0x0,
+    0xc4, 0x80, 0x18, 0x54, 0x3, 0xbc, 0x3, 0xff,
+    0x8d, 0x60, 0x1d, 0x60, 0x1e, 0x90, 0xe, 0x42,
+    0x0, 0xff, 0xe2, 0xb, 0x0, 0x61, 0x60, 0xf,
+    0x19, 0x80, 0x3a, 0xc0, 0x3f, 0xf8, 0x8c, 0x1,
+    0xd2, 0x1, 0xfa, 0x0, 0x39, 0x84, 0x3, 0xff,
+    0x87, 0x20, 0x1c, 0xc0, 0x1f, 0x90, 0x80, 0x39,
+    0x80, 0x3f, 0xf8, 0x4a, 0x20, 0x19, 0x84, 0x3,
+    0xfa, 0xc0, 0x3a, 0x40, 0x3f, 0xf8, 0x52, 0x1,
+    0xd6, 0x1, 0xfe, 0x61, 0x0, 0xc2, 0xa0, 0x1f,
+    0xf8, 0xcc, 0x1, 0x90, 0x80, 0x3f, 0xe6, 0x0,
+    0xe9, 0x0, 0xff, 0xd2, 0x1, 0xd0, 0x1, 0xff,
+    0xa4, 0x3, 0x8d, 0x0, 0x3f, 0xc2, 0xa0, 0x18,
+    0xcc, 0x1, 0xff, 0x85, 0x80, 0x3b, 0xc0, 0x3f,
+    0xd2, 0x1, 0xd2, 0x1, 0xff, 0xc2, 0xb0, 0xe,
+    0x42, 0x0, 0xfe, 0x60, 0xc, 0x2a, 0x1, 0xff,
+    0xc2, 0x24, 0x0, 0xeb, 0x0, 0xfc, 0xc2, 0x1,
+    0xa4, 0x3, 0xff, 0x89, 0xe0, 0x1c, 0xc2, 0x1,
+    0xf5, 0x80, 0x73, 0x80, 0x7f, 0xf1, 0x10, 0xc0,
+    0x39, 0x80, 0x3c, 0x84, 0x1, 0x9c, 0x3, 0xff,
+    0x8d, 0x20, 0x1d, 0x20, 0x1e, 0xf0, 0xe, 0x90,
+    0xf, 0xfe, 0x32, 0x88, 0x6, 0x15, 0x0, 0xc4,
+    0x80, 0x19, 0x44, 0x3, 0xff, 0x8f, 0x20, 0x1d,
+    0x20, 0x1a, 0xc0, 0x3a, 0x40, 0x3f, 0xf9, 0xe,
+    0x1, 0xc6, 0x80, 0x1, 0x60, 0xc, 0x66, 0x0,
+    0xff, 0xe4, 0xb0, 0x7, 0x78, 0x1, 0x80, 0x3a,
+    0x40, 0x3f, 0xf9, 0x56, 0x1, 0xc8, 0x41, 0x20,
+    0x18, 0x94, 0x3, 0xff, 0x94, 0x4a, 0x1, 0xd6,
+    0xa2, 0x1, 0xac, 0x3, 0xff, 0x99, 0x20, 0x1c,
+    0xd0, 0x1, 0x85, 0x80, 0x3f, 0xf9, 0x86, 0x60,
+    0xe, 0x20, 0xc, 0xc0, 0x1f, 0xfc, 0xe9, 0x0,
+    0xff, 0x48, 0x7, 0xff, 0x39, 0x48, 0x3, 0xf2,
+    0x88, 0x7, 0xff, 0x3e, 0xc0, 0x3f, 0x40, 0x7,
+    0xff, 0x41, 0x84, 0x3, 0xc8, 0x40, 0x1f, 0xfd,
+    0x16, 0x0, 0xf7, 0x80, 0x7f, 0xf4, 0xb0, 0x3,
+    0x89, 0x0, 0x3f, 0xfa, 0x5e, 0x1, 0xd6, 0x1,
+    0xff, 0xd2, 0x24, 0x0, 0xc2, 0xc0, 0x1f, 0xfd,
+    0x28, 0x0, 0xe9, 0x0, 0xff, 0xe9, 0x1a, 0x80,
+    0x73, 0x0, 0x7f, 0xf1, 0xd8, 0x3, 0xfd, 0xc0,
+    0x1c, 0xe2, 0x1, 0xff, 0xc6, 0x79, 0xa2, 0x0,
+    0xf0, 0xe1, 0x0, 0x61, 0x90, 0xf, 0xfe, 0x30,
+    0xc0, 0x2e, 0xdb, 0x21, 0xac, 0xf1, 0x80, 0x74,
+    0x8, 0x7, 0xff, 0x1a, 0x0, 0x32, 0x4d, 0xe5,
+    0x30, 0x7, 0x95, 0x80, 0x3f, 0xf8, 0xc4, 0xc0,
+    0x1f, 0xfc, 0x33, 0xa0, 0xf, 0xfe, 0x39, 0x30,
+    0x7, 0xff, 0x9, 0x30, 0x3, 0xff, 0x93, 0x36,
+    0x60, 0x1f, 0xe1, 0x9b, 0x0, 0xff, 0xe5, 0xa6,
+    0x62, 0x10, 0x80, 0x2, 0x4d, 0x5c, 0xc0, 0x1f,
+    0xfc, 0xa0,
 
     /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x71, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xff, 0xfe, 0x7b, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfb, 0x62, 0xa3, 0xff, 0xff, 0xc7, 0x30,
+    0xf, 0x51, 0x0, 0x7f, 0xf1, 0xe4, 0xc0, 0x3a,
+    0x10, 0x3, 0xff, 0x8e, 0xcc, 0x0, 0xe5, 0x70,
+    0xf, 0xfe, 0x39, 0xc8, 0x7, 0x15, 0x0, 0x7f,
+    0xf1, 0xc7, 0x40, 0x38, 0x7c, 0x3, 0xff, 0x91,
+    0xa2, 0x1, 0xd4, 0x40, 0x1f, 0xfc, 0x79, 0x30,
+    0xe, 0x84, 0x0, 0xff, 0xe3, 0xb3, 0x0, 0x39,
+    0x5c, 0x3, 0xff, 0x8e, 0x72, 0x1, 0xc7, 0x40,
+    0x1f, 0xfc, 0x71, 0xd0, 0xe, 0x1e, 0x0, 0xff,
+    0xe4, 0x68, 0x80, 0x75, 0x10, 0x7, 0xff, 0x1e,
+    0x4c, 0x3, 0xa1, 0x0, 0x3f, 0xf8, 0xec, 0xc0,
+    0xe, 0x57, 0x0, 0xff, 0xe3, 0x9c, 0x80, 0x71,
+    0xd0, 0x7, 0xff, 0x1c, 0x74, 0x3, 0x87, 0x40,
+    0x3f, 0xf9, 0x1a, 0x20, 0x1d, 0x42, 0x1, 0xff,
+    0xc7, 0x93, 0x0, 0xe9, 0x40, 0xf, 0xfe, 0x3b,
+    0x30, 0x3, 0x95, 0x80, 0x3f, 0xf8, 0xe7, 0x20,
+    0x1c, 0x74, 0x1, 0xff, 0xc7, 0x1d, 0x0, 0xe1,
+    0xd0, 0xf, 0xfe, 0x46, 0x88, 0x7, 0x68, 0x80,
+    0x7f, 0xf1, 0xe4, 0xc0, 0x3a, 0x4c, 0x3, 0xff,
+    0x8e, 0xcc, 0x0, 0xe5, 0x60, 0xf, 0xfe, 0x39,
+    0xc8, 0x7, 0x1d, 0x0, 0x7f, 0xf1, 0xc7, 0x40,
+    0x3c, 0x7f, 0xff, 0xfc, 0x87, 0x10, 0xf, 0xfe,
+    0x78, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xe0,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfd,
-    0x51, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x11, 0x28, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfd,
-    0x51, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xdf,
-    0xff, 0xf4,
+    0x0, 0xff, 0xe8, 0x8b, 0xdf, 0x7f, 0xe4, 0x0,
+    0xfe, 0x9e, 0x84, 0x10, 0xf, 0xfc, 0x3a, 0xc0,
+    0x1f, 0xfc, 0x4a, 0x20, 0xf, 0xfe, 0x22, 0x20,
+    0x3, 0xff, 0x8b, 0xc0, 0x1e, 0x2a, 0xef, 0xf2,
+    0x0, 0x79, 0x0, 0x38, 0xb5, 0x44, 0x3, 0xf0,
+    0x88, 0x3, 0xa0, 0x3, 0xfe, 0x30, 0xf, 0x28,
+    0x7, 0xfc, 0x20, 0x1c, 0x20, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xd2, 0xc0, 0x1c, 0x60, 0x1f, 0xfb, 0x0, 0x38,
+    0x40, 0x3f, 0x8, 0x8a, 0x18, 0x3, 0x90, 0x3,
+    0xe5, 0xee, 0x6b, 0x80, 0x7a, 0x80, 0x3f, 0xf8,
+    0x83, 0x64, 0x1, 0xff, 0xc3, 0x2c, 0x40, 0xf,
+    0xfe, 0x21, 0x6a, 0x80, 0x7f, 0xf1, 0xa8, 0x80,
+    0x3e, 0x5f, 0xf7, 0x48, 0x7, 0xa8, 0x3, 0xfc,
+    0x2c, 0xc0, 0xe, 0x40, 0xf, 0xfd, 0x80, 0x1c,
+    0x20, 0x1f, 0xf9, 0x80, 0x38, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xa4, 0x40, 0x38, 0x40, 0x3f, 0xf1, 0x80,
+    0x79, 0x40, 0x3f, 0xe1, 0x10, 0x7, 0x40, 0x80,
+    0x7f, 0xc8, 0x1, 0xc5, 0x8a, 0x20, 0x1f, 0xdc,
+    0x1, 0xe2, 0xae, 0xff, 0x20, 0x7, 0x91, 0x0,
+    0x1f, 0xfc, 0x6a, 0x20, 0xf, 0xfe, 0x28, 0xeb,
+    0x0, 0x7f, 0xf1, 0xa7, 0xa1, 0x8, 0x3, 0x80,
 
     /* U+007C "|" */
-    0x28, 0x88, 0x88, 0x34, 0xff, 0xff, 0xf6, 0x4f,
-    0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff,
-    0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64,
-    0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f,
-    0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff,
-    0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64,
-    0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f,
-    0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff,
-    0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64,
-    0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff, 0xff,
-    0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf6,
-    0x4f, 0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f,
-    0xff, 0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff,
-    0xff, 0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff,
-    0x64, 0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64,
-    0xff, 0xff, 0xf6, 0x4f, 0xff, 0xff, 0x64, 0xff,
-    0xff, 0xf6,
+    0x28, 0x8e, 0x36, 0x77, 0xe5, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x4c,
 
     /* U+007D "}" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xfd, 0x41, 0x10, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x13,
-    0x9f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x67, 0xfd, 0xd9, 0x28, 0x1,
+    0xff, 0xc2, 0x13, 0x6b, 0xd4, 0x0, 0xff, 0xe2,
+    0x15, 0xb0, 0x7, 0xff, 0x16, 0x4c, 0x3, 0xff,
+    0x8b, 0xe0, 0x1e, 0xcf, 0xf6, 0x30, 0x7, 0x8c,
+    0xc0, 0x1f, 0x8e, 0x64, 0x1, 0xe4, 0x0, 0xff,
+    0x31, 0x0, 0x76, 0x80, 0x7f, 0xca, 0x1, 0xc2,
+    0x1, 0xff, 0x70, 0x7, 0x38, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff,
+    0xed, 0x18, 0x7, 0x8, 0x7, 0xfc, 0x20, 0x1c,
+    0x44, 0x0, 0xff, 0x28, 0x7, 0xbd, 0x4, 0x40,
+    0x1f, 0xb, 0x0, 0x71, 0x5f, 0x73, 0x0, 0x3e,
+    0x94, 0x0, 0xff, 0xe2, 0xdb, 0x80, 0x7f, 0xf0,
+    0xc7, 0x1c, 0x3, 0xff, 0x87, 0x66, 0x1, 0xff,
+    0xc3, 0x15, 0x0, 0xe3, 0xcf, 0xf6, 0x0, 0x79,
+    0x40, 0x3d, 0xa6, 0x1, 0xfc, 0x20, 0x1c, 0x42,
+    0x1, 0xfe, 0x30, 0xe, 0x10, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xda, 0xe0, 0xe, 0x70, 0xf, 0xf9, 0x40, 0x38,
+    0x40, 0x3f, 0xcc, 0x40, 0x1d, 0xa0, 0x1f, 0x9,
+    0xcc, 0x80, 0x3c, 0x80, 0x1d, 0x9f, 0xd8, 0xc0,
+    0x1e, 0x33, 0x0, 0x7f, 0xf1, 0x3c, 0x3, 0xff,
+    0x89, 0x26, 0x1, 0xff, 0xc2, 0x2b, 0x60, 0xf,
+    0xf8, 0x4d, 0xaf, 0x50, 0x3, 0xf0,
 
     /* U+007E "~" */
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0x99, 0x40,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf7, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x50, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf3, 0x1, 0xff,
-    0xff, 0xff, 0xcb, 0xef, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0x0, 0x6f, 0xff,
-    0xfc, 0x20, 0x0, 0x5e, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x9, 0xff, 0xff, 0xa0, 0xb, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xec,
-    0xcf, 0xff, 0xff, 0xf4, 0x0, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x1f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x3, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x29, 0x99, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0xa4,
-    0x0, 0x0, 0x0,
+    0x0, 0xe2, 0x8d, 0xff, 0x6d, 0x20, 0x7, 0xff,
+    0x5, 0x66, 0x64, 0x0, 0xd3, 0xae, 0x40, 0x2,
+    0x5b, 0xd3, 0x0, 0xff, 0xb1, 0x9a, 0x30, 0xa,
+    0x98, 0x3, 0xf1, 0x63, 0x80, 0x7f, 0x90, 0x2,
+    0x20, 0x3, 0xa8, 0x7, 0xfd, 0x14, 0x1, 0xf8,
+    0x88, 0x1, 0x30, 0xc, 0x0, 0x71, 0xa0, 0x80,
+    0x72, 0xe9, 0x0, 0x7a, 0x40, 0x31, 0x83, 0x80,
+    0x63, 0xdc, 0xbe, 0xa1, 0x0, 0xc5, 0xac, 0x1,
+    0xa5, 0x0, 0x25, 0x0, 0x68, 0x4, 0x3a, 0x40,
+    0x12, 0xfa, 0x0, 0x74, 0xf6, 0x63, 0xd8, 0x3,
+    0x70, 0x1, 0x0, 0x28, 0x10, 0xe, 0x1b, 0x70,
+    0xe, 0x13, 0x30, 0x7, 0x2a, 0x0, 0x80, 0x67,
+    0x0, 0xfd, 0x16, 0x20, 0x1f, 0xe2, 0xb0, 0x1,
+    0x0, 0x44, 0x20, 0x1f, 0xc9, 0xea, 0x1, 0xf9,
+    0x30, 0x40, 0x2, 0xcd, 0x58, 0x7, 0xfc, 0x35,
+    0x8c, 0x40, 0x2, 0x5b, 0xb0, 0x80, 0x40,
 
     /* U+00B0 "°" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x55, 0x42, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xff, 0xff, 0xe9, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x94, 0x10, 0x15, 0xbf, 0xff, 0xfa, 0x0, 0x0,
-    0x9f, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0x60, 0x2, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe0, 0x8, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
-    0xd, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0xf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x1f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfe, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfe, 0xf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc, 0xc,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf9, 0x6, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xc0,
-    0x0, 0x4f, 0xff, 0xf8, 0x10, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0x20, 0x0, 0x7, 0xff, 0xff, 0xfa,
-    0x87, 0x8c, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x9d, 0xff, 0xec, 0x83, 0x0, 0x0, 0x0
+    0x0, 0xfe, 0x35, 0x52, 0x10, 0x7, 0xff, 0x8,
+    0xeb, 0xf2, 0xa9, 0x7b, 0xd2, 0x20, 0x1f, 0xe9,
+    0xc5, 0x0, 0xf0, 0xb7, 0x38, 0x7, 0xc3, 0x8c,
+    0x1, 0xff, 0x45, 0x80, 0x7b, 0x4c, 0x2, 0x6b,
+    0xef, 0xea, 0x40, 0x9, 0x28, 0x3, 0x49, 0x80,
+    0xb, 0x65, 0x4, 0x5, 0x6e, 0x80, 0x25, 0x60,
+    0x1, 0x30, 0x0, 0x70, 0x80, 0x3e, 0x5b, 0x0,
+    0xa0, 0x1, 0x40, 0x15, 0x8, 0x7, 0xf2, 0x30,
+    0x0, 0x54, 0x14, 0x0, 0x48, 0x1, 0xff, 0x40,
+    0x5, 0xe0, 0x40, 0x4, 0x0, 0xff, 0xc2, 0x40,
+    0x7, 0x10, 0xb, 0x80, 0x3f, 0xf8, 0x22, 0x0,
+    0x30, 0xd, 0xe0, 0x1f, 0xfc, 0x51, 0x0, 0x88,
+    0x3, 0xff, 0x82, 0x40, 0x2, 0x3, 0x0, 0x28,
+    0x7, 0xfe, 0x41, 0x0, 0x28, 0x50, 0x5, 0x0,
+    0x1f, 0xf4, 0x0, 0x54, 0xc, 0x20, 0x7, 0x50,
+    0xf, 0xea, 0x30, 0x1, 0x98, 0x1, 0x40, 0x15,
+    0x40, 0x80, 0x71, 0x5a, 0x80, 0x5c, 0x1, 0x24,
+    0x0, 0x4f, 0xd5, 0xf, 0x19, 0xa8, 0x1, 0x51,
+    0x0, 0x67, 0x80, 0xc, 0xaf, 0xe, 0x60, 0x1a,
+    0x94, 0x3, 0xcf, 0x84, 0x1, 0xfc, 0x9a, 0xa0,
+    0x1f, 0x8f, 0x6d, 0x88, 0x0, 0x26, 0xf9, 0x64,
+    0x1, 0x80
 };
 
 
@@ -8246,100 +3423,100 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 275, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 274, .box_w = 9, .box_h = 45, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 203, .adv_w = 400, .box_w = 17, .box_h = 18, .ofs_x = 4, .ofs_y = 27},
-    {.bitmap_index = 356, .adv_w = 720, .box_w = 43, .box_h = 45, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1324, .adv_w = 636, .box_w = 36, .box_h = 61, .ofs_x = 2, .ofs_y = -8},
-    {.bitmap_index = 2422, .adv_w = 863, .box_w = 50, .box_h = 46, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3572, .adv_w = 702, .box_w = 41, .box_h = 47, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 4536, .adv_w = 215, .box_w = 6, .box_h = 18, .ofs_x = 4, .ofs_y = 27},
-    {.bitmap_index = 4590, .adv_w = 345, .box_w = 14, .box_h = 60, .ofs_x = 6, .ofs_y = -12},
-    {.bitmap_index = 5010, .adv_w = 346, .box_w = 14, .box_h = 60, .ofs_x = 2, .ofs_y = -12},
-    {.bitmap_index = 5430, .adv_w = 410, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 23},
-    {.bitmap_index = 5718, .adv_w = 596, .box_w = 29, .box_h = 28, .ofs_x = 4, .ofs_y = 8},
-    {.bitmap_index = 6124, .adv_w = 232, .box_w = 9, .box_h = 18, .ofs_x = 3, .ofs_y = -9},
-    {.bitmap_index = 6205, .adv_w = 392, .box_w = 18, .box_h = 6, .ofs_x = 3, .ofs_y = 15},
-    {.bitmap_index = 6259, .adv_w = 232, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6304, .adv_w = 360, .box_w = 27, .box_h = 60, .ofs_x = -2, .ofs_y = -6},
-    {.bitmap_index = 7114, .adv_w = 683, .box_w = 37, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 7984, .adv_w = 379, .box_w = 17, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8367, .adv_w = 588, .box_w = 35, .box_h = 46, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9172, .adv_w = 586, .box_w = 34, .box_h = 46, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9954, .adv_w = 685, .box_w = 41, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10877, .adv_w = 588, .box_w = 34, .box_h = 46, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 11659, .adv_w = 632, .box_w = 35, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 12482, .adv_w = 612, .box_w = 35, .box_h = 45, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13270, .adv_w = 659, .box_w = 37, .box_h = 47, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 14140, .adv_w = 632, .box_w = 36, .box_h = 47, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14986, .adv_w = 232, .box_w = 10, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15156, .adv_w = 232, .box_w = 10, .box_h = 44, .ofs_x = 2, .ofs_y = -10},
-    {.bitmap_index = 15376, .adv_w = 596, .box_w = 29, .box_h = 29, .ofs_x = 4, .ofs_y = 8},
-    {.bitmap_index = 15797, .adv_w = 596, .box_w = 29, .box_h = 21, .ofs_x = 4, .ofs_y = 12},
-    {.bitmap_index = 16102, .adv_w = 596, .box_w = 29, .box_h = 29, .ofs_x = 4, .ofs_y = 8},
-    {.bitmap_index = 16523, .adv_w = 587, .box_w = 33, .box_h = 46, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17282, .adv_w = 1059, .box_w = 61, .box_h = 58, .ofs_x = 3, .ofs_y = -12},
-    {.bitmap_index = 19051, .adv_w = 750, .box_w = 48, .box_h = 45, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 20131, .adv_w = 775, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 21031, .adv_w = 740, .box_w = 41, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 21995, .adv_w = 846, .box_w = 44, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 22985, .adv_w = 686, .box_w = 34, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 23750, .adv_w = 650, .box_w = 33, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 24493, .adv_w = 791, .box_w = 42, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 25480, .adv_w = 831, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 26380, .adv_w = 317, .box_w = 8, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 26560, .adv_w = 525, .box_w = 28, .box_h = 46, .ofs_x = -1, .ofs_y = -1},
-    {.bitmap_index = 27204, .adv_w = 736, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 28104, .adv_w = 608, .box_w = 32, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 28824, .adv_w = 978, .box_w = 49, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 29927, .adv_w = 831, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 30827, .adv_w = 860, .box_w = 48, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 31955, .adv_w = 739, .box_w = 37, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 32788, .adv_w = 860, .box_w = 50, .box_h = 55, .ofs_x = 3, .ofs_y = -9},
-    {.bitmap_index = 34163, .adv_w = 744, .box_w = 38, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 35018, .adv_w = 636, .box_w = 36, .box_h = 47, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 35864, .adv_w = 601, .box_w = 38, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36719, .adv_w = 810, .box_w = 39, .box_h = 46, .ofs_x = 6, .ofs_y = -1},
-    {.bitmap_index = 37616, .adv_w = 729, .box_w = 47, .box_h = 45, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 38674, .adv_w = 1153, .box_w = 69, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40227, .adv_w = 689, .box_w = 43, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 41195, .adv_w = 663, .box_w = 43, .box_h = 45, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 42163, .adv_w = 673, .box_w = 39, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 43041, .adv_w = 341, .box_w = 15, .box_h = 60, .ofs_x = 6, .ofs_y = -12},
-    {.bitmap_index = 43491, .adv_w = 360, .box_w = 28, .box_h = 60, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 44331, .adv_w = 341, .box_w = 14, .box_h = 60, .ofs_x = 1, .ofs_y = -12},
-    {.bitmap_index = 44751, .adv_w = 597, .box_w = 29, .box_h = 27, .ofs_x = 4, .ofs_y = 9},
-    {.bitmap_index = 45143, .adv_w = 512, .box_w = 32, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 45207, .adv_w = 614, .box_w = 17, .box_h = 9, .ofs_x = 7, .ofs_y = 39},
-    {.bitmap_index = 45284, .adv_w = 612, .box_w = 30, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 45794, .adv_w = 698, .box_w = 36, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 46658, .adv_w = 585, .box_w = 33, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 47219, .adv_w = 698, .box_w = 36, .box_h = 48, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 48083, .adv_w = 627, .box_w = 35, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 48678, .adv_w = 361, .box_w = 25, .box_h = 48, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 49278, .adv_w = 707, .box_w = 37, .box_h = 46, .ofs_x = 2, .ofs_y = -12},
-    {.bitmap_index = 50129, .adv_w = 697, .box_w = 34, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 50945, .adv_w = 286, .box_w = 10, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 51185, .adv_w = 291, .box_w = 20, .box_h = 61, .ofs_x = -6, .ofs_y = -12},
-    {.bitmap_index = 51795, .adv_w = 631, .box_w = 35, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 52635, .adv_w = 286, .box_w = 7, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 52803, .adv_w = 1082, .box_w = 58, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 53789, .adv_w = 697, .box_w = 34, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 54367, .adv_w = 650, .box_w = 36, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 54979, .adv_w = 698, .box_w = 36, .box_h = 46, .ofs_x = 5, .ofs_y = -12},
-    {.bitmap_index = 55807, .adv_w = 698, .box_w = 36, .box_h = 46, .ofs_x = 2, .ofs_y = -12},
-    {.bitmap_index = 56635, .adv_w = 420, .box_w = 20, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 56975, .adv_w = 513, .box_w = 30, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 57485, .adv_w = 424, .box_w = 25, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 58010, .adv_w = 693, .box_w = 33, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 58571, .adv_w = 572, .box_w = 37, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 59200, .adv_w = 921, .box_w = 58, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 60186, .adv_w = 565, .box_w = 35, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 60781, .adv_w = 572, .box_w = 38, .box_h = 46, .ofs_x = -2, .ofs_y = -12},
-    {.bitmap_index = 61655, .adv_w = 534, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 62148, .adv_w = 359, .box_w = 19, .box_h = 60, .ofs_x = 3, .ofs_y = -12},
-    {.bitmap_index = 62718, .adv_w = 306, .box_w = 7, .box_h = 60, .ofs_x = 6, .ofs_y = -12},
-    {.bitmap_index = 62928, .adv_w = 359, .box_w = 18, .box_h = 60, .ofs_x = 1, .ofs_y = -12},
-    {.bitmap_index = 63468, .adv_w = 596, .box_w = 31, .box_h = 11, .ofs_x = 3, .ofs_y = 17},
-    {.bitmap_index = 63639, .adv_w = 429, .box_w = 22, .box_h = 21, .ofs_x = 2, .ofs_y = 24}
+    {.bitmap_index = 116, .adv_w = 400, .box_w = 17, .box_h = 18, .ofs_x = 4, .ofs_y = 27},
+    {.bitmap_index = 187, .adv_w = 720, .box_w = 43, .box_h = 45, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 606, .adv_w = 636, .box_w = 36, .box_h = 61, .ofs_x = 2, .ofs_y = -8},
+    {.bitmap_index = 1053, .adv_w = 863, .box_w = 50, .box_h = 46, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1740, .adv_w = 702, .box_w = 41, .box_h = 47, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 2281, .adv_w = 215, .box_w = 6, .box_h = 18, .ofs_x = 4, .ofs_y = 27},
+    {.bitmap_index = 2311, .adv_w = 345, .box_w = 14, .box_h = 60, .ofs_x = 6, .ofs_y = -12},
+    {.bitmap_index = 2562, .adv_w = 346, .box_w = 14, .box_h = 60, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 2813, .adv_w = 410, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = 23},
+    {.bitmap_index = 2975, .adv_w = 596, .box_w = 29, .box_h = 28, .ofs_x = 4, .ofs_y = 8},
+    {.bitmap_index = 3032, .adv_w = 232, .box_w = 9, .box_h = 18, .ofs_x = 3, .ofs_y = -9},
+    {.bitmap_index = 3097, .adv_w = 392, .box_w = 18, .box_h = 6, .ofs_x = 3, .ofs_y = 15},
+    {.bitmap_index = 3109, .adv_w = 232, .box_w = 10, .box_h = 9, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3144, .adv_w = 360, .box_w = 27, .box_h = 60, .ofs_x = -2, .ofs_y = -6},
+    {.bitmap_index = 3497, .adv_w = 683, .box_w = 37, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 3942, .adv_w = 379, .box_w = 17, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3985, .adv_w = 588, .box_w = 35, .box_h = 46, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4322, .adv_w = 586, .box_w = 34, .box_h = 46, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4646, .adv_w = 685, .box_w = 41, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4900, .adv_w = 588, .box_w = 34, .box_h = 46, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5226, .adv_w = 632, .box_w = 35, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 5670, .adv_w = 612, .box_w = 35, .box_h = 45, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5940, .adv_w = 659, .box_w = 37, .box_h = 47, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 6431, .adv_w = 632, .box_w = 36, .box_h = 47, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 6886, .adv_w = 232, .box_w = 10, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6967, .adv_w = 232, .box_w = 10, .box_h = 44, .ofs_x = 2, .ofs_y = -10},
+    {.bitmap_index = 7085, .adv_w = 596, .box_w = 29, .box_h = 29, .ofs_x = 4, .ofs_y = 8},
+    {.bitmap_index = 7297, .adv_w = 596, .box_w = 29, .box_h = 21, .ofs_x = 4, .ofs_y = 12},
+    {.bitmap_index = 7336, .adv_w = 596, .box_w = 29, .box_h = 29, .ofs_x = 4, .ofs_y = 8},
+    {.bitmap_index = 7547, .adv_w = 587, .box_w = 33, .box_h = 46, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7859, .adv_w = 1059, .box_w = 61, .box_h = 58, .ofs_x = 3, .ofs_y = -12},
+    {.bitmap_index = 8794, .adv_w = 750, .box_w = 48, .box_h = 45, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 9234, .adv_w = 775, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 9539, .adv_w = 740, .box_w = 41, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 9951, .adv_w = 846, .box_w = 44, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 10257, .adv_w = 686, .box_w = 34, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 10353, .adv_w = 650, .box_w = 33, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 10441, .adv_w = 791, .box_w = 42, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 10849, .adv_w = 831, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 10948, .adv_w = 317, .box_w = 8, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 10967, .adv_w = 525, .box_w = 28, .box_h = 46, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 11139, .adv_w = 736, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 11479, .adv_w = 608, .box_w = 32, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 11551, .adv_w = 978, .box_w = 49, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 11941, .adv_w = 831, .box_w = 40, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 12194, .adv_w = 860, .box_w = 48, .box_h = 47, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 12705, .adv_w = 739, .box_w = 37, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 12942, .adv_w = 860, .box_w = 50, .box_h = 55, .ofs_x = 3, .ofs_y = -9},
+    {.bitmap_index = 13563, .adv_w = 744, .box_w = 38, .box_h = 45, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 13858, .adv_w = 636, .box_w = 36, .box_h = 47, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 14274, .adv_w = 601, .box_w = 38, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14367, .adv_w = 810, .box_w = 39, .box_h = 46, .ofs_x = 6, .ofs_y = -1},
+    {.bitmap_index = 14616, .adv_w = 729, .box_w = 47, .box_h = 45, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15072, .adv_w = 1153, .box_w = 69, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 15865, .adv_w = 689, .box_w = 43, .box_h = 45, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16339, .adv_w = 663, .box_w = 43, .box_h = 45, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16670, .adv_w = 673, .box_w = 39, .box_h = 45, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16936, .adv_w = 341, .box_w = 15, .box_h = 60, .ofs_x = 6, .ofs_y = -12},
+    {.bitmap_index = 16987, .adv_w = 360, .box_w = 28, .box_h = 60, .ofs_x = -3, .ofs_y = -6},
+    {.bitmap_index = 17334, .adv_w = 341, .box_w = 14, .box_h = 60, .ofs_x = 1, .ofs_y = -12},
+    {.bitmap_index = 17382, .adv_w = 597, .box_w = 29, .box_h = 27, .ofs_x = 4, .ofs_y = 9},
+    {.bitmap_index = 17615, .adv_w = 512, .box_w = 32, .box_h = 4, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 17625, .adv_w = 614, .box_w = 17, .box_h = 9, .ofs_x = 7, .ofs_y = 39},
+    {.bitmap_index = 17674, .adv_w = 612, .box_w = 30, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17957, .adv_w = 698, .box_w = 36, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 18298, .adv_w = 585, .box_w = 33, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 18587, .adv_w = 698, .box_w = 36, .box_h = 48, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 18927, .adv_w = 627, .box_w = 35, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 19236, .adv_w = 361, .box_w = 25, .box_h = 48, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19377, .adv_w = 707, .box_w = 37, .box_h = 46, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 19828, .adv_w = 697, .box_w = 34, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 20021, .adv_w = 286, .box_w = 10, .box_h = 48, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 20078, .adv_w = 291, .box_w = 20, .box_h = 61, .ofs_x = -6, .ofs_y = -12},
+    {.bitmap_index = 20236, .adv_w = 631, .box_w = 35, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 20511, .adv_w = 286, .box_w = 7, .box_h = 48, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 20531, .adv_w = 1082, .box_w = 58, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 20835, .adv_w = 697, .box_w = 34, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 21006, .adv_w = 650, .box_w = 36, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 21343, .adv_w = 698, .box_w = 36, .box_h = 46, .ofs_x = 5, .ofs_y = -12},
+    {.bitmap_index = 21686, .adv_w = 698, .box_w = 36, .box_h = 46, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 22029, .adv_w = 420, .box_w = 20, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 22127, .adv_w = 513, .box_w = 30, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22422, .adv_w = 424, .box_w = 25, .box_h = 42, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 22554, .adv_w = 693, .box_w = 33, .box_h = 34, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 22725, .adv_w = 572, .box_w = 37, .box_h = 34, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 23047, .adv_w = 921, .box_w = 58, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23604, .adv_w = 565, .box_w = 35, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23936, .adv_w = 572, .box_w = 38, .box_h = 46, .ofs_x = -2, .ofs_y = -12},
+    {.bitmap_index = 24362, .adv_w = 534, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 24553, .adv_w = 359, .box_w = 19, .box_h = 60, .ofs_x = 3, .ofs_y = -12},
+    {.bitmap_index = 24737, .adv_w = 306, .box_w = 7, .box_h = 60, .ofs_x = 6, .ofs_y = -12},
+    {.bitmap_index = 24761, .adv_w = 359, .box_w = 18, .box_h = 60, .ofs_x = 1, .ofs_y = -12},
+    {.bitmap_index = 24943, .adv_w = 596, .box_w = 31, .box_h = 11, .ofs_x = 3, .ofs_y = 17},
+    {.bitmap_index = 25070, .adv_w = 429, .box_w = 22, .box_h = 21, .ofs_x = 2, .ofs_y = 24}
 };
 
 /*---------------------
@@ -8814,7 +3991,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 2,
     .bpp = 4,
     .kern_classes = 1,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -8833,7 +4010,7 @@ const lv_font_t lv_font_montserrat_64 = {
 lv_font_t lv_font_montserrat_64 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_glyph_cache_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 66,          /*The maximum line height required by the font*/
     .base_line = 12,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 27 px
  * Bpp: 4
- * Opts: --font fonts/OverpassMono-Light.ttf --size 27 --bpp 4 --format lvgl --output main/ui/lv_font_overpass_27.c --range 0x20-0x7E,0xB0 --lv-include lvgl.h --no-compress
+ * Opts: --font fonts/OverpassMono-Light.ttf --size 27 --bpp 4 --format lvgl --output main/ui/lv_font_overpass_27.c --range 0x20-0x7E,0xB0 --lv-include lvgl.h
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -9,6 +9,7 @@
 #else
 #include "lvgl.h"
 #endif
+#include "font_glyph_cache.h"
 
 #ifndef LV_FONT_OVERPASS_27
 #define LV_FONT_OVERPASS_27 1
@@ -25,1463 +26,1022 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0x9, 0xf5, 0x0, 0x9f, 0x50, 0x9, 0xf5, 0x0,
-    0x9f, 0x50, 0x9, 0xf5, 0x0, 0x9f, 0x50, 0x9,
-    0xf4, 0x0, 0x8f, 0x40, 0x7, 0xf3, 0x0, 0x6f,
-    0x20, 0x6, 0xf1, 0x0, 0x5f, 0x0, 0x4, 0xf0,
-    0x0, 0x3d, 0x0, 0x0, 0x0, 0x0, 0x25, 0x0,
-    0x2f, 0xfb, 0x5, 0xff, 0xf0, 0xb, 0xf6, 0x0,
+    0x9, 0xf5, 0x0, 0xff, 0xe8, 0x88, 0x0, 0x40,
+    0x37, 0x83, 0x80, 0x4, 0x4, 0x3, 0x18, 0x0,
+    0xc0, 0x40, 0x2, 0x1, 0x9c, 0x80, 0x23, 0xd0,
+    0x8, 0x94, 0x0, 0x5b, 0x56, 0xe, 0x0, 0x40,
+    0x54, 0x9, 0x0,
 
     /* U+0022 "\"" */
-    0x4f, 0xf0, 0x7, 0xfd, 0x3f, 0xf0, 0x6, 0xfc,
-    0x2f, 0xe0, 0x5, 0xfb, 0x1f, 0xd0, 0x4, 0xfa,
-    0xf, 0xc0, 0x3, 0xf9, 0xf, 0xb0, 0x2, 0xf8,
-    0xe, 0xa0, 0x1, 0xf6, 0x1, 0x10, 0x0, 0x20,
+    0x4f, 0xf0, 0x1, 0xff, 0x5c, 0x3, 0x8, 0x8,
+    0x80, 0x40, 0x6, 0xe, 0x60, 0x60, 0x1, 0x1,
+    0x10, 0x8, 0x1, 0xc0, 0xc0, 0xe, 0x0, 0x10,
+    0x10, 0x11, 0x0, 0xc, 0x38, 0x3e, 0xc0, 0x3,
+    0xac,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x2, 0xfb, 0x0, 0x7, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0xc, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0xee,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x1, 0xaa, 0xbf, 0xea, 0xaa,
-    0xcf, 0xca, 0xa8, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0xaf, 0x20, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x30, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xbb,
-    0xbf, 0xeb, 0xbb, 0xdf, 0xcb, 0xb6, 0x0, 0x0,
-    0x3, 0xf9, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0x70, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0x0, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf0, 0x0, 0x2f, 0xa0, 0x0,
-    0x0, 0x0,
+    0x0, 0xe2, 0xfb, 0x0, 0x9f, 0xd8, 0x3, 0xf3,
+    0x1, 0x80, 0x5c, 0xa, 0x1, 0xf8, 0xc3, 0x80,
+    0x25, 0x3, 0x0, 0xfd, 0xa0, 0xa0, 0x11, 0x8,
+    0x7, 0xf3, 0x1, 0x0, 0x4, 0x4a, 0x1, 0xef,
+    0xf8, 0xc3, 0xbf, 0xdc, 0x9, 0xfe, 0xe0, 0x0,
+    0xaa, 0x90, 0x5, 0x56, 0x30, 0x35, 0x53, 0x0,
+    0x6, 0xa9, 0x0, 0x95, 0x52, 0x4, 0x55, 0x20,
+    0x3, 0x98, 0x34, 0x2, 0x20, 0x60, 0xf, 0xda,
+    0x4, 0x1, 0x38, 0x10, 0x7, 0xe2, 0x6, 0x0,
+    0x88, 0x80, 0x1f, 0xcc, 0x4, 0x0, 0x10, 0x60,
+    0xe, 0x2f, 0xf8, 0xc3, 0xbf, 0xdc, 0x9, 0xfe,
+    0xb0, 0x0, 0xa2, 0x40, 0x28, 0x91, 0x1, 0xa2,
+    0x34, 0x0, 0x77, 0x68, 0x7, 0xbb, 0x94, 0x22,
+    0xec, 0xc0, 0x1c, 0xc1, 0xc0, 0x11, 0x83, 0x0,
+    0x7e, 0xd0, 0x30, 0x9, 0x80, 0x80, 0x3f, 0x10,
+    0x30, 0x4, 0x44, 0x0, 0xfe, 0x70, 0x20, 0x1,
+    0x3, 0x80, 0x78,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x7, 0xc4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x2, 0x8d,
-    0xfb, 0x50, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x7, 0xfe, 0x51, 0x3, 0xaf, 0xe0,
-    0x0, 0xef, 0x30, 0x0, 0x0, 0x88, 0x10, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xff, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x32, 0x85,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x4f, 0xe2, 0x0,
-    0x0, 0x4, 0xfd, 0x0, 0x9f, 0xf7, 0x21, 0x27,
-    0xff, 0x50, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x16, 0xdf, 0xb6, 0x10, 0x0, 0x0,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0,
+    0x0, 0xe7, 0xc4, 0x0, 0xff, 0x71, 0x88, 0x7,
+    0xe2, 0x84, 0xe, 0x50, 0xf, 0x4e, 0xb9, 0x2,
+    0x56, 0x90, 0x4, 0xec, 0x35, 0xdf, 0x8a, 0x58,
+    0x1, 0x48, 0x6a, 0x88, 0x1d, 0x3b, 0x8, 0x0,
+    0x40, 0xc0, 0x3a, 0x20, 0x20, 0x18, 0x40, 0x3f,
+    0xca, 0x14, 0x1, 0xfe, 0x81, 0x4d, 0x50, 0xf,
+    0xc5, 0x86, 0x55, 0xac, 0x1, 0xf1, 0x64, 0x91,
+    0x27, 0x90, 0x3, 0xe6, 0xdb, 0x31, 0xb8, 0x0,
+    0xfc, 0x99, 0x20, 0xea, 0x1, 0xfc, 0xd2, 0x10,
+    0x1, 0xfe, 0x61, 0x22, 0x0, 0x7f, 0x88, 0x4,
+    0xa1, 0x40, 0x3e, 0x10, 0x26, 0x7b, 0x20, 0xe,
+    0x42, 0x20, 0xa3, 0xe, 0xb9, 0x9, 0x3d, 0x84,
+    0x0, 0x26, 0x2, 0x37, 0xb6, 0x2, 0x54, 0x2,
+    0x7e, 0x92, 0x4, 0x9e, 0x60, 0xe, 0x16, 0x40,
+    0xe6, 0x10, 0xf, 0xfe, 0x20,
 
     /* U+0025 "%" */
-    0x0, 0x8e, 0xfd, 0x60, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0xbf, 0x86, 0xbf, 0x60, 0x0, 0x3, 0xf9,
-    0x0, 0x4f, 0x60, 0x0, 0xbe, 0x0, 0x0, 0xdd,
-    0x0, 0x8, 0xf0, 0x0, 0x6, 0xf2, 0x0, 0x9f,
-    0x30, 0x0, 0x8f, 0x0, 0x0, 0x6f, 0x30, 0x4f,
-    0x80, 0x0, 0x6, 0xf4, 0x0, 0xa, 0xf0, 0xe,
-    0xd0, 0x0, 0x0, 0xe, 0xd4, 0x27, 0xf8, 0x9,
-    0xf3, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xf9, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0x31, 0x1,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x9f, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x1e, 0xc0, 0xaf, 0x75, 0xaf, 0x50, 0x0, 0x0,
-    0xb, 0xf2, 0x3f, 0x60, 0x0, 0xce, 0x0, 0x0,
-    0x6, 0xf7, 0x7, 0xf1, 0x0, 0x7, 0xf2, 0x0,
-    0x1, 0xfc, 0x0, 0x9f, 0x0, 0x0, 0x6f, 0x30,
-    0x0, 0xbf, 0x20, 0x7, 0xf1, 0x0, 0x7, 0xf1,
-    0x0, 0x6f, 0x60, 0x0, 0x3f, 0x70, 0x0, 0xdc,
-    0x0, 0x2f, 0xb0, 0x0, 0x0, 0xaf, 0x86, 0xcf,
-    0x40, 0xc, 0xe1, 0x0, 0x0, 0x0, 0x8e, 0xfc,
-    0x40, 0x0,
+    0x0, 0x47, 0x7e, 0xb0, 0x7, 0xa3, 0xd0, 0x1,
+    0x6e, 0xd2, 0xd2, 0xc0, 0x18, 0xdd, 0x90, 0x11,
+    0x13, 0xd, 0x69, 0x0, 0x1b, 0x8a, 0x40, 0x18,
+    0xc, 0x1, 0x68, 0x90, 0x2, 0x4b, 0x80, 0x3f,
+    0xe1, 0x4, 0x67, 0x30, 0xb, 0x81, 0x0, 0x2c,
+    0x3, 0xa, 0x28, 0x0, 0xcc, 0x32, 0x84, 0xea,
+    0xe1, 0x23, 0xc0, 0x1e, 0xc0, 0xbd, 0x86, 0x84,
+    0x67, 0x30, 0xf, 0x16, 0xeb, 0x3a, 0x46, 0x8a,
+    0x0, 0x3f, 0x88, 0xc4, 0x2c, 0x7c, 0x3, 0xff,
+    0x82, 0xaa, 0x82, 0x9f, 0xf7, 0x30, 0x7, 0xc3,
+    0x66, 0xf4, 0xd1, 0x49, 0x2a, 0x1, 0xea, 0x1e,
+    0x35, 0x97, 0x5a, 0x3b, 0x0, 0xe6, 0x48, 0x24,
+    0x7, 0x0, 0xac, 0x48, 0x2, 0x19, 0x37, 0xe,
+    0x1, 0x0, 0x84, 0x4, 0x2, 0xa0, 0xe0, 0x7,
+    0x0, 0x80, 0x42, 0x4, 0x0, 0x64, 0x92, 0x0,
+    0x20, 0x30, 0x5, 0x46, 0x20, 0x52, 0x8c, 0x1,
+    0x1a, 0xc4, 0x1b, 0xa, 0x0, 0x1c, 0x34, 0x1,
+    0xd4, 0xed, 0x21, 0x68, 0x0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x5c, 0xff, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfb, 0xcf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd1, 0x0, 0x3f, 0xf0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x9f, 0x30,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x1, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x2, 0xdf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0x70,
-    0x6f, 0xe1, 0x0, 0x38, 0x30, 0x0, 0xdf, 0x40,
-    0x0, 0x8f, 0xd0, 0x9, 0xf3, 0x0, 0x5f, 0x80,
-    0x0, 0x0, 0xaf, 0xb0, 0xef, 0x0, 0x8, 0xf3,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x1, 0xff, 0xf2, 0x0, 0x6,
-    0xf9, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x40, 0x0,
-    0x1e, 0xf8, 0x0, 0x0, 0x5e, 0xfd, 0xff, 0x20,
-    0x0, 0x4f, 0xff, 0xcb, 0xef, 0xf6, 0x6, 0xfd,
-    0x10, 0x0, 0x29, 0xef, 0xec, 0x71, 0x0, 0x8,
-    0xfc, 0x0,
+    0x0, 0xcb, 0x9f, 0xeb, 0x40, 0xf, 0xf4, 0x51,
+    0xa1, 0xa5, 0xb0, 0x7, 0xe2, 0x72, 0xeb, 0xcc,
+    0x4, 0x80, 0x7e, 0x40, 0xb1, 0x0, 0x1b, 0x1,
+    0x80, 0x7c, 0x60, 0x20, 0x1e, 0x10, 0xf, 0x90,
+    0x28, 0x2, 0x17, 0x22, 0x0, 0x7c, 0x2c, 0x54,
+    0x5, 0x83, 0xc0, 0x1f, 0xd2, 0x4b, 0xfa, 0x78,
+    0x60, 0x1f, 0xe5, 0x0, 0xb8, 0xc0, 0x3f, 0x86,
+    0xdc, 0x2, 0x30, 0xf, 0xe2, 0xc4, 0x8f, 0x90,
+    0xd1, 0x0, 0x1c, 0x18, 0x5, 0xe5, 0x6e, 0xc,
+    0xe3, 0x80, 0xa, 0x70, 0x9, 0x49, 0xd0, 0x2,
+    0x85, 0x2b, 0x7, 0x3, 0x0, 0x68, 0x58, 0x7,
+    0x51, 0xa7, 0x8a, 0x80, 0x73, 0x80, 0x7b, 0x40,
+    0x28, 0x0, 0xb8, 0x34, 0x3, 0xfc, 0xc0, 0x13,
+    0x8b, 0x40, 0x6, 0x5f, 0x2, 0xb, 0x20, 0x0,
+    0xd0, 0x3f, 0xe5, 0xf5, 0xc, 0xec, 0x87, 0x88,
+    0x1, 0x35, 0x84, 0xd4, 0xa3, 0x98, 0x19, 0xcb,
+    0x40,
 
     /* U+0027 "'" */
-    0xdf, 0x7c, 0xf6, 0xbf, 0x4a, 0xf3, 0x9f, 0x28,
-    0xf1, 0x7f, 0x0, 0x20,
+    0xdf, 0x71, 0x1, 0x70, 0x21, 0x7, 0x30, 0x11,
+    0x1, 0xf8, 0xb, 0xe8, 0x0,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0x9, 0xf6, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x0,
-    0x5f, 0x80, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0x0, 0x0, 0x1e, 0xf1, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x4f, 0xa0,
-    0x0, 0x0, 0x3, 0x82,
+    0x0, 0xe7, 0xf5, 0x0, 0xd1, 0x9, 0x50, 0x9,
+    0x9d, 0x98, 0x1, 0x14, 0x94, 0x80, 0x69, 0x8,
+    0x0, 0xc4, 0x84, 0xa0, 0x1a, 0xc2, 0xc0, 0x39,
+    0x1, 0xc0, 0x30, 0x91, 0x4, 0x3, 0x10, 0x38,
+    0x7, 0x30, 0x10, 0x7, 0xff, 0x25, 0x80, 0x80,
+    0x38, 0x81, 0xc0, 0x38, 0x48, 0x82, 0x1, 0xca,
+    0xc, 0x1, 0xd4, 0x14, 0x1, 0xc4, 0xc4, 0xc0,
+    0x1d, 0x3, 0x22, 0x1, 0x87, 0x43, 0x40, 0x38,
+    0xec, 0xe8, 0x3, 0x93, 0x8, 0x80,
 
     /* U+0029 ")" */
-    0xb, 0xe3, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x1e, 0xe1, 0x0, 0x0, 0x0, 0x4f,
-    0xb0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x4, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x6f,
-    0x90, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x1e,
-    0xc1, 0x0, 0x0, 0x5, 0x70, 0x0, 0x0, 0x0,
+    0xb, 0xe3, 0x0, 0xf5, 0x96, 0x18, 0x7, 0xb4,
+    0x74, 0x40, 0x38, 0x68, 0x68, 0x3, 0xc8, 0x92,
+    0x80, 0x7a, 0x2, 0x40, 0x3c, 0x67, 0x80, 0x3d,
+    0x60, 0x80, 0x1e, 0x40, 0xc0, 0xf, 0x18, 0x30,
+    0x7, 0xc2, 0x40, 0x1f, 0x18, 0x7, 0xe3, 0x0,
+    0xfc, 0x24, 0x1, 0xe3, 0x6, 0x0, 0xf2, 0x6,
+    0x0, 0x7a, 0x81, 0x40, 0x39, 0x9, 0x8, 0x3,
+    0xa0, 0x20, 0x3, 0x98, 0xd8, 0xc0, 0x31, 0xc9,
+    0xc8, 0x6, 0x1d, 0x3d, 0x0, 0xe4, 0x9c, 0x10,
+    0xc,
 
     /* U+002A "*" */
-    0x0, 0x7, 0x20, 0x0, 0x64, 0x0, 0x0, 0x6,
-    0xfb, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0xd, 0xf4,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x4f, 0xc1, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x8f, 0x30, 0x0,
-    0xb, 0xdd, 0xc8, 0xef, 0xba, 0xcd, 0xd6, 0xdf,
-    0xff, 0xce, 0xfc, 0xdf, 0xff, 0x80, 0x0, 0x5,
-    0xfa, 0xd1, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0xcf, 0x50,
-    0x0, 0x0, 0x5f, 0xc0, 0x3, 0xfe, 0x0, 0x0,
-    0x2, 0xb3, 0x0, 0x8, 0x70, 0x0,
+    0x0, 0x9c, 0x80, 0x26, 0x40, 0xe, 0x68, 0x90,
+    0x0, 0xcd, 0x88, 0x6, 0x62, 0x44, 0x5, 0x84,
+    0x8, 0x7, 0x48, 0x40, 0xa9, 0x38, 0x7, 0x91,
+    0xce, 0x43, 0x80, 0x35, 0xee, 0xb0, 0x5, 0xd2,
+    0x73, 0x74, 0xcc, 0x22, 0x1a, 0x0, 0x1d, 0xc6,
+    0x44, 0xed, 0xff, 0xa4, 0x54, 0x73, 0xfe, 0x80,
+    0x8, 0xa8, 0xe0, 0xb4, 0x3, 0xee, 0x9, 0x23,
+    0x32, 0x80, 0x72, 0x99, 0x94, 0x3c, 0x2c, 0x3,
+    0x9d, 0x3c, 0x0, 0x6f, 0x20, 0x10,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x69, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xd, 0xdd, 0xdd, 0xff, 0xdd, 0xdd, 0xd8,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x40, 0x0, 0x0,
+    0x0, 0xf3, 0x49, 0x0, 0x7f, 0xda, 0xcc, 0x0,
+    0xff, 0xf9, 0x7f, 0xf2, 0x5, 0xff, 0xea, 0x2,
+    0x2e, 0x0, 0x11, 0x78, 0x37, 0x79, 0x2, 0x77,
+    0x74, 0x0, 0x7f, 0xfb, 0x0,
 
     /* U+002C "," */
-    0x3, 0x50, 0x4, 0xff, 0xb0, 0x7f, 0xff, 0x1,
-    0xcf, 0xf0, 0x0, 0xcd, 0x0, 0x1f, 0x70, 0x8,
-    0xe0, 0x2, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x50, 0x2, 0x65, 0x58, 0x18, 0x1, 0x1,
+    0x8c, 0x2, 0x1c, 0x32, 0x0, 0x9, 0xd0, 0x2,
+    0x45, 0xc0, 0x9a, 0x80, 0x5, 0xc8, 0x0,
 
     /* U+002D "-" */
-    0xd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xd, 0xdf, 0xfd, 0x0, 0x45, 0xff, 0xc1,
 
     /* U+002E "." */
-    0x2, 0x50, 0x2, 0xff, 0xb0, 0x5f, 0xff, 0x0,
-    0xbf, 0x60,
+    0x2, 0x50, 0x1, 0x6d, 0x58, 0x38, 0x1, 0x1,
+    0x50, 0x24, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x67,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x47, 0xa0, 0x7, 0xf0, 0xb9, 0x20,
+    0x7, 0xf3, 0x4, 0x0, 0x7f, 0xa4, 0x94, 0x3,
+    0xf9, 0x86, 0xc0, 0x3f, 0xd0, 0x2c, 0x1, 0xfc,
+    0xc3, 0x20, 0x1f, 0xeb, 0x7, 0x0, 0xfe, 0x52,
+    0x70, 0xf, 0xf4, 0x84, 0x80, 0x7f, 0x21, 0xb0,
+    0x80, 0x7f, 0x78, 0x58, 0x7, 0xf1, 0xa2, 0x90,
+    0x7, 0xf4, 0x84, 0x0, 0x7f, 0x12, 0xa1, 0x0,
+    0x7f, 0x58, 0x40, 0x7, 0xf0, 0xb2, 0x18, 0x7,
+    0xf4, 0x7, 0x80, 0x7f, 0xb, 0x1a, 0x0, 0x7f,
+    0x48, 0x48, 0x7, 0xf9, 0x89, 0x40, 0x3f, 0x9c,
+    0x6c, 0x3, 0xfc, 0x30, 0xc0, 0x1f, 0xe0,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x4b, 0xef, 0xd9, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xcb, 0xdf, 0xe3, 0x0, 0x0, 0x6f,
-    0xd2, 0x0, 0x6, 0xfe, 0x10, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0x8f, 0x90, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0xb, 0xf4, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0xf, 0xf0, 0x0, 0x25, 0x0, 0x6, 0xfa,
-    0x1f, 0xe0, 0x2, 0xff, 0xb0, 0x4, 0xfb, 0x2f,
-    0xd0, 0x5, 0xff, 0xf0, 0x4, 0xfc, 0x1f, 0xe0,
-    0x0, 0xbf, 0x60, 0x4, 0xfb, 0xf, 0xf0, 0x0,
-    0x0, 0x0, 0x5, 0xfa, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0xb, 0xf4, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x6, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x6f, 0xd2, 0x0, 0x6, 0xfe, 0x10, 0x0,
-    0x8, 0xff, 0xcb, 0xef, 0xe3, 0x0, 0x0, 0x0,
-    0x4b, 0xef, 0xd9, 0x10, 0x0,
+    0x0, 0xc9, 0x7d, 0xfb, 0x22, 0x1, 0xe8, 0xb4,
+    0x24, 0x6, 0xf3, 0x0, 0xcc, 0xe5, 0xb9, 0x7b,
+    0x23, 0xa2, 0x1, 0x40, 0x79, 0x0, 0x4c, 0xe3,
+    0x0, 0x5, 0x16, 0x20, 0xe, 0x80, 0x60, 0x7,
+    0x86, 0x80, 0x7c, 0x80, 0x80, 0xe0, 0xa0, 0x1f,
+    0x60, 0x60, 0x10, 0x8, 0x0, 0x94, 0x2, 0x10,
+    0x21, 0x1, 0x0, 0x16, 0xd5, 0x80, 0x8, 0x4,
+    0xc0, 0xc0, 0xe, 0x0, 0x40, 0xc, 0xe6, 0x6,
+    0x0, 0x54, 0x9, 0x0, 0xce, 0x20, 0x20, 0x15,
+    0xfb, 0x0, 0x4, 0x4, 0x4, 0x3, 0xf8, 0x83,
+    0x41, 0x41, 0x0, 0x3e, 0xd0, 0x30, 0xd0, 0xd0,
+    0xf, 0x94, 0x10, 0x18, 0x18, 0x80, 0x3a, 0x1,
+    0x80, 0x29, 0xf, 0x20, 0x9, 0x9c, 0x60, 0x2,
+    0x67, 0x2d, 0xcb, 0xe9, 0x1d, 0x10, 0xd, 0x16,
+    0x84, 0x86, 0xde, 0x60, 0x0,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x2, 0x83, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xf4, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0xc, 0xd8, 0x29, 0xf4, 0x0, 0x0,
-    0x2, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x3c, 0xcc,
-    0xcf, 0xff, 0xcc, 0xcb, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff,
+    0x0, 0xe2, 0x83, 0x0, 0xf9, 0xb3, 0x5d, 0xc0,
+    0x1d, 0x1f, 0x26, 0x1, 0xf9, 0x9, 0xf5, 0x80,
+    0x3e, 0xed, 0x82, 0x0, 0xfc, 0x40, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xb9, 0xe6, 0x66, 0xb, 0xcc,
+    0xad, 0xcc, 0xf0, 0x4, 0x67, 0x20,
 
     /* U+0032 "2" */
-    0x0, 0x5, 0xbe, 0xfe, 0xa3, 0x0, 0x0, 0xbf,
-    0xfc, 0xbd, 0xff, 0x60, 0xa, 0xfb, 0x10, 0x0,
-    0x5f, 0xf2, 0x2f, 0xd0, 0x0, 0x0, 0x9, 0xf8,
-    0x5, 0x40, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
-    0x0, 0xa, 0xfd, 0x10, 0x0, 0x0, 0x2, 0xdf,
-    0xc1, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6f,
-    0xd2, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xec,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff,
+    0x0, 0x96, 0xfb, 0xfa, 0x8c, 0x3, 0x5d, 0x21,
+    0x21, 0xae, 0x30, 0x2, 0x91, 0x1d, 0x97, 0xb4,
+    0x12, 0x44, 0x52, 0xb1, 0x0, 0x95, 0x82, 0x8a,
+    0xa4, 0x3, 0xda, 0x6, 0xa, 0x80, 0x1e, 0x70,
+    0x70, 0xf, 0xe5, 0x6, 0x0, 0xfe, 0xb0, 0xf0,
+    0xf, 0xd4, 0x46, 0xa0, 0x1f, 0x52, 0x96, 0x80,
+    0x78, 0xb5, 0x4f, 0x4, 0x3, 0x97, 0x49, 0xf0,
+    0x40, 0x39, 0xe8, 0x2a, 0x0, 0x3c, 0xd0, 0x5a,
+    0xa0, 0x1e, 0x39, 0x2c, 0x20, 0xf, 0xa0, 0x38,
+    0x40, 0x3e, 0x14, 0x33, 0x0, 0x7e, 0x50, 0x2c,
+    0xcf, 0xe1, 0x1, 0x33, 0xfe,
 
     /* U+0033 "3" */
-    0x0, 0x4, 0xbe, 0xfd, 0x81, 0x0, 0x0, 0x9,
-    0xff, 0xdc, 0xff, 0xf3, 0x0, 0x6, 0xfe, 0x30,
-    0x0, 0x9f, 0xe0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0xdf, 0x50, 0x0, 0x40, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xe0, 0x0, 0x0, 0x0,
-    0x1, 0x5d, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x2, 0xbb, 0xef, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x4e, 0x60, 0x0, 0x0, 0x0,
-    0xdf, 0x13, 0xfe, 0x10, 0x0, 0x0, 0x4f, 0xc0,
-    0xa, 0xfc, 0x20, 0x0, 0x5e, 0xf4, 0x0, 0xc,
-    0xff, 0xdc, 0xef, 0xf5, 0x0, 0x0, 0x6, 0xce,
-    0xfd, 0x82, 0x0, 0x0,
+    0x0, 0x92, 0xfb, 0xf6, 0x4, 0x3, 0xa6, 0xd0,
+    0xcc, 0x4f, 0xc6, 0x1, 0x33, 0x7, 0x37, 0x3d,
+    0x83, 0x40, 0x28, 0xd, 0x30, 0xa, 0x48, 0x54,
+    0x1, 0xd6, 0x60, 0x1c, 0x80, 0x60, 0x12, 0x0,
+    0x7e, 0x30, 0xf, 0xe1, 0x71, 0x50, 0xf, 0x85,
+    0x70, 0x68, 0x3, 0xc7, 0xfd, 0x45, 0x8, 0x1,
+    0xe1, 0x44, 0x8, 0x45, 0x0, 0x78, 0xae, 0xdd,
+    0x62, 0xae, 0x1, 0xfc, 0x94, 0x12, 0x1, 0xfe,
+    0x42, 0x12, 0x0, 0xff, 0x8, 0xa, 0x73, 0x0,
+    0x7c, 0x20, 0x4e, 0x30, 0x20, 0x1c, 0x84, 0x62,
+    0x6a, 0x3a, 0x40, 0x12, 0xd0, 0x40, 0x2, 0x8c,
+    0xdb, 0xac, 0xea, 0x1a, 0x40, 0xb, 0x24, 0xcf,
+    0x3e, 0xa8, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xab, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xde, 0x1b,
-    0xf2, 0x0, 0x0, 0x0, 0xa, 0xf4, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x5f, 0x90, 0xb, 0xf2, 0x0,
-    0x0, 0x1, 0xed, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0xb, 0xf2, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0xb, 0xf2, 0x0, 0xd, 0xfb, 0x99, 0x99,
-    0x9e, 0xfa, 0x98, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0,
+    0x0, 0xfe, 0x6f, 0x20, 0xf, 0xf1, 0x48, 0x7,
+    0xfe, 0xe0, 0xf, 0xfd, 0x6, 0x1, 0xff, 0x1b,
+    0xaa, 0x0, 0x7f, 0xb8, 0x6c, 0x3, 0xfd, 0x45,
+    0x42, 0x1, 0xfc, 0xaa, 0x64, 0x0, 0xfe, 0x1b,
+    0x29, 0x0, 0xff, 0x50, 0xf0, 0x7, 0xf9, 0xd2,
+    0xc, 0x3, 0xf8, 0xa0, 0xdc, 0x3, 0xfd, 0xe0,
+    0xf3, 0x3c, 0xa1, 0x13, 0x6, 0x40, 0x8c, 0xdc,
+    0x20, 0xac, 0xc3, 0xff, 0xfc, 0x81, 0xbf, 0xc0,
+    0x1f, 0xfe, 0xc0,
 
     /* U+0035 "5" */
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x8,
-    0xfb, 0xbb, 0xbb, 0xbb, 0x20, 0x0, 0xbf, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x38, 0xbb, 0x71, 0x0, 0x0, 0x8f, 0xaf,
-    0xff, 0xff, 0xf4, 0x0, 0xb, 0xff, 0x82, 0x2,
-    0xaf, 0xf2, 0x0, 0x6b, 0x30, 0x0, 0x0, 0xaf,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x81, 0x0, 0x0, 0x0, 0xbf, 0x70,
-    0x6f, 0xd4, 0x0, 0x1, 0xaf, 0xd0, 0x0, 0x9f,
-    0xfd, 0xbc, 0xff, 0xd1, 0x0, 0x0, 0x39, 0xdf,
-    0xfc, 0x70, 0x0, 0x0,
+    0x0, 0x37, 0xff, 0xe3, 0x0, 0xb8, 0x11, 0x3e,
+    0x10, 0x8, 0xc2, 0xef, 0xe2, 0x0, 0x94, 0x40,
+    0x3f, 0xe1, 0x50, 0xf, 0xf1, 0x81, 0x80, 0x7f,
+    0x98, 0x34, 0xe2, 0xec, 0xe2, 0x1, 0xb4, 0x3f,
+    0x1d, 0x11, 0x1c, 0x80, 0x11, 0x82, 0xbe, 0xfe,
+    0xa8, 0x59, 0x0, 0x35, 0x32, 0x8, 0xa, 0x94,
+    0x20, 0x0, 0xd6, 0x60, 0x1d, 0x0, 0xa0, 0x1f,
+    0xe2, 0x10, 0x20, 0xf, 0xf1, 0x0, 0x80, 0x7f,
+    0x88, 0x8, 0x3, 0xf8, 0x84, 0x60, 0x81, 0x0,
+    0xf4, 0x84, 0x83, 0x3e, 0x20, 0x4, 0x34, 0x84,
+    0xe0, 0xcc, 0x2b, 0xdb, 0xce, 0x52, 0xc0, 0xa,
+    0x71, 0x81, 0xc, 0xd1, 0xa2, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x92, 0x0, 0x0, 0x0, 0x5, 0xfc, 0x20,
-    0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x8d, 0xfe,
-    0xa3, 0x0, 0x0, 0xfe, 0xef, 0xb9, 0xcf, 0xf5,
-    0x0, 0x4f, 0xfc, 0x10, 0x0, 0x3e, 0xf2, 0x7,
-    0xfe, 0x10, 0x0, 0x0, 0x4f, 0xa0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0xdf, 0x7, 0xf5, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x6f, 0x50, 0x0, 0x0, 0x0,
-    0xbf, 0x12, 0xf8, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0xc, 0xe1, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x4f,
-    0xd2, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x7f, 0xfc,
-    0xbd, 0xfe, 0x30, 0x0, 0x0, 0x3b, 0xef, 0xd8,
-    0x10, 0x0,
+    0x0, 0xfe, 0x30, 0xf, 0xf4, 0x7f, 0x80, 0x3f,
+    0x1f, 0x3b, 0x70, 0x7, 0xcb, 0x85, 0xb2, 0x40,
+    0x1e, 0x4a, 0x4c, 0x20, 0xf, 0x8a, 0xce, 0xc0,
+    0x3f, 0xa4, 0x38, 0x3, 0xf9, 0x10, 0xe4, 0x1,
+    0xfd, 0xe1, 0x51, 0xbf, 0xd4, 0x60, 0x19, 0x7,
+    0x1d, 0x98, 0x4b, 0x8a, 0x0, 0x40, 0x12, 0xeb,
+    0x9c, 0xc0, 0xd1, 0x1, 0x80, 0xe8, 0x80, 0x47,
+    0x41, 0x1, 0xe0, 0xc2, 0x1, 0xc8, 0x4a, 0x1e,
+    0x1a, 0x1, 0xf3, 0x81, 0x8, 0x7, 0xf0, 0x81,
+    0xa0, 0x68, 0x7, 0xca, 0x22, 0x23, 0x61, 0x0,
+    0xe5, 0x16, 0x0, 0x40, 0xe1, 0x0, 0x4b, 0x43,
+    0x20, 0x4, 0x82, 0xdc, 0xbd, 0xa1, 0xd1, 0x0,
+    0x9f, 0x10, 0x90, 0x1f, 0xcc, 0x0,
 
     /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9, 0x99,
-    0x99, 0x99, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xce, 0x10,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0,
+    0x1f, 0xff, 0xf5, 0x8b, 0x37, 0xe0, 0x6, 0x4,
+    0xcf, 0xd6, 0x8, 0xe0, 0x1f, 0xb8, 0x68, 0x3,
+    0xf3, 0x1c, 0x88, 0x7, 0xe8, 0x27, 0x0, 0xfc,
+    0xe3, 0x60, 0x1f, 0xd4, 0x2c, 0x1, 0xf8, 0xc9,
+    0xc0, 0x3f, 0xa8, 0x34, 0x3, 0xf9, 0xc5, 0x0,
+    0x3f, 0x10, 0xa8, 0x7, 0xf2, 0x6, 0x0, 0x7f,
+    0x78, 0x10, 0x7, 0xf1, 0x3, 0x80, 0x7f, 0x30,
+    0x18, 0x7, 0xf1, 0x80, 0x80, 0x7f, 0x8, 0x80,
+    0x3f, 0xf8, 0xc0,
 
     /* U+0038 "8" */
-    0x0, 0x4, 0xbe, 0xfd, 0x81, 0x0, 0x0, 0x8,
-    0xff, 0xcb, 0xef, 0xe3, 0x0, 0x5, 0xfd, 0x30,
-    0x0, 0x6f, 0xe0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0xaf, 0x60, 0xf, 0xf0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x9,
-    0xf6, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x1d, 0xf7,
-    0x20, 0x3b, 0xf9, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x2e, 0xf9, 0x43, 0x6c, 0xf9,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x9, 0xf8, 0x6,
-    0xf8, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xbf, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0x5d, 0xf2, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0xbf, 0x40, 0x0, 0x0, 0x0,
-    0xaf, 0x56, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0xd, 0xfa, 0x10, 0x0, 0x3d, 0xf8, 0x0, 0x2d,
-    0xff, 0xcb, 0xdf, 0xf8, 0x0, 0x0, 0x6, 0xce,
-    0xfd, 0xa3, 0x0, 0x0,
+    0x0, 0x92, 0xfb, 0xf6, 0x4, 0x3, 0xa2, 0xd0,
+    0x90, 0xdf, 0xcc, 0x2, 0x57, 0x2c, 0xc5, 0xf4,
+    0x8e, 0x80, 0x52, 0x12, 0x60, 0x13, 0x28, 0xb0,
+    0x0, 0xc1, 0x0, 0x3b, 0xc3, 0xc0, 0x2, 0x1,
+    0xf1, 0x80, 0x80, 0x1c, 0x18, 0x3, 0xa8, 0x2c,
+    0x1, 0x5, 0x2e, 0x40, 0x76, 0x6c, 0x60, 0x1,
+    0xc2, 0x8d, 0xfc, 0x46, 0x90, 0x8, 0xbc, 0x9a,
+    0xf2, 0x4d, 0xa4, 0x2, 0xf1, 0xb9, 0x43, 0x6c,
+    0x66, 0x40, 0x31, 0x3a, 0x0, 0x74, 0x8b, 0x8e,
+    0x85, 0x80, 0x7c, 0xe0, 0x8c, 0x2, 0x1, 0xf7,
+    0x1, 0x30, 0x30, 0x7, 0xda, 0x5, 0xa1, 0xe0,
+    0x1e, 0x15, 0x4, 0x62, 0x4a, 0x10, 0x8, 0xf0,
+    0x1c, 0x43, 0xc9, 0x7b, 0x2f, 0x70, 0x9e, 0x0,
+    0x5, 0xb2, 0x64, 0x80, 0xb9, 0x0, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x4, 0xae, 0xfd, 0xa2, 0x0, 0x0, 0x9,
-    0xff, 0xcb, 0xdf, 0xf5, 0x0, 0x9, 0xfa, 0x10,
-    0x0, 0x5e, 0xf3, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x3f, 0xb0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0xbf,
-    0x1c, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xf4, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x6a, 0xf2, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x5f, 0x90, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0xcf, 0x70, 0x0, 0x2, 0xdf,
-    0xf3, 0x1, 0xdf, 0xd9, 0x8b, 0xfc, 0xff, 0x0,
-    0x0, 0x7d, 0xfe, 0xc6, 0x3f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x1, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x18, 0xff, 0x50, 0x0, 0x0, 0x0, 0xc, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x41, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0x92, 0xbb, 0xf6, 0x88, 0x3, 0xa6, 0xd4,
+    0x90, 0x17, 0x54, 0x2, 0x96, 0x5e, 0xcb, 0xda,
+    0x1a, 0x30, 0x36, 0x4a, 0x10, 0x9, 0x74, 0x20,
+    0x28, 0x20, 0x3, 0xc6, 0x88, 0x15, 0x3, 0x0,
+    0xfb, 0x1, 0x40, 0x3f, 0xf1, 0x30, 0x10, 0x7,
+    0xda, 0x3, 0xe1, 0x60, 0x1e, 0x25, 0x2, 0x53,
+    0x67, 0x0, 0xc5, 0xe0, 0x6, 0xd, 0x28, 0xd9,
+    0x8b, 0xd1, 0x0, 0x18, 0xe, 0xc0, 0x33, 0x1e,
+    0x7c, 0x14, 0x3, 0x3e, 0xff, 0x63, 0x50, 0x48,
+    0x7, 0xf1, 0x32, 0x18, 0x7, 0xf7, 0x4, 0x80,
+    0x7f, 0x59, 0xd1, 0x0, 0x7c, 0x36, 0x90, 0xa0,
+    0x1e, 0x18, 0xe4, 0xa7, 0x0, 0xfb, 0x5d, 0xb9,
+    0x40, 0x3f, 0x47, 0x48, 0x80, 0x78,
 
     /* U+003A ":" */
-    0x2, 0x50, 0x2, 0xff, 0xb0, 0x5f, 0xff, 0x0,
-    0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x50, 0x2, 0xff, 0xb0, 0x5f, 0xff,
-    0x0, 0xbf, 0x60,
+    0x2, 0x50, 0x1, 0x6d, 0x58, 0x38, 0x1, 0x1,
+    0x50, 0x24, 0x1, 0x7e, 0xc0, 0x1f, 0xfc, 0xf2,
+    0x50, 0x1, 0x6d, 0x58, 0x38, 0x1, 0x1, 0x50,
+    0x24, 0x0,
 
     /* U+003B ";" */
-    0x2, 0x40, 0x3, 0xff, 0x90, 0x7f, 0xfd, 0x1,
-    0xce, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x50, 0x4, 0xff, 0xb0, 0x7f, 0xff,
-    0x1, 0xcf, 0xf0, 0x0, 0xcd, 0x0, 0x1f, 0x70,
-    0x8, 0xe0, 0x2, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x40, 0x1, 0xed, 0xc8, 0x20, 0x1, 0x1,
+    0x8c, 0x60, 0x7, 0x39, 0x40, 0x3f, 0xf9, 0xe6,
+    0xa0, 0x4, 0xca, 0xb0, 0x30, 0x2, 0x3, 0x18,
+    0x4, 0x38, 0x64, 0x0, 0x13, 0xa0, 0x4, 0x8b,
+    0x81, 0x35, 0x0, 0xb, 0x90, 0x0,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xda, 0x0, 0x0,
-    0x0, 0x0, 0x3a, 0xff, 0xe6, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0xb5, 0x0, 0x0, 0x3, 0xaf, 0xfe,
-    0x81, 0x0, 0x0, 0x6, 0xdf, 0xfa, 0x40, 0x0,
-    0x0, 0x0, 0xf, 0xfa, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xef, 0xf9, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xfd, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x8e, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x24,
+    0x0, 0xff, 0xe0, 0x88, 0x7, 0xf8, 0x5f, 0x6c,
+    0x3, 0xf1, 0xd7, 0x41, 0xe0, 0x7, 0xb, 0xee,
+    0x2a, 0x57, 0x30, 0x4, 0x75, 0xd0, 0x6f, 0xd6,
+    0xa0, 0x13, 0x6e, 0x2a, 0xaf, 0xa0, 0x40, 0x3a,
+    0x49, 0x7a, 0x90, 0x3, 0xf1, 0x82, 0xeb, 0x0,
+    0x7f, 0x66, 0xb9, 0x4f, 0xc9, 0x80, 0x7c, 0x51,
+    0xd4, 0x6d, 0x9a, 0xe2, 0x1, 0xf2, 0xe6, 0xb9,
+    0xc7, 0x51, 0x80, 0x7c, 0x51, 0xd4, 0x8b, 0x20,
+    0x1f, 0xe5, 0xbd, 0xe0,
 
     /* U+003D "=" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd8, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa,
+    0xf, 0xff, 0xfd, 0x40, 0x45, 0xff, 0xc1, 0xd,
+    0xdf, 0xfd, 0x0, 0x1f, 0xfd, 0x1d, 0xdf, 0xfd,
+    0x0, 0x45, 0xff, 0xc1,
 
     /* U+003E ">" */
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf,
-    0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d,
-    0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xf7,
-    0x0, 0x0, 0x0, 0x5b, 0xff, 0xc6, 0x0, 0x0,
-    0x2, 0x9e, 0xff, 0x93, 0x0, 0x0, 0x6, 0xcf,
-    0xfc, 0x60, 0x0, 0x0, 0x0, 0xf, 0xf9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x1, 0x0, 0xff, 0xe0, 0xf5, 0xa0, 0x7, 0xfc,
+    0x88, 0xbe, 0x71, 0x0, 0xfd, 0x7d, 0x7, 0x1d,
+    0x68, 0x1, 0xf0, 0xbe, 0xda, 0xa5, 0xf3, 0x88,
+    0x7, 0xc9, 0x5d, 0x7, 0x1d, 0x46, 0x1, 0xf0,
+    0xbe, 0xe1, 0x2c, 0x80, 0x7e, 0x28, 0xd2, 0xd,
+    0x0, 0xf2, 0xde, 0xb9, 0x4f, 0xb8, 0x4, 0x53,
+    0xd4, 0x8d, 0x98, 0x60, 0x9, 0xb3, 0x58, 0xa7,
+    0xe4, 0xc0, 0x3a, 0x4d, 0xb3, 0xc, 0x1, 0xfa,
+    0x7e, 0x4c, 0x3, 0xf8,
 
     /* U+003F "?" */
-    0x0, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0, 0xc,
-    0xff, 0xdc, 0xef, 0xfa, 0x0, 0xb, 0xfa, 0x10,
-    0x0, 0x3d, 0xf8, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x6f, 0x50, 0x0, 0x0, 0x0, 0xdf,
-    0x12, 0x41, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0x40, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0x70, 0x0, 0x0, 0x0, 0x3, 0xef, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x96, 0xfb, 0xfa, 0xd4, 0x3, 0xb2, 0x90,
+    0xcc, 0x9, 0x54, 0x0, 0xac, 0xd7, 0xb7, 0x3b,
+    0x9, 0x60, 0x9, 0xe, 0x84, 0x2, 0x3f, 0x6,
+    0x4, 0x9, 0x0, 0xf1, 0x10, 0x44, 0x96, 0x80,
+    0x1f, 0x18, 0x0, 0x90, 0x40, 0x3c, 0x82, 0x42,
+    0x1, 0xf8, 0xa8, 0x24, 0x3, 0xf1, 0xe0, 0xc2,
+    0x0, 0x7c, 0x7a, 0x32, 0xe0, 0x1f, 0xe, 0x8d,
+    0x30, 0x7, 0xe9, 0x16, 0x50, 0xf, 0xe4, 0xa,
+    0x0, 0xff, 0x8, 0x10, 0x7, 0xfb, 0x34, 0x40,
+    0x3f, 0xc4, 0xc0, 0x1f, 0xe5, 0xcb, 0x70, 0xf,
+    0xec, 0x0, 0x60, 0x7, 0xf5, 0x90, 0xc0, 0x7,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x2, 0x9d, 0xfe, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc7, 0x56, 0xaf, 0xd2, 0x0,
-    0x0, 0x7, 0xf6, 0x0, 0x0, 0x1, 0xce, 0x10,
-    0x0, 0x4f, 0x60, 0x0, 0x0, 0x0, 0xd, 0xa0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf1,
-    0x4, 0xf2, 0x0, 0x5d, 0xfa, 0x1f, 0x40, 0xe6,
-    0x9, 0xd0, 0x5, 0xfc, 0x8e, 0x9f, 0x20, 0xb8,
-    0xd, 0x80, 0xe, 0xb0, 0x1, 0xef, 0x0, 0x9a,
-    0xf, 0x60, 0x5f, 0x30, 0x0, 0xbd, 0x0, 0x9a,
-    0xf, 0x50, 0x8f, 0x0, 0x0, 0xab, 0x0, 0xb8,
-    0xf, 0x50, 0x8f, 0x0, 0x0, 0xc9, 0x0, 0xe5,
-    0xe, 0x60, 0x6f, 0x30, 0x2, 0xf7, 0x3, 0xf1,
-    0xd, 0xa0, 0x1f, 0xc3, 0x4d, 0xdc, 0x3c, 0x90,
-    0x8, 0xe0, 0x5, 0xff, 0xf5, 0x5f, 0xfc, 0x10,
-    0x3, 0xf6, 0x0, 0x14, 0x10, 0x2, 0x40, 0x0,
-    0x0, 0xae, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xa6, 0x56, 0x83, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xcf, 0xfe, 0xb1, 0x0, 0x0,
+    0x0, 0xe2, 0x9d, 0xfe, 0xc6, 0x0, 0xfc, 0xfa,
+    0xb5, 0x48, 0x69, 0xd2, 0x0, 0xe7, 0x89, 0xc7,
+    0x56, 0xae, 0x1c, 0x10, 0x9, 0x22, 0x58, 0x3,
+    0x87, 0xe, 0xc0, 0x29, 0x46, 0x0, 0xfd, 0x2a,
+    0x20, 0x85, 0x20, 0x5, 0xdf, 0xa1, 0xf4, 0x40,
+    0xb8, 0x69, 0x10, 0x16, 0x85, 0xd2, 0x1, 0x81,
+    0x78, 0x11, 0x40, 0x16, 0x99, 0x1e, 0xe0, 0x40,
+    0x44, 0x2, 0xe0, 0x51, 0x80, 0x0, 0xa9, 0x0,
+    0x78, 0xc3, 0x40, 0xc0, 0x21, 0x60, 0x1, 0x10,
+    0x3, 0xfc, 0xc4, 0x0, 0x5d, 0x1, 0x30, 0xe0,
+    0x30, 0x1, 0x1f, 0x1, 0x8a, 0x1, 0xe0, 0x38,
+    0x79, 0xa7, 0x95, 0x9f, 0xb0, 0x82, 0xa0, 0xd,
+    0x1e, 0x5c, 0x40, 0xf0, 0x20, 0x1, 0x62, 0xc0,
+    0xbd, 0x7c, 0xaa, 0xdb, 0xc1, 0x0, 0x1a, 0xc0,
+    0x80, 0xa0, 0x80, 0x9, 0x0, 0x3a, 0xc3, 0x8,
+    0x3, 0xff, 0xf, 0x86, 0xd3, 0x2b, 0x41, 0x80,
+    0x7c, 0x3b, 0x2d, 0x35, 0x6, 0x40, 0x18,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x40, 0xaf, 0x20, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x6,
-    0xf7, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x1f,
-    0xd0, 0x0, 0x0, 0x8f, 0xfa, 0xaa, 0xaa, 0xff,
-    0x20, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0xcf, 0x20,
-    0xd, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x8f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x20,
+    0x0, 0xf4, 0xf9, 0x0, 0x7f, 0xe7, 0xa, 0x0,
+    0xff, 0x90, 0x41, 0x40, 0x3f, 0xed, 0x2, 0x28,
+    0x3, 0xfc, 0xe3, 0x1, 0x40, 0x1f, 0xc6, 0x2e,
+    0xa0, 0xa0, 0x1f, 0xd4, 0x1a, 0xa, 0x44, 0x0,
+    0xfc, 0xe0, 0x81, 0xe0, 0xa0, 0x1f, 0x18, 0xa8,
+    0x1, 0x42, 0x80, 0x3e, 0xb0, 0xf0, 0x9, 0x8,
+    0x80, 0x1e, 0x60, 0x50, 0xb, 0x41, 0x40, 0x38,
+    0xc5, 0x0, 0x33, 0x85, 0x0, 0x75, 0x82, 0x55,
+    0x6b, 0x2, 0x20, 0x6, 0x50, 0x2, 0xaf, 0x0,
+    0x14, 0x2, 0x32, 0x4f, 0xff, 0x70, 0x50, 0x5,
+    0x61, 0xa0, 0x1e, 0x13, 0x22, 0x0, 0x14, 0x1c,
+    0x3, 0xea, 0x5, 0x2, 0x21, 0x88, 0x7, 0xce,
+    0x14, 0x14, 0x16, 0x1, 0xf8, 0x4c, 0x88,
 
     /* U+0042 "B" */
-    0x2f, 0xff, 0xff, 0xed, 0x82, 0x0, 0x2, 0xfe,
-    0xbb, 0xbb, 0xdf, 0xf4, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x4f, 0xe0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x2f, 0xc0, 0x0, 0x0, 0x3, 0xf8,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x2f,
-    0xc0, 0x0, 0x0, 0x9, 0xf4, 0x2, 0xfc, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x2f, 0xea, 0xaa, 0xbe,
-    0xf8, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x91,
-    0x0, 0x2f, 0xc0, 0x0, 0x13, 0x8f, 0xe2, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0xbf, 0x12, 0xfc, 0x0, 0x0,
-    0x0, 0x8, 0xf3, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x9f, 0x22, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xf0,
-    0x2f, 0xc0, 0x0, 0x0, 0x9, 0xf8, 0x2, 0xfe,
-    0xbb, 0xbb, 0xcf, 0xfb, 0x0, 0x2f, 0xff, 0xff,
-    0xfe, 0xb5, 0x0, 0x0,
+    0x2f, 0xfe, 0xed, 0x82, 0x0, 0xe1, 0x44, 0x94,
+    0x1f, 0x50, 0x3, 0x15, 0xde, 0xdb, 0xa, 0x0,
+    0xff, 0x24, 0xa, 0x80, 0x7f, 0x90, 0x34, 0x3,
+    0xff, 0x97, 0x41, 0x80, 0x1f, 0xce, 0xca, 0x80,
+    0x11, 0x55, 0x57, 0xd0, 0xf4, 0x1, 0x85, 0x56,
+    0x41, 0x1, 0x10, 0x6, 0x3f, 0xfb, 0xb1, 0xdb,
+    0xc8, 0x3, 0xe1, 0x38, 0xb1, 0xe0, 0xf, 0xf2,
+    0x20, 0xc4, 0x3, 0xfc, 0x60, 0x40, 0x1f, 0xe1,
+    0x1, 0x0, 0xff, 0x20, 0x10, 0x7, 0xf4, 0x93,
+    0x80, 0x45, 0x77, 0xb3, 0xd9, 0x20, 0x2, 0x14,
+    0x4c, 0x49, 0x56, 0x0,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x6c, 0xef, 0xd8, 0x10, 0x0, 0x1,
-    0xcf, 0xfc, 0xbe, 0xfd, 0x10, 0x0, 0xcf, 0xb1,
-    0x0, 0x1c, 0xfa, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x1b, 0x40, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0xb, 0xa1,
-    0x0, 0xcf, 0xa1, 0x0, 0x9, 0xfb, 0x0, 0x1,
-    0xcf, 0xfc, 0xbe, 0xfd, 0x10, 0x0, 0x0, 0x6c,
-    0xef, 0xd7, 0x0, 0x0,
+    0x0, 0xcd, 0x9d, 0xfb, 0x2, 0x1, 0x87, 0x24,
+    0xc9, 0xd, 0xf0, 0x40, 0x2d, 0x34, 0xec, 0xbf,
+    0x32, 0xb0, 0x3, 0x19, 0xac, 0x40, 0x3, 0xa9,
+    0xc0, 0x8, 0xf, 0x0, 0xe1, 0xb4, 0x3, 0x13,
+    0x30, 0x7, 0xf2, 0x2, 0x0, 0x7f, 0xb4, 0x38,
+    0x3, 0xfc, 0x20, 0x40, 0x1f, 0xe7, 0x7, 0x0,
+    0xff, 0x38, 0x38, 0x7, 0xf8, 0x40, 0x40, 0x3f,
+    0xda, 0x1a, 0x1, 0xfe, 0x40, 0x40, 0xf, 0xf1,
+    0x89, 0x98, 0x3, 0xfd, 0x21, 0xe0, 0x1e, 0xba,
+    0x10, 0x73, 0x35, 0x8, 0x5, 0x28, 0x22, 0x0,
+    0x69, 0xaf, 0x65, 0xf3, 0x15, 0x0, 0x43, 0x92,
+    0x64, 0x87, 0x1a, 0x20,
 
     /* U+0044 "D" */
-    0x2f, 0xff, 0xff, 0xd9, 0x30, 0x0, 0x2, 0xfe,
-    0xbb, 0xbd, 0xff, 0x70, 0x0, 0x2f, 0xb0, 0x0,
-    0x4, 0xef, 0x60, 0x2, 0xfb, 0x0, 0x0, 0x3,
-    0xff, 0x10, 0x2f, 0xb0, 0x0, 0x0, 0x9, 0xf8,
-    0x2, 0xfb, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x2f,
-    0xb0, 0x0, 0x0, 0x0, 0xef, 0x12, 0xfb, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0xaf, 0x52, 0xfb, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0xaf, 0x52,
-    0xfb, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0xef, 0x12, 0xfb, 0x0, 0x0,
-    0x0, 0x2f, 0xd0, 0x2f, 0xb0, 0x0, 0x0, 0x9,
-    0xf8, 0x2, 0xfb, 0x0, 0x0, 0x3, 0xff, 0x10,
-    0x2f, 0xb0, 0x0, 0x5, 0xef, 0x60, 0x2, 0xfe,
-    0xbb, 0xbe, 0xff, 0x70, 0x0, 0x2f, 0xff, 0xff,
-    0xd9, 0x20, 0x0, 0x0,
+    0x2f, 0xfe, 0xd9, 0x30, 0xf, 0xa, 0x24, 0xd,
+    0x8e, 0x1, 0xcb, 0x77, 0x6d, 0x8c, 0x30, 0x7,
+    0xf2, 0x68, 0x48, 0x80, 0x7f, 0x1b, 0x4, 0x80,
+    0x7f, 0xac, 0x14, 0x3, 0xfc, 0x42, 0x42, 0x1,
+    0xfe, 0x50, 0x50, 0xf, 0xf0, 0x80, 0x80, 0x7f,
+    0x8c, 0xc, 0x3, 0xfc, 0x60, 0x60, 0x1f, 0xe1,
+    0x6, 0x0, 0xff, 0x28, 0x10, 0x7, 0xf1, 0x9,
+    0x8, 0x7, 0xf5, 0x82, 0x80, 0x7f, 0x1b, 0x4,
+    0x80, 0x7e, 0x5d, 0x9, 0x10, 0x9, 0x6e, 0xee,
+    0xa1, 0x86, 0x0, 0xc2, 0x89, 0x1b, 0x6b, 0x80,
+    0x40,
 
     /* U+0045 "E" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xfc,
-    0xcc, 0xcc, 0xcc, 0xc4, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfc, 0xcc, 0xcc, 0x90, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff,
+    0x2f, 0xff, 0xf3, 0x0, 0x46, 0x7f, 0x88, 0x0,
+    0x79, 0x9f, 0x90, 0x3, 0xff, 0xe4, 0x79, 0x9d,
+    0x20, 0x1e, 0x33, 0xe5, 0x0, 0xe3, 0xff, 0xec,
+    0x0, 0xff, 0xff, 0x80, 0xf, 0x33, 0xf8, 0x2,
+    0x33, 0xfe,
 
     /* U+0046 "F" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0xff,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xc3, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0xcc, 0xcc,
-    0xc3, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xf9, 0x0, 0x23, 0x3f, 0xe7, 0x0,
+    0x1e, 0x67, 0xf1, 0x80, 0x7f, 0xfd, 0xcf, 0x33,
+    0xc6, 0x1, 0xe3, 0x3f, 0x38, 0x7, 0x1f, 0xff,
+    0x90, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xd4,
 
     /* U+0047 "G" */
-    0x0, 0x1, 0x7d, 0xff, 0xc6, 0x0, 0x0, 0x2,
-    0xdf, 0xeb, 0xcf, 0xfa, 0x0, 0x0, 0xdf, 0x90,
-    0x0, 0x2e, 0xf6, 0x0, 0x7f, 0xb0, 0x0, 0x0,
-    0x3a, 0x20, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x60, 0x0, 0xf, 0xff, 0xff, 0x78,
-    0xf7, 0x0, 0x0, 0xaa, 0xad, 0xf7, 0x6f, 0x90,
-    0x0, 0x0, 0x0, 0x8f, 0x62, 0xfd, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x7f, 0xb0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0xdf, 0x90, 0x0, 0x2d, 0xf4, 0x0, 0x2,
-    0xdf, 0xeb, 0xcf, 0xf7, 0x0, 0x0, 0x1, 0x8d,
-    0xfe, 0xb4, 0x0, 0x0,
+    0x0, 0x85, 0xf7, 0xfd, 0x8c, 0x1, 0xc5, 0x90,
+    0x68, 0x66, 0x9a, 0x0, 0xde, 0x4d, 0xd7, 0x9a,
+    0x2a, 0xc0, 0x7, 0x24, 0x90, 0x8, 0xb5, 0x50,
+    0x1, 0x41, 0x0, 0x1c, 0x74, 0x40, 0x45, 0x18,
+    0x7, 0xf2, 0x2, 0x0, 0x7f, 0xb8, 0x38, 0x3,
+    0xfc, 0x20, 0x20, 0x1f, 0xe3, 0x3, 0x0, 0xff,
+    0x18, 0x18, 0x6, 0xff, 0xe7, 0x10, 0x10, 0xc,
+    0xab, 0x10, 0x3, 0x83, 0x80, 0x35, 0x54, 0xa0,
+    0x28, 0x8, 0x1, 0xf1, 0x1, 0x91, 0x46, 0x1,
+    0xe6, 0x7, 0xa, 0x8, 0x0, 0xe3, 0x38, 0x81,
+    0xc9, 0x24, 0x2, 0x2e, 0x8, 0x0, 0xbc, 0x9b,
+    0xaf, 0x34, 0xa1, 0x0, 0x22, 0xc7, 0x34, 0x24,
+    0xb7, 0x0,
 
     /* U+0048 "H" */
-    0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc,
-    0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc,
-    0x2f, 0xfc, 0xcc, 0xcc, 0xcc, 0xfc, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc,
-    0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc,
-    0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0,
-    0x0, 0x0, 0x2, 0xfc, 0x2f, 0xc0, 0x0, 0x0,
-    0x2, 0xfc,
+    0x2f, 0xc0, 0xf, 0x17, 0xe0, 0x7, 0xff, 0xfc,
+    0x3, 0xfe, 0x3c, 0xcf, 0x70, 0x7, 0x19, 0xfc,
+    0x1, 0x8f, 0xff, 0xda, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xe5, 0x80,
 
     /* U+0049 "I" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1c, 0xcc,
-    0xcf, 0xff, 0xcc, 0xc9, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x1c, 0xcc,
-    0xcf, 0xff, 0xcc, 0xc9, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfc,
+    0x2f, 0xff, 0xf6, 0x19, 0xf0, 0x4, 0x67, 0x28,
+    0xe6, 0x65, 0xb, 0xcc, 0xa4, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xe3, 0xe, 0x66,
+    0x50, 0xbc, 0xca, 0x4c, 0xf8, 0x2, 0x33, 0x94,
 
     /* U+004A "J" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x9, 0x80, 0x0, 0x0, 0xd, 0xf2,
-    0xd, 0xf5, 0x0, 0x0, 0xaf, 0xb0, 0x3, 0xef,
-    0xdb, 0xcf, 0xfd, 0x10, 0x0, 0x29, 0xdf, 0xfc,
-    0x70, 0x0,
+    0x0, 0xfe, 0x5f, 0x90, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xfc, 0x3, 0x84, 0x3, 0xf8, 0x83, 0x82,
+    0x60, 0x3, 0xd4, 0x8, 0x8, 0xea, 0x1, 0xa8,
+    0x90, 0x83, 0x86, 0xb6, 0xf3, 0xd4, 0xa8, 0x0,
+    0x78, 0xc0, 0x86, 0x68, 0xd1, 0x0,
 
     /* U+004B "K" */
-    0x2f, 0xc0, 0x0, 0x0, 0x1e, 0xf2, 0x2, 0xfc,
-    0x0, 0x0, 0xb, 0xf5, 0x0, 0x2f, 0xc0, 0x0,
-    0x8, 0xf9, 0x0, 0x2, 0xfc, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x2f, 0xc0, 0x1, 0xee, 0x10, 0x0,
-    0x2, 0xfc, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x2f,
-    0xc0, 0x9f, 0xb0, 0x0, 0x0, 0x2, 0xfc, 0x5f,
-    0xfd, 0x0, 0x0, 0x0, 0x2f, 0xef, 0xdd, 0xf5,
-    0x0, 0x0, 0x2, 0xff, 0xf2, 0x4f, 0xd0, 0x0,
-    0x0, 0x2f, 0xf4, 0x0, 0xbf, 0x60, 0x0, 0x2,
-    0xff, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0xb, 0xf7, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0xaf,
-    0x70, 0x2, 0xfc, 0x0, 0x0, 0x2, 0xfe, 0x10,
-    0x2f, 0xc0, 0x0, 0x0, 0x9, 0xf8, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x9f, 0x90,
+    0x2f, 0xc0, 0xe, 0x1e, 0xf2, 0x0, 0xfe, 0xa1,
+    0xa2, 0x0, 0xfd, 0x8, 0xca, 0x1, 0xf9, 0x1c,
+    0xe4, 0x3, 0xf0, 0xd0, 0xe8, 0x7, 0xf6, 0x8e,
+    0x88, 0x7, 0xe9, 0x34, 0x30, 0xf, 0xca, 0xc0,
+    0xc0, 0x1f, 0x8a, 0x88, 0xa5, 0x0, 0xf8, 0x43,
+    0xe4, 0x20, 0x3, 0xf5, 0x92, 0x20, 0x98, 0x3,
+    0xe4, 0x0, 0x40, 0x40, 0x7, 0x8c, 0x2, 0x34,
+    0x17, 0x0, 0xff, 0x48, 0x48, 0x7, 0xf8, 0x94,
+    0x5c, 0x3, 0xfd, 0x1, 0x22, 0x1, 0xfc, 0x4c,
+    0x32, 0x1, 0xfe, 0x80, 0x71, 0x0, 0xfe, 0x16,
+    0x8,
 
     /* U+004C "L" */
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
-    0xcc, 0xcc, 0xcc, 0xcb, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xfe,
+    0x2f, 0xc0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xd2, 0x79, 0x9f, 0xac, 0x2, 0x33,
+    0xfc, 0xa0,
 
     /* U+004D "M" */
-    0x2f, 0xf2, 0x0, 0x0, 0x8, 0xfc, 0x2f, 0xf6,
-    0x0, 0x0, 0xc, 0xfc, 0x2f, 0xfa, 0x0, 0x0,
-    0xf, 0xfc, 0x2f, 0xfe, 0x0, 0x0, 0x4f, 0xfc,
-    0x2f, 0xff, 0x20, 0x0, 0x8f, 0xfc, 0x2f, 0xdf,
-    0x60, 0x0, 0xcd, 0xfc, 0x2f, 0xbf, 0xa0, 0x0,
-    0xfa, 0xfc, 0x2f, 0xab, 0xd0, 0x4, 0xf6, 0xfc,
-    0x2f, 0xa7, 0xf1, 0x7, 0xf2, 0xfc, 0x2f, 0xa3,
-    0xf5, 0xb, 0xd0, 0xfc, 0x2f, 0xa0, 0xf9, 0xf,
-    0x90, 0xfc, 0x2f, 0xa0, 0xcd, 0x3f, 0x50, 0xfc,
-    0x2f, 0xa0, 0x8f, 0x8f, 0x20, 0xfc, 0x2f, 0xa0,
-    0x4f, 0xee, 0x0, 0xfc, 0x2f, 0xa0, 0xf, 0xfa,
-    0x0, 0xfc, 0x2f, 0xa0, 0xc, 0xf6, 0x0, 0xfc,
-    0x2f, 0xa0, 0x8, 0xf2, 0x0, 0xfc, 0x2f, 0xa0,
-    0x4, 0xe0, 0x0, 0xfc, 0x2f, 0xa0, 0x0, 0xa0,
-    0x0, 0xfc,
+    0x2f, 0xf1, 0x0, 0x74, 0x7e, 0x0, 0x48, 0x1,
+    0xc8, 0x1, 0xd8, 0x1, 0xc6, 0x1, 0xc8, 0x1,
+    0x90, 0x3, 0xc2, 0x40, 0x16, 0x0, 0x71, 0x2,
+    0x0, 0x48, 0x40, 0x19, 0x83, 0x0, 0x23, 0x70,
+    0xc, 0x28, 0xe0, 0x4, 0xc, 0x0, 0xec, 0x21,
+    0x3, 0x4, 0x0, 0xe4, 0x4, 0xc, 0x22, 0x0,
+    0x71, 0x86, 0x2, 0x20, 0x3, 0xe3, 0x43, 0xc,
+    0x0, 0xf9, 0xa, 0xc1, 0xc0, 0x3e, 0xc0, 0x61,
+    0x20, 0xf, 0x90, 0x5, 0x0, 0x3f, 0x8c, 0x30,
+    0x3, 0xf9, 0x1, 0x0, 0x3f, 0xb0, 0x48, 0x3,
+    0xf9, 0x10, 0x1, 0xc0,
 
     /* U+004E "N" */
-    0x2f, 0xf1, 0x0, 0x0, 0x2, 0xfc, 0x2f, 0xf7,
-    0x0, 0x0, 0x2, 0xfc, 0x2f, 0xfe, 0x0, 0x0,
-    0x2, 0xfc, 0x2f, 0xff, 0x70, 0x0, 0x2, 0xfc,
-    0x2f, 0xff, 0xe0, 0x0, 0x2, 0xfc, 0x2f, 0xcc,
-    0xf6, 0x0, 0x2, 0xfc, 0x2f, 0xc5, 0xfd, 0x0,
-    0x2, 0xfc, 0x2f, 0xc0, 0xdf, 0x50, 0x2, 0xfc,
-    0x2f, 0xc0, 0x5f, 0xd0, 0x2, 0xfc, 0x2f, 0xc0,
-    0xd, 0xf5, 0x2, 0xfc, 0x2f, 0xc0, 0x5, 0xfc,
-    0x2, 0xfc, 0x2f, 0xc0, 0x0, 0xdf, 0x42, 0xfc,
-    0x2f, 0xc0, 0x0, 0x5f, 0xc2, 0xfc, 0x2f, 0xc0,
-    0x0, 0xd, 0xf5, 0xfc, 0x2f, 0xc0, 0x0, 0x5,
-    0xfd, 0xfc, 0x2f, 0xc0, 0x0, 0x0, 0xdf, 0xfc,
-    0x2f, 0xc0, 0x0, 0x0, 0x6f, 0xfc, 0x2f, 0xc0,
-    0x0, 0x0, 0xd, 0xfc, 0x2f, 0xc0, 0x0, 0x0,
-    0x6, 0xfc,
+    0x2f, 0xf0, 0x80, 0x71, 0x7e, 0x0, 0x4c, 0x1,
+    0xff, 0x48, 0x7, 0xfc, 0x2e, 0x1, 0xff, 0x48,
+    0x7, 0xf1, 0x98, 0x58, 0x3, 0xfa, 0x42, 0xc0,
+    0x3f, 0x94, 0x88, 0xa0, 0x1f, 0xd0, 0x10, 0x1,
+    0xfc, 0xa4, 0x45, 0x0, 0xfe, 0x80, 0x90, 0xf,
+    0xe5, 0x23, 0x40, 0xf, 0xe8, 0x8, 0x0, 0xfe,
+    0x52, 0x37, 0x0, 0xfe, 0x80, 0x80, 0xf, 0xe5,
+    0x22, 0x0, 0x7f, 0xac, 0x3, 0xfe, 0x62, 0x0,
+    0xff, 0xac, 0x0,
 
     /* U+004F "O" */
-    0x0, 0x3, 0xae, 0xfd, 0x70, 0x0, 0x0, 0x4,
-    0xff, 0xdb, 0xef, 0xd1, 0x0, 0x1, 0xff, 0x50,
-    0x0, 0x9f, 0xb0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0xdf, 0x30, 0xf, 0xf1, 0x0, 0x0, 0x5, 0xfa,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x8f,
-    0x70, 0x0, 0x0, 0x0, 0xdf, 0x1a, 0xf5, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0xaf, 0x5c, 0xf3, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0xbf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0x5a,
-    0xf5, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x8f, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0x14, 0xfa, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0xf, 0xf0, 0x0, 0x0, 0x6,
-    0xfa, 0x0, 0x9f, 0x70, 0x0, 0x0, 0xdf, 0x30,
-    0x1, 0xff, 0x50, 0x0, 0xaf, 0xb0, 0x0, 0x4,
-    0xff, 0xdb, 0xef, 0xd1, 0x0, 0x0, 0x3, 0xae,
-    0xfd, 0x80, 0x0, 0x0,
+    0x0, 0x8e, 0xbb, 0xf5, 0xc0, 0x3c, 0x98, 0xa6,
+    0x87, 0x1a, 0x20, 0x10, 0xd8, 0x56, 0xdf, 0x31,
+    0x50, 0x5, 0x0, 0xea, 0x1, 0x49, 0x21, 0x80,
+    0x18, 0x24, 0x3, 0xa0, 0x24, 0x10, 0x10, 0x40,
+    0x39, 0x41, 0x3, 0x3, 0x0, 0x3e, 0x21, 0x11,
+    0x1, 0x0, 0x7c, 0xc0, 0xa2, 0x2, 0x1, 0xf0,
+    0x80, 0xb8, 0x38, 0x7, 0xc6, 0x6, 0xe0, 0xe0,
+    0x1f, 0x18, 0x18, 0x80, 0x80, 0x7c, 0x20, 0x24,
+    0x4, 0x1, 0xf3, 0x2, 0xe0, 0x68, 0x7, 0x84,
+    0x84, 0x48, 0xa, 0x1, 0xe7, 0x4, 0x0, 0x30,
+    0x38, 0x7, 0x58, 0x48, 0x2, 0x2, 0x14, 0x2,
+    0xa2, 0x43, 0x0, 0xd, 0x85, 0x6d, 0xf2, 0x95,
+    0x0, 0x64, 0xc5, 0x34, 0x37, 0xd1, 0x0,
 
     /* U+0050 "P" */
-    0x2f, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x2, 0xfe,
-    0xbb, 0xbb, 0xcf, 0xfa, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x2c, 0xf7, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0xbf,
-    0x22, 0xfc, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0xbf, 0x22, 0xfc, 0x0,
-    0x0, 0x0, 0x1f, 0xd0, 0x2f, 0xc0, 0x0, 0x0,
-    0x2d, 0xf6, 0x2, 0xfe, 0xbb, 0xbb, 0xcf, 0xf8,
-    0x0, 0x2f, 0xff, 0xff, 0xfe, 0xa4, 0x0, 0x2,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x75, 0xa8, 0x7, 0xa, 0x26, 0x24,
+    0xaa, 0x0, 0x62, 0xbb, 0xd9, 0xa6, 0xae, 0x1,
+    0xfc, 0x5a, 0x12, 0x1, 0xfe, 0x14, 0x12, 0x0,
+    0xff, 0x10, 0x8, 0x7, 0xf8, 0x80, 0x40, 0x3f,
+    0x85, 0x8, 0x80, 0x1f, 0x8b, 0x2, 0xc0, 0x22,
+    0xbb, 0xd9, 0xa4, 0xec, 0x1, 0xa, 0x26, 0x25,
+    0xb8, 0x0, 0xc7, 0xff, 0xba, 0x90, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xc7,
 
     /* U+0051 "Q" */
-    0x0, 0x3, 0xae, 0xfd, 0x70, 0x0, 0x0, 0x4,
-    0xff, 0xdb, 0xef, 0xd1, 0x0, 0x1, 0xff, 0x50,
-    0x0, 0x9f, 0xb0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0xdf, 0x30, 0xf, 0xf1, 0x0, 0x0, 0x5, 0xfa,
-    0x4, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x8f,
-    0x70, 0x0, 0x0, 0x0, 0xdf, 0x1a, 0xf5, 0x0,
-    0x0, 0x0, 0xb, 0xf4, 0xbf, 0x40, 0x0, 0x0,
-    0x0, 0xaf, 0x5c, 0xf3, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0xbf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0x5a,
-    0xf5, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x8f, 0x70,
-    0x0, 0x0, 0x0, 0xdf, 0x14, 0xfa, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0xf, 0xf0, 0x0, 0x5, 0x6,
-    0xfa, 0x0, 0x9f, 0x70, 0x9, 0xf4, 0xdf, 0x30,
-    0x1, 0xff, 0x50, 0x1f, 0xff, 0xb0, 0x0, 0x4,
-    0xff, 0xdb, 0xff, 0xf1, 0x0, 0x0, 0x3, 0xae,
-    0xfd, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xee, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0x90,
-    0x0,
+    0x0, 0x8e, 0xbb, 0xf5, 0xc0, 0x3c, 0x98, 0xa6,
+    0x87, 0x1a, 0x20, 0x10, 0xd8, 0x56, 0xdf, 0x31,
+    0x50, 0x5, 0x0, 0xea, 0x1, 0x49, 0x21, 0x80,
+    0x18, 0x24, 0x3, 0xa0, 0x24, 0x10, 0x10, 0x40,
+    0x39, 0x41, 0x3, 0x3, 0x0, 0x3e, 0x21, 0x11,
+    0x1, 0x0, 0x7c, 0xc0, 0xa2, 0x2, 0x1, 0xf0,
+    0x80, 0xb8, 0x38, 0x7, 0xc6, 0x6, 0xe0, 0xe0,
+    0x1f, 0x18, 0x18, 0x80, 0x80, 0x7c, 0x20, 0x24,
+    0x4, 0x1, 0xf3, 0x2, 0xe0, 0x68, 0x7, 0x84,
+    0x84, 0x48, 0xa, 0x1, 0x94, 0x1c, 0x10, 0x0,
+    0xc0, 0xe0, 0x9, 0xa4, 0xb0, 0x90, 0x4, 0x4,
+    0x28, 0x40, 0x59, 0x21, 0x80, 0x6, 0xc2, 0xb6,
+    0x80, 0x2a, 0x0, 0xc9, 0x8a, 0x68, 0x40, 0x5,
+    0x0, 0xe3, 0xae, 0xfd, 0xe1, 0xa1, 0x0, 0xfe,
+    0x1a, 0x71, 0x0,
 
     /* U+0052 "R" */
-    0x2f, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0x2, 0xfe,
-    0xbb, 0xbb, 0xdf, 0xfa, 0x0, 0x2f, 0xc0, 0x0,
-    0x0, 0x2d, 0xf6, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x2f, 0xc0, 0x0, 0x0, 0x0, 0xdf,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x2f,
-    0xc0, 0x0, 0x0, 0x0, 0xdf, 0x2, 0xfc, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x2f, 0xc0, 0x0, 0x1,
-    0x7f, 0xf3, 0x2, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x2f, 0xeb, 0xbc, 0xff, 0x50, 0x0, 0x2,
-    0xfc, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x2f, 0xc0,
-    0x0, 0x3f, 0xc0, 0x0, 0x2, 0xfc, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x2f, 0xc0, 0x0, 0x4, 0xfc,
-    0x0, 0x2, 0xfc, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x2f, 0xc0, 0x0, 0x0, 0x4f, 0xc0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x2f, 0xc0, 0x0,
-    0x0, 0x4, 0xfc, 0x0,
+    0x2f, 0xff, 0x75, 0xa8, 0x7, 0xa, 0x26, 0x34,
+    0xaa, 0x0, 0x62, 0xbb, 0xdb, 0xa2, 0x56, 0x0,
+    0xfe, 0x2e, 0xb, 0x0, 0xff, 0x19, 0x10, 0x3,
+    0xfe, 0x60, 0x10, 0xf, 0xf3, 0x0, 0x80, 0x7f,
+    0x29, 0x20, 0x7, 0xe1, 0x7a, 0x8, 0x0, 0x8f,
+    0xff, 0x74, 0xd, 0x98, 0x4, 0x28, 0x83, 0x0,
+    0x57, 0x20, 0x6, 0x2b, 0xb6, 0x20, 0x8, 0x7,
+    0xfa, 0x2, 0x0, 0x3f, 0xc6, 0x86, 0x80, 0x1f,
+    0xef, 0x8, 0x0, 0xff, 0x21, 0x99, 0x0, 0x3f,
+    0xd0, 0x10, 0x1, 0xfe, 0x43, 0x32, 0x0, 0x7f,
+    0xa0, 0x20, 0x0,
 
     /* U+0053 "S" */
-    0x0, 0x5, 0xce, 0xfd, 0x81, 0x0, 0x0, 0x9f,
-    0xfc, 0xbe, 0xfe, 0x20, 0x5, 0xfd, 0x10, 0x0,
-    0x9f, 0xb0, 0xa, 0xf5, 0x0, 0x0, 0x5, 0x10,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfc, 0x40, 0x0, 0x0,
-    0x0, 0x3, 0xdf, 0xfc, 0x40, 0x0, 0x0, 0x0,
-    0x5, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfc, 0x0, 0x20, 0x0, 0x0,
-    0x3, 0xfc, 0x1f, 0xe1, 0x0, 0x0, 0x7, 0xf9,
-    0x9, 0xfd, 0x30, 0x0, 0x4f, 0xf3, 0x0, 0xaf,
-    0xfd, 0xbd, 0xff, 0x60, 0x0, 0x4, 0xbe, 0xfe,
-    0xa3, 0x0,
+    0x0, 0x97, 0x3b, 0xf6, 0x4, 0x3, 0x4d, 0x19,
+    0x21, 0xbf, 0x90, 0x1, 0x58, 0xbb, 0x2f, 0x98,
+    0x64, 0x1, 0xe1, 0x2, 0x1, 0x4d, 0x50, 0x0,
+    0x20, 0xc0, 0x1c, 0xa2, 0x0, 0x20, 0xb0, 0xf,
+    0xeb, 0x7, 0x60, 0xf, 0xc5, 0x21, 0x38, 0x80,
+    0x1f, 0x36, 0x11, 0xde, 0x20, 0x7, 0x8f, 0x68,
+    0x8e, 0xe4, 0x3, 0xe5, 0xda, 0x16, 0xa0, 0xf,
+    0xcb, 0x82, 0xa8, 0x1, 0xf8, 0xa0, 0x38, 0x3,
+    0xf9, 0x1, 0x80, 0x4, 0x1, 0xe1, 0x0, 0xf,
+    0xe0, 0x80, 0x72, 0x2, 0x8b, 0xe, 0x18, 0x4,
+    0x90, 0x14, 0x12, 0xa5, 0x9b, 0x7b, 0x61, 0x26,
+    0x0, 0xab, 0x43, 0x43, 0x5c, 0x60,
 
     /* U+0054 "T" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc,
-    0xcc, 0xcc, 0xef, 0xdc, 0xcc, 0xc8, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0,
+    0xf, 0xff, 0xfd, 0x40, 0x67, 0xc2, 0x4, 0x67,
+    0x88, 0x33, 0x39, 0x2, 0x73, 0x34, 0x0, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xe0,
 
     /* U+0055 "U" */
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0x4a, 0xf4,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0xaf, 0x4a, 0xf4, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0xaf, 0x40, 0x0, 0x0, 0x0, 0xaf,
-    0x4a, 0xf4, 0x0, 0x0, 0x0, 0xa, 0xf4, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0xaf, 0x4a, 0xf4, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0xaf, 0x4a, 0xf4, 0x0, 0x0, 0x0, 0xa,
-    0xf4, 0xaf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0x49,
-    0xf4, 0x0, 0x0, 0x0, 0xa, 0xf3, 0x9f, 0x40,
-    0x0, 0x0, 0x0, 0xaf, 0x27, 0xf6, 0x0, 0x0,
-    0x0, 0xc, 0xf1, 0x5f, 0x90, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0xff, 0x10, 0x0, 0x0, 0x7f, 0xa0,
-    0x8, 0xfc, 0x20, 0x0, 0x5f, 0xf2, 0x0, 0xb,
-    0xff, 0xcb, 0xef, 0xf6, 0x0, 0x0, 0x6, 0xce,
-    0xfd, 0xa3, 0x0, 0x0,
+    0xaf, 0x40, 0xf, 0xab, 0xd0, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xeb, 0x30, 0xf, 0xf9, 0xc0, 0x3f,
+    0xf0, 0xf0, 0x10, 0x7, 0xcc, 0x6, 0x41, 0xe0,
+    0x1f, 0x18, 0x89, 0x41, 0x84, 0x3, 0x9c, 0x10,
+    0x0, 0xe1, 0xa4, 0x1, 0x2c, 0x4, 0x0, 0x21,
+    0xf, 0x72, 0xfa, 0x82, 0x48, 0x2, 0xb9, 0x32,
+    0x43, 0x5c, 0x60, 0x0,
 
     /* U+0056 "V" */
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x12,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0xd,
-    0xf1, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x7f,
-    0x60, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x2, 0xfb,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0xd, 0xf1,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0xbf, 0x20, 0x0, 0x2, 0xfb, 0x0,
-    0x0, 0x1f, 0xc0, 0x0, 0x0, 0xd, 0xf0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0xbf, 0x20, 0x0, 0x0, 0x2, 0xfa, 0x0, 0xf,
-    0xc0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x5, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0xaf, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xf9, 0xe, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xe4, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x20, 0x0, 0x0, 0x0,
+    0x7f, 0x70, 0xf, 0xed, 0xf1, 0x50, 0xb0, 0xf,
+    0xc4, 0x43, 0x12, 0x21, 0x88, 0x7, 0xca, 0x16,
+    0x0, 0xa0, 0x70, 0xf, 0xac, 0x18, 0x0, 0xa1,
+    0xa0, 0x1e, 0x13, 0x30, 0x80, 0x8, 0x88, 0x20,
+    0x1c, 0xe1, 0x60, 0x19, 0x41, 0xc0, 0x3b, 0x41,
+    0x40, 0x35, 0x6, 0x80, 0x61, 0x43, 0x20, 0xc,
+    0x44, 0x40, 0xc, 0xe1, 0x60, 0x1e, 0x50, 0x50,
+    0xb, 0x41, 0x40, 0x3d, 0x41, 0xe0, 0x12, 0x19,
+    0x0, 0x78, 0x88, 0xa0, 0x5, 0xb, 0x0, 0xfc,
+    0xa0, 0x81, 0xe0, 0xa0, 0x1f, 0xa8, 0x34, 0x10,
+    0xc8, 0x3, 0xf1, 0x11, 0xd0, 0x6c, 0x3, 0xfc,
+    0xa3, 0xe0, 0xa0, 0x1f, 0xeb, 0x4, 0x32, 0x0,
+    0xff, 0x19, 0x5, 0x80, 0x7f, 0xe5, 0x5, 0x0,
+    0xf0,
 
     /* U+0057 "W" */
-    0x8f, 0x50, 0x0, 0x8f, 0x30, 0x0, 0xaf, 0x25,
-    0xf7, 0x0, 0xa, 0xf5, 0x0, 0xd, 0xf0, 0x3f,
-    0x90, 0x0, 0xdf, 0x80, 0x0, 0xfd, 0x0, 0xfc,
-    0x0, 0xf, 0xfb, 0x0, 0x2f, 0xa0, 0xd, 0xe0,
-    0x2, 0xff, 0xd0, 0x4, 0xf8, 0x0, 0xbf, 0x0,
-    0x5f, 0xdf, 0x0, 0x6f, 0x50, 0x8, 0xf3, 0x7,
-    0xf8, 0xf2, 0x9, 0xf2, 0x0, 0x6f, 0x50, 0xaf,
-    0x4f, 0x50, 0xbf, 0x0, 0x3, 0xf7, 0xc, 0xc1,
-    0xf8, 0xd, 0xd0, 0x0, 0x1f, 0xa0, 0xf9, 0xf,
-    0xa0, 0xfb, 0x0, 0x0, 0xec, 0x1f, 0x70, 0xcd,
-    0x2f, 0x80, 0x0, 0xc, 0xe4, 0xf4, 0x9, 0xf5,
-    0xf6, 0x0, 0x0, 0x9f, 0x8f, 0x10, 0x7f, 0x9f,
-    0x30, 0x0, 0x6, 0xfc, 0xe0, 0x4, 0xfe, 0xf0,
-    0x0, 0x0, 0x4f, 0xfc, 0x0, 0x2f, 0xfe, 0x0,
-    0x0, 0x1, 0xff, 0x90, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0xf, 0xf6, 0x0, 0xc, 0xf9, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0xa, 0xf1, 0x0, 0x7, 0xf4, 0x0, 0x0,
+    0x8f, 0x50, 0xa, 0x3c, 0xc0, 0x2a, 0xf2, 0xd0,
+    0x20, 0x8, 0x81, 0x80, 0x27, 0x2, 0x60, 0xe0,
+    0x9, 0xc3, 0x40, 0x22, 0x20, 0x18, 0x28, 0x4,
+    0x40, 0x60, 0x2, 0x7, 0x0, 0x11, 0x0, 0x4,
+    0x0, 0x60, 0x3, 0x1, 0x0, 0x18, 0x40, 0xe,
+    0x4, 0x40, 0x1, 0x6, 0x80, 0xc, 0xc, 0x8,
+    0x14, 0x8, 0x3c, 0x1c, 0x1, 0xc0, 0xc1, 0xa1,
+    0x80, 0xe0, 0x40, 0x40, 0x5, 0x2, 0x6, 0x35,
+    0xd, 0x6, 0x20, 0x8, 0x83, 0x40, 0xd4, 0x40,
+    0x80, 0x98, 0x2, 0x11, 0x30, 0x87, 0x1, 0xb9,
+    0x1, 0x80, 0x62, 0x22, 0x81, 0x82, 0x93, 0x87,
+    0x0, 0x65, 0x1c, 0x5, 0xe, 0xc, 0x5, 0x0,
+    0xde, 0x8, 0x22, 0x3, 0x7, 0x3, 0x0, 0xc4,
+    0x6, 0x40, 0x6, 0x1, 0x10, 0x7, 0x28, 0x1,
+    0x40, 0x4, 0x0, 0x50, 0xe, 0x10, 0x7, 0x80,
+    0x46, 0x4, 0x1, 0xe3, 0x2, 0x0, 0x98, 0x3c,
+    0x3, 0xcc, 0xa, 0x1, 0x68, 0x10, 0x4,
 
     /* U+0058 "X" */
-    0x6, 0xf9, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0xdf, 0x20, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x5f,
-    0xb0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0xa, 0xf3, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x2f, 0xd3, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xc5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0xdf, 0x20, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x4f,
-    0xa0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x2f, 0xb0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0x0, 0xaf, 0x50, 0x4,
-    0xfa, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x6, 0xf9, 0x0, 0xf0, 0xfe, 0x80, 0x18, 0x98,
+    0x80, 0x3a, 0x2, 0x0, 0x28, 0x9, 0x0, 0xc4,
+    0xc6, 0xa0, 0x12, 0x9a, 0x18, 0x5, 0x1, 0xe0,
+    0x1d, 0xe1, 0xe0, 0x2, 0x55, 0x18, 0x7, 0x1a,
+    0x9a, 0x4, 0x85, 0x80, 0x7d, 0x1, 0x26, 0x8e,
+    0x20, 0x1f, 0x13, 0x96, 0xc, 0x0, 0x7f, 0x48,
+    0x2, 0x40, 0x3f, 0xc2, 0x1, 0xff, 0xc1, 0x60,
+    0x4, 0x8, 0x7, 0xf4, 0x1d, 0x4, 0x0, 0x7e,
+    0x81, 0x85, 0x26, 0x20, 0xf, 0xb, 0x9a, 0x4,
+    0x84, 0x0, 0x7a, 0x3, 0xc0, 0x8, 0x85, 0x30,
+    0xc, 0x4c, 0x86, 0x1, 0x40, 0x78, 0x6, 0x90,
+    0x80, 0xc, 0x6a, 0x6a, 0x0, 0x44, 0x29, 0x80,
+    0x74, 0x4, 0x0, 0x24, 0x20, 0x3, 0xc4, 0xc4,
+    0xe0,
 
     /* U+0059 "Y" */
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x9f, 0x64, 0xfc,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0xc, 0xf3, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0x5f, 0xa0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x5f, 0x80,
-    0x0, 0x6, 0xf7, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0xe, 0xe0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x7f,
-    0x50, 0xaf, 0x20, 0x0, 0x0, 0x0, 0xfc, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x0,
+    0xbf, 0x50, 0xf, 0xa7, 0xdb, 0xc2, 0x40, 0x3e,
+    0x61, 0x64, 0x33, 0x80, 0x39, 0xc2, 0x40, 0x12,
+    0x12, 0x1, 0xd2, 0x2e, 0x0, 0x52, 0x51, 0x0,
+    0x94, 0x58, 0x3, 0x58, 0x30, 0x5, 0x21, 0x20,
+    0x19, 0x86, 0x40, 0x6, 0x66, 0x10, 0xe, 0x91,
+    0x50, 0x90, 0xb0, 0xf, 0x38, 0x48, 0xaa, 0x88,
+    0x3, 0xe7, 0x3d, 0x9, 0x0, 0xfd, 0x20, 0x68,
+    0x60, 0x1f, 0x85, 0x43, 0x80, 0x3f, 0xc6, 0x2,
+    0x1, 0xff, 0xff, 0x0, 0xfc,
 
     /* U+005A "Z" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xc2, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30,
+    0xf, 0xff, 0xf9, 0x40, 0xcf, 0xf8, 0x0, 0xc1,
+    0x99, 0xf9, 0x1, 0x8c, 0x3, 0xf1, 0x38, 0xc0,
+    0x7, 0xf4, 0x84, 0x8, 0x7, 0xe5, 0x43, 0x60,
+    0xf, 0xe8, 0xf, 0x0, 0xfe, 0x82, 0x63, 0x0,
+    0xfc, 0x4e, 0x30, 0x1, 0xfd, 0x21, 0x2, 0x1,
+    0xf9, 0x50, 0xd8, 0x3, 0xfa, 0x3, 0xc0, 0x3f,
+    0xa0, 0x98, 0xc0, 0x3f, 0x13, 0x8c, 0x0, 0x7f,
+    0x48, 0x40, 0x80, 0x7e, 0x54, 0x36, 0x0, 0xfe,
+    0x80, 0xf0, 0xf, 0xe7, 0x20, 0xfc, 0xcf, 0xc5,
+    0xa0, 0x3, 0x3f, 0xe1,
 
     /* U+005B "[" */
-    0x5f, 0xff, 0xff, 0x55, 0xfd, 0xaa, 0xa3, 0x5f,
-    0x90, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x5f, 0x90, 0x0,
-    0x5, 0xf9, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x5f, 0x90, 0x0, 0x5, 0xf9, 0x0,
-    0x0, 0x5f, 0x90, 0x0, 0x5, 0xf9, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x5f,
-    0x90, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x5f, 0x90,
-    0x0, 0x5, 0xff, 0xff, 0xf5, 0x3b, 0xbb, 0xbb,
-    0x30,
+    0x5f, 0xfe, 0x50, 0x1, 0x2a, 0xcc, 0x0, 0x4a,
+    0xa8, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfe, 0x96,
+    0xff, 0x95, 0x91, 0x39, 0x80,
 
     /* U+005C "\\" */
-    0x8f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x18, 0x40,
+    0x8f, 0x50, 0xf, 0xf4, 0x84, 0x80, 0x7f, 0x85,
+    0xcd, 0x0, 0x3f, 0xd2, 0x10, 0x1, 0xfe, 0x16,
+    0x33, 0x0, 0x7f, 0xac, 0x20, 0x3, 0xfc, 0x4a,
+    0x84, 0x1, 0xfe, 0x90, 0x80, 0xf, 0xf1, 0xa2,
+    0x90, 0x7, 0xfb, 0xc2, 0xc0, 0x3f, 0xc8, 0x6c,
+    0x20, 0x1f, 0xe9, 0x9, 0x0, 0xff, 0x29, 0x38,
+    0x7, 0xfd, 0x0, 0xe0, 0x1f, 0xe5, 0x19, 0x0,
+    0xff, 0xa0, 0x58, 0x3, 0xfc, 0xc3, 0x60, 0x1f,
+    0xf4, 0x92, 0x80, 0x7f, 0x98, 0x20, 0x3, 0xfc,
+    0x2e, 0x48, 0x1, 0xfe, 0x90, 0x80, 0xf, 0xf0,
+    0xb1, 0x98, 0x3, 0xfd, 0xe, 0xe0,
 
     /* U+005D "]" */
-    0x5f, 0xff, 0xff, 0x53, 0xaa, 0xad, 0xf5, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x9f, 0x50, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x9f,
-    0x50, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x9,
-    0xf5, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x9, 0xf5,
-    0x0, 0x0, 0x9f, 0x50, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x9f, 0x50, 0x0, 0x9, 0xf5, 0x0, 0x0,
-    0x9f, 0x55, 0xff, 0xff, 0xf5, 0x3b, 0xbb, 0xbb,
-    0x30,
+    0x5f, 0xfe, 0x56, 0x55, 0x88, 0x0, 0x75, 0x52,
+    0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfd, 0x2b, 0xff,
+    0x30, 0x1, 0x91, 0x39, 0x80,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x6, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x5f, 0xe5, 0xfe,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0xb, 0xf8, 0x0,
-    0x0, 0x7, 0xfb, 0x0, 0x2f, 0xf1, 0x0, 0x1,
-    0xef, 0x20, 0x0, 0x8f, 0x90, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0xef, 0x20, 0x1f, 0xe0, 0x0, 0x0,
-    0x5, 0xfb, 0x9, 0xf5, 0x0, 0x0, 0x0, 0xb,
-    0xf4,
+    0x0, 0xe6, 0x83, 0x0, 0xfe, 0x49, 0x7e, 0x0,
+    0xfe, 0x90, 0x1, 0x30, 0x7, 0xca, 0x43, 0x41,
+    0x0, 0x1f, 0x58, 0x5a, 0xa0, 0xc0, 0x7, 0x38,
+    0xa2, 0x84, 0x83, 0x88, 0x4, 0x32, 0x12, 0x0,
+    0x27, 0x8, 0x0, 0xa4, 0x5c, 0x80, 0x28, 0x16,
+    0x20, 0x17, 0x18, 0x0, 0xeb, 0x9, 0x8, 0xb,
+    0x0, 0xf2, 0xa2, 0x40,
 
     /* U+005F "_" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0,
+    0x1, 0x1f, 0xfe, 0x28, 0x37, 0x77, 0xff, 0x14,
+    0x3, 0xff, 0x90,
 
     /* U+0060 "`" */
-    0x7, 0xff, 0x50, 0x0, 0x0, 0x4f, 0xf4, 0x0,
-    0x0, 0x2, 0xdf, 0x40, 0x0, 0x0, 0x1b, 0xf3,
+    0x7, 0xff, 0x28, 0x6, 0x7b, 0xa, 0x40, 0xc,
+    0x9a, 0x56, 0x80, 0x18, 0xb1, 0x2c, 0xc0,
 
     /* U+0061 "a" */
-    0x0, 0x5, 0xad, 0xfe, 0xb4, 0x0, 0x1, 0xdf,
-    0xfc, 0xac, 0xff, 0x60, 0x0, 0xc7, 0x10, 0x0,
-    0x2e, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x29,
-    0xdf, 0xec, 0x87, 0xf6, 0x4, 0xff, 0xda, 0xad,
-    0xff, 0xf6, 0xe, 0xf5, 0x0, 0x0, 0x2b, 0xf6,
-    0x4f, 0x80, 0x0, 0x0, 0x5, 0xf6, 0x6f, 0x60,
-    0x0, 0x0, 0x5, 0xf6, 0x4f, 0x90, 0x0, 0x0,
-    0x9, 0xf6, 0xf, 0xf4, 0x0, 0x1, 0xaf, 0xf6,
-    0x5, 0xff, 0xda, 0xbf, 0xfb, 0xf6, 0x0, 0x3b,
-    0xef, 0xe9, 0x25, 0xf6,
+    0x0, 0x96, 0xb7, 0xfa, 0xd0, 0x2, 0x1d, 0xa5,
+    0x15, 0x24, 0xb6, 0x0, 0x8, 0xa3, 0xb2, 0xb3,
+    0x46, 0x40, 0x2c, 0x71, 0x0, 0x89, 0x81, 0x0,
+    0x3f, 0xb8, 0x8, 0x0, 0x53, 0xbf, 0xd9, 0x2,
+    0x1, 0x26, 0xb0, 0x2a, 0xb, 0xc0, 0x5, 0x41,
+    0x5b, 0x54, 0xdd, 0x20, 0x1, 0x5, 0xd4, 0x3,
+    0x17, 0x0, 0x8, 0x38, 0x3, 0xf8, 0x83, 0xc0,
+    0x3d, 0x80, 0x4, 0x6, 0x40, 0x8, 0x69, 0x80,
+    0x2a, 0xb, 0xda, 0xbe, 0x54, 0x0, 0x97, 0x10,
+    0xd5, 0x4d, 0xbc, 0x0,
 
     /* U+0062 "b" */
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x7d, 0xfe, 0xb4, 0x0, 0x0, 0xfe, 0xdf,
-    0xdb, 0xcf, 0xf9, 0x0, 0xf, 0xfe, 0x40, 0x0,
-    0x2d, 0xf6, 0x0, 0xff, 0x10, 0x0, 0x0, 0x2f,
-    0xe0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0xbf, 0x40,
-    0xfd, 0x0, 0x0, 0x0, 0x7, 0xf7, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x6f, 0x90, 0xfd, 0x0, 0x0,
-    0x0, 0x6, 0xf9, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x8f, 0x80, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xf, 0xf2, 0x0, 0x0, 0x3, 0xff, 0x0, 0xff,
-    0xe4, 0x0, 0x2, 0xdf, 0x80, 0xf, 0xed, 0xfd,
-    0xbc, 0xff, 0xb0, 0x0, 0xfd, 0x8, 0xdf, 0xfc,
-    0x60, 0x0,
+    0x0, 0x8, 0x7, 0xfd, 0x58, 0x1, 0xff, 0x28,
+    0x7, 0xff, 0xa9, 0xf7, 0xfa, 0xd0, 0x3, 0x8f,
+    0x60, 0x10, 0x92, 0xe4, 0x3, 0x9, 0xde, 0xde,
+    0x69, 0x33, 0x0, 0x37, 0xa0, 0x4, 0x5e, 0x10,
+    0x1, 0x10, 0x80, 0x71, 0x20, 0xa0, 0x7, 0xfb,
+    0x0, 0xc0, 0x3f, 0xc2, 0x1c, 0x1, 0xff, 0xcb,
+    0xe0, 0x10, 0xf, 0xf2, 0x6, 0x80, 0x8, 0x80,
+    0x1c, 0x66, 0x5, 0x0, 0xb1, 0x0, 0x22, 0xe0,
+    0x70, 0x8, 0x4e, 0xf6, 0xf3, 0x49, 0x20, 0x2,
+    0x3d, 0x70, 0x43, 0x34, 0xd8, 0x0,
 
     /* U+0063 "c" */
-    0x0, 0x18, 0xdf, 0xeb, 0x50, 0x0, 0x2e, 0xfe,
-    0xbc, 0xff, 0x80, 0xd, 0xf7, 0x0, 0x2, 0xef,
-    0x35, 0xfa, 0x0, 0x0, 0x3, 0x30, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xa0, 0x0, 0x0, 0x38, 0x20, 0xdf, 0x70, 0x0,
-    0x2d, 0xf4, 0x3, 0xef, 0xeb, 0xcf, 0xf8, 0x0,
-    0x1, 0x9e, 0xfe, 0xb4, 0x0,
+    0x0, 0xc, 0x6f, 0xf5, 0xa8, 0x4, 0x5e, 0xe6,
+    0x84, 0x95, 0x0, 0xf, 0x18, 0xeb, 0xcd, 0x17,
+    0x35, 0x25, 0x70, 0x8, 0xb7, 0xf, 0xc3, 0x80,
+    0x38, 0xcc, 0xe, 0xa, 0x1, 0xf8, 0xc0, 0x40,
+    0x3f, 0x8, 0x7, 0xf8, 0x80, 0x40, 0x3f, 0x30,
+    0x28, 0x7, 0xed, 0xe, 0x0, 0xe3, 0x82, 0x62,
+    0x57, 0x0, 0x8b, 0x9d, 0x83, 0x86, 0x3a, 0xf3,
+    0x49, 0xd0, 0xf, 0xd8, 0x10, 0x92, 0xe0, 0x0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xca, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x7, 0xdf, 0xfc,
-    0x74, 0xfa, 0x2, 0xdf, 0xfb, 0xbe, 0xff, 0xfa,
-    0xc, 0xfa, 0x0, 0x0, 0x6f, 0xfa, 0x5f, 0xc0,
-    0x0, 0x0, 0x6, 0xfa, 0xaf, 0x50, 0x0, 0x0,
-    0x3, 0xfa, 0xdf, 0x10, 0x0, 0x0, 0x3, 0xfa,
-    0xef, 0x0, 0x0, 0x0, 0x3, 0xfa, 0xef, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0xdf, 0x20, 0x0, 0x0,
-    0x3, 0xfa, 0xaf, 0x70, 0x0, 0x0, 0x3, 0xfa,
-    0x5f, 0xe1, 0x0, 0x0, 0x7, 0xfa, 0xc, 0xfc,
-    0x20, 0x0, 0x6f, 0xfa, 0x1, 0xdf, 0xfc, 0xbe,
-    0xfd, 0xfa, 0x0, 0x7, 0xdf, 0xfc, 0x64, 0xfa,
+    0x0, 0xff, 0x84, 0x3, 0xf8, 0x72, 0xc0, 0x3f,
+    0x88, 0xc0, 0x3f, 0xfb, 0x8f, 0xbf, 0xec, 0x77,
+    0x0, 0x45, 0xb0, 0x48, 0x82, 0x8b, 0x0, 0xb8,
+    0x97, 0xee, 0xdd, 0x20, 0x12, 0x99, 0xa8, 0x3,
+    0x34, 0x80, 0x3c, 0x24, 0x3, 0xca, 0x0, 0x70,
+    0x40, 0xf, 0xe3, 0x1, 0x0, 0xff, 0xe4, 0x98,
+    0x10, 0x7, 0xf3, 0x82, 0x80, 0x7f, 0x78, 0x48,
+    0x80, 0x72, 0x0, 0x14, 0xc7, 0x48, 0x2, 0x68,
+    0x0, 0xb4, 0x8f, 0x72, 0xfa, 0x48, 0x2, 0x1d,
+    0x82, 0x34, 0x29, 0x90, 0x0,
 
     /* U+0065 "e" */
-    0x0, 0x3, 0xad, 0xfe, 0xa3, 0x0, 0x0, 0x7,
-    0xff, 0xdb, 0xdf, 0xf7, 0x0, 0x5, 0xfd, 0x20,
-    0x0, 0x3e, 0xf4, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x4f, 0xb0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0xdf,
-    0x7, 0xf6, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xb2, 0x7f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf5, 0x0, 0x1, 0x83, 0x0, 0x0, 0x5f,
-    0xfe, 0xcd, 0xff, 0xa0, 0x0, 0x0, 0x29, 0xdf,
-    0xeb, 0x40, 0x0,
+    0x0, 0x8e, 0xb7, 0xfa, 0x8c, 0x3, 0x9f, 0x14,
+    0x10, 0xd7, 0x1c, 0x2, 0x58, 0x2d, 0xd5, 0xee,
+    0xc, 0x20, 0x2, 0xc3, 0x8, 0x2, 0x3a, 0xf,
+    0x4, 0x15, 0x10, 0xe, 0x42, 0x40, 0x30, 0xc0,
+    0xf, 0x98, 0xb, 0xc2, 0x7f, 0xfe, 0x40, 0x10,
+    0x9, 0x13, 0xf8, 0x7c, 0x1e, 0xef, 0xf8, 0x90,
+    0x14, 0x3, 0xfc, 0x64, 0x45, 0x0, 0xff, 0x70,
+    0x52, 0x80, 0x43, 0x6, 0x1, 0x1d, 0x5, 0x76,
+    0x6f, 0x3c, 0x80, 0x65, 0xd6, 0x33, 0x92, 0xe8,
+    0x0,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x2a, 0xef, 0xe9, 0x10, 0x0, 0x1e,
-    0xfd, 0xcd, 0xf2, 0x0, 0x5, 0xfa, 0x0, 0x1,
-    0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x2b, 0xbc, 0xfd, 0xbb, 0xb1, 0x0, 0x0,
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x80,
-    0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x6, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x6, 0xf8, 0x0, 0x0, 0x2, 0xbb, 0xff,
-    0xfb, 0xbb, 0x10, 0x4f, 0xff, 0xff, 0xff, 0xf2,
-    0x0,
+    0x0, 0xc5, 0x5d, 0xfd, 0x22, 0x1, 0xe, 0x29,
+    0x9c, 0xc6, 0x1, 0x20, 0xae, 0xe6, 0xf1, 0x0,
+    0x46, 0x4, 0x1, 0x8, 0x7, 0xfe, 0x4f, 0xf4,
+    0x83, 0xff, 0xc4, 0xc, 0x88, 0x30, 0x24, 0x48,
+    0xc0, 0xae, 0xd4, 0xb, 0x77, 0x8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0x9a, 0x57, 0x69, 0x7, 0xbb,
+    0x84, 0x19, 0x10, 0x1, 0x22, 0x46, 0x0,
 
     /* U+0067 "g" */
-    0x0, 0x6, 0xcf, 0xfc, 0x63, 0xfb, 0x1, 0xcf,
-    0xfc, 0xbe, 0xfc, 0xfb, 0xb, 0xf9, 0x0, 0x0,
-    0x6f, 0xfb, 0x5f, 0xc0, 0x0, 0x0, 0x6, 0xfb,
-    0xaf, 0x50, 0x0, 0x0, 0x3, 0xfb, 0xdf, 0x10,
-    0x0, 0x0, 0x3, 0xfb, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0xff, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0xdf, 0x10, 0x0, 0x0, 0x3, 0xfb, 0xaf, 0x60,
-    0x0, 0x0, 0x3, 0xfb, 0x5f, 0xd0, 0x0, 0x0,
-    0x7, 0xfb, 0xb, 0xfc, 0x10, 0x0, 0x7f, 0xfb,
-    0x1, 0xcf, 0xfc, 0xbe, 0xfa, 0xfb, 0x0, 0x7,
-    0xcf, 0xfc, 0x53, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0,
-    0x48, 0xae, 0xfd, 0x20, 0x0, 0x0, 0x1f, 0xeb,
-    0x60, 0x0,
+    0x0, 0x9b, 0x3f, 0xd8, 0xc7, 0xf6, 0x3, 0x92,
+    0x66, 0x42, 0x9f, 0x0, 0xa8, 0xdb, 0xf2, 0xfa,
+    0x4c, 0x0, 0xa8, 0x72, 0x1, 0x9a, 0x40, 0x1e,
+    0x12, 0x1, 0xe5, 0x0, 0x38, 0x20, 0x7, 0xf1,
+    0x0, 0x80, 0x7f, 0xf2, 0x48, 0x4, 0x3, 0xf9,
+    0xc1, 0xc0, 0x3f, 0xbc, 0x2c, 0x3, 0xc8, 0x0,
+    0x54, 0x2c, 0x10, 0x9, 0xe0, 0x2, 0xa3, 0x37,
+    0x65, 0xf4, 0x28, 0x4, 0x39, 0x6, 0x64, 0x2a,
+    0x90, 0x10, 0x9, 0xf3, 0xfd, 0x8a, 0xe0, 0x60,
+    0x1f, 0xd8, 0x18, 0x1, 0xf9, 0x9c, 0x94, 0x3,
+    0x24, 0x57, 0x49, 0x78, 0x7, 0x2b, 0xa2, 0xce,
+    0x90, 0x0,
 
     /* U+0068 "h" */
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x8d, 0xfe,
-    0xb4, 0x0, 0xf, 0xec, 0xfc, 0xbe, 0xff, 0x50,
-    0xf, 0xfd, 0x20, 0x0, 0x6f, 0xe0, 0xf, 0xf3,
-    0x0, 0x0, 0x9, 0xf5, 0xf, 0xf0, 0x0, 0x0,
-    0x4, 0xf8, 0xf, 0xd0, 0x0, 0x0, 0x3, 0xf9,
-    0xf, 0xd0, 0x0, 0x0, 0x3, 0xfa, 0xf, 0xd0,
-    0x0, 0x0, 0x3, 0xfb, 0xf, 0xd0, 0x0, 0x0,
-    0x3, 0xfb, 0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb,
-    0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb, 0xf, 0xd0,
-    0x0, 0x0, 0x3, 0xfb, 0xf, 0xd0, 0x0, 0x0,
-    0x3, 0xfb, 0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb,
+    0x0, 0x8, 0x7, 0xfa, 0xb0, 0x3, 0xfc, 0xa0,
+    0x1f, 0xfe, 0x68, 0xdf, 0xeb, 0x40, 0xc, 0x78,
+    0xe2, 0x80, 0x96, 0xa0, 0x10, 0x8b, 0x72, 0xfa,
+    0x42, 0xc0, 0x37, 0x10, 0x4, 0xcc, 0x15, 0x0,
+    0x8c, 0x3, 0xb4, 0x34, 0x0, 0x40, 0x1e, 0x70,
+    0x10, 0xf, 0xf8, 0xc0, 0x3f, 0xe1, 0x0, 0xff,
+    0xfe, 0x0,
 
     /* U+0069 "i" */
-    0x0, 0x3, 0xea, 0x0, 0x0, 0x0, 0x6, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x73, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xbb, 0xbe,
-    0xfb, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xfb,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0,
-    0x0, 0x3, 0xfb, 0x0, 0x0, 0xbb, 0xbe, 0xff,
-    0xbb, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x8f, 0xa8, 0x3, 0xe5, 0x14, 0x0, 0xf9,
+    0xa3, 0x40, 0x3f, 0x39, 0x80, 0x7f, 0xf0, 0xbf,
+    0xfa, 0xc0, 0x32, 0x24, 0x20, 0x1e, 0xbb, 0xb4,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xc9, 0xbb, 0xb4,
+    0x12, 0xee, 0x54, 0x48, 0x40, 0x8, 0x96, 0x80,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0xd, 0xf8, 0x0,
-    0x0, 0x37, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf4, 0x4b, 0xbb, 0xff,
-    0x40, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x9f, 0x40,
-    0x0, 0x9, 0xf4, 0x0, 0x0, 0x9f, 0x40, 0x0,
-    0x9, 0xf4, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x9,
-    0xf4, 0x0, 0x0, 0x9f, 0x40, 0x0, 0x9, 0xf4,
-    0x0, 0x0, 0x9f, 0x40, 0x0, 0x9, 0xf4, 0x0,
-    0x0, 0x9f, 0x40, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x7f, 0xe0, 0x2a, 0xef, 0xf5,
-    0x0, 0xde, 0xb4, 0x0,
+    0x0, 0xd1, 0xe8, 0x1, 0x94, 0x30, 0x3, 0x74,
+    0x48, 0x6, 0x37, 0x10, 0xf, 0x9b, 0xff, 0x90,
+    0x91, 0x20, 0x9, 0x2e, 0xe6, 0x0, 0xff, 0xff,
+    0x80, 0x7e, 0x30, 0xf, 0x38, 0x30, 0x4, 0xe4,
+    0x24, 0x4a, 0xe8, 0xb, 0x2, 0x70, 0x4b, 0x50,
 
     /* U+006B "k" */
-    0x0, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0xfd, 0x0,
-    0x5, 0xfc, 0x0, 0x0, 0xf, 0xd0, 0x4, 0xfd,
-    0x10, 0x0, 0x0, 0xfd, 0x3, 0xff, 0x10, 0x0,
-    0x0, 0xf, 0xd2, 0xef, 0xf4, 0x0, 0x0, 0x0,
-    0xfe, 0xee, 0x7f, 0xc0, 0x0, 0x0, 0xf, 0xff,
-    0x30, 0xcf, 0x40, 0x0, 0x0, 0xff, 0x40, 0x4,
-    0xfc, 0x0, 0x0, 0xf, 0xd0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xfd,
-    0x0, 0x0, 0x4, 0xfc, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0xc, 0xf4, 0x0, 0xfd, 0x0, 0x0, 0x0,
-    0x4f, 0xc0,
+    0x0, 0x30, 0x7, 0xfd, 0xd6, 0x1, 0xff, 0x8,
+    0x7, 0xff, 0xb5, 0xfe, 0xc0, 0x3f, 0x96, 0xe,
+    0xc0, 0x3f, 0x25, 0x16, 0x80, 0x7e, 0x3b, 0xc,
+    0x10, 0xf, 0x8b, 0x40, 0xa, 0x1, 0xf1, 0xe0,
+    0x40, 0x40, 0x7, 0xc2, 0x2d, 0x73, 0x32, 0x0,
+    0x7d, 0x66, 0x10, 0x10, 0x1, 0xe2, 0x40, 0x2,
+    0x19, 0x90, 0x3, 0xfd, 0x1, 0x0, 0x1f, 0xe4,
+    0x33, 0x20, 0x7, 0xfa, 0x2, 0x0, 0x3f, 0xc8,
+    0x66, 0x40, 0xf, 0xf4, 0x4, 0x0,
 
     /* U+006C "l" */
-    0x9f, 0xff, 0xff, 0x40, 0x0, 0x1, 0xbb, 0xbf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x40, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0,
-    0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0xa, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x40, 0x0, 0x4, 0xbb, 0xbf,
-    0xff, 0xbb, 0xb0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0x10,
+    0x9f, 0xfe, 0x40, 0xd, 0x8, 0x90, 0x7, 0xc3,
+    0x77, 0x28, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xfe, 0x4b, 0xb9, 0x42, 0xef, 0x1, 0xa2,
+    0x40, 0x12, 0x24, 0x20,
 
     /* U+006D "m" */
-    0x9f, 0x68, 0xee, 0x70, 0x1a, 0xfe, 0x90, 0x9,
-    0xfd, 0xfc, 0xff, 0x6c, 0xfc, 0xff, 0x90, 0x9f,
-    0xf4, 0x2, 0xff, 0xf2, 0x4, 0xff, 0x9, 0xfb,
-    0x0, 0xc, 0xf9, 0x0, 0xe, 0xf2, 0x9f, 0x80,
-    0x0, 0xbf, 0x60, 0x0, 0xcf, 0x39, 0xf6, 0x0,
-    0xa, 0xf5, 0x0, 0xc, 0xf3, 0x9f, 0x60, 0x0,
-    0xaf, 0x40, 0x0, 0xcf, 0x39, 0xf6, 0x0, 0xa,
-    0xf4, 0x0, 0xc, 0xf3, 0x9f, 0x60, 0x0, 0xaf,
-    0x40, 0x0, 0xcf, 0x39, 0xf6, 0x0, 0xa, 0xf4,
-    0x0, 0xc, 0xf3, 0x9f, 0x60, 0x0, 0xaf, 0x40,
-    0x0, 0xcf, 0x39, 0xf6, 0x0, 0xa, 0xf4, 0x0,
-    0xc, 0xf3, 0x9f, 0x60, 0x0, 0xaf, 0x40, 0x0,
-    0xcf, 0x39, 0xf6, 0x0, 0xa, 0xf4, 0x0, 0xc,
-    0xf3,
+    0x9f, 0x68, 0xee, 0x38, 0xd, 0x7f, 0x48, 0x6,
+    0xb7, 0x21, 0x86, 0xd5, 0x31, 0x69, 0x0, 0x8a,
+    0xf3, 0x42, 0x4f, 0x72, 0xc1, 0x80, 0x24, 0x40,
+    0x11, 0x83, 0x10, 0x20, 0x81, 0x0, 0xc, 0x2,
+    0x70, 0xf0, 0x8, 0x80, 0x40, 0x1c, 0x1, 0x8,
+    0x18, 0x7, 0xff, 0x8, 0x40, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfd, 0x80,
 
     /* U+006E "n" */
-    0xf, 0xd0, 0x8d, 0xfe, 0xb4, 0x0, 0xf, 0xed,
-    0xfc, 0xbe, 0xff, 0x50, 0xf, 0xfd, 0x20, 0x0,
-    0x6f, 0xe0, 0xf, 0xf3, 0x0, 0x0, 0x9, 0xf5,
-    0xf, 0xf0, 0x0, 0x0, 0x4, 0xf8, 0xf, 0xd0,
-    0x0, 0x0, 0x3, 0xf9, 0xf, 0xd0, 0x0, 0x0,
-    0x3, 0xfa, 0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb,
-    0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb, 0xf, 0xd0,
-    0x0, 0x0, 0x3, 0xfb, 0xf, 0xd0, 0x0, 0x0,
-    0x3, 0xfb, 0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb,
-    0xf, 0xd0, 0x0, 0x0, 0x3, 0xfb, 0xf, 0xd0,
-    0x0, 0x0, 0x3, 0xfb,
+    0xf, 0xd0, 0x8d, 0xfe, 0xb4, 0x0, 0xc7, 0xae,
+    0x28, 0x9, 0x6a, 0x1, 0x8, 0x6e, 0x5f, 0x48,
+    0x58, 0x6, 0xe2, 0x0, 0x99, 0x82, 0xa0, 0x11,
+    0x80, 0x76, 0x86, 0x80, 0x8, 0x3, 0xce, 0x2,
+    0x1, 0xff, 0x18, 0x7, 0xfc, 0x20, 0x1f, 0xff,
+    0xc0,
 
     /* U+006F "o" */
-    0x0, 0x0, 0x5b, 0xef, 0xda, 0x30, 0x0, 0x0,
-    0x1c, 0xff, 0xcb, 0xdf, 0xf8, 0x0, 0x0, 0xbf,
-    0xa1, 0x0, 0x3, 0xef, 0x60, 0x5, 0xfb, 0x0,
-    0x0, 0x0, 0x2f, 0xf0, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0xe, 0xf0, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x5,
-    0xfa, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0xe, 0xf0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0xb,
-    0xf4, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0xcf, 0xa1,
-    0x0, 0x3, 0xef, 0x60, 0x0, 0x1c, 0xff, 0xcb,
-    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x6c, 0xef, 0xda,
-    0x30, 0x0,
+    0x0, 0xcb, 0x7d, 0xfb, 0x46, 0x1, 0xc3, 0x94,
+    0x84, 0x80, 0xb9, 0x0, 0x1a, 0x8d, 0x7b, 0x2f,
+    0x70, 0x5d, 0x80, 0xa, 0x88, 0xa1, 0x0, 0x8f,
+    0x2, 0x40, 0x1c, 0x1e, 0x1, 0xe2, 0x50, 0x50,
+    0x50, 0x40, 0xf, 0xb0, 0x34, 0x4, 0x3, 0xf8,
+    0xc0, 0x80, 0x3f, 0xf8, 0x62, 0x1, 0xfc, 0x60,
+    0x40, 0xa0, 0x80, 0x1f, 0x68, 0x68, 0x70, 0x40,
+    0x7, 0x8d, 0x5, 0x41, 0x4c, 0xd4, 0x20, 0x11,
+    0xe8, 0x40, 0x5, 0xa6, 0xbd, 0x97, 0xb8, 0x30,
+    0xc0, 0x10, 0xe4, 0x99, 0x20, 0x2e, 0x38, 0x0,
 
     /* U+0070 "p" */
-    0xf, 0xd0, 0x8d, 0xfe, 0xb5, 0x0, 0x0, 0xfe,
-    0xdf, 0xdb, 0xdf, 0xfa, 0x0, 0xf, 0xfd, 0x30,
-    0x0, 0x3d, 0xf7, 0x0, 0xff, 0x10, 0x0, 0x0,
-    0x2f, 0xf1, 0xf, 0xd0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0xfd, 0x0, 0x0, 0x0, 0x6, 0xf9, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0xfd, 0x0,
-    0x0, 0x0, 0x4, 0xfa, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0x6f, 0x90, 0xfd, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0xf, 0xf2, 0x0, 0x0, 0x1, 0xff, 0x10,
-    0xff, 0xe4, 0x0, 0x2, 0xdf, 0x70, 0xf, 0xed,
-    0xfd, 0xbc, 0xff, 0xa0, 0x0, 0xfd, 0x8, 0xdf,
-    0xeb, 0x50, 0x0, 0xf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xf, 0xd0, 0x8d, 0xfe, 0xb5, 0x0, 0xe3, 0xd7,
+    0x4, 0x34, 0xaa, 0x0, 0x61, 0xc, 0xdb, 0xdc,
+    0x25, 0x70, 0xd, 0x86, 0x1, 0x1f, 0x84, 0x8,
+    0x0, 0x84, 0x3, 0x89, 0x41, 0x0, 0x3f, 0xd8,
+    0x18, 0x1, 0xfe, 0x20, 0x30, 0xf, 0xfe, 0x59,
+    0x1, 0x80, 0x7f, 0xbc, 0x3c, 0x0, 0x44, 0x0,
+    0xe1, 0x60, 0x70, 0xb, 0x10, 0x2, 0x2c, 0x8,
+    0x10, 0x0, 0x9d, 0xed, 0xe6, 0x92, 0xb8, 0x4,
+    0x7a, 0xe0, 0x84, 0x95, 0x40, 0xf, 0x46, 0xff,
+    0x5a, 0x80, 0x7f, 0xf7, 0xca, 0x0, 0x3f, 0xed,
+    0x50, 0xf, 0xf0,
 
     /* U+0071 "q" */
-    0x0, 0x1, 0x7d, 0xff, 0xc4, 0x3f, 0xa0, 0x2,
-    0xdf, 0xfc, 0xbe, 0xfc, 0xfa, 0x0, 0xdf, 0xb1,
-    0x0, 0x6, 0xff, 0xa0, 0x6f, 0xd0, 0x0, 0x0,
-    0x7, 0xfa, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x3f,
-    0xa0, 0xef, 0x10, 0x0, 0x0, 0x3, 0xfa, 0xf,
-    0xf0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0xff, 0x0,
-    0x0, 0x0, 0x3, 0xfa, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0xbf, 0x40, 0x0, 0x0, 0x3,
-    0xfa, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0xd, 0xf8, 0x0, 0x0, 0x9f, 0xfa, 0x0, 0x2d,
-    0xfe, 0xbb, 0xff, 0xbf, 0xa0, 0x0, 0x17, 0xdf,
-    0xfc, 0x53, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3b, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0x85, 0xf7, 0xfd, 0x88, 0x7f, 0x40, 0x2,
+    0xc8, 0x23, 0x42, 0xbf, 0x0, 0xde, 0x49, 0xd9,
+    0x7d, 0x26, 0x1, 0x31, 0x12, 0xc4, 0x2, 0x68,
+    0x0, 0xb4, 0x2c, 0x3, 0xc8, 0x1, 0x28, 0x38,
+    0x7, 0xf8, 0x40, 0x40, 0x3f, 0xf9, 0x62, 0x1,
+    0xff, 0x94, 0x10, 0x3, 0xfd, 0xa1, 0xe0, 0x1e,
+    0xb0, 0x9, 0x89, 0x20, 0x3, 0x4b, 0x80, 0x6f,
+    0x27, 0xeb, 0xb7, 0xb2, 0x0, 0x62, 0xc8, 0x34,
+    0x41, 0xd4, 0x0, 0x70, 0xbe, 0xff, 0xb1, 0x40,
+    0x3f, 0xfd, 0x29, 0x20, 0x1f, 0xe3, 0xb3,
 
     /* U+0072 "r" */
-    0xaf, 0xff, 0xf1, 0x3, 0xae, 0xff, 0xd6, 0xaf,
-    0xff, 0xf2, 0xaf, 0xff, 0xff, 0xf8, 0x0, 0xc,
-    0xfc, 0xfb, 0x51, 0x7, 0xf8, 0x0, 0xc, 0xff,
-    0x50, 0x0, 0x6, 0xf8, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x6, 0xf8, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x1, 0x31, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x6b, 0xbe, 0xfc, 0xbb,
-    0xb3, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0,
+    0xaf, 0xfc, 0x20, 0x75, 0xdf, 0xed, 0x60, 0xe,
+    0x3a, 0xc5, 0x10, 0x1, 0x75, 0x7f, 0x8c, 0x39,
+    0x52, 0xbb, 0xe0, 0x3, 0xe3, 0xab, 0x51, 0x1,
+    0x0, 0xf9, 0xd4, 0x3, 0xff, 0x60, 0x7, 0x3e,
+    0x48, 0x7, 0x38, 0x7, 0x9, 0x88, 0x7, 0xff,
+    0xe9, 0xae, 0xc4, 0x1f, 0x77, 0x18, 0x6, 0xc4,
+    0x40, 0x81, 0xa2, 0x4c, 0x1, 0x80,
 
     /* U+0073 "s" */
-    0x0, 0x8d, 0xff, 0xc7, 0x0, 0x1d, 0xfd, 0xbb,
-    0xef, 0xd1, 0x7f, 0x80, 0x0, 0x7, 0xd2, 0xaf,
-    0x20, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x0, 0xc, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x7e,
-    0xff, 0x92, 0x0, 0x0, 0x0, 0x5c, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x4d, 0xf7, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x4, 0x0, 0x0, 0x0, 0xdf, 0x6f,
-    0xb2, 0x0, 0x5, 0xfc, 0xb, 0xff, 0xcb, 0xdf,
-    0xf3, 0x0, 0x5b, 0xef, 0xd9, 0x10,
+    0x0, 0x46, 0xff, 0xb1, 0xc0, 0x3, 0xae, 0x8,
+    0x82, 0x8d, 0x16, 0x27, 0xdb, 0xb7, 0x40, 0x1e,
+    0x85, 0x0, 0x67, 0xd2, 0xd0, 0xb0, 0xf, 0x9c,
+    0xdb, 0x58, 0x3, 0xd9, 0x7, 0x3f, 0x24, 0x1,
+    0x9f, 0xa8, 0xdb, 0x60, 0x3, 0x97, 0x2c, 0x9d,
+    0xc0, 0x1e, 0x4c, 0xa, 0x4, 0x0, 0xe1, 0x22,
+    0x35, 0xd8, 0x80, 0x25, 0x23, 0x64, 0x46, 0xe5,
+    0xed, 0x7, 0x85, 0xd2, 0x12, 0x3, 0x71, 0x80,
 
     /* U+0074 "t" */
-    0x0, 0x0, 0x51, 0x0, 0x0, 0x0, 0x9, 0xf3,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xab, 0xbe, 0xfb, 0xbb, 0xb8,
-    0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xf3,
-    0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
-    0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0xb,
-    0xf3, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x4, 0x0, 0x4, 0xff, 0xdc, 0xeb, 0x0,
-    0x0, 0x7e, 0xff, 0xc4,
+    0x0, 0xca, 0x20, 0x1f, 0x4d, 0x10, 0x7, 0xc4,
+    0x1, 0xff, 0xd8, 0xff, 0x90, 0x33, 0xfe, 0xc5,
+    0x44, 0x8, 0x22, 0x75, 0x5d, 0x94, 0x22, 0xee,
+    0x80, 0xf, 0xff, 0xf8, 0x7, 0xe2, 0xb, 0x0,
+    0x90, 0x2, 0xd0, 0x7d, 0xce, 0xf0, 0x9, 0x20,
+    0x48, 0xcb, 0xc0,
 
     /* U+0075 "u" */
-    0x1f, 0xe0, 0x0, 0x0, 0x4, 0xfa, 0x1f, 0xe0,
-    0x0, 0x0, 0x4, 0xfa, 0x1f, 0xe0, 0x0, 0x0,
-    0x4, 0xfa, 0x1f, 0xe0, 0x0, 0x0, 0x4, 0xfa,
-    0x1f, 0xe0, 0x0, 0x0, 0x4, 0xfa, 0x1f, 0xe0,
-    0x0, 0x0, 0x4, 0xfa, 0x1f, 0xe0, 0x0, 0x0,
-    0x4, 0xfa, 0xf, 0xe0, 0x0, 0x0, 0x4, 0xfa,
-    0xf, 0xe0, 0x0, 0x0, 0x4, 0xfa, 0xe, 0xf0,
-    0x0, 0x0, 0x6, 0xfa, 0xb, 0xf5, 0x0, 0x0,
-    0xb, 0xfa, 0x5, 0xfe, 0x30, 0x0, 0x7f, 0xfa,
-    0x0, 0xbf, 0xfd, 0xce, 0xfc, 0xfa, 0x0, 0x7,
-    0xce, 0xfd, 0x64, 0xfa,
+    0x1f, 0xe0, 0xf, 0x27, 0xd0, 0x7, 0xff, 0xf0,
+    0x40, 0x3f, 0xf9, 0x82, 0x20, 0xf, 0x10, 0x4,
+    0xa0, 0xa0, 0x1d, 0xa0, 0x17, 0x5, 0x98, 0x4,
+    0xe8, 0x1, 0x2a, 0xe, 0x6e, 0x74, 0x18, 0x6,
+    0xb8, 0x33, 0xd3, 0x0, 0x0,
 
     /* U+0076 "v" */
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0xdf, 0x10, 0xfe,
-    0x0, 0x0, 0x0, 0x3f, 0xa0, 0xa, 0xf4, 0x0,
-    0x0, 0x8, 0xf4, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0xef, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x8, 0xf6, 0x0, 0xa, 0xf2, 0x0, 0x0,
-    0x2f, 0xc0, 0x0, 0xfc, 0x0, 0x0, 0x0, 0xcf,
-    0x20, 0x5f, 0x60, 0x0, 0x0, 0x6, 0xf7, 0xb,
-    0xf1, 0x0, 0x0, 0x0, 0xf, 0xd1, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x20, 0x0, 0x0,
+    0x6f, 0x80, 0xf, 0xb7, 0xc5, 0x81, 0x80, 0x3c,
+    0x64, 0xa2, 0xa, 0x28, 0x1, 0xd6, 0x1c, 0x0,
+    0xe0, 0xe0, 0xe, 0x61, 0x40, 0x2, 0xa, 0x80,
+    0x64, 0x16, 0x0, 0xcc, 0xc, 0x1, 0x70, 0x50,
+    0x6, 0xa0, 0xa0, 0x9, 0x4c, 0x80, 0x31, 0x19,
+    0x88, 0x14, 0x28, 0x3, 0xd4, 0xa, 0x1c, 0xe,
+    0x1, 0xe6, 0xa, 0x14, 0x51, 0x0, 0xf9, 0x4a,
+    0xc3, 0x80, 0x3f, 0x70, 0x28, 0xa0, 0x7, 0xe4,
+    0x10, 0x60, 0xf, 0xf3, 0x5, 0x0, 0x70,
 
     /* U+0077 "w" */
-    0x1f, 0xd0, 0x0, 0x9, 0xf3, 0x0, 0x3, 0xfb,
-    0xd, 0xf1, 0x0, 0xc, 0xf6, 0x0, 0x7, 0xf7,
-    0x9, 0xf4, 0x0, 0xf, 0xfa, 0x0, 0xa, 0xf3,
-    0x5, 0xf8, 0x0, 0x3f, 0xed, 0x0, 0xe, 0xf0,
-    0x1, 0xfc, 0x0, 0x6f, 0x8f, 0x10, 0x1f, 0xb0,
-    0x0, 0xdf, 0x0, 0xad, 0x3f, 0x40, 0x5f, 0x70,
-    0x0, 0x9f, 0x30, 0xda, 0xf, 0x80, 0x8f, 0x30,
-    0x0, 0x5f, 0x61, 0xf6, 0xc, 0xb0, 0xbf, 0x0,
-    0x0, 0x1f, 0xa4, 0xf3, 0x9, 0xf0, 0xfc, 0x0,
-    0x0, 0xe, 0xe8, 0xf0, 0x5, 0xf5, 0xf8, 0x0,
-    0x0, 0xa, 0xfc, 0xc0, 0x1, 0xfc, 0xf4, 0x0,
-    0x0, 0x6, 0xff, 0x80, 0x0, 0xef, 0xf0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0xaf, 0xc0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x7f, 0x80, 0x0,
+    0x1f, 0xd0, 0xd, 0x3e, 0x60, 0x11, 0xfd, 0x89,
+    0x10, 0x40, 0x25, 0x5, 0x0, 0x90, 0x30, 0x10,
+    0x14, 0x2, 0x30, 0xc0, 0xb, 0x41, 0x3, 0x3,
+    0x0, 0x6, 0x2, 0xe0, 0x12, 0x1, 0x82, 0x2,
+    0x0, 0x14, 0x18, 0x84, 0x4, 0x48, 0x0, 0x12,
+    0x30, 0x6, 0x15, 0x82, 0x82, 0x6, 0x0, 0x48,
+    0x6, 0xe, 0xe3, 0xc, 0xd, 0x4, 0x0, 0xb0,
+    0x14, 0x4b, 0x0, 0xcc, 0x6, 0x6, 0x1, 0x20,
+    0x62, 0x82, 0x82, 0xa0, 0x21, 0x80, 0x61, 0x12,
+    0x60, 0x18, 0x60, 0x28, 0x20, 0x7, 0x20, 0xa1,
+    0x80, 0x10, 0x24, 0x30, 0x3, 0xb0, 0xd, 0x0,
+    0x2, 0x23, 0x4, 0x0, 0xe4, 0x0, 0x68, 0x4,
+    0x80, 0x60, 0x1e, 0x21, 0x4, 0x0, 0xb4, 0x10,
+    0x2,
 
     /* U+0078 "x" */
-    0x3f, 0xd0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x7f,
-    0x90, 0x0, 0x1, 0xef, 0x20, 0x0, 0xbf, 0x40,
-    0x0, 0xaf, 0x50, 0x0, 0x1, 0xee, 0x10, 0x6f,
-    0xa0, 0x0, 0x0, 0x5, 0xfb, 0x2f, 0xe1, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0xaf, 0x60, 0xcf, 0x40,
-    0x0, 0x0, 0x5f, 0xb0, 0x1, 0xfe, 0x10, 0x0,
-    0x2f, 0xe1, 0x0, 0x5, 0xfb, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0xa, 0xf6, 0x7, 0xf9, 0x0, 0x0,
-    0x0, 0xd, 0xf2,
+    0x3f, 0xd0, 0xf, 0x27, 0xe0, 0x1c, 0x14, 0x80,
+    0x61, 0xa0, 0xe0, 0x3, 0xa3, 0x20, 0x5, 0x63,
+    0x44, 0x1, 0x50, 0xd0, 0x83, 0x2a, 0xc0, 0x18,
+    0x6c, 0x68, 0xa4, 0x6c, 0x3, 0xca, 0xc9, 0x81,
+    0x42, 0x1, 0xf4, 0x88, 0x99, 0x0, 0x3f, 0x18,
+    0x82, 0x0, 0x7f, 0x68, 0x31, 0x48, 0x7, 0xd4,
+    0x33, 0x23, 0x64, 0x0, 0xe5, 0x52, 0x30, 0x68,
+    0x50, 0x80, 0x45, 0x43, 0x40, 0x1, 0xa1, 0xa0,
+    0xb, 0x82, 0x84, 0x2, 0x55, 0x23, 0x3, 0x9b,
+    0x20, 0x7, 0x51, 0x49, 0x0,
 
     /* U+0079 "y" */
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0xef, 0x11, 0xfc,
-    0x0, 0x0, 0x0, 0x4f, 0xb0, 0xb, 0xf2, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x5f, 0x80, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0xed, 0x0, 0x0, 0x6f, 0x90,
-    0x0, 0x9, 0xf3, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x3f, 0x90, 0x2, 0xfd, 0x0, 0x0, 0x0, 0xde,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x7, 0xf4, 0xd,
-    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xa3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0,
+    0x7f, 0x70, 0xf, 0xbb, 0xc5, 0x82, 0xc0, 0x3c,
+    0x82, 0x82, 0x24, 0x32, 0x0, 0xee, 0xe, 0x0,
+    0x70, 0x50, 0x6, 0x15, 0x15, 0x0, 0x28, 0xa8,
+    0x6, 0x70, 0x70, 0xc, 0xe4, 0x60, 0x15, 0x5,
+    0x0, 0x6a, 0xa, 0x0, 0x11, 0x91, 0x80, 0x63,
+    0x27, 0x0, 0x28, 0x50, 0x7, 0xa8, 0x50, 0x28,
+    0x18, 0x3, 0xcc, 0x1c, 0x64, 0x82, 0x1, 0xe1,
+    0x55, 0x50, 0x70, 0x7, 0xee, 0x6, 0x5, 0x0,
+    0xfc, 0x82, 0xc, 0x1, 0xfe, 0x50, 0xa0, 0xf,
+    0xf2, 0x11, 0x80, 0x7f, 0x30, 0x50, 0x7, 0xfa,
+    0x81, 0x40, 0x3f, 0x84, 0xcc, 0x40, 0x1f, 0xcc,
+    0x14, 0x1, 0xf0,
 
     /* U+007A "z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x40, 0xbb, 0xbb,
-    0xbb, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xcf, 0x50,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x2f, 0xe1, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0xbb, 0xbb, 0xbb, 0x2a,
-    0xff, 0xff, 0xff, 0xff, 0xf3,
+    0x1f, 0xff, 0xe4, 0x14, 0x4f, 0x18, 0xa, 0x85,
+    0xdf, 0x80, 0x16, 0x20, 0x1e, 0x73, 0x55, 0x0,
+    0x78, 0xa0, 0x6c, 0x3, 0xee, 0xb, 0x10, 0xf,
+    0x31, 0xaa, 0x80, 0x3c, 0x52, 0x36, 0x1, 0xf4,
+    0x85, 0x88, 0x7, 0x99, 0x10, 0xa0, 0x1e, 0x19,
+    0x1a, 0x0, 0xfa, 0x82, 0xc4, 0x3, 0xcc, 0x81,
+    0xd7, 0x7e, 0x2c, 0x0, 0x22, 0x7c, 0x20,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x7, 0xdf, 0x60, 0x0, 0xc, 0xfd,
-    0x93, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0, 0x3,
-    0xfb, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0,
-    0x4, 0xfa, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0x6c, 0xf9, 0x0,
-    0x0, 0xc, 0xfa, 0x30, 0x0, 0x0, 0x4, 0xff,
-    0x20, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0,
-    0x5f, 0x90, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x4f, 0xa0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x3, 0xfe, 0x40, 0x0, 0x0,
-    0x5, 0xff, 0xf6, 0x0, 0x0, 0x1, 0x68, 0x30,
+    0x0, 0xe7, 0xdf, 0x60, 0xd, 0x90, 0xc, 0xa0,
+    0x14, 0x1b, 0x6c, 0x98, 0x4, 0xc1, 0x0, 0x1c,
+    0x42, 0x62, 0x1, 0xc2, 0xe, 0x1, 0xe7, 0x1,
+    0x0, 0xff, 0xe1, 0x90, 0x18, 0x7, 0xa8, 0x30,
+    0x3, 0x36, 0x1b, 0x28, 0x6, 0xa3, 0x5a, 0x0,
+    0xec, 0xb5, 0xc2, 0x0, 0xe4, 0x70, 0x50, 0xf,
+    0x68, 0x70, 0x7, 0x84, 0xc, 0x3, 0xff, 0x86,
+    0xe0, 0x20, 0x1e, 0x30, 0x50, 0xf, 0x8c, 0x50,
+    0x3, 0xde, 0x14, 0x80, 0x1c, 0x74, 0x37, 0xec,
+    0x1, 0x97, 0xa5, 0xd4,
 
     /* U+007C "|" */
-    0x58, 0x2a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a,
-    0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf,
-    0x4a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a, 0xf4,
-    0xaf, 0x4a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a,
-    0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf,
-    0x4a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a, 0xf4,
-    0xaf, 0x4a, 0xf4, 0xaf, 0x4a, 0xf4, 0xaf, 0x4a,
-    0xf4, 0xaf, 0x40,
+    0x58, 0x2f, 0x76, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf6, 0x0,
 
     /* U+007D "}" */
-    0xcf, 0xb4, 0x0, 0x0, 0x7, 0xaf, 0xf6, 0x0,
-    0x0, 0x0, 0x1e, 0xf2, 0x0, 0x0, 0x0, 0x6f,
-    0x80, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0,
-    0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0xef, 0x0,
-    0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x2d,
-    0xfa, 0x30, 0x0, 0x0, 0x5c, 0xf6, 0x0, 0x0,
-    0x7f, 0xc1, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0xaf,
-    0x60, 0x0, 0x1, 0x7f, 0xd0, 0x0, 0xc, 0xff,
-    0xc1, 0x0, 0x0, 0x67, 0x40, 0x0, 0x0, 0x0,
+    0xcf, 0xb4, 0x0, 0xeb, 0x54, 0xb6, 0x0, 0xcf,
+    0x5c, 0x32, 0x40, 0x1c, 0x30, 0x14, 0x1, 0xe4,
+    0x4, 0x0, 0xf1, 0x0, 0x80, 0x7e, 0x30, 0xf,
+    0xfe, 0x20, 0x88, 0x3, 0xe4, 0x6, 0x0, 0xf4,
+    0x14, 0xd1, 0x80, 0x62, 0x83, 0x55, 0x0, 0x67,
+    0xa0, 0xe6, 0x0, 0xd4, 0x1c, 0x20, 0x1c, 0x40,
+    0x40, 0x1f, 0x8, 0x7, 0xff, 0xc, 0x40, 0xc0,
+    0x3c, 0x40, 0xe0, 0x1e, 0x90, 0xc0, 0xc, 0x2e,
+    0xa4, 0xc0, 0x16, 0x74, 0x1e, 0x0, 0x6a, 0x8b,
+    0xc1, 0x0, 0xc0,
 
     /* U+007E "~" */
-    0x4, 0xac, 0xa5, 0x0, 0x0, 0x7, 0x74, 0xff,
-    0xff, 0xfe, 0x82, 0x4, 0xf6, 0xbc, 0x20, 0x4b,
-    0xff, 0xff, 0xfe, 0x1e, 0x30, 0x0, 0x2, 0x9e,
-    0xfc, 0x30,
+    0x4, 0xac, 0xa5, 0x0, 0xe7, 0x72, 0x5a, 0x9a,
+    0xd7, 0x41, 0x2, 0x40, 0xf9, 0xef, 0xda, 0xb,
+    0xef, 0xd8, 0xba, 0xf9, 0x2, 0x5e, 0xb0, 0x81,
+    0xe8, 0x80,
 
     /* U+00B0 "°" */
-    0x0, 0x19, 0xef, 0xd6, 0x0, 0x2, 0xef, 0xfd,
-    0xff, 0xb0, 0xc, 0xfa, 0x0, 0x2d, 0xf6, 0x1f,
-    0xe0, 0x0, 0x5, 0xfb, 0x3f, 0xc0, 0x0, 0x2,
-    0xfd, 0x1f, 0xf0, 0x0, 0x5, 0xfb, 0xc, 0xfa,
-    0x0, 0x2e, 0xf6, 0x2, 0xef, 0xfe, 0xff, 0xa0,
-    0x0, 0x19, 0xef, 0xd6, 0x0
+    0x0, 0xc, 0xf7, 0xeb, 0x0, 0x45, 0xec, 0x24,
+    0x49, 0xb0, 0x7, 0xa, 0xfe, 0xe8, 0x91, 0x84,
+    0xc6, 0x80, 0x5, 0x1, 0xa4, 0x4, 0x1, 0x9c,
+    0x18, 0x80, 0xc0, 0x33, 0x83, 0x9, 0x85, 0x0,
+    0xa, 0xc3, 0x43, 0x85, 0x7f, 0xb4, 0x55, 0x80,
+    0xbd, 0x84, 0x45, 0x34, 0x0
 };
 
 
@@ -1493,100 +1053,100 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 266, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 266, .box_w = 5, .box_h = 19, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 48, .adv_w = 266, .box_w = 8, .box_h = 8, .ofs_x = 4, .ofs_y = 11},
-    {.bitmap_index = 80, .adv_w = 266, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 242, .adv_w = 266, .box_w = 13, .box_h = 24, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 398, .adv_w = 266, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 560, .adv_w = 266, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 722, .adv_w = 266, .box_w = 3, .box_h = 8, .ofs_x = 7, .ofs_y = 11},
-    {.bitmap_index = 734, .adv_w = 266, .box_w = 8, .box_h = 23, .ofs_x = 5, .ofs_y = -4},
-    {.bitmap_index = 826, .adv_w = 266, .box_w = 9, .box_h = 23, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 930, .adv_w = 266, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 1008, .adv_w = 266, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1099, .adv_w = 266, .box_w = 5, .box_h = 9, .ofs_x = 6, .ofs_y = -5},
-    {.bitmap_index = 1122, .adv_w = 266, .box_w = 14, .box_h = 2, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 1136, .adv_w = 266, .box_w = 5, .box_h = 4, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 1146, .adv_w = 266, .box_w = 13, .box_h = 23, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 1296, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1429, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1543, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1657, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1781, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1914, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2038, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2168, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2282, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2406, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 2536, .adv_w = 266, .box_w = 5, .box_h = 14, .ofs_x = 6, .ofs_y = 0},
-    {.bitmap_index = 2571, .adv_w = 266, .box_w = 5, .box_h = 19, .ofs_x = 6, .ofs_y = -5},
-    {.bitmap_index = 2619, .adv_w = 266, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2710, .adv_w = 266, .box_w = 14, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2759, .adv_w = 266, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2850, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2974, .adv_w = 266, .box_w = 16, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3126, .adv_w = 266, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3269, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3393, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3517, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3641, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3755, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3879, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4003, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4117, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4231, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4345, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4469, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4583, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4697, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4811, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4935, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5059, .adv_w = 266, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 5196, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5320, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5434, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5567, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5691, .adv_w = 266, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5834, .adv_w = 266, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5977, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6110, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6234, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6358, .adv_w = 266, .box_w = 7, .box_h = 23, .ofs_x = 6, .ofs_y = -4},
-    {.bitmap_index = 6439, .adv_w = 266, .box_w = 13, .box_h = 23, .ofs_x = 3, .ofs_y = -4},
-    {.bitmap_index = 6589, .adv_w = 266, .box_w = 7, .box_h = 23, .ofs_x = 6, .ofs_y = -4},
-    {.bitmap_index = 6670, .adv_w = 266, .box_w = 13, .box_h = 10, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 6735, .adv_w = 266, .box_w = 19, .box_h = 3, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 6764, .adv_w = 266, .box_w = 8, .box_h = 4, .ofs_x = 4, .ofs_y = 15},
-    {.bitmap_index = 6780, .adv_w = 266, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6864, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6994, .adv_w = 266, .box_w = 11, .box_h = 14, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7071, .adv_w = 266, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7191, .adv_w = 266, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7282, .adv_w = 266, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7387, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 7501, .adv_w = 266, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7621, .adv_w = 266, .box_w = 10, .box_h = 19, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 7716, .adv_w = 266, .box_w = 7, .box_h = 24, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 7800, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7930, .adv_w = 266, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8035, .adv_w = 266, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8140, .adv_w = 266, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8224, .adv_w = 266, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8322, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 8452, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 8582, .adv_w = 266, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8680, .adv_w = 266, .box_w = 10, .box_h = 14, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8750, .adv_w = 266, .box_w = 10, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8850, .adv_w = 266, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8934, .adv_w = 266, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9025, .adv_w = 266, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9137, .adv_w = 266, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9228, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 9352, .adv_w = 266, .box_w = 11, .box_h = 14, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9429, .adv_w = 266, .box_w = 9, .box_h = 23, .ofs_x = 4, .ofs_y = -4},
-    {.bitmap_index = 9533, .adv_w = 266, .box_w = 3, .box_h = 39, .ofs_x = 7, .ofs_y = -10},
-    {.bitmap_index = 9592, .adv_w = 266, .box_w = 9, .box_h = 23, .ofs_x = 4, .ofs_y = -4},
-    {.bitmap_index = 9696, .adv_w = 266, .box_w = 13, .box_h = 4, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 9722, .adv_w = 266, .box_w = 10, .box_h = 9, .ofs_x = 3, .ofs_y = 12}
+    {.bitmap_index = 35, .adv_w = 266, .box_w = 8, .box_h = 8, .ofs_x = 4, .ofs_y = 11},
+    {.bitmap_index = 68, .adv_w = 266, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 199, .adv_w = 266, .box_w = 13, .box_h = 24, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 316, .adv_w = 266, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 457, .adv_w = 266, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 586, .adv_w = 266, .box_w = 3, .box_h = 8, .ofs_x = 7, .ofs_y = 11},
+    {.bitmap_index = 599, .adv_w = 266, .box_w = 8, .box_h = 23, .ofs_x = 5, .ofs_y = -4},
+    {.bitmap_index = 669, .adv_w = 266, .box_w = 9, .box_h = 23, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 742, .adv_w = 266, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 812, .adv_w = 266, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 841, .adv_w = 266, .box_w = 5, .box_h = 9, .ofs_x = 6, .ofs_y = -5},
+    {.bitmap_index = 864, .adv_w = 266, .box_w = 14, .box_h = 2, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 871, .adv_w = 266, .box_w = 5, .box_h = 4, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 882, .adv_w = 266, .box_w = 13, .box_h = 23, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 969, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1086, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1124, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1209, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1308, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1375, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1469, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1571, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1638, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1749, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 1851, .adv_w = 266, .box_w = 5, .box_h = 14, .ofs_x = 6, .ofs_y = 0},
+    {.bitmap_index = 1877, .adv_w = 266, .box_w = 5, .box_h = 19, .ofs_x = 6, .ofs_y = -5},
+    {.bitmap_index = 1915, .adv_w = 266, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1983, .adv_w = 266, .box_w = 14, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 2003, .adv_w = 266, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2071, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2159, .adv_w = 266, .box_w = 16, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2294, .adv_w = 266, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2397, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2481, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2573, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2654, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2688, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2719, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2817, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2844, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2876, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2914, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2995, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3013, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3097, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3164, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3267, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3327, .adv_w = 266, .box_w = 13, .box_h = 21, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 3442, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3525, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3619, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3643, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3695, .adv_w = 266, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3800, .adv_w = 266, .box_w = 15, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3935, .adv_w = 266, .box_w = 14, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4040, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4109, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4185, .adv_w = 266, .box_w = 7, .box_h = 23, .ofs_x = 6, .ofs_y = -4},
+    {.bitmap_index = 4206, .adv_w = 266, .box_w = 13, .box_h = 23, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 4292, .adv_w = 266, .box_w = 7, .box_h = 23, .ofs_x = 6, .ofs_y = -4},
+    {.bitmap_index = 4313, .adv_w = 266, .box_w = 13, .box_h = 10, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 4365, .adv_w = 266, .box_w = 19, .box_h = 3, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 4376, .adv_w = 266, .box_w = 8, .box_h = 4, .ofs_x = 4, .ofs_y = 15},
+    {.bitmap_index = 4391, .adv_w = 266, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4467, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4545, .adv_w = 266, .box_w = 11, .box_h = 14, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4609, .adv_w = 266, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4686, .adv_w = 266, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4759, .adv_w = 266, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4814, .adv_w = 266, .box_w = 12, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 4904, .adv_w = 266, .box_w = 12, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4954, .adv_w = 266, .box_w = 10, .box_h = 19, .ofs_x = 4, .ofs_y = 0},
+    {.bitmap_index = 4994, .adv_w = 266, .box_w = 7, .box_h = 24, .ofs_x = 4, .ofs_y = -5},
+    {.bitmap_index = 5034, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5104, .adv_w = 266, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5132, .adv_w = 266, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5183, .adv_w = 266, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5224, .adv_w = 266, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5304, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 5387, .adv_w = 266, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 5466, .adv_w = 266, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5520, .adv_w = 266, .box_w = 10, .box_h = 14, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5584, .adv_w = 266, .box_w = 10, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5627, .adv_w = 266, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5664, .adv_w = 266, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5735, .adv_w = 266, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5840, .adv_w = 266, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5917, .adv_w = 266, .box_w = 13, .box_h = 19, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6008, .adv_w = 266, .box_w = 11, .box_h = 14, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6063, .adv_w = 266, .box_w = 9, .box_h = 23, .ofs_x = 4, .ofs_y = -4},
+    {.bitmap_index = 6139, .adv_w = 266, .box_w = 3, .box_h = 39, .ofs_x = 7, .ofs_y = -10},
+    {.bitmap_index = 6149, .adv_w = 266, .box_w = 9, .box_h = 23, .ofs_x = 4, .ofs_y = -4},
+    {.bitmap_index = 6224, .adv_w = 266, .box_w = 13, .box_h = 4, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 6250, .adv_w = 266, .box_w = 10, .box_h = 9, .ofs_x = 3, .ofs_y = 12}
 };
 
 /*---------------------
@@ -1632,7 +1192,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 2,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1651,7 +1211,7 @@ const lv_font_t lv_font_overpass_27 = {
 lv_font_t lv_font_overpass_27 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_glyph_cache_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 39,          /*The maximum line height required by the font*/
     .base_line = 10,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 90 px
  * Bpp: 4
- * Opts: --font fonts/PlayfairDisplay-Regular-Lining.ttf --size 90 --bpp 4 --format lvgl --output main/ui/lv_font_playfair_90.c --range 0x30-0x3A,0xB0 --lv-include lvgl.h --no-compress
+ * Opts: --font fonts/PlayfairDisplay-Regular-Lining.ttf --size 90 --bpp 4 --format lvgl --output main/ui/lv_font_playfair_90.c --range 0x30-0x3A,0xB0 --lv-include lvgl.h
  ******************************************************************************/
 
 #ifdef LV_LVGL_H_INCLUDE_SIMPLE
@@ -9,6 +9,7 @@
 #else
 #include "lvgl.h"
 #endif
+#include "font_glyph_cache.h"
 
 #ifndef LV_FONT_PLAYFAIR_90
 #define LV_FONT_PLAYFAIR_90 1
@@ -23,1775 +24,732 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x36, 0x89, 0x98, 0x76, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xea, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xcf, 0xff, 0xb5, 0x20,
-    0x2, 0x5b, 0xff, 0xff, 0xd5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0x20, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x5, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x70, 0xc,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0x5, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xf1, 0x7f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x39,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xf5, 0xaf, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf8,
-    0xef, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0x7d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf6, 0xcf,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xf0, 0x6f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfe, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0xb, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x70, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff,
-    0xff, 0xa3, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff,
-    0xfe, 0xba, 0xbd, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xac, 0xdf,
-    0xff, 0xdb, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x1b, 0x44, 0xca, 0x1d, 0x88,
+    0x3, 0xff, 0xaa, 0x95, 0xf9, 0x2e, 0xcc, 0x78,
+    0x9d, 0xea, 0x40, 0xf, 0xfe, 0x82, 0x65, 0xa8,
+    0x25, 0x6f, 0xfb, 0x69, 0x0, 0x56, 0xf5, 0x40,
+    0x3f, 0xf9, 0xb3, 0x66, 0x5, 0x96, 0xa4, 0x0,
+    0x25, 0xbc, 0x20, 0x1, 0x55, 0x88, 0x7, 0xff,
+    0x24, 0xb5, 0x80, 0x7, 0xa6, 0x1, 0xf8, 0xf5,
+    0x0, 0x24, 0xe4, 0x0, 0xff, 0xe3, 0x96, 0x10,
+    0x0, 0xb0, 0x3, 0xff, 0x59, 0x80, 0x6b, 0x60,
+    0xf, 0xfe, 0x29, 0x60, 0x80, 0x5e, 0x1, 0xff,
+    0xc2, 0xd1, 0x0, 0xd2, 0xc0, 0x1f, 0xfc, 0x31,
+    0xc1, 0x0, 0x9c, 0x80, 0x3f, 0xf8, 0x43, 0x60,
+    0x1d, 0x28, 0x1, 0xff, 0xc2, 0xa1, 0x0, 0xd2,
+    0x1, 0xff, 0xc4, 0x53, 0x0, 0xea, 0x20, 0xf,
+    0xfc, 0xe8, 0x1, 0x98, 0x40, 0x3f, 0xf8, 0xbe,
+    0x1, 0xc3, 0xc0, 0x1f, 0xf1, 0x40, 0x7, 0x58,
+    0x7, 0xff, 0x18, 0xcc, 0x1, 0xc6, 0xa0, 0x1f,
+    0xe9, 0x0, 0xe3, 0x20, 0xf, 0xfe, 0x3d, 0x0,
+    0x7a, 0xc0, 0x3f, 0x91, 0x0, 0x1d, 0x60, 0x1f,
+    0xfc, 0x86, 0x0, 0xf0, 0xb8, 0x7, 0xe8, 0x0,
+    0xf2, 0x0, 0x7f, 0xf2, 0x50, 0x3, 0xd2, 0x1,
+    0xf1, 0x98, 0x3, 0x84, 0xc0, 0x3f, 0xf9, 0x3a,
+    0x1, 0xe1, 0x50, 0xf, 0x48, 0x7, 0x94, 0x3,
+    0xff, 0x94, 0x80, 0x1f, 0x48, 0x7, 0xa, 0x80,
+    0x7b, 0x0, 0x3f, 0xf9, 0x44, 0x20, 0x1e, 0x32,
+    0x0, 0xce, 0x1, 0xf1, 0x80, 0x7f, 0xf2, 0xd4,
+    0x3, 0xe5, 0x0, 0xda, 0x1, 0xf2, 0x80, 0x7f,
+    0xf2, 0xcc, 0x3, 0xeb, 0x0, 0xc8, 0x1, 0xf0,
+    0x80, 0x7f, 0xf2, 0xf4, 0x3, 0xe3, 0x10, 0x2,
+    0x80, 0x7c, 0x40, 0x1f, 0xfc, 0xc6, 0x0, 0xfc,
+    0xa0, 0xd, 0x0, 0xf9, 0x80, 0x3f, 0xf9, 0x84,
+    0x1, 0xf8, 0xc0, 0x8, 0x1, 0xf1, 0x0, 0x7f,
+    0xf3, 0x4, 0x3, 0xf6, 0x80, 0xc, 0x3, 0xee,
+    0x0, 0xff, 0xe6, 0x90, 0x7, 0xc8, 0x4, 0x1,
+    0xf8, 0x40, 0x3f, 0xf9, 0xa2, 0x1, 0xf0, 0x83,
+    0x80, 0x7e, 0x30, 0xf, 0xfe, 0x6b, 0x80, 0x7e,
+    0x12, 0x0, 0xfc, 0x20, 0x1f, 0xfc, 0xd2, 0x0,
+    0xfc, 0x5c, 0x1, 0xf9, 0xc0, 0x3f, 0xfa, 0xcc,
+    0x60, 0x1f, 0x84, 0x3, 0xff, 0x9a, 0x20, 0x1f,
+    0x8d, 0x80, 0x3f, 0x18, 0x7, 0xff, 0x37, 0xc0,
+    0x3f, 0x8, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfc,
+    0x1f, 0x30, 0xf, 0xc2, 0x1, 0xff, 0xcd, 0x10,
+    0xf, 0xc2, 0x1, 0xff, 0xe1, 0x10, 0xf, 0xfe,
+    0xf8, 0x88, 0x3, 0xf0, 0x80, 0x7f, 0xfe, 0x84,
+    0x3, 0xf7, 0x98, 0x7, 0xff, 0x7c, 0x44, 0x1,
+    0xf8, 0xc0, 0x3f, 0xf9, 0xbe, 0x1, 0xf8, 0xdc,
+    0x3, 0xf0, 0x80, 0x7f, 0xf5, 0x98, 0x40, 0x3f,
+    0xfa, 0xc2, 0x1, 0xf8, 0x88, 0x1, 0xf9, 0xc0,
+    0x3f, 0xf9, 0xa6, 0x1, 0xf8, 0x78, 0x3, 0xf1,
+    0x0, 0x7f, 0xf3, 0x44, 0x3, 0xe1, 0x2, 0x0,
+    0xfc, 0x20, 0x1f, 0xfc, 0xd6, 0x0, 0xf9, 0x41,
+    0x40, 0x3f, 0x78, 0x7, 0xff, 0x34, 0xc0, 0x3e,
+    0xc0, 0x11, 0x0, 0x7c, 0x40, 0x1f, 0xfc, 0xd1,
+    0x0, 0xf8, 0xc0, 0xa, 0x1, 0xf3, 0x0, 0x7f,
+    0xf3, 0x8, 0x3, 0xf2, 0x0, 0xc, 0x3, 0xe2,
+    0x0, 0xff, 0xe6, 0x30, 0x7, 0xc6, 0x1, 0x58,
+    0x7, 0xc2, 0x20, 0xf, 0xfe, 0x59, 0x0, 0x7d,
+    0x60, 0x11, 0x88, 0x7, 0xca, 0x1, 0xff, 0xcb,
+    0xf0, 0xf, 0x94, 0x3, 0x38, 0x7, 0xc6, 0x1,
+    0xff, 0xcb, 0x50, 0xf, 0x11, 0x0, 0x36, 0x80,
+    0x7d, 0x80, 0x1f, 0xfc, 0xb3, 0x0, 0xf5, 0x80,
+    0x72, 0x8, 0x7, 0x94, 0x3, 0xff, 0x94, 0x40,
+    0x1f, 0x30, 0x7, 0xa4, 0x3, 0xc2, 0x60, 0x1f,
+    0xfc, 0x94, 0x0, 0xf3, 0x80, 0x7c, 0xe0, 0x1f,
+    0x58, 0x7, 0xff, 0x27, 0x40, 0x3d, 0x40, 0x1f,
+    0x9c, 0x3, 0xca, 0x1, 0xff, 0xc9, 0x40, 0xe,
+    0x72, 0x0, 0xfd, 0x2, 0x1, 0xc4, 0x80, 0x1f,
+    0xfc, 0x75, 0x0, 0xe1, 0x80, 0xf, 0xf5, 0x80,
+    0x7b, 0x80, 0x3f, 0xf8, 0xfc, 0x1, 0xd6, 0x1,
+    0xff, 0x2a, 0x0, 0x72, 0x90, 0x7, 0xff, 0x14,
+    0x90, 0x3, 0x2a, 0x80, 0x3f, 0xf5, 0x90, 0x7,
+    0x48, 0x7, 0xff, 0x16, 0x0, 0x31, 0x50, 0x7,
+    0xff, 0xb, 0xc0, 0x39, 0x14, 0x3, 0xff, 0x86,
+    0x6a, 0x1, 0xf, 0x80, 0x7f, 0xf0, 0xcb, 0x4,
+    0x3, 0x51, 0x0, 0x7f, 0xf0, 0xb8, 0x2, 0x1c,
+    0x20, 0xf, 0xfe, 0x21, 0xe0, 0x80, 0x6f, 0x20,
+    0xf, 0xfd, 0x64, 0x0, 0x1c, 0x20, 0xf, 0xfe,
+    0x31, 0x7a, 0x0, 0x45, 0x86, 0x1, 0xfc, 0x38,
+    0x80, 0x4, 0xf2, 0x0, 0xff, 0xe4, 0xd, 0xd0,
+    0x80, 0x7, 0x28, 0xc0, 0x38, 0x5f, 0xcc, 0x6,
+    0x6c, 0x40, 0x3f, 0xf9, 0x6b, 0xd4, 0x60, 0x5,
+    0xce, 0xba, 0xbd, 0xe8, 0x11, 0x47, 0x30, 0x7,
+    0xff, 0x3d, 0x73, 0x65, 0x4c, 0xc8, 0xa8, 0x9,
+    0x19, 0xce, 0x1, 0xff, 0xc3,
 
     /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5a, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0xaf, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x9d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x6a, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x68, 0x89, 0xac, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb3, 0x0, 0x0, 0x5, 0xbc, 0xde, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xcb,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x12,
+    0x0, 0xff, 0xe2, 0xac, 0x0, 0x7f, 0xf2, 0x45,
+    0xfa, 0x8c, 0x3, 0xff, 0x8e, 0xb5, 0xd0, 0x20,
+    0x1f, 0xfc, 0x51, 0x5a, 0xfa, 0x50, 0xf, 0xfe,
+    0x21, 0x2c, 0xef, 0x52, 0x80, 0x7f, 0xf0, 0xda,
+    0xb3, 0xf6, 0x98, 0x80, 0x3f, 0xf8, 0xd6, 0xa6,
+    0x1, 0xff, 0xcb, 0xb7, 0x73, 0x29, 0x80, 0x7f,
+    0xf2, 0x1a, 0x21, 0x35, 0x9f, 0x68, 0x1, 0xff,
+    0xcc, 0x4b, 0x50, 0xf, 0xfe, 0x6d, 0x80, 0x7f,
+    0xf3, 0x45, 0x0, 0x3f, 0xf9, 0xa6, 0x1, 0xff,
+    0xcd, 0xf0, 0xf, 0xfe, 0x68, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xf7, 0x10, 0xf, 0xfe, 0x6f,
+    0x0, 0x7c, 0xc0, 0x1f, 0xfc, 0x55, 0x0, 0xf8,
+    0x80, 0x3f, 0xf8, 0x82, 0x60, 0x1f, 0x8c, 0x3,
+    0xff, 0x87, 0x40, 0x1f, 0xd0, 0x1, 0xff, 0x85,
+    0x71, 0x0, 0x3f, 0x92, 0xcc, 0x3, 0x96, 0xf3,
+    0x7b, 0x94, 0x60, 0x1f, 0xf2, 0x67, 0xee, 0x58,
+    0x6a, 0x19, 0x8, 0x7, 0xff, 0x14, 0x8d, 0x2,
+    0x7b, 0x9f, 0xff, 0xfc, 0x8e, 0xd0,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0x9c,
-    0xef, 0xff, 0xed, 0xa8, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfc, 0x74, 0x10, 0x1, 0x49,
-    0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfb, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1e, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xa5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x2, 0xff, 0xff, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x1, 0x68, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x70, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x5d, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x1e, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0,
+    0x0, 0xff, 0xc4, 0xd3, 0x9d, 0xff, 0x76, 0xd4,
+    0x20, 0x7, 0xff, 0x28, 0x5f, 0x75, 0x2c, 0x62,
+    0x1, 0x9, 0x2b, 0xdf, 0xc9, 0x80, 0x7f, 0xf1,
+    0xa3, 0xa0, 0x62, 0xfb, 0xfd, 0xd6, 0xc0, 0x1e,
+    0x6c, 0xa2, 0x0, 0xff, 0xe1, 0x1f, 0x3a, 0x66,
+    0x1d, 0x4, 0x0, 0x29, 0x3c, 0xe0, 0x1e, 0x5d,
+    0x50, 0xf, 0xfc, 0xd8, 0x35, 0x66, 0x1, 0xfc,
+    0x31, 0x60, 0x1f, 0x53, 0x80, 0x7f, 0x9a, 0x42,
+    0xd4, 0x3, 0xff, 0x82, 0x96, 0x1, 0xf4, 0x30,
+    0x7, 0xe4, 0x90, 0x84, 0x0, 0xff, 0xe1, 0xa3,
+    0x80, 0x7d, 0x26, 0x1, 0xe1, 0xa0, 0x17, 0x0,
+    0xff, 0xe2, 0xc0, 0x80, 0x7d, 0xc0, 0x1e, 0x81,
+    0x1, 0xa5, 0x0, 0xff, 0xe2, 0xc8, 0x7, 0xc4,
+    0xa0, 0x18, 0x98, 0x2, 0x5a, 0xc3, 0x0, 0xff,
+    0xe1, 0xb0, 0x7, 0xee, 0x0, 0xca, 0x1, 0xe3,
+    0xc2, 0x0, 0xff, 0xe1, 0x9, 0x0, 0x7c, 0x80,
+    0x1b, 0x0, 0x3f, 0x40, 0x7, 0xff, 0xd, 0x0,
+    0x3f, 0x18, 0x4, 0xc0, 0x1f, 0x9c, 0x3, 0xff,
+    0x87, 0xc0, 0x1f, 0x94, 0x2, 0x10, 0xf, 0xc2,
+    0x1, 0xff, 0xc3, 0x20, 0xf, 0xc2, 0x1, 0x20,
+    0x7, 0xe5, 0x0, 0xff, 0xe1, 0x88, 0x7, 0xfe,
+    0x91, 0x0, 0xf0, 0xc0, 0x7, 0xff, 0xd, 0xc0,
+    0x3f, 0xf0, 0xe8, 0x80, 0x61, 0xd1, 0x0, 0xff,
+    0xe6, 0x8, 0x6, 0x3f, 0x97, 0x75, 0x71, 0x80,
+    0x7f, 0xf1, 0x1c, 0x3, 0xf2, 0x80, 0x70, 0xb4,
+    0x41, 0x40, 0x3f, 0xf8, 0xc2, 0x1, 0xf8, 0x80,
+    0x3f, 0xfa, 0x6, 0x1, 0xf1, 0x8, 0x7, 0xff,
+    0x43, 0x80, 0x3e, 0x50, 0xf, 0xfe, 0x89, 0x80,
+    0x7d, 0x60, 0x1f, 0xfd, 0x15, 0x0, 0xf1, 0x98,
+    0x3, 0xff, 0xa0, 0x22, 0x0, 0xf4, 0x80, 0x7f,
+    0xf4, 0x50, 0x3, 0xc4, 0xa0, 0x1f, 0xfd, 0x1f,
+    0x0, 0xf4, 0x0, 0x7f, 0xf4, 0x90, 0x3, 0x8d,
+    0x40, 0x3f, 0xfa, 0x28, 0x20, 0x1d, 0xc0, 0x1f,
+    0xfd, 0x2e, 0x0, 0xe7, 0x20, 0xf, 0xfe, 0x92,
+    0x80, 0x62, 0x80, 0xf, 0xfe, 0x93, 0x0, 0x77,
+    0x0, 0x7f, 0xf4, 0xec, 0x3, 0x39, 0x80, 0x7f,
+    0xf4, 0x90, 0x80, 0x24, 0x80, 0xf, 0xfe, 0x9f,
+    0x80, 0x43, 0x40, 0x1f, 0xfd, 0x33, 0x40, 0xb,
+    0x44, 0x3, 0xff, 0xa7, 0x0, 0x14, 0x98, 0x7,
+    0xff, 0x4d, 0x10, 0x0, 0x66, 0x0, 0x7f, 0xf5,
+    0x20, 0x0, 0x72, 0x1, 0xff, 0xd4, 0x63, 0x1,
+    0xd0, 0xf, 0xfe, 0xa0, 0xc0, 0x3, 0x44, 0x3,
+    0xff, 0xa9, 0x2, 0x12, 0x60, 0x1f, 0xfd, 0x43,
+    0x60, 0x66, 0x0, 0x7f, 0xf5, 0x78, 0x12, 0x40,
+    0x3f, 0xfa, 0xb0, 0x44, 0xa0, 0xf, 0xfe, 0xa9,
+    0xb8, 0x78, 0x80, 0x7f, 0xf5, 0x78, 0x28, 0x80,
+    0x3f, 0xfa, 0xb0, 0x50, 0xa0, 0x1f, 0xfd, 0x54,
+    0x75, 0x70, 0xf, 0xfe, 0xa8, 0xd1, 0x50, 0x7,
+    0xff, 0x5a, 0x87, 0xc0, 0x3f, 0xf8, 0xe2, 0x84,
+    0x1, 0xff, 0xa1, 0x28, 0x80, 0x3f, 0xf8, 0xed,
+    0x76, 0x0, 0xff, 0x91, 0xd9, 0x40, 0x3f, 0xf9,
+    0x1a, 0x2, 0x1, 0xfe, 0x2a, 0x29, 0x0, 0xff,
+    0xe4, 0xb8, 0x78, 0x7, 0xfb, 0xc7, 0xc0, 0x3f,
+    0xf9, 0x22, 0x40, 0x1f, 0xf5, 0x15, 0x10, 0x7,
+    0xff, 0x25, 0x80, 0x2, 0x1, 0xf9, 0xd5, 0x60,
+    0xf, 0xfe, 0x48, 0xc8, 0x7, 0xf9, 0x60, 0x6c,
+    0x3, 0xff, 0x95, 0x42, 0x0, 0x10, 0xf, 0x1d,
+    0x6, 0x88, 0x7, 0xff, 0x1c, 0x57, 0x50, 0x3,
+    0xf8, 0x74, 0x1, 0xbd, 0xdf, 0xfc, 0x9a, 0x20,
+    0xd, 0xe0, 0x1d, 0x82, 0x0, 0x11, 0xff, 0xe4,
+    0x80, 0x7f, 0xeb, 0x20, 0xf, 0xfe, 0x99, 0x0,
+    0x52, 0x80, 0x1f, 0xfd, 0x41, 0x0, 0x3b, 0x0,
+    0x7f, 0xf5, 0x58, 0x6, 0x0, 0x3f, 0xfa, 0xc6,
+    0x6, 0x1, 0xff, 0xd7, 0x10,
 
     /* U+0033 "3" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0x8b, 0xde, 0xff, 0xed, 0xc9, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xaf, 0xfe,
-    0x96, 0x32, 0x13, 0x59, 0xef, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfd,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0x87, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xdd, 0xa7,
-    0x7c, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfd, 0xff, 0xdc, 0xb9,
-    0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0x71, 0x0, 0x37, 0xcf, 0xff, 0xfe, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2b, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x2, 0x8a, 0x96, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xb0, 0x4, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xc4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8f, 0xff, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x6c, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xdf, 0xff, 0xdb, 0x98, 0x89, 0xbe, 0xff,
-    0xff, 0xe9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xac,
-    0xef, 0xff, 0xfe, 0xdb, 0x86, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0xa, 0xc5, 0xef, 0x7f, 0xbb,
+    0x72, 0x54, 0x40, 0x3f, 0xf9, 0x82, 0xfb, 0xd4,
+    0xe8, 0x42, 0x0, 0x12, 0x36, 0xae, 0xb4, 0x0,
+    0xff, 0xe4, 0x15, 0x74, 0x1b, 0x4e, 0x6f, 0x65,
+    0x30, 0x80, 0x72, 0x5e, 0x10, 0x7, 0xff, 0x15,
+    0xf5, 0x52, 0xfa, 0x58, 0xc8, 0x4d, 0x67, 0x9c,
+    0x3, 0xc7, 0xae, 0x1, 0xff, 0xc3, 0xb8, 0xa,
+    0xb4, 0x0, 0xff, 0x45, 0x80, 0x7d, 0x12, 0x1,
+    0xff, 0xc1, 0xc4, 0x1d, 0x50, 0xf, 0xfe, 0xa,
+    0x50, 0x7, 0xcc, 0xe0, 0x1f, 0xf5, 0x18, 0x69,
+    0x0, 0x7f, 0xf0, 0xd5, 0x40, 0x1f, 0x41, 0x80,
+    0x7f, 0x32, 0x83, 0x18, 0x7, 0xff, 0x16, 0x0,
+    0x3f, 0x78, 0x7, 0xf4, 0x0, 0x12, 0x8, 0x3,
+    0xff, 0x88, 0x48, 0x1, 0xf1, 0x98, 0x3, 0xe7,
+    0x10, 0x1, 0x3e, 0xc8, 0x7, 0xff, 0x13, 0x80,
+    0x3f, 0x50, 0x7, 0xd4, 0x1, 0xe6, 0xb0, 0xf,
+    0xfe, 0x1a, 0x0, 0x7e, 0x40, 0xf, 0x9, 0x0,
+    0x7c, 0x88, 0x0, 0xff, 0xe1, 0x8, 0x80, 0x3e,
+    0x20, 0xf, 0x10, 0x7, 0xf1, 0x80, 0x7f, 0xf0,
+    0xc8, 0x3, 0xf0, 0x80, 0x70, 0x80, 0x7f, 0x8,
+    0x7, 0xff, 0xd, 0xc0, 0x3f, 0x18, 0x7, 0x10,
+    0x80, 0x7e, 0x50, 0xf, 0xfe, 0x18, 0x80, 0x7e,
+    0x30, 0xf, 0x40, 0x7, 0xca, 0x60, 0x1f, 0xfc,
+    0x33, 0x0, 0xfc, 0x20, 0x1e, 0x67, 0x0, 0xe5,
+    0xa0, 0xf, 0xfe, 0x21, 0x80, 0x7c, 0x60, 0x1f,
+    0xa3, 0x61, 0xe3, 0x28, 0x3, 0xff, 0x8a, 0x20,
+    0x1f, 0x28, 0x7, 0xf1, 0x3c, 0x39, 0x80, 0x7f,
+    0xf1, 0x98, 0x3, 0xea, 0x0, 0xff, 0xea, 0x10,
+    0x7, 0x88, 0xc0, 0x3f, 0xfa, 0x64, 0x1, 0xf4,
+    0x80, 0x7f, 0xf5, 0x14, 0x3, 0xca, 0x80, 0x1f,
+    0xfd, 0x4b, 0x0, 0xe2, 0xa0, 0xf, 0xfe, 0xa1,
+    0x98, 0x3, 0xf, 0x80, 0x7f, 0xf5, 0x64, 0x3,
+    0xe, 0x10, 0x7, 0xff, 0x50, 0xd4, 0x2, 0x2c,
+    0x20, 0xf, 0xfe, 0xaf, 0x0, 0x49, 0x84, 0x1,
+    0xff, 0xd5, 0xb2, 0x1, 0x9b, 0x10, 0xf, 0xfe,
+    0xa1, 0x6a, 0x3, 0x7b, 0x0, 0x7f, 0xf5, 0x6,
+    0x74, 0x9b, 0x64, 0x40, 0x3f, 0xf9, 0xd3, 0xba,
+    0xa7, 0x76, 0x72, 0xcf, 0x49, 0x0, 0x7f, 0xf3,
+    0xd1, 0x88, 0x8b, 0x14, 0x60, 0x35, 0x49, 0x62,
+    0x0, 0xff, 0xe7, 0x22, 0x0, 0xa3, 0xb7, 0xf2,
+    0x81, 0x1a, 0x77, 0xa4, 0xc0, 0x3f, 0xf9, 0x97,
+    0xfa, 0xe2, 0x0, 0x37, 0xcd, 0x40, 0x0, 0xb6,
+    0x6a, 0x80, 0x7f, 0xf5, 0xa, 0xe8, 0x40, 0x22,
+    0xac, 0x20, 0xf, 0xfe, 0xa2, 0xe0, 0x80, 0x63,
+    0xd7, 0x0, 0xff, 0xea, 0x17, 0x90, 0x7, 0x44,
+    0x80, 0x7f, 0xf5, 0x7, 0x80, 0x3c, 0xd4, 0x1,
+    0xff, 0xd4, 0x37, 0x0, 0xf2, 0xc0, 0x7, 0xff,
+    0x52, 0x4, 0x3, 0xce, 0x60, 0x1f, 0xfd, 0x49,
+    0x0, 0xfb, 0x80, 0x3f, 0xfa, 0x8c, 0x1, 0xf1,
+    0x20, 0x7, 0xff, 0x4c, 0x4c, 0x3, 0xef, 0x0,
+    0xff, 0xea, 0x20, 0x7, 0xc8, 0x1, 0xff, 0xd4,
+    0xd0, 0xf, 0xc6, 0x1, 0xff, 0xd3, 0x60, 0xf,
+    0xca, 0x1, 0xff, 0xd3, 0x10, 0xf, 0xc2, 0x1,
+    0xff, 0xd3, 0x20, 0xf, 0xde, 0x1, 0xff, 0xff,
+    0x0, 0xf7, 0x80, 0x7f, 0xf4, 0xc4, 0x3, 0xf0,
+    0x80, 0x7f, 0xf4, 0xcc, 0x3, 0xf2, 0x80, 0x45,
+    0x15, 0x2c, 0x1, 0xff, 0xcb, 0x70, 0xf, 0xc6,
+    0x0, 0x7d, 0x75, 0x69, 0xd2, 0x0, 0xff, 0xe4,
+    0xe8, 0x7, 0xc8, 0x0, 0x48, 0x0, 0xe2, 0xc0,
+    0xf, 0xfe, 0x4a, 0x0, 0x7d, 0xa0, 0x8, 0x0,
+    0xf8, 0x58, 0x3, 0xff, 0x8e, 0x26, 0x1, 0xe1,
+    0x60, 0x1, 0x80, 0x7e, 0xf0, 0xf, 0xfe, 0x3b,
+    0x0, 0x7d, 0x20, 0x1f, 0xf8, 0xc0, 0x3f, 0xf8,
+    0xf4, 0x1, 0xe2, 0x70, 0x8, 0x40, 0x3f, 0x10,
+    0x7, 0xff, 0x19, 0x48, 0x3, 0xde, 0x1, 0x9c,
+    0x3, 0xf5, 0x80, 0x7f, 0xf1, 0x46, 0xc0, 0x3d,
+    0x44, 0x1, 0xa0, 0x3, 0xe7, 0x30, 0xf, 0xfe,
+    0x2d, 0x8, 0x7, 0x4a, 0x80, 0x70, 0xd8, 0x6,
+    0x3b, 0x80, 0xf, 0xfe, 0x2c, 0xa0, 0x7, 0x5b,
+    0x0, 0x7c, 0x92, 0x1, 0x4a, 0x0, 0x7f, 0xf1,
+    0x69, 0x80, 0x31, 0xea, 0x0, 0x7f, 0x35, 0x88,
+    0x54, 0x88, 0x7, 0xff, 0x9, 0x75, 0x40, 0x21,
+    0x9c, 0x20, 0xf, 0xf9, 0x3d, 0xc1, 0xba, 0x94,
+    0x3, 0xf8, 0x5b, 0x28, 0x80, 0x3, 0x1c, 0xc0,
+    0x1f, 0xfc, 0x21, 0x8e, 0x82, 0x5a, 0xfd, 0xb9,
+    0x88, 0x4d, 0xf7, 0x24, 0xc0, 0x5a, 0xf9, 0xc0,
+    0x3f, 0xf8, 0xc2, 0xfb, 0xa8, 0x51, 0x56, 0x77,
+    0x32, 0x9a, 0x3c, 0xef, 0x4a, 0x0, 0x7f, 0xf0,
+    0x40,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xce, 0xdf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x5b,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0xbf, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf1, 0xb, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfb,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x60, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xb0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf1, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x60, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0xcf, 0xff, 0xff, 0xff, 0x71,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9b, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xcb, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x0,
+    0x0, 0xff, 0xe9, 0x94, 0x18, 0x7, 0xff, 0x7b,
+    0x5d, 0x40, 0x3f, 0xfb, 0xb2, 0x1, 0xff, 0xdf,
+    0x26, 0x0, 0xff, 0xef, 0xe8, 0x7, 0xff, 0x7d,
+    0xc0, 0x3f, 0xfb, 0xe5, 0x0, 0x1f, 0xfd, 0xff,
+    0x0, 0xff, 0xef, 0xb9, 0x0, 0x7f, 0xf7, 0x8a,
+    0x0, 0x3f, 0xfb, 0xfc, 0x1, 0xff, 0xdf, 0x73,
+    0x0, 0xff, 0xef, 0x14, 0x0, 0x7f, 0xf7, 0xf8,
+    0x48, 0x3, 0xff, 0xba, 0xe7, 0x6c, 0x1, 0xff,
+    0xdc, 0x28, 0x45, 0x0, 0xff, 0xee, 0xf0, 0x50,
+    0x7, 0xff, 0x75, 0xce, 0x44, 0x3, 0xff, 0xb8,
+    0x50, 0x8c, 0x1, 0xff, 0xdd, 0xe0, 0xa0, 0xf,
+    0xfe, 0xeb, 0x9c, 0x88, 0x7, 0xff, 0x70, 0xe1,
+    0x18, 0x3, 0xff, 0xbb, 0xc1, 0x40, 0x1f, 0xfd,
+    0xd8, 0x29, 0x10, 0xf, 0xfe, 0xe1, 0xba, 0x30,
+    0x7, 0xff, 0x77, 0x82, 0x80, 0x3f, 0xfb, 0xb0,
+    0x52, 0x20, 0x1f, 0xfd, 0xc3, 0x74, 0x60, 0xf,
+    0xfe, 0xef, 0x5, 0x0, 0x7f, 0xf7, 0x60, 0xa4,
+    0x40, 0x3f, 0xfb, 0x86, 0xe8, 0xc0, 0x1f, 0xfd,
+    0xde, 0xa, 0x0, 0xff, 0xee, 0xc1, 0x48, 0x80,
+    0x7f, 0xf7, 0xd, 0xd1, 0x80, 0x3f, 0xfb, 0xbc,
+    0x14, 0x1, 0xff, 0xdd, 0x92, 0x91, 0x0, 0xff,
+    0xee, 0x1b, 0x23, 0x0, 0x7f, 0xf7, 0x78, 0x28,
+    0x3, 0xff, 0xbb, 0x25, 0x22, 0x1, 0xff, 0xdc,
+    0x46, 0x46, 0x0, 0xff, 0xee, 0xc8, 0x48, 0x7,
+    0xff, 0x76, 0x4a, 0x48, 0x3, 0xff, 0xb8, 0x8c,
+    0x8c, 0x1, 0xff, 0xdd, 0xa0, 0x4f, 0xff, 0xfe,
+    0x3a, 0x0, 0x7d, 0x3f, 0xff, 0xeb, 0x0, 0x48,
+    0x80, 0x7f, 0xf7, 0x91, 0x80, 0x3f, 0xfb, 0xc3,
+    0x40, 0x1f, 0xfd, 0xf6, 0x10, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0x5, 0xfb, 0xbf, 0xf9, 0x86, 0x1,
+    0xf4, 0x77, 0x7f, 0xac, 0x4, 0x7f, 0xf9, 0x8e,
+    0x1, 0xf0, 0x8f, 0xfc, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfd, 0xd7, 0x0, 0xff, 0xf0, 0x10,
+    0x7, 0xdc, 0x1, 0xff, 0xd7, 0x11, 0x0, 0x7c,
+    0x40, 0x1f, 0xfd, 0x77, 0x0, 0xfc, 0x80, 0x1f,
+    0xfd, 0x61, 0x80, 0xf, 0xc2, 0xc0, 0x1f, 0xfd,
+    0x32, 0x7f, 0x10, 0xf, 0xe9, 0x82, 0x0, 0xff,
+    0xe6, 0x4d, 0xe6, 0xfe, 0xc0, 0x80, 0x7f, 0xcf,
+    0xbd, 0x96, 0xe0, 0x1f, 0xfc, 0x84, 0x41, 0x90,
+    0x7, 0xff, 0x14, 0x4d, 0x34, 0x3, 0xff, 0x91,
+    0xfd, 0xff, 0xff, 0xc9, 0xeb, 0x0, 0xc0,
 
     /* U+0035 "5" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x13, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x49,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x4,
-    0x7a, 0xcd, 0xef, 0xfe, 0xca, 0x73, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6,
-    0x0, 0x4a, 0xff, 0xff, 0xfd, 0xde, 0xff, 0xff,
-    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf6, 0x5d, 0xff, 0xc7, 0x41, 0x0,
-    0x0, 0x14, 0xaf, 0xff, 0xff, 0xfc, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x4, 0x76,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xb0,
-    0x3, 0xef, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0x50, 0x2f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x80, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xaf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xe8, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0x9f, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xfe, 0xb9, 0x89, 0xac, 0xff, 0xff, 0xfc,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x6a, 0xde, 0xff, 0xfe,
-    0xca, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0xe9, 0x8f, 0xc8, 0x7, 0xff, 0x5d,
+    0xc0, 0x40, 0x3f, 0xfa, 0xc7, 0x21, 0xc0, 0x1f,
+    0x84, 0xc4, 0x3, 0xff, 0x90, 0x49, 0x38, 0x1,
+    0xff, 0x3e, 0x77, 0xff, 0xff, 0x23, 0x6d, 0x80,
+    0x23, 0x0, 0xff, 0xf1, 0x8, 0x7, 0xff, 0x40,
+    0xc0, 0x3f, 0x78, 0x7, 0xff, 0x40, 0x40, 0x3f,
+    0xfb, 0x3c, 0x1, 0xf8, 0x40, 0x3f, 0xfa, 0xa,
+    0x1, 0xff, 0xd9, 0x20, 0xf, 0xc6, 0x1b, 0xff,
+    0xff, 0xce, 0xe0, 0xf, 0xc2, 0x6, 0x1, 0xff,
+    0xfd, 0x70, 0x10, 0xf, 0xff, 0xe8, 0x80, 0x7f,
+    0xf6, 0x4c, 0x40, 0x3f, 0xff, 0xc2, 0x60, 0x1f,
+    0xff, 0xf1, 0x0, 0xff, 0xeb, 0x88, 0x7, 0xff,
+    0x6d, 0xc0, 0x3f, 0xfa, 0xe6, 0x2, 0x1, 0xff,
+    0xfd, 0x10, 0x30, 0xf, 0xfe, 0xbb, 0x80, 0x7f,
+    0xf6, 0xc4, 0x3, 0xff, 0xae, 0x21, 0xe0, 0x1f,
+    0xfd, 0xf4, 0x7a, 0xcd, 0xef, 0xf7, 0x65, 0x39,
+    0x80, 0x7f, 0xf1, 0x4c, 0x4, 0x0, 0x95, 0xf7,
+    0xa, 0x60, 0x62, 0x2, 0x6b, 0x19, 0xf2, 0x60,
+    0x1f, 0xfc, 0x21, 0x0, 0x2e, 0xda, 0x9c, 0x5f,
+    0x7e, 0xeb, 0xb9, 0x6a, 0x1, 0x9b, 0x30, 0x80,
+    0x1f, 0xfc, 0x28, 0xa0, 0x8e, 0xc7, 0x41, 0x0,
+    0xc2, 0x95, 0xcc, 0x1, 0x8e, 0xe8, 0x40, 0x3f,
+    0xf0, 0xce, 0xb8, 0x80, 0x7f, 0xc3, 0x36, 0x1,
+    0xcb, 0xe6, 0x1, 0xfc, 0xf7, 0xcc, 0x1, 0xff,
+    0xc4, 0x4c, 0x0, 0xe1, 0xc4, 0x0, 0xfe, 0x41,
+    0x0, 0xff, 0xe3, 0x1c, 0x80, 0x7a, 0xd0, 0x3,
+    0xff, 0xa2, 0xc8, 0x1, 0xea, 0x20, 0xf, 0xfe,
+    0x8c, 0x0, 0x78, 0x78, 0x3, 0xff, 0xa2, 0x68,
+    0x1, 0xe3, 0x50, 0xf, 0xfe, 0x8f, 0x0, 0x7d,
+    0x60, 0x1f, 0xfd, 0x15, 0x0, 0xf8, 0x50, 0x3,
+    0xff, 0xa2, 0x60, 0x1f, 0x70, 0x7, 0xff, 0x45,
+    0x40, 0x3e, 0x50, 0xf, 0xfe, 0x8f, 0x0, 0x7e,
+    0x20, 0xf, 0xfe, 0x81, 0x0, 0x7e, 0x70, 0xf,
+    0xfe, 0x83, 0x0, 0x7e, 0x30, 0xf, 0xfe, 0xc8,
+    0x80, 0x7f, 0xf4, 0x4, 0x3, 0xf7, 0x80, 0x7f,
+    0xfd, 0x84, 0x3, 0xf7, 0x80, 0x7f, 0xf6, 0x44,
+    0x3, 0xff, 0xa0, 0xe0, 0x1f, 0x8c, 0x3, 0xff,
+    0xa0, 0x40, 0x1f, 0x9c, 0x3, 0xff, 0xa1, 0xc0,
+    0x1f, 0x88, 0x2, 0x47, 0x63, 0x0, 0xff, 0xe4,
+    0x90, 0x7, 0xc8, 0x0, 0x3e, 0xb8, 0x9c, 0xc0,
+    0x80, 0x7f, 0xf1, 0xdc, 0x3, 0xee, 0x2, 0xc1,
+    0x0, 0xc7, 0x80, 0x1f, 0xfc, 0x72, 0x0, 0xf9,
+    0x42, 0xc0, 0x3e, 0x27, 0x0, 0xff, 0xe2, 0xa8,
+    0x7, 0xcc, 0x0, 0x70, 0xf, 0xda, 0x1, 0xff,
+    0xc5, 0xf0, 0xf, 0xa0, 0x3, 0xfe, 0x10, 0xf,
+    0xfe, 0x2a, 0x80, 0x79, 0xc4, 0x0, 0x40, 0x1f,
+    0x84, 0x3, 0xff, 0x88, 0xe0, 0x1e, 0x38, 0x0,
+    0xa8, 0x3, 0xf7, 0x80, 0x7f, 0xf1, 0x24, 0x3,
+    0x87, 0x80, 0x33, 0x10, 0x7, 0x95, 0x40, 0x1f,
+    0xfc, 0x3a, 0x10, 0xe, 0xd2, 0x0, 0xee, 0x0,
+    0xc5, 0x34, 0x1, 0xff, 0xc3, 0x65, 0x0, 0xc3,
+    0x86, 0x1, 0xe3, 0xb0, 0xa, 0x18, 0x3, 0xff,
+    0x86, 0xd2, 0x1, 0x8f, 0xcc, 0x3, 0xf2, 0x69,
+    0x5, 0x40, 0x7, 0xff, 0x4, 0x6a, 0x40, 0x34,
+    0x60, 0x80, 0x7f, 0x8b, 0x60, 0x5f, 0xa0, 0xc0,
+    0x3f, 0x24, 0xf2, 0x80, 0x4d, 0xce, 0x1, 0xff,
+    0xc2, 0x7e, 0x83, 0x7c, 0xeb, 0x98, 0x9a, 0xcf,
+    0xb6, 0x0, 0x1c, 0xfc, 0x88, 0x7, 0xff, 0x15,
+    0xf7, 0x52, 0x8c, 0xee, 0x65, 0x23, 0x57, 0xbf,
+    0xc6, 0x0, 0xff, 0xe0, 0x80,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0xac, 0xef, 0xfe, 0xdb, 0x85, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xeb,
-    0x99, 0xab, 0xef, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0xff, 0xf8, 0x20, 0x0, 0x0, 0x0, 0x16,
-    0xcf, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6e, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x58, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1, 0x6a, 0xde, 0xff, 0xeb, 0x84, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xfe,
-    0xde, 0xff, 0xff, 0xfe, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x8f, 0xf9, 0x40, 0x0, 0x2, 0x8f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0xcf, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xe0, 0x1e, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfa, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfe, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xd0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xc0, 0xd, 0xff, 0xff,
-    0xff, 0xfd, 0x6f, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0x30, 0xdf, 0xff, 0xff, 0xff, 0xeb, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xfa, 0xd, 0xff,
-    0xff, 0xff, 0xfe, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xe0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x3d,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf7, 0xcf, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x9b, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xfc, 0xaf, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfd,
-    0xc, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xd0, 0x9f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xfa, 0x5, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x10, 0x6,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff,
-    0xfa, 0x40, 0x0, 0x2, 0x7e, 0xff, 0xff, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xff, 0xfd, 0xde,
-    0xff, 0xff, 0xe9, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x15, 0x9c, 0xef, 0xff, 0xed, 0xa7, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe3, 0x13, 0xd6, 0x77, 0xfb, 0xb6,
+    0xe1, 0x44, 0x3, 0xff, 0x9c, 0xfb, 0xa8, 0x52,
+    0x56, 0x62, 0x32, 0xbd, 0x75, 0x98, 0x7, 0xff,
+    0x29, 0xfa, 0x8, 0x1f, 0x7a, 0xe6, 0x55, 0x7d,
+    0xc9, 0x34, 0xca, 0x10, 0xf, 0xfe, 0x31, 0x6c,
+    0x8, 0x27, 0x41, 0x0, 0x7c, 0x2d, 0x8c, 0xb,
+    0xe4, 0x1, 0xff, 0xc4, 0x5d, 0x20, 0x3, 0xd8,
+    0x80, 0x7f, 0xcc, 0xe0, 0x1, 0xd3, 0x0, 0xff,
+    0xe1, 0x35, 0x0, 0x4f, 0x0, 0x1f, 0xf9, 0xe4,
+    0x40, 0x36, 0x88, 0x7, 0xfe, 0x69, 0x0, 0x92,
+    0x0, 0x3f, 0xf1, 0x40, 0x7, 0x86, 0x40, 0x3f,
+    0xe5, 0x90, 0xd, 0x40, 0x1f, 0xfc, 0x18, 0x0,
+    0xfc, 0x80, 0x1f, 0xe2, 0xa0, 0xd, 0x2, 0x1,
+    0xff, 0xc1, 0x60, 0xf, 0xc4, 0x1, 0xfe, 0xf0,
+    0xc, 0x2e, 0x1, 0xff, 0xc2, 0x10, 0xf, 0xc6,
+    0x1, 0xfd, 0x4, 0x1, 0xa4, 0x3, 0xff, 0x86,
+    0x80, 0x1f, 0x94, 0x3, 0xf1, 0x38, 0x7, 0x30,
+    0x7, 0xff, 0xe, 0xc0, 0x3e, 0x19, 0x0, 0xfd,
+    0x0, 0x1c, 0x82, 0x1, 0xff, 0xc3, 0x2c, 0x10,
+    0xc, 0x58, 0x20, 0x1f, 0x1a, 0x80, 0x76, 0x80,
+    0x7f, 0xf1, 0x4f, 0xa9, 0xdd, 0x5a, 0x40, 0x1f,
+    0xa4, 0x3, 0xce, 0x1, 0xff, 0xc7, 0x58, 0x82,
+    0x80, 0x7f, 0xa, 0x80, 0x71, 0x8, 0x7, 0xff,
+    0x52, 0x40, 0x3c, 0x80, 0x1f, 0xfd, 0x56, 0x0,
+    0xf6, 0x0, 0x7f, 0xf5, 0xc, 0x40, 0x3c, 0xe0,
+    0x1f, 0xfd, 0x4b, 0x0, 0xf8, 0x80, 0x3f, 0xfa,
+    0x8a, 0x1, 0xe2, 0x0, 0xff, 0xea, 0x11, 0x0,
+    0x3c, 0xe0, 0x1f, 0xfd, 0x47, 0x0, 0xf8, 0x80,
+    0x3f, 0xfa, 0x98, 0x1, 0xf7, 0x0, 0x7f, 0xf5,
+    0x14, 0x3, 0xe3, 0x0, 0xff, 0xea, 0x18, 0x7,
+    0xcc, 0x1, 0xf8, 0x5a, 0xb7, 0xbf, 0xdd, 0x70,
+    0x80, 0x1f, 0xf8, 0x80, 0x3f, 0x8, 0x7, 0x8a,
+    0xba, 0x54, 0xcc, 0x20, 0x28, 0xf7, 0xd2, 0x20,
+    0x1f, 0xcc, 0x1, 0xf8, 0xc0, 0x3a, 0x35, 0x5a,
+    0xff, 0xb7, 0xb5, 0xc0, 0x21, 0x6e, 0x80, 0xf,
+    0xc2, 0x1, 0xf8, 0x40, 0x36, 0x3a, 0xf4, 0xa0,
+    0x6, 0x28, 0xd2, 0x0, 0xcf, 0xa4, 0x1, 0xe2,
+    0x0, 0xff, 0xd8, 0x73, 0x42, 0x1, 0xf8, 0xb0,
+    0x80, 0x31, 0x61, 0x80, 0x77, 0x0, 0x7f, 0xd4,
+    0x72, 0xc0, 0x1f, 0xf0, 0xf8, 0x7, 0xe, 0x10,
+    0x6, 0x20, 0xf, 0x84, 0x0, 0xca, 0xec, 0x1,
+    0xff, 0xc1, 0x29, 0x0, 0xf7, 0x88, 0x7, 0xff,
+    0x4, 0x60, 0xa0, 0x3, 0xff, 0x86, 0xc4, 0x1,
+    0xc5, 0x60, 0x13, 0x80, 0x7f, 0x48, 0xf0, 0x7,
+    0xff, 0x16, 0xc0, 0x3c, 0xa8, 0x1, 0xfe, 0x30,
+    0x64, 0x30, 0xf, 0xfe, 0x2b, 0x80, 0x7d, 0x0,
+    0x1, 0x0, 0xfc, 0xc3, 0x0, 0x1f, 0xfc, 0x61,
+    0x30, 0xf, 0x19, 0x80, 0x3f, 0x8f, 0x48, 0xc0,
+    0x3f, 0xf8, 0xe8, 0x1, 0xf4, 0x80, 0x7f, 0x92,
+    0x80, 0x3f, 0xf9, 0x1a, 0x1, 0xf2, 0x0, 0x7f,
+    0x8, 0x28, 0x7, 0xff, 0x21, 0x80, 0x3e, 0x13,
+    0x0, 0xfe, 0x22, 0x0, 0x7f, 0xf2, 0x8, 0x3,
+    0xf2, 0x8, 0x7, 0xe7, 0x0, 0xff, 0xe4, 0x88,
+    0x7, 0xee, 0x70, 0xf, 0xd8, 0x1, 0xff, 0xca,
+    0x10, 0xf, 0x94, 0x40, 0x3f, 0x10, 0x7, 0xff,
+    0x28, 0xc0, 0x3e, 0x12, 0x0, 0xfc, 0xc0, 0x1f,
+    0xfc, 0xa1, 0x0, 0xf8, 0xfc, 0x3, 0xf0, 0x80,
+    0x7f, 0xf4, 0x84, 0xc0, 0x3f, 0x38, 0x7, 0xff,
+    0x29, 0xc0, 0x3f, 0x30, 0x7, 0xe1, 0x0, 0xff,
+    0xe5, 0x38, 0x7, 0xc2, 0x40, 0x1f, 0x88, 0x3,
+    0xff, 0xa4, 0x60, 0x60, 0x1f, 0x70, 0x7, 0xff,
+    0x28, 0x40, 0x3f, 0x94, 0x3, 0xe5, 0x0, 0xff,
+    0xe5, 0x18, 0x7, 0xce, 0x18, 0x1, 0xf1, 0x0,
+    0x7f, 0xf2, 0x84, 0x3, 0xe2, 0x4, 0x0, 0xf8,
+    0x48, 0x3, 0xff, 0x90, 0x20, 0x1f, 0xb4, 0x4,
+    0xc0, 0x3e, 0x70, 0xf, 0xfe, 0x41, 0x0, 0x7e,
+    0x40, 0x5, 0x0, 0x7d, 0x80, 0x1f, 0xfc, 0x85,
+    0x0, 0xf8, 0xc4, 0x0, 0xe0, 0x1f, 0x20, 0x7,
+    0xff, 0x23, 0xc0, 0x3e, 0xb0, 0x8, 0x58, 0x3,
+    0xc4, 0x20, 0x1f, 0xfc, 0x74, 0x0, 0xf9, 0x80,
+    0x35, 0x80, 0x7c, 0xc0, 0x1f, 0xfc, 0x61, 0x20,
+    0xf, 0x30, 0x80, 0x62, 0x60, 0xf, 0x50, 0x7,
+    0xff, 0x19, 0x80, 0x3e, 0xb0, 0xf, 0x40, 0x80,
+    0x71, 0x20, 0x7, 0xff, 0x16, 0x80, 0x3d, 0x24,
+    0x1, 0xe1, 0xb0, 0xf, 0x40, 0x7, 0xff, 0x11,
+    0x48, 0x3, 0x91, 0x80, 0x3f, 0x2b, 0x80, 0x71,
+    0xa8, 0x7, 0xff, 0xe, 0x0, 0x38, 0xa8, 0x3,
+    0xfd, 0xa, 0x1, 0xd6, 0x20, 0x1f, 0xfc, 0x19,
+    0x20, 0xc, 0x5e, 0x20, 0x1f, 0xf5, 0x28, 0x6,
+    0x1c, 0x10, 0xf, 0xf9, 0xd8, 0x3, 0x1e, 0x10,
+    0x7, 0xff, 0x6, 0xa0, 0x3, 0x16, 0x18, 0x7,
+    0xf4, 0xc0, 0x6, 0x7c, 0x10, 0xf, 0xfe, 0x1b,
+    0xe1, 0x80, 0x45, 0x94, 0x80, 0x18, 0x9f, 0x98,
+    0x2, 0x4c, 0x80, 0xf, 0xfe, 0x31, 0xe5, 0xa0,
+    0x4, 0xb7, 0xfb, 0xae, 0xd8, 0x10, 0x16, 0xcb,
+    0x30, 0xf, 0xfe, 0x4a, 0x5f, 0x53, 0x18, 0x81,
+    0x10, 0x9, 0x62, 0xfa, 0x4c, 0x3, 0xfe,
 
     /* U+0037 "7" */
-    0x5d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x25, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xc6, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0xd, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0,
-    0x0, 0xdf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0x0, 0x0, 0xe, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x0, 0x0, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x47, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x5d, 0xdf, 0xfe, 0xd9, 0x1, 0x17, 0xff, 0x6c,
+    0x58, 0x3, 0xff, 0xb4, 0x46, 0x40, 0x1f, 0xfd,
+    0xa8, 0x1, 0x0, 0xff, 0xec, 0x92, 0x80, 0x7f,
+    0xf6, 0xe0, 0x2, 0x10, 0xf, 0xfe, 0xb9, 0xa8,
+    0x4, 0x60, 0x1c, 0x73, 0x9d, 0xff, 0xff, 0xcc,
+    0x40, 0xf0, 0xf, 0xc5, 0x98, 0x63, 0x10, 0xf,
+    0xfe, 0x5a, 0xa2, 0x98, 0x7, 0xc5, 0x86, 0x1,
+    0xff, 0xcf, 0xb0, 0x80, 0xe, 0x30, 0x4, 0x88,
+    0x7, 0xff, 0x3e, 0x5, 0xc8, 0x3, 0xe3, 0x40,
+    0xf, 0xfe, 0x79, 0x38, 0xc0, 0x7, 0x84, 0x2c,
+    0x3, 0xff, 0xa1, 0xc1, 0x0, 0x1f, 0xc8, 0x1,
+    0xff, 0xcf, 0x63, 0x26, 0x0, 0xf0, 0x80, 0xc,
+    0x3, 0xff, 0x9c, 0x30, 0x12, 0x1, 0xf0, 0xee,
+    0x80, 0x3f, 0xf9, 0xf0, 0x26, 0x80, 0x1f, 0x88,
+    0x80, 0x1f, 0xfc, 0xe3, 0x60, 0xf0, 0xf, 0xfe,
+    0xcf, 0x2, 0x98, 0x7, 0xff, 0x61, 0xc8, 0x20,
+    0x3, 0xff, 0xb0, 0x30, 0xc, 0x40, 0x1f, 0xfd,
+    0x8b, 0x0, 0x58, 0x7, 0xff, 0x60, 0xd4, 0x18,
+    0x80, 0x3f, 0xfb, 0x1e, 0x0, 0xb0, 0xf, 0xfe,
+    0xc3, 0x18, 0x31, 0x0, 0x7f, 0xf6, 0x20, 0x1,
+    0x60, 0x1f, 0xfd, 0x88, 0x10, 0x52, 0x0, 0xff,
+    0xeb, 0x8b, 0x80, 0x24, 0x3, 0xff, 0xb1, 0x0,
+    0x3, 0x30, 0x7, 0xff, 0x5c, 0x98, 0x1, 0x20,
+    0x1f, 0xfd, 0x89, 0x0, 0xa, 0x80, 0x7f, 0xf5,
+    0xcd, 0x0, 0x12, 0x1, 0xff, 0xd8, 0x80, 0x9,
+    0x40, 0x3f, 0xfa, 0xe6, 0x80, 0x3, 0x20, 0xf,
+    0xfe, 0xbc, 0x0, 0x54, 0x1, 0xff, 0xd7, 0x34,
+    0x0, 0x98, 0x3, 0xff, 0xaf, 0x0, 0x12, 0x80,
+    0x7f, 0xf5, 0xc9, 0x0, 0x2f, 0x0, 0xff, 0xeb,
+    0xd8, 0x6, 0x40, 0xf, 0xfe, 0xb0, 0xb0, 0x4,
+    0x42, 0x1, 0xff, 0xd6, 0x60, 0xc, 0xa0, 0x1f,
+    0xfd, 0x7a, 0x0, 0xd8, 0x1, 0xff, 0xd6, 0x42,
+    0x0, 0xc8, 0x1, 0xff, 0xd6, 0xe0, 0xc, 0x60,
+    0x1f, 0xfd, 0x75, 0x0, 0xca, 0x1, 0xff, 0xd6,
+    0x50, 0xe, 0xf0, 0xf, 0xfe, 0xb7, 0x80, 0x72,
+    0x80, 0x7f, 0xf5, 0x94, 0x3, 0x88, 0x3, 0xff,
+    0xaa, 0x80, 0x1e, 0x10, 0xf, 0xfe, 0xae, 0x80,
+    0x70, 0x80, 0x7f, 0xf5, 0x90, 0x3, 0x8c, 0x3,
+    0xff, 0xaa, 0x24, 0x1, 0xcc, 0x1, 0xff, 0xd5,
+    0x50, 0xf, 0xfe, 0xe1, 0x80, 0x7f, 0xf7, 0x34,
+    0x3, 0xff, 0xb8, 0xe0, 0x1f, 0xfd, 0xc3, 0x0,
+    0xff, 0xee, 0x8, 0x7, 0x9c, 0x3, 0xff, 0xa8,
+    0x40, 0x1f, 0x8, 0x7, 0xff, 0x70, 0xc0, 0x3f,
+    0xfa, 0x82, 0x1, 0xf0, 0x80, 0x7f, 0xff, 0x48,
+    0x3, 0xff, 0xb8, 0x22, 0x0, 0xf1, 0x80, 0x7f,
+    0xf5, 0x64, 0x3, 0xd2, 0x1, 0xff, 0xd5, 0x74,
+    0x0, 0xce, 0xa0, 0x1f, 0xfd, 0x6b, 0xb4, 0x4e,
+    0xc0, 0x7, 0xff, 0x24,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x68, 0x99, 0x99, 0x86, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x72, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xd8, 0x41, 0x0, 0x24, 0x8d,
-    0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x7f, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xb1, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0x80, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x9, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0xef, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xf2, 0x6f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0x17, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xfe, 0x6, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xb0, 0x4f, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf7, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0x10, 0xb, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xb0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xfc,
-    0x61, 0x0, 0x0, 0x0, 0x3, 0x8e, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xff, 0xfd, 0xba,
-    0xaa, 0xcf, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x58, 0xbd, 0xef, 0xff, 0xed, 0xc9,
-    0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0xff, 0xe2, 0x9b, 0x44, 0xce, 0x86, 0x30,
+    0xf, 0xfe, 0x89, 0x46, 0x7e, 0x4b, 0xb3, 0x67,
+    0x9c, 0xfc, 0x72, 0x0, 0xff, 0xe5, 0xa6, 0x6b,
+    0x99, 0x3d, 0xf7, 0xfb, 0x6d, 0xc8, 0x0, 0x71,
+    0xb6, 0x60, 0x1f, 0xfc, 0x71, 0xbb, 0x18, 0xd,
+    0x6c, 0x20, 0x80, 0x9, 0x23, 0x64, 0x40, 0x24,
+    0xc9, 0x0, 0xff, 0xe2, 0xaf, 0x20, 0x0, 0xfd,
+    0x40, 0x3f, 0xcd, 0x82, 0x1, 0x9b, 0x4, 0x3,
+    0xff, 0x84, 0xd4, 0x1, 0x1e, 0x8, 0x7, 0xfe,
+    0x2c, 0x0, 0xe3, 0xc1, 0x0, 0xff, 0xcb, 0x20,
+    0x1b, 0x80, 0x3f, 0xf8, 0x65, 0x0, 0x1c, 0x54,
+    0x1, 0xff, 0x15, 0x0, 0x66, 0x20, 0xf, 0xfe,
+    0x23, 0x88, 0x7, 0x23, 0x0, 0x7f, 0xb8, 0x3,
+    0xa8, 0x3, 0xff, 0x8d, 0x20, 0x1e, 0xb0, 0xf,
+    0xe3, 0x30, 0x7, 0x18, 0x7, 0xff, 0x19, 0x40,
+    0x3c, 0x46, 0x1, 0xfa, 0x40, 0x38, 0x80, 0x3f,
+    0xf8, 0xe4, 0x20, 0x1e, 0x50, 0xf, 0xc8, 0x1,
+    0xc2, 0x1, 0xff, 0xc8, 0x50, 0xf, 0x70, 0x7,
+    0xc2, 0x20, 0xe, 0x10, 0xf, 0xfe, 0x40, 0x80,
+    0x78, 0x80, 0x3e, 0x20, 0xf, 0x18, 0x7, 0xff,
+    0x20, 0xc0, 0x3c, 0x60, 0x1f, 0x38, 0x7, 0x84,
+    0x40, 0x1f, 0xfc, 0xe1, 0x0, 0xf9, 0xc0, 0x3e,
+    0x50, 0xf, 0xfe, 0x39, 0x80, 0x7b, 0x40, 0x3e,
+    0x10, 0xf, 0xb8, 0x3, 0xff, 0x8e, 0x20, 0x1e,
+    0x70, 0xf, 0x88, 0x3, 0xe5, 0x10, 0xf, 0xfe,
+    0x32, 0x80, 0x71, 0x90, 0x7, 0xe4, 0x0, 0xfa,
+    0xc0, 0x3f, 0xf8, 0xa2, 0x20, 0xe, 0xa0, 0xf,
+    0xed, 0x0, 0xf9, 0x50, 0x3, 0xff, 0x88, 0x80,
+    0x1c, 0x4c, 0x1, 0xfc, 0xe0, 0x1f, 0xa8, 0x80,
+    0x3f, 0xf8, 0x7e, 0x1, 0xdc, 0x1, 0xfe, 0x17,
+    0x0, 0xf8, 0x7c, 0x40, 0x3f, 0xf8, 0x22, 0xa0,
+    0x1a, 0xc, 0x3, 0xfe, 0x81, 0x0, 0xf8, 0xb0,
+    0x40, 0x3f, 0xf4, 0x80, 0x66, 0x70, 0xf, 0xfe,
+    0xd, 0x0, 0x7e, 0x2c, 0x20, 0xf, 0xf0, 0xb8,
+    0x4, 0xf2, 0x1, 0xff, 0xc2, 0x48, 0x0, 0xfc,
+    0x5a, 0x80, 0x1f, 0xd4, 0x1, 0x44, 0x0, 0x3f,
+    0xf8, 0x8e, 0xa0, 0x1f, 0xd7, 0x20, 0x1f, 0x42,
+    0x0, 0x29, 0xc0, 0x3f, 0xf8, 0xd4, 0xa0, 0x1f,
+    0xcd, 0xa4, 0x1, 0x9d, 0xc0, 0x5a, 0xa0, 0x1f,
+    0xfc, 0x8a, 0x60, 0xf, 0xe2, 0xd7, 0x0, 0x44,
+    0x1, 0xb4, 0x80, 0x3f, 0xf9, 0x53, 0x0, 0x1f,
+    0xe8, 0xee, 0x38, 0xdc, 0x80, 0x7f, 0xf3, 0x5e,
+    0xc4, 0x3, 0xf8, 0x44, 0x1e, 0x80, 0x1f, 0xfc,
+    0xf4, 0xf3, 0x0, 0xff, 0xb0, 0xc0, 0x3f, 0xfa,
+    0x3, 0x8e, 0x1, 0xfe, 0x2c, 0x80, 0xf, 0xfe,
+    0x8c, 0x38, 0x7, 0xfc, 0xfa, 0x60, 0x1f, 0xfc,
+    0xe5, 0xd7, 0x0, 0xff, 0xc5, 0x8e, 0x1, 0xff,
+    0xcb, 0x3d, 0xa2, 0x4e, 0xfb, 0x10, 0xf, 0xf4,
+    0x60, 0x80, 0x7f, 0xf1, 0xc6, 0x70, 0x81, 0xec,
+    0x41, 0x3d, 0x0, 0x3f, 0xc7, 0xe8, 0x1, 0xff,
+    0xc5, 0x5f, 0x60, 0x5, 0x40, 0x6, 0x1b, 0x90,
+    0xf, 0xf0, 0xdb, 0x0, 0x7f, 0xf0, 0xe6, 0x84,
+    0x1, 0x4a, 0x1, 0xf3, 0x69, 0x0, 0x7f, 0xa6,
+    0x0, 0x3f, 0xf0, 0xe3, 0x0, 0x50, 0xa0, 0x1f,
+    0xc5, 0xaa, 0x1, 0xfe, 0x77, 0x0, 0x7f, 0x87,
+    0xc, 0x2, 0x47, 0x0, 0xff, 0xd5, 0x0, 0x1f,
+    0xe8, 0x50, 0xf, 0xed, 0x20, 0xd, 0x20, 0x1f,
+    0xfc, 0x27, 0xa0, 0xf, 0xf5, 0x10, 0x7, 0xd6,
+    0x60, 0x19, 0xc8, 0x3, 0xff, 0x86, 0xb6, 0x1,
+    0xfe, 0xf0, 0xf, 0x3a, 0x0, 0x74, 0x80, 0x7f,
+    0xf1, 0x52, 0xc0, 0x3f, 0x89, 0x80, 0x31, 0x40,
+    0x7, 0x28, 0x80, 0x7f, 0xf1, 0x92, 0x80, 0x3f,
+    0xa0, 0x3, 0x48, 0x7, 0xbc, 0x3, 0xff, 0x90,
+    0xac, 0x1, 0xf8, 0x50, 0x0, 0x68, 0x1, 0xe5,
+    0x0, 0xff, 0xe4, 0xc9, 0x0, 0x7e, 0xd0, 0x5,
+    0x0, 0x78, 0x80, 0x3f, 0xf9, 0x72, 0x1, 0xf9,
+    0x0, 0xe, 0x1, 0xe7, 0x0, 0xff, 0xe5, 0xa2,
+    0x0, 0x3e, 0x20, 0x21, 0x0, 0xf1, 0x0, 0x7f,
+    0xf3, 0x38, 0x3, 0xf0, 0xb8, 0x7, 0xde, 0x1,
+    0xff, 0xcc, 0x50, 0xf, 0xc6, 0x60, 0xf, 0x84,
+    0x3, 0xff, 0x9a, 0x60, 0x1f, 0x18, 0x80, 0x7c,
+    0x20, 0x1f, 0xfc, 0xd6, 0x0, 0xf8, 0x40, 0x3f,
+    0x78, 0x7, 0xff, 0x34, 0x80, 0x3c, 0x20, 0x20,
+    0x1f, 0x10, 0x7, 0xff, 0x51, 0x40, 0x80, 0x3e,
+    0x70, 0xf, 0xfe, 0xa6, 0x2, 0x0, 0x7c, 0x40,
+    0x1f, 0xfc, 0xd2, 0x0, 0xf3, 0x0, 0x10, 0x3,
+    0xe4, 0x0, 0xff, 0xe6, 0x38, 0x7, 0x20, 0x80,
+    0x3c, 0x3, 0xee, 0x0, 0xff, 0xe5, 0x91, 0x0,
+    0x3a, 0x40, 0x24, 0x20, 0xf, 0x28, 0x80, 0x7f,
+    0xf2, 0xa8, 0x3, 0x9c, 0x80, 0x37, 0x80, 0x7d,
+    0x0, 0x1f, 0xfc, 0x92, 0x70, 0xc, 0x70, 0x1,
+    0xc5, 0x20, 0x1e, 0x63, 0x0, 0xff, 0xe4, 0x70,
+    0x6, 0x2d, 0x0, 0xf9, 0xa4, 0x3, 0xda, 0x20,
+    0x1f, 0xfc, 0x6a, 0x30, 0x8, 0xf0, 0x40, 0x3f,
+    0x35, 0x88, 0x6, 0x1c, 0x20, 0xf, 0xfe, 0x18,
+    0xda, 0x80, 0x4b, 0x82, 0x1, 0xfe, 0x4c, 0x40,
+    0xc, 0x58, 0xa0, 0x1f, 0xfc, 0x16, 0xf4, 0x0,
+    0xd, 0x50, 0x3, 0xff, 0x82, 0x57, 0x64, 0x0,
+    0x86, 0xb1, 0x84, 0x3, 0xe3, 0x8e, 0x91, 0x1,
+    0x8e, 0x50, 0xf, 0xfe, 0x22, 0x5e, 0xb9, 0x0,
+    0xe, 0x7b, 0x6e, 0xaa, 0xcf, 0xc7, 0x10, 0x5b,
+    0xe7, 0x0, 0xff, 0xe4, 0x14, 0x6e, 0xa9, 0xd0,
+    0x8d, 0x15, 0x48, 0x26, 0xd1, 0x9f, 0x48, 0x1,
+    0xff, 0x80,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x69, 0xbb, 0xcc, 0xb9, 0x73, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d,
-    0xff, 0xff, 0xd6, 0x20, 0x1, 0x5b, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x10, 0x9f,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x9f, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0xaf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x90, 0xaf, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x9f, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x9f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x5f, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x2f,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xe, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0xa, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xef, 0xff, 0xff, 0xff, 0xf2, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xaf, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x8f, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf4,
-    0x8f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x9f, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x50, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xe1, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x30,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6e,
-    0xff, 0xff, 0xfb, 0x40, 0x0, 0x2, 0x7d, 0xfc,
-    0x20, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xff, 0xff,
-    0xff, 0xdd, 0xff, 0xfd, 0x50, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x37, 0xbd, 0xef, 0xfe, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x97, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf8, 0x30, 0x0,
-    0x0, 0x0, 0x16, 0xdf, 0xff, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xca, 0x98, 0x9c, 0xff,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x8a, 0xde, 0xff, 0xfd, 0xb8, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x9b, 0x4d, 0xdb, 0x31, 0x72,
+    0xe6, 0x1, 0xff, 0xd0, 0x4a, 0xec, 0x96, 0x44,
+    0x19, 0x91, 0xa3, 0x3e, 0x8c, 0x3, 0xff, 0x96,
+    0xbb, 0x6a, 0x20, 0x53, 0xbf, 0xee, 0xa4, 0x0,
+    0x97, 0x30, 0x60, 0x1f, 0xfc, 0x72, 0xca, 0x20,
+    0x0, 0xd6, 0xb1, 0x0, 0x5, 0x6f, 0x8, 0x2,
+    0x3c, 0x80, 0xf, 0xfe, 0x2a, 0xe9, 0x80, 0x45,
+    0xea, 0x1, 0xf8, 0xf5, 0x0, 0x33, 0xd8, 0x7,
+    0xff, 0xe, 0x28, 0x3, 0xe, 0x8, 0x7, 0xfd,
+    0x64, 0x1, 0x93, 0x0, 0x3f, 0xf8, 0x2e, 0xe0,
+    0xe, 0xb1, 0x0, 0xff, 0xe0, 0xf8, 0x7, 0x1d,
+    0x80, 0x7f, 0xcb, 0x0, 0x1c, 0x8a, 0x1, 0xff,
+    0xc2, 0x27, 0x0, 0xe4, 0x80, 0xf, 0xe1, 0xb0,
+    0xf, 0x40, 0x7, 0xff, 0x12, 0x40, 0x3c, 0xe6,
+    0x1, 0xfa, 0x84, 0x3, 0x88, 0xc0, 0x3f, 0xf8,
+    0x82, 0xc0, 0x1e, 0xf0, 0xf, 0x8d, 0x0, 0x3d,
+    0x40, 0x1f, 0xfc, 0x6a, 0x0, 0xf1, 0xa8, 0x7,
+    0xa0, 0x3, 0xe5, 0x0, 0xff, 0xe3, 0x19, 0x0,
+    0x7a, 0x0, 0x38, 0x90, 0x3, 0xc2, 0x40, 0x1f,
+    0xfc, 0x74, 0x0, 0xf1, 0x20, 0x6, 0x50, 0xf,
+    0x94, 0x3, 0xff, 0x91, 0xa0, 0x1f, 0x70, 0x6,
+    0xb0, 0xf, 0x8c, 0x3, 0xff, 0x90, 0xa0, 0x1f,
+    0x28, 0x6, 0x30, 0xf, 0xb8, 0x3, 0xff, 0x90,
+    0x24, 0x1, 0xf2, 0x80, 0xc, 0x3, 0xf1, 0x0,
+    0x7f, 0xf2, 0x5c, 0x3, 0xec, 0x0, 0x30, 0x7,
+    0xe7, 0x0, 0xff, 0xe4, 0xe8, 0x7, 0xc8, 0x0,
+    0xd0, 0xf, 0xc2, 0x1, 0xff, 0xc9, 0x20, 0xf,
+    0x88, 0x40, 0x40, 0x3f, 0x18, 0x7, 0xff, 0x25,
+    0x80, 0x3f, 0x28, 0x7, 0xff, 0x50, 0x80, 0x3f,
+    0x18, 0x18, 0x7, 0xe1, 0x0, 0xff, 0xe4, 0x88,
+    0x7, 0xee, 0x0, 0xff, 0xee, 0x90, 0x18, 0x7,
+    0xe1, 0x0, 0xff, 0xe9, 0x30, 0x7, 0xff, 0x74,
+    0xc3, 0x80, 0x3f, 0x18, 0x7, 0xff, 0x24, 0x40,
+    0x3f, 0x8, 0x10, 0x7, 0xe6, 0x0, 0xff, 0xe4,
+    0xa8, 0x7, 0xf0, 0xb8, 0x7, 0xe1, 0x0, 0xff,
+    0xe4, 0xe0, 0x7, 0xf8, 0x84, 0x3, 0xe2, 0x0,
+    0xff, 0xe4, 0xa8, 0x7, 0xf1, 0x82, 0x0, 0x7d,
+    0xa0, 0x1f, 0xfc, 0x81, 0x21, 0x0, 0xff, 0x78,
+    0x7, 0xce, 0x1, 0xff, 0xc8, 0x60, 0x40, 0xf,
+    0xf2, 0x88, 0x7, 0x88, 0x40, 0x3f, 0xf8, 0xf2,
+    0x84, 0x1, 0xff, 0x30, 0x7, 0xc8, 0x1, 0xff,
+    0xc6, 0x61, 0xf0, 0xf, 0xe3, 0x0, 0x48, 0x80,
+    0x7b, 0x80, 0x3f, 0xf8, 0xd6, 0x48, 0x20, 0x1f,
+    0xf0, 0xc0, 0x7, 0x90, 0x80, 0x3f, 0xf8, 0x90,
+    0x50, 0x1, 0xfe, 0x10, 0x9, 0x94, 0x3, 0xd0,
+    0x1, 0xff, 0xc3, 0x37, 0x45, 0x0, 0xff, 0xe1,
+    0xd1, 0x0, 0x72, 0xa8, 0x3, 0xff, 0x82, 0x5a,
+    0x34, 0x0, 0x30, 0xf, 0x84, 0x3, 0xd8, 0x60,
+    0x1d, 0x46, 0x1, 0xff, 0x1e, 0xe, 0x88, 0x7,
+    0xf8, 0x80, 0x3c, 0x38, 0x80, 0x1d, 0x8a, 0x1,
+    0xfc, 0xf8, 0x38, 0x60, 0x10, 0x80, 0x7c, 0xc0,
+    0x1f, 0xae, 0x44, 0x3, 0x55, 0xa0, 0x6, 0x27,
+    0xd8, 0x3d, 0x30, 0xc, 0xe0, 0x1f, 0x18, 0x7,
+    0xf3, 0x74, 0x10, 0x4, 0x97, 0xfb, 0xaf, 0xd8,
+    0xa, 0xc2, 0x0, 0xe1, 0x0, 0xfb, 0x80, 0x3f,
+    0xe7, 0xdc, 0x84, 0x21, 0x2, 0x34, 0x7c, 0xd5,
+    0x0, 0xf8, 0xc0, 0x3e, 0x30, 0xf, 0xfe, 0x9,
+    0xbd, 0xef, 0x7f, 0xba, 0xe0, 0xc0, 0x3f, 0x84,
+    0x3, 0xe5, 0x0, 0xff, 0xea, 0x8, 0x7, 0xc2,
+    0x20, 0xf, 0xfe, 0xa1, 0x0, 0x7c, 0x80, 0x1f,
+    0xfd, 0x56, 0x0, 0xfb, 0x40, 0x3f, 0xfa, 0xba,
+    0x1, 0xf2, 0x80, 0x7f, 0xf5, 0x48, 0x3, 0xc4,
+    0x40, 0xf, 0xfe, 0xab, 0x80, 0x79, 0x40, 0x3f,
+    0xfa, 0xc4, 0x1, 0xeb, 0x0, 0xff, 0xea, 0xa0,
+    0x7, 0x88, 0xc0, 0x3f, 0xfa, 0xb8, 0x1, 0xeb,
+    0x0, 0xff, 0xeb, 0x20, 0x7, 0xb, 0x0, 0x7f,
+    0x8e, 0x25, 0xc8, 0x3, 0xff, 0x8c, 0x26, 0x1,
+    0xcc, 0x1, 0xfe, 0xbc, 0x76, 0x8d, 0x70, 0xf,
+    0xfe, 0x2b, 0x80, 0x70, 0xc8, 0x7, 0xf5, 0xa0,
+    0x7, 0x43, 0x0, 0x7f, 0xf1, 0x28, 0x3, 0xa0,
+    0x40, 0x3f, 0x22, 0x0, 0x3e, 0x80, 0xf, 0xfe,
+    0x19, 0x18, 0x6, 0x26, 0x0, 0xfe, 0xc0, 0xf,
+    0xc2, 0x40, 0x1f, 0xfc, 0x28, 0x0, 0xee, 0x0,
+    0xff, 0x8, 0x7, 0xf1, 0x80, 0x7f, 0xf0, 0x49,
+    0x40, 0x34, 0x18, 0x7, 0xfb, 0x80, 0x3f, 0x8,
+    0x80, 0x3f, 0xf8, 0x32, 0x1, 0x95, 0xc0, 0x3f,
+    0xe5, 0x0, 0xfd, 0x20, 0x1f, 0xfc, 0x16, 0x40,
+    0x9, 0x28, 0x3, 0xff, 0x12, 0x80, 0x78, 0xdc,
+    0x3, 0xff, 0x1c, 0x80, 0x49, 0x60, 0x1f, 0xfc,
+    0x2a, 0x30, 0xc, 0xd8, 0x1, 0xff, 0x8f, 0x0,
+    0x25, 0xb0, 0xf, 0xfe, 0x26, 0x28, 0x0, 0xa0,
+    0x3, 0xff, 0x3e, 0x0, 0x53, 0x40, 0x1f, 0xfc,
+    0x6a, 0x90, 0x2e, 0x83, 0x0, 0xf8, 0x5b, 0x60,
+    0x0, 0xba, 0xc0, 0x1f, 0xfc, 0x86, 0xe7, 0x17,
+    0xcf, 0xca, 0x98, 0x9c, 0xe9, 0x20, 0x6c, 0xa2,
+    0x0, 0xff, 0xe5, 0xc, 0x76, 0x3a, 0x8a, 0x33,
+    0xb0, 0xa3, 0xdf, 0xc9, 0x80, 0x7f, 0xf1, 0x0,
 
     /* U+003A ":" */
-    0x0, 0x6, 0xcf, 0xfc, 0x50, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xfb, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x6f, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x1, 0x69, 0x96, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x69, 0x85, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xe5, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x1, 0xcf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x6, 0xcf, 0xfc, 0x60, 0x0,
+    0x0, 0x9b, 0x3f, 0xd8, 0xa0, 0x18, 0x72, 0x4c,
+    0x0, 0x75, 0x60, 0x15, 0x18, 0x7, 0x92, 0x81,
+    0x10, 0x1, 0xf9, 0x4f, 0x80, 0x3f, 0xd4, 0xc0,
+    0x1f, 0xe2, 0x70, 0xf, 0xf0, 0x98, 0x7, 0xfb,
+    0x68, 0x3, 0xfc, 0xc5, 0x20, 0x1f, 0xa8, 0x41,
+    0xa4, 0x3, 0x86, 0x94, 0x2, 0x6e, 0x96, 0x64,
+    0xf2, 0x80, 0x70, 0xb4, 0xc9, 0x80, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xe8, 0x5a, 0x61, 0x40, 0x3c, 0xbd, 0x2c,
+    0xf5, 0xca, 0x1, 0x35, 0x0, 0x70, 0xd2, 0x81,
+    0x48, 0x7, 0xea, 0x1a, 0x0, 0xff, 0x31, 0x80,
+    0x7f, 0xb5, 0xc0, 0x3f, 0xc2, 0xc0, 0x1f, 0xe2,
+    0xe0, 0xf, 0xf5, 0x22, 0x0, 0x3f, 0x29, 0x85,
+    0x18, 0x7, 0x92, 0x80, 0x3, 0x92, 0x60, 0x3,
+    0x9b, 0x0,
 
     /* U+00B0 "°" */
-    0x0, 0x0, 0x0, 0x17, 0xbd, 0xff, 0xdb, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff, 0xfb,
-    0x99, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xd5, 0x0, 0x0, 0x0, 0x6e, 0xfd, 0x30,
-    0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xf3, 0x0, 0x1, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x10, 0xa,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x90, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0x7f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
-    0xbf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xfa, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfc, 0xef, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0xef, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfd, 0xdf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0xbf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfa, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x90, 0x1, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0x3f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe2,
-    0x0, 0x0, 0x3, 0xdf, 0xc5, 0x0, 0x0, 0x0,
-    0x5d, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xeb, 0x99, 0xbf, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xbe, 0xff, 0xdb, 0x61, 0x0,
-    0x0, 0x0
+    0x0, 0xf0, 0xbd, 0xef, 0xfb, 0x6d, 0x84, 0x3,
+    0xfc, 0x33, 0xd0, 0x8c, 0xd9, 0x27, 0xa0, 0x3,
+    0xf1, 0xfb, 0x15, 0x7d, 0xcc, 0xaf, 0xe4, 0x5f,
+    0x4c, 0x3, 0x8f, 0x5, 0x75, 0x40, 0x3c, 0xde,
+    0x85, 0x86, 0x1, 0xe, 0x83, 0x50, 0x7, 0xf0,
+    0xda, 0x6, 0x88, 0x2, 0xc4, 0xa4, 0x3, 0xff,
+    0x58, 0x8a, 0x0, 0x94, 0x24, 0x3, 0xff, 0x85,
+    0x60, 0xc2, 0xa0, 0x48, 0x1, 0xff, 0xc2, 0x51,
+    0x7, 0xc0, 0x40, 0xf, 0xfe, 0x23, 0x86, 0x30,
+    0x78, 0x7, 0xff, 0x13, 0x81, 0x8c, 0xc, 0x3,
+    0xff, 0x88, 0x40, 0x40, 0x1f, 0xfc, 0x93, 0x30,
+    0x18, 0x7, 0xff, 0x10, 0xc0, 0x58, 0x38, 0x3,
+    0xff, 0x89, 0xe0, 0xda, 0x8, 0x1, 0xff, 0xc4,
+    0x40, 0xc4, 0x3, 0x20, 0xf, 0xfe, 0x11, 0x90,
+    0x39, 0x30, 0x48, 0x7, 0xff, 0xb, 0xc1, 0x84,
+    0x20, 0x51, 0xc0, 0x3f, 0xf4, 0x98, 0xc0, 0x0,
+    0x74, 0x21, 0xc0, 0x3f, 0xd2, 0xc3, 0x82, 0x1,
+    0x1e, 0x14, 0x62, 0x80, 0x79, 0x75, 0x8b, 0x8,
+    0x3, 0x8f, 0x58, 0xeb, 0xae, 0x65, 0x7f, 0x44,
+    0xfa, 0x40, 0x1f, 0xa7, 0xa5, 0x54, 0xcd, 0x24,
+    0xf4, 0x0, 0x70
 };
 
 
@@ -1802,17 +760,17 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 874, .box_w = 45, .box_h = 67, .ofs_x = 5, .ofs_y = -1},
-    {.bitmap_index = 1508, .adv_w = 514, .box_w = 26, .box_h = 66, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 2366, .adv_w = 717, .box_w = 38, .box_h = 65, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3601, .adv_w = 770, .box_w = 41, .box_h = 67, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 4975, .adv_w = 776, .box_w = 45, .box_h = 67, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6483, .adv_w = 729, .box_w = 38, .box_h = 70, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 7813, .adv_w = 805, .box_w = 41, .box_h = 67, .ofs_x = 5, .ofs_y = -1},
-    {.bitmap_index = 9187, .adv_w = 684, .box_w = 41, .box_h = 66, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 10540, .adv_w = 809, .box_w = 43, .box_h = 67, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 11981, .adv_w = 805, .box_w = 42, .box_h = 67, .ofs_x = 4, .ofs_y = -1},
-    {.bitmap_index = 13388, .adv_w = 383, .box_w = 12, .box_h = 49, .ofs_x = 6, .ofs_y = -1},
-    {.bitmap_index = 13682, .adv_w = 480, .box_w = 22, .box_h = 22, .ofs_x = 4, .ofs_y = 53}
+    {.bitmap_index = 669, .adv_w = 514, .box_w = 26, .box_h = 66, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 851, .adv_w = 717, .box_w = 38, .box_h = 65, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 1360, .adv_w = 770, .box_w = 41, .box_h = 67, .ofs_x = 3, .ofs_y = -1},
+    {.bitmap_index = 1985, .adv_w = 776, .box_w = 45, .box_h = 67, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2320, .adv_w = 729, .box_w = 38, .box_h = 70, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 2797, .adv_w = 805, .box_w = 41, .box_h = 67, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 3492, .adv_w = 684, .box_w = 41, .box_h = 66, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 3872, .adv_w = 809, .box_w = 43, .box_h = 67, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 4618, .adv_w = 805, .box_w = 42, .box_h = 67, .ofs_x = 4, .ofs_y = -1},
+    {.bitmap_index = 5314, .adv_w = 383, .box_w = 12, .box_h = 49, .ofs_x = 6, .ofs_y = -1},
+    {.bitmap_index = 5428, .adv_w = 480, .box_w = 22, .box_h = 22, .ofs_x = 4, .ofs_y = 53}
 };
 
 /*---------------------
@@ -1858,7 +816,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 2,
     .bpp = 4,
     .kern_classes = 0,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1877,7 +835,7 @@ const lv_font_t lv_font_playfair_90 = {
 lv_font_t lv_font_playfair_90 = {
 #endif
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .get_glyph_bitmap = font_glyph_cache_get_bitmap,    /*Function pointer to get glyph's bitmap*/
     .line_height = 77,          /*The maximum line height required by the font*/
     .base_line = 2,             /*Baseline measured from the bottom of the line*/
 #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
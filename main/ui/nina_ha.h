@@ -5,7 +5,7 @@
  * @brief Home Assistant page — thin adapter over the shared nina_tile_grid renderer.
  *
  * Mirrors nina_json.h 1:1. The page is created once (hidden), fed by the shared
- * ha_data_t (populated by ha_poll_task via ha_client_poll), and re-themed /
+ * ha_data_t (populated by the ha poll job via ha_client_poll), and re-themed /
  * rebuilt on config change. All functions run with the LVGL display lock held
  * by the CALLER (matches nina_json.c); this module never takes the lock itself.
  */
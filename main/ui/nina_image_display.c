@@ -15,6 +15,8 @@
 #include "nina_wait_overlay.h"
 #include "nina_dashboard_internal.h"
 #include "image_red_remap.h"   /* image_red_remap_rgb565 — self-gates on red-night */
+#include "image_transform.h"
+#include "jpeg_utils.h"         /* ppa_rotate180_rgb565_into */
 #include "moon_interaction.h"
 #include "app_config.h"
 #include "display_defs.h"
@@ -104,15 +106,16 @@ static void init_image_dsc(lv_image_dsc_t *dsc)
     dsc->header.cf    = LV_COLOR_FORMAT_RGB565;
 }
 
-/* Release a slot's descriptor: free the backing buffer ONLY if this module owns
- * it (not borrowed), then clear the descriptor and the borrowed flag. `is_a`
+/* Release a slot's descriptor: return the backing frame slot to g_image_frames
+ * ONLY if this module owns it (not borrowed), then clear the descriptor and the
+ * borrowed flag. `is_a`
  * selects which slot's borrowed flag to clear. Borrowed buffers belong to the
  * moon-drag scratch in tasks.c and are freed there on page leave. */
 static void release_dsc(lv_image_dsc_t *dsc, bool is_a)
 {
     bool *borrowed = is_a ? &dsc_a_borrowed : &dsc_b_borrowed;
     if (dsc->data && !*borrowed) {
-        heap_caps_free((void *)dsc->data);
+        frame_pool_release(&g_image_frames, (void *)dsc->data);
     }
     dsc->data       = NULL;
     dsc->data_size  = 0;
@@ -536,24 +539,6 @@ void nina_image_display_update(goes_data_t *data)
         oy = (uint16_t)((sh - h) / 2);
     }
 
-    size_t   buf_size = (size_t)w * h * 2;
-    uint8_t *copy = heap_caps_malloc(buf_size, MALLOC_CAP_SPIRAM);
-    if (!copy) {
-        ESP_LOGE(TAG, "PSRAM alloc failed for crossfade buffer (%u bytes)",
-                 (unsigned)buf_size);
-        goes_data_unlock(data);
-        /* New-image gate passed but the display copy failed — release any
-         * manual-fetch wait overlay so it can't get stuck. */
-        nina_wait_overlay_hide();
-        return;
-    }
-    /* Copy the (optionally cropped) source row-by-row. The software JPEG decoder
-     * path sets vflip=true (its buffer is top<->bottom relative to the hardware
-     * decode path); reverse the source row index in that case so the logical
-     * buffer is upright. ox/oy apply the center-crop. */
-    size_t src_stride = (size_t)sw * 2;
-    size_t dst_stride = (size_t)w * 2;
-
     /* Optional caption mask (Solar bands only). The mask rect is in upright-full
      * image fractional coords; convert to a pixel rect [mx0..mx1, my0..my1]. For
      * masked pixels we composite a color-sampled blend: per row, sample one
@@ -579,48 +564,10 @@ void nina_image_display_update(goes_data_t *data)
         }
     }
 
-    for (uint32_t y = 0; y < h; y++) {
-        uint32_t src_y = data->vflip ? (uint32_t)(sh - 1 - (oy + y)) : (uint32_t)(oy + y);
-        memcpy((uint8_t *)copy + (size_t)y * dst_stride,
-               data->image_buf + (size_t)src_y * src_stride + (size_t)ox * 2,
-               dst_stride);
-
-        if (!mask_on) continue;
-
-        /* Upright-full row for this dst row. Mask rect is in upright coords. */
-        int uY = (int)oy + (int)y;
-        if (uY < my0 || uY >= my1) continue;  /* row outside the mask band */
-
-        /* Sample the per-row replacement color ONCE (right of the mask, same
-         * upright row, same vflip mapping the copy uses). */
-        const uint8_t *src_px = data->image_buf
-                                + (size_t)src_y * src_stride
-                                + (size_t)sample_col * 2;
-        uint8_t lo = src_px[0], hi = src_px[1];
-
-        /* Overwrite the masked columns in this dst row. dst col x maps to
-         * upright col (ox + x); paint where ox+x is within [mx0, mx1). */
-        for (uint32_t x = 0; x < w; x++) {
-            int uX = (int)ox + (int)x;
-            if (uX < mx0 || uX >= mx1) continue;
-            uint8_t *dst_px = (uint8_t *)copy + (size_t)y * dst_stride + (size_t)x * 2;
-            dst_px[0] = lo;
-            dst_px[1] = hi;
-        }
-    }
-    int64_t poll_ms = data->last_poll_ms;
-    /* Capture the label this buffer was fetched for UNDER the same lock so the
-     * on-screen text is coupled to image_buf and cannot desync if a config
-     * change lands between fetches (issue #166). */
-    char label_copy[48];
-    strlcpy(label_copy, data->label, sizeof(label_copy));
-    goes_data_unlock(data);
-
-    /* Per-source logical mirror pass. Runs on the upright `copy` (after vflip +
-     * caption mask) and BEFORE the rotation block, so flips compose naturally
-     * with rotation. vflip reverses row order (top<->bottom); hflip reverses the
-     * pixel order within each row (left<->right). Moon (source 1) is excluded —
-     * it has its own moon_flip_u/v handling elsewhere. Dimensions are unchanged. */
+    /* Per-source logical mirror. vflip reverses row order (top<->bottom); hflip
+     * reverses the pixel order within each row (left<->right). Moon (source 1) is
+     * excluded — it has its own moon_flip_u/v handling elsewhere. Flips compose
+     * before the rotation below. */
     uint8_t do_vflip = (buf_src == 0)   ? cfg->goes_vflip
                        : (buf_src == 2) ? cfg->solar_vflip
                        : (buf_src == 3) ? cfg->custom_vflip
@@ -629,100 +576,77 @@ void nina_image_display_update(goes_data_t *data)
                        : (buf_src == 2) ? cfg->solar_hflip
                        : (buf_src == 3) ? cfg->custom_hflip
                                         : 0;
-    if (do_vflip) {
-        /* Swap row y with row (h-1-y) using one PSRAM temp row of dst_stride. */
-        uint8_t *tmp_row = heap_caps_malloc(dst_stride, MALLOC_CAP_SPIRAM);
-        if (!tmp_row) {
-            ESP_LOGE(TAG, "PSRAM alloc failed for vflip temp row (%u bytes)",
-                     (unsigned)dst_stride);
-            heap_caps_free(copy);
-            /* goes lock already released above; just retire the wait overlay. */
-            nina_wait_overlay_hide();
-            return;
-        }
-        for (uint32_t y = 0; y < h / 2; y++) {
-            uint8_t *row_a = (uint8_t *)copy + (size_t)y * dst_stride;
-            uint8_t *row_b = (uint8_t *)copy + (size_t)(h - 1 - y) * dst_stride;
-            memcpy(tmp_row, row_a, dst_stride);
-            memcpy(row_a, row_b, dst_stride);
-            memcpy(row_b, tmp_row, dst_stride);
-        }
-        heap_caps_free(tmp_row);
-    }
-    if (do_hflip) {
-        /* Reverse the w pixels in each row: swap col x with (w-1-x). */
-        for (uint32_t y = 0; y < h; y++) {
-            uint16_t *row = (uint16_t *)((uint8_t *)copy + (size_t)y * dst_stride);
-            for (uint32_t x = 0; x < (uint32_t)w / 2; x++) {
-                uint16_t t          = row[x];
-                row[x]              = row[w - 1 - x];
-                row[w - 1 - x]      = t;
-            }
-        }
-    }
 
-    /* Per-source logical rotation pass. Rotates the decoded RGB565 pixel buffer
-     * (NOT via an LVGL transform) so it is independent of display rotation and
-     * runs on the upright `copy` produced above (after vflip + caption mask).
-     * orient: 0/1/2/3 = 0/90/180/270 degrees CLOCKWISE. Moon (source 1) never
-     * rotates. 90/270 swap width<->height. */
+    /* Per-source logical rotation of the decoded pixels (NOT via an LVGL
+     * transform) so it is independent of display rotation. orient: 0/1/2/3 =
+     * 0/90/180/270 degrees CLOCKWISE. Moon (source 1) never rotates. 90/270
+     * swap width<->height. */
     uint8_t orient = (buf_src == 0)   ? cfg->goes_orientation
                      : (buf_src == 2) ? cfg->solar_orientation
                      : (buf_src == 3) ? cfg->custom_orientation
                                       : 0;
-    if (orient != 0) {
-        uint16_t rw, rh;
-        if (orient == 2) {            /* 180deg: same dims */
-            rw = w;  rh = h;
-        } else {                       /* 90/270: dims swap */
-            rw = h;  rh = w;
-        }
-        size_t   rot_size = (size_t)rw * rh * 2;
-        uint8_t *rot = heap_caps_malloc(rot_size, MALLOC_CAP_SPIRAM);
-        if (!rot) {
-            ESP_LOGE(TAG, "PSRAM alloc failed for rotation buffer (%u bytes)",
-                     (unsigned)rot_size);
-            heap_caps_free(copy);
-            /* goes lock already released above; just retire the wait overlay. */
-            nina_wait_overlay_hide();
-            return;
-        }
-        const uint16_t *src = (const uint16_t *)copy;
-        uint16_t       *dst = (uint16_t *)rot;
-        if (orient == 2) {
-            /* rot[x,y] = copy[w-1-x, h-1-y] */
-            for (uint32_t Y = 0; Y < rh; Y++) {
-                for (uint32_t X = 0; X < rw; X++) {
-                    uint32_t sx = (uint32_t)w - 1 - X;
-                    uint32_t sy = (uint32_t)h - 1 - Y;
-                    dst[(size_t)Y * rw + X] = src[(size_t)sy * w + sx];
-                }
-            }
-        } else if (orient == 1) {
-            /* 90deg CW: rot[X,Y] = copy[Y, h-1-X], dims rw=h, rh=w */
-            for (uint32_t Y = 0; Y < rh; Y++) {           /* Y in [0,w) */
-                for (uint32_t X = 0; X < rw; X++) {       /* X in [0,h) */
-                    uint32_t sx = Y;
-                    uint32_t sy = (uint32_t)h - 1 - X;
-                    dst[(size_t)Y * rw + X] = src[(size_t)sy * w + sx];
-                }
-            }
-        } else {  /* orient == 3 */
-            /* 270deg CW: rot[X,Y] = copy[w-1-Y, X], dims rw=h, rh=w */
-            for (uint32_t Y = 0; Y < rh; Y++) {           /* Y in [0,w) */
-                for (uint32_t X = 0; X < rw; X++) {       /* X in [0,h) */
-                    uint32_t sx = (uint32_t)w - 1 - Y;
-                    uint32_t sy = X;
-                    dst[(size_t)Y * rw + X] = src[(size_t)sy * w + sx];
-                }
-            }
-        }
-        heap_caps_free(copy);
-        copy     = rot;
-        w        = rw;
-        h        = rh;
-        buf_size = rot_size;
+
+    /* Crop, caption mask, the source vflip (the software JPEG decoder path sets
+     * vflip=true: its buffer is top<->bottom relative to the hardware decode
+     * path), the logical flips and the rotation compose into one index map, so
+     * every displayed pixel is read once from image_buf and written once. */
+    image_transform_t xf = {
+        .src = (const uint16_t *)data->image_buf,
+        .src_w = sw, .src_h = sh,
+        .src_vflip = data->vflip,
+        .crop_x = ox, .crop_y = oy, .crop_w = w, .crop_h = h,
+        .mask_on = mask_on,
+        .mask_x0 = mx0, .mask_x1 = mx1, .mask_y0 = my0, .mask_y1 = my1,
+        .mask_sample_x = sample_col,
+        .vflip = do_vflip, .hflip = do_hflip,
+        .orient = orient,
+    };
+    image_transform_plan_t plan;
+    if (!image_transform_plan(&xf, &plan)) {
+        ESP_LOGE(TAG, "Bad image transform (%ux%u crop %ux%u+%u+%u, orient %u)",
+                 sw, sh, w, h, ox, oy, orient);
+        goes_data_unlock(data);
+        nina_wait_overlay_hide();
+        return;
     }
+    w = plan.dst_w;
+    h = plan.dst_h;
+
+    /* A DISPLAY frame slot (128-byte aligned address and size, so the PPA can
+     * write it too). The retired front/back copies go back to the pool, so a
+     * running slideshow reuses the same two slots instead of allocating. */
+    size_t   buf_size = (size_t)w * h * 2;
+    size_t   alloc_size = (buf_size + 127) & ~(size_t)127;
+    uint8_t *copy = frame_pool_acquire(&g_image_frames, alloc_size, FRAME_OWNER_DISPLAY);
+    if (!copy) {
+        ESP_LOGE(TAG, "PSRAM alloc failed for crossfade buffer (%u bytes)",
+                 (unsigned)alloc_size);
+        goes_data_unlock(data);
+        /* New-image gate passed but the display copy failed — release any
+         * manual-fetch wait overlay so it can't get stuck. */
+        nina_wait_overlay_hide();
+        return;
+    }
+
+    /* A plain 180 degree turn goes to the PPA (decoded frames are cache-synced
+     * to PSRAM; moon frames are CPU-rendered, so they stay on the CPU path). */
+    bool done = false;
+    if (plan.kind == IMAGE_TRANSFORM_ROT180 && buf_src != 1) {
+        done = ppa_rotate180_rgb565_into(data->image_buf, sw, sh,
+                                         plan.block_x, plan.block_y, w, h,
+                                         copy, alloc_size) != NULL;
+    }
+    if (!done) {
+        image_transform_apply(&plan, (uint16_t *)copy);
+    }
+
+    int64_t poll_ms = data->last_poll_ms;
+    /* Capture the label this buffer was fetched for UNDER the same lock so the
+     * on-screen text is coupled to image_buf and cannot desync if a config
+     * change lands between fetches (issue #166). */
+    char label_copy[48];
+    strlcpy(label_copy, data->label, sizeof(label_copy));
+    goes_data_unlock(data);
 
     /* Red Night: recolour the decoded image to red shades (luma->red, in place).
      * Self-gates inside the helper (no-op for every non-red theme), so call it
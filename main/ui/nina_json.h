@@ -5,7 +5,7 @@
  * @brief JSON Display page — row-based tile grid driven by any JSON API.
  *
  * Mirrors the AllSky page contract: the page is created once (hidden), fed by
- * the shared json_data_t (populated by json_poll_task via json_client_poll),
+ * the shared json_data_t (populated by the json poll job via json_client_poll),
  * and re-themed / rebuilt on config change. All functions run with the LVGL
  * display lock held by the CALLER (matches nina_allsky.c); this module never
  * takes the display lock itself.
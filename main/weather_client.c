@@ -3,8 +3,13 @@
  * @brief Provider-abstracted HTTP weather client.
  *
  * Polls weather data from one of three providers (OWM, Open-Meteo,
- * Weather Underground) on a dedicated FreeRTOS task pinned to Core 0.
+ * Weather Underground) as a job on the shared poll scheduler (poll_task.h).
  * Data is mutex-protected and copied out via weather_client_get_data().
+ *
+ * Provider GETs are conditional: bodies are retained by s_validators and
+ * replayed on a 304, so a provider result spread over several responses can
+ * always be re-assembled, and a poll where nothing changed only refreshes
+ * last_update_ts instead of republishing and redrawing the clock page.
  */
 
 #include "weather_client.h"
@@ -33,19 +38,29 @@ static const char *TAG = "weather";
 
 #define WEATHER_RESPONSE_BUF_SIZE  16384
 #define WEATHER_HTTP_TIMEOUT_MS    15000
-#define WEATHER_TASK_STACK_SIZE    16384
 #define WEATHER_RETRY_INTERVAL_S  60
 
 /* ── Static state ── */
 static weather_data_t    s_data;
 static SemaphoreHandle_t s_mutex;
-static TaskHandle_t      s_task_handle;
+static int               s_job = -1;   /* shared poll scheduler job */
+
+/* Conditional-GET cache: up to 3 URLs per provider poll (WU), bodies kept up
+ * to the response cap for replay. s_poll_fresh_bodies counts non-304 bodies
+ * in the current poll; only touched by the weather poll task. */
+#define WEATHER_VALIDATOR_SLOTS    4
+static http_validator_cache_t *s_validators;
+static int                     s_poll_fresh_bodies;
 
 // =============================================================================
 // Mutex helpers
 // =============================================================================
 
 void weather_client_init(void) {
+    if (!s_validators) {
+        s_validators = http_validator_cache_create(WEATHER_VALIDATOR_SLOTS,
+                                                   WEATHER_RESPONSE_BUF_SIZE);
+    }
     memset(&s_data, 0, sizeof(s_data));
     s_data.valid = false;
     s_data.uv_index = -1.0f;
@@ -72,9 +87,7 @@ bool weather_client_has_valid_data(void) {
 }
 
 void weather_client_force_refresh(void) {
-    if (s_task_handle) {
-        xTaskNotifyGive(s_task_handle);
-    }
+    poll_task_kick(s_job);
 }
 
 void weather_client_invalidate(void) {
@@ -84,6 +97,7 @@ void weather_client_invalidate(void) {
         s_data.uv_index = -1.0f;
         xSemaphoreGive(s_mutex);
     }
+    http_validator_cache_clear(s_validators);
 }
 
 // =============================================================================
@@ -118,15 +132,19 @@ static void str_to_upper(char *s) {
  * TLS cert-bundle validation on, redirects followed up to 3 hops, single
  * attempt (this poller's own retry interval is the retry mechanism), same
  * response-size cap as before. All transport/status/size error logging
- * happens inside http_fetch_text() itself.
+ * happens inside http_fetch_text() itself. Conditional via s_validators: a
+ * 304 returns the retained body, anything else bumps s_poll_fresh_bodies.
  */
 static char *http_get_body(const char *url) {
+    bool not_modified = false;
     http_fetch_opts_t opts = {
         .timeout_ms         = WEATHER_HTTP_TIMEOUT_MS,
         .use_tls_bundle     = true,
         .max_redirects      = 3,
         .max_attempts       = 1,
         .max_response_bytes = WEATHER_RESPONSE_BUF_SIZE,
+        .validators         = s_validators,
+        .not_modified_out   = &not_modified,
     };
 
     char *body = NULL;
@@ -134,6 +152,9 @@ static char *http_get_body(const char *url) {
     if (http_fetch_text(url, &opts, &body, &len) != ESP_OK) {
         return NULL;
     }
+    if (!not_modified) {
+        s_poll_fresh_bodies++;
+    }
 
     if (len == 0) {
         ESP_LOGW(TAG, "Empty response body");
@@ -646,19 +667,20 @@ static bool fetch_wunderground(const app_config_t *cfg, weather_data_t *out) {
 }
 
 // =============================================================================
-// Poll task
+// Poll job
 // =============================================================================
 
 /* Poll interval (seconds) from the cfg snapshot taken during the most recent
  * successful poll_once() -- stashed here so weather_interval_ms() (called by
- * poll_loop_run right after a successful poll_once()) can clamp it without
- * re-snapshotting the config. Only read/written from the weather poll task. */
+ * the poll scheduler right after poll_once()) can clamp it without
+ * re-snapshotting the config. Only read/written from the weather poll job,
+ * which never runs on two workers at once. */
 static uint32_t s_last_poll_interval_s;
 
 static bool weather_poll_once(void *arg) {
     (void)arg;
 
-    /* app_config_t is ~20 KB; never place it on this task's stack. Snapshot
+    /* app_config_t is ~20 KB; never place it on a worker's stack. Snapshot
      * into a PSRAM heap buffer and free on every return path. */
     app_config_t *cfg_snap = heap_caps_malloc(sizeof(app_config_t), MALLOC_CAP_SPIRAM);
     if (cfg_snap == NULL) {
@@ -686,6 +708,7 @@ static bool weather_poll_once(void *arg) {
     local.uv_index = -1.0f;
 
     bool ok = false;
+    s_poll_fresh_bodies = 0;
     switch (cfg_snap->weather_provider) {
         case 0:  ok = fetch_owm(cfg_snap, &local);          break;
         case 1:  ok = fetch_open_meteo(cfg_snap, &local);   break;
@@ -704,6 +727,23 @@ static bool weather_poll_once(void *arg) {
     local.valid = true;
     local.last_update_ts = (int64_t)time(NULL);
 
+    /* Every body was a 304 replay: the published data is still current, so
+     * just stamp it and skip the clock page redraw. */
+    if (s_poll_fresh_bodies == 0 &&
+        xSemaphoreTake(s_mutex, pdMS_TO_TICKS(200)) == pdTRUE) {
+        bool unchanged = s_data.valid;
+        if (unchanged) {
+            s_data.last_update_ts = local.last_update_ts;
+        }
+        xSemaphoreGive(s_mutex);
+        if (unchanged) {
+            ESP_LOGD(TAG, "Weather unchanged (304)");
+            s_last_poll_interval_s = cfg_snap->weather_poll_interval_s;
+            heap_caps_free(cfg_snap);
+            return true;
+        }
+    }
+
     if (xSemaphoreTake(s_mutex, pdMS_TO_TICKS(200)) == pdTRUE) {
         memcpy(&s_data, &local, sizeof(weather_data_t));
         xSemaphoreGive(s_mutex);
@@ -731,58 +771,27 @@ static uint32_t weather_interval_ms(void *arg) {
     return interval_ms;
 }
 
-static void weather_poll_task(void *arg) {
-    (void)arg;
-
-    poll_loop_spec_t spec = {
-        .name = "weather",
-        .wifi_group = s_wifi_event_group,
-        .wifi_bits = WIFI_CONNECTED_BIT,
-        .page_active = &clock_page_active,
-        .poll_once = weather_poll_once,
-        .interval_ms = weather_interval_ms,
-        /* Both the "not configured" and "fetch failed" paths retry at a flat
-         * WEATHER_RETRY_INTERVAL_S: initial == max means poll_backoff_next()
-         * always returns WEATHER_RETRY_INTERVAL_S * 1000, never doubling. */
-        .backoff_initial_ms = WEATHER_RETRY_INTERVAL_S * 1000,
-        .backoff_max_ms = WEATHER_RETRY_INTERVAL_S * 1000,
-    };
-
-    poll_loop_run(&spec, NULL);
-}
+static poll_loop_spec_t s_spec = {
+    .name = "weather",
+    .wifi_bits = WIFI_CONNECTED_BIT,
+    .page_active = &clock_page_active,
+    .poll_once = weather_poll_once,
+    .interval_ms = weather_interval_ms,
+    /* Both the "not configured" and "fetch failed" paths retry at a flat
+     * WEATHER_RETRY_INTERVAL_S: initial == max means poll_backoff_next()
+     * always returns WEATHER_RETRY_INTERVAL_S * 1000, never doubling. */
+    .backoff_initial_ms = WEATHER_RETRY_INTERVAL_S * 1000,
+    .backoff_max_ms = WEATHER_RETRY_INTERVAL_S * 1000,
+};
 
 void weather_client_start(void) {
-    if (s_task_handle) return;  /* Already running */
-
-    void *stack = heap_caps_calloc(1, WEATHER_TASK_STACK_SIZE, MALLOC_CAP_SPIRAM);
-    if (!stack) {
-        ESP_LOGE(TAG, "Failed to allocate task stack in PSRAM");
-        return;
-    }
-
-    StaticTask_t *tcb = heap_caps_calloc(1, sizeof(StaticTask_t), MALLOC_CAP_INTERNAL);
-    if (!tcb) {
-        ESP_LOGE(TAG, "Failed to allocate TCB");
-        free(stack);
-        return;
-    }
-
-    s_task_handle = xTaskCreateStaticPinnedToCore(
-        weather_poll_task,
-        "weather_poll",
-        WEATHER_TASK_STACK_SIZE,
-        NULL,
-        5,
-        (StackType_t *)stack,
-        tcb,
-        0  /* Core 0 — networking core */
-    );
-
-    if (s_task_handle) {
-        ESP_LOGI(TAG, "Weather poll task started on Core 0");
+    if (s_job >= 0) return;  /* Already polling */
+
+    s_spec.wifi_group = s_wifi_event_group;
+    s_job = poll_task_add(&s_spec, NULL);
+    if (s_job >= 0) {
+        ESP_LOGI(TAG, "Weather poll job added");
     } else {
-        ESP_LOGE(TAG, "Failed to create weather poll task");
-        free(stack);
-        free(tcb);
+        ESP_LOGE(TAG, "Failed to add weather poll job");
     }
 }
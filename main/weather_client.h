@@ -31,7 +31,7 @@ typedef struct {
 /** Initialise internal state (creates mutex). Call once before start. */
 void weather_client_init(void);
 
-/** Spawn the weather poll task. Call after WiFi init. */
+/** Add the weather poll job to the shared poll scheduler. Call after WiFi init. */
 void weather_client_start(void);
 
 /** Copy current weather data into *out under mutex. */
@@ -40,7 +40,7 @@ void weather_client_get_data(weather_data_t *out);
 /** Returns true if cached data is valid (successful fetch completed). */
 bool weather_client_has_valid_data(void);
 
-/** Wake the poll task immediately for an out-of-cycle refresh. */
+/** Run the poll job immediately for an out-of-cycle refresh. */
 void weather_client_force_refresh(void);
 
 /** Clear cached weather data (marks invalid). Call when provider changes. */
@@ -0,0 +1,42 @@
+/*
+ * web_assets.c - Lookup and validator matching for the gzip asset table
+ * (see web_assets.h).
+ */
+
+#include "web_assets.h"
+
+#include <string.h>
+
+const web_asset_t *web_asset_find(const char *name)
+{
+    if (!name) return NULL;
+    for (size_t i = 0; i < web_assets_count; i++) {
+        if (strcmp(web_assets[i].name, name) == 0) return &web_assets[i];
+    }
+    return NULL;
+}
+
+bool web_asset_etag_matches(const char *inm, const char *etag)
+{
+    if (!inm || !etag) return false;
+    size_t etag_len = strlen(etag);
+
+    const char *p = inm;
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == ',') p++;
+        if (*p == '\0') break;
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t')) len--;
+
+        if (len == 1 && p[0] == '*') return true;
+        const char *tag = p;
+        if (len > 2 && tag[0] == 'W' && tag[1] == '/') {
+            tag += 2;
+            len -= 2;
+        }
+        if (len == etag_len && memcmp(tag, etag, len) == 0) return true;
+        p += (end ? (size_t)(end - p) : strlen(p));
+    }
+    return false;
+}
@@ -0,0 +1,57 @@
+/*
+ * web_assets.h - Gzip-precompressed web UI pages.
+ *
+ * The HTML pages used to be embedded raw (EMBED_TXTFILES) and sent
+ * uncompressed on every request, which over a weak link made the first
+ * settings-page load slow and kept the httpd task busy for the whole
+ * transfer. generate_web_assets.py now gzips every page at build time into
+ * the web_assets[] table below (generated into the build directory), each
+ * with a content-hash ETag, so a page costs a fraction of the bytes and a
+ * revalidation costs a 304.
+ *
+ * Bodies are gzip streams, sent as-is with Content-Encoding: gzip.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char    *name;            /* source file name, e.g. "config_ui.html" */
+    const uint8_t *gz;              /* gzip-compressed body */
+    size_t         gz_len;
+    const char    *etag;            /* quoted strong ETag (content hash) */
+    const char    *content_type;
+} web_asset_t;
+
+/* Generated by generate_web_assets.py. */
+extern const web_asset_t web_assets[];
+extern const size_t      web_assets_count;
+
+/* Hash over every asset; substituted for __WEB_ASSETS_VERSION__ in the pages. */
+extern const char web_assets_version[];
+
+/* Asset named @p name, or NULL. */
+const web_asset_t *web_asset_find(const char *name);
+
+/*
+ * True if an If-None-Match header value @p inm (a single ETag, a list, or
+ * "*") matches @p etag. Weak validators (W/"...") are compared by value.
+ */
+bool web_asset_etag_matches(const char *inm, const char *etag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WEB_ASSETS_H */
@@ -14,8 +14,6 @@ static int s_login_failures = 0;
 static int64_t s_login_lockout_until_us = 0;
 static portMUX_TYPE s_login_mux = portMUX_INITIALIZER_UNLOCKED;
 
-extern const uint8_t login_html_start[] asm("_binary_login_html_start");
-extern const uint8_t login_html_end[]   asm("_binary_login_html_end");
 
 /* ---- Shared login lockout helpers ----
  * These let other auth paths (e.g. the X-Auth-Password header in check_session)
@@ -68,12 +66,8 @@ void auth_note_success(void)
 /* GET /login — serves the static login page (unauthenticated). */
 esp_err_t login_page_get_handler(httpd_req_t *req)
 {
-    httpd_resp_set_type(req, "text/html");
     /* No caching: avoids stale copy after logout/password change */
-    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
-    httpd_resp_send(req, (const char *)login_html_start,
-                    login_html_end - login_html_start);
-    return ESP_OK;
+    return send_web_asset(req, web_asset_find("login.html"), "no-store");
 }
 
 esp_err_t auth_status_get_handler(httpd_req_t *req)
@@ -1,8 +1,10 @@
 #include "web_server_internal.h"
 #include "mqtt_ha.h"
+#include <inttypes.h>
 #include <string.h>
 #include <time.h>
 #include "esp_heap_caps.h"
+#include "esp_random.h"
 #include "build_version.h"
 #include "esp_mac.h"
 #include "esp_timer.h"
@@ -13,77 +15,54 @@
 #include "ui/page_registry.h"           /* page_ref_navigate, PAGE_REF_ID_MAX, PAGE_REF_SETTINGS */
 #include "settings_table.h"             /* settings_json_serialize/parse — table-driven config JSON */
 
-extern const uint8_t config_html_start[] asm("_binary_config_ui_html_start");
-extern const uint8_t config_html_end[]   asm("_binary_config_ui_html_end");
-extern const uint8_t setup_html_start[] asm("_binary_setup_ui_html_start");
-extern const uint8_t setup_html_end[]   asm("_binary_setup_ui_html_end");
 extern const uint8_t favicon_png_start[] asm("_binary_favicon_png_start");
 extern const uint8_t favicon_png_end[]   asm("_binary_favicon_png_end");
 
-/* P6b tab fragments -- see s_ui_fragments[] below for the lookup table these feed. */
-extern const uint8_t fragment_logs_html_start[] asm("_binary_fragment_logs_html_start");
-extern const uint8_t fragment_logs_html_end[]   asm("_binary_fragment_logs_html_end");
-extern const uint8_t fragment_backup_html_start[] asm("_binary_fragment_backup_html_start");
-extern const uint8_t fragment_backup_html_end[]   asm("_binary_fragment_backup_html_end");
-extern const uint8_t fragment_api_html_start[] asm("_binary_fragment_api_html_start");
-extern const uint8_t fragment_api_html_end[]   asm("_binary_fragment_api_html_end");
-
-/* P6c tab fragments. image-display's tab name has a hyphen; the embedded
- * asset filename/symbol use an underscore (fragment_image_display.html),
- * so the name->symbol mapping only lines up in the s_ui_fragments[] row
- * below, not by naming convention alone. */
-extern const uint8_t fragment_allsky_html_start[] asm("_binary_fragment_allsky_html_start");
-extern const uint8_t fragment_allsky_html_end[]   asm("_binary_fragment_allsky_html_end");
-extern const uint8_t fragment_json_html_start[] asm("_binary_fragment_json_html_start");
-extern const uint8_t fragment_json_html_end[]   asm("_binary_fragment_json_html_end");
-extern const uint8_t fragment_ha_html_start[] asm("_binary_fragment_ha_html_start");
-extern const uint8_t fragment_ha_html_end[]   asm("_binary_fragment_ha_html_end");
-extern const uint8_t fragment_clock_html_start[] asm("_binary_fragment_clock_html_start");
-extern const uint8_t fragment_clock_html_end[]   asm("_binary_fragment_clock_html_end");
-extern const uint8_t fragment_spotify_html_start[] asm("_binary_fragment_spotify_html_start");
-extern const uint8_t fragment_spotify_html_end[]   asm("_binary_fragment_spotify_html_end");
-extern const uint8_t fragment_image_display_html_start[] asm("_binary_fragment_image_display_html_start");
-extern const uint8_t fragment_image_display_html_end[]   asm("_binary_fragment_image_display_html_end");
-
-/* P6d tab fragments -- final wave. Extracts the remaining four tabs (nodes,
- * display, behavior, system), completing the migration: all 11 tabs now ship
- * as lazily-fetched fragments and config_ui.html holds only the tab shell,
- * loader machinery, and the shared JS (see config_ui.html's Tab Fragment
- * Loader section for LAZY_TABS/loadedTabs). */
-extern const uint8_t fragment_nodes_html_start[] asm("_binary_fragment_nodes_html_start");
-extern const uint8_t fragment_nodes_html_end[]   asm("_binary_fragment_nodes_html_end");
-extern const uint8_t fragment_display_html_start[] asm("_binary_fragment_display_html_start");
-extern const uint8_t fragment_display_html_end[]   asm("_binary_fragment_display_html_end");
-extern const uint8_t fragment_behavior_html_start[] asm("_binary_fragment_behavior_html_start");
-extern const uint8_t fragment_behavior_html_end[]   asm("_binary_fragment_behavior_html_end");
-extern const uint8_t fragment_system_html_start[] asm("_binary_fragment_system_html_start");
-extern const uint8_t fragment_system_html_end[]   asm("_binary_fragment_system_html_end");
+/* HTML pages are served from the gzip table in web_assets.h. The top-level
+ * pages have fixed URLs, so browsers revalidate them on every load (a 304
+ * when unchanged). Fragment URLs carry web_assets_version, so those can be
+ * cached for good: an update changes the version and therefore the URL. */
+#define CACHE_REVALIDATE "private, no-cache"
+#define CACHE_IMMUTABLE  "private, max-age=31536000, immutable"
+
+esp_err_t send_web_asset(httpd_req_t *req, const web_asset_t *asset, const char *cache_control)
+{
+    if (!asset) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    httpd_resp_set_hdr(req, "ETag", asset->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", cache_control);
+
+    char inm[96];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        web_asset_etag_matches(inm, asset->etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    httpd_resp_set_type(req, asset->content_type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char *)asset->gz, asset->gz_len);
+}
 
 // Handler for root URL
 esp_err_t root_get_handler(httpd_req_t *req)
 {
     if (is_setup_mode()) {
-        httpd_resp_set_type(req, "text/html");
-        httpd_resp_send(req, (const char *)setup_html_start,
-                        setup_html_end - setup_html_start);
-        return ESP_OK;
+        return send_web_asset(req, web_asset_find("setup_ui.html"), CACHE_REVALIDATE);
     }
     REQUIRE_AUTH(req);
-    httpd_resp_set_type(req, "text/html");
-    httpd_resp_send(req, (const char *)config_html_start,
-                    config_html_end - config_html_start);
-    return ESP_OK;
+    return send_web_asset(req, web_asset_find("config_ui.html"), CACHE_REVALIDATE);
 }
 
 /**
  * @brief One row of the tab-fragment lookup table: a `tab` query value maps
- * to an embedded HTML asset's start/end pointers (same EMBED_TXTFILES
- * pattern as config_html_start/end above).
+ * to the web_assets.h page that holds its markup.
  */
 typedef struct {
     const char *name;
-    const uint8_t *start;
-    const uint8_t *end;
+    const char *asset;
 } ui_fragment_entry_t;
 
 /*
@@ -95,45 +74,44 @@ typedef struct {
  * P6d (final wave) extracts the remaining four -- nodes, display, behavior,
  * system -- so every tab now ships as its own fragment_NAME.html and none
  * remain inline in config_ui.html. The "image-display" row is the one
- * name/symbol mismatch: the tab name has a hyphen, but embedded-asset
- * symbols cannot contain one, so the file is fragment_image_display.html
- * and only this table maps the hyphenated tab name to the underscored
- * symbol.
+ * name/file mismatch: the tab name has a hyphen, but the file is
+ * fragment_image_display.html, and only this table maps one to the other.
  */
 static const ui_fragment_entry_t s_ui_fragments[] = {
-    { "__none__", NULL, NULL },  /* placeholder so the array type-checks; never matches a real tab name */
-    { "logs",   fragment_logs_html_start,   fragment_logs_html_end },
-    { "backup", fragment_backup_html_start, fragment_backup_html_end },
-    { "api",    fragment_api_html_start,    fragment_api_html_end },
-    { "allsky",        fragment_allsky_html_start,        fragment_allsky_html_end },
-    { "json",          fragment_json_html_start,          fragment_json_html_end },
-    { "ha",            fragment_ha_html_start,            fragment_ha_html_end },
-    { "clock",         fragment_clock_html_start,         fragment_clock_html_end },
-    { "spotify",       fragment_spotify_html_start,       fragment_spotify_html_end },
-    { "image-display", fragment_image_display_html_start, fragment_image_display_html_end },
-    { "nodes",         fragment_nodes_html_start,         fragment_nodes_html_end },
-    { "display",       fragment_display_html_start,       fragment_display_html_end },
-    { "behavior",      fragment_behavior_html_start,      fragment_behavior_html_end },
-    { "system",        fragment_system_html_start,        fragment_system_html_end },
+    { "logs",          "fragment_logs.html" },
+    { "backup",        "fragment_backup.html" },
+    { "api",           "fragment_api.html" },
+    { "allsky",        "fragment_allsky.html" },
+    { "json",          "fragment_json.html" },
+    { "ha",            "fragment_ha.html" },
+    { "clock",         "fragment_clock.html" },
+    { "spotify",       "fragment_spotify.html" },
+    { "image-display", "fragment_image_display.html" },
+    { "nodes",         "fragment_nodes.html" },
+    { "display",       "fragment_display.html" },
+    { "behavior",      "fragment_behavior.html" },
+    { "system",        "fragment_system.html" },
 };
 
-// Handler for GET /ui/fragment?tab=<name> -- serves one lazily-loaded config_ui.html tab fragment.
+// Handler for GET /ui/fragment?tab=<name>[&v=<version>] -- serves one lazily-loaded config_ui.html tab fragment.
 esp_err_t ui_fragment_get_handler(httpd_req_t *req)
 {
     REQUIRE_AUTH(req);
 
-    char qbuf[64] = {0};
+    char qbuf[96] = {0};
     char tab[32] = {0};
+    char ver[24] = {0};
     if (httpd_req_get_url_query_str(req, qbuf, sizeof(qbuf)) == ESP_OK) {
         httpd_query_key_value(qbuf, "tab", tab, sizeof(tab));
+        httpd_query_key_value(qbuf, "v", ver, sizeof(ver));
     }
 
     for (size_t i = 0; i < sizeof(s_ui_fragments) / sizeof(s_ui_fragments[0]); i++) {
-        if (s_ui_fragments[i].start != NULL && strcmp(s_ui_fragments[i].name, tab) == 0) {
-            httpd_resp_set_type(req, "text/html");
-            httpd_resp_send(req, (const char *)s_ui_fragments[i].start,
-                             s_ui_fragments[i].end - s_ui_fragments[i].start);
-            return ESP_OK;
+        if (strcmp(s_ui_fragments[i].name, tab) == 0) {
+            /* Only a URL naming this build's version may be cached for good. */
+            bool versioned = strcmp(ver, web_assets_version) == 0;
+            return send_web_asset(req, web_asset_find(s_ui_fragments[i].asset),
+                                  versioned ? CACHE_IMMUTABLE : CACHE_REVALIDATE);
         }
     }
 
@@ -241,15 +219,89 @@ static cJSON *serialize_config_to_json(const app_config_t *cfg)
     return obj;
 }
 
-// Handler for getting config
-esp_err_t config_get_handler(httpd_req_t *req)
+/* ---- Serialized config cache ----
+ * GET /api/config and GET /api/backup used to build a cJSON tree from the
+ * config and print it on every request. Each printed document is now kept in
+ * a config_json_cache_t together with the config snapshot it was printed
+ * from; a request takes a fresh snapshot (one memcpy under the config mutex)
+ * and reuses the JSON for as long as the two are byte-identical. Comparing
+ * snapshots, rather than hooking app_config_save()/apply(), also catches the
+ * on-device settings screens and MQTT, which write the live config directly.
+ * Each rebuild bumps the entry's generation, which /api/config serves as its
+ * ETag. Handlers all run on the single httpd task, so the entries need no
+ * lock. */
+
+#define CONFIG_JSON_CHUNK 4096
+
+typedef struct {
+    app_config_t *src;      /* PSRAM: snapshot the JSON was printed from */
+    uint32_t      key;      /* other inputs to the document (e.g. dirty flag) */
+    char         *json;     /* cJSON_PrintUnformatted() output */
+    size_t        len;
+    uint32_t      gen;      /* bumped on every rebuild */
+} config_json_cache_t;
+
+typedef char *(*config_json_build_fn)(const app_config_t *cfg, uint32_t key);
+
+static app_config_t *s_config_probe;    /* PSRAM: this request's snapshot */
+static uint32_t s_etag_nonce;           /* keeps ETags from repeating across boots */
+
+/* Snapshot the live config into the probe buffer; NULL if it cannot be allocated. */
+static const app_config_t *config_cache_snapshot(void)
+{
+    if (!s_config_probe) {
+        s_config_probe = heap_caps_malloc(sizeof(app_config_t), MALLOC_CAP_SPIRAM);
+        if (!s_config_probe) return NULL;
+        s_etag_nonce = esp_random();
+    }
+    app_config_get_snapshot_into(s_config_probe);
+    return s_config_probe;
+}
+
+/* Make @p c hold the document for @p cfg and @p key, rebuilding it only if
+ * either differs from what it was last built from. */
+static bool config_cache_refresh(config_json_cache_t *c, const app_config_t *cfg,
+                                 uint32_t key, config_json_build_fn build)
+{
+    if (c->json && c->key == key && memcmp(c->src, cfg, sizeof(*cfg)) == 0) {
+        return true;
+    }
+    if (!c->src) {
+        c->src = heap_caps_malloc(sizeof(app_config_t), MALLOC_CAP_SPIRAM);
+        if (!c->src) return false;
+    }
+    char *json = build(cfg, key);
+    if (!json) return false;
+
+    free(c->json);
+    c->json = json;
+    c->len = strlen(json);
+    c->key = key;
+    memcpy(c->src, cfg, sizeof(*cfg));
+    c->gen++;
+    return true;
+}
+
+/* Send @p len bytes as CONFIG_JSON_CHUNK-sized chunks (no terminating chunk). */
+static esp_err_t send_json_chunks(httpd_req_t *req, const char *buf, size_t len)
+{
+    while (len > 0) {
+        size_t n = len < CONFIG_JSON_CHUNK ? len : CONFIG_JSON_CHUNK;
+        esp_err_t err = httpd_resp_send_chunk(req, buf, n);
+        if (err != ESP_OK) return err;
+        buf += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+/* Build the GET /api/config document: serialize_config_to_json() plus
+ * redacted secrets, WiFi networks and the @p dirty flag. */
+static char *build_config_get_json(const app_config_t *cfg, uint32_t dirty)
 {
-    REQUIRE_AUTH(req);
-    app_config_t *cfg = app_config_get();
     cJSON *root = serialize_config_to_json(cfg);
     if (root == NULL) {
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
+        return NULL;
     }
 
     /* Redact secrets. Real values are never exposed via GET /api/config.
@@ -283,19 +335,46 @@ esp_err_t config_get_handler(httpd_req_t *req)
             cfg->wifi_networks[0].password[0] != '\0' ? "********" : "");
     }
 
-    cJSON_AddBoolToObject(root, "_dirty", app_config_is_dirty());
+    cJSON_AddBoolToObject(root, "_dirty", dirty != 0);
 
-    const char *json_str = cJSON_PrintUnformatted(root);
-    if (json_str == NULL) {
-        cJSON_Delete(root);
+    char *json_str = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    return json_str;
+}
+
+static config_json_cache_t s_config_get_cache;
+
+// Handler for getting config
+esp_err_t config_get_handler(httpd_req_t *req)
+{
+    REQUIRE_AUTH(req);
+    const app_config_t *cfg = config_cache_snapshot();
+    if (!cfg || !config_cache_refresh(&s_config_get_cache, cfg, app_config_is_dirty(),
+                                      build_config_get_json)) {
         httpd_resp_send_500(req);
         return ESP_FAIL;
     }
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, json_str, HTTPD_RESP_USE_STRLEN);
+    const config_json_cache_t *c = &s_config_get_cache;
+
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"%08" PRIx32 "-%" PRIu32 "\"", s_etag_nonce, c->gen);
+    httpd_resp_set_hdr(req, "ETag", etag);
+    /* Let browsers keep the body but revalidate it on every load. */
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+    char inm[64];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK &&
+        strstr(inm, etag) != NULL) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        httpd_resp_send(req, NULL, 0);
+        return ESP_OK;
+    }
 
-    free((void*)json_str);
-    cJSON_Delete(root);
+    httpd_resp_set_type(req, "application/json");
+    if (send_json_chunks(req, c->json, c->len) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    httpd_resp_send_chunk(req, NULL, 0);
     return ESP_OK;
 }
 
@@ -1312,6 +1391,76 @@ esp_err_t config_revert_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+/* Build the backup "config" section: every non-sensitive registry field. */
+static char *build_backup_config_json(const app_config_t *cfg, uint32_t key)
+{
+    (void)key;
+    cJSON *full_config = serialize_config_to_json(cfg);
+    if (!full_config) return NULL;
+
+    cJSON *config_section = cJSON_CreateObject();
+    for (const backup_field_t *f = s_backup_fields; f->json_key; f++) {
+        if (f->is_sensitive) continue;
+        cJSON *val = cJSON_GetObjectItem(full_config, f->json_key);
+        if (!val) continue;
+        cJSON_AddItemToObject(config_section, f->json_key, cJSON_Duplicate(val, true));
+    }
+    cJSON_Delete(full_config);
+
+    char *json_str = cJSON_PrintUnformatted(config_section);
+    cJSON_Delete(config_section);
+    return json_str;
+}
+
+/* Build the backup "sensitive" section: sensitive registry fields plus the
+ * credentials serialize_config_to_json() does not emit. */
+static char *build_backup_sensitive_json(const app_config_t *cfg, uint32_t key)
+{
+    (void)key;
+    cJSON *full_config = serialize_config_to_json(cfg);
+    if (!full_config) return NULL;
+
+    cJSON *sensitive_section = cJSON_CreateObject();
+    for (const backup_field_t *f = s_backup_fields; f->json_key; f++) {
+        if (!f->is_sensitive) continue;
+        cJSON *val = cJSON_GetObjectItem(full_config, f->json_key);
+        if (!val) continue;
+        cJSON_AddItemToObject(sensitive_section, f->json_key, cJSON_Duplicate(val, true));
+    }
+    cJSON_Delete(full_config);
+
+    /* Inject fields that serialize_config_to_json() does NOT emit (admin_password,
+     * wifi_networks array, wifi_password legacy). Without these, a restore from
+     * a "full" backup would wipe device credentials. */
+    cJSON_AddStringToObject(sensitive_section, "admin_password", cfg->admin_password);
+    /* mqtt_password, spotify_client_id, weather_api_key already emitted by
+     * serialize_config_to_json() and routed into sensitive_section by the
+     * s_backup_fields registry above. */
+
+    /* wifi_networks: full array with real ssid + password per entry */
+    cJSON *wifi_arr = cJSON_CreateArray();
+    for (int i = 0; i < 3; i++) {
+        cJSON *net = cJSON_CreateObject();
+        cJSON_AddStringToObject(net, "ssid", cfg->wifi_networks[i].ssid);
+        cJSON_AddStringToObject(net, "password", cfg->wifi_networks[i].password);
+        /* Mirror as "pass" too — config_post handler reads "pass" key */
+        cJSON_AddStringToObject(net, "pass", cfg->wifi_networks[i].password);
+        cJSON_AddItemToArray(wifi_arr, net);
+    }
+    cJSON_AddItemToObject(sensitive_section, "wifi_networks", wifi_arr);
+
+    /* Legacy top-level wifi_password = wifi_networks[0].password */
+    cJSON_AddStringToObject(sensitive_section, "wifi_password",
+                            cfg->wifi_networks[0].password);
+
+    char *json_str = cJSON_PrintUnformatted(sensitive_section);
+    cJSON_Delete(sensitive_section);
+    return json_str;
+}
+
+static config_json_cache_t s_backup_config_cache;
+static config_json_cache_t s_backup_sensitive_cache;
+
 esp_err_t backup_get_handler(httpd_req_t *req)
 {
     REQUIRE_AUTH(req);
@@ -1327,22 +1476,30 @@ esp_err_t backup_get_handler(httpd_req_t *req)
         }
     }
 
+    const app_config_t *cfg = config_cache_snapshot();
+    if (!cfg) { httpd_resp_send_500(req); return ESP_FAIL; }
+
     /* Safety rail: if authentication is disabled, secrets must NEVER be
      * returned in any API response — including this backup endpoint. A caller
      * that explicitly requests include_sensitive=1 on an open device still
      * gets a redacted backup. */
-    app_config_t *cfg = app_config_get();
     if (!cfg->auth_enabled && include_sensitive) {
         ESP_LOGI(TAG, "backup: include_sensitive forced off (auth disabled)");
         include_sensitive = false;
     }
 
-    /* Build root JSON */
-    cJSON *root = cJSON_CreateObject();
-    if (!root) { httpd_resp_send_500(req); return ESP_FAIL; }
+    /* The config and sensitive sections come from the cache; only the small
+     * meta section (export date) is built per request. */
+    if (!config_cache_refresh(&s_backup_config_cache, cfg, 0, build_backup_config_json) ||
+        (include_sensitive &&
+         !config_cache_refresh(&s_backup_sensitive_cache, cfg, 0, build_backup_sensitive_json))) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
 
     /* ---- Meta section ---- */
     cJSON *meta = cJSON_CreateObject();
+    if (!meta) { httpd_resp_send_500(req); return ESP_FAIL; }
     cJSON_AddNumberToObject(meta, "config_version", APP_CONFIG_VERSION);
     cJSON_AddStringToObject(meta, "firmware_version", BUILD_GIT_TAG);
     cJSON_AddStringToObject(meta, "git_sha", BUILD_GIT_SHA);
@@ -1372,71 +1529,9 @@ esp_err_t backup_get_handler(httpd_req_t *req)
     strftime(date_str, sizeof(date_str), "%Y-%m-%dT%H:%M:%SZ", &timeinfo);
     cJSON_AddStringToObject(meta, "export_date", date_str);
 
-    cJSON_AddItemToObject(root, "meta", meta);
-
-    /* ---- Build full config JSON, then split into config + sensitive sections ---- */
-    cJSON *full_config = serialize_config_to_json(cfg);
-    if (!full_config) {
-        cJSON_Delete(root);
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
-
-    /* Split into config and sensitive sections */
-    cJSON *config_section = cJSON_CreateObject();
-    cJSON *sensitive_section = include_sensitive ? cJSON_CreateObject() : NULL;
-
-    for (const backup_field_t *f = s_backup_fields; f->json_key; f++) {
-        cJSON *val = cJSON_GetObjectItem(full_config, f->json_key);
-        if (!val) continue;
-
-        if (f->is_sensitive) {
-            if (sensitive_section) {
-                cJSON_AddItemToObject(sensitive_section, f->json_key, cJSON_Duplicate(val, true));
-            }
-        } else {
-            cJSON_AddItemToObject(config_section, f->json_key, cJSON_Duplicate(val, true));
-        }
-    }
-
-    /* Inject fields that serialize_config_to_json() does NOT emit (admin_password,
-     * wifi_networks array, wifi_password legacy). Without these, a restore from
-     * a "full" backup would wipe device credentials. Only included when
-     * include_sensitive=1 (matches the existing sensitive-section gating). */
-    if (sensitive_section) {
-        cJSON_AddStringToObject(sensitive_section, "admin_password", cfg->admin_password);
-        /* mqtt_password, spotify_client_id, weather_api_key already emitted by
-         * serialize_config_to_json() and routed into sensitive_section by the
-         * s_backup_fields registry above. */
-
-        /* wifi_networks: full array with real ssid + password per entry */
-        cJSON *wifi_arr = cJSON_CreateArray();
-        for (int i = 0; i < 3; i++) {
-            cJSON *net = cJSON_CreateObject();
-            cJSON_AddStringToObject(net, "ssid", cfg->wifi_networks[i].ssid);
-            cJSON_AddStringToObject(net, "password", cfg->wifi_networks[i].password);
-            /* Mirror as "pass" too — config_post handler reads "pass" key */
-            cJSON_AddStringToObject(net, "pass", cfg->wifi_networks[i].password);
-            cJSON_AddItemToArray(wifi_arr, net);
-        }
-        cJSON_AddItemToObject(sensitive_section, "wifi_networks", wifi_arr);
-
-        /* Legacy top-level wifi_password = wifi_networks[0].password */
-        cJSON_AddStringToObject(sensitive_section, "wifi_password",
-                                cfg->wifi_networks[0].password);
-    }
-
-    cJSON_AddItemToObject(root, "config", config_section);
-    if (sensitive_section) {
-        cJSON_AddItemToObject(root, "sensitive", sensitive_section);
-    }
-
-    cJSON_Delete(full_config);
-
-    /* Serialize and send */
-    const char *json_str = cJSON_PrintUnformatted(root);
-    cJSON_Delete(root);
-    if (!json_str) { httpd_resp_send_500(req); return ESP_FAIL; }
+    char *meta_str = cJSON_PrintUnformatted(meta);
+    cJSON_Delete(meta);
+    if (!meta_str) { httpd_resp_send_500(req); return ESP_FAIL; }
 
     /* Build filename: {hostname}_{MAC}_v{version}_{date}.json */
     char filename[128];
@@ -1464,9 +1559,22 @@ esp_err_t backup_get_handler(httpd_req_t *req)
 
     httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Content-Disposition", filename);
-    httpd_resp_send(req, json_str, HTTPD_RESP_USE_STRLEN);
-    free((void *)json_str);
-    return ESP_OK;
+
+    /* {"meta":...,"config":...[,"sensitive":...]} */
+    esp_err_t err = httpd_resp_send_chunk(req, "{\"meta\":", HTTPD_RESP_USE_STRLEN);
+    if (err == ESP_OK) err = httpd_resp_send_chunk(req, meta_str, HTTPD_RESP_USE_STRLEN);
+    if (err == ESP_OK) err = httpd_resp_send_chunk(req, ",\"config\":", HTTPD_RESP_USE_STRLEN);
+    if (err == ESP_OK) err = send_json_chunks(req, s_backup_config_cache.json,
+                                              s_backup_config_cache.len);
+    if (err == ESP_OK && include_sensitive) {
+        err = httpd_resp_send_chunk(req, ",\"sensitive\":", HTTPD_RESP_USE_STRLEN);
+        if (err == ESP_OK) err = send_json_chunks(req, s_backup_sensitive_cache.json,
+                                                  s_backup_sensitive_cache.len);
+    }
+    if (err == ESP_OK) err = httpd_resp_send_chunk(req, "}", 1);
+    if (err == ESP_OK) err = httpd_resp_send_chunk(req, NULL, 0);
+    free(meta_str);
+    return err == ESP_OK ? ESP_OK : ESP_FAIL;
 }
 
 esp_err_t restore_post_handler(httpd_req_t *req)
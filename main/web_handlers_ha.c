@@ -19,10 +19,11 @@
 
 #include "web_server_internal.h"
 #include "ha_client.h"            /* ha_client_fetch_entity / ha_client_invalidate_config_cache */
+#include "ha_ws_client.h"         /* ha_ws_client_stop */
 #include "ui/nina_ha.h"           /* ha_page_refresh_config */
 #include "ui/nina_dashboard.h"    /* nina_dashboard_set_ha_enabled */
 #include "ui/nina_nav_arbiter.h"  /* nav_arbiter_notify_topology_changed */
-#include "tasks.h"                /* ha_ensure_task_running */
+#include "tasks.h"                /* ha_ensure_polling */
 #include "display_defs.h"         /* LVGL_LOCK_TIMEOUT_MS */
 #include "bsp/esp-bsp.h"
 #include "bsp/display.h"          /* bsp_display_lock / bsp_display_unlock */
@@ -158,10 +159,14 @@ esp_err_t ha_config_post_handler(httpd_req_t *req)
      * page's availability (it just appeared/disappeared from the ladder). */
     nav_arbiter_notify_topology_changed();
 
-    /* A runtime enable must start the poll task without a reboot; idempotent
+    /* A runtime enable must start polling without a reboot; idempotent
      * (no-op when disabled or already running). */
     if (cfg->ha_enabled) {
-        ha_ensure_task_running();
+        ha_ensure_polling();
+    } else {
+        /* The poll job idles with the page gone; close the subscription it
+         * would otherwise leave open. */
+        ha_ws_client_stop();
     }
 
     heap_caps_free(cfg);
@@ -20,7 +20,7 @@
 #include "ui/nina_json.h"         /* json_page_refresh_config */
 #include "ui/nina_dashboard.h"    /* nina_dashboard_set_json_enabled */
 #include "ui/nina_nav_arbiter.h"  /* nav_arbiter_notify_topology_changed */
-#include "tasks.h"                /* json_ensure_task_running */
+#include "tasks.h"                /* json_ensure_polling */
 #include "display_defs.h"         /* LVGL_LOCK_TIMEOUT_MS */
 #include "bsp/esp-bsp.h"
 #include "bsp/display.h"          /* bsp_display_lock / bsp_display_unlock */
@@ -160,10 +160,10 @@ esp_err_t json_config_post_handler(httpd_req_t *req)
      * page's availability (it just appeared/disappeared from the ladder). */
     nav_arbiter_notify_topology_changed();
 
-    /* A runtime enable must start the poll task without a reboot; idempotent
+    /* A runtime enable must start polling without a reboot; idempotent
      * (no-op when disabled or already running). */
     if (cfg->json_enabled) {
-        json_ensure_task_running();
+        json_ensure_polling();
     }
 
     heap_caps_free(cfg);
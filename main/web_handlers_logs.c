@@ -4,8 +4,10 @@
  *
  * GET  /api/logs            -> streams the captured log oldest->newest as a
  *                              text/plain attachment, chunked from PSRAM.
- *                              Optional ?tail=N serves only the last N bytes
- *                              (clamped to 1 KB .. full buffer size).
+ *                              Lines are formatted from the binary log
+ *                              records as they are streamed. Optional
+ *                              ?tail=N serves only the newest lines that fit
+ *                              in N bytes (clamped to 1 KB .. ring size).
  * POST /api/logs/clear      -> empties the capture buffer, returns {"ok":true}.
  * GET  /api/crashlog        -> streams the persistent crash-history JSONL file
  *                              (text/plain attachment; the UI also fetches it
@@ -16,10 +18,16 @@
  * GET  /api/coredump        -> streams the raw core dump ELF as an octet-stream
  *                              attachment (404 when no dump is present).
  * POST /api/coredump/clear  -> erases the saved core dump, returns {"ok":true}.
+ * GET  /api/trace           -> streams the timeline trace ring as Chrome
+ *                              trace-event JSON (attachment; open it in
+ *                              chrome://tracing or ui.perfetto.dev). Holds the
+ *                              events recorded up to the request.
+ * POST /api/trace/clear     -> empties the trace ring, returns {"ok":true}.
  */
 
 #include "web_server_internal.h"
 #include "log_capture.h"
+#include "trace.h"
 #include "crash_log.h"
 #include "build_version.h"
 #include "esp_heap_caps.h"
@@ -41,11 +49,11 @@ esp_err_t logs_get_handler(httpd_req_t *req)
 {
     REQUIRE_AUTH(req);
 
-    /* Optional ?tail=N: serve only the last N bytes of the captured log so
+    /* Optional ?tail=N: serve only the newest N bytes of formatted log so
      * the web UI's Logs tab can poll a small window instead of pulling the
-     * full 512 KB ring on every open (which starves other httpd requests).
+     * whole capture on every open (which starves other httpd requests).
      * No param, a malformed value, or N >= captured size keeps the existing
-     * full-buffer behavior. */
+     * full-log behavior. */
     size_t tail_bytes = 0;
     char qbuf[64];
     if (httpd_req_get_url_query_str(req, qbuf, sizeof(qbuf)) == ESP_OK) {
@@ -77,48 +85,38 @@ esp_err_t logs_get_handler(httpd_req_t *req)
     httpd_resp_set_type(req, "text/plain");
     httpd_resp_set_hdr(req, "Content-Disposition", disp);
 
+    /* The cursor carries one pending record per core ring; keep it in PSRAM
+     * next to the chunk rather than on the httpd stack. */
     char *chunk = heap_caps_malloc(LOG_CHUNK_SIZE, MALLOC_CAP_SPIRAM);
-    if (!chunk) {
+    log_capture_cursor_t *cur = heap_caps_malloc(sizeof(*cur), MALLOC_CAP_SPIRAM);
+    if (!chunk || !cur) {
+        heap_caps_free(chunk);
+        heap_caps_free(cur);
         httpd_resp_send_500(req);
         return ESP_FAIL;
     }
 
-    /* When tailing, start the stream at (captured size - N). The size is
-     * sampled once; lines that arrive mid-download simply extend what later
-     * reads return, same as the full download. */
-    size_t offset = 0;
-    if (tail_bytes > 0) {
-        size_t total = log_capture_size();
-        if (tail_bytes < total) {
-            offset = total - tail_bytes;
-            /* Advance past the first (likely partial) line so the tail starts
-             * on a clean line boundary. Cheap single-chunk scan; if no newline
-             * is found in the first chunk, just start mid-line. */
-            size_t got = log_capture_read(offset, chunk, LOG_CHUNK_SIZE);
-            if (got > 0) {
-                const char *nl = memchr(chunk, '\n', got);
-                if (nl != NULL) {
-                    offset += (size_t)(nl - chunk) + 1;
-                }
-            }
-        }
-    }
+    /* When tailing, the cursor starts at the oldest whole line that keeps the
+     * formatted output within N bytes. Records are formatted only here, as
+     * they are streamed. */
+    log_capture_open(cur, tail_bytes);
 
-    /* Stream oldest->newest. Each read locks the ring only for its own copy,
-     * so logging is never blocked across the whole HTTP send. New lines that
-     * arrive mid-download simply extend what later reads return. */
+    /* Stream oldest->newest. The rings are never locked, so logging is never
+     * blocked by the HTTP send. New lines that arrive mid-download simply
+     * extend what later reads return. */
     for (;;) {
-        size_t got = log_capture_read(offset, chunk, LOG_CHUNK_SIZE);
+        size_t got = log_capture_read(cur, chunk, LOG_CHUNK_SIZE);
         if (got == 0) {
             break;
         }
         if (httpd_resp_send_chunk(req, chunk, got) != ESP_OK) {
             heap_caps_free(chunk);
+            heap_caps_free(cur);
             return ESP_FAIL;  /* connection aborted; httpd cleans up */
         }
-        offset += got;
     }
 
+    heap_caps_free(cur);
     heap_caps_free(chunk);
 
     /* Terminate the chunked response with a zero-length chunk. */
@@ -312,3 +310,68 @@ esp_err_t coredump_clear_post_handler(httpd_req_t *req)
     httpd_resp_send(req, "{\"ok\":true}", HTTPD_RESP_USE_STRLEN);
     return ESP_OK;
 }
+
+// Handler for downloading the timeline trace as Chrome trace-event JSON
+esp_err_t trace_get_handler(httpd_req_t *req)
+{
+    REQUIRE_AUTH(req);
+
+    /* Build the download filename from the configured hostname. */
+    const char *hostname = app_config_get()->hostname;
+    if (!hostname || hostname[0] == '\0') {
+        hostname = "ninadash";
+    }
+    char disp[96];
+    snprintf(disp, sizeof(disp),
+             "attachment; filename=\"%s-trace.json\"", hostname);
+
+    char *chunk = heap_caps_malloc(LOG_CHUNK_SIZE, MALLOC_CAP_SPIRAM);
+    trace_cursor_t cur;
+    if (!chunk) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Content-Disposition", disp);
+
+    /* Open before naming the tasks so every track with events is labelled. */
+    trace_open(&cur);
+    bool first = true;
+    static const char head[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    size_t got = trace_thread_names_json(&first, chunk, LOG_CHUNK_SIZE);
+    if (httpd_resp_send_chunk(req, head, sizeof(head) - 1) != ESP_OK ||
+        httpd_resp_send_chunk(req, chunk, got) != ESP_OK) {
+        heap_caps_free(chunk);
+        return ESP_FAIL;  /* connection aborted; httpd cleans up */
+    }
+
+    /* Stream oldest->newest. Tasks keep recording during the download; the
+     * cursor stops at the head it was opened at. */
+    for (;;) {
+        got = trace_read_json(&cur, &first, chunk, LOG_CHUNK_SIZE);
+        if (got == 0) {
+            break;
+        }
+        if (httpd_resp_send_chunk(req, chunk, got) != ESP_OK) {
+            heap_caps_free(chunk);
+            return ESP_FAIL;
+        }
+    }
+    heap_caps_free(chunk);
+
+    httpd_resp_send_chunk(req, "]}", 2);
+    /* Terminate the chunked response with a zero-length chunk. */
+    httpd_resp_send_chunk(req, NULL, 0);
+    return ESP_OK;
+}
+
+// Handler for clearing the timeline trace ring
+esp_err_t trace_clear_post_handler(httpd_req_t *req)
+{
+    REQUIRE_AUTH(req);
+    trace_clear();
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, "{\"ok\":true}", HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+}
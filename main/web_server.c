@@ -374,6 +374,8 @@ void start_web_server(void)
         { { "/api/auth/status",        HTTP_GET,  auth_status_get_handler, NULL }, ROUTE_PUBLIC },
         { { "/api/logs",               HTTP_GET,  logs_get_handler, NULL }, ROUTE_AUTH_REQUIRED },
         { { "/api/logs/clear",         HTTP_POST, logs_clear_post_handler, NULL }, ROUTE_AUTH_REQUIRED },
+        { { "/api/trace",              HTTP_GET,  trace_get_handler,        NULL }, ROUTE_AUTH_REQUIRED },
+        { { "/api/trace/clear",        HTTP_POST, trace_clear_post_handler, NULL }, ROUTE_AUTH_REQUIRED },
         { { "/api/crashlog",           HTTP_GET,  crashlog_get_handler, NULL }, ROUTE_AUTH_REQUIRED },
         { { "/api/crashlog/clear",     HTTP_POST, crashlog_clear_post_handler, NULL }, ROUTE_AUTH_REQUIRED },
         { { "/api/coredump",           HTTP_GET,  coredump_get_handler,        NULL }, ROUTE_AUTH_REQUIRED },
@@ -9,6 +9,7 @@
 #include "esp_log.h"
 #include "cJSON.h"
 #include "app_config.h"
+#include "web_assets.h"
 
 /* Logging tag -- shared across all handler files */
 static const char *TAG __attribute__((unused)) = "web_server";
@@ -53,6 +54,11 @@ bool validate_url_format(const char *url);
  * Defined in web_handlers_config.c. */
 cJSON *receive_json_body(httpd_req_t *req, int max_size);
 
+/* Send a gzip-precompressed page from web_assets.h with @p cache_control, or
+ * 304 Not Modified if the request's If-None-Match matches its ETag.
+ * Defined in web_handlers_config.c. */
+esp_err_t send_web_asset(httpd_req_t *req, const web_asset_t *asset, const char *cache_control);
+
 /* ---- Session cookie auth (defined in web_server.c) ---- */
 bool check_session(httpd_req_t *req);
 esp_err_t send_auth_required(httpd_req_t *req);
@@ -147,6 +153,8 @@ esp_err_t wifi_status_get_handler(httpd_req_t *req);
 esp_err_t auth_status_get_handler(httpd_req_t *req);
 esp_err_t logs_get_handler(httpd_req_t *req);
 esp_err_t logs_clear_post_handler(httpd_req_t *req);
+esp_err_t trace_get_handler(httpd_req_t *req);
+esp_err_t trace_clear_post_handler(httpd_req_t *req);
 esp_err_t crashlog_get_handler(httpd_req_t *req);
 esp_err_t crashlog_clear_post_handler(httpd_req_t *req);
 esp_err_t coredump_info_get_handler(httpd_req_t *req);
@@ -0,0 +1,311 @@
+/*
+ * ws_event.c - Pure, host-testable incremental decoder for NINA WebSocket
+ * events.
+ *
+ * See ws_event.h for the contract.
+ */
+
+#include "ws_event.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define W_UI    WS_WAKE_UI
+#define W_POLL  WS_WAKE_POLL
+#define T(cat)  WS_TOAST_BIT(WS_TOAST_##cat)
+
+/* Event without an equipment: { name, type, payload?, wake, toast categories } */
+#define EV(name, type, payload, wake, toast) \
+    { name, type, WS_EQ_NONE, false, payload, wake, toast }
+/* Equipment connect / disconnect: aggregated toast, re-poll the equipment. */
+#define CONN(name, type, eq) \
+    { name, type, WS_EQ_##eq, true, false, W_POLL, T(CONNECT) }
+#define DISCONN(name, type, eq) \
+    { name, type, WS_EQ_##eq, false, false, W_POLL, T(DISCONNECT) }
+
+/* Exact Event strings. Anything else starting with "ERROR" is WS_EVT_ERROR.
+ * After adding, removing or renaming a row, re-run generate_ws_event_hash.py
+ * (test_ws_event fails until the hash table matches). */
+static const ws_event_info_t k_event_info[] = {
+    EV("IMAGE-SAVE",                 WS_EVT_IMAGE_SAVE,            true,  W_UI | W_POLL, 0),
+    EV("FILTERWHEEL-CHANGED",        WS_EVT_FILTERWHEEL_CHANGED,   true,  W_UI,          0),
+    EV("SEQUENCE-FINISHED",          WS_EVT_SEQUENCE_FINISHED,     false, W_UI | W_POLL, T(SEQUENCE)),
+    EV("SEQUENCE-STARTING",          WS_EVT_SEQUENCE_STARTING,     false, W_UI | W_POLL, T(SEQUENCE)),
+    EV("GUIDER-DITHER",              WS_EVT_GUIDER_DITHER,         false, W_UI,          0),
+    EV("GUIDER-START",               WS_EVT_GUIDER_START,          false, W_UI,          0),
+    EV("TS-NEWTARGETSTART",          WS_EVT_TS_NEWTARGETSTART,     true,  W_UI | W_POLL, 0),
+    EV("AUTOFOCUS-STARTING",         WS_EVT_AUTOFOCUS_STARTING,    false, W_UI,          0),
+    EV("AUTOFOCUS-FINISHED",         WS_EVT_AUTOFOCUS_FINISHED,    false, W_UI,          T(AUTOFOCUS)),
+    EV("AUTOFOCUS-POINT-ADDED",      WS_EVT_AUTOFOCUS_POINT_ADDED, true,  W_UI,          0),
+    EV("ROTATOR-MOVED",              WS_EVT_ROTATOR_MOVED,         true,  W_UI,          0),
+    EV("ROTATOR-MOVED-MECHANICAL",   WS_EVT_ROTATOR_MOVED,         true,  W_UI,          0),
+    EV("SAFETY-CHANGED",             WS_EVT_SAFETY_CHANGED,        true,  W_UI,          T(SAFETY)),
+    EV("TS-WAITSTART",               WS_EVT_TS_WAITSTART,          true,  W_UI,          T(SEQUENCE)),
+    EV("MOUNT-BEFORE-FLIP",          WS_EVT_MOUNT_BEFORE_FLIP,     false, W_UI,          0),
+    EV("MOUNT-AFTER-FLIP",           WS_EVT_MOUNT_AFTER_FLIP,      false, W_UI | W_POLL, T(FLIP)),
+    EV("GUIDER-STOP",                WS_EVT_GUIDER_STOP,           false, W_UI,          T(GUIDER)),
+    EV("PROFILE-CHANGED",            WS_EVT_PROFILE_CHANGED,       false, W_UI | W_POLL, T(PROFILE)),
+    EV("AUTOFOCUS-FAILED",           WS_EVT_AUTOFOCUS_FAILED,      false, W_UI,          T(AUTOFOCUS) | T(ERRORS)),
+    EV("ERROR-AF",                   WS_EVT_AUTOFOCUS_FAILED,      false, W_UI,          T(AUTOFOCUS) | T(ERRORS)),
+    CONN("CAMERA-CONNECTED",         WS_EVT_CAMERA_CONNECTED,      CAMERA),
+    DISCONN("CAMERA-DISCONNECTED",   WS_EVT_CAMERA_DISCONNECTED,   CAMERA),
+    EV("MOUNT-SLEWING",              WS_EVT_MOUNT_SLEWING,         false, W_POLL,        T(MOUNT)),
+    EV("MOUNT-PARKED",               WS_EVT_MOUNT_PARKED,          false, W_POLL,        T(MOUNT)),
+    EV("MOUNT-HOMED",                WS_EVT_MOUNT_HOMED,           false, W_POLL,        T(MOUNT)),
+    EV("MOUNT-TRACKING-ON",          WS_EVT_MOUNT_TRACKING_ON,     false, W_POLL,        T(MOUNT)),
+    EV("MOUNT-TRACKING-OFF",         WS_EVT_MOUNT_TRACKING_OFF,    false, W_POLL,        T(MOUNT)),
+    CONN("GUIDER-CONNECTED",         WS_EVT_GUIDER_CONNECTED,      GUIDER),
+    DISCONN("GUIDER-DISCONNECTED",   WS_EVT_GUIDER_DISCONNECTED,   GUIDER),
+    CONN("MOUNT-CONNECTED",          WS_EVT_MOUNT_CONNECTED,       MOUNT),
+    DISCONN("MOUNT-DISCONNECTED",    WS_EVT_MOUNT_DISCONNECTED,    MOUNT),
+    EV("MOUNT-UNPARKED",             WS_EVT_MOUNT_UNPARKED,        false, W_POLL,        T(MOUNT)),
+    CONN("FOCUSER-CONNECTED",        WS_EVT_FOCUSER_CONNECTED,     FOCUSER),
+    DISCONN("FOCUSER-DISCONNECTED",  WS_EVT_FOCUSER_DISCONNECTED,  FOCUSER),
+    CONN("FILTERWHEEL-CONNECTED",    WS_EVT_FILTERWHEEL_CONNECTED, FILTERWHEEL),
+    DISCONN("FILTERWHEEL-DISCONNECTED", WS_EVT_FILTERWHEEL_DISCONNECTED, FILTERWHEEL),
+    CONN("ROTATOR-CONNECTED",        WS_EVT_ROTATOR_CONNECTED,     ROTATOR),
+    DISCONN("ROTATOR-DISCONNECTED",  WS_EVT_ROTATOR_DISCONNECTED,  ROTATOR),
+    CONN("SAFETY-CONNECTED",         WS_EVT_SAFETY_CONNECTED,      SAFETY),
+    DISCONN("SAFETY-DISCONNECTED",   WS_EVT_SAFETY_DISCONNECTED,   SAFETY),
+    CONN("DOME-CONNECTED",           WS_EVT_DOME_CONNECTED,        DOME),
+    DISCONN("DOME-DISCONNECTED",     WS_EVT_DOME_DISCONNECTED,     DOME),
+    EV("DOME-SHUTTER-OPENED",        WS_EVT_DOME_SHUTTER_OPENED,   false, 0,             T(DOME)),
+    EV("DOME-SHUTTER-CLOSED",        WS_EVT_DOME_SHUTTER_CLOSED,   false, 0,             T(DOME)),
+    CONN("FLAT-CONNECTED",           WS_EVT_FLAT_CONNECTED,        FLAT),
+    DISCONN("FLAT-DISCONNECTED",     WS_EVT_FLAT_DISCONNECTED,     FLAT),
+    EV("FLAT-LIGHT-TOGGLED",         WS_EVT_FLAT_LIGHT_TOGGLED,    false, 0,             T(FLAT)),
+    EV("FLAT-COVER-OPENED",          WS_EVT_FLAT_COVER_OPENED,     false, 0,             T(FLAT)),
+    EV("FLAT-COVER-CLOSED",          WS_EVT_FLAT_COVER_CLOSED,     false, 0,             T(FLAT)),
+    CONN("SWITCH-CONNECTED",         WS_EVT_SWITCH_CONNECTED,      SWITCH),
+    DISCONN("SWITCH-DISCONNECTED",   WS_EVT_SWITCH_DISCONNECTED,   SWITCH),
+    CONN("WEATHER-CONNECTED",        WS_EVT_WEATHER_CONNECTED,     WEATHER),
+    DISCONN("WEATHER-DISCONNECTED",  WS_EVT_WEATHER_DISCONNECTED,  WEATHER),
+    EV("CAMERA-DOWNLOAD-TIMEOUT",    WS_EVT_CAMERA_DOWNLOAD_TIMEOUT, false, 0,           T(DISCONNECT) | T(ERRORS)),
+    EV("SEQUENCE-ENTITY-FAILED",     WS_EVT_SEQUENCE_ENTITY_FAILED,  true,  0,           T(SEQUENCE) | T(ERRORS)),
+};
+
+/* Fallbacks: the ERROR* family (toast + log only), and anything unrecognised,
+ * which wakes both tasks so a poll picks up whatever it changed. */
+static const ws_event_info_t k_error_info   = EV("ERROR*", WS_EVT_ERROR, false, 0, T(ERRORS));
+static const ws_event_info_t k_unknown_info = EV("", WS_EVT_UNKNOWN, false, W_UI | W_POLL, 0);
+
+#undef EV
+#undef CONN
+#undef DISCONN
+#undef T
+#undef W_UI
+#undef W_POLL
+
+/* k_event_slots[], WS_EVENT_HASH_SEED and WS_EVENT_HASH_BITS. */
+#include "ws_event_hash.h"
+
+#define EVENT_COUNT (sizeof(k_event_info) / sizeof(k_event_info[0]))
+_Static_assert(EVENT_COUNT < 255, "k_event_slots stores index + 1 in a uint8_t");
+
+/* FNV-1a from a generator-chosen seed; the top WS_EVENT_HASH_BITS bits pick
+ * the slot. The seed makes the mapping collision-free for k_event_info. */
+static uint32_t event_slot(const char *name) {
+    uint32_t h = WS_EVENT_HASH_SEED;
+    for (const unsigned char *p = (const unsigned char *)name; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h >> (32 - WS_EVENT_HASH_BITS);
+}
+
+const ws_event_info_t *ws_event_lookup(const char *name) {
+    if (!name) return &k_unknown_info;
+    uint8_t idx = k_event_slots[event_slot(name)];
+    if (idx != 0 && idx <= EVENT_COUNT && strcmp(name, k_event_info[idx - 1].name) == 0) {
+        return &k_event_info[idx - 1];
+    }
+    if (strncmp(name, "ERROR", 5) == 0) return &k_error_info;
+    return &k_unknown_info;
+}
+
+ws_event_type_t ws_event_classify(const char *name) {
+    return ws_event_lookup(name)->type;
+}
+
+const ws_event_info_t *ws_event_info_table(size_t *count) {
+    if (count) *count = EVENT_COUNT;
+    return k_event_info;
+}
+
+const char *ws_event_type_name(ws_event_type_t type) {
+    for (size_t i = 0; i < EVENT_COUNT; i++) {
+        if (k_event_info[i].type == type) return k_event_info[i].name;
+    }
+    return type == WS_EVT_ERROR ? k_error_info.name : "UNKNOWN";
+}
+
+bool ws_event_type_needs_payload(ws_event_type_t type) {
+    for (size_t i = 0; i < EVENT_COUNT; i++) {
+        if (k_event_info[i].type == type) return k_event_info[i].needs_payload;
+    }
+    return false;
+}
+
+/* ── Field capture ── */
+
+typedef enum { K_FLOAT, K_INT, K_STR, K_BOOL } field_kind_t;
+
+typedef struct {
+    const char *key;
+    uint32_t bit;
+    field_kind_t kind;
+    size_t offset;      /* into ws_event_t */
+    size_t size;        /* K_STR: destination capacity */
+} field_spec_t;
+
+#define STAT(k, bit, kind, member) \
+    { k, bit, kind, offsetof(ws_event_t, stats.member), sizeof(((ws_event_t *)0)->stats.member) }
+#define TOP(k, bit, kind, member) \
+    { k, bit, kind, offsetof(ws_event_t, member), sizeof(((ws_event_t *)0)->member) }
+
+/* Response.ImageStatistics.<key> */
+static const field_spec_t k_stats_fields[] = {
+    STAT("HFR",           WS_F_HFR,          K_FLOAT, hfr),
+    STAT("Stars",         WS_F_STARS,        K_INT,   stars),
+    STAT("ExposureTime",  WS_F_EXPOSURE,     K_FLOAT, exposure_time),
+    STAT("HFRStDev",      WS_F_HFR_STDEV,    K_FLOAT, hfr_stdev),
+    STAT("Mean",          WS_F_MEAN,         K_FLOAT, mean),
+    STAT("Median",        WS_F_MEDIAN,       K_FLOAT, median),
+    STAT("StDev",         WS_F_STDEV,        K_FLOAT, stdev),
+    STAT("Min",           WS_F_MIN,          K_INT,   min_val),
+    STAT("Max",           WS_F_MAX,          K_INT,   max_val),
+    STAT("Gain",          WS_F_GAIN,         K_INT,   gain),
+    STAT("Offset",        WS_F_OFFSET,       K_INT,   offset),
+    STAT("Temperature",   WS_F_TEMPERATURE,  K_FLOAT, temperature),
+    STAT("FocalLength",   WS_F_FOCAL_LENGTH, K_INT,   focal_length),
+    STAT("ImageType",     WS_F_IMAGE_TYPE,   K_STR,   image_type),
+    STAT("TargetName",    WS_F_STATS_TARGET, K_STR,   target_name),
+    STAT("TelescopeName", WS_F_TELESCOPE,    K_STR,   telescope_name),
+    STAT("Filter",        WS_F_FILTER,       K_STR,   filter),
+    STAT("CameraName",    WS_F_CAMERA,       K_STR,   camera_name),
+    STAT("Date",          WS_F_DATE,         K_STR,   date),
+    STAT("Filename",      WS_F_FILENAME,     K_STR,   filename),
+};
+
+/* Response.<key> */
+static const field_spec_t k_top_fields[] = {
+    TOP("TargetName",    WS_F_TARGET_NAME, K_STR,   target_name),
+    TOP("Position",      WS_F_POSITION,    K_INT,   position),
+    TOP("HFR",           WS_F_AF_HFR,      K_FLOAT, af_hfr),
+    TOP("To",            WS_F_TO,          K_FLOAT, to),
+    TOP("IsSafe",        WS_F_IS_SAFE,     K_BOOL,  is_safe),
+    TOP("WaitStartTime", WS_F_WAIT_START,  K_STR,   wait_start),
+    TOP("Entity",        WS_F_ENTITY,      K_STR,   entity),
+    TOP("Error",         WS_F_ERROR,       K_STR,   error),
+};
+
+static const field_spec_t k_new_name_field = TOP("Name", WS_F_NEW_NAME, K_STR, new_name);
+
+#undef STAT
+#undef TOP
+
+static void store_field(ws_event_t *ev, const field_spec_t *f, const json_stream_value_t *v) {
+    char *dst = (char *)ev + f->offset;
+    switch (f->kind) {
+    case K_FLOAT:
+        if (v->type != JSON_STREAM_NUMBER) return;
+        *(float *)dst = (float)v->num;
+        break;
+    case K_INT:
+        if (v->type != JSON_STREAM_NUMBER) return;
+        *(int *)dst = json_stream_value_int(v);
+        break;
+    case K_STR:
+        if (v->type != JSON_STREAM_STRING) return;
+        snprintf(dst, f->size, "%s", v->str);
+        break;
+    case K_BOOL:
+        if (v->type != JSON_STREAM_BOOL) return;
+        *(bool *)dst = v->boolean;
+        break;
+    }
+    ev->fields |= f->bit;
+}
+
+static const field_spec_t *find_field(const field_spec_t *tab, size_t n, const char *key) {
+    for (size_t i = 0; i < n; i++) {
+        if (strcmp(tab[i].key, key) == 0) return &tab[i];
+    }
+    return NULL;
+}
+
+static bool on_json(json_stream_t *js, json_stream_event_t jev,
+                    const json_stream_value_t *v, void *ctx) {
+    ws_event_decoder_t *d = (ws_event_decoder_t *)ctx;
+    ws_event_t *ev = &d->ev;
+
+    int depth = json_stream_depth(js);
+    if (depth < 2) return true;
+    const char *root = json_stream_key_at(js, 0);
+    if (!root || strcmp(root, "Response") != 0) return true;
+    const char *k1 = json_stream_key_at(js, 1);
+    if (!k1) return true;
+
+    if (jev == JSON_STREAM_EV_OBJECT_BEGIN) {
+        if (depth == 2 && strcmp(k1, "ImageStatistics") == 0) ev->fields |= WS_F_STATS;
+        return true;
+    }
+    if (jev != JSON_STREAM_EV_VALUE) return true;
+
+    if (depth == 2) {
+        if (strcmp(k1, "Event") == 0) {
+            if (v->type != JSON_STREAM_STRING) return true;
+            snprintf(ev->name, sizeof(ev->name), "%s", v->str);
+            ev->info = ws_event_lookup(ev->name);
+            ev->type = ev->info->type;
+            d->payload_needed = ev->info->needs_payload;
+            if (!d->payload_needed) {
+                /* Classified and nothing else to read: stop here. */
+                d->status = WS_EVENT_READY;
+                return false;
+            }
+            return true;
+        }
+        const field_spec_t *f = find_field(k_top_fields,
+                                           sizeof(k_top_fields) / sizeof(k_top_fields[0]), k1);
+        if (f) store_field(ev, f, v);
+        return true;
+    }
+
+    if (depth == 3) {
+        const char *k2 = json_stream_key_at(js, 2);
+        if (!k2) return true;
+        if (strcmp(k1, "ImageStatistics") == 0) {
+            const field_spec_t *f = find_field(k_stats_fields,
+                                               sizeof(k_stats_fields) / sizeof(k_stats_fields[0]),
+                                               k2);
+            if (f) store_field(ev, f, v);
+        } else if (strcmp(k1, "New") == 0 && strcmp(k2, "Name") == 0) {
+            store_field(ev, &k_new_name_field, v);
+        }
+    }
+    return true;
+}
+
+void ws_event_decoder_begin(ws_event_decoder_t *d) {
+    memset(&d->ev, 0, sizeof(d->ev));
+    d->ev.info = &k_unknown_info;
+    d->status = WS_EVENT_MORE;
+    d->payload_needed = false;
+    json_stream_init(&d->js, on_json, d);
+}
+
+ws_event_status_t ws_event_decoder_feed(ws_event_decoder_t *d, const char *data, size_t len) {
+    if (d->status != WS_EVENT_MORE) return d->status;
+    if (!json_stream_feed(&d->js, data, len) && d->status == WS_EVENT_MORE) {
+        d->status = WS_EVENT_INVALID;
+    }
+    return d->status;
+}
+
+ws_event_status_t ws_event_decoder_finish(ws_event_decoder_t *d) {
+    if (d->status != WS_EVENT_MORE) return d->status;
+    bool ok = json_stream_finish(&d->js);
+    d->status = (ok && d->ev.name[0] != '\0') ? WS_EVENT_READY : WS_EVENT_INVALID;
+    return d->status;
+}
@@ -0,0 +1,273 @@
+/*
+ * ws_event.h - Pure, host-testable incremental decoder for NINA Advanced API
+ * WebSocket events ({"Response":{"Event":"IMAGE-SAVE",...},...}).
+ *
+ * Built on json_stream: each WebSocket fragment is fed straight from the
+ * esp_websocket_client DATA event, so a fragmented message is never
+ * reassembled and no cJSON DOM is built. The decoder keeps one fixed
+ * ws_event_t holding the event type plus every field an event handler in
+ * nina_websocket.c reads; fields are captured by path as they stream past,
+ * whichever order NINA serialises them in.
+ *
+ * The event is classified as soon as Response.Event arrives, through a
+ * perfect-hash table (ws_event_hash.h, generated by generate_ws_event_hash.py)
+ * that costs one hash and one strcmp whatever the name. Each table row also
+ * carries the metadata the dispatcher needs (ws_event_info_t): which
+ * equipment a connect/disconnect event is about, which toast categories
+ * enable it, and which tasks to wake. Events whose handlers read no payload
+ * (the large majority -- connect/disconnect, mount, dome, flat, guider state)
+ * are reported ready right there, so the remaining bytes of the message are
+ * skipped without being parsed.
+ *
+ * No ESP-IDF dependencies; standard C only so the module can be compiled
+ * unmodified into the host test suite (test/host).
+ */
+
+#ifndef WS_EVENT_H
+#define WS_EVENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "json_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WS_EVENT_NAME_MAX 48
+
+typedef enum {
+    WS_EVT_UNKNOWN = 0,
+    WS_EVT_IMAGE_SAVE,
+    WS_EVT_FILTERWHEEL_CHANGED,
+    WS_EVT_SEQUENCE_FINISHED,
+    WS_EVT_SEQUENCE_STARTING,
+    WS_EVT_GUIDER_DITHER,
+    WS_EVT_GUIDER_START,
+    WS_EVT_TS_NEWTARGETSTART,
+    WS_EVT_AUTOFOCUS_STARTING,
+    WS_EVT_AUTOFOCUS_FINISHED,
+    WS_EVT_AUTOFOCUS_POINT_ADDED,
+    WS_EVT_ROTATOR_MOVED,           /* ROTATOR-MOVED and ROTATOR-MOVED-MECHANICAL */
+    WS_EVT_SAFETY_CHANGED,
+    WS_EVT_TS_WAITSTART,
+    WS_EVT_MOUNT_BEFORE_FLIP,
+    WS_EVT_MOUNT_AFTER_FLIP,
+    WS_EVT_GUIDER_STOP,
+    WS_EVT_PROFILE_CHANGED,
+    WS_EVT_AUTOFOCUS_FAILED,        /* AUTOFOCUS-FAILED and ERROR-AF */
+    WS_EVT_CAMERA_CONNECTED,
+    WS_EVT_CAMERA_DISCONNECTED,
+    WS_EVT_MOUNT_SLEWING,
+    WS_EVT_MOUNT_PARKED,
+    WS_EVT_MOUNT_HOMED,
+    WS_EVT_MOUNT_TRACKING_ON,
+    WS_EVT_MOUNT_TRACKING_OFF,
+    WS_EVT_ERROR,                   /* any other ERROR* event */
+    WS_EVT_GUIDER_CONNECTED,
+    WS_EVT_GUIDER_DISCONNECTED,
+    WS_EVT_MOUNT_CONNECTED,
+    WS_EVT_MOUNT_DISCONNECTED,
+    WS_EVT_MOUNT_UNPARKED,
+    WS_EVT_FOCUSER_CONNECTED,
+    WS_EVT_FOCUSER_DISCONNECTED,
+    WS_EVT_FILTERWHEEL_CONNECTED,
+    WS_EVT_FILTERWHEEL_DISCONNECTED,
+    WS_EVT_ROTATOR_CONNECTED,
+    WS_EVT_ROTATOR_DISCONNECTED,
+    WS_EVT_SAFETY_CONNECTED,
+    WS_EVT_SAFETY_DISCONNECTED,
+    WS_EVT_DOME_CONNECTED,
+    WS_EVT_DOME_DISCONNECTED,
+    WS_EVT_DOME_SHUTTER_OPENED,
+    WS_EVT_DOME_SHUTTER_CLOSED,
+    WS_EVT_FLAT_CONNECTED,
+    WS_EVT_FLAT_DISCONNECTED,
+    WS_EVT_FLAT_LIGHT_TOGGLED,
+    WS_EVT_FLAT_COVER_OPENED,
+    WS_EVT_FLAT_COVER_CLOSED,
+    WS_EVT_SWITCH_CONNECTED,
+    WS_EVT_SWITCH_DISCONNECTED,
+    WS_EVT_WEATHER_CONNECTED,
+    WS_EVT_WEATHER_DISCONNECTED,
+    WS_EVT_CAMERA_DOWNLOAD_TIMEOUT,
+    WS_EVT_SEQUENCE_ENTITY_FAILED,
+    WS_EVT_COUNT
+} ws_event_type_t;
+
+/* Equipment a CONNECTED/DISCONNECTED event refers to (bit index in the
+ * connect-aggregation masks of nina_websocket.c). */
+typedef enum {
+    WS_EQ_NONE = -1,
+    WS_EQ_CAMERA = 0, WS_EQ_MOUNT, WS_EQ_GUIDER, WS_EQ_FOCUSER, WS_EQ_FILTERWHEEL,
+    WS_EQ_ROTATOR, WS_EQ_SAFETY, WS_EQ_DOME, WS_EQ_FLAT, WS_EQ_SWITCH, WS_EQ_WEATHER,
+    WS_EQ_COUNT
+} ws_equipment_t;
+
+/* Toast categories: bit index in app_config_t.toast_notify_mask (the
+ * notify_cat_N switches on the Behavior tab). */
+enum {
+    WS_TOAST_CONNECT = 0,
+    WS_TOAST_DISCONNECT,
+    WS_TOAST_SEQUENCE,
+    WS_TOAST_AUTOFOCUS,
+    WS_TOAST_MOUNT,
+    WS_TOAST_FLIP,
+    WS_TOAST_GUIDER,
+    WS_TOAST_SAFETY,
+    WS_TOAST_ERRORS,
+    WS_TOAST_PROFILE,
+    WS_TOAST_DOME,
+    WS_TOAST_FLAT,
+};
+#define WS_TOAST_BIT(cat) (1u << (cat))
+
+/* ws_event_info_t.wake: who to wake once the event is handled. */
+enum {
+    WS_WAKE_UI   = 1u << 0,   /* data_update_task: shared state changed, redraw */
+    WS_WAKE_POLL = 1u << 1,   /* instance poll task: re-poll what the event invalidated */
+};
+
+/* Per-event metadata. One row per Event string (aliases such as
+ * ROTATOR-MOVED-MECHANICAL have their own row with the same type). */
+typedef struct {
+    const char     *name;           /* Event string ("ERROR*" / "" for the fallbacks) */
+    ws_event_type_t type;
+    int8_t          equipment;      /* ws_equipment_t, WS_EQ_NONE if not a (dis)connect */
+    bool            connected;      /* equipment events: CONNECTED (true) or DISCONNECTED */
+    bool            needs_payload;  /* handler reads payload fields */
+    uint8_t         wake;           /* WS_WAKE_* */
+    uint16_t        toast_mask;     /* WS_TOAST_BIT()s; a toast shows if any is enabled */
+} ws_event_info_t;
+
+/* ws_event_t.fields bits: which payload values were present (numbers must be
+ * JSON numbers, strings JSON strings). */
+enum {
+    WS_F_STATS          = 1u << 0,   /* Response.ImageStatistics object */
+    WS_F_HFR            = 1u << 1,   /* ImageStatistics.* from here ... */
+    WS_F_STARS          = 1u << 2,
+    WS_F_EXPOSURE       = 1u << 3,
+    WS_F_HFR_STDEV      = 1u << 4,
+    WS_F_MEAN           = 1u << 5,
+    WS_F_MEDIAN         = 1u << 6,
+    WS_F_STDEV          = 1u << 7,
+    WS_F_MIN            = 1u << 8,
+    WS_F_MAX            = 1u << 9,
+    WS_F_GAIN           = 1u << 10,
+    WS_F_OFFSET         = 1u << 11,
+    WS_F_TEMPERATURE    = 1u << 12,
+    WS_F_FOCAL_LENGTH   = 1u << 13,
+    WS_F_IMAGE_TYPE     = 1u << 14,
+    WS_F_STATS_TARGET   = 1u << 15,
+    WS_F_TELESCOPE      = 1u << 16,
+    WS_F_FILTER         = 1u << 17,
+    WS_F_CAMERA         = 1u << 18,
+    WS_F_DATE           = 1u << 19,
+    WS_F_FILENAME       = 1u << 20,  /* ... to here */
+    WS_F_NEW_NAME       = 1u << 21,  /* Response.New.Name */
+    WS_F_TARGET_NAME    = 1u << 22,  /* Response.TargetName */
+    WS_F_POSITION       = 1u << 23,  /* Response.Position */
+    WS_F_AF_HFR         = 1u << 24,  /* Response.HFR */
+    WS_F_TO             = 1u << 25,  /* Response.To */
+    WS_F_IS_SAFE        = 1u << 26,  /* Response.IsSafe (bool) */
+    WS_F_WAIT_START     = 1u << 27,  /* Response.WaitStartTime */
+    WS_F_ENTITY         = 1u << 28,  /* Response.Entity */
+    WS_F_ERROR          = 1u << 29,  /* Response.Error */
+};
+
+/* Fields of Response.ImageStatistics (IMAGE-SAVE). String sizes match the
+ * nina_client_t / imagestats_detail_data_t fields they are copied into. */
+typedef struct {
+    float hfr;
+    int   stars;
+    float exposure_time;
+    float hfr_stdev;
+    float mean;
+    float median;
+    float stdev;
+    int   min_val;
+    int   max_val;
+    int   gain;
+    int   offset;
+    float temperature;
+    int   focal_length;
+    char  image_type[16];
+    char  target_name[64];
+    char  telescope_name[64];
+    char  filter[32];
+    char  camera_name[64];
+    char  date[32];
+    char  filename[128];
+} ws_event_stats_t;
+
+typedef struct {
+    ws_event_type_t type;
+    const ws_event_info_t *info;    /* metadata for type; set with it */
+    char name[WS_EVENT_NAME_MAX];   /* Response.Event as sent */
+    uint32_t fields;                /* WS_F_* present */
+    ws_event_stats_t stats;         /* IMAGE-SAVE */
+    char  new_name[32];             /* FILTERWHEEL-CHANGED */
+    char  target_name[64];          /* TS-NEWTARGETSTART */
+    int   position;                 /* AUTOFOCUS-POINT-ADDED */
+    float af_hfr;
+    float to;                       /* ROTATOR-MOVED* */
+    bool  is_safe;                  /* SAFETY-CHANGED */
+    char  wait_start[40];           /* TS-WAITSTART */
+    char  entity[64];               /* SEQUENCE-ENTITY-FAILED */
+    char  error[128];
+} ws_event_t;
+
+typedef enum {
+    WS_EVENT_MORE,      /* need more bytes */
+    WS_EVENT_READY,     /* decoder->ev is complete; later bytes are ignored */
+    WS_EVENT_INVALID,   /* malformed JSON or no Response.Event */
+} ws_event_status_t;
+
+/* Treat as opaque; exposed only so callers can own the storage. */
+typedef struct {
+    json_stream_t js;
+    ws_event_t ev;
+    ws_event_status_t status;
+    bool payload_needed;    /* classified type reads payload fields */
+} ws_event_decoder_t;
+
+/* Metadata for an Event string: the exact name's row, else the ERROR* family
+ * row, else the unknown-event row (type WS_EVT_UNKNOWN). Never NULL. */
+const ws_event_info_t *ws_event_lookup(const char *name);
+
+/* Map an Event string to its type; ws_event_lookup(name)->type. */
+ws_event_type_t ws_event_classify(const char *name);
+
+/* Every exact-name row, in table order (for tests). */
+const ws_event_info_t *ws_event_info_table(size_t *count);
+
+/* Display name for @p type (perf reports): its first Event string in table
+ * order, "ERROR*" for the generic error family, "UNKNOWN" otherwise. */
+const char *ws_event_type_name(ws_event_type_t type);
+
+/* True when the handler for @p type reads payload fields, i.e. the decoder
+ * must parse the whole message rather than stop at Response.Event. */
+bool ws_event_type_needs_payload(ws_event_type_t type);
+
+/* Start decoding a new message (discarding any partial one). */
+void ws_event_decoder_begin(ws_event_decoder_t *d);
+
+/* Feed the next fragment of the current message. */
+ws_event_status_t ws_event_decoder_feed(ws_event_decoder_t *d, const char *data, size_t len);
+
+/* The message is complete: READY if a well-formed event was decoded (or
+ * already reported ready), else INVALID. */
+ws_event_status_t ws_event_decoder_finish(ws_event_decoder_t *d);
+
+/* Decoded event; valid once feed/finish returned WS_EVENT_READY. */
+static inline const ws_event_t *ws_event_decoder_event(const ws_event_decoder_t *d) {
+    return &d->ev;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WS_EVENT_H */
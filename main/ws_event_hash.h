@@ -0,0 +1,24 @@
+/* Generated by generate_ws_event_hash.py from k_event_info[] in ws_event.c
+ * -- do not edit. Private to ws_event.c. */
+
+#ifndef WS_EVENT_HASH_H
+#define WS_EVENT_HASH_H
+
+#include <stdint.h>
+
+#define WS_EVENT_HASH_SEED 0x81255c5eu
+#define WS_EVENT_HASH_BITS 7
+
+/* 55 events in 128 slots: slot -> k_event_info index + 1, 0 = empty. */
+static const uint8_t k_event_slots[1u << WS_EVENT_HASH_BITS] = {
+     0, 49, 44, 43, 46, 45,  0,  0,  0, 48,  0,  0, 39, 31,  9,  0,
+    54,  0,  0,  0,  0,  0,  3,  0, 12,  0,  0,  0,  0,  0,  6,  0,
+     0,  0,  0, 21, 32,  0,  5,  0,  0,  0, 13, 17, 55, 52, 37, 41,
+    33, 47,  0,  0,  0, 42,  0, 15, 35,  0, 28,  0, 40, 50,  0, 30,
+     7,  0,  0, 19, 29,  8, 10,  0,  0,  4,  0,  0,  0,  0, 27, 34,
+     2,  0,  0,  0,  0,  0, 38, 16, 14,  0,  0, 23,  0,  0, 51,  0,
+    53,  0,  0,  0, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,
+    18, 25, 22, 24,  1,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0, 20,
+};
+
+#endif /* WS_EVENT_HASH_H */
@@ -0,0 +1,277 @@
+/* Benchmark for main/ui/font_glyph_cache.c — the compressed display fonts
+ * (main/ui/lv_font_{playfair_228,montserrat_64,playfair_90,warning_128,
+ * overpass_27}.c, compiled unmodified against the LVGL subset in
+ * bench/font/lvgl.h) drawn through their get_glyph_bitmap hook:
+ *
+ *   plain   LVGL's --no-compress path: expand packed 4 bpp to A8 on every
+ *           draw (the bitmap is rebuilt from the decoded glyph, so this is
+ *           what the fonts cost before they were compressed)
+ *   cold    first draw of a glyph: RLE decode into the cache, then copy
+ *   hit     every later draw: cache lookup and a row copy
+ *
+ * It also prints each font's glyph bitmap bytes plain vs compressed -- the
+ * flash (and OTA image) saving -- and checks that every glyph's compressed
+ * stream ends exactly where the next one starts, that the hook's output
+ * matches a direct decode, and that it never fell back to LVGL's decoder.
+ * Host timings are only indicative: the device decodes from flash into
+ * PSRAM on a 32-bit in-order core.
+ *
+ * Usage: bench_glyph_cache [iterations]
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(bench_glyph_cache ...)).
+ */
+
+#include "font_glyph_cache.h"
+#include "glyph_rle.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+extern const lv_font_t lv_font_playfair_228;
+extern const lv_font_t lv_font_montserrat_64;
+extern const lv_font_t lv_font_playfair_90;
+extern const lv_font_t lv_font_warning_128;
+extern const lv_font_t lv_font_overpass_27;
+
+static const struct {
+    const char *name;
+    const lv_font_t *font;
+} k_fonts[] = {
+    { "playfair_228",  &lv_font_playfair_228 },
+    { "montserrat_64", &lv_font_montserrat_64 },
+    { "playfair_90",   &lv_font_playfair_90 },
+    { "warning_128",   &lv_font_warning_128 },
+    { "overpass_27",   &lv_font_overpass_27 },
+};
+#define FONT_COUNT ((int)(sizeof(k_fonts) / sizeof(k_fonts[0])))
+
+#define MAX_GLYPH_PX (256 * 256)
+
+static long s_fallbacks;
+
+/* LVGL's own fmt_txt entry points, referenced by the font descriptors. */
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t unicode_letter, uint32_t unicode_letter_next) {
+    (void)font;
+    (void)dsc_out;
+    (void)unicode_letter;
+    (void)unicode_letter_next;
+    return false;
+}
+
+const void *lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf) {
+    (void)g_dsc;
+    (void)draw_buf;
+    s_fallbacks++;
+    return NULL;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static const lv_font_fmt_txt_dsc_t *fmt(const lv_font_t *font) {
+    return (const lv_font_fmt_txt_dsc_t *)font->dsc;
+}
+
+/* One past the highest glyph id the cmaps reach (id 0 is reserved). */
+static uint32_t glyph_end(const lv_font_fmt_txt_dsc_t *fdsc) {
+    uint32_t end = 1;
+    for (uint32_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cm = &fdsc->cmaps[i];
+        uint32_t n = cm->list_length ? cm->list_length : cm->range_length;
+        if (cm->glyph_id_start + n > end) end = cm->glyph_id_start + n;
+    }
+    return end;
+}
+
+static size_t glyph_px(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t gid) {
+    return (size_t)fdsc->glyph_dsc[gid].box_w * fdsc->glyph_dsc[gid].box_h;
+}
+
+static const void *draw(const lv_font_t *font, uint32_t gid, lv_draw_buf_t *buf) {
+    const lv_font_fmt_txt_glyph_dsc_t *g = &fmt(font)->glyph_dsc[gid];
+    lv_font_glyph_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.resolved_font = font;
+    dsc.box_w = g->box_w;
+    dsc.box_h = g->box_h;
+    dsc.gid.index = gid;
+    return font->get_glyph_bitmap(&dsc, buf);
+}
+
+/* LVGL's plain 4 bpp path (lv_font_get_bitmap_fmt_txt, --no-compress). */
+static void expand_plain4(const uint8_t *in, uint8_t *out, uint16_t w, uint16_t h) {
+    static const uint8_t opa4[16] = {
+        0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+    };
+    uint32_t i = 0;
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++, i++) {
+            uint8_t b = in[i >> 1];
+            out[x] = opa4[(i & 1) ? (b & 0xF) : (b >> 4)];
+        }
+        out += w;
+    }
+}
+
+typedef struct {
+    uint32_t glyphs;
+    size_t px;
+    size_t plain_bytes;
+    size_t packed_bytes;
+    double plain_ns;
+    double cold_ns;
+    double hit_ns;
+} font_result_t;
+
+static int check_font(int f, font_result_t *r, uint8_t **plain, size_t *plain_off) {
+    const lv_font_t *font = k_fonts[f].font;
+    const lv_font_fmt_txt_dsc_t *fdsc = fmt(font);
+    uint32_t end = glyph_end(fdsc);
+    static uint8_t direct[MAX_GLYPH_PX];
+    static uint8_t hooked[MAX_GLYPH_PX];
+    lv_draw_buf_t buf = { .data = hooked };
+    int bad = 0;
+
+    memset(r, 0, sizeof(*r));
+    for (uint32_t gid = 1; gid < end; gid++) {
+        const lv_font_fmt_txt_glyph_dsc_t *g = &fdsc->glyph_dsc[gid];
+        size_t px = glyph_px(fdsc, gid);
+        plain_off[gid] = r->plain_bytes;
+        if (px == 0) continue;
+        if (px > MAX_GLYPH_PX || fdsc->bpp != 4) {
+            fprintf(stderr, "%s: glyph %u outside the bench limits\n", k_fonts[f].name, gid);
+            return 1;
+        }
+        size_t used = glyph_rle_decode(&fdsc->glyph_bitmap[g->bitmap_index], direct, g->box_w,
+                                       g->box_h, fdsc->bpp,
+                                       fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED);
+        /* The next non-empty glyph must start where this stream ended. */
+        for (uint32_t next = gid + 1; next < end; next++) {
+            if (glyph_px(fdsc, next) == 0) continue;
+            if (fdsc->glyph_dsc[next].bitmap_index != g->bitmap_index + used) {
+                fprintf(stderr, "%s: glyph %u stream is %zu bytes, next glyph at +%u\n",
+                        k_fonts[f].name, gid, used,
+                        (unsigned)(fdsc->glyph_dsc[next].bitmap_index - g->bitmap_index));
+                bad++;
+            }
+            break;
+        }
+        if (draw(font, gid, &buf) != &buf || memcmp(direct, hooked, px) != 0) {
+            fprintf(stderr, "%s: glyph %u hook output differs from decode\n", k_fonts[f].name, gid);
+            bad++;
+        }
+
+        /* Rebuild the --no-compress bitmap for the plain baseline. */
+        size_t bytes = (px + 1) / 2;
+        *plain = realloc(*plain, r->plain_bytes + bytes);
+        uint8_t *p = *plain + r->plain_bytes;
+        memset(p, 0, bytes);
+        for (size_t i = 0; i < px; i++) {
+            uint8_t v = (uint8_t)(direct[i] / 17);
+            p[i >> 1] |= (uint8_t)((i & 1) ? v : (v << 4));
+        }
+        r->glyphs++;
+        r->px += px;
+        r->plain_bytes += bytes;
+        r->packed_bytes += used;
+    }
+    return bad;
+}
+
+static void time_font(int f, int iters, font_result_t *r, const uint8_t *plain,
+                      const size_t *plain_off) {
+    const lv_font_t *font = k_fonts[f].font;
+    const lv_font_fmt_txt_dsc_t *fdsc = fmt(font);
+    uint32_t end = glyph_end(fdsc);
+    static uint8_t out[MAX_GLYPH_PX];
+    lv_draw_buf_t buf = { .data = out };
+    double t0;
+
+    t0 = now_ns();
+    for (int it = 0; it < iters; it++) {
+        for (uint32_t gid = 1; gid < end; gid++) {
+            if (glyph_px(fdsc, gid) == 0) continue;
+            expand_plain4(plain + plain_off[gid], out, fdsc->glyph_dsc[gid].box_w,
+                          fdsc->glyph_dsc[gid].box_h);
+        }
+    }
+    r->plain_ns = (now_ns() - t0) / ((double)iters * r->glyphs);
+
+    r->cold_ns = 0;
+    for (int it = 0; it < iters; it++) {
+        font_glyph_cache_clear();
+        t0 = now_ns();
+        for (uint32_t gid = 1; gid < end; gid++) {
+            if (glyph_px(fdsc, gid) == 0) continue;
+            draw(font, gid, &buf);
+        }
+        r->cold_ns += now_ns() - t0;
+    }
+    r->cold_ns /= (double)iters * r->glyphs;
+
+    t0 = now_ns();
+    for (int it = 0; it < iters; it++) {
+        for (uint32_t gid = 1; gid < end; gid++) {
+            if (glyph_px(fdsc, gid) == 0) continue;
+            draw(font, gid, &buf);
+        }
+    }
+    r->hit_ns = (now_ns() - t0) / ((double)iters * r->glyphs);
+}
+
+int main(int argc, char **argv) {
+    int iters = argc > 1 ? atoi(argv[1]) : 20;
+    if (iters < 1) iters = 1;
+    int bad = 0;
+
+    font_glyph_cache_init();
+
+    printf("bench_glyph_cache: %d iterations, cache budget %d KB\n\n", iters,
+           FONT_GLYPH_CACHE_BYTES / 1024);
+    printf("%-14s %6s %8s %10s %10s %6s %10s %10s %10s\n", "font", "glyphs", "avg px",
+           "plain B", "packed B", "ratio", "plain ns", "cold ns", "hit ns");
+
+    size_t total_plain = 0;
+    size_t total_packed = 0;
+    for (int f = 0; f < FONT_COUNT; f++) {
+        font_result_t r;
+        uint8_t *plain = NULL;
+        size_t *plain_off = calloc(glyph_end(fmt(k_fonts[f].font)), sizeof(size_t));
+
+        font_glyph_cache_clear();
+        bad += check_font(f, &r, &plain, plain_off);
+        time_font(f, iters, &r, plain, plain_off);
+        free(plain);
+        free(plain_off);
+
+        printf("%-14s %6u %8zu %10zu %10zu %5.1f%% %10.0f %10.0f %10.0f\n", k_fonts[f].name,
+               r.glyphs, r.px / r.glyphs, r.plain_bytes, r.packed_bytes,
+               100.0 * (double)r.packed_bytes / (double)r.plain_bytes, r.plain_ns, r.cold_ns,
+               r.hit_ns);
+        total_plain += r.plain_bytes;
+        total_packed += r.packed_bytes;
+    }
+
+    glyph_cache_stats_t st;
+    font_glyph_cache_get_stats(&st);
+    printf("\nglyph bitmaps: %zu -> %zu bytes (app image %+ld bytes)\n", total_plain, total_packed,
+           (long)total_packed - (long)total_plain);
+    printf("cache: %u hits, %u misses, %u evictions, %d glyphs / %zu KB resident\n", st.hits,
+           st.misses, st.evictions, st.entries, st.bytes_used / 1024);
+
+    if (s_fallbacks) {
+        fprintf(stderr, "%ld draws fell back to LVGL's decoder\n", s_fallbacks);
+        bad++;
+    }
+    if (bad) {
+        printf("\n%d FAILURE(S)\n", bad);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
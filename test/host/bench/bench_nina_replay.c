@@ -0,0 +1,337 @@
+/* Benchmark for the NINA poll pipeline — replays a recorded simulator
+ * session (test/host/fixtures/nina_session_fast.jsonl, written by
+ * record_nina_session.py from tests/simulator) through the unmodified
+ * nina_client.c, nina_api_fetchers.c, nina_sequence.c and nina_websocket.c.
+ * http_fetch is replaced by the recorded-response stand-in in
+ * bench/replay/replay_http.c; everything is counted by the force-included
+ * allocator in bench/replay/replay_alloc.h.
+ *
+ * Every pass walks the session one simulated second (tick) at a time, with
+ * the esp_timer clock pinned to the tick so the firmware's slow-poll and
+ * sequence cadences behave as on the device:
+ *
+ *   ws       WebSocket connected: the tick's recorded events are delivered
+ *            to nina_websocket.c's handler in 2048-byte DATA fragments, then
+ *            nina_client_poll() runs one cycle (bundled equipment/info).
+ *   no-ws    the same session with the WebSocket down: nina_client_poll()
+ *            also gates on the image count and catches the HFR store up.
+ *   fetcher  each public fetcher called on its own (one-shot, no pipelined
+ *            prefetch) against a separate nina_client_t.
+ *
+ * Per row it prints calls, us/call, heap allocations/call, bytes
+ * allocated/call and the worst peak heap above the live size at entry. The
+ * run fails on sanity breaks (never connected, no IMAGE-SAVE applied, a GET
+ * for a path the session never served), so the ctest pass doubles as an
+ * end-to-end smoke test of the poll pipeline.
+ *
+ * Usage: bench_nina_replay [passes] [fixture.jsonl]
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(bench_nina_replay ...)).
+ */
+
+#include "replay.h"
+#include "replay_alloc.h"
+#include "nina_client.h"
+#include "nina_api_fetchers.h"
+#include "nina_sequence.h"
+#include "nina_websocket.h"
+#include "nina_connection.h"
+#include "esp_timer.h"
+#include "cJSON.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef NINA_REPLAY_FIXTURE
+#define NINA_REPLAY_FIXTURE "nina_session_fast.jsonl"
+#endif
+
+#define BASE_URL        "http://127.0.0.1:1888/v2/api/"
+#define WS_BUFFER_SIZE  2048        /* nina_websocket.c's esp_websocket_client buffer_size */
+#define TICK_US         1000000LL
+#define CLOCK_ORIGIN_US 3600000000LL /* an hour of uptime: nothing is "due" at 0 */
+
+typedef struct {
+    const char *name;
+    uint64_t calls;
+    double ns;
+    uint64_t allocs;
+    uint64_t bytes;
+    size_t peak;
+} row_t;
+
+typedef struct {
+    row_t *row;
+    double t0;
+    replay_alloc_stats_t a0;
+} probe_t;
+
+static int fails = 0;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void probe_begin(probe_t *p, row_t *row) {
+    p->row = row;
+    replay_alloc_reset_peak();
+    p->a0 = replay_alloc_stats();
+    p->t0 = now_ns();
+}
+
+static void probe_end(probe_t *p) {
+    double t1 = now_ns();
+    replay_alloc_stats_t a1 = replay_alloc_stats();
+    row_t *r = p->row;
+    r->calls++;
+    r->ns += t1 - p->t0;
+    r->allocs += a1.allocs - p->a0.allocs;
+    r->bytes += a1.bytes - p->a0.bytes;
+    size_t peak = a1.peak_bytes - p->a0.live_bytes;
+    if (peak > r->peak) r->peak = peak;
+}
+
+static void print_row(const row_t *r) {
+    if (r->calls == 0) return;
+    double n = (double)r->calls;
+    printf("  %-28s %7llu %10.1f %9.1f %10.0f %9zu\n", r->name,
+           (unsigned long long)r->calls, r->ns / n / 1000.0,
+           (double)r->allocs / n, (double)r->bytes / n, r->peak);
+}
+
+static void print_header(const char *title) {
+    printf("\n%s\n  %-28s %7s %10s %9s %10s %9s\n", title,
+           "row", "calls", "us/call", "allocs", "bytes", "peak");
+}
+
+static void set_tick(int tick) {
+    shim_set_time_us(CLOCK_ORIGIN_US + (int64_t)tick * TICK_US);
+}
+
+/* nina_client_t as tasks.c sets one up (mutex + PSRAM HFR ring). */
+static nina_client_t *client_new(void) {
+    nina_client_t *c = calloc(1, sizeof(*c));
+    if (!c) return NULL;
+    nina_client_init_mutex(c);
+    c->hfr_ring.hfr = calloc(HFR_RING_SIZE, sizeof(float));
+    c->hfr_ring.stars = calloc(HFR_RING_SIZE, sizeof(int));
+    return c;
+}
+
+static void client_free(nina_client_t *c) {
+    if (!c) return;
+    free(c->hfr_ring.hfr);
+    free(c->hfr_ring.stars);
+    vSemaphoreDelete(c->mutex);
+    free(c);
+}
+
+// =============================================================================
+// ws / no-ws passes
+// =============================================================================
+
+static row_t s_ws_row = { .name = "ws event (decode+dispatch)" };
+static row_t s_poll_ws_row = { .name = "poll cycle, ws connected" };
+static row_t s_poll_nows_row = { .name = "poll cycle, no ws" };
+
+static void deliver_ws(const char *msg, size_t len, void *ctx) {
+    int *image_saves = ctx;
+    if (strstr(msg, "\"IMAGE-SAVE\"")) (*image_saves)++;
+    probe_t p;
+    probe_begin(&p, &s_ws_row);
+    replay_ws_deliver(msg, len, WS_BUFFER_SIZE);
+    probe_end(&p);
+}
+
+static void run_poll_pass(int ticks, bool with_ws) {
+    nina_client_t *data = client_new();
+    nina_poll_state_t state;
+    memset(&state, 0, sizeof(state));
+    nina_poll_state_init(&state);
+    nina_connection_init();
+    replay_rewind();
+    set_tick(0);
+
+    if (with_ws) {
+        nina_websocket_start(0, BASE_URL, data);
+        if (!replay_ws_ready()) {
+            printf("  FAIL: nina_websocket_start() never registered a handler\n");
+            fails++;
+        }
+        replay_ws_connect();
+    }
+
+    int image_saves = 0;
+    bool ever_connected = false;
+    for (int t = 0; t < ticks; t++) {
+        set_tick(t);
+        replay_apply_tick(t, with_ws ? deliver_ws : NULL, &image_saves);
+        probe_t p;
+        probe_begin(&p, with_ws ? &s_poll_ws_row : &s_poll_nows_row);
+        nina_client_poll(BASE_URL, data, &state, 0);
+        probe_end(&p);
+        ever_connected |= data->connected;
+    }
+
+    const char *pass = with_ws ? "ws" : "no-ws";
+    if (!ever_connected || !data->connected) {
+        printf("  FAIL: %s pass: client not connected at end of session\n", pass);
+        fails++;
+    }
+    if (strcmp(data->profile_name, "NINA") == 0 || data->profile_name[0] == '\0') {
+        printf("  FAIL: %s pass: profile never fetched\n", pass);
+        fails++;
+    }
+    if (with_ws) {
+        if (!data->websocket_connected) {
+            printf("  FAIL: ws pass: websocket_connected not set\n");
+            fails++;
+        }
+        if (image_saves == 0 || data->hfr_ring.count == 0) {
+            printf("  FAIL: ws pass: no IMAGE-SAVE reached the HFR store (%d sent)\n", image_saves);
+            fails++;
+        }
+        nina_websocket_stop(0);
+    }
+
+    nina_poll_state_init(&state);   /* releases the keep-alive slot */
+    client_free(data);
+}
+
+// =============================================================================
+// Per-fetcher pass
+// =============================================================================
+
+typedef struct {
+    nina_client_t *data;
+    camera_detail_data_t camera;
+    mount_detail_data_t mount;
+    sequence_detail_data_t sequence;
+    graph_hfr_data_t hfr;
+} fetch_ctx_t;
+
+typedef void (*fetch_fn)(fetch_ctx_t *c);
+
+static void f_bundle(fetch_ctx_t *c) {
+    uint16_t mask = 0;
+    fetch_equipment_info_bundled(BASE_URL, c->data, true, &mask);
+}
+static void f_camera(fetch_ctx_t *c) { fetch_camera_info_robust(BASE_URL, c->data); }
+static void f_filter(fetch_ctx_t *c) { fetch_filter_robust_ex(BASE_URL, c->data, true); }
+static void f_guider(fetch_ctx_t *c) { fetch_guider_robust(BASE_URL, c->data); }
+static void f_mount(fetch_ctx_t *c) { fetch_mount_robust(BASE_URL, c->data); }
+static void f_focuser(fetch_ctx_t *c) { fetch_focuser_robust(BASE_URL, c->data); }
+static void f_switch(fetch_ctx_t *c) { fetch_switch_info(BASE_URL, c->data); }
+static void f_safety(fetch_ctx_t *c) { fetch_safety_monitor_info(BASE_URL, c->data); }
+static void f_profile(fetch_ctx_t *c) { fetch_profile_robust(BASE_URL, c->data); }
+static void f_image_count(fetch_ctx_t *c) { (void)c; fetch_image_count(BASE_URL); }
+static void f_image_history(fetch_ctx_t *c) { fetch_image_history_robust(BASE_URL, c->data); }
+static void f_sequence(fetch_ctx_t *c) { fetch_sequence_counts_optional(BASE_URL, c->data, NULL); }
+static void f_camera_details(fetch_ctx_t *c) { fetch_camera_details(BASE_URL, &c->camera); }
+static void f_mount_details(fetch_ctx_t *c) { fetch_mount_details(BASE_URL, &c->mount); }
+static void f_sequence_details(fetch_ctx_t *c) { fetch_sequence_details(BASE_URL, &c->sequence); }
+static void f_hfr_sync(fetch_ctx_t *c) {
+    /* Drop the store first so every call pays the full history sync. */
+    hfr_store_invalidate(&c->data->hfr_ring);
+    fetch_hfr_history(BASE_URL, c->data, &c->hfr, GRAPH_MAX_POINTS);
+}
+
+static struct {
+    fetch_fn fn;
+    row_t row;
+} s_fetchers[] = {
+    { f_bundle,           { .name = "equipment_info_bundled" } },
+    { f_camera,           { .name = "camera_info" } },
+    { f_filter,           { .name = "filter (with list)" } },
+    { f_guider,           { .name = "guider" } },
+    { f_mount,            { .name = "mount" } },
+    { f_focuser,          { .name = "focuser" } },
+    { f_switch,           { .name = "switch_info" } },
+    { f_safety,           { .name = "safety_monitor_info" } },
+    { f_profile,          { .name = "profile" } },
+    { f_image_count,      { .name = "image_count" } },
+    { f_image_history,    { .name = "image_history" } },
+    { f_sequence,         { .name = "sequence_counts" } },
+    { f_camera_details,   { .name = "camera_details" } },
+    { f_mount_details,    { .name = "mount_details" } },
+    { f_sequence_details, { .name = "sequence_details" } },
+    { f_hfr_sync,         { .name = "hfr_history (full sync)" } },
+};
+#define FETCHER_COUNT ((int)(sizeof(s_fetchers) / sizeof(s_fetchers[0])))
+
+static void run_fetcher_pass(int ticks) {
+    fetch_ctx_t *c = calloc(1, sizeof(*c));
+    c->data = client_new();
+    replay_rewind();
+    for (int t = 0; t < ticks; t++) {
+        set_tick(t);
+        replay_apply_tick(t, NULL, NULL);
+        for (int i = 0; i < FETCHER_COUNT; i++) {
+            probe_t p;
+            probe_begin(&p, &s_fetchers[i].row);
+            s_fetchers[i].fn(c);
+            probe_end(&p);
+        }
+    }
+    if (!c->data->connected) {
+        printf("  FAIL: fetcher pass: camera/bundle fetchers report offline\n");
+        fails++;
+    }
+    client_free(c->data);
+    free(c);
+}
+
+int main(int argc, char **argv) {
+    int passes = argc > 1 ? atoi(argv[1]) : 1;
+    const char *fixture = argc > 2 ? argv[2] : NINA_REPLAY_FIXTURE;
+    if (passes < 1) passes = 1;
+
+    /* cJSON is its own library; route it through the counting allocator
+     * before anything is parsed so every tree is counted and freed alike. */
+    cJSON_Hooks hooks = { replay_malloc, replay_free };
+    cJSON_InitHooks(&hooks);
+
+    int ticks = replay_load(fixture);
+    if (ticks < 0) return 1;
+
+    nina_client_init();
+    replay_http_set_date("Fri, 16 Oct 2026 03:00:00 GMT");
+    printf("bench_nina_replay: %s, %d ticks x %d pass(es)\n", fixture, ticks, passes);
+
+    size_t baseline = replay_alloc_stats().live_bytes;
+    for (int i = 0; i < passes; i++) {
+        run_poll_pass(ticks, true);
+        run_poll_pass(ticks, false);
+        run_fetcher_pass(ticks);
+    }
+
+    print_header("Poll pipeline (per call):");
+    print_row(&s_ws_row);
+    print_row(&s_poll_ws_row);
+    print_row(&s_poll_nows_row);
+    print_header("Fetchers (per call, one-shot GET):");
+    for (int i = 0; i < FETCHER_COUNT; i++) print_row(&s_fetchers[i].row);
+
+    replay_http_stats_t hs = replay_http_stats();
+    replay_alloc_stats_t as = replay_alloc_stats();
+    printf("\nGETs served: %u (%llu body bytes), not found: %u; heap retained after run: %lld bytes\n",
+           hs.requests, (unsigned long long)hs.bytes, hs.not_found,
+           (long long)as.live_bytes - (long long)baseline);
+    if (hs.not_found != 0) {
+        printf("  FAIL: firmware requested paths the recorded session never served\n");
+        fails++;
+    }
+
+    shim_reset_time();
+    replay_unload();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,296 @@
+/* Benchmark for main/ws_event.c — replays a captured NINA WebSocket session
+ * (test/host/fixtures/ws_events_session.jsonl, one message per line) through
+ * two receive paths and compares them:
+ *
+ *   legacy  the pre-ws_event nina_websocket.c path: memcpy every fragment
+ *           into a reassembly buffer, cJSON_ParseWithLength() the whole
+ *           message, then cJSON_GetObjectItem() the handler's fields.
+ *   stream  ws_event_decoder_feed() straight from each fragment, stopping
+ *           as soon as the decoder reports READY.
+ *
+ * Messages are cut into fragments the way esp_websocket_client delivers them
+ * (buffer_size bytes per DATA event). For each fragment size it prints
+ * ns/event, heap allocations/event and bytes copied/event, and cross-checks
+ * that both paths decode the same event type and handler fields, so the
+ * ctest run doubles as a differential test.
+ *
+ * Usage: bench_ws_events [iterations] [fixture.jsonl]
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(bench_ws_events ...)).
+ */
+
+#include "ws_event.h"
+#include "cJSON.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef WS_EVENTS_FIXTURE
+#define WS_EVENTS_FIXTURE "ws_events_session.jsonl"
+#endif
+
+#define MAX_MESSAGES 1024
+
+static char *s_msgs[MAX_MESSAGES];
+static size_t s_lens[MAX_MESSAGES];
+static int s_count;
+
+static long s_allocs;
+
+static void *count_malloc(size_t sz) {
+    s_allocs++;
+    return malloc(sz);
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int load_fixture(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "cannot open fixture %s\n", path);
+        return -1;
+    }
+    char line[8192];
+    while (s_count < MAX_MESSAGES && fgets(line, sizeof(line), f)) {
+        size_t n = strcspn(line, "\r\n");
+        if (n == 0) continue;
+        s_msgs[s_count] = malloc(n + 1);
+        memcpy(s_msgs[s_count], line, n);
+        s_msgs[s_count][n] = '\0';
+        s_lens[s_count] = n;
+        s_count++;
+    }
+    fclose(f);
+    return s_count;
+}
+
+/* ── Legacy path: reassemble + cJSON DOM ── */
+
+typedef struct {
+    char *buf;
+    size_t cap;
+    size_t copied;
+} reasm_t;
+
+static float num_or(const cJSON *o, const char *k, float dflt) {
+    const cJSON *it = cJSON_GetObjectItem(o, k);
+    return cJSON_IsNumber(it) ? (float)it->valuedouble : dflt;
+}
+
+static const char *str_or(const cJSON *o, const char *k) {
+    const cJSON *it = cJSON_GetObjectItem(o, k);
+    return cJSON_IsString(it) ? it->valuestring : "";
+}
+
+/* Pull the same fields the old handler read, into a ws_event_t for comparison. */
+static bool legacy_decode(const char *msg, size_t len, ws_event_t *out) {
+    memset(out, 0, sizeof(*out));
+    cJSON *json = cJSON_ParseWithLength(msg, len);
+    if (!json) return false;
+    cJSON *resp = cJSON_GetObjectItem(json, "Response");
+    cJSON *evt = resp ? cJSON_GetObjectItem(resp, "Event") : NULL;
+    if (!cJSON_IsString(evt)) {
+        cJSON_Delete(json);
+        return false;
+    }
+    snprintf(out->name, sizeof(out->name), "%s", evt->valuestring);
+    out->type = ws_event_classify(out->name);
+
+    switch (out->type) {
+    case WS_EVT_IMAGE_SAVE: {
+        cJSON *st = cJSON_GetObjectItem(resp, "ImageStatistics");
+        if (st) {
+            out->fields |= WS_F_STATS;
+            out->stats.hfr = num_or(st, "HFR", 0);
+            out->stats.stars = (int)num_or(st, "Stars", 0);
+            out->stats.exposure_time = num_or(st, "ExposureTime", 0);
+            out->stats.mean = num_or(st, "Mean", 0);
+            out->stats.median = num_or(st, "Median", 0);
+            out->stats.gain = (int)num_or(st, "Gain", 0);
+            snprintf(out->stats.filter, sizeof(out->stats.filter), "%s", str_or(st, "Filter"));
+            snprintf(out->stats.image_type, sizeof(out->stats.image_type), "%s",
+                     str_or(st, "ImageType"));
+            snprintf(out->stats.filename, sizeof(out->stats.filename), "%s",
+                     str_or(st, "Filename"));
+        }
+        break;
+    }
+    case WS_EVT_FILTERWHEEL_CHANGED: {
+        cJSON *nw = cJSON_GetObjectItem(resp, "New");
+        if (nw) snprintf(out->new_name, sizeof(out->new_name), "%s", str_or(nw, "Name"));
+        break;
+    }
+    case WS_EVT_TS_NEWTARGETSTART:
+        snprintf(out->target_name, sizeof(out->target_name), "%s", str_or(resp, "TargetName"));
+        break;
+    case WS_EVT_AUTOFOCUS_POINT_ADDED:
+        out->position = (int)num_or(resp, "Position", 0);
+        out->af_hfr = num_or(resp, "HFR", 0);
+        break;
+    case WS_EVT_ROTATOR_MOVED:
+        out->to = num_or(resp, "To", 0);
+        break;
+    case WS_EVT_SAFETY_CHANGED:
+        out->is_safe = cJSON_IsTrue(cJSON_GetObjectItem(resp, "IsSafe"));
+        break;
+    case WS_EVT_TS_WAITSTART:
+        snprintf(out->wait_start, sizeof(out->wait_start), "%s", str_or(resp, "WaitStartTime"));
+        break;
+    case WS_EVT_SEQUENCE_ENTITY_FAILED:
+        snprintf(out->entity, sizeof(out->entity), "%s", str_or(resp, "Entity"));
+        snprintf(out->error, sizeof(out->error), "%s", str_or(resp, "Error"));
+        break;
+    default:
+        break;
+    }
+    cJSON_Delete(json);
+    return true;
+}
+
+static bool legacy_receive(reasm_t *r, const char *msg, size_t len, size_t frag, ws_event_t *out) {
+    if (len <= frag) return legacy_decode(msg, len, out);   /* single frame: no copy */
+    if (r->cap < len) {
+        free(r->buf);
+        r->buf = count_malloc(len);
+        r->cap = len;
+    }
+    for (size_t off = 0; off < len; off += frag) {
+        size_t n = (len - off < frag) ? len - off : frag;
+        memcpy(r->buf + off, msg + off, n);
+        r->copied += n;
+    }
+    return legacy_decode(r->buf, len, out);
+}
+
+/* ── Streaming path ── */
+
+static bool stream_receive(ws_event_decoder_t *d, const char *msg, size_t len, size_t frag) {
+    ws_event_decoder_begin(d);
+    ws_event_status_t st = WS_EVENT_MORE;
+    for (size_t off = 0; off < len && st == WS_EVENT_MORE; off += frag) {
+        size_t n = (len - off < frag) ? len - off : frag;
+        st = ws_event_decoder_feed(d, msg + off, n);
+    }
+    if (st == WS_EVENT_MORE) st = ws_event_decoder_finish(d);
+    return st == WS_EVENT_READY;
+}
+
+static bool feq(float a, float b) { return fabsf(a - b) < 1e-4f; }
+
+static int compare(int i, const ws_event_t *a, const ws_event_t *b) {
+    bool ok = a->type == b->type && strcmp(a->name, b->name) == 0;
+    switch (a->type) {
+    case WS_EVT_IMAGE_SAVE:
+        ok = ok && feq(a->stats.hfr, b->stats.hfr) && a->stats.stars == b->stats.stars &&
+             feq(a->stats.exposure_time, b->stats.exposure_time) &&
+             feq(a->stats.mean, b->stats.mean) && feq(a->stats.median, b->stats.median) &&
+             a->stats.gain == b->stats.gain &&
+             strcmp(a->stats.filter, b->stats.filter) == 0 &&
+             strcmp(a->stats.image_type, b->stats.image_type) == 0 &&
+             strcmp(a->stats.filename, b->stats.filename) == 0;
+        break;
+    case WS_EVT_FILTERWHEEL_CHANGED:
+        ok = ok && strcmp(a->new_name, b->new_name) == 0;
+        break;
+    case WS_EVT_TS_NEWTARGETSTART:
+        ok = ok && strcmp(a->target_name, b->target_name) == 0;
+        break;
+    case WS_EVT_AUTOFOCUS_POINT_ADDED:
+        ok = ok && a->position == b->position && feq(a->af_hfr, b->af_hfr);
+        break;
+    case WS_EVT_ROTATOR_MOVED:
+        ok = ok && feq(a->to, b->to);
+        break;
+    case WS_EVT_SAFETY_CHANGED:
+        ok = ok && a->is_safe == b->is_safe;
+        break;
+    case WS_EVT_TS_WAITSTART:
+        ok = ok && strcmp(a->wait_start, b->wait_start) == 0;
+        break;
+    case WS_EVT_SEQUENCE_ENTITY_FAILED:
+        ok = ok && strcmp(a->entity, b->entity) == 0 && strcmp(a->error, b->error) == 0;
+        break;
+    default:
+        break;
+    }
+    if (!ok) printf("MISMATCH message %d (%s vs %s)\n", i, a->name, b->name);
+    return ok ? 0 : 1;
+}
+
+static int run(size_t frag, int iters) {
+    int mismatches = 0;
+    reasm_t r = {0};
+    ws_event_decoder_t *d = count_malloc(sizeof(*d));   /* one per instance, kept */
+    ws_event_t legacy_ev, stream_ev;
+
+    for (int i = 0; i < s_count; i++) {
+        if (!legacy_receive(&r, s_msgs[i], s_lens[i], frag, &legacy_ev) ||
+            !stream_receive(d, s_msgs[i], s_lens[i], frag)) {
+            printf("DECODE FAILED message %d\n", i);
+            mismatches++;
+            continue;
+        }
+        stream_ev = *ws_event_decoder_event(d);
+        mismatches += compare(i, &legacy_ev, &stream_ev);
+    }
+
+    long events = (long)iters * s_count;
+
+    s_allocs = 0;
+    r.copied = 0;
+    double t0 = now_ns();
+    for (int it = 0; it < iters; it++) {
+        for (int i = 0; i < s_count; i++) legacy_receive(&r, s_msgs[i], s_lens[i], frag, &legacy_ev);
+    }
+    double legacy_ns = (now_ns() - t0) / (double)events;
+    double legacy_allocs = (double)s_allocs / (double)events;
+    double legacy_copied = (double)r.copied / (double)events;
+
+    s_allocs = 0;
+    t0 = now_ns();
+    for (int it = 0; it < iters; it++) {
+        for (int i = 0; i < s_count; i++) stream_receive(d, s_msgs[i], s_lens[i], frag);
+    }
+    double stream_ns = (now_ns() - t0) / (double)events;
+    double stream_allocs = (double)s_allocs / (double)events;
+
+    printf("fragment %5zu B  legacy %8.0f ns/evt %6.1f allocs/evt %7.1f B copied/evt\n",
+           frag, legacy_ns, legacy_allocs, legacy_copied);
+    printf("                  stream %8.0f ns/evt %6.1f allocs/evt %7.1f B copied/evt  (x%.2f)\n",
+           stream_ns, stream_allocs, 0.0, stream_ns > 0 ? legacy_ns / stream_ns : 0.0);
+
+    free(r.buf);
+    free(d);
+    return mismatches;
+}
+
+int main(int argc, char **argv) {
+    int iters = (argc > 1) ? atoi(argv[1]) : 50;
+    const char *path = (argc > 2) ? argv[2] : WS_EVENTS_FIXTURE;
+    if (iters < 1) iters = 1;
+
+    cJSON_Hooks hooks = { count_malloc, free };
+    cJSON_InitHooks(&hooks);
+
+    if (load_fixture(path) <= 0) return 1;
+    size_t bytes = 0;
+    for (int i = 0; i < s_count; i++) bytes += s_lens[i];
+    printf("%d messages, %zu bytes, %d iterations\n", s_count, bytes, iters);
+
+    /* 2048 = nina_websocket.c buffer_size; 256 exercises heavy fragmentation */
+    int mismatches = run(2048, iters) + run(256, iters);
+
+    for (int i = 0; i < s_count; i++) free(s_msgs[i]);
+    if (mismatches) {
+        printf("\n%d MISMATCH(ES)\n", mismatches);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
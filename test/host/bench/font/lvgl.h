@@ -0,0 +1,142 @@
+#pragma once
+/* LVGL 9.5 font subset for bench_glyph_cache — just enough of lv_font.h,
+ * lv_font_fmt_txt.h and lv_draw_buf.h for the generated main/ui/lv_font_*.c
+ * sources and main/ui/font_glyph_cache.c to compile unmodified. Field names
+ * and order follow LVGL; nothing here renders.
+ *
+ * Put ahead of shims/ on the include path (the shims/lvgl.h stand-in only
+ * declares lv_obj_t). lv_font_get_glyph_dsc_fmt_txt() and
+ * lv_font_get_bitmap_fmt_txt() are defined by the bench. */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define LVGL_VERSION_MAJOR 9
+#define LVGL_VERSION_MINOR 5
+#define LVGL_VERSION_PATCH 0
+#define LV_VERSION_CHECK(x, y, z) \
+    ((x) == LVGL_VERSION_MAJOR && ((y) < LVGL_VERSION_MINOR || \
+     ((y) == LVGL_VERSION_MINOR && (z) <= LVGL_VERSION_PATCH)))
+
+#define LV_ATTRIBUTE_LARGE_CONST
+#define LV_FONT_FMT_TXT_LARGE 1    /* CONFIG_LV_FONT_FMT_TXT_LARGE=y */
+
+typedef struct _lv_font_t lv_font_t;
+
+typedef enum {
+    LV_FONT_SUBPX_NONE,
+    LV_FONT_SUBPX_HOR,
+    LV_FONT_SUBPX_VER,
+    LV_FONT_SUBPX_BOTH,
+} lv_font_subpx_t;
+
+typedef enum {
+    LV_COLOR_FORMAT_A8 = 0x0E,
+} lv_color_format_t;
+
+typedef struct {
+    const lv_font_t *resolved_font;
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint16_t stride;
+    uint8_t format;
+    union {
+        uint32_t index;
+        const void *src;
+    } gid;
+} lv_font_glyph_dsc_t;
+
+typedef struct {
+    struct {
+        uint32_t cf;
+        uint32_t w;
+        uint32_t h;
+        uint32_t stride;
+    } header;
+    uint32_t data_size;
+    uint8_t *data;
+} lv_draw_buf_t;
+
+/* CONFIG_LV_DRAW_BUF_STRIDE_ALIGN=1: A8 rows are exactly w bytes. */
+static inline uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t cf)
+{
+    (void)cf;
+    return w;
+}
+
+struct _lv_font_t {
+    bool (*get_glyph_dsc)(const lv_font_t *, lv_font_glyph_dsc_t *, uint32_t letter,
+                          uint32_t letter_next);
+    const void *(*get_glyph_bitmap)(lv_font_glyph_dsc_t *, lv_draw_buf_t *);
+    void (*release_glyph)(const lv_font_t *, lv_font_glyph_dsc_t *);
+    int32_t line_height;
+    int32_t base_line;
+    uint8_t subpx : 2;
+    uint8_t kerning : 1;
+    uint8_t static_bitmap : 1;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    const void *dsc;
+    const lv_font_t *fallback;
+    void *user_data;
+};
+
+typedef struct {
+    uint32_t bitmap_index;
+    uint32_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+typedef enum {
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+} lv_font_fmt_txt_cmap_type_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    const uint16_t *unicode_list;
+    const void *glyph_id_ofs_list;
+    uint16_t list_length;
+    lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct {
+    const int8_t *class_pair_values;
+    const uint8_t *left_class_mapping;
+    const uint8_t *right_class_mapping;
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+} lv_font_fmt_txt_kern_classes_t;
+
+typedef enum {
+    LV_FONT_FMT_TXT_PLAIN = 0,
+    LV_FONT_FMT_TXT_COMPRESSED = 1,
+    LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 2,
+} lv_font_fmt_txt_bitmap_format_t;
+
+typedef struct {
+    const uint8_t *glyph_bitmap;
+    const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+    const lv_font_fmt_txt_cmap_t *cmaps;
+    const void *kern_dsc;
+    uint16_t kern_scale;
+    uint16_t cmap_num : 9;
+    uint16_t bpp : 4;
+    uint16_t kern_classes : 1;
+    uint16_t bitmap_format : 2;
+} lv_font_fmt_txt_dsc_t;
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t unicode_letter, uint32_t unicode_letter_next);
+const void *lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf);
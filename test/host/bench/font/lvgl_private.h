@@ -0,0 +1,4 @@
+#pragma once
+/* lv_font_warning_128.c includes lvgl_private.h; the bench's lvgl.h already
+ * carries every font type it needs. */
+#include "lvgl.h"
@@ -0,0 +1,58 @@
+/* Replay support for bench_nina_replay: a recorded NINA session served to
+ * the unmodified nina_client / nina_api_fetchers / nina_sequence /
+ * nina_websocket sources.
+ *
+ *   replay_http.c   fixture loader plus the http_fetch.h stand-in: every
+ *                   GET is answered from the session's current body for
+ *                   that API path (404 for paths the session never served).
+ *   replay_stubs.c  link-time stand-ins for everything else those sources
+ *                   reach (UI, app_config, perf_monitor, esp_websocket_client,
+ *                   esp_http_client) plus WebSocket frame delivery through
+ *                   the handler nina_websocket.c registers.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ── Fixture / http_fetch stand-in (replay_http.c) ── */
+
+typedef struct {
+    uint32_t requests;      /* GETs answered (text, stream and batch items) */
+    uint32_t not_found;     /* GETs for a path the session never served */
+    uint64_t bytes;         /* body bytes handed to the firmware */
+} replay_http_stats_t;
+
+/* Load a fixture written by test/host/fixtures/record_nina_session.py.
+ * Returns the number of ticks it covers, or -1 on error. */
+int replay_load(const char *path);
+
+/* Release everything replay_load() allocated. */
+void replay_unload(void);
+
+/* Forget the served bodies and rewind to tick 0. */
+void replay_rewind(void);
+
+/* Apply every record of @p tick: REST records replace the body served for
+ * their path; WebSocket records are passed to @p on_ws in capture order. */
+typedef void (*replay_ws_fn)(const char *msg, size_t len, void *ctx);
+void replay_apply_tick(int tick, replay_ws_fn on_ws, void *ctx);
+
+/* Value returned for a captured "Date" response header. */
+void replay_http_set_date(const char *rfc1123);
+
+replay_http_stats_t replay_http_stats(void);
+
+/* ── WebSocket delivery (replay_stubs.c) ── */
+
+/* True once nina_websocket_start() has registered its event handler. */
+bool replay_ws_ready(void);
+
+/* Post WEBSOCKET_EVENT_CONNECTED to the registered handler. */
+void replay_ws_connect(void);
+
+/* Deliver one text message as DATA events of at most @p buffer_size bytes,
+ * fragmented the way esp_websocket_client does (op_code 0x01 then 0x00
+ * continuations, payload_len/payload_offset set on every event). */
+void replay_ws_deliver(const char *msg, size_t len, int buffer_size);
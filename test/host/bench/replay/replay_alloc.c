@@ -0,0 +1,80 @@
+/* Counting allocator for bench_nina_replay -- see replay_alloc.h. */
+
+#define REPLAY_ALLOC_IMPL
+#include "replay_alloc.h"
+
+/* The header is force-included ahead of REPLAY_ALLOC_IMPL, so its macros
+ * are already defined here; this file needs the real functions. */
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+#undef strdup
+
+/* Header padded to the strictest scalar alignment (C99 has no max_align_t)
+ * so the returned pointer is suitably aligned for any type. */
+typedef union {
+    size_t size;
+    long double ld;
+    long long ll;
+    void *p;
+} block_hdr_t;
+
+static replay_alloc_stats_t s_stats;
+
+static void note_alloc(size_t size) {
+    s_stats.allocs++;
+    s_stats.bytes += size;
+    s_stats.live_bytes += size;
+    if (s_stats.live_bytes > s_stats.peak_bytes) s_stats.peak_bytes = s_stats.live_bytes;
+}
+
+void *replay_malloc(size_t size) {
+    block_hdr_t *h = malloc(sizeof(block_hdr_t) + size);
+    if (!h) return NULL;
+    h->size = size;
+    note_alloc(size);
+    return h + 1;
+}
+
+void *replay_calloc(size_t n, size_t size) {
+    if (size && n > (SIZE_MAX - sizeof(block_hdr_t)) / size) return NULL;
+    void *p = replay_malloc(n * size);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void replay_free(void *ptr) {
+    if (!ptr) return;
+    block_hdr_t *h = (block_hdr_t *)ptr - 1;
+    s_stats.frees++;
+    s_stats.live_bytes -= h->size;
+    free(h);
+}
+
+void *replay_realloc(void *ptr, size_t size) {
+    if (!ptr) return replay_malloc(size);
+    block_hdr_t *h = (block_hdr_t *)ptr - 1;
+    size_t old = h->size;
+    block_hdr_t *n = realloc(h, sizeof(block_hdr_t) + size);
+    if (!n) return NULL;
+    n->size = size;
+    s_stats.live_bytes -= old;
+    note_alloc(size);
+    return n + 1;
+}
+
+char *replay_strdup(const char *s) {
+    size_t len = strlen(s) + 1;
+    char *p = replay_malloc(len);
+    if (p) memcpy(p, s, len);
+    return p;
+}
+
+replay_alloc_stats_t replay_alloc_stats(void) {
+    return s_stats;
+}
+
+void replay_alloc_reset_peak(void) {
+    s_stats.peak_bytes = s_stats.live_bytes;
+}
@@ -0,0 +1,50 @@
+/* Counting allocator for bench_nina_replay.
+ *
+ * Force-included (-include) into every translation unit of the replay
+ * target, so the firmware sources' heap_caps_* calls (which the
+ * esp_heap_caps.h shim routes to malloc/calloc/realloc/free) and any direct
+ * libc allocation land here without touching firmware code. cJSON is a
+ * separate library and is routed through the same counters with
+ * cJSON_InitHooks() by the driver.
+ *
+ * Every block carries a small size header so free() can keep a live-bytes
+ * figure and a high-water mark. Single-threaded, like the rest of the host
+ * shims.
+ */
+#pragma once
+
+/* System headers that declare the allocation functions must be seen before
+ * the macros below, or their prototypes would be rewritten too. */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint64_t allocs;        /* successful malloc/calloc/realloc/strdup calls */
+    uint64_t frees;
+    uint64_t bytes;         /* total bytes requested */
+    size_t   live_bytes;    /* currently allocated */
+    size_t   peak_bytes;    /* high-water mark of live_bytes */
+} replay_alloc_stats_t;
+
+void *replay_malloc(size_t size);
+void *replay_calloc(size_t n, size_t size);
+void *replay_realloc(void *ptr, size_t size);
+void  replay_free(void *ptr);
+char *replay_strdup(const char *s);
+
+/* Snapshot of the counters. */
+replay_alloc_stats_t replay_alloc_stats(void);
+
+/* Restart the high-water mark from the current live size, so a following
+ * replay_alloc_stats().peak_bytes - live_bytes is the peak of one section. */
+void replay_alloc_reset_peak(void);
+
+#ifndef REPLAY_ALLOC_IMPL
+#define malloc(n)       replay_malloc(n)
+#define calloc(n, s)    replay_calloc((n), (s))
+#define realloc(p, n)   replay_realloc((p), (n))
+#define free(p)         replay_free(p)
+#define strdup(s)       replay_strdup(s)
+#endif
@@ -0,0 +1,267 @@
+/* Recorded-session stand-in for main/http_fetch.c (see replay.h).
+ *
+ * Implements the http_fetch.h surface the NINA client uses -- text, stream
+ * and batch GETs plus the keep-alive slot -- by looking the request's API
+ * path (everything after "/v2/api/") up in the replayed session. Bodies are
+ * delivered the way the real fetcher does it: http_fetch_text() hands over a
+ * fresh heap copy, http_fetch_stream() and http_fetch_batch() feed the sink
+ * HTTP_STREAM_CHUNK_BYTES at a time, so the firmware's parse cost and heap
+ * traffic are the same as on the device minus the socket.
+ */
+
+#include "replay.h"
+#include "http_fetch.h"
+#include "esp_heap_caps.h"
+#include "cJSON.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Matches main/http_fetch.c's read chunk. */
+#define REPLAY_CHUNK_BYTES 512
+#define REPLAY_MAX_PATHS   32
+#define REPLAY_API_PREFIX  "/v2/api/"
+
+typedef struct {
+    int tick;
+    int path;           /* index into s_paths, -1 for a WebSocket message */
+    char *text;
+    size_t len;
+} replay_record_t;
+
+static replay_record_t *s_records;
+static int s_record_count;
+static int s_ticks;
+static int s_next;      /* first record not yet applied */
+
+static char *s_paths[REPLAY_MAX_PATHS];
+static int s_path_count;
+static const replay_record_t *s_current[REPLAY_MAX_PATHS];
+
+static char s_date[40] = "Fri, 16 Oct 2026 03:00:00 GMT";
+static replay_http_stats_t s_stats;
+
+struct http_fetch_conn {
+    uint32_t requests;
+};
+
+// =============================================================================
+// Fixture
+// =============================================================================
+
+static int path_index(const char *path, bool add) {
+    for (int i = 0; i < s_path_count; i++) {
+        if (strcmp(s_paths[i], path) == 0) return i;
+    }
+    if (!add || s_path_count >= REPLAY_MAX_PATHS) return -1;
+    s_paths[s_path_count] = strdup(path);
+    return s_paths[s_path_count] ? s_path_count++ : -1;
+}
+
+static bool add_record(int tick, int path, cJSON *item) {
+    if ((s_record_count & 63) == 0) {
+        replay_record_t *grown = realloc(s_records, (size_t)(s_record_count + 64) * sizeof(*grown));
+        if (!grown) return false;
+        s_records = grown;
+    }
+    char *text = cJSON_PrintUnformatted(item);
+    if (!text) return false;
+    s_records[s_record_count++] = (replay_record_t){
+        .tick = tick, .path = path, .text = text, .len = strlen(text),
+    };
+    return true;
+}
+
+int replay_load(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "cannot open fixture %s\n", path);
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = malloc((size_t)size + 1);
+    if (!buf || fread(buf, 1, (size_t)size, f) != (size_t)size) {
+        fclose(f);
+        free(buf);
+        return -1;
+    }
+    fclose(f);
+    buf[size] = '\0';
+
+    int rc = 0;
+    for (char *line = buf; line && *line && rc == 0; ) {
+        char *eol = strchr(line, '\n');
+        if (eol) *eol = '\0';
+        cJSON *rec = line[0] ? cJSON_Parse(line) : NULL;
+        if (line[0] && !rec) {
+            fprintf(stderr, "fixture: bad line %.40s...\n", line);
+            rc = -1;
+        } else if (rec) {
+            cJSON *ticks = cJSON_GetObjectItem(rec, "ticks");
+            cJSON *t = cJSON_GetObjectItem(rec, "t");
+            cJSON *get = cJSON_GetObjectItem(rec, "get");
+            cJSON *ws = cJSON_GetObjectItem(rec, "ws");
+            if (cJSON_IsNumber(ticks)) {
+                s_ticks = ticks->valueint;
+            } else if (cJSON_IsNumber(t) && cJSON_IsString(get)) {
+                int p = path_index(get->valuestring, true);
+                if (p < 0 || !add_record(t->valueint, p, cJSON_GetObjectItem(rec, "body"))) rc = -1;
+            } else if (cJSON_IsNumber(t) && ws) {
+                if (!add_record(t->valueint, -1, ws)) rc = -1;
+            }
+            cJSON_Delete(rec);
+        }
+        line = eol ? eol + 1 : NULL;
+    }
+    free(buf);
+    if (rc != 0 || s_ticks <= 0) {
+        replay_unload();
+        return -1;
+    }
+    replay_rewind();
+    return s_ticks;
+}
+
+void replay_unload(void) {
+    for (int i = 0; i < s_record_count; i++) cJSON_free(s_records[i].text);
+    free(s_records);
+    s_records = NULL;
+    s_record_count = 0;
+    for (int i = 0; i < s_path_count; i++) free(s_paths[i]);
+    s_path_count = 0;
+    s_ticks = 0;
+    replay_rewind();
+}
+
+void replay_rewind(void) {
+    s_next = 0;
+    memset(s_current, 0, sizeof(s_current));
+}
+
+void replay_apply_tick(int tick, replay_ws_fn on_ws, void *ctx) {
+    while (s_next < s_record_count && s_records[s_next].tick <= tick) {
+        const replay_record_t *r = &s_records[s_next++];
+        if (r->path >= 0) {
+            s_current[r->path] = r;
+        } else if (on_ws) {
+            on_ws(r->text, r->len, ctx);
+        }
+    }
+}
+
+void replay_http_set_date(const char *rfc1123) {
+    snprintf(s_date, sizeof(s_date), "%s", rfc1123);
+}
+
+replay_http_stats_t replay_http_stats(void) {
+    return s_stats;
+}
+
+// =============================================================================
+// http_fetch.h stand-in
+// =============================================================================
+
+/* Current body for @p url, or NULL (404). */
+static const replay_record_t *lookup(const char *url) {
+    const char *api = url ? strstr(url, REPLAY_API_PREFIX) : NULL;
+    int p = api ? path_index(api + strlen(REPLAY_API_PREFIX), false) : -1;
+    const replay_record_t *r = p >= 0 ? s_current[p] : NULL;
+    s_stats.requests++;
+    if (!r) s_stats.not_found++;
+    else s_stats.bytes += r->len;
+    return r;
+}
+
+static void report_attempt(const http_fetch_opts_t *opts, int status) {
+    if (!opts || !opts->on_attempt) return;
+    http_fetch_attempt_info_t info = {
+        .attempt_index = 0,
+        .ok = status == 200,
+        .ever_connected = true,
+        .status = status,
+    };
+    opts->on_attempt(&info, opts->hook_ctx);
+}
+
+static void capture_date(const char *want, char *out, size_t out_len) {
+    if (!out || out_len == 0) return;
+    snprintf(out, out_len, "%s", want ? s_date : "");
+}
+
+static bool feed_sink(const replay_record_t *r, const http_fetch_sink_t *sink) {
+    if (sink->on_begin) sink->on_begin(sink->sink_ctx);
+    for (size_t off = 0; off < r->len; off += REPLAY_CHUNK_BYTES) {
+        size_t n = r->len - off < REPLAY_CHUNK_BYTES ? r->len - off : REPLAY_CHUNK_BYTES;
+        if (!sink->on_data(r->text + off, n, sink->sink_ctx)) return false;
+    }
+    return true;
+}
+
+http_fetch_conn_t *http_fetch_conn_create(void) {
+    return heap_caps_calloc(1, sizeof(http_fetch_conn_t), MALLOC_CAP_SPIRAM);
+}
+
+void http_fetch_conn_destroy(http_fetch_conn_t *conn) {
+    heap_caps_free(conn);
+}
+
+esp_err_t http_fetch_text(const char *url, const http_fetch_opts_t *opts,
+                           char **out_body, size_t *out_len) {
+    const replay_record_t *r = lookup(url);
+    int status = r ? 200 : 404;
+    if (opts && opts->status_out) *opts->status_out = status;
+    if (opts && opts->conn) opts->conn->requests++;
+    report_attempt(opts, status);
+    if (!r) return ESP_FAIL;
+
+    char *body = heap_caps_malloc(r->len + 1, MALLOC_CAP_SPIRAM);
+    if (!body) return ESP_ERR_NO_MEM;
+    memcpy(body, r->text, r->len + 1);
+    if (opts) capture_date(opts->capture_header, opts->capture_header_out, opts->capture_header_out_len);
+    *out_body = body;
+    if (out_len) *out_len = r->len;
+    return ESP_OK;
+}
+
+esp_err_t http_fetch_stream(const char *url, const http_fetch_opts_t *opts,
+                             const http_fetch_sink_t *sink, size_t *out_len) {
+    if (!sink || !sink->on_data) return ESP_ERR_INVALID_ARG;
+    const replay_record_t *r = lookup(url);
+    int status = r ? 200 : 404;
+    if (opts && opts->status_out) *opts->status_out = status;
+    if (opts && opts->conn) opts->conn->requests++;
+    report_attempt(opts, status);
+    if (!r) return ESP_FAIL;
+
+    if (opts) capture_date(opts->capture_header, opts->capture_header_out, opts->capture_header_out_len);
+    if (!feed_sink(r, sink)) return ESP_FAIL;
+    if (out_len) *out_len = r->len;
+    return ESP_OK;
+}
+
+esp_err_t http_fetch_batch(http_fetch_batch_item_t *items, int n,
+                            const http_fetch_opts_t *opts) {
+    if (!items || n <= 0 || n > HTTP_BATCH_MAX) return ESP_ERR_INVALID_ARG;
+    esp_err_t rc = ESP_OK;
+    for (int i = 0; i < n; i++) {
+        http_fetch_batch_item_t *it = &items[i];
+        const replay_record_t *r = lookup(it->url);
+        it->status = r ? 200 : 404;
+        it->pipelined = true;
+        it->body_len = 0;
+        if (opts && opts->conn) opts->conn->requests++;
+        report_attempt(opts, it->status);
+        if (r && it->sink.on_data && feed_sink(r, &it->sink)) {
+            it->err = ESP_OK;
+            it->body_len = r->len;
+            capture_date(opts ? opts->capture_header : NULL, it->capture_out, it->capture_out_len);
+        } else {
+            it->err = ESP_FAIL;
+            rc = ESP_FAIL;
+        }
+    }
+    return rc;
+}
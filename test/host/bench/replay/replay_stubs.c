@@ -0,0 +1,256 @@
+/* Link-time stand-ins for bench_nina_replay (see replay.h).
+ *
+ * The NINA client sources reach into the UI (toasts, event log, alerts,
+ * safety banner), app_config, the task table, perf_monitor, trace and two
+ * ESP-IDF clients. None of that is under test here, so each is reduced to the
+ * smallest behavior-preserving stub: UI calls are dropped, perf_monitor
+ * stays disabled (g_perf.enabled == false makes every perf call a no-op on
+ * the device too), and esp_http_client -- only used by the prepared-image
+ * download, which the replay never requests -- always fails to init.
+ *
+ * esp_websocket_client is a capturing mock: nina_websocket_start() gets a
+ * dummy handle and its registered handler is kept so replay_ws_deliver()
+ * can post recorded frames to it exactly as the client task would.
+ */
+
+#include "replay.h"
+#include "app_config.h"
+#include "perf_monitor.h"
+#include "trace.h"
+#include "tasks.h"
+#include "esp_http_client.h"
+#include "esp_websocket_client.h"
+#include "ui/nina_alerts.h"
+#include "ui/nina_event_log.h"
+#include "ui/nina_safety.h"
+#include "ui/nina_toast.h"
+
+#include <string.h>
+
+// =============================================================================
+// app_config / tasks
+// =============================================================================
+
+#define REPLAY_INSTANCE_URL "http://127.0.0.1:1888/v2/api/"
+
+static app_config_t s_config = {
+    .connection_timeout_s = 6,
+};
+
+app_config_t *app_config_get(void) {
+    return &s_config;
+}
+
+const char *app_config_get_instance_url(int index) {
+    return index == 0 ? REPLAY_INSTANCE_URL : "";
+}
+
+TaskHandle_t data_task_handle;
+TaskHandle_t poll_task_handles[MAX_NINA_INSTANCES];
+
+// =============================================================================
+// perf_monitor (disabled)
+// =============================================================================
+
+perf_state_t g_perf;
+
+perf_span_t perf_timer_start(void) {
+    return 0;
+}
+
+int64_t perf_timer_stop(perf_timer_t *t, perf_span_t span) {
+    (void)t;
+    (void)span;
+    return 0;
+}
+
+void perf_timer_record(perf_timer_t *t, int64_t duration_us) {
+    (void)t;
+    (void)duration_us;
+}
+
+void perf_counter_increment(perf_counter_t *c) {
+    (void)c;
+}
+
+void perf_ws_type_record(ws_event_type_t type, int64_t duration_us) {
+    (void)type;
+    (void)duration_us;
+}
+
+// =============================================================================
+// trace (disabled -- same as a failed PSRAM allocation on the device)
+// =============================================================================
+
+void trace_begin(const char *name, int32_t arg) {
+    (void)name;
+    (void)arg;
+}
+
+void trace_end(const char *name) {
+    (void)name;
+}
+
+// =============================================================================
+// UI
+// =============================================================================
+
+void nina_toast_show(toast_severity_t sev, const char *msg) {
+    (void)sev;
+    (void)msg;
+}
+
+void nina_toast_show_fmt(toast_severity_t sev, const char *fmt, ...) {
+    (void)sev;
+    (void)fmt;
+}
+
+void nina_event_log_add(event_severity_t sev, int instance, const char *message) {
+    (void)sev;
+    (void)instance;
+    (void)message;
+}
+
+void nina_event_log_add_fmt(event_severity_t sev, int instance, const char *fmt, ...) {
+    (void)sev;
+    (void)instance;
+    (void)fmt;
+}
+
+void nina_alert_trigger(alert_type_t type, int instance, float value) {
+    (void)type;
+    (void)instance;
+    (void)value;
+}
+
+void nina_safety_update(bool connected, bool is_safe) {
+    (void)connected;
+    (void)is_safe;
+}
+
+// =============================================================================
+// esp_http_client (prepared-image download only; never succeeds)
+// =============================================================================
+
+esp_http_client_handle_t esp_http_client_init(const esp_http_client_config_t *config) {
+    (void)config;
+    return NULL;
+}
+
+esp_err_t esp_http_client_open(esp_http_client_handle_t client, int write_len) {
+    (void)client;
+    (void)write_len;
+    return ESP_FAIL;
+}
+
+int64_t esp_http_client_fetch_headers(esp_http_client_handle_t client) {
+    (void)client;
+    return -1;
+}
+
+int esp_http_client_read(esp_http_client_handle_t client, char *buffer, int len) {
+    (void)client;
+    (void)buffer;
+    (void)len;
+    return -1;
+}
+
+int esp_http_client_get_status_code(esp_http_client_handle_t client) {
+    (void)client;
+    return 0;
+}
+
+bool esp_http_client_is_chunked_response(esp_http_client_handle_t client) {
+    (void)client;
+    return false;
+}
+
+esp_err_t esp_http_client_cleanup(esp_http_client_handle_t client) {
+    (void)client;
+    return ESP_OK;
+}
+
+// =============================================================================
+// esp_websocket_client (capturing mock)
+// =============================================================================
+
+struct esp_websocket_client {
+    esp_event_handler_t handler;
+    void *handler_arg;
+    bool started;
+};
+
+static struct esp_websocket_client s_ws;
+static bool s_ws_in_use;
+
+esp_websocket_client_handle_t esp_websocket_client_init(const esp_websocket_client_config_t *config) {
+    (void)config;
+    if (s_ws_in_use) return NULL;   /* one instance is replayed */
+    memset(&s_ws, 0, sizeof(s_ws));
+    s_ws_in_use = true;
+    return &s_ws;
+}
+
+esp_err_t esp_websocket_register_events(esp_websocket_client_handle_t client,
+                                        esp_websocket_event_id_t event,
+                                        esp_event_handler_t event_handler,
+                                        void *event_handler_arg) {
+    if (!client || event != WEBSOCKET_EVENT_ANY) return ESP_ERR_INVALID_ARG;
+    client->handler = event_handler;
+    client->handler_arg = event_handler_arg;
+    return ESP_OK;
+}
+
+esp_err_t esp_websocket_client_start(esp_websocket_client_handle_t client) {
+    if (!client) return ESP_ERR_INVALID_ARG;
+    client->started = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_websocket_client_stop(esp_websocket_client_handle_t client) {
+    if (!client) return ESP_ERR_INVALID_ARG;
+    client->started = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_websocket_client_destroy(esp_websocket_client_handle_t client) {
+    if (client != &s_ws) return ESP_ERR_INVALID_ARG;
+    memset(&s_ws, 0, sizeof(s_ws));
+    s_ws_in_use = false;
+    return ESP_OK;
+}
+
+bool esp_websocket_client_is_connected(esp_websocket_client_handle_t client) {
+    return client && client->started;
+}
+
+bool replay_ws_ready(void) {
+    return s_ws_in_use && s_ws.started && s_ws.handler;
+}
+
+static void ws_post(int32_t event_id, esp_websocket_event_data_t *data) {
+    s_ws.handler(s_ws.handler_arg, "WEBSOCKET_EVENTS", event_id, data);
+}
+
+void replay_ws_connect(void) {
+    if (!replay_ws_ready()) return;
+    esp_websocket_event_data_t data = { .client = &s_ws };
+    ws_post(WEBSOCKET_EVENT_CONNECTED, &data);
+}
+
+void replay_ws_deliver(const char *msg, size_t len, int buffer_size) {
+    if (!replay_ws_ready() || buffer_size <= 0) return;
+    for (size_t off = 0; off < len; off += (size_t)buffer_size) {
+        size_t n = len - off < (size_t)buffer_size ? len - off : (size_t)buffer_size;
+        esp_websocket_event_data_t data = {
+            .data_ptr = msg + off,
+            .data_len = (int)n,
+            .fin = off + n >= len,
+            .op_code = off == 0 ? 0x01 : 0x00,
+            .client = &s_ws,
+            .payload_len = (int)len,
+            .payload_offset = (int)off,
+        };
+        ws_post(WEBSOCKET_EVENT_DATA, &data);
+    }
+}
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Record a simulated NINA session as a replay fixture for bench_nina_replay.
+
+Drives tests/simulator's SessionTimeline (the same state machine
+nina_server.py serves over HTTP/WebSocket) in 1 s ticks without opening any
+sockets, and writes one JSON object per line:
+
+    {"session": ..., "profile": ..., "seed": ..., "ticks": N}      header
+    {"t": 12, "get": "equipment/info", "body": {...}}            REST body
+    {"t": 12, "ws": {"Response": {"Event": "IMAGE-SAVE", ...}}}   WS message
+
+"get" paths are relative to the NINA API base (http://host:port/v2/api/) and
+spelled exactly as the firmware requests them. REST state is sampled every
+--rest-every ticks (default 3 s, close to the firmware's poll cadence) and a
+body is only written when it differs from the previous one for that path; the
+replay keeps serving the last body until the next record. Simulator
+WebSocket events are converted to the NINA Advanced API envelope the firmware
+parses (Response.Event, Response.ImageStatistics, Response.New.Name, ...).
+
+Usage: record_nina_session.py [--ticks N] [--rest-every N] [--seed S]
+                              [--profile P] [out.jsonl]
+Default output: nina_session_fast.jsonl next to this script.
+"""
+import argparse
+import json
+import os
+import random
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "..", "..", "tests"))
+
+from simulator.session_timeline import SessionTimeline  # noqa: E402
+
+# Highest ?index= the recorder snapshots; the HFR store catch-up asks for at
+# most a handful of the newest frames per cycle.
+INDEX_SNAPSHOTS = 4
+
+
+def wrap(data):
+    return {"Response": data, "Error": "", "StatusCode": 200, "Success": True, "Type": "API"}
+
+
+def rest_snapshot(tl):
+    """Every REST path the replay serves, at the timeline's current state."""
+    paths = {
+        "equipment/info": tl.get_equipment_info(),
+        "equipment/camera/info": tl.get_camera_info(),
+        "equipment/filterwheel/info": tl.get_filter_info(),
+        "equipment/guider/info": tl.get_guider_info(),
+        "equipment/mount/info": tl.get_mount_info(),
+        "equipment/focuser/info": tl.get_focuser_info(),
+        "equipment/switch/info": tl.get_switch_info(),
+        "equipment/safetymonitor/info": tl.get_safety_info(),
+        "profile/show": tl.get_profile(),
+        "sequence/json": tl.get_sequence_json(),
+        "image-history": tl.get_image_history(),
+        "image-history?count=true": tl.get_image_history(count_only=True),
+        "image-history?count=true&imageType=LIGHT":
+            tl.get_image_history(count_only=True, image_type="LIGHT"),
+        "image-history?all=true&imageType=LIGHT":
+            tl.get_image_history(all_images=True, image_type="LIGHT"),
+    }
+    for i in range(INDEX_SNAPSHOTS):
+        paths["image-history?index=%d&imageType=LIGHT" % i] = \
+            tl.get_image_history(index=i, image_type="LIGHT")
+    return {k: wrap(v) for k, v in paths.items()}
+
+
+def nina_events(tl, ev):
+    """Convert one simulator event into the NINA Response payload(s)."""
+    name = ev["event"]
+    if name == "IMAGE-SAVE":
+        return [{
+            "Event": name,
+            "ImageStatistics": {
+                "ExposureTime": ev["ExposureTime"],
+                "Index": tl._total_exposures,
+                "Filter": ev["Filter"],
+                "RmsText": "",
+                "Temperature": ev["Temperature"],
+                "CameraName": tl.camera.name,
+                "Gain": ev["Gain"],
+                "Offset": 10,
+                "Date": "2026-10-16T03:00:00.000+00:00",
+                "TelescopeName": tl.telescope,
+                "FocalLength": 1050,
+                "StDev": 48.2,
+                "Mean": 812.5,
+                "Median": 790.0,
+                "Min": 112,
+                "Max": 65535,
+                "Stars": ev["Stars"],
+                "HFR": ev["HFR"],
+                "HFRStDev": 0.31,
+                "IsBayered": False,
+                "TargetName": ev["Target"],
+                "ImageType": "LIGHT",
+                "Filename": "C:\\Astro\\%s\\LIGHT_%04d.fits"
+                            % (ev["Target"].split(" ")[0], tl._total_exposures),
+            },
+        }]
+    if name == "FILTERWHEEL-CHANGED":
+        return [{"Event": name,
+                 "Previous": {"Name": "", "Id": 0},
+                 "New": {"Name": ev["Filter"], "Id": 1}}]
+    if name == "TS-NEWTARGETSTART":
+        return [{"Event": name, "TargetName": ev["Name"], "ProjectName": "Replay",
+                 "Coordinates": {"RA": ev["RA"], "Dec": ev["Dec"]}}]
+    if name == "MERIDIAN-FLIP":
+        return [{"Event": "MOUNT-BEFORE-FLIP"}, {"Event": "MOUNT-AFTER-FLIP"}]
+    out = {"Event": name}
+    out.update({k: v for k, v in ev.items() if k not in ("event", "Name")})
+    return [out]
+
+
+def record(ticks, seed, profile, rest_every, out):
+    random.seed(seed)
+    tl = SessionTimeline(0, profile)
+    out.write(json.dumps({"session": "simulator instance 0", "profile": profile,
+                          "seed": seed, "ticks": ticks}, separators=(",", ":")) + "\n")
+    last = {}
+    for t in range(ticks):
+        snapshot = rest_snapshot(tl) if t % rest_every == 0 else {}
+        for path, body in snapshot.items():
+            text = json.dumps(body, separators=(",", ":"), sort_keys=True)
+            if last.get(path) != text:
+                last[path] = text
+                out.write('{"t":%d,"get":%s,"body":%s}\n' % (t, json.dumps(path), text))
+        for ev in tl.advance(1.0):
+            for resp in nina_events(tl, ev):
+                msg = {"Response": resp, "Error": "", "StatusCode": 200,
+                       "Success": True, "Type": "Socket"}
+                out.write('{"t":%d,"ws":%s}\n' % (t, json.dumps(msg, separators=(",", ":"))))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--ticks", type=int, default=150)
+    ap.add_argument("--rest-every", type=int, default=3)
+    ap.add_argument("--seed", type=int, default=1888)
+    ap.add_argument("--profile", default="fast")
+    ap.add_argument("out", nargs="?", default=os.path.join(HERE, "nina_session_fast.jsonl"))
+    args = ap.parse_args()
+    with open(args.out, "w", newline="\n") as f:
+        record(args.ticks, args.seed, args.profile, args.rest_every, f)
+
+
+if __name__ == "__main__":
+    main()
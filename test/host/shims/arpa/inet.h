@@ -0,0 +1,8 @@
+#pragma once
+/* Host shim for arpa/inet.h — the system header plus lwIP's reentrant
+ * inet_ntoa_r(), which firmware (nina_client_resolve_host) uses and libc
+ * lacks. Implemented in shims.c. */
+
+#include_next <arpa/inet.h>
+
+char *inet_ntoa_r(struct in_addr addr, char *buf, int buflen);
@@ -15,11 +15,24 @@ typedef enum {
 #define ESP_LOG_LEVEL(level, tag, format, ...) \
     fprintf(stderr, "[%d/%s] " format "\n", (int)(level), tag, ##__VA_ARGS__)
 
-#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGI(tag, format, ...) fprintf(stderr, "I (%s) " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGD(tag, format, ...) fprintf(stderr, "D (%s) " format "\n", tag, ##__VA_ARGS__)
-#define ESP_LOGV(tag, format, ...) fprintf(stderr, "V (%s) " format "\n", tag, ##__VA_ARGS__)
+/* Compile-time verbosity, like CONFIG_LOG_MAXIMUM_LEVEL on the device.
+ * Everything prints by default; a target whose timing would be skewed by
+ * stderr traffic (e.g. bench_nina_replay) defines a lower level. */
+#ifndef NINA_HOST_LOG_LEVEL
+#define NINA_HOST_LOG_LEVEL ESP_LOG_VERBOSE
+#endif
+
+#define NINA_HOST_LOG(level, letter, tag, format, ...) \
+    do { \
+        if (NINA_HOST_LOG_LEVEL >= (level)) \
+            fprintf(stderr, letter " (%s) " format "\n", tag, ##__VA_ARGS__); \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) NINA_HOST_LOG(ESP_LOG_ERROR, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) NINA_HOST_LOG(ESP_LOG_WARN, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) NINA_HOST_LOG(ESP_LOG_INFO, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) NINA_HOST_LOG(ESP_LOG_DEBUG, "D", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) NINA_HOST_LOG(ESP_LOG_VERBOSE, "V", tag, format, ##__VA_ARGS__)
 
 /* Buffer/hex dump helpers occasionally used by firmware code; no-ops on host. */
 #define ESP_LOG_BUFFER_HEX(tag, buffer, buff_len) \
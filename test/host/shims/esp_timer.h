@@ -7,6 +7,8 @@
  * overridden, the fake value sticks until shim_reset_time() is called.
  */
 
+#include "esp_err.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -15,6 +17,25 @@ extern "C" {
 
 int64_t esp_timer_get_time(void);
 
+/* One-shot/periodic timers: accepted and tracked as handles, but they never
+ * fire on host (there is no timer task). Implemented in shims.c. */
+typedef struct esp_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef struct {
+    esp_timer_cb_t callback;
+    void *arg;
+    int dispatch_method;
+    const char *name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+
 /* Test-only controls (declared here, implemented in shims.c). */
 void shim_set_time_us(int64_t us);
 void shim_reset_time(void); /* Return to real monotonic clock. */
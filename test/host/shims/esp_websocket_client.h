@@ -0,0 +1,68 @@
+#pragma once
+/* Host shim for esp_websocket_client.h — type/declaration surface only.
+ *
+ * Like esp_http_client.h, no function here is implemented: a target that
+ * links main/nina_websocket.c supplies its own mock (see
+ * test/host/bench/replay/replay_stubs.c, which captures the registered event
+ * handler so recorded frames can be delivered to it). */
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef const char *esp_event_base_t;
+typedef void (*esp_event_handler_t)(void *handler_args, esp_event_base_t base,
+                                    int32_t event_id, void *event_data);
+
+typedef struct esp_websocket_client *esp_websocket_client_handle_t;
+
+typedef enum {
+    WEBSOCKET_EVENT_ANY = -1,
+    WEBSOCKET_EVENT_ERROR = 0,
+    WEBSOCKET_EVENT_CONNECTED,
+    WEBSOCKET_EVENT_DISCONNECTED,
+    WEBSOCKET_EVENT_DATA,
+    WEBSOCKET_EVENT_CLOSED,
+    WEBSOCKET_EVENT_BEFORE_CONNECT,
+    WEBSOCKET_EVENT_BEGIN,
+    WEBSOCKET_EVENT_FINISH,
+} esp_websocket_event_id_t;
+
+typedef struct {
+    const char *data_ptr;
+    int data_len;
+    bool fin;
+    uint8_t op_code;
+    esp_websocket_client_handle_t client;
+    void *user_context;
+    int payload_len;
+    int payload_offset;
+} esp_websocket_event_data_t;
+
+typedef struct {
+    const char *uri;
+    const char *host;
+    int port;
+    const char *path;
+    int buffer_size;
+    int task_stack;
+    int task_prio;
+    int reconnect_timeout_ms;
+    int network_timeout_ms;
+    bool disable_auto_reconnect;
+    int ping_interval_sec;
+    int pingpong_timeout_sec;
+    bool disable_pingpong_discon;
+    void *user_context;
+    const char *headers;
+} esp_websocket_client_config_t;
+
+esp_websocket_client_handle_t esp_websocket_client_init(const esp_websocket_client_config_t *config);
+esp_err_t esp_websocket_register_events(esp_websocket_client_handle_t client,
+                                        esp_websocket_event_id_t event,
+                                        esp_event_handler_t event_handler,
+                                        void *event_handler_arg);
+esp_err_t esp_websocket_client_start(esp_websocket_client_handle_t client);
+esp_err_t esp_websocket_client_stop(esp_websocket_client_handle_t client);
+esp_err_t esp_websocket_client_destroy(esp_websocket_client_handle_t client);
+bool esp_websocket_client_is_connected(esp_websocket_client_handle_t client);
@@ -0,0 +1,12 @@
+#pragma once
+/* Host shim for esp_wifi_types.h — just the record type perf_monitor.h
+ * names in a prototype. */
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    int8_t  rssi;
+} wifi_ap_record_t;
@@ -0,0 +1,8 @@
+#pragma once
+/* Host shim for freertos/event_groups.h — handle type only, for headers
+ * (main/tasks.h) that declare EventGroupHandle_t globals. */
+
+#include "freertos/FreeRTOS.h"
+
+typedef void *EventGroupHandle_t;
+typedef TickType_t EventBits_t;
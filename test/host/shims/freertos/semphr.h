@@ -14,6 +14,16 @@ static inline SemaphoreHandle_t xSemaphoreCreateMutex(void)
     return malloc(1);
 }
 
+typedef struct {
+    int dummy;
+} StaticSemaphore_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *buf)
+{
+    /* Caller-owned storage doubles as the handle; never freed. */
+    return (SemaphoreHandle_t)buf;
+}
+
 static inline SemaphoreHandle_t xSemaphoreCreateBinary(void)
 {
     return malloc(1);
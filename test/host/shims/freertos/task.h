@@ -3,6 +3,15 @@
 
 #include "freertos/FreeRTOS.h"
 
+typedef enum {
+    eRunning = 0,
+    eReady,
+    eBlocked,
+    eSuspended,
+    eDeleted,
+    eInvalid,
+} eTaskState;
+
 static inline void vTaskDelay(TickType_t ticks)
 {
     (void)ticks;
@@ -20,3 +29,9 @@ static inline TickType_t xTaskGetTickCount(void)
 {
     return 0;
 }
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdPASS;
+}
@@ -0,0 +1,13 @@
+/* Force-included into every host test translation unit (see
+ * test/host/CMakeLists.txt). Declares the newlib string extensions that
+ * firmware sources use but older glibc (< 2.38) does not provide; the
+ * matching fallback definitions live in shims.c. */
+#pragma once
+
+#include <string.h>  /* pulls in <features.h>, which defines __GLIBC__ */
+
+#if defined(__GLIBC__) && !defined(__APPLE__) && \
+    (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+#define NINA_HOST_NEED_STRLCPY 1
+size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
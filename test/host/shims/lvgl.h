@@ -0,0 +1,9 @@
+#pragma once
+/* Host shim for lvgl.h — opaque object type only.
+ *
+ * Enough for UI headers that merely declare lv_obj_t-taking functions
+ * (nina_toast.h, nina_graph_overlay.h, ...) to compile when a host target
+ * includes them for their non-LVGL declarations. No LVGL API is provided;
+ * a test that calls into LVGL must not use this shim. */
+
+typedef struct _lv_obj_t lv_obj_t;
@@ -3,6 +3,8 @@
 
 #include "esp_timer.h"
 
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #if defined(_WIN32)
@@ -50,3 +52,67 @@ int64_t esp_timer_get_time(void)
     }
     return monotonic_time_us();
 }
+
+struct esp_timer {
+    esp_timer_create_args_t args;
+    bool armed;
+};
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle)
+{
+    if (!args || !out_handle) return ESP_ERR_INVALID_ARG;
+    struct esp_timer *t = calloc(1, sizeof(*t));
+    if (!t) return ESP_ERR_NO_MEM;
+    t->args = *args;
+    *out_handle = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    (void)timeout_us;
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    timer->armed = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
+{
+    return esp_timer_start_once(timer, period_us);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    if (!timer) return ESP_ERR_INVALID_ARG;
+    if (!timer->armed) return ESP_ERR_INVALID_STATE;
+    timer->armed = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    free(timer);
+    return ESP_OK;
+}
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+
+char *inet_ntoa_r(struct in_addr addr, char *buf, int buflen)
+{
+    return (char *)inet_ntop(AF_INET, &addr, buf, (socklen_t)buflen);
+}
+#endif
+
+#ifdef NINA_HOST_NEED_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+    if (size > 0) {
+        size_t n = (len < size - 1) ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
@@ -0,0 +1,324 @@
+/* Host test for main/config_tlv.c — tagged per-field config encoding behind
+ * the NVS config store in app_config.c, and its schema in settings_table.c.
+ *
+ * Covers: schema validation (bounds, tag collisions), encode/decode round
+ * trip of every bucket, decoding onto defaults (missing, unknown, resized
+ * and retyped records), strings stored without their slack, dirty-bucket
+ * tracking, malformed input, and the real app_config_t schema: unique tags,
+ * every field but config_version stored exactly once, and a full round trip
+ * of a populated config.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_config_tlv ...)).
+ */
+
+#include "config_tlv.h"
+#include "app_config.h"
+#include "settings_table.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = strcmp(got, want) == 0;
+    printf("%-56s %s\n", label, ok ? "OK" : "FAIL");
+    if (!ok) {
+        printf("    got:  \"%s\"\n    want: \"%s\"\n", got, want);
+        fails++;
+    }
+}
+
+/* settings_table.c's theme_index row references themes_get_count(); the real
+ * one lives in ui/themes.c, which pulls in LVGL. */
+int themes_get_count(void) { return 9; }
+
+typedef struct {
+    uint32_t count;
+    char     name[24];
+    uint8_t  flags[4];
+    float    ratio;
+    uint16_t port;
+} small_cfg_t;
+
+#define ROW(field, kind) \
+    { #field, offsetof(small_cfg_t, field), sizeof(((small_cfg_t *)0)->field), \
+      __alignof__(((small_cfg_t *)0)->field), kind, 0 }
+
+static config_tlv_field_t small_fields[] = {
+    ROW(count, CONFIG_TLV_RAW),
+    ROW(name,  CONFIG_TLV_STR),
+    ROW(flags, CONFIG_TLV_ARRAY),
+    ROW(ratio, CONFIG_TLV_RAW),
+    ROW(port,  CONFIG_TLV_RAW),
+};
+
+static config_tlv_schema_t small_schema(void) {
+    config_tlv_schema_t s;
+    config_tlv_schema_init(&s, small_fields, 5, sizeof(small_cfg_t));
+    return s;
+}
+
+static small_cfg_t small_defaults(void) {
+    small_cfg_t c;
+    memset(&c, 0, sizeof(c));
+    c.count = 7;
+    strcpy(c.name, "default");
+    c.flags[0] = 1;
+    c.ratio = 0.5f;
+    c.port = 1883;
+    return c;
+}
+
+/* Encode every bucket of @p cfg and decode them onto @p out. */
+static int round_trip(const config_tlv_schema_t *s, const void *cfg, void *out) {
+    static uint8_t buf[16384];
+    int fields = 0;
+    for (int b = 0; b < CONFIG_TLV_BUCKETS; b++) {
+        size_t n = config_tlv_encode_bucket(s, cfg, b, buf, sizeof(buf));
+        if (n == 0 || n > config_tlv_bucket_max(s, b)) return -1;
+        int r = config_tlv_decode(s, buf, n, out);
+        if (r < 0) return -1;
+        fields += r;
+    }
+    return fields;
+}
+
+/* Append one record to @p buf at @p *n. */
+static void put_rec(uint8_t *buf, size_t *n, const char *name, const void *data, uint16_t len) {
+    uint32_t tag = config_tlv_tag(name);
+    for (int b = 0; b < 4; b++) buf[(*n)++] = (uint8_t)(tag >> (8 * b));
+    buf[(*n)++] = (uint8_t)len;
+    buf[(*n)++] = (uint8_t)(len >> 8);
+    memcpy(buf + *n, data, len);
+    *n += len;
+}
+
+static void test_schema_init(void) {
+    config_tlv_schema_t s;
+    config_tlv_field_t out_of_range[] = {
+        { "a", 0, 4, 4, CONFIG_TLV_RAW, 0 },
+        { "b", 6, 4, 4, CONFIG_TLV_RAW, 0 },
+    };
+    expect_true("field past the struct rejected", !config_tlv_schema_init(&s, out_of_range, 2, 8));
+    config_tlv_field_t dup[] = {
+        { "same", 0, 4, 4, CONFIG_TLV_RAW, 0 },
+        { "same", 4, 4, 4, CONFIG_TLV_RAW, 0 },
+    };
+    expect_true("duplicate tag rejected", !config_tlv_schema_init(&s, dup, 2, 8));
+    expect_true("small schema accepted",
+                config_tlv_schema_init(&s, small_fields, 5, sizeof(small_cfg_t)));
+    int sorted = 1;
+    for (size_t i = 1; i < s.count; i++) sorted &= s.fields[i - 1].tag < s.fields[i].tag;
+    expect_true("  sorted by tag", sorted);
+    expect_true("tags are never 0", config_tlv_tag("") != 0);
+}
+
+static void test_round_trip(void) {
+    config_tlv_schema_t s = small_schema();
+    small_cfg_t a = small_defaults();
+    a.count = 123456;
+    strcpy(a.name, "observatory");
+    memcpy(a.flags, "\x01\x02\x03\x04", 4);
+    a.ratio = -2.25f;
+    a.port = 8883;
+
+    small_cfg_t b = small_defaults();
+    expect_int("every field restored", round_trip(&s, &a, &b), 5);
+    expect_true("  values identical", memcmp(&a, &b, sizeof(a)) == 0);
+}
+
+static void test_string_slack(void) {
+    config_tlv_schema_t s = small_schema();
+    small_cfg_t a = small_defaults();
+    memset(a.name, 'x', sizeof(a.name));
+    strcpy(a.name, "ab");       /* slack after the NUL is garbage */
+
+    const config_tlv_field_t *f = NULL;
+    for (size_t i = 0; i < s.count; i++)
+        if (strcmp(s.fields[i].name, "name") == 0) f = &s.fields[i];
+    uint8_t buf[256];
+    size_t n = config_tlv_encode_bucket(&s, &a, config_tlv_bucket(f->tag), buf, sizeof(buf));
+    expect_true("string stored without its slack", n < config_tlv_bucket_max(&s, config_tlv_bucket(f->tag)));
+
+    small_cfg_t b = small_defaults();
+    memset(b.name, 'y', sizeof(b.name));
+    config_tlv_decode(&s, buf, n, &b);
+    char zeros[sizeof(b.name) - 3] = { 0 };
+    expect_str("  restored", b.name, "ab");
+    expect_true("  rest of the field zeroed", memcmp(b.name + 3, zeros, sizeof(zeros)) == 0);
+
+    memset(a.name, 'z', sizeof(a.name));   /* unterminated */
+    n = config_tlv_encode_bucket(&s, &a, config_tlv_bucket(f->tag), buf, sizeof(buf));
+    config_tlv_decode(&s, buf, n, &b);
+    expect_int("unterminated string truncated to fit", (long)strlen(b.name), sizeof(b.name) - 1);
+}
+
+static void test_decode_onto_defaults(void) {
+    config_tlv_schema_t s = small_schema();
+    uint8_t buf[256] = { CONFIG_TLV_FORMAT, 0 };
+    size_t n = CONFIG_TLV_HDR;
+
+    uint32_t count = 99;
+    put_rec(buf, &n, "count", &count, sizeof(count));
+    put_rec(buf, &n, "removed_field", "junk", 4);            /* no such field */
+    uint8_t port8 = 5;
+    put_rec(buf, &n, "port", &port8, 1);                      /* type changed */
+    put_rec(buf, &n, "flags", "\x09\x08", 2);                 /* array grew since */
+    char longname[40];
+    memset(longname, 'n', sizeof(longname));
+    put_rec(buf, &n, "name", longname, sizeof(longname));     /* string shrank since */
+
+    small_cfg_t c = small_defaults();
+    int r = config_tlv_decode(&s, buf, n, &c);
+    expect_int("known records applied", r, 3);
+    expect_int("  scalar restored", c.count, 99);
+    expect_int("  retyped scalar keeps its default", c.port, 1883);
+    expect_true("  array prefix restored, tail keeps default",
+                c.flags[0] == 9 && c.flags[1] == 8 && c.flags[2] == 0);
+    expect_int("  oversized string truncated", (long)strlen(c.name), sizeof(c.name) - 1);
+    expect_true("  field without a record keeps its default", c.ratio == 0.5f);
+}
+
+static void test_malformed(void) {
+    config_tlv_schema_t s = small_schema();
+    small_cfg_t c = small_defaults();
+    uint8_t bad_fmt[] = { CONFIG_TLV_FORMAT + 1, 0 };
+    expect_int("unknown format rejected", config_tlv_decode(&s, bad_fmt, 2, &c), -1);
+    expect_int("short header rejected", config_tlv_decode(&s, bad_fmt, 1, &c), -1);
+
+    uint8_t buf[64] = { CONFIG_TLV_FORMAT, 0 };
+    size_t n = CONFIG_TLV_HDR;
+    uint32_t count = 42;
+    put_rec(buf, &n, "count", &count, sizeof(count));
+    uint16_t port = 99;
+    put_rec(buf, &n, "port", &port, sizeof(port));
+    expect_int("truncated record rejected", config_tlv_decode(&s, buf, n - 1, &c), -1);
+    expect_true("  records before it still applied", c.count == 42 && c.port == 1883);
+    expect_int("truncated record header rejected",
+               config_tlv_decode(&s, buf, CONFIG_TLV_HDR + 3, &c), -1);
+    expect_int("empty bucket decodes to nothing",
+               config_tlv_decode(&s, buf, CONFIG_TLV_HDR, &c), 0);
+
+    uint8_t tiny[4];
+    expect_int("encode into a too-small buffer returns 0",
+               (long)config_tlv_encode_bucket(&s, &c, config_tlv_bucket(config_tlv_tag("count")),
+                                              tiny, sizeof(tiny)), 0);
+}
+
+static void test_dirty(void) {
+    config_tlv_schema_t s = small_schema();
+    small_cfg_t a = small_defaults(), b = small_defaults();
+    expect_int("identical configs: nothing dirty", config_tlv_dirty_buckets(&s, &a, &b), 0);
+
+    memset(b.name + 10, 'q', 5);           /* slack only */
+    expect_int("string slack ignored", config_tlv_dirty_buckets(&s, &a, &b), 0);
+
+    b.port = 1;
+    expect_int("one field: its bucket only", config_tlv_dirty_buckets(&s, &a, &b),
+               1L << config_tlv_bucket(config_tlv_tag("port")));
+    strcpy(b.name, "changed");
+    uint32_t want = (1u << config_tlv_bucket(config_tlv_tag("port"))) |
+                    (1u << config_tlv_bucket(config_tlv_tag("name")));
+    expect_int("two fields: union of their buckets", config_tlv_dirty_buckets(&s, &a, &b), want);
+}
+
+static int cmp_offset(const void *x, const void *y) {
+    const config_tlv_field_t *a = x, *b = y;
+    return (int)a->offset - (int)b->offset;
+}
+
+/* The real schema: every app_config_t field except config_version must be in
+ * SETTINGS_TABLE or CONFIG_STORE_EXTRA_FIELDS. Walk the fields by offset;
+ * any hole larger than the alignment padding before the next field is a
+ * field that would silently not be persisted. */
+static void test_app_config_schema(void) {
+    const config_tlv_schema_t *s = settings_store_schema();
+    expect_true("app_config_t schema builds (no tag collision)", s != NULL);
+    if (!s) return;
+    expect_true("  same schema on every call", settings_store_schema() == s);
+
+    config_tlv_field_t *by_off = malloc(s->count * sizeof(*by_off));
+    memcpy(by_off, s->fields, s->count * sizeof(*by_off));
+    qsort(by_off, s->count, sizeof(*by_off), cmp_offset);
+
+    size_t cursor = sizeof(((app_config_t *)0)->config_version);
+    int holes = 0;
+    for (size_t i = 0; i < s->count; i++) {
+        size_t pad = (by_off[i].align - cursor % by_off[i].align) % by_off[i].align;
+        if (by_off[i].offset != cursor + pad) {
+            printf("    unstored bytes %zu..%zu before \"%s\"\n",
+                   cursor, (size_t)by_off[i].offset, by_off[i].name);
+            holes++;
+        }
+        cursor = by_off[i].offset + by_off[i].size;
+    }
+    size_t tail = sizeof(app_config_t) - cursor;
+    expect_int("every field stored once", holes, 0);
+    expect_true("  up to the end of the struct", tail < __alignof__(app_config_t));
+    free(by_off);
+
+    static app_config_t a, b;
+    memset(&a, 0, sizeof(a));
+    settings_defaults_apply(&a);
+    strcpy(a.api_url[1], "http://astro-pc:1888/v2/api");
+    strcpy(a.admin_password, "hunter22");
+    strcpy(a.wifi_networks[2].ssid, "obs-5g");
+    a.instance_enabled[2] = true;
+    a.toast_notify_mask = 0xA5A5A5A5u;
+    a.auto_rotate_order2[15] = 7;
+    a.moon_roll_offset = 12.5f;
+    a.ha_update_interval_s = 77;
+
+    memset(&b, 0, sizeof(b));
+    settings_defaults_apply(&b);
+    int n = round_trip(s, &a, &b);
+    expect_int("populated app_config_t round trips", n, (long)s->count);
+    b.config_version = a.config_version;
+    expect_int("  nothing differs afterwards", config_tlv_dirty_buckets(s, &a, &b), 0);
+    expect_str("  nested array string", b.wifi_networks[2].ssid, "obs-5g");
+    expect_true("  scalars", b.toast_notify_mask == 0xA5A5A5A5u && b.ha_update_interval_s == 77);
+
+    /* A typical web UI save touches one or two fields. */
+    b.brightness = 80;
+    uint32_t mask = config_tlv_dirty_buckets(s, &a, &b);
+    expect_int("one changed setting dirties one section", __builtin_popcount(mask), 1);
+
+    size_t largest = 0;
+    for (int k = 0; k < CONFIG_TLV_BUCKETS; k++) {
+        size_t m = config_tlv_bucket_max(s, k);
+        if (m > largest) largest = m;
+    }
+    printf("    %zu fields, largest section %zu bytes, struct %zu bytes\n",
+           s->count, largest, sizeof(app_config_t));
+}
+
+int main(void) {
+    test_schema_init();
+    test_round_trip();
+    test_string_slack();
+    test_decode_onto_defaults();
+    test_malformed();
+    test_dirty();
+    test_app_config_schema();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
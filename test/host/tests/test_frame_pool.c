@@ -0,0 +1,236 @@
+/* Host test for main/frame_pool.c — fixed frame slots with ownership handoff.
+ *
+ * Covers: lazy slot fill and reuse (no allocation once warm), the producer ->
+ * prefetch -> source -> display handoff chain, one-off fallback for oversized
+ * requests and an exhausted pool (freed by release), occupancy stats and the
+ * high-water mark, trim of idle slots only, and a simulated night of
+ * slideshow rotation that must stop allocating after the first frames.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_frame_pool ...)).
+ */
+
+#include "frame_pool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static int allocs = 0;
+static int frees = 0;
+static int fail_next_alloc = 0;
+
+static void *test_alloc(size_t n) {
+    if (fail_next_alloc) {
+        fail_next_alloc = 0;
+        return NULL;
+    }
+    allocs++;
+    return malloc(n);
+}
+
+static void test_free(void *p) {
+    frees++;
+    free(p);
+}
+
+static void reset_counts(void) {
+    allocs = 0;
+    frees = 0;
+}
+
+static void test_lazy_fill_and_reuse(void) {
+    frame_pool_t pool;
+    reset_counts();
+    frame_pool_init(&pool, 3, 1024, test_alloc, test_free);
+    expect_int("init allocates nothing", allocs, 0);
+
+    uint8_t *a = frame_pool_acquire(&pool, 1000, FRAME_OWNER_PRODUCER);
+    expect_true("first acquire returns a buffer", a != NULL);
+    expect_int("  and fills one slot", allocs, 1);
+    frame_pool_release(&pool, a);
+    expect_int("release keeps the slot memory", frees, 0);
+
+    uint8_t *b = frame_pool_acquire(&pool, 512, FRAME_OWNER_PRODUCER);
+    expect_true("next acquire reuses the warm slot", b == a);
+    expect_int("  without allocating", allocs, 1);
+
+    uint8_t *c = frame_pool_acquire(&pool, 1024, FRAME_OWNER_DISPLAY);
+    expect_true("a second owner gets a different slot", c && c != b);
+    expect_int("  filled lazily", allocs, 2);
+
+    frame_pool_stats_t st;
+    frame_pool_get_stats(&pool, &st);
+    expect_int("stats: 3 slots", st.slots, 3);
+    expect_int("stats: 2 allocated", st.allocated, 2);
+    expect_int("stats: 1 producer", st.owned[FRAME_OWNER_PRODUCER], 1);
+    expect_int("stats: 1 display", st.owned[FRAME_OWNER_DISPLAY], 1);
+    expect_int("stats: no idle slot", st.owned[FRAME_OWNER_FREE], 0);
+    expect_int("stats: 3 hits", st.hits, 3);
+    expect_int("stats: high water 2", st.high_water, 2);
+
+    frame_pool_release(&pool, b);
+    frame_pool_release(&pool, c);
+    frame_pool_trim(&pool);
+    expect_int("trim frees both idle slots", frees, 2);
+    frame_pool_get_stats(&pool, &st);
+    expect_int("  nothing allocated after trim", st.allocated, 0);
+}
+
+static void test_handoff_chain(void) {
+    frame_pool_t pool;
+    reset_counts();
+    frame_pool_init(&pool, 4, 256, test_alloc, test_free);
+
+    uint8_t *f = frame_pool_acquire(&pool, 256, FRAME_OWNER_PRODUCER);
+    expect_int("decoded frame starts as producer", frame_pool_owner(&pool, f), FRAME_OWNER_PRODUCER);
+    expect_true("handoff to prefetch", frame_pool_handoff(&pool, f, FRAME_OWNER_PREFETCH));
+    expect_int("  owner is prefetch", frame_pool_owner(&pool, f), FRAME_OWNER_PREFETCH);
+    expect_true("handoff to source", frame_pool_handoff(&pool, f, FRAME_OWNER_SOURCE));
+    expect_int("  owner is source", frame_pool_owner(&pool, f), FRAME_OWNER_SOURCE);
+
+    uint8_t *d = frame_pool_acquire(&pool, 200, FRAME_OWNER_DISPLAY);
+    expect_true("display copy is its own slot", d && d != f);
+
+    frame_pool_release(&pool, f);
+    expect_int("released source is free", frame_pool_owner(&pool, f), FRAME_OWNER_FREE);
+    expect_true("handoff of a released slot refused", !frame_pool_handoff(&pool, f, FRAME_OWNER_SOURCE));
+    expect_true("handoff to FREE refused", !frame_pool_handoff(&pool, d, FRAME_OWNER_FREE));
+    expect_true("handoff of NULL refused", !frame_pool_handoff(&pool, NULL, FRAME_OWNER_SOURCE));
+
+    uint8_t *z = frame_pool_acquire(&pool, 10, FRAME_OWNER_FREE);
+    expect_true("acquire for FREE refused", z == NULL);
+
+    frame_pool_release(&pool, NULL);
+    frame_pool_release(&pool, d);
+    frame_pool_trim(&pool);
+}
+
+static void test_fallbacks(void) {
+    frame_pool_t pool;
+    reset_counts();
+    frame_pool_init(&pool, 2, 128, test_alloc, test_free);
+
+    uint8_t *big = frame_pool_acquire(&pool, 4096, FRAME_OWNER_PRODUCER);
+    expect_true("oversized request still served", big != NULL);
+    expect_int("  by a one-off allocation", allocs, 1);
+    expect_true("  that is not a slot", !frame_pool_handoff(&pool, big, FRAME_OWNER_SOURCE));
+
+    uint8_t *s1 = frame_pool_acquire(&pool, 128, FRAME_OWNER_SOURCE);
+    uint8_t *s2 = frame_pool_acquire(&pool, 128, FRAME_OWNER_DISPLAY);
+    uint8_t *s3 = frame_pool_acquire(&pool, 128, FRAME_OWNER_DISPLAY);
+    expect_true("exhausted pool falls back", s1 && s2 && s3 && s3 != s1 && s3 != s2);
+
+    frame_pool_stats_t st;
+    frame_pool_get_stats(&pool, &st);
+    expect_int("stats: 2 fallbacks", st.fallbacks, 2);
+
+    frame_pool_release(&pool, big);
+    frame_pool_release(&pool, s3);
+    expect_int("release frees one-off buffers", frees, 2);
+    uint8_t *foreign = malloc(32);
+    frame_pool_release(&pool, foreign);
+    expect_int("release frees a buffer the pool never saw", frees, 3);
+
+    frame_pool_release(&pool, s1);
+    frame_pool_trim(&pool);     /* frees s1's slot; s2 stays owned */
+    frame_pool_get_stats(&pool, &st);
+    expect_int("trim leaves the owned slot", st.allocated, 1);
+
+    fail_next_alloc = 1;
+    uint8_t *none = frame_pool_acquire(&pool, 128, FRAME_OWNER_PRODUCER);
+    expect_true("slot fill failure falls through to one-off", none != NULL);
+    expect_int("  the empty slot stays free", frame_pool_owner(&pool, none), FRAME_OWNER_FREE);
+    frame_pool_release(&pool, none);
+    frame_pool_release(&pool, s2);
+    frame_pool_trim(&pool);
+}
+
+/* Slideshow loop in the shape goes_poll_task drives it: the producer decodes
+ * the next image ahead of time, the swap moves it to the source and retires
+ * the old source, the display copies the source into the back slot and
+ * retires the old front. */
+static void test_steady_state(void) {
+    frame_pool_t pool;
+    reset_counts();
+    frame_pool_init(&pool, 6, 4096, test_alloc, test_free);
+
+    uint8_t *source = NULL, *prefetch = NULL;
+    uint8_t *front = NULL, *back = NULL;
+    int warm_allocs = -1;
+
+    for (int frame = 0; frame < 1000; frame++) {
+        uint8_t *next = frame_pool_acquire(&pool, 1000 + (frame % 7) * 400, FRAME_OWNER_PRODUCER);
+        memset(next, frame & 0xFF, 1000);
+        frame_pool_handoff(&pool, next, FRAME_OWNER_PREFETCH);
+        if (prefetch) frame_pool_release(&pool, prefetch);
+        prefetch = next;
+
+        frame_pool_handoff(&pool, prefetch, FRAME_OWNER_SOURCE);
+        frame_pool_release(&pool, source);
+        source = prefetch;
+        prefetch = NULL;
+
+        back = frame_pool_acquire(&pool, 900 + (frame % 5) * 600, FRAME_OWNER_DISPLAY);
+        memcpy(back, source, 900);
+        frame_pool_release(&pool, front);
+        front = back;
+        back = NULL;
+
+        if (frame == 10) warm_allocs = allocs;
+    }
+
+    frame_pool_stats_t st;
+    frame_pool_get_stats(&pool, &st);
+    expect_true("rotation stops allocating once warm", allocs == warm_allocs);
+    expect_int("  no one-off buffers", st.fallbacks, 0);
+    expect_int("  and frees nothing", frees, 0);
+    expect_int("  source slot held", st.owned[FRAME_OWNER_SOURCE], 1);
+    expect_int("  display slot held", st.owned[FRAME_OWNER_DISPLAY], 1);
+    expect_true("  high water within the pool", st.high_water <= 6);
+
+    frame_pool_release(&pool, source);
+    frame_pool_release(&pool, front);
+    frame_pool_trim(&pool);
+    expect_int("every slot freed after trim", frees, allocs);
+}
+
+static void test_init_clamps(void) {
+    frame_pool_t pool;
+    frame_pool_init(&pool, 100, 64, test_alloc, test_free);
+    expect_int("slot count clamped", pool.count, FRAME_POOL_MAX_SLOTS);
+    frame_pool_init(&pool, -1, 64, test_alloc, test_free);
+    expect_int("negative slot count clamped", pool.count, 0);
+    reset_counts();
+    uint8_t *p = frame_pool_acquire(&pool, 64, FRAME_OWNER_SOURCE);
+    expect_true("zero-slot pool still serves", p != NULL);
+    frame_pool_release(&pool, p);
+    expect_int("  and frees", frees, 1);
+}
+
+int main(void) {
+    test_lazy_fill_and_reuse();
+    test_handoff_chain();
+    test_fallbacks();
+    test_steady_state();
+    test_init_clamps();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
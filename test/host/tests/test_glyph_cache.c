@@ -0,0 +1,312 @@
+/* Host test for main/ui/glyph_rle.c and main/ui/glyph_cache.c — compressed
+ * font glyph decoding and the bounded LRU the decoded bitmaps live in.
+ *
+ * Covers: a hand-assembled stream exercising every decoder state (single
+ * values, 1-bit repeats, the 6-bit counter, LVGL's zero-counter case), round
+ * trips through an encoder that mirrors compress_fonts.py for 1/2/4/8 bpp
+ * with and without the row prefilter, reported stream lengths, and the
+ * cache's hit/miss accounting, LRU eviction by bytes and by entry count,
+ * oversized glyphs, allocation failure and clear.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_glyph_cache ...)).
+ */
+
+#include "glyph_cache.h"
+#include "glyph_rle.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+/* ── Encoder (same algorithm as compress_fonts.py) ── */
+
+typedef struct {
+    uint8_t buf[8192];
+    size_t bits;
+} bit_writer_t;
+
+static void put_bits(bit_writer_t *w, unsigned v, int n) {
+    for (int s = n - 1; s >= 0; s--) {
+        if ((v >> s) & 1) {
+            w->buf[w->bits >> 3] |= (uint8_t)(0x80 >> (w->bits & 7));
+        }
+        w->bits++;
+    }
+}
+
+static size_t encode(const uint8_t *raw, int w, int h, int bpp, int prefilter, uint8_t *out) {
+    static uint8_t px[4096];
+    int n = w * h;
+    for (int i = 0; i < n; i++) {
+        px[i] = (prefilter && i >= w) ? (uint8_t)(raw[i] ^ raw[i - w]) : raw[i];
+    }
+    bit_writer_t *bw = calloc(1, sizeof(*bw));
+    int i = 0;
+    int prev = -1;
+    while (i < n) {
+        int v = px[i++];
+        put_bits(bw, (unsigned)v, bpp);
+        if (v != prev) {
+            prev = v;
+            continue;
+        }
+        int run = 0;
+        while (i + run < n && px[i + run] == v) run++;
+        if (run <= 10) {
+            for (int k = 0; k < run; k++) put_bits(bw, 1, 1);
+            i += run;
+            if (i < n) {
+                put_bits(bw, 0, 1);
+                prev = px[i++];
+                put_bits(bw, (unsigned)prev, bpp);
+            }
+            continue;
+        }
+        if (run > 73) run = 73;
+        for (int k = 0; k < 11; k++) put_bits(bw, 1, 1);
+        put_bits(bw, (unsigned)(run - 10), 6);
+        i += run;
+        if (i < n) {
+            prev = px[i++];
+            put_bits(bw, (unsigned)prev, bpp);
+        }
+    }
+    size_t bytes = (bw->bits + 7) >> 3;
+    memcpy(out, bw->buf, bytes);
+    free(bw);
+    return bytes;
+}
+
+static uint8_t to_opa(uint8_t v, int bpp) {
+    switch (bpp) {
+        case 1: return v ? 255 : 0;
+        case 2: return (uint8_t)(v * 85);
+        case 4: return (uint8_t)(v * 17);
+        default: return v;
+    }
+}
+
+/* ── Decoder ── */
+
+static void test_decode_states(void) {
+    /* 4 bpp, 1 x 20, no prefilter. Values: 3, 5, 5 x 14 (entry pair, 11
+     * repeat bits, counter 2 -> one more repeat), then 9 read at the counter
+     * end, then 7, 7, 7 (entry pair, one repeat bit) and nothing after. */
+    bit_writer_t w;
+    memset(&w, 0, sizeof(w));
+    put_bits(&w, 3, 4);
+    put_bits(&w, 5, 4);
+    put_bits(&w, 5, 4);
+    for (int k = 0; k < 11; k++) put_bits(&w, 1, 1);
+    put_bits(&w, 2, 6);
+    put_bits(&w, 9, 4);
+    put_bits(&w, 7, 4);
+    put_bits(&w, 7, 4);
+    put_bits(&w, 1, 1);
+
+    static const uint8_t want_raw[20] = { 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 9, 7, 7, 7, 0 };
+    uint8_t out[20];
+    size_t used = glyph_rle_decode(w.buf, out, 19, 1, 4, false);
+    int ok = 1;
+    for (int i = 0; i < 19; i++) {
+        if (out[i] != to_opa(want_raw[i], 4)) ok = 0;
+    }
+    expect_true("hand stream: single / repeat / counter states", ok);
+    expect_int("  input bytes reported", (long)used, (long)((w.bits + 7) >> 3));
+
+    /* LVGL's zero counter: the 11th repeat bit is followed by counter 0 and
+     * a new value, which is emitted in place of the 11th repeat. */
+    memset(&w, 0, sizeof(w));
+    put_bits(&w, 1, 4);
+    put_bits(&w, 1, 4);
+    for (int k = 0; k < 11; k++) put_bits(&w, 1, 1);
+    put_bits(&w, 0, 6);
+    put_bits(&w, 6, 4);
+    uint8_t z[13];
+    glyph_rle_decode(w.buf, z, 13, 1, 4, false);
+    ok = z[11] == to_opa(1, 4) && z[12] == to_opa(6, 4);
+    expect_true("zero counter reads the next value (LVGL compat)", ok);
+}
+
+static void test_round_trips(void) {
+    static const int bpps[] = { 1, 2, 4, 8 };
+    static uint8_t raw[4096];
+    static uint8_t packed[8192];
+    static uint8_t out[4096];
+    srand(7);
+    for (size_t b = 0; b < sizeof(bpps) / sizeof(bpps[0]); b++) {
+        int bpp = bpps[b];
+        int max = (1 << bpp) - 1;
+        int ok = 1;
+        int len_ok = 1;
+        for (int trial = 0; trial < 40; trial++) {
+            int w = 1 + rand() % 60;
+            int h = 1 + rand() % 60;
+            /* Glyph-like: long blank runs, solid strokes, a few edge values. */
+            for (int i = 0; i < w * h; i++) {
+                int r = rand() % 100;
+                raw[i] = (uint8_t)(r < 55 ? 0 : r < 85 ? max : rand() % (max + 1));
+                if (i > 0 && rand() % 4) raw[i] = raw[i - 1];
+            }
+            for (int prefilter = 0; prefilter <= 1; prefilter++) {
+                memset(packed, 0, sizeof(packed));
+                size_t bytes = encode(raw, w, h, bpp, prefilter, packed);
+                size_t used = glyph_rle_decode(packed, out, (uint16_t)w, (uint16_t)h,
+                                               (uint8_t)bpp, prefilter);
+                if (used != bytes) len_ok = 0;
+                for (int i = 0; i < w * h; i++) {
+                    if (out[i] != to_opa(raw[i], bpp)) ok = 0;
+                }
+            }
+        }
+        char label[64];
+        snprintf(label, sizeof(label), "%d bpp round trip (prefilter on/off)", bpp);
+        expect_true(label, ok);
+        snprintf(label, sizeof(label), "%d bpp stream length matches encoder", bpp);
+        expect_true(label, len_ok);
+    }
+
+    /* A blank glyph row longer than one counter span. */
+    memset(raw, 0, 300);
+    raw[299] = 15;
+    memset(packed, 0, sizeof(packed));
+    encode(raw, 300, 1, 4, 1, packed);
+    glyph_rle_decode(packed, out, 300, 1, 4, true);
+    expect_true("run longer than the 6-bit counter", out[298] == 0 && out[299] == 255);
+}
+
+static void test_decode_rejects(void) {
+    uint8_t in[4] = { 0 };
+    uint8_t out[4];
+    expect_int("3 bpp unsupported", (long)glyph_rle_decode(in, out, 2, 2, 3, false), 0);
+    expect_int("empty glyph decodes nothing", (long)glyph_rle_decode(in, out, 0, 5, 4, false), 0);
+    expect_true("bpp 4 supported", glyph_rle_bpp_supported(4));
+    expect_true("bpp 3 not supported", !glyph_rle_bpp_supported(3));
+}
+
+/* ── Cache ── */
+
+static int allocs = 0;
+static int frees = 0;
+static int fail_next_alloc = 0;
+
+static void *test_alloc(size_t n) {
+    if (fail_next_alloc) {
+        fail_next_alloc = 0;
+        return NULL;
+    }
+    allocs++;
+    return malloc(n);
+}
+
+static void test_free(void *p) {
+    frees++;
+    free(p);
+}
+
+static const char font_a[] = "a";
+static const char font_b[] = "b";
+
+static void test_hit_miss(void) {
+    glyph_cache_t c;
+    glyph_cache_init(&c, 1000, test_alloc, test_free);
+    expect_true("empty cache misses", glyph_cache_get(&c, font_a, 1) == NULL);
+
+    uint8_t *p = glyph_cache_put(&c, font_a, 1, 100);
+    expect_true("put returns a buffer", p != NULL);
+    memset(p, 0xAB, 100);
+    const uint8_t *g = glyph_cache_get(&c, font_a, 1);
+    expect_true("get returns the same bitmap", g == p && g[99] == 0xAB);
+    expect_true("same gid, other font misses", glyph_cache_get(&c, font_b, 1) == NULL);
+
+    glyph_cache_stats_t st;
+    glyph_cache_get_stats(&c, &st);
+    expect_int("hits", st.hits, 1);
+    expect_int("misses", st.misses, 2);
+    expect_int("entries", st.entries, 1);
+    expect_int("bytes used", (long)st.bytes_used, 100);
+    glyph_cache_clear(&c);
+}
+
+static void test_evict_by_bytes(void) {
+    glyph_cache_t c;
+    allocs = frees = 0;
+    glyph_cache_init(&c, 300, test_alloc, test_free);
+    glyph_cache_put(&c, font_a, 1, 100);
+    glyph_cache_put(&c, font_a, 2, 100);
+    glyph_cache_put(&c, font_a, 3, 100);
+    glyph_cache_get(&c, font_a, 1);               /* 2 is now least recent */
+    glyph_cache_put(&c, font_a, 4, 100);
+    expect_true("LRU glyph evicted", glyph_cache_get(&c, font_a, 2) == NULL);
+    expect_true("recently used glyph kept", glyph_cache_get(&c, font_a, 1) != NULL);
+    expect_true("new glyph cached", glyph_cache_get(&c, font_a, 4) != NULL);
+
+    glyph_cache_put(&c, font_a, 5, 250);          /* needs all but 50 bytes */
+    glyph_cache_stats_t st;
+    glyph_cache_get_stats(&c, &st);
+    expect_true("budget never exceeded", st.bytes_used <= 300);
+    expect_int("large glyph pushed out the rest", st.entries, 1);
+    expect_int("evictions counted", st.evictions, 4);
+    expect_int("evicted buffers freed", frees, 4);
+
+    expect_true("glyph over budget not cached", glyph_cache_put(&c, font_a, 6, 301) == NULL);
+    expect_true("  and nothing evicted for it", glyph_cache_get(&c, font_a, 5) != NULL);
+    glyph_cache_clear(&c);
+    expect_int("clear frees everything", frees, allocs);
+}
+
+static void test_evict_by_count(void) {
+    glyph_cache_t c;
+    glyph_cache_init(&c, 1 << 20, test_alloc, test_free);
+    for (uint32_t gid = 1; gid <= GLYPH_CACHE_MAX_ENTRIES; gid++) {
+        glyph_cache_put(&c, font_b, gid, 8);
+    }
+    glyph_cache_put(&c, font_b, 1000, 8);
+    expect_true("full table evicts the oldest glyph", glyph_cache_get(&c, font_b, 1) == NULL);
+    expect_true("  and caches the new one", glyph_cache_get(&c, font_b, 1000) != NULL);
+    glyph_cache_stats_t st;
+    glyph_cache_get_stats(&c, &st);
+    expect_int("entry count stays at the cap", st.entries, GLYPH_CACHE_MAX_ENTRIES);
+    glyph_cache_clear(&c);
+}
+
+static void test_alloc_failure(void) {
+    glyph_cache_t c;
+    glyph_cache_init(&c, 1000, test_alloc, test_free);
+    fail_next_alloc = 1;
+    expect_true("failed allocation returns NULL", glyph_cache_put(&c, font_a, 1, 10) == NULL);
+    expect_true("  and caches nothing", glyph_cache_get(&c, font_a, 1) == NULL);
+    glyph_cache_stats_t st;
+    glyph_cache_get_stats(&c, &st);
+    expect_int("  and accounts no bytes", (long)st.bytes_used, 0);
+}
+
+int main(void) {
+    test_decode_states();
+    test_round_trips();
+    test_decode_rejects();
+    test_hit_miss();
+    test_evict_by_bytes();
+    test_evict_by_count();
+    test_alloc_failure();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
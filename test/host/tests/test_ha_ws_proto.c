@@ -0,0 +1,246 @@
+/* Host test for main/ha_ws_proto.c — Home Assistant WebSocket API protocol
+ * behind ha_ws_client.c.
+ *
+ * Covers: the auth_required -> auth -> auth_ok -> subscribe_entities
+ * handshake (de-duped entity_ids), auth_invalid and a refused subscription,
+ * the initial "a" event reporting every tile and resolving state and
+ * attributes the REST way (numbers, bools, unavailable), "c" deltas touching
+ * only the tiles they name (state, attribute, removed attribute, unchanged
+ * value -> no change bit), "r" removal, coalesced message arrays, a tile
+ * without an entity, malformed JSON failing the session, and a reconnect
+ * starting over from auth. Messages are the ones a stand-in server
+ * (tests/simulator/ha_server.py) sends.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_ha_ws_proto ...)).
+ */
+
+#include "ha_ws_proto.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = (strcmp(got, want) == 0);
+    printf("%-56s got=\"%s\" want=\"%s\" %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static ha_ws_result_t handle(ha_ws_proto_t *p, const char *msg) {
+    return ha_ws_proto_handle(p, msg, strlen(msg));
+}
+
+static const char *reply_of(ha_ws_result_t r) {
+    return r.reply ? r.reply : "";
+}
+
+/* Tiles: 0 temp state, 1 temp unit attribute, 2 door state, 3 no entity,
+ * 4 light brightness attribute. */
+static void setup(ha_ws_proto_t *p) {
+    ha_ws_proto_init(p, "tok\"en");
+    ha_ws_proto_add_tile(p, "sensor.temp", NULL);
+    ha_ws_proto_add_tile(p, "sensor.temp", "unit_of_measurement");
+    ha_ws_proto_add_tile(p, "binary_sensor.door", "State");
+    ha_ws_proto_add_tile(p, NULL, NULL);
+    ha_ws_proto_add_tile(p, "light.desk", "brightness");
+    ha_ws_proto_begin(p);
+}
+
+#define INITIAL_EVENT \
+    "{\"id\":1,\"type\":\"event\",\"event\":{\"a\":{" \
+    "\"sensor.temp\":{\"s\":\"21.5\",\"a\":{\"unit_of_measurement\":\"C\"},\"c\":\"x\",\"lc\":1}," \
+    "\"binary_sensor.door\":{\"s\":\"off\",\"a\":{}}," \
+    "\"light.desk\":{\"s\":\"on\",\"a\":{\"brightness\":127.5}}}}}"
+
+static void go_live(ha_ws_proto_t *p) {
+    setup(p);
+    handle(p, "{\"type\":\"auth_required\",\"ha_version\":\"2024.1.0\"}");
+    handle(p, "{\"type\":\"auth_ok\",\"ha_version\":\"2024.1.0\"}");
+    handle(p, "{\"id\":1,\"type\":\"result\",\"success\":true,\"result\":null}");
+    handle(p, INITIAL_EVENT);
+}
+
+static void test_handshake(void) {
+    static ha_ws_proto_t p;
+    setup(&p);
+    expect_int("handshake: entity count de-duped", ha_ws_proto_entity_count(&p), 3);
+    expect_int("handshake: begins in auth", p.phase, HA_WS_AUTH);
+
+    ha_ws_result_t r = handle(&p, "{\"type\":\"auth_required\",\"ha_version\":\"2024.1.0\"}");
+    expect_str("handshake: auth reply (token escaped)", reply_of(r),
+               "{\"type\":\"auth\",\"access_token\":\"tok\\\"en\"}");
+    expect_int("handshake: auth reply length", (long)r.reply_len, (long)strlen(reply_of(r)));
+
+    r = handle(&p, "{\"type\":\"auth_ok\",\"ha_version\":\"2024.1.0\"}");
+    expect_str("handshake: subscribe_entities", reply_of(r),
+               "{\"id\":1,\"type\":\"subscribe_entities\","
+               "\"entity_ids\":[\"sensor.temp\",\"binary_sensor.door\",\"light.desk\"]}");
+    expect_int("handshake: subscribing", p.phase, HA_WS_SUBSCRIBING);
+
+    r = handle(&p, "{\"id\":1,\"type\":\"result\",\"success\":true,\"result\":null}");
+    expect_true("handshake: result -> no reply", r.reply == NULL);
+    expect_int("handshake: result -> still subscribing", p.phase, HA_WS_SUBSCRIBING);
+
+    r = handle(&p, "{\"id\":7,\"type\":\"event\",\"event\":{\"a\":{}}}");
+    expect_int("handshake: other id's event ignored", p.phase, HA_WS_SUBSCRIBING);
+
+    r = handle(&p, INITIAL_EVENT);
+    expect_int("handshake: initial event -> live", p.phase, HA_WS_LIVE);
+    expect_int("handshake: every tile reported", (long)r.changed, 0x1f);
+}
+
+static void test_initial_values(void) {
+    static ha_ws_proto_t p;
+    go_live(&p);
+    expect_str("initial: state", p.values[0], "21.5");
+    expect_str("initial: attribute", p.values[1], "C");
+    expect_str("initial: \"State\" tile reads the state", p.values[2], "off");
+    expect_true("initial: no-entity tile unresolved", !p.resolved[3] && p.values[3][0] == '\0');
+    expect_str("initial: fractional number like REST", p.values[4], "127.50");
+    expect_true("initial: resolved flags", p.resolved[0] && p.resolved[1] && p.resolved[2] && p.resolved[4]);
+}
+
+static void test_deltas(void) {
+    static ha_ws_proto_t p;
+    go_live(&p);
+
+    ha_ws_result_t r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"sensor.temp\":"
+        "{\"+\":{\"s\":\"22\",\"lc\":2,\"c\":\"y\"}}}}}");
+    expect_int("delta: state change -> tile 0 only", (long)r.changed, 0x01);
+    expect_str("delta: new state", p.values[0], "22");
+    expect_true("delta: no reply", r.reply == NULL);
+
+    r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"sensor.temp\":"
+        "{\"+\":{\"s\":\"22\",\"lu\":3}}}}}");
+    expect_int("delta: same value -> no change bit", (long)r.changed, 0);
+
+    r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"light.desk\":"
+        "{\"+\":{\"a\":{\"brightness\":255,\"color_mode\":\"hs\"}}}}}}");
+    expect_int("delta: attribute change -> tile 4", (long)r.changed, 0x10);
+    expect_str("delta: integer attribute", p.values[4], "255");
+
+    r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"light.desk\":"
+        "{\"+\":{\"s\":\"off\"},\"-\":{\"a\":[\"brightness\",\"color_mode\"]}}}}}");
+    expect_int("delta: removed attribute -> tile 4", (long)r.changed, 0x10);
+    expect_true("delta: removed attribute unresolved", !p.resolved[4]);
+
+    r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"binary_sensor.door\":"
+        "{\"+\":{\"s\":\"unavailable\"}}}}}");
+    expect_int("delta: unavailable -> tile 2", (long)r.changed, 0x04);
+    expect_true("delta: unavailable unresolved", !p.resolved[2] && p.values[2][0] == '\0');
+
+    r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"sensor.other\":"
+        "{\"+\":{\"s\":\"5\"}}}}}");
+    expect_int("delta: untracked entity -> nothing", (long)r.changed, 0);
+
+    r = handle(&p, "{\"id\":1,\"type\":\"event\",\"event\":{\"r\":[\"sensor.temp\"]}}");
+    expect_int("delta: removed entity -> its tiles", (long)r.changed, 0x03);
+    expect_true("delta: removed entity unresolved", !p.resolved[0] && !p.resolved[1]);
+
+    r = handle(&p,
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"a\":{\"sensor.temp\":"
+        "{\"s\":true,\"a\":{}}}}}");
+    expect_int("delta: re-added entity -> state tile", (long)r.changed, 0x01);
+    expect_str("delta: bool state", p.values[0], "true");
+
+    r = handle(&p,
+        "[{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"sensor.temp\":{\"+\":{\"s\":\"1\"}}}}},"
+        "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"binary_sensor.door\":{\"+\":{\"s\":\"on\"}}}}}]");
+    expect_int("delta: coalesced array -> both tiles", (long)r.changed, 0x05);
+    expect_int("delta: still live", p.phase, HA_WS_LIVE);
+}
+
+static void test_failures(void) {
+    static ha_ws_proto_t p;
+
+    setup(&p);
+    handle(&p, "{\"type\":\"auth_required\"}");
+    handle(&p, "{\"type\":\"auth_invalid\",\"message\":\"Invalid access token\"}");
+    expect_int("fail: auth_invalid", p.phase, HA_WS_AUTH_FAILED);
+    ha_ws_result_t r = handle(&p, "{\"type\":\"auth_ok\"}");
+    expect_true("fail: ignored after auth_invalid", r.reply == NULL && p.phase == HA_WS_AUTH_FAILED);
+
+    setup(&p);
+    handle(&p, "{\"type\":\"auth_required\"}");
+    handle(&p, "{\"type\":\"auth_ok\"}");
+    handle(&p, "{\"id\":1,\"type\":\"result\",\"success\":false,"
+               "\"error\":{\"code\":\"unknown_command\",\"message\":\"Unknown command.\"}}");
+    expect_int("fail: subscribe refused", p.phase, HA_WS_FAILED);
+
+    go_live(&p);
+    r = handle(&p, "{\"id\":1,\"type\":\"event\",\"event\":{\"c\":");
+    expect_int("fail: malformed JSON fails the session", p.phase, HA_WS_FAILED);
+    expect_int("fail: malformed -> no change", (long)r.changed, 0);
+
+    /* Reconnect: same tiles, back to auth, values cleared until re-sent. */
+    ha_ws_proto_begin(&p);
+    expect_int("fail: begin after failure -> auth", p.phase, HA_WS_AUTH);
+    expect_true("fail: begin clears values", !p.resolved[0] && p.values[0][0] == '\0');
+    r = handle(&p, "{\"type\":\"auth_required\"}");
+    expect_true("fail: re-auth reply", r.reply != NULL);
+    handle(&p, "{\"type\":\"auth_ok\"}");
+    r = handle(&p, INITIAL_EVENT);
+    expect_int("fail: resubscribed live", p.phase, HA_WS_LIVE);
+    expect_str("fail: values back", p.values[0], "21.5");
+
+    /* No entities at all: live straight after auth, nothing subscribed (an
+     * empty entity_ids would subscribe to every entity). */
+    ha_ws_proto_init(&p, "t");
+    ha_ws_proto_add_tile(&p, NULL, NULL);
+    ha_ws_proto_begin(&p);
+    handle(&p, "{\"type\":\"auth_required\"}");
+    r = handle(&p, "{\"type\":\"auth_ok\"}");
+    expect_true("no entities: no subscribe", r.reply == NULL);
+    expect_int("no entities: live", p.phase, HA_WS_LIVE);
+}
+
+static void test_limits(void) {
+    static ha_ws_proto_t p;
+    ha_ws_proto_init(&p, NULL);
+    for (int i = 0; i < HA_WS_MAX_TILES; i++) {
+        char id[32];
+        snprintf(id, sizeof(id), "sensor.s%02d", i);
+        ha_ws_proto_add_tile(&p, id, NULL);
+    }
+    expect_true("limits: tile past the max rejected", !ha_ws_proto_add_tile(&p, "sensor.x", NULL));
+
+    char long_attr[HA_WS_ATTR_LEN + 8];
+    memset(long_attr, 'a', sizeof(long_attr) - 1);
+    long_attr[sizeof(long_attr) - 1] = '\0';
+    ha_ws_proto_init(&p, NULL);
+    ha_ws_proto_add_tile(&p, "sensor.y", long_attr);
+    expect_int("limits: overlong attribute -> no entity", ha_ws_proto_entity_count(&p), 0);
+}
+
+int main(void) {
+    test_handshake();
+    test_initial_values();
+    test_deltas();
+    test_failures();
+    test_limits();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
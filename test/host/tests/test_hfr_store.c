@@ -0,0 +1,155 @@
+/* Host test for main/hfr_store.c — per-instance HFR/star history store.
+ *
+ * Covers: HFR<=0 samples skipped but still counted as images, ring wrap,
+ * oldest-first build of the most recent N samples, loading a newest-first
+ * full sync (with truncation to HFR_RING_SIZE), sync planning (none /
+ * incremental / full), and invalidation keeping samples for display.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_hfr_store ...)).
+ */
+
+#include "hfr_store.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static float hfr_buf[HFR_RING_SIZE];
+static int stars_buf[HFR_RING_SIZE];
+
+static hfr_store_t make_store(void) {
+    hfr_store_t s = { .hfr = hfr_buf, .stars = stars_buf };
+    hfr_store_clear(&s);
+    return s;
+}
+
+static void test_push_and_build(void) {
+    hfr_store_t s = make_store();
+    hfr_store_note_image(&s, 2.0f, 100);
+    hfr_store_note_image(&s, 0.0f, 0);      /* no stars detected */
+    hfr_store_note_image(&s, 2.5f, 120);
+    hfr_store_note_image(&s, 3.0f, 140);
+
+    expect_int("note: images counted incl. HFR=0", s.synced_count, 4);
+    expect_int("note: HFR=0 not stored", s.count, 3);
+
+    float h[8];
+    int st[8];
+    int n = hfr_store_build(&s, h, st, 8);
+    expect_int("build: all samples", n, 3);
+    expect_true("build: oldest first", h[0] == 2.0f && h[1] == 2.5f && h[2] == 3.0f);
+    expect_true("build: stars follow HFR", st[0] == 100 && st[2] == 140);
+
+    n = hfr_store_build(&s, h, st, 2);
+    expect_int("build: capped to max_points", n, 2);
+    expect_true("build: keeps the most recent", h[0] == 2.5f && h[1] == 3.0f);
+
+    expect_int("build: max_points 0", hfr_store_build(&s, h, st, 0), 0);
+
+    hfr_store_t empty = { 0 };
+    hfr_store_push(&empty, 1.0f, 1);        /* unallocated buffers: ignored */
+    expect_int("push: no buffers is a no-op", empty.count, 0);
+}
+
+static void test_wrap(void) {
+    hfr_store_t s = make_store();
+    for (int i = 1; i <= HFR_RING_SIZE + 7; i++) {
+        hfr_store_push(&s, (float)i, i);
+    }
+    static float h[HFR_RING_SIZE];
+    static int st[HFR_RING_SIZE];
+    int n = hfr_store_build(&s, h, st, HFR_RING_SIZE);
+    expect_int("wrap: full ring", n, HFR_RING_SIZE);
+    expect_true("wrap: oldest surviving sample first", h[0] == 8.0f);
+    expect_true("wrap: newest last", h[n - 1] == (float)(HFR_RING_SIZE + 7));
+
+    n = hfr_store_build(&s, h, st, 3);
+    expect_true("wrap: tail of 3",
+                n == 3 && h[0] == (float)(HFR_RING_SIZE + 5) && h[2] == (float)(HFR_RING_SIZE + 7));
+}
+
+static void test_load_newest_first(void) {
+    hfr_store_t s = make_store();
+    hfr_store_note_image(&s, 9.0f, 9);      /* replaced by the load */
+
+    /* /image-history order: newest first */
+    float h_in[] = { 3.0f, 0.0f, 2.0f, 1.0f };
+    int st_in[] = { 30, 0, 20, 10 };
+    hfr_store_load_newest_first(&s, h_in, st_in, 4, 4);
+
+    expect_true("load: marks synced", s.synced);
+    expect_int("load: synced_count = images covered", s.synced_count, 4);
+    expect_int("load: HFR=0 dropped", s.count, 3);
+
+    float h[8];
+    int st[8];
+    int n = hfr_store_build(&s, h, st, 8);
+    expect_true("load: chronological order",
+                n == 3 && h[0] == 1.0f && h[1] == 2.0f && h[2] == 3.0f && st[2] == 30);
+
+    /* More samples than fit: the newest HFR_RING_SIZE are kept */
+    static float big_h[HFR_RING_SIZE + 10];
+    static int big_st[HFR_RING_SIZE + 10];
+    for (int i = 0; i < HFR_RING_SIZE + 10; i++) {
+        big_h[i] = (float)(1000 - i);       /* index 0 newest */
+        big_st[i] = i;
+    }
+    hfr_store_load_newest_first(&s, big_h, big_st, HFR_RING_SIZE + 10, 800);
+    n = hfr_store_build(&s, h, st, 1);
+    expect_true("load: newest sample last", n == 1 && h[0] == 1000.0f);
+    expect_int("load: truncated to ring", s.count, HFR_RING_SIZE);
+    expect_int("load: synced_count from caller", s.synced_count, 800);
+}
+
+static void test_plan(void) {
+    hfr_store_t s = make_store();
+    expect_int("plan: never synced -> full", hfr_store_plan_sync(&s, 10), HFR_STORE_SYNC_FULL);
+
+    float h_in[] = { 2.0f };
+    int st_in[] = { 1 };
+    hfr_store_load_newest_first(&s, h_in, st_in, 1, 10);
+    expect_int("plan: current -> none", hfr_store_plan_sync(&s, 10), HFR_STORE_SYNC_NONE);
+    expect_int("plan: 3 new -> incremental", hfr_store_plan_sync(&s, 13), 3);
+    expect_int("plan: gap at limit -> incremental",
+               hfr_store_plan_sync(&s, 10 + HFR_STORE_INCREMENTAL_MAX), HFR_STORE_INCREMENTAL_MAX);
+    expect_int("plan: gap over limit -> full",
+               hfr_store_plan_sync(&s, 11 + HFR_STORE_INCREMENTAL_MAX), HFR_STORE_SYNC_FULL);
+    expect_int("plan: history shrank -> full", hfr_store_plan_sync(&s, 4), HFR_STORE_SYNC_FULL);
+
+    /* IMAGE-SAVE while synced advances synced_count */
+    hfr_store_note_image(&s, 2.1f, 5);
+    expect_int("plan: event accounted -> none", hfr_store_plan_sync(&s, 11), HFR_STORE_SYNC_NONE);
+
+    hfr_store_invalidate(&s);
+    expect_int("plan: invalidated -> full", hfr_store_plan_sync(&s, 11), HFR_STORE_SYNC_FULL);
+    expect_int("invalidate: samples kept", s.count, 2);
+
+    hfr_store_clear(&s);
+    expect_true("clear: empty and unsynced", s.count == 0 && s.synced_count == 0 && !s.synced);
+}
+
+int main(void) {
+    test_push_and_build();
+    test_wrap();
+    test_load_newest_first();
+    test_plan();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,287 @@
+/* Host test for main/http_pipeline.c — the pure half of http_fetch_batch().
+ *
+ * Covers: URL splitting and same-origin checks, pipelined GET formatting,
+ * and the incremental response parser over back-to-back responses
+ * (Content-Length, chunked, 204/304, 1xx, read-until-close), byte-by-byte
+ * feeding, header callbacks, body muting and malformed input.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_http_pipeline ...)).
+ */
+
+#include "http_pipeline.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = (strcmp(got, want) == 0);
+    printf("%-56s got=\"%s\" want=\"%s\" %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+/* ── Recorder: one slot per response in the stream ── */
+
+#define MAX_RESP 4
+
+typedef struct {
+    int status[MAX_RESP];
+    long content_length[MAX_RESP];
+    char body[MAX_RESP][128];
+    char date[MAX_RESP][48];
+    int cur;
+    int mute_after;        /* stop accepting body after this many bytes (-1 = never) */
+} recorder_t;
+
+static void rec_status(int status, void *ctx) {
+    recorder_t *r = (recorder_t *)ctx;
+    r->status[r->cur] = status;
+}
+
+static void rec_header(const char *name, const char *value, void *ctx) {
+    recorder_t *r = (recorder_t *)ctx;
+    if (strcmp(name, "Date") == 0) {
+        snprintf(r->date[r->cur], sizeof(r->date[0]), "%s", value);
+    }
+}
+
+static void rec_headers_done(int64_t content_length, void *ctx) {
+    recorder_t *r = (recorder_t *)ctx;
+    r->content_length[r->cur] = (long)content_length;
+}
+
+static bool rec_body(const char *data, size_t len, void *ctx) {
+    recorder_t *r = (recorder_t *)ctx;
+    char *b = r->body[r->cur];
+    size_t have = strlen(b);
+    if (r->mute_after >= 0 && have + len > (size_t)r->mute_after) {
+        size_t take = (size_t)r->mute_after > have ? (size_t)r->mute_after - have : 0;
+        strncat(b, data, take);
+        return false;
+    }
+    if (have + len < sizeof(r->body[0])) strncat(b, data, len);
+    return true;
+}
+
+/* Feed @p stream in @p step-byte pieces, re-initialising the parser after
+ * each completed response. Returns the number of completed responses;
+ * *err set if the parser reported an error. */
+static int run_stream(recorder_t *r, const char *stream, size_t step, bool eof, bool *err) {
+    memset(r, 0, sizeof(*r));
+    r->mute_after = -1;
+    http_resp_callbacks_t cb = {
+        .on_status = rec_status, .on_header = rec_header,
+        .on_headers_done = rec_headers_done, .on_body = rec_body, .ctx = r,
+    };
+    http_resp_parser_t p;
+    http_resp_init(&p, &cb);
+    *err = false;
+
+    size_t len = strlen(stream);
+    size_t pos = 0;
+    int done = 0;
+    while (pos < len) {
+        size_t n = len - pos < step ? len - pos : step;
+        size_t off = 0;
+        while (off < n) {
+            size_t used = 0;
+            http_resp_result_t res = http_resp_feed(&p, stream + pos + off, n - off, &used);
+            off += used;
+            if (res == HTTP_RESP_ERROR) {
+                *err = true;
+                return done;
+            }
+            if (res == HTTP_RESP_COMPLETE) {
+                done++;
+                if (r->cur + 1 < MAX_RESP) r->cur++;
+                http_resp_init(&p, &cb);
+            }
+        }
+        pos += n;
+    }
+    if (eof && http_resp_eof(&p) == HTTP_RESP_COMPLETE) done++;
+    return done;
+}
+
+static const char *PIPELINED =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/json\r\n"
+    "Date: Mon, 06 Jul 2026 19:06:19 GMT\r\n"
+    "Content-Length: 17\r\n"
+    "\r\n"
+    "{\"Response\":true}"
+    "HTTP/1.1 200 OK\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n"
+    "5\r\n{\"a\":\r\n"
+    "3;ext=1\r\n42}\r\n"
+    "0\r\n"
+    "X-Trailer: 1\r\n"
+    "\r\n"
+    "HTTP/1.1 404 Not Found\r\n"
+    "content-length: 9\r\n"
+    "\r\n"
+    "not found";
+
+static void test_pipelined_stream(void) {
+    recorder_t r;
+    bool err;
+    size_t steps[] = { 4096, 1, 7 };
+    for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+        char label[64];
+        int done = run_stream(&r, PIPELINED, steps[s], false, &err);
+        snprintf(label, sizeof(label), "pipelined (step %u): 3 responses", (unsigned)steps[s]);
+        expect_true(label, done == 3 && !err);
+        snprintf(label, sizeof(label), "pipelined (step %u): bodies", (unsigned)steps[s]);
+        expect_true(label, strcmp(r.body[0], "{\"Response\":true}") == 0 &&
+                           strcmp(r.body[1], "{\"a\":42}") == 0 &&
+                           strcmp(r.body[2], "not found") == 0);
+    }
+    expect_int("status[0]", r.status[0], 200);
+    expect_int("status[2]", r.status[2], 404);
+    expect_int("content_length[0]", r.content_length[0], 17);
+    expect_int("chunked reports -1", r.content_length[1], -1);
+    expect_int("lower-case Content-Length honoured", r.content_length[2], 9);
+    expect_str("Date header captured", r.date[0], "Mon, 06 Jul 2026 19:06:19 GMT");
+}
+
+static void test_no_body_and_interim(void) {
+    recorder_t r;
+    bool err;
+    const char *s =
+        "HTTP/1.1 100 Continue\r\n\r\n"
+        "HTTP/1.1 204 No Content\r\n\r\n"
+        "HTTP/1.1 304 Not Modified\r\nContent-Length: 500\r\n\r\n"
+        "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+    int done = run_stream(&r, s, 3, false, &err);
+    expect_true("1xx skipped, 204/304/empty complete", done == 3 && !err);
+    expect_int("first final status is 204", r.status[0], 204);
+    expect_int("304 ignores Content-Length", r.content_length[1], 0);
+    expect_int("empty 200", r.status[2], 200);
+}
+
+static void test_until_close(void) {
+    recorder_t r;
+    bool err;
+    const char *s = "HTTP/1.0 200 OK\r\n\r\nraw body";
+    int done = run_stream(&r, s, 5, false, &err);
+    expect_int("until-close: not complete before EOF", done, 0);
+    done = run_stream(&r, s, 5, true, &err);
+    expect_true("until-close: EOF completes", done == 1 && !err);
+    expect_str("until-close: body", r.body[0], "raw body");
+
+    http_resp_parser_t p;
+    http_resp_init(&p, NULL);
+    size_t used;
+    http_resp_feed(&p, "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 1\r\n\r\nx", 58, &used);
+    expect_true("Connection: close reported", http_resp_closes_connection(&p));
+
+    http_resp_init(&p, NULL);
+    http_resp_feed(&p, "HTTP/1.1 200 OK\r\nContent-Length: 10\r\n\r\nabc", 42, &used);
+    expect_int("EOF mid-body is an error", http_resp_eof(&p), HTTP_RESP_ERROR);
+}
+
+static void test_mute(void) {
+    recorder_t r;
+    memset(&r, 0, sizeof(r));
+    /* Sink stops after 4 bytes; the parser must still find response 2. */
+    http_resp_callbacks_t cb = { .on_body = rec_body, .on_status = rec_status, .ctx = &r };
+    r.mute_after = 4;
+    http_resp_parser_t p;
+    http_resp_init(&p, &cb);
+    const char *s = "HTTP/1.1 200 OK\r\nContent-Length: 10\r\n\r\n0123456789"
+                    "HTTP/1.1 201 Created\r\nContent-Length: 2\r\n\r\nok";
+    size_t used = 0;
+    http_resp_result_t res = http_resp_feed(&p, s, strlen(s), &used);
+    expect_true("muted body still completes", res == HTTP_RESP_COMPLETE);
+    expect_str("muted body truncated at sink's limit", r.body[0], "0123");
+    r.cur = 1;
+    r.mute_after = -1;
+    http_resp_init(&p, &cb);
+    size_t used2 = 0;
+    res = http_resp_feed(&p, s + used, strlen(s) - used, &used2);
+    expect_true("next response parsed after muted one",
+                res == HTTP_RESP_COMPLETE && r.status[1] == 201 && strcmp(r.body[1], "ok") == 0);
+}
+
+static void test_malformed(void) {
+    const char *bad[] = {
+        "HTTX/1.1 200 OK\r\n\r\n",
+        "HTTP/1.1 2x0 OK\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nNoColonHere\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nContent-Length: 12a\r\n\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n",
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n2\r\nabX\r\n",
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        recorder_t r;
+        bool err;
+        run_stream(&r, bad[i], 4096, false, &err);
+        char label[64];
+        snprintf(label, sizeof(label), "malformed #%u rejected", (unsigned)i);
+        expect_true(label, err);
+    }
+}
+
+static void test_url(void) {
+    http_url_parts_t u;
+    expect_true("split http with port", http_url_split("http://nina.lan:1888/v2/api/x?y=1", &u));
+    expect_str("host", u.host, "nina.lan");
+    expect_int("port", u.port, 1888);
+    expect_str("path keeps query", u.path, "/v2/api/x?y=1");
+    expect_true("https default port",
+                http_url_split("https://example.com", &u) && u.https && u.port == 443 &&
+                strcmp(u.path, "/") == 0);
+    expect_true("http default port", http_url_split("http://10.0.0.5/a", &u) && u.port == 80);
+    expect_true("reject ftp", !http_url_split("ftp://x/", &u));
+    expect_true("reject empty host", !http_url_split("http://:80/", &u));
+    expect_true("reject bad port", !http_url_split("http://h:99999/", &u));
+    expect_true("reject port junk", !http_url_split("http://h:12x/", &u));
+
+    expect_true("same origin", http_url_same_origin("http://H:1888/a", "http://h:1888/b"));
+    expect_true("different port", !http_url_same_origin("http://h:1888/a", "http://h:1889/a"));
+    expect_true("different scheme", !http_url_same_origin("http://h/a", "https://h/a"));
+}
+
+static void test_append_get(void) {
+    char buf[256];
+    size_t len = http_pipeline_append_get(buf, sizeof(buf), 0, "/v2/api/a", "nina.lan:1888",
+                                          "Accept: application/json\r\n");
+    expect_true("first request appended", len > 0);
+    len = http_pipeline_append_get(buf, sizeof(buf), len, "/b", "nina.lan:1888", NULL);
+    expect_str("two pipelined requests", buf,
+               "GET /v2/api/a HTTP/1.1\r\nHost: nina.lan:1888\r\n"
+               "Accept: application/json\r\nConnection: keep-alive\r\n\r\n"
+               "GET /b HTTP/1.1\r\nHost: nina.lan:1888\r\nConnection: keep-alive\r\n\r\n");
+    expect_int("overflow returns 0",
+               (long)http_pipeline_append_get(buf, 40, 0, "/long/path", "host", NULL), 0);
+}
+
+int main(void) {
+    test_pipelined_stream();
+    test_no_body_and_interim();
+    test_until_close();
+    test_mute();
+    test_malformed();
+    test_url();
+    test_append_get();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
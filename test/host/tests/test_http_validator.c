@@ -0,0 +1,107 @@
+/* Host test for main/http_validator.c — conditional-GET validator table.
+ *
+ * Covers: URL hashing, ETag/Last-Modified header capture (case-insensitive,
+ * over-long values dropped), find/claim of entries, LRU recycling when the
+ * table is full (with the recycled flag and the body pointer left for the
+ * caller), and release.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_http_validator ...)).
+ */
+
+#include "http_validator.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = (strcmp(got, want) == 0);
+    printf("%-56s got=\"%s\" want=\"%s\" %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void test_hash(void) {
+    uint64_t a = http_validator_url_hash("http://allsky.lan/all");
+    uint64_t b = http_validator_url_hash("http://allsky.lan/all?x");
+    expect_true("hash: stable", a == http_validator_url_hash("http://allsky.lan/all"));
+    expect_true("hash: differs per URL", a != b);
+    expect_true("hash: never the free marker", http_validator_url_hash("") != 0);
+}
+
+static void test_headers(void) {
+    http_validators_t v;
+    http_validators_clear(&v);
+    expect_true("headers: empty not present", !http_validators_present(&v));
+    expect_true("headers: etag recognised",
+                http_validators_note_header(&v, "etag", "W/\"5f-1a\""));
+    expect_str("headers: etag kept verbatim", v.etag, "W/\"5f-1a\"");
+    expect_true("headers: last-modified recognised",
+                http_validators_note_header(&v, "Last-Modified", "Tue, 06 Oct 2026 10:00:00 GMT"));
+    expect_str("headers: date kept", v.last_modified, "Tue, 06 Oct 2026 10:00:00 GMT");
+    expect_true("headers: others ignored", !http_validators_note_header(&v, "Date", "x"));
+    expect_true("headers: present", http_validators_present(&v));
+
+    char big[HTTP_VALIDATOR_ETAG_MAX + 8];
+    memset(big, 'a', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    http_validators_note_header(&v, "ETag", big);
+    expect_str("headers: over-long etag dropped, not truncated", v.etag, "");
+    expect_true("headers: date survives", v.last_modified[0] != '\0');
+}
+
+static void test_table(void) {
+    http_validator_entry_t slots[3];
+    http_validator_table_t t;
+    http_validator_table_init(&t, slots, 3);
+
+    expect_true("find: empty table", http_validator_find(&t, "u1") == NULL);
+
+    bool recycled = true;
+    http_validator_entry_t *e1 = http_validator_claim(&t, "u1", &recycled);
+    expect_true("claim: fresh slot", e1 && !recycled);
+    strcpy(e1->v.etag, "\"1\"");
+    e1->body_len = 10;
+    expect_true("find: after claim", http_validator_find(&t, "u1") == e1);
+    expect_true("claim: same URL returns same entry", http_validator_claim(&t, "u1", NULL) == e1);
+    expect_str("claim: existing entry keeps validators", e1->v.etag, "\"1\"");
+
+    http_validator_entry_t *e2 = http_validator_claim(&t, "u2", NULL);
+    http_validator_entry_t *e3 = http_validator_claim(&t, "u3", NULL);
+    static char body2[] = "body2";
+    e2->body = body2;
+
+    /* Touch u1 and u3 so u2 is least recently used */
+    http_validator_find(&t, "u1");
+    http_validator_find(&t, "u3");
+    http_validator_entry_t *e4 = http_validator_claim(&t, "u4", &recycled);
+    expect_true("lru: u2 slot recycled", e4 == e2 && recycled);
+    expect_true("lru: body left for caller", e4->body == body2);
+    expect_true("lru: validators reset", !http_validators_present(&e4->v) && e4->body_len == 0);
+    expect_true("lru: u2 gone", http_validator_find(&t, "u2") == NULL);
+    expect_true("lru: u1/u3 kept",
+                http_validator_find(&t, "u1") == e1 && http_validator_find(&t, "u3") == e3);
+
+    http_validator_release(e1);
+    expect_true("release: find misses", http_validator_find(&t, "u1") == NULL);
+    http_validator_entry_t *e5 = http_validator_claim(&t, "u5", &recycled);
+    expect_true("release: freed slot reused first", e5 == e1 && !recycled);
+}
+
+int main(void) {
+    test_hash();
+    test_headers();
+    test_table();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
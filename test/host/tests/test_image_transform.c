@@ -0,0 +1,242 @@
+/* Host test for main/ui/image_transform.c — single-pass crop/mask/flip/rotate.
+ *
+ * Covers: every combination of source vflip, crop, caption mask, logical
+ * v/h flips and the four orientations matches a reference copy of the old
+ * multi-pass pipeline from nina_image_display.c pixel for pixel (including
+ * frames larger than one rotation tile and odd sizes), plan kinds and the
+ * source block used for HW offload, and rejected plans.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_image_transform ...)).
+ */
+
+#include "image_transform.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+/* The pre-fusion passes, kept verbatim in structure: cropped copy with the
+ * source vflip and caption mask, vflip row swap, hflip, then rotation into a
+ * second buffer. Returns the final buffer (caller frees) and its size. */
+static uint16_t *reference(const image_transform_t *t, uint16_t *out_w, uint16_t *out_h) {
+    uint16_t sw = t->src_w, sh = t->src_h;
+    uint16_t w = t->crop_w, h = t->crop_h, ox = t->crop_x, oy = t->crop_y;
+    uint16_t *copy = malloc((size_t)w * h * 2);
+
+    for (uint32_t y = 0; y < h; y++) {
+        uint32_t src_y = t->src_vflip ? (uint32_t)(sh - 1 - (oy + y)) : (uint32_t)(oy + y);
+        memcpy(copy + (size_t)y * w, t->src + (size_t)src_y * sw + ox, (size_t)w * 2);
+        if (!t->mask_on) continue;
+        int uY = (int)oy + (int)y;
+        if (uY < t->mask_y0 || uY >= t->mask_y1) continue;
+        uint16_t px = t->src[(size_t)src_y * sw + t->mask_sample_x];
+        for (uint32_t x = 0; x < w; x++) {
+            int uX = (int)ox + (int)x;
+            if (uX < t->mask_x0 || uX >= t->mask_x1) continue;
+            copy[(size_t)y * w + x] = px;
+        }
+    }
+    if (t->vflip) {
+        for (uint32_t y = 0; y < h / 2; y++) {
+            for (uint32_t x = 0; x < w; x++) {
+                uint16_t tmp = copy[(size_t)y * w + x];
+                copy[(size_t)y * w + x] = copy[(size_t)(h - 1 - y) * w + x];
+                copy[(size_t)(h - 1 - y) * w + x] = tmp;
+            }
+        }
+    }
+    if (t->hflip) {
+        for (uint32_t y = 0; y < h; y++) {
+            uint16_t *row = copy + (size_t)y * w;
+            for (uint32_t x = 0; x < (uint32_t)w / 2; x++) {
+                uint16_t tmp = row[x];
+                row[x] = row[w - 1 - x];
+                row[w - 1 - x] = tmp;
+            }
+        }
+    }
+    if (t->orient == 0) {
+        *out_w = w;
+        *out_h = h;
+        return copy;
+    }
+    uint16_t rw = (t->orient == 2) ? w : h;
+    uint16_t rh = (t->orient == 2) ? h : w;
+    uint16_t *rot = malloc((size_t)rw * rh * 2);
+    for (uint32_t Y = 0; Y < rh; Y++) {
+        for (uint32_t X = 0; X < rw; X++) {
+            uint32_t sx, sy;
+            if (t->orient == 2)      { sx = w - 1 - X; sy = h - 1 - Y; }
+            else if (t->orient == 1) { sx = Y;         sy = h - 1 - X; }
+            else                     { sx = w - 1 - Y; sy = X; }
+            rot[(size_t)Y * rw + X] = copy[(size_t)sy * w + sx];
+        }
+    }
+    free(copy);
+    *out_w = rw;
+    *out_h = rh;
+    return rot;
+}
+
+static uint16_t *make_src(uint16_t w, uint16_t h) {
+    uint16_t *s = malloc((size_t)w * h * 2);
+    for (uint32_t i = 0; i < (uint32_t)w * h; i++) {
+        s[i] = (uint16_t)(i * 2654435761u >> 16);   /* distinct-ish per pixel */
+    }
+    return s;
+}
+
+/* Runs every flag/orientation combination for one geometry; returns mismatches. */
+static int sweep(uint16_t sw, uint16_t sh, uint16_t cx, uint16_t cy, uint16_t cw, uint16_t ch,
+                 int mx0, int mx1, int my0, int my1, int sample) {
+    uint16_t *src = make_src(sw, sh);
+    int bad = 0;
+    for (int combo = 0; combo < 64; combo++) {
+        image_transform_t t = {
+            .src = src, .src_w = sw, .src_h = sh,
+            .src_vflip = combo & 1,
+            .crop_x = cx, .crop_y = cy, .crop_w = cw, .crop_h = ch,
+            .mask_on = (combo >> 1) & 1,
+            .mask_x0 = mx0, .mask_x1 = mx1, .mask_y0 = my0, .mask_y1 = my1,
+            .mask_sample_x = sample,
+            .vflip = (combo >> 2) & 1,
+            .hflip = (combo >> 3) & 1,
+            .orient = (uint8_t)(combo >> 4),
+        };
+        uint16_t rw = 0, rh = 0;
+        uint16_t *want = reference(&t, &rw, &rh);
+        image_transform_plan_t p;
+        if (!image_transform_plan(&t, &p) || p.dst_w != rw || p.dst_h != rh) {
+            bad++;
+            free(want);
+            continue;
+        }
+        uint16_t *got = malloc((size_t)rw * rh * 2);
+        image_transform_apply(&p, got);
+        if (memcmp(got, want, (size_t)rw * rh * 2) != 0) bad++;
+        free(got);
+        free(want);
+    }
+    free(src);
+    return bad;
+}
+
+static void test_matches_reference(void) {
+    expect_int("uncropped 40x24, mask in the corner",
+               sweep(40, 24, 0, 0, 40, 24, 28, 36, 2, 7, 38), 0);
+    expect_int("88% center crop of 100x60, mask across crop",
+               sweep(100, 60, 6, 3, 88, 54, 70, 95, 0, 10, 99), 0);
+    expect_int("multi-tile 130x75, odd crop, mid mask",
+               sweep(130, 75, 5, 4, 117, 67, 40, 90, 30, 50, 95), 0);
+    expect_int("mask wholly outside the crop",
+               sweep(64, 64, 8, 8, 48, 48, 0, 4, 0, 64, 60), 0);
+    expect_int("1-pixel crop",
+               sweep(20, 20, 7, 9, 1, 1, 0, 20, 0, 20, 19), 0);
+    expect_int("single row / single column crops",
+               sweep(50, 30, 0, 11, 50, 1, 10, 20, 0, 30, 45) +
+               sweep(50, 30, 13, 0, 1, 30, 0, 50, 5, 9, 40), 0);
+}
+
+static void test_kinds(void) {
+    uint16_t *src = make_src(64, 32);
+    image_transform_t t = {
+        .src = src, .src_w = 64, .src_h = 32,
+        .crop_x = 4, .crop_y = 2, .crop_w = 56, .crop_h = 28,
+    };
+    image_transform_plan_t p;
+
+    expect_true("plain crop plans", image_transform_plan(&t, &p));
+    expect_int("plain crop is a row copy", p.kind, IMAGE_TRANSFORM_COPY);
+    expect_int("  block x", p.block_x, 4);
+    expect_int("  block y", p.block_y, 2);
+
+    t.src_vflip = true;
+    t.vflip = true;
+    image_transform_plan(&t, &p);
+    expect_int("source vflip undone by logical vflip: copy", p.kind, IMAGE_TRANSFORM_COPY);
+    expect_int("  block y mirrors the crop", p.block_y, 2);
+
+    t.src_vflip = false;
+    t.vflip = false;
+    t.orient = 2;
+    image_transform_plan(&t, &p);
+    expect_int("orient 180 is a HW-able 180 turn", p.kind, IMAGE_TRANSFORM_ROT180);
+    expect_int("  block x", p.block_x, 4);
+    expect_int("  block y", p.block_y, 2);
+
+    t.orient = 0;
+    t.vflip = true;
+    t.hflip = true;
+    image_transform_plan(&t, &p);
+    expect_int("vflip + hflip is a 180 turn", p.kind, IMAGE_TRANSFORM_ROT180);
+
+    t.src_vflip = true;
+    t.crop_y = 0;
+    t.crop_h = 20;
+    image_transform_plan(&t, &p);
+    expect_int("stored-flipped source: hflip only", p.kind, IMAGE_TRANSFORM_GENERAL);
+    expect_int("  block y counts from the stored bottom", p.block_y, 12);
+
+    t.src_vflip = false;
+    t.vflip = true;
+    t.hflip = true;
+    t.mask_on = true;
+    t.mask_x0 = 0; t.mask_x1 = 8; t.mask_y0 = 0; t.mask_y1 = 8;
+    image_transform_plan(&t, &p);
+    expect_int("any visible mask forces the CPU path", p.kind, IMAGE_TRANSFORM_GENERAL);
+
+    t.orient = 1;
+    t.mask_on = false;
+    image_transform_plan(&t, &p);
+    expect_int("90 deg is general", p.kind, IMAGE_TRANSFORM_GENERAL);
+    expect_int("  dst width is the crop height", p.dst_w, 20);
+    expect_int("  dst height is the crop width", p.dst_h, 56);
+    free(src);
+}
+
+static void test_rejects(void) {
+    uint16_t *src = make_src(16, 16);
+    image_transform_t t = {
+        .src = src, .src_w = 16, .src_h = 16,
+        .crop_x = 0, .crop_y = 0, .crop_w = 16, .crop_h = 16,
+    };
+    image_transform_plan_t p;
+    t.crop_w = 0;
+    expect_true("empty crop rejected", !image_transform_plan(&t, &p));
+    t.crop_w = 16;
+    t.crop_x = 1;
+    expect_true("crop past the right edge rejected", !image_transform_plan(&t, &p));
+    t.crop_x = 0;
+    t.orient = 4;
+    expect_true("orientation 4 rejected", !image_transform_plan(&t, &p));
+    t.orient = 0;
+    t.src = NULL;
+    expect_true("NULL source rejected", !image_transform_plan(&t, &p));
+    free(src);
+}
+
+int main(void) {
+    test_matches_reference();
+    test_kinds();
+    test_rejects();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,322 @@
+/* Host test for main/json_stream.c — streaming (SAX-style) JSON extractor.
+ *
+ * Covers: scalar decoding (numbers, literals, escapes, \u code points),
+ * path matching ("Response.X", "[]" wildcards, "[N]" indices), begin/end
+ * event paths, byte-by-byte chunking giving the same result as one feed,
+ * syntax-error rejection, reset, clamped int conversion, and a differential
+ * check against the vendored cJSON on a NINA-shaped /equipment/guider/graph
+ * body.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_json_stream ...)).
+ */
+
+#include "json_stream.h"
+#include "cJSON.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = (strcmp(got, want) == 0);
+    printf("%-56s got=\"%s\" want=\"%s\" %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+/* ── Generic recorder: remembers a few fields by path ── */
+
+typedef struct {
+    char name[64];
+    double temp;
+    int is_exposing;       /* -1 = not seen */
+    int null_seen;
+    int steps_begun;
+    int steps_ended;
+    double ra_sum;
+    int idx1_dec_seen;
+    double idx1_dec;
+    int resets;
+    int root_begin_depth;  /* depth at the root OBJECT_BEGIN */
+    int values;
+} recorder_t;
+
+static bool record_cb(json_stream_t *js, json_stream_event_t ev,
+                      const json_stream_value_t *v, void *ctx) {
+    recorder_t *r = (recorder_t *)ctx;
+    switch (ev) {
+    case JSON_STREAM_EV_RESET:
+        memset(r, 0, sizeof(*r));
+        r->is_exposing = -1;
+        r->resets = 1;
+        return true;
+    case JSON_STREAM_EV_OBJECT_BEGIN:
+        if (json_stream_depth(js) == 0) r->root_begin_depth = 0;
+        if (json_stream_path_is(js, "Response.GuideSteps[]")) r->steps_begun++;
+        return true;
+    case JSON_STREAM_EV_OBJECT_END:
+        if (json_stream_path_is(js, "Response.GuideSteps[]")) r->steps_ended++;
+        return true;
+    case JSON_STREAM_EV_VALUE:
+        r->values++;
+        if (json_stream_path_is(js, "Response.Name") && v->type == JSON_STREAM_STRING) {
+            snprintf(r->name, sizeof(r->name), "%s", v->str);
+        } else if (json_stream_path_is(js, "Response.Temperature")) {
+            r->temp = v->num;
+        } else if (json_stream_path_is(js, "Response.IsExposing")) {
+            r->is_exposing = (v->type == JSON_STREAM_BOOL) ? v->boolean : -2;
+        } else if (json_stream_path_is(js, "Response.Gain") && v->type == JSON_STREAM_NULL) {
+            r->null_seen = 1;
+        } else if (json_stream_path_is(js, "Response.GuideSteps[].RADistanceRaw")) {
+            r->ra_sum += v->num;
+        } else if (json_stream_path_is(js, "Response.GuideSteps[1].DECDistanceRaw")) {
+            r->idx1_dec_seen = 1;
+            r->idx1_dec = v->num;
+        }
+        return true;
+    default:
+        return true;
+    }
+}
+
+static const char *k_doc =
+    "{\"Response\":{\"Name\":\"ZWO ASI2600MM \\\"Pro\\\"\",\"Temperature\":-10.5,"
+    "\"IsExposing\":true,\"Gain\":null,\"Empty\":{},\"EmptyArr\":[],"
+    "\"GuideSteps\":[{\"RADistanceRaw\":1.5,\"DECDistanceRaw\":-0.25},"
+    "{\"RADistanceRaw\":-2e-1,\"DECDistanceRaw\":3.0E+0}]},"
+    "\"Success\":true}";
+
+static void test_whole_feed(void) {
+    recorder_t r;
+    json_stream_t js;
+    json_stream_init(&js, record_cb, &r);
+    json_stream_reset(&js);  /* exercise the RESET event */
+    expect_true("reset event delivered", r.resets == 1);
+
+    bool fed = json_stream_feed(&js, k_doc, strlen(k_doc));
+    expect_true("whole feed accepted", fed);
+    expect_true("finish -> complete document", json_stream_finish(&js));
+    expect_str("escaped string value", r.name, "ZWO ASI2600MM \"Pro\"");
+    expect_true("negative decimal", fabs(r.temp - (-10.5)) < 1e-9);
+    expect_int("true literal", r.is_exposing, 1);
+    expect_int("null literal", r.null_seen, 1);
+    expect_int("array element begins", r.steps_begun, 2);
+    expect_int("array element ends", r.steps_ended, 2);
+    expect_true("[] wildcard sums all RA (1.5 + -0.2)", fabs(r.ra_sum - 1.3) < 1e-9);
+    expect_true("[1] specific index matched", r.idx1_dec_seen && fabs(r.idx1_dec - 3.0) < 1e-9);
+    expect_int("bytes counted", (long)json_stream_bytes(&js), (long)strlen(k_doc));
+}
+
+static void test_byte_by_byte(void) {
+    recorder_t whole, split;
+    json_stream_t js;
+
+    json_stream_init(&js, record_cb, &whole);
+    json_stream_reset(&js);
+    json_stream_feed(&js, k_doc, strlen(k_doc));
+    json_stream_finish(&js);
+
+    json_stream_init(&js, record_cb, &split);
+    json_stream_reset(&js);
+    bool ok = true;
+    for (size_t i = 0; i < strlen(k_doc) && ok; i++) {
+        ok = json_stream_feed(&js, k_doc + i, 1);
+    }
+    expect_true("byte-by-byte feed accepted", ok && json_stream_finish(&js));
+    expect_true("byte-by-byte matches whole feed",
+                memcmp(&whole, &split, sizeof(whole)) == 0);
+}
+
+static bool null_cb(json_stream_t *js, json_stream_event_t ev,
+                    const json_stream_value_t *v, void *ctx) {
+    (void)js; (void)ev; (void)v; (void)ctx;
+    return true;
+}
+
+static int parses(const char *doc) {
+    json_stream_t js;
+    json_stream_init(&js, null_cb, NULL);
+    return json_stream_feed(&js, doc, strlen(doc)) && json_stream_finish(&js);
+}
+
+static void test_syntax(void) {
+    expect_int("top-level number", parses("  42 "), 1);
+    expect_int("top-level string", parses("\"x\""), 1);
+    expect_int("nested arrays", parses("[[1,[2]],{\"a\":[]}]"), 1);
+    expect_int("reject trailing comma", parses("[1,2,]"), 0);
+    expect_int("reject missing colon", parses("{\"a\" 1}"), 0);
+    expect_int("reject mismatched closer", parses("{\"a\":[1}"), 0);
+    expect_int("reject bad literal", parses("[tru]"), 0);
+    expect_int("reject truncated document", parses("{\"a\":1"), 0);
+    expect_int("reject second document", parses("{} {}"), 0);
+    expect_int("reject raw control char in string", parses("\"a\nb\""), 0);
+    expect_int("reject malformed number", parses("[1e]"), 0);
+
+    char deep[2 * (JSON_STREAM_MAX_DEPTH + 1) + 1];
+    memset(deep, '[', JSON_STREAM_MAX_DEPTH + 1);
+    memset(deep + JSON_STREAM_MAX_DEPTH + 1, ']', JSON_STREAM_MAX_DEPTH + 1);
+    deep[sizeof(deep) - 1] = '\0';
+    expect_int("reject nesting beyond JSON_STREAM_MAX_DEPTH", parses(deep), 0);
+}
+
+typedef struct {
+    char s[JSON_STREAM_STR_MAX];
+    bool truncated;
+} str_capture_t;
+
+static bool str_cb(json_stream_t *js, json_stream_event_t ev,
+                   const json_stream_value_t *v, void *ctx) {
+    (void)js;
+    str_capture_t *c = (str_capture_t *)ctx;
+    if (ev == JSON_STREAM_EV_VALUE && v->type == JSON_STREAM_STRING) {
+        memcpy(c->s, v->str, v->len + 1);
+        c->truncated = v->truncated;
+    }
+    return true;
+}
+
+static void test_strings(void) {
+    str_capture_t c = { { 0 }, false };
+    json_stream_t js;
+    const char *doc = "\"a\\u00e9\\u20ac\\n\\/\"";
+    json_stream_init(&js, str_cb, &c);
+    json_stream_feed(&js, doc, strlen(doc));
+    json_stream_finish(&js);
+    expect_str("\\u escapes -> UTF-8", c.s, "a\xC3\xA9\xE2\x82\xAC\n/");
+
+    char longdoc[JSON_STREAM_STR_MAX + 64];
+    longdoc[0] = '"';
+    memset(longdoc + 1, 'x', JSON_STREAM_STR_MAX + 10);
+    longdoc[JSON_STREAM_STR_MAX + 11] = '"';
+    longdoc[JSON_STREAM_STR_MAX + 12] = '\0';
+    json_stream_init(&js, str_cb, &c);
+    json_stream_feed(&js, longdoc, strlen(longdoc));
+    expect_true("long string accepted", json_stream_finish(&js));
+    expect_true("long string flagged truncated", c.truncated);
+    expect_int("long string clamped", (long)strlen(c.s), JSON_STREAM_STR_MAX - 1);
+}
+
+static bool abort_cb(json_stream_t *js, json_stream_event_t ev,
+                     const json_stream_value_t *v, void *ctx) {
+    (void)v; (void)ctx;
+    return !(ev == JSON_STREAM_EV_VALUE && json_stream_path_is(js, "b"));
+}
+
+static void test_abort_and_reset(void) {
+    json_stream_t js;
+    const char *doc = "{\"a\":1,\"b\":2}";
+    json_stream_init(&js, abort_cb, NULL);
+    expect_int("callback abort stops feed", json_stream_feed(&js, doc, strlen(doc)), 0);
+    expect_int("feed after error stays false", json_stream_feed(&js, " ", 1), 0);
+    json_stream_reset(&js);
+    expect_int("reset clears the error", json_stream_feed(&js, "[1]", 3) && json_stream_finish(&js), 1);
+}
+
+/* ── Differential check vs cJSON: last-N window of GuideSteps ── */
+
+typedef struct {
+    double ra[8];
+    double dec[8];
+    int count;
+} steps_t;
+
+static bool steps_cb(json_stream_t *js, json_stream_event_t ev,
+                     const json_stream_value_t *v, void *ctx) {
+    steps_t *s = (steps_t *)ctx;
+    if (ev == JSON_STREAM_EV_OBJECT_BEGIN && json_stream_path_is(js, "Response.GuideSteps[]")) {
+        int i = json_stream_index_at(js, 2);
+        expect_true("index_at tracks element index", i == s->count);
+        s->count++;
+    } else if (ev == JSON_STREAM_EV_VALUE && s->count > 0 && s->count <= 8) {
+        if (json_stream_path_is(js, "Response.GuideSteps[].RADistanceRaw")) {
+            s->ra[s->count - 1] = v->num;
+        } else if (json_stream_path_is(js, "Response.GuideSteps[].DECDistanceRaw")) {
+            s->dec[s->count - 1] = v->num;
+        }
+    }
+    return true;
+}
+
+static void test_vs_cjson(void) {
+    const char *doc =
+        "{\"Response\":{\"RMS\":{\"RA\":0.41,\"Dec\":0.33,\"Total\":0.53},"
+        "\"GuideSteps\":["
+        "{\"Id\":1,\"RADistanceRaw\":0.12,\"DECDistanceRaw\":-0.08,\"Dither\":\"NaN\"},"
+        "{\"Id\":2,\"RADistanceRaw\":-0.31,\"DECDistanceRaw\":0.22,\"Dither\":\"NaN\"},"
+        "{\"Id\":3,\"RADistanceRaw\":0.05,\"DECDistanceRaw\":0.0,\"Dither\":\"NaN\"},"
+        "{\"Id\":4,\"RADistanceRaw\":1.25e0,\"DECDistanceRaw\":-1.5,\"Dither\":\"NaN\"}"
+        "],\"PixelScale\":1.21},\"Success\":true}";
+
+    steps_t s;
+    memset(&s, 0, sizeof(s));
+    json_stream_t js;
+    json_stream_init(&js, steps_cb, &s);
+    /* Uneven chunking across token boundaries */
+    size_t len = strlen(doc), off = 0, chunk = 7;
+    while (off < len) {
+        size_t n = (len - off < chunk) ? len - off : chunk;
+        json_stream_feed(&js, doc + off, n);
+        off += n;
+        chunk = chunk * 3 % 17 + 1;
+    }
+    expect_true("differential doc parses", json_stream_finish(&js));
+
+    cJSON *root = cJSON_Parse(doc);
+    cJSON *steps = cJSON_GetObjectItem(cJSON_GetObjectItem(root, "Response"), "GuideSteps");
+    expect_int("step count matches cJSON", s.count, cJSON_GetArraySize(steps));
+    int same = 1;
+    for (int i = 0; i < s.count; i++) {
+        cJSON *st = cJSON_GetArrayItem(steps, i);
+        if (s.ra[i] != cJSON_GetObjectItem(st, "RADistanceRaw")->valuedouble) same = 0;
+        if (s.dec[i] != cJSON_GetObjectItem(st, "DECDistanceRaw")->valuedouble) same = 0;
+    }
+    expect_true("RA/DEC values bit-identical to cJSON", same);
+    cJSON_Delete(root);
+}
+
+static void test_value_int(void) {
+    json_stream_value_t v;
+    memset(&v, 0, sizeof(v));
+    v.type = JSON_STREAM_NUMBER;
+    v.num = -42.9;
+    expect_int("int truncates toward zero", json_stream_value_int(&v), -42);
+    v.num = 1e30;
+    expect_int("int clamps above INT_MAX", json_stream_value_int(&v), INT_MAX);
+    v.num = -1e30;
+    expect_int("int clamps below INT_MIN", json_stream_value_int(&v), INT_MIN);
+    v.num = NAN;
+    expect_int("int NaN reads as 0", json_stream_value_int(&v), 0);
+    v.type = JSON_STREAM_STRING;
+    v.num = 7;
+    expect_int("int non-number reads as 0", json_stream_value_int(&v), 0);
+}
+
+int main(void) {
+    test_whole_feed();
+    test_byte_by_byte();
+    test_syntax();
+    test_strings();
+    test_abort_and_reset();
+    test_vs_cjson();
+    test_value_int();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
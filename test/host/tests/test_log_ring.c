@@ -0,0 +1,315 @@
+/* Host test for main/log_ring.c — binary log record ring behind log_capture.
+ *
+ * Covers: lazily formatted records match vsnprintf for every conversion the
+ * ESP_LOG formats use, copied vs by-pointer strings, the preformatted-text
+ * fallback (non-static format, unsupported conversion, over-long string),
+ * wraparound keeping the newest whole lines in order, an unpublished
+ * (preempted) record being skipped, per-core rings merged by time, tail
+ * windows on line boundaries, clear, streaming with small reads, and the
+ * bytes per line against the old text ring.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_log_ring ...)).
+ */
+
+#include "log_ring.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = strcmp(got, want) == 0;
+    printf("%-56s %s\n", label, ok ? "OK" : "FAIL");
+    if (!ok) {
+        printf("    got:  \"%s\"\n    want: \"%s\"\n", got, want);
+        fails++;
+    }
+}
+
+/* Stand-in for flash rodata: the literals below are "static", anything on
+ * the stack or heap is not. */
+static const char TAG[] = "nina_client";
+static const char *const k_static[] = {
+    TAG,
+    "I (%lu) %s: Poll cycle %d ms, %d fetchers\n",
+    "W (%lu) %s: HTTP %d from %s (retry in %u s)\n",
+    "%s|%5s|%-6s|%.3s|%.*s|%*d|%-*d|%c|%%|%x|%08X|%o\n",
+    "%ld %lu %lld %llu %zu %jd %td %hd %hhu\n",
+    "%.2f %8.3e %g %p\n",
+    "null=%s\n",
+    "%s\n",
+    "wide %ls\n",
+    "line %05d\n",
+    "core%d %d\n",
+};
+
+static bool is_static(const void *p) {
+    for (size_t i = 0; i < sizeof(k_static) / sizeof(k_static[0]); i++)
+        if (p == k_static[i]) return true;
+    return false;
+}
+
+static void vwrite_at(log_ring_t *r, uint32_t t, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    log_ring_vwrite(r, t, is_static, fmt, ap);
+    va_end(ap);
+}
+
+static void vwrite_plain(log_ring_t *r, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    log_ring_vwrite(r, 1, NULL, fmt, ap);
+    va_end(ap);
+}
+
+/* Write one line and return it formatted from the ring (last record). */
+static char g_got[LOG_RING_LINE_MAX], g_want[LOG_RING_LINE_MAX];
+static log_ring_slot_t g_slots[256];
+static log_ring_t g_ring;
+
+static const char *roundtrip(const char *fmt, ...) {
+    log_ring_init(&g_ring, g_slots, 256);
+    va_list ap, ap2;
+    va_start(ap, fmt);
+    va_copy(ap2, ap);
+    log_ring_vwrite(&g_ring, 1, is_static, fmt, ap);
+    vsnprintf(g_want, sizeof(g_want), fmt, ap2);
+    va_end(ap2);
+    va_end(ap);
+
+    log_ring_t *rings[1] = { &g_ring };
+    log_ring_reader_t rd;
+    log_ring_reader_init(&rd, rings, 1, 0);
+    size_t n = log_ring_reader_read(&rd, g_got, sizeof(g_got) - 1);
+    g_got[n] = '\0';
+    return g_got;
+}
+
+static void test_conversions(void) {
+    char host[16] = "10.0.0.5";
+    expect_str("ESP_LOG style line", roundtrip(k_static[1], 123456ul, TAG, 250, 7), g_want);
+    expect_str("copied %s argument", roundtrip(k_static[2], 99ul, TAG, 503, host, 30u), g_want);
+    expect_str("flags, width, precision, stars",
+               roundtrip(k_static[3], "abc", "ab", "ab", "abcdef", 2, "xyz", 6, 42, 5, -3,
+                         'Q', 0xbeefu, 0xbeefu, 8u), g_want);
+    expect_str("length modifiers",
+               roundtrip(k_static[4], -5l, 6ul, -7ll, 8ull, (size_t)9, (intmax_t)-10,
+                         (ptrdiff_t)-11, (short)-12, (unsigned char)13), g_want);
+    expect_str("doubles and %p", roundtrip(k_static[5], 3.14159, 12345.678, 0.5, (void *)host),
+               g_want);
+    expect_str("NULL %s", roundtrip(k_static[6], (const char *)NULL), g_want);
+    expect_int("all of the above stored as records", atomic_load(&g_ring.text_records), 0);
+
+    /* A copied string must not follow later changes to its buffer. */
+    log_ring_init(&g_ring, g_slots, 256);
+    vwrite_at(&g_ring, 1, k_static[7], host);
+    strcpy(host, "changed");
+    log_ring_t *rings[1] = { &g_ring };
+    log_ring_reader_t rd;
+    log_ring_reader_init(&rd, rings, 1, 0);
+    size_t n = log_ring_reader_read(&rd, g_got, sizeof(g_got) - 1);
+    g_got[n] = '\0';
+    expect_str("copied %s keeps the value at log time", g_got, "10.0.0.5\n");
+}
+
+static void test_text_fallback(void) {
+    char fmt[32] = "dyn %d %s\n";
+    char arg[8] = "x";
+    expect_str("non-static format: same text", roundtrip(fmt, 5, arg), g_want);
+    expect_int("non-static format stored as text", atomic_load(&g_ring.text_records), 1);
+
+    expect_str("%ls: same text", roundtrip(k_static[8], L"wide"), g_want);
+    expect_int("%ls stored as text", atomic_load(&g_ring.text_records), 1);
+
+    char big[400];
+    memset(big, 'z', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    roundtrip(k_static[7], big);
+    expect_int("over-long string stored as text", atomic_load(&g_ring.text_records), 1);
+    expect_int("text truncated to LOG_RING_LINE_MAX - 1", (long)strlen(g_got),
+               LOG_RING_LINE_MAX - 1);
+    expect_true("truncated text is a prefix", strncmp(g_got, g_want, LOG_RING_LINE_MAX - 1) == 0);
+
+    log_ring_init(&g_ring, g_slots, 256);
+    vwrite_plain(&g_ring, k_static[9], 4);
+    expect_int("no predicate: stored as text", atomic_load(&g_ring.text_records), 1);
+}
+
+/* Read everything from @p rings into a heap string. */
+static char *read_all(log_ring_t **rings, int n, size_t tail, size_t chunk) {
+    log_ring_reader_t *rd = malloc(sizeof(*rd));
+    log_ring_reader_init(rd, rings, n, tail);
+    size_t cap = 1 << 20, len = 0;
+    char *out = malloc(cap + 1);
+    for (;;) {
+        size_t got = log_ring_reader_read(rd, out + len, chunk);
+        if (got == 0) break;
+        len += got;
+    }
+    out[len] = '\0';
+    free(rd);
+    return out;
+}
+
+static int count_lines(const char *s) {
+    int n = 0;
+    for (; *s; s++) if (*s == '\n') n++;
+    return n;
+}
+
+static void test_wraparound(void) {
+    static log_ring_slot_t slots[128];
+    log_ring_t r;
+    log_ring_init(&r, slots, 128);
+    for (int i = 0; i < 1000; i++) vwrite_at(&r, (uint32_t)i, k_static[9], i);
+
+    log_ring_t *rings[1] = { &r };
+    char *all = read_all(rings, 1, 0, LOG_RING_LINE_MAX);
+    int lines = count_lines(all);
+    expect_true("wrapped ring keeps a window of lines", lines > 20 && lines < 64);
+
+    int bad = 0, prev = -1, first = -1;
+    for (char *p = all; *p; ) {
+        int v;
+        if (sscanf(p, "line %05d\n", &v) != 1 || strncmp(p, "line ", 5) != 0) { bad++; break; }
+        if (first < 0) first = v;
+        if (prev >= 0 && v != prev + 1) bad++;
+        prev = v;
+        p = strchr(p, '\n') + 1;
+    }
+    expect_int("lines whole, contiguous and in order", bad, 0);
+    expect_int("newest line last", prev, 999);
+    free(all);
+
+    /* A writer that reserved slots but was preempted before publishing. */
+    log_ring_init(&r, slots, 128);
+    vwrite_at(&r, 1, k_static[9], 1);
+    atomic_fetch_add(&r.head, 2);
+    vwrite_at(&r, 3, k_static[9], 3);
+    all = read_all(rings, 1, 0, LOG_RING_LINE_MAX);
+    expect_str("unpublished record skipped", all, "line 00001\nline 00003\n");
+    free(all);
+}
+
+static void test_merge_and_tail(void) {
+    static log_ring_slot_t s0[128], s1[128];
+    log_ring_t r0, r1;
+    log_ring_init(&r0, s0, 128);
+    log_ring_init(&r1, s1, 128);
+    /* Core 0 logs even milliseconds, core 1 odd ones, in bursts. */
+    for (int i = 0; i < 20; i += 2) vwrite_at(&r0, (uint32_t)i, k_static[10], 0, i);
+    for (int i = 1; i < 20; i += 2) vwrite_at(&r1, (uint32_t)i, k_static[10], 1, i);
+
+    log_ring_t *rings[2] = { &r0, &r1 };
+    char *all = read_all(rings, 2, 0, LOG_RING_LINE_MAX);
+    int bad = 0, prev = -1;
+    for (char *p = all; *p; p = strchr(p, '\n') + 1) {
+        int core, v;
+        if (sscanf(p, "core%d %d", &core, &v) != 2 || v != prev + 1 || core != (v & 1)) bad++;
+        prev = v;
+    }
+    expect_int("two rings merged in time order", bad, 0);
+    expect_int("merge returns every line", count_lines(all), 20);
+    free(all);
+
+    /* "core0 18\n" / "core1 19\n" are 9 bytes each. */
+    all = read_all(rings, 2, 27, LOG_RING_LINE_MAX);
+    expect_str("tail of 27 bytes: last three lines", all, "core1 17\ncore0 18\ncore1 19\n");
+    free(all);
+    all = read_all(rings, 2, 30, LOG_RING_LINE_MAX);
+    expect_str("tail rounds down to whole lines", all, "core1 17\ncore0 18\ncore1 19\n");
+    free(all);
+    all = read_all(rings, 2, 1, LOG_RING_LINE_MAX);
+    expect_str("tail below one line: newest line", all, "core1 19\n");
+    free(all);
+    all = read_all(rings, 2, 1 << 20, LOG_RING_LINE_MAX);
+    expect_int("tail above the total: everything", count_lines(all), 20);
+    free(all);
+
+    /* Small reads return whole lines; lines logged after open show up. */
+    log_ring_reader_t rd;
+    log_ring_reader_init(&rd, rings, 2, 0);
+    char buf[12];
+    size_t n = log_ring_reader_read(&rd, buf, sizeof(buf));
+    expect_int("read with room for one line returns one", (long)n, 8);
+    int drained = 1;
+    while (log_ring_reader_read(&rd, buf, sizeof(buf)) > 0) drained++;
+    vwrite_at(&r1, 20, k_static[10], 1, 20);
+    n = log_ring_reader_read(&rd, buf, sizeof(buf));
+    buf[n < sizeof(buf) ? n : sizeof(buf) - 1] = '\0';
+    expect_int("streamed every line", drained, 20);
+    expect_str("line logged after open is read", buf, "core1 20\n");
+
+    log_ring_clear(&r0);
+    log_ring_clear(&r1);
+    vwrite_at(&r0, 30, k_static[10], 0, 30);
+    all = read_all(rings, 2, 0, LOG_RING_LINE_MAX);
+    expect_str("clear hides earlier lines", all, "core0 30\n");
+    free(all);
+}
+
+static void test_density(void) {
+    /* Typical poll-task lines: old ring stored the formatted text; the new
+     * one stores whole slots. */
+    static log_ring_slot_t slots[4096];
+    log_ring_t r;
+    log_ring_init(&r, slots, 4096);
+    char url[] = "10.0.0.5";
+    size_t text_bytes = 0;
+    int lines = 0;
+    for (int i = 0; i < 200; i++) {
+        char line[LOG_RING_LINE_MAX];
+        text_bytes += (size_t)snprintf(line, sizeof(line), k_static[1], 1000ul + i, TAG, 200 + i, 7);
+        vwrite_at(&r, (uint32_t)(2 * i), k_static[1], 1000ul + i, TAG, 200 + i, 7);
+        text_bytes += (size_t)snprintf(line, sizeof(line), k_static[2], 1000ul + i, TAG, 503, url, 30u);
+        vwrite_at(&r, (uint32_t)(2 * i + 1), k_static[2], 1000ul + i, TAG, 503, url, 30u);
+        lines += 2;
+    }
+    size_t ring_bytes = (size_t)atomic_load(&r.head) * LOG_RING_SLOT_BYTES;
+    printf("    %d lines: text %zu B, records %zu B (%.2fx)\n", lines, text_bytes, ring_bytes,
+           (double)text_bytes / (double)ring_bytes);
+    expect_true("records smaller than the text they replace", ring_bytes * 3 <= text_bytes * 2);
+}
+
+static void test_init(void) {
+    static log_ring_slot_t slots[128];
+    log_ring_t r;
+    expect_true("non power of two rejected", !log_ring_init(&r, slots, 96));
+    expect_true("ring below two records rejected", !log_ring_init(&r, slots, 64));
+    expect_true("valid ring accepted", log_ring_init(&r, slots, 128));
+    log_ring_reader_t rd;
+    char buf[LOG_RING_LINE_MAX];
+    log_ring_reader_init(&rd, NULL, 0, 0);
+    expect_int("reader without rings reads nothing", (long)log_ring_reader_read(&rd, buf, sizeof(buf)), 0);
+}
+
+int main(void) {
+    test_init();
+    test_conversions();
+    test_text_fallback();
+    test_wraparound();
+    test_merge_and_tail();
+    test_density();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,182 @@
+/* Host test for main/moon_background.c — cached moon page background.
+ *
+ * Covers: black / starfield / halo styles (halo confined to its ring, stars
+ * grey), drawing in row ranges gives the same frame as one full pass and
+ * leaves other rows untouched, and the slot table's find / claim / LRU
+ * behaviour including empty slots and key changes.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_moon_background ...)).
+ */
+
+#include "moon_background.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+#define W 240
+#define H 240
+#define CANARY 0xA5A5u
+
+static const float DISC_R = 100.0f;
+
+static uint16_t *draw_full(uint8_t style) {
+    uint16_t *buf = malloc(W * H * sizeof(uint16_t));
+    for (int i = 0; i < W * H; i++) buf[i] = CANARY;
+    moon_background_draw(buf, W, H, style, DISC_R, 0, H);
+    return buf;
+}
+
+static float dist_from_centre(int x, int y) {
+    float dx = (float)x - (W - 1) * 0.5f, dy = (float)y - (H - 1) * 0.5f;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+static void test_styles(void) {
+    uint16_t *black = draw_full(0);
+    long nonzero = 0;
+    for (int i = 0; i < W * H; i++) if (black[i]) nonzero++;
+    expect_int("style 0: all black", nonzero, 0);
+
+    uint16_t *stars = draw_full(1);
+    long lit = 0, non_grey = 0;
+    for (int i = 0; i < W * H; i++) {
+        uint16_t c = stars[i];
+        if (!c) continue;
+        lit++;
+        int r = c >> 11, g = (c >> 6) & 0x1f, b = c & 0x1f;  /* g: top 5 of 6 bits */
+        if (r != g || g != b) non_grey++;
+    }
+    expect_true("style 1: stars drawn", lit > 0 && lit <= (W * H) / 900);
+    expect_int("style 1: stars are grey", non_grey, 0);
+
+    uint16_t *halo = draw_full(2);
+    long outside_ring = 0, in_ring = 0;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            if (!halo[y * W + x]) continue;
+            float d = dist_from_centre(x, y);
+            if (d <= DISC_R - 0.01f || d >= DISC_R * 1.35f + 0.01f) outside_ring++;
+            else in_ring++;
+        }
+    }
+    expect_true("style 2: halo drawn", in_ring > 0);
+    expect_int("style 2: halo confined to [R, 1.35R]", outside_ring, 0);
+    expect_int("style 2: disc interior left black", halo[(H / 2) * W + W / 2], 0);
+
+    uint16_t *both = draw_full(3);
+    long star_kept = 0, star_total = 0;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            if (!stars[y * W + x]) continue;
+            float d = dist_from_centre(x, y);
+            if (d > DISC_R && d < DISC_R * 1.35f) continue;  /* brightened by halo */
+            star_total++;
+            if (both[y * W + x] == stars[y * W + x]) star_kept++;
+        }
+    }
+    expect_int("style 3: stars outside the ring unchanged", star_kept, star_total);
+
+    free(black);
+    free(stars);
+    free(halo);
+    free(both);
+}
+
+static void test_bands(void) {
+    uint16_t *full = draw_full(3);
+    static const int splits[] = { 1, 7, 60, 120, 121, 239 };
+    long mismatched = 0;
+    for (size_t i = 0; i < sizeof(splits) / sizeof(splits[0]); i++) {
+        uint16_t *buf = malloc(W * H * sizeof(uint16_t));
+        for (int p = 0; p < W * H; p++) buf[p] = CANARY;
+        moon_background_draw(buf, W, H, 3, DISC_R, splits[i], H);
+        moon_background_draw(buf, W, H, 3, DISC_R, 0, splits[i]);
+        if (memcmp(buf, full, W * H * sizeof(uint16_t)) != 0) mismatched++;
+        free(buf);
+    }
+    expect_int("two bands == one pass, at every split", mismatched, 0);
+
+    uint16_t *buf = malloc(W * H * sizeof(uint16_t));
+    for (int p = 0; p < W * H; p++) buf[p] = CANARY;
+    moon_background_draw(buf, W, H, 3, DISC_R, 100, 140);
+    long outside = 0, inside_bad = 0;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            uint16_t c = buf[y * W + x];
+            if (y < 100 || y >= 140) { if (c != CANARY) outside++; }
+            else if (c != full[y * W + x]) inside_bad++;
+        }
+    }
+    expect_int("band: rows outside the range untouched", outside, 0);
+    expect_int("band: rows inside match the full frame", inside_bad, 0);
+
+    moon_background_draw(buf, W, H, 3, DISC_R, 50, 50);
+    moon_background_draw(NULL, W, H, 3, DISC_R, 0, H);
+    expect_int("empty range / NULL buffer are no-ops", buf[50 * W], CANARY);
+
+    free(buf);
+    free(full);
+}
+
+static void test_table(void) {
+    static uint16_t a_px[1], b_px[1];
+    moon_bg_slot_t slots[2];
+    memset(slots, 0, sizeof(slots));
+    moon_bg_table_t t = { slots, 2, 0 };
+    moon_bg_key_t big = { .w = 720, .h = 720, .bg_style = 3, .disc_r = 333.0f };
+    moon_bg_key_t small = { .w = 240, .h = 240, .bg_style = 3, .disc_r = 111.0f };
+    moon_bg_key_t restyled = big;
+    restyled.bg_style = 1;
+
+    expect_int("empty table: miss", moon_bg_table_find(&t, &big), -1);
+    int s0 = moon_bg_table_claim(&t);
+    slots[s0].px = a_px;
+    slots[s0].key = big;
+    expect_int("hit after build", moon_bg_table_find(&t, &big), s0);
+
+    int s1 = moon_bg_table_claim(&t);
+    expect_true("second claim prefers the empty slot", s1 != s0);
+    slots[s1].px = b_px;
+    slots[s1].key = small;
+    expect_int("both sizes cached", moon_bg_table_find(&t, &small), s1);
+    expect_int("style change misses", moon_bg_table_find(&t, &restyled), -1);
+
+    /* big was used before small; touch big so small becomes LRU. */
+    moon_bg_table_find(&t, &big);
+    expect_int("full table evicts the LRU slot", moon_bg_table_claim(&t), s1);
+    slots[s1].key = restyled;
+    expect_int("rebuilt slot hits under its new key", moon_bg_table_find(&t, &restyled), s1);
+    expect_int("evicted key now misses", moon_bg_table_find(&t, &small), -1);
+
+    slots[s0].px = NULL;   /* allocation failed on rebuild */
+    expect_int("slot without pixels never hits", moon_bg_table_find(&t, &big), -1);
+    expect_int("claim reuses the emptied slot", moon_bg_table_claim(&t), s0);
+}
+
+int main(void) {
+    test_styles();
+    test_bands();
+    test_table();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,69 @@
+/* Host test for main/moon_bands.h — band split of a moon frame across cores.
+ *
+ * Covers: the moon page sizes (720 and the 240 drag size) split at the
+ * middle, every split row starts on a 128-byte line and lies within one
+ * aligned step below h/2, and degenerate frames render as a single band.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_moon_bands ...)).
+ */
+
+#include "moon_bands.h"
+
+#include <stdio.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void test_page_sizes(void) {
+    expect_int("720x720 splits at 360", moon_bands_split(720, 720), 360);
+    expect_int("240x240 (drag size) splits at 120", moon_bands_split(240, 240), 120);
+    expect_int("64-wide rows: any row is aligned", moon_bands_split(64, 101), 50);
+    expect_int("odd width needs 64-row steps", moon_bands_split(33, 200), 64);
+}
+
+static void test_alignment_sweep(void) {
+    int misaligned = 0, too_far = 0, past_half = 0;
+    for (int w = 1; w <= 800; w++) {
+        for (int h = 2; h <= 800; h += 7) {
+            int y = moon_bands_split(w, h);
+            long off = (long)y * w * 2;
+            if (off % MOON_BANDS_ALIGN_BYTES) misaligned++;
+            if (y > h / 2) past_half++;
+            /* Never more than one aligned step (<= 64 rows) short of h/2. */
+            if (h / 2 - y >= 64) too_far++;
+        }
+    }
+    expect_int("sweep: split rows start on a 128-byte line", misaligned, 0);
+    expect_int("sweep: split never below the middle row", past_half, 0);
+    expect_int("sweep: split within one step of the middle", too_far, 0);
+}
+
+static void test_degenerate(void) {
+    expect_int("zero width: single band", moon_bands_split(0, 720), 0);
+    expect_int("one row: single band", moon_bands_split(720, 1), 0);
+    expect_int("odd width, short frame: single band", moon_bands_split(33, 100), 0);
+    expect_true("negative height: single band", moon_bands_split(720, -4) == 0);
+}
+
+int main(void) {
+    test_page_sizes();
+    test_alignment_sweep();
+    test_degenerate();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
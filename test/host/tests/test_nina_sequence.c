@@ -9,12 +9,13 @@
  * Status=="RUNNING" (see test_take_many_exposures_not_matched below for
  * the current-behavior gap this leaves for other step types).
  *
- * fetch_sequence_counts_optional() calls http_get_json() (declared in
- * nina_client_internal.h, implemented in nina_client.c which is NOT
+ * fetch_sequence_counts_optional() calls http_get_json_stream() (declared
+ * in nina_client_internal.h, implemented in nina_client.c which is NOT
  * linked here), parse_iso8601() (same header/source split), and
  * nina_client_now_epoch() (declared in nina_client.h). All three are
- * mocked below: http_get_json() parses whatever fixture string the test
- * pointed s_mock_json at; parse_iso8601() is a stub returning 0 since no
+ * mocked below: http_get_json_stream() streams whatever fixture string the
+ * test pointed s_mock_json at into the caller's json_stream (through the
+ * real seq_index.c); parse_iso8601() is a stub returning 0 since no
  * fixture here relies on the ExpectedDateTime fallback path;
  * nina_client_now_epoch() mirrors the production time(NULL) fallback.
  *
@@ -26,6 +27,7 @@
 #include "cJSON.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
@@ -36,12 +38,15 @@
  * --------------------------------------------------------------------- */
 static const char *s_mock_json = NULL; /* NULL => simulate HTTP/parse failure */
 
-cJSON *http_get_json(const char *url) {
+bool http_get_json_stream(const char *url, json_stream_t *js, int64_t *date_epoch_out) {
     (void)url;
+    if (date_epoch_out) *date_epoch_out = 0;
     if (!s_mock_json) {
-        return NULL;
+        return false;
     }
-    return cJSON_Parse(s_mock_json); /* NULL on malformed JSON, same as prod */
+    json_stream_reset(js);
+    /* false on malformed JSON, same as prod */
+    return json_stream_feed(js, s_mock_json, strlen(s_mock_json)) && json_stream_finish(js);
 }
 
 time_t parse_iso8601(const char *str) {
@@ -70,6 +75,11 @@ static void expect_str(const char *label, const char *got, const char *want) {
     if (!ok) fails++;
 }
 
+static void expect_true(const char *label, int cond) {
+    printf("%-48s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
 static void expect_int(const char *label, int got, int want) {
     int ok = (got == want);
     printf("%-48s got=%d want=%d %s\n", label, got, want, ok ? "OK" : "FAIL");
@@ -88,7 +98,7 @@ static void reset_client(nina_client_t *c) {
 
 static void run_fetch(const char *json, nina_client_t *c) {
     s_mock_json = json;
-    fetch_sequence_counts_optional("http://fake-host/v2/api/", c);
+    fetch_sequence_counts_optional("http://fake-host/v2/api/", c, NULL);
     s_mock_json = NULL;
 }
 
@@ -259,15 +269,15 @@ static void test_nested_containers_deep(void) {
 }
 
 /* =======================================================================
- * (d) Malformed / truncated JSON must not crash: cJSON_Parse() fails and
- *     returns NULL, and fetch_sequence_counts_optional() must handle that
+ * (d) Malformed / truncated JSON must not crash: the stream parse fails
+ *     part-way, and fetch_sequence_counts_optional() must handle that
  *     gracefully (early return, client struct untouched). A second variant
  *     covers structurally-valid JSON with an unexpected type for "Response".
  * ======================================================================= */
 static void test_malformed_json_no_crash(void) {
     printf("\n-- test_malformed_json_no_crash --\n");
 
-    /* Truncated mid-object -> cJSON_Parse returns NULL. */
+    /* Truncated mid-object -> the stream never completes. */
     const char *truncated =
         "{\"Response\": [ { \"Name\": \"Targets_Container\", \"Items\": [ { \"Name\": ";
 
@@ -286,7 +296,7 @@ static void test_malformed_json_no_crash(void) {
 }
 
 /* =======================================================================
- * (e) Empty / null input: http_get_json() returning NULL outright (e.g.
+ * (e) Empty / null input: http_get_json_stream() failing outright (e.g.
  *     network failure), and structurally-valid JSON with an empty
  *     "Response" array (no Targets_Container present at all).
  * ======================================================================= */
@@ -295,8 +305,8 @@ static void test_empty_null_input(void) {
 
     nina_client_t c;
     reset_client(&c);
-    run_fetch(NULL, &c); /* s_mock_json stays NULL -> http_get_json() returns NULL */
-    expect_str("target_name untouched (http_get_json NULL)", c.target_name, "");
+    run_fetch(NULL, &c); /* s_mock_json stays NULL -> http_get_json_stream() fails */
+    expect_str("target_name untouched (fetch failed)", c.target_name, "");
 
     reset_client(&c);
     run_fetch("{\"Response\": []}", &c);
@@ -403,6 +413,45 @@ static void test_take_many_exposures_not_matched(void) {
     expect_float("exposure_total (NOT matched -- known limitation)", c.exposure_total, 0.0f, 0.01f);
 }
 
+/* =======================================================================
+ * (h) Poll state keeps the index between polls: a second poll where only
+ *     the counters moved reuses the walk but still reads the new values;
+ *     a status change (next Smart Exposure starts) re-walks.
+ * ======================================================================= */
+#define SEQ_FIXTURE(exp1_status, exp1_done, exp2_status, exp2_done)             \
+    "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":["            \
+    "{\"Name\":\"M42_Container\",\"Status\":\"RUNNING\",\"Items\":["        \
+    "{\"Name\":\"Smart Exposure\",\"Status\":\"" exp1_status "\","          \
+    "\"CompletedIterations\":" exp1_done ",\"Iterations\":10},"                \
+    "{\"Name\":\"Smart Exposure\",\"Status\":\"" exp2_status "\","          \
+    "\"CompletedIterations\":" exp2_done ",\"Iterations\":20}]}]}]}"
+
+static void test_cached_poll_state(void) {
+    printf("\n-- test_cached_poll_state --\n");
+    nina_poll_state_t state;
+    memset(&state, 0, sizeof(state));
+    nina_client_t c;
+    reset_client(&c);
+
+    s_mock_json = SEQ_FIXTURE("RUNNING", "3", "CREATED", "0");
+    fetch_sequence_counts_optional("http://fake-host/v2/api/", &c, &state);
+    expect_int("poll 1: exposure_count", c.exposure_count, 3);
+    expect_true("poll 1: index kept in poll state", state.seq_cache != NULL);
+
+    s_mock_json = SEQ_FIXTURE("RUNNING", "4", "CREATED", "0");
+    fetch_sequence_counts_optional("http://fake-host/v2/api/", &c, &state);
+    expect_int("poll 2 (same shape): exposure_count", c.exposure_count, 4);
+    expect_int("poll 2: exposure_iterations", c.exposure_iterations, 10);
+
+    s_mock_json = SEQ_FIXTURE("FINISHED", "10", "RUNNING", "1");
+    fetch_sequence_counts_optional("http://fake-host/v2/api/", &c, &state);
+    expect_int("poll 3 (second exposure running): exposure_count", c.exposure_count, 1);
+    expect_int("poll 3: exposure_iterations", c.exposure_iterations, 20);
+    s_mock_json = NULL;
+
+    free(state.seq_cache);
+}
+
 int main(void) {
     test_normal_running_smart_exposure();
     test_no_running_target();
@@ -411,6 +460,7 @@ int main(void) {
     test_empty_null_input();
     test_container_suffix_stripping();
     test_take_many_exposures_not_matched();
+    test_cached_poll_state();
 
     printf("\n%s (%d failures)\n", fails ? "TESTS FAILED" : "ALL TESTS PASSED", fails);
     return fails ? 1 : 0;
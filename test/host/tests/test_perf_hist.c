@@ -0,0 +1,145 @@
+/* Host test for main/perf_hist.c — log-scale latency histogram.
+ *
+ * Covers: bucket edges (exact below 4 us, two buckets per power of two,
+ * clamp to the last bucket), every duration landing in the bucket whose range
+ * contains it, percentiles of constant, uniform and long-tailed samples
+ * against the exact sorted values (within one bucket width), halving on
+ * 16-bit overflow keeping the percentiles, and the empty histogram.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_perf_hist ...)).
+ */
+
+#include "perf_hist.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+/* Estimate within the width of the exact value's bucket. */
+static int close_to(double est, int64_t exact) {
+    int b = perf_hist_bucket(exact);
+    double width = (double)(perf_hist_bucket_lo(b + 1) - perf_hist_bucket_lo(b));
+    if (b == PERF_HIST_BUCKETS - 1) return 1;
+    return fabs(est - (double)exact) <= width;
+}
+
+static int cmp_i64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int64_t exact_pct(const int64_t *sorted, int n, double pct) {
+    int rank = (int)ceil(pct / 100.0 * n);
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+static void test_buckets(void) {
+    expect_int("0 us -> bucket 0", perf_hist_bucket(0), 0);
+    expect_int("negative -> bucket 0", perf_hist_bucket(-5), 0);
+    expect_int("3 us -> bucket 3", perf_hist_bucket(3), 3);
+    expect_int("4 us -> bucket 4", perf_hist_bucket(4), 4);
+    expect_int("5 us -> bucket 4", perf_hist_bucket(5), 4);
+    expect_int("6 us -> bucket 5", perf_hist_bucket(6), 5);
+    expect_int("8 us -> bucket 6", perf_hist_bucket(8), 6);
+    expect_int("12 us -> bucket 7", perf_hist_bucket(12), 7);
+    expect_int("1 ms (1000 us) -> bucket 19", perf_hist_bucket(1000), 19);
+    expect_int("1 hour -> last bucket", perf_hist_bucket(3600LL * 1000000), PERF_HIST_BUCKETS - 1);
+    expect_int("bucket 7 starts at 12 us", perf_hist_bucket_lo(7), 12);
+    expect_int("last bucket starts at 12582912 us", perf_hist_bucket_lo(PERF_HIST_BUCKETS - 1), 12582912);
+
+    int bad = 0;
+    for (int64_t us = 0; us < (1 << 22); us += 1 + us / 64) {
+        int b = perf_hist_bucket(us);
+        if (us < perf_hist_bucket_lo(b) || us >= perf_hist_bucket_lo(b + 1)) bad++;
+    }
+    expect_int("every duration inside its bucket range", bad, 0);
+}
+
+static void check_percentiles(const char *name, int64_t *v, int n) {
+    perf_hist_t h;
+    memset(&h, 0, sizeof(h));
+    for (int i = 0; i < n; i++) perf_hist_add(&h, v[i]);
+    qsort(v, n, sizeof(v[0]), cmp_i64);
+
+    char label[64];
+    const double pcts[3] = { 50, 95, 99 };
+    for (int i = 0; i < 3; i++) {
+        snprintf(label, sizeof(label), "%s p%.0f within a bucket", name, pcts[i]);
+        expect_true(label, close_to(perf_hist_percentile(&h, pcts[i]), exact_pct(v, n, pcts[i])));
+    }
+}
+
+static void test_percentiles(void) {
+    enum { N = 10000 };
+    static int64_t v[N];
+
+    for (int i = 0; i < N; i++) v[i] = 250;
+    check_percentiles("constant 250 us:", v, N);
+
+    srand(1234);
+    for (int i = 0; i < N; i++) v[i] = 1000 + rand() % 9000;
+    check_percentiles("uniform 1-10 ms:", v, N);
+
+    /* UI lock wait shape: mostly ~200 us, 3% of waits 20-60 ms. */
+    for (int i = 0; i < N; i++) {
+        v[i] = (rand() % 100 < 97) ? 150 + rand() % 100 : 20000 + rand() % 40000;
+    }
+    check_percentiles("long tail:", v, N);
+
+    perf_hist_t h;
+    memset(&h, 0, sizeof(h));
+    for (int i = 0; i < 99; i++) perf_hist_add(&h, 100);
+    perf_hist_add(&h, 50000);
+    expect_true("p99 of 99x100us + 1x50ms stays at 100 us",
+                perf_hist_percentile(&h, 99) < 128);
+    expect_true("p100 finds the outlier", perf_hist_percentile(&h, 100) >= 32768);
+}
+
+static void test_overflow_halving(void) {
+    perf_hist_t h;
+    memset(&h, 0, sizeof(h));
+    for (int i = 0; i < 100000; i++) perf_hist_add(&h, (i % 10 == 0) ? 5000 : 100);
+    expect_true("no bucket wrapped", h.n[perf_hist_bucket(100)] > h.n[perf_hist_bucket(5000)]);
+    expect_true("total was halved", perf_hist_total(&h) < 100000);
+    expect_true("p50 still ~100 us", close_to(perf_hist_percentile(&h, 50), 100));
+    expect_true("p95 still ~5 ms", close_to(perf_hist_percentile(&h, 95), 5000));
+}
+
+static void test_empty(void) {
+    perf_hist_t h;
+    memset(&h, 0, sizeof(h));
+    expect_true("empty histogram percentile is 0", perf_hist_percentile(&h, 99) == 0.0);
+    expect_int("empty total", perf_hist_total(&h), 0);
+    perf_hist_add(&h, 7);
+    expect_true("single sample p50 in its bucket",
+                perf_hist_percentile(&h, 50) >= 6 && perf_hist_percentile(&h, 50) < 8);
+}
+
+int main(void) {
+    test_buckets();
+    test_percentiles();
+    test_overflow_halving();
+    test_empty();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,222 @@
+/* Host test for main/poll_sched.c — the deadline table behind the shared poll
+ * scheduler (poll_task.c).
+ *
+ * Covers: new jobs due immediately, earliest-deadline-first take, coalescing
+ * of deadlines inside the window (and not beyond it), a taken job hidden from
+ * other takers, next-due tracking, interval vs flat vs doubling backoff
+ * schedules and backoff reset on success, defer leaving backoff alone, kicks
+ * on idle and running jobs, run statistics, a full table, and a simulated
+ * hour of four pollers with and without coalescing.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_poll_sched ...)).
+ */
+
+#include "poll_sched.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long long got, long long want) {
+    int ok = (got == want);
+    printf("%-56s got=%lld want=%lld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void test_take_order(void) {
+    poll_sched_t s;
+    poll_sched_init(&s, 250);
+    expect_int("empty table: nothing due", poll_sched_take(&s, 0), -1);
+    expect_true("empty table: next due never", poll_sched_next_due(&s) == POLL_SCHED_NEVER);
+
+    int a = poll_sched_add(&s, "a", 1000);
+    int b = poll_sched_add(&s, "b", 1000);
+    expect_int("ids in order", a * 10 + b, 1);
+    expect_int("next due is add time", poll_sched_next_due(&s), 1000);
+
+    expect_int("take: first due job", poll_sched_take(&s, 1000), a);
+    expect_int("take: running job skipped", poll_sched_take(&s, 1000), b);
+    expect_int("take: both running, nothing left", poll_sched_take(&s, 1000), -1);
+    expect_true("next due ignores running jobs", poll_sched_next_due(&s) == POLL_SCHED_NEVER);
+
+    poll_sched_finish(&s, b, 1100, true, 500, 0, 0, 10);
+    poll_sched_finish(&s, a, 1200, true, 300, 0, 0, 20);
+    expect_int("a due at 1500 (earlier)", s.jobs[a].due_ms, 1500);
+    expect_int("b due at 1600", s.jobs[b].due_ms, 1600);
+    expect_int("next due is the earliest", poll_sched_next_due(&s), 1500);
+    expect_int("not due yet", poll_sched_take(&s, 1000), -1);
+    expect_int("earliest deadline first", poll_sched_take(&s, 1600), a);
+}
+
+static void test_coalesce(void) {
+    poll_sched_t s;
+    poll_sched_init(&s, 250);
+    int a = poll_sched_add(&s, "a", 0);
+    int b = poll_sched_add(&s, "b", 0);
+    int c = poll_sched_add(&s, "c", 0);
+    s.jobs[a].due_ms = 10000;
+    s.jobs[b].due_ms = 10200;   /* inside the window */
+    s.jobs[c].due_ms = 10300;   /* outside it */
+
+    expect_int("coalesce: nothing before the window", poll_sched_take(&s, 9700), -1);
+    expect_int("coalesce: due job", poll_sched_take(&s, 10000), a);
+    expect_int("coalesce: 200 ms early rides along", poll_sched_take(&s, 10000), b);
+    expect_int("coalesce: 300 ms early waits", poll_sched_take(&s, 10000), -1);
+    expect_int("coalesce: then runs on its own wakeup", poll_sched_take(&s, 10050), c);
+}
+
+static void test_backoff(void) {
+    poll_sched_t s;
+    poll_sched_init(&s, 0);
+    int j = poll_sched_add(&s, "j", 0);
+
+    /* Backoff disabled: failures retry at the interval. */
+    poll_sched_take(&s, 0);
+    expect_int("no backoff: fail waits interval",
+               poll_sched_finish(&s, j, 0, false, 5000, 0, 0, 1), 5000);
+    expect_int("no backoff: failure counted", s.jobs[j].failures, 1);
+
+    /* Doubling, capped. */
+    int64_t t = 5000;
+    const long want[] = { 1000, 2000, 4000, 8000, 8000 };
+    int doubling_ok = 1;
+    for (int i = 0; i < 5; i++) {
+        poll_sched_take(&s, t);
+        uint32_t w = poll_sched_finish(&s, j, t, false, 60000, 1000, 8000, 1);
+        doubling_ok &= (w == (uint32_t)want[i]) && s.jobs[j].due_ms == t + want[i];
+        t += w;
+    }
+    expect_true("backoff doubles to the cap", doubling_ok);
+
+    /* Success resets; the next failure starts over. */
+    poll_sched_take(&s, t);
+    expect_int("success waits interval", poll_sched_finish(&s, j, t, true, 60000, 1000, 8000, 1), 60000);
+    expect_int("success clears backoff", s.jobs[j].backoff_ms, 0);
+    t += 60000;
+    poll_sched_take(&s, t);
+    expect_int("first failure after success", poll_sched_finish(&s, j, t, false, 60000, 1000, 8000, 1), 1000);
+
+    /* Flat retry (weather): initial == max. */
+    poll_sched_t f;
+    poll_sched_init(&f, 0);
+    int w = poll_sched_add(&f, "weather", 0);
+    poll_sched_take(&f, 0);
+    expect_int("flat retry", poll_sched_finish(&f, w, 0, false, 900000, 60000, 60000, 1), 60000);
+    poll_sched_take(&f, 60000);
+    expect_int("flat retry stays flat", poll_sched_finish(&f, w, 60000, false, 900000, 60000, 60000, 1), 60000);
+
+    /* Defer keeps the backoff state. */
+    uint32_t before = s.jobs[j].backoff_ms;
+    t += 1000;
+    expect_int("defer: job taken", poll_sched_take(&s, t), j);
+    poll_sched_defer(&s, j, t, 1000);
+    expect_int("defer: due after the delay", s.jobs[j].due_ms, t + 1000);
+    expect_int("defer: backoff untouched", s.jobs[j].backoff_ms, before);
+    expect_true("defer: no longer running", !s.jobs[j].running);
+    expect_int("defer of an idle job is ignored",
+               (poll_sched_defer(&s, j, 0, 1), s.jobs[j].due_ms), t + 1000);
+}
+
+static void test_kick(void) {
+    poll_sched_t s;
+    poll_sched_init(&s, 0);
+    int j = poll_sched_add(&s, "j", 0);
+    poll_sched_take(&s, 0);
+    poll_sched_finish(&s, j, 100, true, 60000, 0, 0, 100);
+
+    poll_sched_kick(&s, j, 5000);
+    expect_int("kick idle: due now", s.jobs[j].due_ms, 5000);
+    poll_sched_kick(&s, j, 7000);
+    expect_int("kick never postpones", s.jobs[j].due_ms, 5000);
+
+    expect_int("kicked job taken", poll_sched_take(&s, 5000), j);
+    poll_sched_kick(&s, j, 5100);
+    expect_true("kick while running is remembered", s.jobs[j].kicked);
+    poll_sched_finish(&s, j, 5400, true, 60000, 0, 0, 400);
+    expect_int("kick while running: due on finish", s.jobs[j].due_ms, 5400);
+    expect_true("kick flag consumed", !s.jobs[j].kicked);
+
+    poll_sched_take(&s, 5400);
+    poll_sched_finish(&s, j, 5500, true, 60000, 0, 0, 100);
+    expect_int("next run back on the interval", s.jobs[j].due_ms, 65500);
+
+    poll_sched_kick(&s, 7, 0);
+    poll_sched_kick(&s, -1, 0);
+    expect_int("bad ids ignored", s.count, 1);
+
+    expect_int("stats: runs", s.jobs[j].runs, 3);
+    expect_int("stats: busy total", (long long)s.jobs[j].busy_ms_total, 600);
+    expect_int("stats: busy max", s.jobs[j].busy_ms_max, 400);
+    expect_int("stats: busy last", s.jobs[j].busy_ms_last, 100);
+}
+
+static void test_full(void) {
+    poll_sched_t s;
+    poll_sched_init(&s, 0);
+    for (int i = 0; i < POLL_SCHED_MAX_JOBS; i++) poll_sched_add(&s, "x", 0);
+    expect_int("full table rejects add", poll_sched_add(&s, "y", 0), -1);
+}
+
+/* Four pollers at their usual intervals for an hour, one worker. Each next
+ * deadline counts from the end of a run, as the per-task loops did. JSON and
+ * HA share an interval but start 200 ms apart, so with coalescing they run
+ * off one wakeup. Returns the number of wakeups. */
+static int simulate_hour(uint32_t coalesce_ms, poll_sched_t *s) {
+    const uint32_t interval[] = { 30000, 10000, 10000, 900000 };
+    const uint32_t busy[]     = { 400, 150, 150, 1200 };
+    const int64_t  start[]    = { 0, 5000, 5200, 0 };
+    poll_sched_init(s, coalesce_ms);
+    for (int i = 0; i < 4; i++) poll_sched_add(s, "job", start[i]);
+
+    int wakeups = 0;
+    int64_t t = 0;
+    while (1) {
+        int64_t next = poll_sched_next_due(s);
+        if (next > t) t = next;
+        if (t >= 3600000) break;
+        wakeups++;
+        int id;
+        while ((id = poll_sched_take(s, t)) >= 0) {
+            t += busy[id];
+            poll_sched_finish(s, id, t, true, interval[id], 0, 0, busy[id]);
+        }
+    }
+    return wakeups;
+}
+
+static void test_simulated_hour(void) {
+    poll_sched_t s;
+    int separate = simulate_hour(0, &s);
+    expect_true("no coalescing: ha runs apart from json", separate > (int)(s.jobs[1].runs * 2));
+
+    int merged = simulate_hour(250, &s);
+    expect_true("allsky cadence kept", s.jobs[0].runs >= 118 && s.jobs[0].runs <= 120);
+    expect_true("json cadence kept", s.jobs[1].runs >= 350 && s.jobs[1].runs <= 360);
+    expect_int("ha runs with json", s.jobs[2].runs, s.jobs[1].runs);
+    expect_int("weather cadence kept", s.jobs[3].runs, 4);
+    expect_true("coalescing: one wakeup per json/ha pair",
+                merged < separate && merged <= (int)s.jobs[1].runs + 130);
+    printf("    %d wakeups without coalescing, %d with\n", separate, merged);
+}
+
+int main(void) {
+    test_take_order();
+    test_coalesce();
+    test_backoff();
+    test_kick();
+    test_full();
+    test_simulated_hour();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
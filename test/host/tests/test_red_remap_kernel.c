@@ -0,0 +1,145 @@
+/* Host test for main/red_remap_kernel.c — Red Night RGB565 remap kernels.
+ *
+ * Covers: the reference mapping on known colours, and that the packed-word
+ * and lookup-table kernels reproduce it for all 65536 pixel values, at every
+ * start alignment and for short tails (0..9 pixels), without touching
+ * memory outside the requested range.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_red_remap_kernel ...)).
+ */
+
+#include "red_remap_kernel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+#define ALL_PX   65536u
+#define GUARD    8          /* canary pixels either side of the range */
+#define CANARY   0xA5A5u
+
+static uint16_t all_in[ALL_PX];
+static uint16_t want_out[ALL_PX];
+
+static void test_reference(void) {
+    expect_int("px: black stays black", red_remap_px(0x0000), 0x0000);
+    expect_int("px: white -> full red", red_remap_px(0xFFFF), 0xF800);
+    expect_int("px: pure red -> dim red", red_remap_px(0xF800), (uint16_t)((((77 * 255) >> 8) >> 3) << 11));
+    expect_int("px: pure green -> brighter red", red_remap_px(0x07E0), (uint16_t)((((150 * 255) >> 8) >> 3) << 11));
+    expect_int("px: pure blue -> darkest red", red_remap_px(0x001F), (uint16_t)((((29 * 255) >> 8) >> 3) << 11));
+
+    int only_red = 1;
+    for (uint32_t px = 0; px < ALL_PX; px++) {
+        if (red_remap_px((uint16_t)px) & 0x07FF) only_red = 0;
+    }
+    expect_true("px: G and B always zero", only_red);
+}
+
+/* Run @p kernel over all 65536 values starting @p offset pixels into a
+ * guarded buffer; return mismatches (output or canaries). */
+static long run_exhaustive(void (*kernel)(uint16_t *, size_t, const uint16_t *),
+                           const uint16_t *lut, size_t offset) {
+    uint16_t *buf = malloc((ALL_PX + 2 * GUARD + 8) * sizeof(uint16_t));
+    if (!buf) return -1;
+    uint16_t *start = buf + GUARD + offset;
+    for (size_t i = 0; i < ALL_PX + 2 * GUARD + 8; i++) buf[i] = CANARY;
+    memcpy(start, all_in, sizeof(all_in));
+
+    kernel(start, ALL_PX, lut);
+
+    long bad = 0;
+    for (size_t i = 0; i < ALL_PX; i++) {
+        if (start[i] != want_out[i]) bad++;
+    }
+    for (size_t i = 0; i < GUARD + offset; i++) {
+        if (buf[i] != CANARY) bad++;
+    }
+    for (size_t i = 0; i < GUARD; i++) {
+        if (start[ALL_PX + i] != CANARY) bad++;
+    }
+    free(buf);
+    return bad;
+}
+
+static void packed_adapter(uint16_t *buf, size_t n, const uint16_t *lut) {
+    (void)lut;
+    red_remap_rgb565_packed(buf, n);
+}
+
+static void scalar_adapter(uint16_t *buf, size_t n, const uint16_t *lut) {
+    (void)lut;
+    red_remap_rgb565_scalar(buf, n);
+}
+
+static void test_exhaustive(void) {
+    static uint16_t lut[RED_REMAP_LUT_ENTRIES];
+    red_remap_lut_build(lut);
+    long lut_bad = 0;
+    for (uint32_t px = 0; px < ALL_PX; px++) {
+        if (lut[px] != want_out[px]) lut_bad++;
+    }
+    expect_int("lut: table matches reference", lut_bad, 0);
+
+    expect_int("scalar: all 65536 values", run_exhaustive(scalar_adapter, NULL, 0), 0);
+    char label[64];
+    for (size_t off = 0; off < 4; off++) {
+        snprintf(label, sizeof(label), "packed: all 65536 values, start +%zu px", off);
+        expect_int(label, run_exhaustive(packed_adapter, NULL, off), 0);
+    }
+    expect_int("lut: all 65536 values, start +1 px",
+               run_exhaustive(red_remap_rgb565_lut, lut, 1), 0);
+}
+
+static void test_short_runs(void) {
+    /* Lengths shorter than one unrolled block, at each start alignment, on a
+     * pattern that mixes every channel. */
+    long bad = 0;
+    for (size_t off = 0; off < 4; off++) {
+        for (size_t n = 0; n < 10; n++) {
+            uint16_t buf[32];
+            for (size_t i = 0; i < 32; i++) buf[i] = CANARY;
+            for (size_t i = 0; i < n; i++) buf[off + i] = (uint16_t)(0x9E37u * (i + 1) + off);
+            uint16_t want[32];
+            memcpy(want, buf, sizeof(buf));
+            for (size_t i = 0; i < n; i++) want[off + i] = red_remap_px(want[off + i]);
+            red_remap_rgb565_packed(buf + off, n);
+            if (memcmp(buf, want, sizeof(buf)) != 0) bad++;
+        }
+    }
+    expect_int("packed: lengths 0..9 at offsets 0..3", bad, 0);
+
+    red_remap_rgb565_packed(NULL, 4);
+    red_remap_rgb565_lut(NULL, 4, NULL);
+    expect_true("NULL buffers are ignored", 1);
+}
+
+int main(void) {
+    for (uint32_t px = 0; px < ALL_PX; px++) {
+        all_in[px] = (uint16_t)px;
+        want_out[px] = red_remap_px((uint16_t)px);
+    }
+
+    test_reference();
+    test_exhaustive();
+    test_short_runs();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
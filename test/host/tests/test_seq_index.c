@@ -0,0 +1,274 @@
+/* Host test for main/seq_index.c — flattened /sequence/json index.
+ *
+ * Covers: preorder node table with parent / child / sibling links, Name /
+ * Status / counters captured whichever order the keys arrive in, byte-by-byte
+ * feeding, Items nested under a trigger (not a sequence item) ignored,
+ * Conditions attached to their item and their scope, shape hashes that ignore
+ * counters but see a status change, the cached walk (reused across a value-only
+ * change, shifted when Targets_Container moves, re-walked on a status change),
+ * RUNNING-only descent for the Smart Exposure search, capacity truncation, and
+ * a stream reset mid-document.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_seq_index ...)).
+ */
+
+#include "seq_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = (strcmp(got, want) == 0);
+    printf("%-56s got=\"%s\" want=\"%s\" %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+/* Build @p idx from @p doc, @p chunk bytes at a time (0 = all at once). */
+static bool build(seq_index_t *idx, const char *doc, size_t chunk) {
+    json_stream_t js;
+    json_stream_init(&js, seq_index_stream_cb, idx);
+    json_stream_reset(&js);
+    size_t len = strlen(doc);
+    if (chunk == 0) chunk = len;
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = len - off < chunk ? len - off : chunk;
+        if (!json_stream_feed(&js, doc + off, n)) return false;
+    }
+    return json_stream_finish(&js);
+}
+
+static int find(const seq_index_t *idx, const char *name) {
+    for (int i = 0; i < idx->count; i++) {
+        if (strcmp(seq_index_name(idx, i), name) == 0) return i;
+    }
+    return SEQ_NO_NODE;
+}
+
+/* Start container, then a Targets_Container with two targets: M31 finished,
+ * M42 running Smart Exposure #2 of a filter loop. Status and Name come after
+ * Items on M42 to check key order does not matter. */
+#define DOC(m42_done, m42_exp_status, extra_start)                                   \
+    "{\"Response\":["                                                                \
+    "{\"Name\":\"Start_Container\",\"Status\":\"FINISHED\",\"Items\":["               \
+    "{\"Name\":\"Cool Camera\",\"Status\":\"FINISHED\"}" extra_start "]},"            \
+    "{\"Name\":\"Targets_Container\",\"Status\":\"RUNNING\",\"Items\":["              \
+    "{\"Name\":\"M31_Container\",\"Status\":\"FINISHED\",\"Items\":["                 \
+    "{\"Name\":\"Smart Exposure\",\"Status\":\"FINISHED\",\"CompletedIterations\":10}]},"\
+    "{\"Conditions\":[{\"Name\":\"Horizon Condition\",\"RemainingTime\":\"1:30:00\"},"   \
+    "{\"Name\":\"Time Condition\",\"ExpectedDateTime\":\"2026-01-01T04:00:00\"}],"       \
+    "\"Triggers\":[{\"Name\":\"AF After Filter\",\"TriggerRunner\":{\"Items\":["        \
+    "{\"Name\":\"Run Autofocus\",\"Status\":\"CREATED\"}]}}],"                          \
+    "\"Items\":["                                                                     \
+    "{\"Name\":\"Loop_Container\",\"Status\":\"RUNNING\","                             \
+    "\"Conditions\":[{\"Name\":\"Loop Condition\",\"RemainingTime\":\"0:45:00\"}],"    \
+    "\"Items\":["                                                                     \
+    "{\"Name\":\"Smart Exposure\",\"Status\":\"FINISHED\",\"CompletedIterations\":5},"  \
+    "{\"Name\":\"Smart Exposure\",\"Status\":\"" m42_exp_status "\","                  \
+    "\"CompletedIterations\":" m42_done ",\"Iterations\":20,\"ExposureCount\":7,"       \
+    "\"ExposureTime\":120.5,\"Items\":["                                              \
+    "{\"Name\":\"Switch Filter\",\"Status\":\"FINISHED\"},"                            \
+    "{\"Name\":\"Take Exposure\",\"Status\":\"" m42_exp_status "\"}]}]},"              \
+    "{\"Name\":\"Park_Container\",\"Status\":\"CREATED\","                             \
+    "\"Conditions\":[{\"Name\":\"Dawn Condition\",\"RemainingTime\":\"3:00:00\"}],"     \
+    "\"Items\":[]},"                                                                  \
+    "{\"Name\":\"Skipped_Container\",\"Status\":\"SKIPPED\","                          \
+    "\"Conditions\":[{\"Name\":\"Other\",\"RemainingTime\":\"0:01:00\"}],\"Items\":[]}" \
+    "],\"Status\":\"RUNNING\",\"Name\":\"M42_Container\"}]}"                           \
+    "],\"Success\":true}"
+
+static void test_build(void) {
+    seq_index_t *idx = malloc(sizeof(*idx));
+    expect_true("build: whole document", build(idx, DOC("3", "RUNNING", ""), 0));
+    expect_true("build: not truncated", !idx->truncated);
+
+    /* Start, Cool, Targets, M31, SE, M42, Loop, SE, SE, Switch, Take, Park, Skipped */
+    expect_int("build: item count (trigger Items excluded)", idx->count, 13);
+    expect_int("build: no trigger runner item", find(idx, "Run Autofocus"), SEQ_NO_NODE);
+    expect_int("build: Targets_Container found", idx->targets, 2);
+
+    int m42 = find(idx, "M42_Container");
+    const seq_node_t *n = &idx->nodes[m42];
+    expect_int("build: M42 parent", n->parent, idx->targets);
+    expect_int("build: M42 level", n->level, 1);
+    expect_int("build: M42 status (after Items)", n->status, SEQ_STATUS_RUNNING);
+    expect_true("build: M42 is a container", n->flags & SEQ_NODE_CONTAINER);
+    expect_true("build: M42 has RUNNING below", n->flags & SEQ_NODE_RUNNING_BELOW);
+    expect_int("build: M31 next sibling is M42", idx->nodes[find(idx, "M31_Container")].next_sibling, m42);
+    expect_str("build: M42 first child", seq_index_name(idx, n->first_child), "Loop_Container");
+    expect_true("build: finished M31 has no RUNNING below",
+                !(idx->nodes[find(idx, "M31_Container")].flags & SEQ_NODE_RUNNING_BELOW));
+    expect_true("build: empty Items is still a container",
+                idx->nodes[find(idx, "Park_Container")].flags & SEQ_NODE_CONTAINER);
+
+    expect_int("conds: count", idx->cond_count, 5);
+    expect_int("conds: first belongs to M42", idx->conds[0].node, m42);
+    expect_int("conds: RemainingTime parsed", idx->conds[0].remaining_s, 5400);
+    expect_int("conds: no RemainingTime", idx->conds[1].remaining_s, -1);
+    expect_str("conds: ExpectedDateTime kept", idx->conds[1].expected, "2026-01-01T04:00:00");
+    expect_true("scope: target's own", seq_index_cond_in_scope(idx, m42, 0));
+    expect_true("scope: RUNNING child container", seq_index_cond_in_scope(idx, m42, 2));
+    expect_true("scope: CREATED child container", seq_index_cond_in_scope(idx, m42, 3));
+    expect_true("scope: SKIPPED child excluded", !seq_index_cond_in_scope(idx, m42, 4));
+    expect_true("scope: outside the root", !seq_index_cond_in_scope(idx, find(idx, "M31_Container"), 0));
+
+    /* Byte-by-byte feeding builds the same index */
+    seq_index_t *bytes = malloc(sizeof(*bytes));
+    expect_true("bytewise: builds", build(bytes, DOC("3", "RUNNING", ""), 1));
+    expect_int("bytewise: same count", bytes->count, idx->count);
+    expect_true("bytewise: same target hash",
+                bytes->nodes[bytes->targets].hash == idx->nodes[idx->targets].hash);
+    free(bytes);
+    free(idx);
+}
+
+static void test_walk(void) {
+    seq_index_t *idx = malloc(sizeof(*idx));
+    seq_walk_t w;
+    seq_walk_reset(&w);
+
+    build(idx, DOC("3", "RUNNING", ""), 0);
+    expect_true("walk 1: walked", seq_index_walk(idx, &w));
+    expect_str("walk 1: target", seq_index_name(idx, w.target), "M42_Container");
+    /* Smart Exposure is itself a container (its Items are the instructions) */
+    expect_str("walk 1: container (deepest RUNNING)", seq_index_name(idx, w.container), "Smart Exposure");
+    expect_int("walk 1: container is the running one", w.container, w.smart_exposure);
+    expect_str("walk 1: step (leaf)", seq_index_name(idx, w.step), "Take Exposure");
+    expect_int("walk 1: smart exposure is the running one",
+               idx->nodes[w.smart_exposure].completed_iterations, 3);
+    expect_int("walk 1: iterations", idx->nodes[w.smart_exposure].iterations, 20);
+    expect_int("walk 1: exposure count", idx->nodes[w.smart_exposure].exposure_count, 7);
+    expect_true("walk 1: exposure time", idx->nodes[w.smart_exposure].exposure_time == 120.5f);
+    uint32_t shape = idx->nodes[idx->targets].hash;
+
+    /* Only a counter moved: same shape, walk reused, new value read */
+    build(idx, DOC("4", "RUNNING", ""), 0);
+    expect_true("walk 2: counter change keeps the shape", idx->nodes[idx->targets].hash == shape);
+    expect_true("walk 2: reused", !seq_index_walk(idx, &w));
+    expect_int("walk 2: reads the new counter", idx->nodes[w.smart_exposure].completed_iterations, 4);
+
+    /* An extra item before Targets_Container moves it; picks follow */
+    build(idx, DOC("5", "RUNNING", ",{\"Name\":\"Unpark\",\"Status\":\"FINISHED\"}"), 0);
+    expect_true("walk 3: reused after Targets_Container moved", !seq_index_walk(idx, &w));
+    expect_str("walk 3: target follows", seq_index_name(idx, w.target), "M42_Container");
+    expect_str("walk 3: step follows", seq_index_name(idx, w.step), "Take Exposure");
+    expect_int("walk 3: counter follows", idx->nodes[w.smart_exposure].completed_iterations, 5);
+
+    /* Smart Exposure finished: shape changes, re-walk finds no running one */
+    build(idx, DOC("20", "FINISHED", ""), 0);
+    expect_true("walk 4: status change changes the shape", idx->nodes[idx->targets].hash != shape);
+    expect_true("walk 4: re-walked", seq_index_walk(idx, &w));
+    expect_int("walk 4: no running smart exposure", w.smart_exposure, SEQ_NO_NODE);
+    expect_str("walk 4: step falls back to the container", seq_index_name(idx, w.step), "Loop_Container");
+
+    /* Nothing to walk */
+    build(idx, "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":[]}]}", 0);
+    expect_true("walk 5: empty targets not walked", !seq_index_walk(idx, &w));
+    expect_int("walk 5: no target", w.target, SEQ_NO_NODE);
+    expect_true("walk 5: cache cleared", !w.valid);
+    free(idx);
+}
+
+static void test_fallbacks(void) {
+    seq_index_t *idx = malloc(sizeof(*idx));
+    seq_walk_t w;
+    seq_walk_reset(&w);
+
+    /* No RUNNING target: last FINISHED wins, with its last FINISHED container */
+    build(idx,
+          "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":["
+          "{\"Name\":\"A_Container\",\"Status\":\"FINISHED\",\"Items\":[]},"
+          "{\"Name\":\"B_Container\",\"Status\":\"FINISHED\",\"Items\":["
+          "{\"Name\":\"B1_Container\",\"Status\":\"FINISHED\",\"Items\":[]},"
+          "{\"Name\":\"B2_Container\",\"Status\":\"FINISHED\",\"Items\":[]}]},"
+          "{\"Name\":\"C_Container\",\"Status\":\"CREATED\",\"Items\":[]}]}]}", 0);
+    seq_index_walk(idx, &w);
+    expect_str("fallback: last FINISHED target", seq_index_name(idx, w.target), "B_Container");
+    expect_str("fallback: last FINISHED container", seq_index_name(idx, w.container), "B2_Container");
+    expect_int("fallback: no step", w.step, SEQ_NO_NODE);
+
+    /* Nothing RUNNING or FINISHED: the first target */
+    build(idx,
+          "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":["
+          "{\"Name\":\"X_Container\",\"Status\":\"CREATED\",\"Items\":[]},"
+          "{\"Name\":\"Y_Container\",\"Status\":\"CREATED\",\"Items\":[]}]}]}", 0);
+    seq_index_walk(idx, &w);
+    expect_str("fallback: first target", seq_index_name(idx, w.target), "X_Container");
+    expect_int("fallback: no container", w.container, SEQ_NO_NODE);
+    free(idx);
+}
+
+static void test_limits(void) {
+    seq_index_t *idx = malloc(sizeof(*idx));
+
+    /* More items than the index holds: keeps the first ones, flags the rest */
+    size_t cap = 64 + (SEQ_INDEX_MAX_NODES + 8) * 40;
+    char *doc = malloc(cap);
+    size_t n = (size_t)snprintf(doc, cap, "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":[");
+    for (int i = 0; i < SEQ_INDEX_MAX_NODES + 4; i++) {
+        n += (size_t)snprintf(doc + n, cap - n, "%s{\"Name\":\"T%d\",\"Status\":\"CREATED\"}",
+                              i ? "," : "", i);
+    }
+    snprintf(doc + n, cap - n, "]}]}");
+    expect_true("limits: oversized document still parses", build(idx, doc, 0));
+    expect_true("limits: truncated", idx->truncated);
+    expect_int("limits: full node table", idx->count, SEQ_INDEX_MAX_NODES);
+    free(doc);
+
+    /* Ten container levels deep (22 path segments) fit the stream depth */
+    char deep[2048];
+    n = (size_t)snprintf(deep, sizeof(deep), "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":[");
+    for (int i = 0; i < 9; i++) {
+        n += (size_t)snprintf(deep + n, sizeof(deep) - n,
+                              "{\"Name\":\"L%d\",\"Status\":\"RUNNING\",\"Items\":[", i);
+    }
+    n += (size_t)snprintf(deep + n, sizeof(deep) - n, "{\"Name\":\"Leaf\",\"Status\":\"RUNNING\"}");
+    for (int i = 0; i < 9; i++) n += (size_t)snprintf(deep + n, sizeof(deep) - n, "]}");
+    snprintf(deep + n, sizeof(deep) - n, "]}]}");
+    expect_true("limits: ten levels deep parses", build(idx, deep, 0));
+    seq_walk_t w;
+    seq_walk_reset(&w);
+    seq_index_walk(idx, &w);
+    expect_str("limits: deep step", seq_index_name(idx, w.step), "Leaf");
+    expect_str("limits: deepest container", seq_index_name(idx, w.container), "L8");
+
+    /* A reset mid-document (transport retry) starts over */
+    json_stream_t js;
+    json_stream_init(&js, seq_index_stream_cb, idx);
+    const char *part = "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":[{\"Name\":\"Half";
+    json_stream_feed(&js, part, strlen(part));
+    json_stream_reset(&js);
+    const char *full = "{\"Response\":[{\"Name\":\"Targets_Container\",\"Items\":[{\"Name\":\"Z\"}]}]}";
+    expect_true("reset: second attempt parses",
+                json_stream_feed(&js, full, strlen(full)) && json_stream_finish(&js));
+    expect_int("reset: only the second attempt's items", idx->count, 2);
+    expect_str("reset: item name", seq_index_name(idx, 1), "Z");
+    free(idx);
+}
+
+int main(void) {
+    test_build();
+    test_walk();
+    test_fallbacks();
+    test_limits();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
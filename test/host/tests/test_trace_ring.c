@@ -0,0 +1,240 @@
+/* Host test for main/trace_ring.c — lock-free timeline event ring behind trace.c.
+ *
+ * Covers: init validation, events read back in order with every field intact,
+ * wraparound keeping the newest lap, a reader stopping at the head it opened
+ * at, clear, an unpublished (preempted) slot being skipped and counted,
+ * Chrome trace-event JSON for begin/end/instant events (name escaping,
+ * too-small buffer), and the rendered trace parsing as balanced B/E pairs.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_trace_ring ...)).
+ */
+
+#include "trace_ring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = strcmp(got, want) == 0;
+    printf("%-56s %s\n", label, ok ? "OK" : "FAIL");
+    if (!ok) {
+        printf("    got:  \"%s\"\n    want: \"%s\"\n", got, want);
+        fails++;
+    }
+}
+
+static void record(trace_ring_t *r, char ph, const char *name, int64_t ts, uint32_t tid, int32_t arg) {
+    trace_event_t ev = { .ts_us = ts, .name = name, .tid = tid, .arg = arg,
+                         .phase = (uint8_t)ph, .core = (uint8_t)(tid & 1) };
+    trace_ring_record(r, &ev);
+}
+
+static void test_init(void) {
+    trace_ring_t r;
+    static trace_slot_t slots[64];
+    expect_true("non power of two rejected", !trace_ring_init(&r, slots, 48));
+    expect_true("too small rejected", !trace_ring_init(&r, slots, 8));
+    expect_true("NULL slots rejected", !trace_ring_init(&r, NULL, 64));
+    expect_true("64 slots accepted", trace_ring_init(&r, slots, 64));
+
+    trace_ring_reader_t rd;
+    trace_event_t ev;
+    trace_ring_reader_init(&rd, &r);
+    expect_true("empty ring reads nothing", !trace_ring_reader_next(&rd, &r, &ev));
+}
+
+static void test_order_and_fields(void) {
+    trace_ring_t r;
+    static trace_slot_t slots[32];
+    trace_ring_init(&r, slots, 32);
+
+    record(&r, 'B', "ui_update", 1000, 7, 0);
+    record(&r, 'i', "ws_event", 1100, 3, 42);
+    record(&r, 'E', "ui_update", 1500, 7, 0);
+
+    trace_ring_reader_t rd;
+    trace_event_t ev;
+    trace_ring_reader_init(&rd, &r);
+    int ok = trace_ring_reader_next(&rd, &r, &ev);
+    expect_true("first event is the begin", ok && ev.phase == 'B' && ev.ts_us == 1000);
+    expect_str("  name kept by pointer", ev.name, "ui_update");
+    ok = trace_ring_reader_next(&rd, &r, &ev);
+    expect_true("instant keeps tid, core and arg",
+                ok && ev.phase == 'i' && ev.tid == 3 && ev.core == 1 && ev.arg == 42);
+    ok = trace_ring_reader_next(&rd, &r, &ev);
+    expect_true("then the end", ok && ev.phase == 'E' && ev.ts_us == 1500);
+    expect_true("then nothing", !trace_ring_reader_next(&rd, &r, &ev));
+    expect_int("nothing lost", rd.lost, 0);
+    expect_int("recorded count", trace_ring_recorded(&r), 3);
+}
+
+static void test_wrap_and_end(void) {
+    trace_ring_t r;
+    static trace_slot_t slots[16];
+    trace_ring_init(&r, slots, 16);
+    for (int i = 0; i < 100; i++) record(&r, 'i', "tick", i, 1, i);
+
+    trace_ring_reader_t rd;
+    trace_event_t ev;
+    trace_ring_reader_init(&rd, &r);
+    record(&r, 'i', "late", 1000, 1, 1000);     /* after open: not returned */
+
+    int n = 0, in_order = 1, first = -1, last = -1;
+    while (trace_ring_reader_next(&rd, &r, &ev)) {
+        if (first < 0) first = ev.arg;
+        if (last >= 0 && ev.arg != last + 1) in_order = 0;
+        last = ev.arg;
+        n++;
+    }
+    /* The late write overwrote the oldest slot of the lap being read. */
+    expect_int("reads one lap minus the overwritten slot", n, 15);
+    expect_int("  starting after it", first, 85);
+    expect_int("  ending at the head it opened at", last, 99);
+    expect_true("  in order", in_order);
+    expect_int("  the overwritten one counted lost", rd.lost, 1);
+}
+
+static void test_clear(void) {
+    trace_ring_t r;
+    static trace_slot_t slots[16];
+    trace_ring_init(&r, slots, 16);
+    record(&r, 'i', "old", 1, 1, 0);
+    record(&r, 'i', "old", 2, 1, 0);
+    trace_ring_clear(&r);
+    record(&r, 'i', "new", 3, 1, 0);
+
+    trace_ring_reader_t rd;
+    trace_event_t ev;
+    trace_ring_reader_init(&rd, &r);
+    int ok = trace_ring_reader_next(&rd, &r, &ev);
+    expect_true("clear hides earlier events", ok && strcmp(ev.name, "new") == 0);
+    expect_true("  and only those", !trace_ring_reader_next(&rd, &r, &ev));
+}
+
+static void test_unpublished_skipped(void) {
+    trace_ring_t r;
+    static trace_slot_t slots[16];
+    trace_ring_init(&r, slots, 16);
+    record(&r, 'i', "a", 1, 1, 0);
+    /* A writer preempted between its reservation and its publish. */
+    atomic_fetch_add(&r.head, 1);
+    record(&r, 'i', "c", 3, 1, 0);
+
+    trace_ring_reader_t rd;
+    trace_event_t ev;
+    trace_ring_reader_init(&rd, &r);
+    int n = 0;
+    const char *names[3] = { 0 };
+    while (trace_ring_reader_next(&rd, &r, &ev)) names[n++] = ev.name;
+    expect_int("unpublished slot skipped", n, 2);
+    expect_true("  around it", n == 2 && names[0][0] == 'a' && names[1][0] == 'c');
+    expect_int("  and counted", rd.lost, 1);
+}
+
+static void test_json(void) {
+    char buf[TRACE_RING_JSON_MAX];
+    trace_event_t ev = { .ts_us = 123456789, .name = "ui_update", .tid = 1070000000u,
+                         .arg = -3, .phase = TRACE_PH_BEGIN, .core = 1 };
+    trace_ring_format_json(&ev, 1, buf, sizeof(buf));
+    expect_str("begin event",
+               buf, "{\"name\":\"ui_update\",\"ph\":\"B\",\"ts\":123456789,\"pid\":1,"
+                    "\"tid\":1070000000,\"args\":{\"core\":1,\"v\":-3}}");
+
+    ev.phase = TRACE_PH_INSTANT;
+    ev.name = "ws \"IMAGE\\SAVE\"\n";
+    ev.arg = 4;
+    trace_ring_format_json(&ev, 1, buf, sizeof(buf));
+    expect_str("instant: thread scope, escaped name",
+               buf, "{\"name\":\"ws \\\"IMAGE\\\\SAVE\\\"\",\"ph\":\"i\",\"s\":\"t\","
+                    "\"ts\":123456789,\"pid\":1,\"tid\":1070000000,"
+                    "\"args\":{\"core\":1,\"v\":4}}");
+
+    char longname[200];
+    memset(longname, '"', sizeof(longname) - 1);
+    longname[sizeof(longname) - 1] = '\0';
+    ev.name = longname;
+    ev.ts_us = INT64_MAX;
+    ev.tid = UINT32_MAX;
+    ev.arg = INT32_MIN;
+    size_t n = trace_ring_format_json(&ev, UINT32_MAX, buf, sizeof(buf));
+    expect_true("worst case fits TRACE_RING_JSON_MAX", n > 0 && n < sizeof(buf));
+
+    ev.name = "x";
+    expect_int("too small a buffer returns 0", trace_ring_format_json(&ev, 1, buf, 16), 0);
+    expect_str("  and leaves it empty", buf, "");
+}
+
+/* Render a whole ring the way the /api/trace handler does and check that the
+ * begin/end pairs of every task balance. */
+static void test_render_balanced(void) {
+    trace_ring_t r;
+    static trace_slot_t slots[256];
+    trace_ring_init(&r, slots, 256);
+    int64_t t = 0;
+    for (int i = 0; i < 20; i++) {
+        record(&r, 'i', "ws_event", t++, 2, 5);
+        record(&r, 'B', "fetch_thumbnail", t++, 4, 0);
+        record(&r, 'B', "ui_update", t++, 5, 0);
+        record(&r, 'B', "ui_lock_wait", t++, 5, 0);
+        record(&r, 'E', "ui_lock_wait", t++, 5, 0);
+        record(&r, 'E', "ui_update", t++, 5, 0);
+        record(&r, 'E', "fetch_thumbnail", t++, 4, 0);
+    }
+
+    static char out[256 * TRACE_RING_JSON_MAX];
+    size_t len = 0;
+    trace_ring_reader_t rd;
+    trace_event_t ev;
+    trace_ring_reader_init(&rd, &r);
+    while (trace_ring_reader_next(&rd, &r, &ev)) {
+        if (len) out[len++] = ',';
+        len += trace_ring_format_json(&ev, 1, out + len, sizeof(out) - len);
+    }
+    out[len] = '\0';
+
+    int depth4 = 0, depth5 = 0, min_depth = 0, events = 0;
+    for (const char *p = out; (p = strstr(p, "\"ph\":\"")) != NULL; p += 6) {
+        char ph = p[6];
+        const char *tid = strstr(p, "\"tid\":");
+        int t_id = tid ? atoi(tid + 6) : -1;
+        int delta = ph == 'B' ? 1 : ph == 'E' ? -1 : 0;
+        if (t_id == 4) depth4 += delta;
+        if (t_id == 5) depth5 += delta;
+        if (depth4 < min_depth) min_depth = depth4;
+        if (depth5 < min_depth) min_depth = depth5;
+        events++;
+    }
+    expect_int("rendered every event", events, 140);
+    expect_true("begin/end balanced per task", depth4 == 0 && depth5 == 0 && min_depth == 0);
+}
+
+int main(void) {
+    test_init();
+    test_order_and_fields();
+    test_wrap_and_end();
+    test_clear();
+    test_unpublished_skipped();
+    test_json();
+    test_render_balanced();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
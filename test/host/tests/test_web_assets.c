@@ -0,0 +1,186 @@
+/* Host test for generate_web_assets.py and main/web_assets.c — the gzip table
+ * the web UI pages are served from.
+ *
+ * The table is generated from the real main/ HTML pages at build time (see
+ * the add_custom_command in test/host/CMakeLists.txt), exactly as the
+ * firmware build does. Covers: every page present with its content type, the
+ * gzip bodies inflating back to the source files byte for byte (with the
+ * version token substituted in config_ui.html only), the bodies actually
+ * being smaller, distinct quoted ETags, lookup by name, and If-None-Match
+ * matching (lists, weak validators, "*").
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_web_assets ...)).
+ */
+
+#include "web_assets.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static char *read_file(const char *name, size_t *len) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/main/%s", NINA_REPO_ROOT, name);
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = malloc((size_t)n + 1);
+    if (fread(buf, 1, (size_t)n, f) != (size_t)n) n = 0;
+    fclose(f);
+    buf[n] = '\0';
+    *len = (size_t)n;
+    return buf;
+}
+
+/* Inflate a gzip stream; returns a malloc'd buffer or NULL. */
+static char *gunzip(const uint8_t *gz, size_t gz_len, size_t *out_len) {
+    size_t cap = gz_len * 16 + 1024;
+    char *out = malloc(cap);
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (inflateInit2(&zs, 16 + MAX_WBITS) != Z_OK) { free(out); return NULL; }
+    zs.next_in = (Bytef *)gz;
+    zs.avail_in = (uInt)gz_len;
+    zs.next_out = (Bytef *)out;
+    zs.avail_out = (uInt)cap;
+    int rc = inflate(&zs, Z_FINISH);
+    *out_len = zs.total_out;
+    inflateEnd(&zs);
+    if (rc != Z_STREAM_END) { free(out); return NULL; }
+    return out;
+}
+
+/* Replace every __WEB_ASSETS_VERSION__ in @p src with the build's version. */
+static char *substitute_version(const char *src, size_t *len) {
+    static const char token[] = "__WEB_ASSETS_VERSION__";
+    size_t tlen = sizeof(token) - 1, vlen = strlen(web_assets_version);
+    char *out = malloc(*len * 2 + 1);
+    size_t o = 0;
+    for (size_t i = 0; i < *len;) {
+        if (i + tlen <= *len && memcmp(src + i, token, tlen) == 0) {
+            memcpy(out + o, web_assets_version, vlen);
+            o += vlen;
+            i += tlen;
+        } else {
+            out[o++] = src[i++];
+        }
+    }
+    *len = o;
+    return out;
+}
+
+static const char *const k_pages[] = {
+    "config_ui.html", "login.html", "setup_ui.html",
+    "fragment_logs.html", "fragment_backup.html", "fragment_api.html",
+    "fragment_allsky.html", "fragment_json.html", "fragment_ha.html",
+    "fragment_clock.html", "fragment_spotify.html", "fragment_image_display.html",
+    "fragment_nodes.html", "fragment_display.html", "fragment_behavior.html",
+    "fragment_system.html",
+};
+#define PAGE_COUNT (sizeof(k_pages) / sizeof(k_pages[0]))
+
+static void test_table(void) {
+    expect_int("one asset per page", (long)web_assets_count, (long)PAGE_COUNT);
+    expect_int("version is 16 hex digits", (long)strlen(web_assets_version), 16);
+
+    int found = 0, html = 0, round_trip = 0, smaller = 0, substituted = 0;
+    size_t raw_total = 0, gz_total = 0;
+    for (size_t i = 0; i < PAGE_COUNT; i++) {
+        const web_asset_t *a = web_asset_find(k_pages[i]);
+        if (!a) {
+            printf("    missing %s\n", k_pages[i]);
+            continue;
+        }
+        found++;
+        html += strcmp(a->content_type, "text/html") == 0;
+
+        size_t src_len = 0, out_len = 0;
+        char *src = read_file(k_pages[i], &src_len);
+        char *out = gunzip(a->gz, a->gz_len, &out_len);
+        if (src && out) {
+            size_t want_len = src_len;
+            char *want = substitute_version(src, &want_len);
+            if (want_len == out_len && memcmp(want, out, out_len) == 0) round_trip++;
+            else printf("    %s does not inflate to its source\n", k_pages[i]);
+            if (want_len != src_len || memcmp(want, src, src_len) != 0) substituted++;
+            smaller += a->gz_len < src_len;
+            raw_total += src_len;
+            gz_total += a->gz_len;
+            free(want);
+        }
+        free(src);
+        free(out);
+    }
+    expect_int("every page in the table", found, (long)PAGE_COUNT);
+    expect_int("  served as text/html", html, (long)PAGE_COUNT);
+    expect_int("  inflates back to its source", round_trip, (long)PAGE_COUNT);
+    expect_int("  compressed smaller", smaller, (long)PAGE_COUNT);
+    expect_int("version token only in config_ui.html", substituted, 1);
+    printf("    %zu -> %zu bytes (%.0f%%)\n", raw_total, gz_total,
+           raw_total ? 100.0 * (double)gz_total / (double)raw_total : 0.0);
+
+    const web_asset_t *cfg = web_asset_find("config_ui.html");
+    size_t n = 0;
+    char *page = cfg ? gunzip(cfg->gz, cfg->gz_len, &n) : NULL;
+    char needle[64];
+    snprintf(needle, sizeof(needle), "&v=%s'", web_assets_version);
+    expect_true("config page requests versioned fragments", page && strstr(page, needle));
+    free(page);
+}
+
+static void test_etags(void) {
+    int quoted = 1, distinct = 1;
+    for (size_t i = 0; i < web_assets_count; i++) {
+        const char *e = web_assets[i].etag;
+        size_t len = strlen(e);
+        quoted &= len > 2 && e[0] == '"' && e[len - 1] == '"';
+        for (size_t j = 0; j < i; j++) distinct &= strcmp(e, web_assets[j].etag) != 0;
+    }
+    expect_true("ETags are quoted", quoted);
+    expect_true("ETags are distinct", distinct);
+    expect_true("unknown name not found", web_asset_find("nope.html") == NULL);
+    expect_true("NULL name not found", web_asset_find(NULL) == NULL);
+}
+
+static void test_if_none_match(void) {
+    const char *etag = "\"0123456789abcdef\"";
+    expect_true("exact match", web_asset_etag_matches("\"0123456789abcdef\"", etag));
+    expect_true("match in a list",
+                web_asset_etag_matches("\"aaaa\", \"0123456789abcdef\" ,\"bbbb\"", etag));
+    expect_true("weak validator matches",
+                web_asset_etag_matches("W/\"0123456789abcdef\"", etag));
+    expect_true("wildcard matches", web_asset_etag_matches(" * ", etag));
+    expect_true("other tag does not match", !web_asset_etag_matches("\"0123456789abcdee\"", etag));
+    expect_true("prefix does not match", !web_asset_etag_matches("\"0123456789abcdef", etag));
+    expect_true("empty header does not match", !web_asset_etag_matches("", etag));
+    expect_true("NULL header does not match", !web_asset_etag_matches(NULL, etag));
+}
+
+int main(void) {
+    test_table();
+    test_etags();
+    test_if_none_match();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
@@ -0,0 +1,290 @@
+/* Host test for main/ws_event.c — incremental NINA WebSocket event decoder.
+ *
+ * Covers: Event-name classification (exact names, ERROR-AF vs the ERROR*
+ * family, unknown names), the generated perfect-hash table (every row found
+ * through it -- a failure here means re-run generate_ws_event_hash.py --
+ * near-miss names rejected) and the per-row dispatch metadata, IMAGE-SAVE statistics capture whichever order the
+ * keys arrive in, byte-by-byte feeding, early READY for payload-free events
+ * (trailing bytes never parsed), FILTERWHEEL-CHANGED New.Name, IsSafe and
+ * type-mismatched values, and INVALID for malformed JSON or a missing Event.
+ *
+ * Build: see test/host/CMakeLists.txt (add_nina_host_test(test_ws_event ...)).
+ */
+
+#include "ws_event.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static int fails = 0;
+
+static void expect_true(const char *label, int cond) {
+    printf("%-56s %s\n", label, cond ? "OK" : "FAIL");
+    if (!cond) fails++;
+}
+
+static void expect_int(const char *label, long got, long want) {
+    int ok = (got == want);
+    printf("%-56s got=%ld want=%ld %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static void expect_str(const char *label, const char *got, const char *want) {
+    int ok = (strcmp(got, want) == 0);
+    printf("%-56s got=\"%s\" want=\"%s\" %s\n", label, got, want, ok ? "OK" : "FAIL");
+    if (!ok) fails++;
+}
+
+static ws_event_status_t decode_all(ws_event_decoder_t *d, const char *json) {
+    ws_event_decoder_begin(d);
+    ws_event_status_t st = ws_event_decoder_feed(d, json, strlen(json));
+    if (st == WS_EVENT_MORE) st = ws_event_decoder_finish(d);
+    return st;
+}
+
+static ws_event_status_t decode_bytewise(ws_event_decoder_t *d, const char *json) {
+    ws_event_decoder_begin(d);
+    ws_event_status_t st = WS_EVENT_MORE;
+    for (size_t i = 0; json[i] && st == WS_EVENT_MORE; i++) {
+        st = ws_event_decoder_feed(d, &json[i], 1);
+    }
+    if (st == WS_EVENT_MORE) st = ws_event_decoder_finish(d);
+    return st;
+}
+
+static void test_classify(void) {
+    expect_int("classify: IMAGE-SAVE", ws_event_classify("IMAGE-SAVE"), WS_EVT_IMAGE_SAVE);
+    expect_int("classify: ROTATOR-MOVED-MECHANICAL",
+               ws_event_classify("ROTATOR-MOVED-MECHANICAL"), WS_EVT_ROTATOR_MOVED);
+    expect_int("classify: ERROR-AF is autofocus failure",
+               ws_event_classify("ERROR-AF"), WS_EVT_AUTOFOCUS_FAILED);
+    expect_int("classify: other ERROR* is generic error",
+               ws_event_classify("ERROR-PLATESOLVE"), WS_EVT_ERROR);
+    expect_int("classify: unknown", ws_event_classify("FOO-BAR"), WS_EVT_UNKNOWN);
+    expect_int("classify: NULL", ws_event_classify(NULL), WS_EVT_UNKNOWN);
+    expect_true("payload: IMAGE-SAVE needs it", ws_event_type_needs_payload(WS_EVT_IMAGE_SAVE));
+    expect_true("payload: GUIDER-DITHER does not",
+                !ws_event_type_needs_payload(WS_EVT_GUIDER_DITHER));
+}
+
+static const char *k_image_save =
+    "{\"Response\":{\"ImageStatistics\":{\"ExposureTime\":180.0,\"Index\":7,"
+    "\"Filter\":\"Ha\",\"RmsText\":\"0.5\",\"Temperature\":-10.0,"
+    "\"CameraName\":\"ZWO ASI2600MM Pro\",\"Gain\":100,\"Offset\":50,"
+    "\"Date\":\"2026-10-16T02:11:00Z\",\"TelescopeName\":\"Askar FRA400\","
+    "\"FocalLength\":400,\"StDev\":95.5,\"Mean\":1001.25,\"Median\":990,"
+    "\"Min\":112,\"Max\":65535,\"Stars\":1234,\"HFR\":2.125,\"HFRStDev\":0.5,"
+    "\"IsBayered\":false,\"TargetName\":\"M 31\",\"Filename\":\"C:\\\\img\\\\a.fits\","
+    "\"ImageType\":\"LIGHT\"},\"Event\":\"IMAGE-SAVE\"},"
+    "\"Error\":\"\",\"StatusCode\":200,\"Success\":true,\"Type\":\"Socket\"}";
+
+static void test_lookup_table(void) {
+    size_t n = 0;
+    const ws_event_info_t *rows = ws_event_info_table(&n);
+    expect_true("table: has rows", n > 50);
+
+    size_t found = 0, dup = 0, bad_meta = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (ws_event_lookup(rows[i].name) == &rows[i]) found++;
+        for (size_t j = i + 1; j < n; j++) {
+            if (strcmp(rows[i].name, rows[j].name) == 0) dup++;
+        }
+        /* Equipment events re-poll and toast under connect/disconnect;
+         * everything else has no equipment. */
+        bool is_conn = strstr(rows[i].name, "-CONNECTED") != NULL;
+        bool is_disc = strstr(rows[i].name, "-DISCONNECTED") != NULL;
+        if (is_conn || is_disc) {
+            if (rows[i].equipment < 0 || rows[i].equipment >= WS_EQ_COUNT ||
+                rows[i].connected != is_conn || !(rows[i].wake & WS_WAKE_POLL) ||
+                rows[i].toast_mask != WS_TOAST_BIT(is_conn ? WS_TOAST_CONNECT : WS_TOAST_DISCONNECT))
+                bad_meta++;
+        } else if (rows[i].equipment != WS_EQ_NONE) {
+            bad_meta++;
+        }
+        if (rows[i].needs_payload != ws_event_type_needs_payload(rows[i].type)) bad_meta++;
+    }
+    expect_int("table: every row found through the hash", (long)found, (long)n);
+    expect_int("table: no duplicate names", (long)dup, 0);
+    expect_int("table: metadata consistent", (long)bad_meta, 0);
+
+    /* Near misses share a slot's neighbourhood but must not match */
+    expect_int("lookup: prefix of a name", ws_event_classify("IMAGE-SAV"), WS_EVT_UNKNOWN);
+    expect_int("lookup: name plus suffix", ws_event_classify("IMAGE-SAVED"), WS_EVT_UNKNOWN);
+    expect_int("lookup: lower case", ws_event_classify("image-save"), WS_EVT_UNKNOWN);
+    expect_int("lookup: empty", ws_event_classify(""), WS_EVT_UNKNOWN);
+
+    const ws_event_info_t *info = ws_event_lookup("CAMERA-DISCONNECTED");
+    expect_int("info: camera disconnect equipment", info->equipment, WS_EQ_CAMERA);
+    expect_true("info: camera disconnect not connected", !info->connected);
+    info = ws_event_lookup("AUTOFOCUS-FAILED");
+    expect_int("info: AF failed toasts as autofocus or error", info->toast_mask,
+               WS_TOAST_BIT(WS_TOAST_AUTOFOCUS) | WS_TOAST_BIT(WS_TOAST_ERRORS));
+    expect_int("info: dome shutter wakes nobody", ws_event_lookup("DOME-SHUTTER-OPENED")->wake, 0);
+    expect_int("info: IMAGE-SAVE wakes UI and poll", ws_event_lookup("IMAGE-SAVE")->wake,
+               WS_WAKE_UI | WS_WAKE_POLL);
+    info = ws_event_lookup("ERROR-PLATESOLVE");
+    expect_int("info: ERROR* toasts as error", info->toast_mask, WS_TOAST_BIT(WS_TOAST_ERRORS));
+    expect_int("info: ERROR* wakes nobody", info->wake, 0);
+    info = ws_event_lookup("FOO-BAR");
+    expect_int("info: unknown wakes UI and poll", info->wake, WS_WAKE_UI | WS_WAKE_POLL);
+    expect_true("info: NULL is not NULL", ws_event_lookup(NULL) != NULL);
+
+    /* Every type has a report name */
+    size_t unnamed = 0;
+    for (int t = 0; t < WS_EVT_COUNT; t++) {
+        const char *name = ws_event_type_name((ws_event_type_t)t);
+        if (!name || !name[0]) unnamed++;
+    }
+    expect_int("name: every type named", (long)unnamed, 0);
+    expect_str("name: alias type uses first row", ws_event_type_name(WS_EVT_ROTATOR_MOVED),
+               "ROTATOR-MOVED");
+    expect_str("name: generic error", ws_event_type_name(WS_EVT_ERROR), "ERROR*");
+    expect_str("name: unknown", ws_event_type_name(WS_EVT_UNKNOWN), "UNKNOWN");
+
+    /* The decoder hands the row to the dispatcher */
+    ws_event_decoder_t d;
+    ws_event_decoder_begin(&d);
+    const char *json = "{\"Response\":{\"Event\":\"GUIDER-CONNECTED\"}}";
+    ws_event_decoder_feed(&d, json, strlen(json));
+    const ws_event_t *ev = ws_event_decoder_event(&d);
+    expect_true("decoder: info set", ev->info == ws_event_lookup("GUIDER-CONNECTED"));
+    expect_int("decoder: info equipment", ev->info->equipment, WS_EQ_GUIDER);
+}
+
+static void check_image_save(const char *prefix, ws_event_status_t st, const ws_event_t *ev) {
+    char label[64];
+    snprintf(label, sizeof(label), "%s: READY", prefix);
+    expect_int(label, st, WS_EVENT_READY);
+    snprintf(label, sizeof(label), "%s: type", prefix);
+    expect_int(label, ev->type, WS_EVT_IMAGE_SAVE);
+    snprintf(label, sizeof(label), "%s: stats present", prefix);
+    expect_true(label, (ev->fields & (WS_F_STATS | WS_F_HFR | WS_F_STARS | WS_F_IMAGE_TYPE)) ==
+                       (WS_F_STATS | WS_F_HFR | WS_F_STARS | WS_F_IMAGE_TYPE));
+    snprintf(label, sizeof(label), "%s: HFR/stars/exposure", prefix);
+    expect_true(label, fabsf(ev->stats.hfr - 2.125f) < 1e-6f && ev->stats.stars == 1234 &&
+                       fabsf(ev->stats.exposure_time - 180.0f) < 1e-6f);
+    snprintf(label, sizeof(label), "%s: ints", prefix);
+    expect_true(label, ev->stats.gain == 100 && ev->stats.offset == 50 &&
+                       ev->stats.min_val == 112 && ev->stats.max_val == 65535 &&
+                       ev->stats.focal_length == 400);
+    snprintf(label, sizeof(label), "%s: filter", prefix);
+    expect_str(label, ev->stats.filter, "Ha");
+    snprintf(label, sizeof(label), "%s: filename unescaped", prefix);
+    expect_str(label, ev->stats.filename, "C:\\img\\a.fits");
+    snprintf(label, sizeof(label), "%s: target is stats-level only", prefix);
+    expect_true(label, strcmp(ev->stats.target_name, "M 31") == 0 &&
+                       !(ev->fields & WS_F_TARGET_NAME));
+}
+
+static void test_image_save(void) {
+    ws_event_decoder_t d;
+    /* Event arrives after ImageStatistics: fields captured before classification */
+    ws_event_status_t st = decode_all(&d, k_image_save);
+    check_image_save("image-save", st, ws_event_decoder_event(&d));
+
+    st = decode_bytewise(&d, k_image_save);
+    check_image_save("image-save bytewise", st, ws_event_decoder_event(&d));
+
+    /* Mid-message split points land inside keys, strings and numbers */
+    int all_ok = 1;
+    size_t n = strlen(k_image_save);
+    for (size_t cut = 1; cut < n; cut += 7) {
+        ws_event_decoder_begin(&d);
+        st = ws_event_decoder_feed(&d, k_image_save, cut);
+        if (st == WS_EVENT_MORE) st = ws_event_decoder_feed(&d, k_image_save + cut, n - cut);
+        if (st == WS_EVENT_MORE) st = ws_event_decoder_finish(&d);
+        const ws_event_t *ev = ws_event_decoder_event(&d);
+        if (st != WS_EVENT_READY || ev->stats.stars != 1234 ||
+            strcmp(ev->stats.camera_name, "ZWO ASI2600MM Pro") != 0) all_ok = 0;
+    }
+    expect_true("image-save: every two-fragment split", all_ok);
+}
+
+static void test_early_ready(void) {
+    ws_event_decoder_t d;
+    const char *head = "{\"Response\":{\"Event\":\"GUIDER-DITHER\",";
+    ws_event_decoder_begin(&d);
+    ws_event_status_t st = ws_event_decoder_feed(&d, head, strlen(head));
+    expect_int("early: READY at Event", st, WS_EVENT_READY);
+    expect_int("early: type", ws_event_decoder_event(&d)->type, WS_EVT_GUIDER_DITHER);
+
+    /* The rest of the message is never parsed, even if it is garbage */
+    st = ws_event_decoder_feed(&d, "}}}}not json", 12);
+    expect_int("early: trailing bytes ignored", st, WS_EVENT_READY);
+    expect_int("early: finish stays READY", ws_event_decoder_finish(&d), WS_EVENT_READY);
+
+    st = decode_all(&d, "{\"Response\":{\"Event\":\"ERROR-PLATESOLVE\",\"Message\":\"x\"}}");
+    expect_int("early: ERROR* ready", st, WS_EVENT_READY);
+    expect_str("early: ERROR* name kept", ws_event_decoder_event(&d)->name, "ERROR-PLATESOLVE");
+
+    st = decode_all(&d, "{\"Response\":{\"Event\":\"SOMETHING-NEW\"}}");
+    expect_int("early: unknown still READY", st, WS_EVENT_READY);
+    expect_int("early: unknown type", ws_event_decoder_event(&d)->type, WS_EVT_UNKNOWN);
+}
+
+static void test_payload_fields(void) {
+    ws_event_decoder_t d = {0};
+    const ws_event_t *ev = ws_event_decoder_event(&d);
+
+    decode_bytewise(&d, "{\"Response\":{\"Event\":\"FILTERWHEEL-CHANGED\","
+                        "\"Previous\":{\"Name\":\"L\",\"Id\":0},\"New\":{\"Name\":\"OIII\",\"Id\":5}}}");
+    expect_true("filterwheel: New.Name present", ev->fields & WS_F_NEW_NAME);
+    expect_str("filterwheel: New.Name", ev->new_name, "OIII");
+
+    decode_all(&d, "{\"Response\":{\"Event\":\"SAFETY-CHANGED\",\"IsSafe\":true}}");
+    expect_true("safety: IsSafe true", (ev->fields & WS_F_IS_SAFE) && ev->is_safe);
+    decode_all(&d, "{\"Response\":{\"Event\":\"SAFETY-CHANGED\",\"IsSafe\":\"true\"}}");
+    expect_true("safety: string IsSafe not a bool", !(ev->fields & WS_F_IS_SAFE));
+
+    decode_all(&d, "{\"Response\":{\"Event\":\"AUTOFOCUS-POINT-ADDED\",\"Position\":10200,"
+                   "\"HFR\":1.95,\"Stars\":300}}");
+    expect_true("af point: Position/HFR",
+                (ev->fields & (WS_F_POSITION | WS_F_AF_HFR)) == (WS_F_POSITION | WS_F_AF_HFR) &&
+                ev->position == 10200 && fabsf(ev->af_hfr - 1.95f) < 1e-6f);
+    expect_true("af point: not mistaken for image stats", !(ev->fields & WS_F_HFR));
+
+    decode_all(&d, "{\"Response\":{\"Event\":\"ROTATOR-MOVED\",\"From\":1,\"To\":\"90\"}}");
+    expect_true("rotator: string To ignored", !(ev->fields & WS_F_TO));
+
+    decode_all(&d, "{\"Response\":{\"Event\":\"SEQUENCE-ENTITY-FAILED\","
+                   "\"Entity\":\"Center\",\"Error\":\"Plate solve failed\"},\"Error\":\"\"}");
+    expect_str("entity failed: Entity", ev->entity, "Center");
+    expect_str("entity failed: Response.Error, not root Error", ev->error, "Plate solve failed");
+
+    decode_all(&d, "{\"Response\":{\"Event\":\"TS-WAITSTART\",\"WaitStartTime\":\"2026-10-16T04:55:00Z\"}}");
+    expect_str("waitstart: time", ev->wait_start, "2026-10-16T04:55:00Z");
+}
+
+static void test_invalid(void) {
+    ws_event_decoder_t d;
+    expect_int("invalid: malformed", decode_all(&d, "{\"Response\":{\"Event\":"), WS_EVENT_INVALID);
+    expect_int("invalid: syntax error", decode_all(&d, "{\"Response\":{\"Event\" 1}}"),
+               WS_EVENT_INVALID);
+    expect_int("invalid: no Event", decode_all(&d, "{\"Response\":{\"TargetName\":\"x\"}}"),
+               WS_EVENT_INVALID);
+    expect_int("invalid: Event outside Response", decode_all(&d, "{\"Event\":\"IMAGE-SAVE\"}"),
+               WS_EVENT_INVALID);
+    expect_int("invalid: non-string Event", decode_all(&d, "{\"Response\":{\"Event\":5}}"),
+               WS_EVENT_INVALID);
+
+    /* A new message after a bad one decodes cleanly */
+    expect_int("invalid: decoder reusable",
+               decode_all(&d, "{\"Response\":{\"Event\":\"MOUNT-PARKED\"}}"), WS_EVENT_READY);
+}
+
+int main(void) {
+    test_classify();
+    test_lookup_table();
+    test_image_save();
+    test_early_ready();
+    test_payload_fields();
+    test_invalid();
+
+    if (fails) {
+        printf("\n%d FAILURE(S)\n", fails);
+        return 1;
+    }
+    printf("\nALL PASS\n");
+    return 0;
+}
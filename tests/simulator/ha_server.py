@@ -0,0 +1,245 @@
+"""Home Assistant stand-in — REST /api/states and the WebSocket API for the HA page.
+
+Serves a handful of drifting entities the way Home Assistant does, so the
+device's HA client can be exercised without a real HA install:
+
+    GET /api/states/<entity_id>     REST fallback (Bearer token)
+    GET /api/websocket              auth_required -> auth -> auth_ok, then
+                                    subscribe_entities: a result, the initial
+                                    {"a": ...} event, and {"c": ...} diffs as
+                                    entities change
+
+Point the device's ha_base_url at http://<this host>:<port> with the same
+token. --no-ws answers /api/websocket with 404 (REST fallback only),
+--drop-after closes every socket after N seconds (reconnect + backoff), and
+--legacy refuses subscribe_entities like HA before 2022.4.
+
+Usage: python3 tests/simulator/ha_server.py [--port 8123] [--token T]
+           [--interval S] [--no-ws] [--drop-after S] [--legacy]
+"""
+import argparse
+import asyncio
+import json
+import logging
+import random
+import time
+
+from aiohttp import web, WSMsgType
+
+logger = logging.getLogger(__name__)
+
+HA_VERSION = "2024.6.0"
+
+
+def _initial_entities() -> dict:
+    return {
+        "sensor.outdoor_temperature": {
+            "state": "12.4",
+            "attributes": {"unit_of_measurement": "°C", "device_class": "temperature",
+                           "friendly_name": "Outdoor Temperature"},
+        },
+        "sensor.outdoor_humidity": {
+            "state": "71",
+            "attributes": {"unit_of_measurement": "%", "friendly_name": "Outdoor Humidity"},
+        },
+        "binary_sensor.roof_open": {
+            "state": "off",
+            "attributes": {"device_class": "opening", "friendly_name": "Roof"},
+        },
+        "light.observatory_red": {
+            "state": "on",
+            "attributes": {"brightness": 40, "color_mode": "brightness",
+                           "friendly_name": "Observatory Red Light"},
+        },
+        "weather.home": {
+            "state": "clear-night",
+            "attributes": {"temperature": 12.4, "cloud_coverage": 5, "wind_speed": 7.2,
+                           "friendly_name": "Home"},
+        },
+    }
+
+
+class HaSimulatorServer:
+    """One Home Assistant stand-in instance."""
+
+    def __init__(self, bind_address: str = "0.0.0.0", port: int = 8123,
+                 token: str = "test-token", interval_s: float = 5.0,
+                 websocket: bool = True, drop_after_s: float = 0.0,
+                 legacy: bool = False, seed: int = 1):
+        self.bind_address = bind_address
+        self.port = port
+        self.token = token
+        self.interval_s = interval_s
+        self.websocket = websocket
+        self.drop_after_s = drop_after_s
+        self.legacy = legacy
+        self.rng = random.Random(seed)
+        self.entities = _initial_entities()
+        # ws -> (subscription id, subscribed entity ids)
+        self._subs: dict[web.WebSocketResponse, tuple[int, set[str]]] = {}
+        self._opened: dict[web.WebSocketResponse, float] = {}
+        self._runner: web.AppRunner | None = None
+        self._advance_task: asyncio.Task | None = None
+        self.stats = {"rest_requests": 0, "ws_connections": 0, "ws_events": 0}
+
+    async def start(self):
+        app = web.Application()
+        app.router.add_get("/api/states/{entity_id}", self._rest_state)
+        app.router.add_get("/api/websocket", self._websocket)
+        self._runner = web.AppRunner(app)
+        await self._runner.setup()
+        await web.TCPSite(self._runner, self.bind_address, self.port).start()
+        self._advance_task = asyncio.create_task(self._advance_loop())
+        logger.info(f"HA stand-in listening on {self.bind_address}:{self.port} "
+                    f"(websocket {'on' if self.websocket else 'off'})")
+
+    async def stop(self):
+        if self._advance_task:
+            self._advance_task.cancel()
+            try:
+                await self._advance_task
+            except asyncio.CancelledError:
+                pass
+        for ws in list(self._opened):
+            await ws.close()
+        self._subs.clear()
+        self._opened.clear()
+        if self._runner:
+            await self._runner.cleanup()
+
+    # -- REST -----------------------------------------------------------------
+
+    async def _rest_state(self, req: web.Request) -> web.Response:
+        self.stats["rest_requests"] += 1
+        if req.headers.get("Authorization") != f"Bearer {self.token}":
+            return web.json_response({"message": "Unauthorized"}, status=401)
+        entity_id = req.match_info["entity_id"]
+        ent = self.entities.get(entity_id)
+        if ent is None:
+            return web.json_response({"message": "Entity not found."}, status=404)
+        return web.json_response({"entity_id": entity_id, **ent})
+
+    # -- WebSocket API --------------------------------------------------------
+
+    async def _websocket(self, req: web.Request) -> web.StreamResponse:
+        if not self.websocket:
+            raise web.HTTPNotFound()
+        ws = web.WebSocketResponse()
+        await ws.prepare(req)
+        self.stats["ws_connections"] += 1
+        self._opened[ws] = time.monotonic()
+        authed = False
+        await ws.send_json({"type": "auth_required", "ha_version": HA_VERSION})
+
+        try:
+            async for msg in ws:
+                if msg.type != WSMsgType.TEXT:
+                    break
+                data = json.loads(msg.data)
+                if not authed:
+                    if data.get("type") == "auth" and data.get("access_token") == self.token:
+                        authed = True
+                        await ws.send_json({"type": "auth_ok", "ha_version": HA_VERSION})
+                    else:
+                        await ws.send_json({"type": "auth_invalid",
+                                            "message": "Invalid access token or password"})
+                        break
+                    continue
+                await self._command(ws, data)
+        finally:
+            self._subs.pop(ws, None)
+            self._opened.pop(ws, None)
+        return ws
+
+    async def _command(self, ws: web.WebSocketResponse, data: dict):
+        msg_id = data.get("id")
+        kind = data.get("type")
+        if kind == "ping":
+            await ws.send_json({"id": msg_id, "type": "pong"})
+        elif kind == "subscribe_entities" and not self.legacy:
+            ids = set(data.get("entity_ids") or self.entities)
+            self._subs[ws] = (msg_id, ids)
+            await ws.send_json({"id": msg_id, "type": "result", "success": True, "result": None})
+            added = {eid: self._compressed(self.entities[eid]) for eid in ids if eid in self.entities}
+            await self._send_event(ws, msg_id, {"a": added})
+        else:
+            await ws.send_json({"id": msg_id, "type": "result", "success": False,
+                                "error": {"code": "unknown_command", "message": "Unknown command."}})
+
+    @staticmethod
+    def _compressed(ent: dict) -> dict:
+        now = time.time()
+        return {"s": ent["state"], "a": ent["attributes"], "c": "01J0000000", "lc": now}
+
+    async def _send_event(self, ws: web.WebSocketResponse, sub_id: int, event: dict):
+        await ws.send_json({"id": sub_id, "type": "event", "event": event})
+        self.stats["ws_events"] += 1
+
+    # -- Entity drift -------------------------------------------------------
+
+    def _drift(self) -> dict:
+        """Change a couple of entities; returns {entity_id: diff} in "c" form."""
+        diffs = {}
+        temp = self.entities["sensor.outdoor_temperature"]
+        new_temp = f"{float(temp['state']) + self.rng.choice((-0.1, 0.0, 0.1)):.1f}"
+        if new_temp != temp["state"]:
+            temp["state"] = new_temp
+            diffs["sensor.outdoor_temperature"] = {"+": {"s": new_temp, "lc": time.time()}}
+        weather = self.entities["weather.home"]
+        clouds = max(0, min(100, weather["attributes"]["cloud_coverage"] + self.rng.randint(-3, 3)))
+        if clouds != weather["attributes"]["cloud_coverage"]:
+            weather["attributes"]["cloud_coverage"] = clouds
+            diffs["weather.home"] = {"+": {"a": {"cloud_coverage": clouds}, "lu": time.time()}}
+        if self.rng.random() < 0.1:
+            roof = self.entities["binary_sensor.roof_open"]
+            roof["state"] = "on" if roof["state"] == "off" else "off"
+            diffs["binary_sensor.roof_open"] = {"+": {"s": roof["state"], "lc": time.time()}}
+        return diffs
+
+    async def _advance_loop(self):
+        while True:
+            await asyncio.sleep(self.interval_s)
+            diffs = self._drift()
+            for ws, (sub_id, ids) in list(self._subs.items()):
+                mine = {eid: d for eid, d in diffs.items() if eid in ids}
+                if not mine:
+                    continue
+                try:
+                    await self._send_event(ws, sub_id, {"c": mine})
+                except Exception:
+                    self._subs.pop(ws, None)
+            if self.drop_after_s:
+                now = time.monotonic()
+                for ws, opened in list(self._opened.items()):
+                    if now - opened > self.drop_after_s:
+                        await ws.close()
+
+
+async def _main(args):
+    server = HaSimulatorServer(args.bind, args.port, args.token, args.interval,
+                               not args.no_ws, args.drop_after, args.legacy)
+    await server.start()
+    try:
+        while True:
+            await asyncio.sleep(30)
+            logger.info(f"stats: {server.stats}")
+    finally:
+        await server.stop()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--bind", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8123)
+    parser.add_argument("--token", default="test-token")
+    parser.add_argument("--interval", type=float, default=5.0,
+                        help="seconds between entity changes")
+    parser.add_argument("--no-ws", action="store_true", help="REST only (404 on /api/websocket)")
+    parser.add_argument("--drop-after", type=float, default=0.0,
+                        help="close WebSocket sessions after this many seconds")
+    parser.add_argument("--legacy", action="store_true", help="refuse subscribe_entities")
+    logging.basicConfig(level=logging.INFO, format="%(asctime)s %(message)s")
+    try:
+        asyncio.run(_main(parser.parse_args()))
+    except KeyboardInterrupt:
+        pass
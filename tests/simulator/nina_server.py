@@ -118,7 +118,14 @@ class NinaSimulatorServer:
 
         async def image_history(req):
             count_only = req.query.get("count", "").lower() == "true"
-            result = tl.get_image_history(count_only=count_only)
+            all_images = req.query.get("all", "").lower() == "true"
+            index = req.query.get("index")
+            result = tl.get_image_history(
+                count_only=count_only,
+                index=int(index) if index is not None and index.lstrip("-").isdigit() else None,
+                all_images=all_images,
+                image_type=req.query.get("imageType"),
+            )
             return web.json_response(_wrap(result))
 
         async def prepared_image(req):
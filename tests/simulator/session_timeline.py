@@ -427,17 +427,30 @@ class SessionTimeline:
             }],
         }]
 
-    def get_image_history(self, count_only: bool = False):
+    def get_image_history(self, count_only: bool = False, index: int | None = None,
+                          all_images: bool = False, image_type: str | None = None):
         self.requests_served += 1
+        # Every simulated frame is a LIGHT
+        history = self._image_history
+        if image_type and image_type.upper() != "LIGHT":
+            history = []
         if count_only:
-            return len(self._image_history)
-        # Return in reverse order (newest first) with firmware-expected field names
+            return len(history)
+        # Newest first (index 0 = newest) with firmware-expected field names
+        newest_first = list(reversed(history))
+        if index is not None:
+            selected = newest_first[index:index + 1] if index >= 0 else []
+        elif all_images:
+            selected = newest_first
+        else:
+            selected = newest_first[:50]
         result = []
-        for img in reversed(self._image_history[-50:]):
+        for img in selected:
             result.append({
                 "TargetName": img.get("Target", self._current_target),
                 "TelescopeName": self.telescope,
                 "ExposureTime": self.exposure_time,
+                "ImageType": "LIGHT",
                 "Filter": img.get("Filter", ""),
                 "HFR": img.get("HFR", 0),
                 "Stars": img.get("Stars", 0),